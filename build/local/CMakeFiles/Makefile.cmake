@@ -0,0 +1,100 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CMakeVersion.cmake"
+  "/root/repo/app/make.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/core/deps/http/make.cmake"
+  "/root/repo/core/deps/libuv.cmake"
+  "/root/repo/core/deps/mbedtls.cmake"
+  "/root/repo/core/deps/miniz/make.cmake"
+  "/root/repo/core/deps/mqtt/make.cmake"
+  "/root/repo/core/deps/networking/make.cmake"
+  "/root/repo/core/deps/quickjs.cmake"
+  "/root/repo/core/deps/util/make.cmake"
+  "/root/repo/core/js/make.cmake"
+  "/root/repo/core/js/version.json"
+  "/root/repo/core/make.cmake"
+  "/root/repo/core/tjs/make.cmake"
+  "/root/repo/core/tjs/src/version.h.in"
+  "/root/repo/modules/make.cmake"
+  "/root/repo/modules/networking/libcjson/make.cmake"
+  "/root/repo/modules/networking/libhttp/make.cmake"
+  "/root/repo/modules/networking/libjsonrpc/make.cmake"
+  "/root/repo/modules/networking/libmqtt/make.cmake"
+  "/root/repo/modules/networking/libutil/make.cmake"
+  "/root/repo/modules/networking/make.cmake"
+  "/root/repo/targets/local/make.cmake"
+  "/root/repo/targets/make.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "version.h"
+  "version.json"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/tjs_mbedtls.dir/DependInfo.cmake"
+  "CMakeFiles/tjs_quickjs.dir/DependInfo.cmake"
+  "CMakeFiles/tjs_uv.dir/DependInfo.cmake"
+  "CMakeFiles/tjs_http_parser.dir/DependInfo.cmake"
+  "CMakeFiles/tjs_mqtt_packet.dir/DependInfo.cmake"
+  "CMakeFiles/tjs_miniz.dir/DependInfo.cmake"
+  "CMakeFiles/tjs_util.dir/DependInfo.cmake"
+  "CMakeFiles/tjs_networking.dir/DependInfo.cmake"
+  "CMakeFiles/tjsc.dir/DependInfo.cmake"
+  "CMakeFiles/tjs_core.dir/DependInfo.cmake"
+  "CMakeFiles/tjs.dir/DependInfo.cmake"
+  "CMakeFiles/tjs_networking_util.dir/DependInfo.cmake"
+  "CMakeFiles/tjs_http.dir/DependInfo.cmake"
+  "CMakeFiles/tjs_cjson.dir/DependInfo.cmake"
+  "CMakeFiles/tjs_jsonrpc.dir/DependInfo.cmake"
+  "CMakeFiles/tjs_mqtt.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/build/local/app-js.c" "CMakeFiles/tjs.dir/app-js.c.o" "gcc" "CMakeFiles/tjs.dir/app-js.c.o.d"
+  "/root/repo/core/tjs/src/main.c" "CMakeFiles/tjs.dir/core/tjs/src/main.c.o" "gcc" "CMakeFiles/tjs.dir/core/tjs/src/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/local/CMakeFiles/tjs_core.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_miniz.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_mqtt_packet.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_http_parser.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_quickjs.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_networking.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_mbedtls.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_util.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_uv.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
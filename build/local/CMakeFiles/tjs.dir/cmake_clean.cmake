@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs.dir/app-js.c.o"
+  "CMakeFiles/tjs.dir/app-js.c.o.d"
+  "CMakeFiles/tjs.dir/core/tjs/src/main.c.o"
+  "CMakeFiles/tjs.dir/core/tjs/src/main.c.o.d"
+  "app-js.c"
+  "tjs"
+  "tjs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs_cjson.dir/modules/networking/libcjson/src/cJSON.c.o"
+  "CMakeFiles/tjs_cjson.dir/modules/networking/libcjson/src/cJSON.c.o.d"
+  "libtjs_cjson.a"
+  "libtjs_cjson.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs_cjson.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
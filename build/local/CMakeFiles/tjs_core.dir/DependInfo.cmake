@@ -0,0 +1,68 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/core/tjs/src/bootstrap.c" "CMakeFiles/tjs_core.dir/core/tjs/src/bootstrap.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/bootstrap.c.o.d"
+  "/root/repo/core/tjs/src/cli.c" "CMakeFiles/tjs_core.dir/core/tjs/src/cli.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/cli.c.o.d"
+  "/root/repo/core/tjs/src/codec.c" "CMakeFiles/tjs_core.dir/core/tjs/src/codec.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/codec.c.o.d"
+  "/root/repo/core/tjs/src/crypto.c" "CMakeFiles/tjs_core.dir/core/tjs/src/crypto.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/crypto.c.o.d"
+  "/root/repo/core/tjs/src/dns.c" "CMakeFiles/tjs_core.dir/core/tjs/src/dns.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/dns.c.o.d"
+  "/root/repo/core/tjs/src/dns_resolver.c" "CMakeFiles/tjs_core.dir/core/tjs/src/dns_resolver.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/dns_resolver.c.o.d"
+  "/root/repo/core/tjs/src/error.c" "CMakeFiles/tjs_core.dir/core/tjs/src/error.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/error.c.o.d"
+  "/root/repo/core/tjs/src/fs.c" "CMakeFiles/tjs_core.dir/core/tjs/src/fs.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/fs.c.o.d"
+  "/root/repo/core/tjs/src/gzip.c" "CMakeFiles/tjs_core.dir/core/tjs/src/gzip.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/gzip.c.o.d"
+  "/root/repo/core/tjs/src/hal.c" "CMakeFiles/tjs_core.dir/core/tjs/src/hal.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/hal.c.o.d"
+  "/root/repo/core/tjs/src/heap.c" "CMakeFiles/tjs_core.dir/core/tjs/src/heap.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/heap.c.o.d"
+  "/root/repo/core/tjs/src/http.c" "CMakeFiles/tjs_core.dir/core/tjs/src/http.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/http.c.o.d"
+  "/root/repo/core/tjs/src/http_server.c" "CMakeFiles/tjs_core.dir/core/tjs/src/http_server.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/http_server.c.o.d"
+  "/root/repo/core/tjs/src/internal_modules.c" "CMakeFiles/tjs_core.dir/core/tjs/src/internal_modules.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/internal_modules.c.o.d"
+  "/root/repo/core/tjs/src/json.c" "CMakeFiles/tjs_core.dir/core/tjs/src/json.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/json.c.o.d"
+  "/root/repo/core/tjs/src/logger.c" "CMakeFiles/tjs_core.dir/core/tjs/src/logger.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/logger.c.o.d"
+  "/root/repo/core/tjs/src/miniz.c" "CMakeFiles/tjs_core.dir/core/tjs/src/miniz.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/miniz.c.o.d"
+  "/root/repo/core/tjs/src/misc.c" "CMakeFiles/tjs_core.dir/core/tjs/src/misc.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/misc.c.o.d"
+  "/root/repo/core/tjs/src/modules.c" "CMakeFiles/tjs_core.dir/core/tjs/src/modules.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/modules.c.o.d"
+  "/root/repo/core/tjs/src/mqtt.c" "CMakeFiles/tjs_core.dir/core/tjs/src/mqtt.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/mqtt.c.o.d"
+  "/root/repo/core/tjs/src/mqtt_broker.c" "CMakeFiles/tjs_core.dir/core/tjs/src/mqtt_broker.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/mqtt_broker.c.o.d"
+  "/root/repo/core/tjs/src/os.c" "CMakeFiles/tjs_core.dir/core/tjs/src/os.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/os.c.o.d"
+  "/root/repo/core/tjs/src/process.c" "CMakeFiles/tjs_core.dir/core/tjs/src/process.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/process.c.o.d"
+  "/root/repo/core/tjs/src/profiler.c" "CMakeFiles/tjs_core.dir/core/tjs/src/profiler.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/profiler.c.o.d"
+  "/root/repo/core/tjs/src/signals.c" "CMakeFiles/tjs_core.dir/core/tjs/src/signals.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/signals.c.o.d"
+  "/root/repo/core/tjs/src/std.c" "CMakeFiles/tjs_core.dir/core/tjs/src/std.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/std.c.o.d"
+  "/root/repo/core/tjs/src/streams.c" "CMakeFiles/tjs_core.dir/core/tjs/src/streams.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/streams.c.o.d"
+  "/root/repo/core/tjs/src/streams_pipe.c" "CMakeFiles/tjs_core.dir/core/tjs/src/streams_pipe.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/streams_pipe.c.o.d"
+  "/root/repo/core/tjs/src/streams_tcp.c" "CMakeFiles/tjs_core.dir/core/tjs/src/streams_tcp.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/streams_tcp.c.o.d"
+  "/root/repo/core/tjs/src/streams_tls.c" "CMakeFiles/tjs_core.dir/core/tjs/src/streams_tls.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/streams_tls.c.o.d"
+  "/root/repo/core/tjs/src/streams_tty.c" "CMakeFiles/tjs_core.dir/core/tjs/src/streams_tty.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/streams_tty.c.o.d"
+  "/root/repo/core/tjs/src/timers.c" "CMakeFiles/tjs_core.dir/core/tjs/src/timers.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/timers.c.o.d"
+  "/root/repo/core/tjs/src/tls.c" "CMakeFiles/tjs_core.dir/core/tjs/src/tls.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/tls.c.o.d"
+  "/root/repo/core/tjs/src/uart.c" "CMakeFiles/tjs_core.dir/core/tjs/src/uart.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/uart.c.o.d"
+  "/root/repo/core/tjs/src/udp.c" "CMakeFiles/tjs_core.dir/core/tjs/src/udp.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/udp.c.o.d"
+  "/root/repo/core/tjs/src/utf8.c" "CMakeFiles/tjs_core.dir/core/tjs/src/utf8.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/utf8.c.o.d"
+  "/root/repo/core/tjs/src/util.c" "CMakeFiles/tjs_core.dir/core/tjs/src/util.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/util.c.o.d"
+  "/root/repo/core/tjs/src/utils.c" "CMakeFiles/tjs_core.dir/core/tjs/src/utils.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/utils.c.o.d"
+  "/root/repo/core/tjs/src/version.c" "CMakeFiles/tjs_core.dir/core/tjs/src/version.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/version.c.o.d"
+  "/root/repo/core/tjs/src/vm.c" "CMakeFiles/tjs_core.dir/core/tjs/src/vm.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/vm.c.o.d"
+  "/root/repo/core/tjs/src/worker.c" "CMakeFiles/tjs_core.dir/core/tjs/src/worker.c.o" "gcc" "CMakeFiles/tjs_core.dir/core/tjs/src/worker.c.o.d"
+  "/root/repo/build/local/tjs-js.c" "CMakeFiles/tjs_core.dir/tjs-js.c.o" "gcc" "CMakeFiles/tjs_core.dir/tjs-js.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/local/CMakeFiles/tjs_miniz.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_mqtt_packet.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_http_parser.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_quickjs.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_networking.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_util.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_uv.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_mbedtls.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
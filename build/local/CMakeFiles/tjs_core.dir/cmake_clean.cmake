@@ -0,0 +1,94 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs_core.dir/core/tjs/src/bootstrap.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/bootstrap.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/cli.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/cli.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/codec.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/codec.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/crypto.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/crypto.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/dns.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/dns.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/dns_resolver.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/dns_resolver.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/error.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/error.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/fs.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/fs.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/gzip.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/gzip.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/hal.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/hal.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/heap.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/heap.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/http.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/http.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/http_server.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/http_server.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/internal_modules.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/internal_modules.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/json.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/json.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/logger.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/logger.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/miniz.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/miniz.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/misc.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/misc.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/modules.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/modules.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/mqtt.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/mqtt.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/mqtt_broker.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/mqtt_broker.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/os.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/os.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/process.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/process.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/profiler.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/profiler.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/signals.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/signals.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/std.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/std.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/streams.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/streams.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/streams_pipe.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/streams_pipe.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/streams_tcp.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/streams_tcp.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/streams_tls.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/streams_tls.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/streams_tty.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/streams_tty.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/timers.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/timers.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/tls.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/tls.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/uart.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/uart.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/udp.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/udp.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/utf8.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/utf8.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/util.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/util.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/utils.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/utils.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/version.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/version.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/vm.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/vm.c.o.d"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/worker.c.o"
+  "CMakeFiles/tjs_core.dir/core/tjs/src/worker.c.o.d"
+  "CMakeFiles/tjs_core.dir/tjs-js.c.o"
+  "CMakeFiles/tjs_core.dir/tjs-js.c.o.d"
+  "libtjs_core.a"
+  "libtjs_core.pdb"
+  "tjs-js.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
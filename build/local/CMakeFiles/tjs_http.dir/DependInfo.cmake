@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/networking/libhttp/src/http-client.c" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-client.c.o" "gcc" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-client.c.o.d"
+  "/root/repo/modules/networking/libhttp/src/http-header-auth.c" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-auth.c.o" "gcc" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-auth.c.o.d"
+  "/root/repo/modules/networking/libhttp/src/http-header-authorization.c" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-authorization.c.o" "gcc" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-authorization.c.o.d"
+  "/root/repo/modules/networking/libhttp/src/http-header-content-type.c" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-content-type.c.o" "gcc" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-content-type.c.o.d"
+  "/root/repo/modules/networking/libhttp/src/http-header-expires.c" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-expires.c.o" "gcc" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-expires.c.o.d"
+  "/root/repo/modules/networking/libhttp/src/http-header-host.c" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-host.c.o" "gcc" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-host.c.o.d"
+  "/root/repo/modules/networking/libhttp/src/http-header-range.c" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-range.c.o" "gcc" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-range.c.o.d"
+  "/root/repo/modules/networking/libhttp/src/http-header-www-authenticate.c" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-www-authenticate.c.o" "gcc" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-www-authenticate.c.o.d"
+  "/root/repo/modules/networking/libhttp/src/http-parser.c" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-parser.c.o" "gcc" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-parser.c.o.d"
+  "/root/repo/modules/networking/libhttp/src/http-reason.c" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-reason.c.o" "gcc" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-reason.c.o.d"
+  "/root/repo/modules/networking/libhttp/src/http-request.c" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-request.c.o" "gcc" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-request.c.o.d"
+  "/root/repo/modules/networking/libhttp/src/http-server.c" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-server.c.o" "gcc" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-server.c.o.d"
+  "/root/repo/modules/networking/libhttp/src/rfc822-datetime.c" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/rfc822-datetime.c.o" "gcc" "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/rfc822-datetime.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/local/CMakeFiles/tjs_http_parser.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_networking_util.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_uv.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_networking.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_mbedtls.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_util.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
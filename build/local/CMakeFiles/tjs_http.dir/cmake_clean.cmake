@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-client.c.o"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-client.c.o.d"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-auth.c.o"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-auth.c.o.d"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-authorization.c.o"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-authorization.c.o.d"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-content-type.c.o"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-content-type.c.o.d"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-expires.c.o"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-expires.c.o.d"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-host.c.o"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-host.c.o.d"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-range.c.o"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-range.c.o.d"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-www-authenticate.c.o"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-header-www-authenticate.c.o.d"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-parser.c.o"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-parser.c.o.d"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-reason.c.o"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-reason.c.o.d"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-request.c.o"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-request.c.o.d"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-server.c.o"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/http-server.c.o.d"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/rfc822-datetime.c.o"
+  "CMakeFiles/tjs_http.dir/modules/networking/libhttp/src/rfc822-datetime.c.o.d"
+  "libtjs_http.a"
+  "libtjs_http.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs_http.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs_http_parser.dir/core/deps/http/src/http_parser.c.o"
+  "CMakeFiles/tjs_http_parser.dir/core/deps/http/src/http_parser.c.o.d"
+  "libtjs_http_parser.a"
+  "libtjs_http_parser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs_http_parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/networking/libjsonrpc/source/jsonrpc/client.c" "CMakeFiles/tjs_jsonrpc.dir/modules/networking/libjsonrpc/source/jsonrpc/client.c.o" "gcc" "CMakeFiles/tjs_jsonrpc.dir/modules/networking/libjsonrpc/source/jsonrpc/client.c.o.d"
+  "/root/repo/modules/networking/libjsonrpc/source/jsonrpc/server.c" "CMakeFiles/tjs_jsonrpc.dir/modules/networking/libjsonrpc/source/jsonrpc/server.c.o" "gcc" "CMakeFiles/tjs_jsonrpc.dir/modules/networking/libjsonrpc/source/jsonrpc/server.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/local/CMakeFiles/tjs_cjson.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_util.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
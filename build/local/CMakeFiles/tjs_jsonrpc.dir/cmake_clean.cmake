@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs_jsonrpc.dir/modules/networking/libjsonrpc/source/jsonrpc/client.c.o"
+  "CMakeFiles/tjs_jsonrpc.dir/modules/networking/libjsonrpc/source/jsonrpc/client.c.o.d"
+  "CMakeFiles/tjs_jsonrpc.dir/modules/networking/libjsonrpc/source/jsonrpc/server.c.o"
+  "CMakeFiles/tjs_jsonrpc.dir/modules/networking/libjsonrpc/source/jsonrpc/server.c.o.d"
+  "libtjs_jsonrpc.a"
+  "libtjs_jsonrpc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs_jsonrpc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,87 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/core/deps/mbedtls/library/aes.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/aes.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/aes.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/aesni.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/aesni.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/aesni.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/aria.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/aria.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/aria.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/asn1parse.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/asn1parse.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/asn1parse.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/asn1write.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/asn1write.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/asn1write.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/base64.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/base64.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/base64.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/bignum.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/bignum.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/bignum.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/camellia.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/camellia.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/camellia.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ccm.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ccm.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ccm.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/chacha20.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/chacha20.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/chacha20.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/chachapoly.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/chachapoly.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/chachapoly.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/cipher.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/cipher.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/cipher.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/cipher_wrap.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/cipher_wrap.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/cipher_wrap.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/constant_time.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/constant_time.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/constant_time.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ctr_drbg.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ctr_drbg.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ctr_drbg.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/debug.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/debug.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/debug.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/des.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/des.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/des.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/dhm.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/dhm.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/dhm.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ecdh.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecdh.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecdh.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ecdsa.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecdsa.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecdsa.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ecjpake.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecjpake.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecjpake.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ecp.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecp.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecp.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ecp_curves.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecp_curves.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecp_curves.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/entropy.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/entropy.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/entropy.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/entropy_poll.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/entropy_poll.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/entropy_poll.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/error.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/error.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/error.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/gcm.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/gcm.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/gcm.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/hmac_drbg.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/hmac_drbg.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/hmac_drbg.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/md.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/md.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/md.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/md5.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/md5.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/md5.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/memory_buffer_alloc.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/memory_buffer_alloc.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/memory_buffer_alloc.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/nist_kw.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/nist_kw.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/nist_kw.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/oid.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/oid.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/oid.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/padlock.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/padlock.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/padlock.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/pem.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pem.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pem.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/pk.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pk.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pk.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/pk_wrap.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pk_wrap.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pk_wrap.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/pkcs12.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkcs12.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkcs12.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/pkcs5.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkcs5.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkcs5.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/pkparse.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkparse.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkparse.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/pkwrite.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkwrite.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkwrite.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/platform.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/platform.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/platform.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/platform_util.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/platform_util.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/platform_util.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/poly1305.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/poly1305.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/poly1305.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ripemd160.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ripemd160.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ripemd160.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/rsa.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/rsa.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/rsa.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/rsa_alt_helpers.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/rsa_alt_helpers.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/rsa_alt_helpers.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/sha1.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/sha1.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/sha1.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/sha256.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/sha256.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/sha256.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/sha512.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/sha512.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/sha512.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ssl_cache.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_cache.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_cache.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ssl_ciphersuites.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_ciphersuites.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_ciphersuites.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ssl_cli.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_cli.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_cli.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ssl_cookie.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_cookie.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_cookie.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ssl_msg.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_msg.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_msg.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ssl_srv.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_srv.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_srv.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ssl_ticket.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_ticket.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_ticket.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/ssl_tls.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_tls.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_tls.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/threading.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/threading.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/threading.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/timing.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/timing.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/timing.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/version.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/version.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/version.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/version_features.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/version_features.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/version_features.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/x509.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/x509_create.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_create.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_create.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/x509_crl.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_crl.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_crl.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/x509_crt.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_crt.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_crt.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/x509_csr.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_csr.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_csr.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/x509write_crt.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509write_crt.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509write_crt.c.o.d"
+  "/root/repo/core/deps/mbedtls/library/x509write_csr.c" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509write_csr.c.o" "gcc" "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509write_csr.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
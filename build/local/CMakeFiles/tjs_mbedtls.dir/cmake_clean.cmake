@@ -0,0 +1,147 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/aes.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/aes.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/aesni.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/aesni.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/aria.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/aria.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/asn1parse.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/asn1parse.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/asn1write.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/asn1write.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/base64.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/base64.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/bignum.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/bignum.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/camellia.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/camellia.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ccm.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ccm.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/chacha20.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/chacha20.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/chachapoly.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/chachapoly.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/cipher.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/cipher.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/cipher_wrap.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/cipher_wrap.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/constant_time.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/constant_time.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ctr_drbg.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ctr_drbg.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/debug.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/debug.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/des.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/des.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/dhm.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/dhm.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecdh.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecdh.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecdsa.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecdsa.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecjpake.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecjpake.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecp.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecp.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecp_curves.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ecp_curves.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/entropy.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/entropy.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/entropy_poll.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/entropy_poll.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/error.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/error.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/gcm.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/gcm.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/hmac_drbg.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/hmac_drbg.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/md.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/md.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/md5.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/md5.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/memory_buffer_alloc.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/memory_buffer_alloc.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/nist_kw.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/nist_kw.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/oid.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/oid.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/padlock.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/padlock.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pem.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pem.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pk.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pk.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pk_wrap.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pk_wrap.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkcs12.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkcs12.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkcs5.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkcs5.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkparse.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkparse.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkwrite.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/pkwrite.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/platform.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/platform.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/platform_util.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/platform_util.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/poly1305.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/poly1305.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ripemd160.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ripemd160.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/rsa.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/rsa.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/rsa_alt_helpers.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/rsa_alt_helpers.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/sha1.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/sha1.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/sha256.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/sha256.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/sha512.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/sha512.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_cache.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_cache.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_ciphersuites.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_ciphersuites.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_cli.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_cli.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_cookie.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_cookie.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_msg.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_msg.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_srv.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_srv.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_ticket.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_ticket.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_tls.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/ssl_tls.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/threading.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/threading.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/timing.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/timing.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/version.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/version.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/version_features.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/version_features.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_create.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_create.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_crl.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_crl.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_crt.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_crt.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_csr.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509_csr.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509write_crt.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509write_crt.c.o.d"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509write_csr.c.o"
+  "CMakeFiles/tjs_mbedtls.dir/core/deps/mbedtls/library/x509write_csr.c.o.d"
+  "libtjs_mbedtls.a"
+  "libtjs_mbedtls.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs_mbedtls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/core/deps/miniz/src/miniz.c" "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz.c.o" "gcc" "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz.c.o.d"
+  "/root/repo/core/deps/miniz/src/miniz_tdef.c" "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz_tdef.c.o" "gcc" "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz_tdef.c.o.d"
+  "/root/repo/core/deps/miniz/src/miniz_tinfl.c" "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz_tinfl.c.o" "gcc" "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz_tinfl.c.o.d"
+  "/root/repo/core/deps/miniz/src/miniz_zip.c" "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz_zip.c.o" "gcc" "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz_zip.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
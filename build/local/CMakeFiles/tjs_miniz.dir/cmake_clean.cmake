@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz.c.o"
+  "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz.c.o.d"
+  "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz_tdef.c.o"
+  "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz_tdef.c.o.d"
+  "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz_tinfl.c.o"
+  "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz_tinfl.c.o.d"
+  "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz_zip.c.o"
+  "CMakeFiles/tjs_miniz.dir/core/deps/miniz/src/miniz_zip.c.o.d"
+  "libtjs_miniz.a"
+  "libtjs_miniz.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs_miniz.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/networking/libmqtt/source/mqtt/mqtt-client.c" "CMakeFiles/tjs_mqtt.dir/modules/networking/libmqtt/source/mqtt/mqtt-client.c.o" "gcc" "CMakeFiles/tjs_mqtt.dir/modules/networking/libmqtt/source/mqtt/mqtt-client.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/local/CMakeFiles/tjs_mqtt_packet.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_networking_util.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_networking.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_mbedtls.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_util.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_uv.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs_mqtt.dir/modules/networking/libmqtt/source/mqtt/mqtt-client.c.o"
+  "CMakeFiles/tjs_mqtt.dir/modules/networking/libmqtt/source/mqtt/mqtt-client.c.o.d"
+  "libtjs_mqtt.a"
+  "libtjs_mqtt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs_mqtt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
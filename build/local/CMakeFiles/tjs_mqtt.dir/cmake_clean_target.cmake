@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libtjs_mqtt.a"
+)
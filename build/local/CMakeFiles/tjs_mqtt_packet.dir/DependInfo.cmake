@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/core/deps/mqtt/src/MQTTConnectClient.c" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTConnectClient.c.o" "gcc" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTConnectClient.c.o.d"
+  "/root/repo/core/deps/mqtt/src/MQTTConnectServer.c" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTConnectServer.c.o" "gcc" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTConnectServer.c.o.d"
+  "/root/repo/core/deps/mqtt/src/MQTTDeserializePublish.c" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTDeserializePublish.c.o" "gcc" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTDeserializePublish.c.o.d"
+  "/root/repo/core/deps/mqtt/src/MQTTFormat.c" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTFormat.c.o" "gcc" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTFormat.c.o.d"
+  "/root/repo/core/deps/mqtt/src/MQTTPacket.c" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTPacket.c.o" "gcc" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTPacket.c.o.d"
+  "/root/repo/core/deps/mqtt/src/MQTTSerializePublish.c" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTSerializePublish.c.o" "gcc" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTSerializePublish.c.o.d"
+  "/root/repo/core/deps/mqtt/src/MQTTSubscribeClient.c" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTSubscribeClient.c.o" "gcc" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTSubscribeClient.c.o.d"
+  "/root/repo/core/deps/mqtt/src/MQTTSubscribeServer.c" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTSubscribeServer.c.o" "gcc" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTSubscribeServer.c.o.d"
+  "/root/repo/core/deps/mqtt/src/MQTTUnsubscribeClient.c" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTUnsubscribeClient.c.o" "gcc" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTUnsubscribeClient.c.o.d"
+  "/root/repo/core/deps/mqtt/src/MQTTUnsubscribeServer.c" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTUnsubscribeServer.c.o" "gcc" "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTUnsubscribeServer.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTConnectClient.c.o"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTConnectClient.c.o.d"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTConnectServer.c.o"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTConnectServer.c.o.d"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTDeserializePublish.c.o"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTDeserializePublish.c.o.d"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTFormat.c.o"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTFormat.c.o.d"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTPacket.c.o"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTPacket.c.o.d"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTSerializePublish.c.o"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTSerializePublish.c.o.d"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTSubscribeClient.c.o"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTSubscribeClient.c.o.d"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTSubscribeServer.c.o"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTSubscribeServer.c.o.d"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTUnsubscribeClient.c.o"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTUnsubscribeClient.c.o.d"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTUnsubscribeServer.c.o"
+  "CMakeFiles/tjs_mqtt_packet.dir/core/deps/mqtt/src/MQTTUnsubscribeServer.c.o.d"
+  "libtjs_mqtt_packet.a"
+  "libtjs_mqtt_packet.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs_mqtt_packet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
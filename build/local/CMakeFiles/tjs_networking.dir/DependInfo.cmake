@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/core/deps/networking/src/net-transport.c" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/net-transport.c.o" "gcc" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/net-transport.c.o.d"
+  "/root/repo/core/deps/networking/src/tcp-transport.c" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tcp-transport.c.o" "gcc" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tcp-transport.c.o.d"
+  "/root/repo/core/deps/networking/src/tls-transport.c" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tls-transport.c.o" "gcc" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tls-transport.c.o.d"
+  "/root/repo/core/deps/networking/src/tls/tls-context.c" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tls/tls-context.c.o" "gcc" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tls/tls-context.c.o.d"
+  "/root/repo/core/deps/networking/src/tls/uv-tls.c" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tls/uv-tls.c.o" "gcc" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tls/uv-tls.c.o.d"
+  "/root/repo/core/deps/networking/src/udp-transport.c" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/udp-transport.c.o" "gcc" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/udp-transport.c.o.d"
+  "/root/repo/core/deps/networking/src/url/uri-parser.c" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/url/uri-parser.c.o" "gcc" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/url/uri-parser.c.o.d"
+  "/root/repo/core/deps/networking/src/url/url-codec.c" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/url/url-codec.c.o" "gcc" "CMakeFiles/tjs_networking.dir/core/deps/networking/src/url/url-codec.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/local/CMakeFiles/tjs_util.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_uv.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_mbedtls.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/net-transport.c.o"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/net-transport.c.o.d"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tcp-transport.c.o"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tcp-transport.c.o.d"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tls-transport.c.o"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tls-transport.c.o.d"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tls/tls-context.c.o"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tls/tls-context.c.o.d"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tls/uv-tls.c.o"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/tls/uv-tls.c.o.d"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/udp-transport.c.o"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/udp-transport.c.o.d"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/url/uri-parser.c.o"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/url/uri-parser.c.o.d"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/url/url-codec.c.o"
+  "CMakeFiles/tjs_networking.dir/core/deps/networking/src/url/url-codec.c.o.d"
+  "libtjs_networking.a"
+  "libtjs_networking.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs_networking.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/networking/libutil/source/digest/md5.c" "CMakeFiles/tjs_networking_util.dir/modules/networking/libutil/source/digest/md5.c.o" "gcc" "CMakeFiles/tjs_networking_util.dir/modules/networking/libutil/source/digest/md5.c.o.d"
+  "/root/repo/modules/networking/libutil/source/util/darray.c" "CMakeFiles/tjs_networking_util.dir/modules/networking/libutil/source/util/darray.c.o" "gcc" "CMakeFiles/tjs_networking_util.dir/modules/networking/libutil/source/util/darray.c.o.d"
+  "/root/repo/modules/networking/libutil/source/util/uuid.c" "CMakeFiles/tjs_networking_util.dir/modules/networking/libutil/source/util/uuid.c.o" "gcc" "CMakeFiles/tjs_networking_util.dir/modules/networking/libutil/source/util/uuid.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/local/CMakeFiles/tjs_networking.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_util.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_uv.dir/DependInfo.cmake"
+  "/root/repo/build/local/CMakeFiles/tjs_mbedtls.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs_networking_util.dir/modules/networking/libutil/source/digest/md5.c.o"
+  "CMakeFiles/tjs_networking_util.dir/modules/networking/libutil/source/digest/md5.c.o.d"
+  "CMakeFiles/tjs_networking_util.dir/modules/networking/libutil/source/util/darray.c.o"
+  "CMakeFiles/tjs_networking_util.dir/modules/networking/libutil/source/util/darray.c.o.d"
+  "CMakeFiles/tjs_networking_util.dir/modules/networking/libutil/source/util/uuid.c.o"
+  "CMakeFiles/tjs_networking_util.dir/modules/networking/libutil/source/util/uuid.c.o.d"
+  "libtjs_networking_util.a"
+  "libtjs_networking_util.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs_networking_util.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
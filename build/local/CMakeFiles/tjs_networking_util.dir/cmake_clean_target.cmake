@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libtjs_networking_util.a"
+)
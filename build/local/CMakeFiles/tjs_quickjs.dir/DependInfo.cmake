@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/core/deps/quickjs/src/cutils.c" "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/cutils.c.o" "gcc" "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/cutils.c.o.d"
+  "/root/repo/core/deps/quickjs/src/libbf.c" "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/libbf.c.o" "gcc" "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/libbf.c.o.d"
+  "/root/repo/core/deps/quickjs/src/libregexp.c" "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/libregexp.c.o" "gcc" "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/libregexp.c.o.d"
+  "/root/repo/core/deps/quickjs/src/libunicode.c" "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/libunicode.c.o" "gcc" "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/libunicode.c.o.d"
+  "/root/repo/core/deps/quickjs/src/quickjs.c" "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/quickjs.c.o" "gcc" "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/quickjs.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
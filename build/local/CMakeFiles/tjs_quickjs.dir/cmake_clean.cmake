@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/cutils.c.o"
+  "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/cutils.c.o.d"
+  "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/libbf.c.o"
+  "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/libbf.c.o.d"
+  "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/libregexp.c.o"
+  "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/libregexp.c.o.d"
+  "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/libunicode.c.o"
+  "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/libunicode.c.o.d"
+  "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/quickjs.c.o"
+  "CMakeFiles/tjs_quickjs.dir/core/deps/quickjs/src/quickjs.c.o.d"
+  "libtjs_quickjs.a"
+  "libtjs_quickjs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs_quickjs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/core/deps/util/src/digest/md5.c" "CMakeFiles/tjs_util.dir/core/deps/util/src/digest/md5.c.o" "gcc" "CMakeFiles/tjs_util.dir/core/deps/util/src/digest/md5.c.o.d"
+  "/root/repo/core/deps/util/src/digest/sha1.c" "CMakeFiles/tjs_util.dir/core/deps/util/src/digest/sha1.c.o" "gcc" "CMakeFiles/tjs_util.dir/core/deps/util/src/digest/sha1.c.o.d"
+  "/root/repo/core/deps/util/src/encoding/base64.c" "CMakeFiles/tjs_util.dir/core/deps/util/src/encoding/base64.c.o" "gcc" "CMakeFiles/tjs_util.dir/core/deps/util/src/encoding/base64.c.o.d"
+  "/root/repo/core/deps/util/src/encoding/hex.c" "CMakeFiles/tjs_util.dir/core/deps/util/src/encoding/hex.c.o" "gcc" "CMakeFiles/tjs_util.dir/core/deps/util/src/encoding/hex.c.o.d"
+  "/root/repo/core/deps/util/src/util/base64.c" "CMakeFiles/tjs_util.dir/core/deps/util/src/util/base64.c.o" "gcc" "CMakeFiles/tjs_util.dir/core/deps/util/src/util/base64.c.o.d"
+  "/root/repo/core/deps/util/src/util/dbuffer.c" "CMakeFiles/tjs_util.dir/core/deps/util/src/util/dbuffer.c.o" "gcc" "CMakeFiles/tjs_util.dir/core/deps/util/src/util/dbuffer.c.o.d"
+  "/root/repo/core/deps/util/src/util/getopt.c" "CMakeFiles/tjs_util.dir/core/deps/util/src/util/getopt.c.o" "gcc" "CMakeFiles/tjs_util.dir/core/deps/util/src/util/getopt.c.o.d"
+  "/root/repo/core/deps/util/src/util/md5.c" "CMakeFiles/tjs_util.dir/core/deps/util/src/util/md5.c.o" "gcc" "CMakeFiles/tjs_util.dir/core/deps/util/src/util/md5.c.o.d"
+  "/root/repo/core/deps/util/src/util/uart.c" "CMakeFiles/tjs_util.dir/core/deps/util/src/util/uart.c.o" "gcc" "CMakeFiles/tjs_util.dir/core/deps/util/src/util/uart.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
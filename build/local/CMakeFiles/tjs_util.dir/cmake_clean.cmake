@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/digest/md5.c.o"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/digest/md5.c.o.d"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/digest/sha1.c.o"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/digest/sha1.c.o.d"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/encoding/base64.c.o"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/encoding/base64.c.o.d"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/encoding/hex.c.o"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/encoding/hex.c.o.d"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/util/base64.c.o"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/util/base64.c.o.d"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/util/dbuffer.c.o"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/util/dbuffer.c.o.d"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/util/getopt.c.o"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/util/getopt.c.o.d"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/util/md5.c.o"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/util/md5.c.o.d"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/util/uart.c.o"
+  "CMakeFiles/tjs_util.dir/core/deps/util/src/util/uart.c.o.d"
+  "libtjs_util.a"
+  "libtjs_util.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs_util.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,55 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/core/deps/uv/src/fs-poll.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/fs-poll.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/fs-poll.c.o.d"
+  "/root/repo/core/deps/uv/src/idna.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/idna.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/idna.c.o.d"
+  "/root/repo/core/deps/uv/src/inet.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/inet.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/inet.c.o.d"
+  "/root/repo/core/deps/uv/src/random.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/random.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/random.c.o.d"
+  "/root/repo/core/deps/uv/src/strscpy.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/strscpy.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/strscpy.c.o.d"
+  "/root/repo/core/deps/uv/src/strtok.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/strtok.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/strtok.c.o.d"
+  "/root/repo/core/deps/uv/src/threadpool.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/threadpool.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/threadpool.c.o.d"
+  "/root/repo/core/deps/uv/src/timer.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/timer.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/timer.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/async.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/async.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/async.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/core.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/core.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/core.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/dl.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/dl.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/dl.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/fs.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/fs.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/fs.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/getaddrinfo.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/getaddrinfo.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/getaddrinfo.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/getnameinfo.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/getnameinfo.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/getnameinfo.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/linux.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/linux.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/linux.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/loop-watcher.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/loop-watcher.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/loop-watcher.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/loop.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/loop.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/loop.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/pipe.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/pipe.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/pipe.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/poll.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/poll.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/poll.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/process.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/process.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/process.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/procfs-exepath.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/procfs-exepath.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/procfs-exepath.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/proctitle.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/proctitle.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/proctitle.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/random-devurandom.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-devurandom.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-devurandom.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/random-getentropy.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-getentropy.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-getentropy.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/random-getrandom.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-getrandom.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-getrandom.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/random-sysctl-linux.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-sysctl-linux.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-sysctl-linux.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/signal.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/signal.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/signal.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/stream.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/stream.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/stream.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/sysinfo-loadavg.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/sysinfo-loadavg.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/sysinfo-loadavg.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/sysinfo-memory.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/sysinfo-memory.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/sysinfo-memory.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/tcp.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/tcp.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/tcp.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/thread.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/thread.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/thread.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/tty.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/tty.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/tty.c.o.d"
+  "/root/repo/core/deps/uv/src/unix/udp.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/udp.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/udp.c.o.d"
+  "/root/repo/core/deps/uv/src/uv-common.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/uv-common.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/uv-common.c.o.d"
+  "/root/repo/core/deps/uv/src/uv-data-getter-setters.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/uv-data-getter-setters.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/uv-data-getter-setters.c.o.d"
+  "/root/repo/core/deps/uv/src/version.c" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/version.c.o" "gcc" "CMakeFiles/tjs_uv.dir/core/deps/uv/src/version.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
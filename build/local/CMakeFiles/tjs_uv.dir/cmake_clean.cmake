@@ -0,0 +1,83 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/fs-poll.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/fs-poll.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/idna.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/idna.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/inet.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/inet.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/random.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/random.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/strscpy.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/strscpy.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/strtok.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/strtok.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/threadpool.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/threadpool.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/timer.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/timer.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/async.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/async.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/core.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/core.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/dl.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/dl.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/fs.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/fs.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/getaddrinfo.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/getaddrinfo.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/getnameinfo.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/getnameinfo.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/linux.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/linux.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/loop-watcher.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/loop-watcher.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/loop.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/loop.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/pipe.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/pipe.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/poll.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/poll.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/process.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/process.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/procfs-exepath.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/procfs-exepath.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/proctitle.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/proctitle.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-devurandom.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-devurandom.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-getentropy.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-getentropy.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-getrandom.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-getrandom.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-sysctl-linux.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/random-sysctl-linux.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/signal.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/signal.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/stream.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/stream.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/sysinfo-loadavg.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/sysinfo-loadavg.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/sysinfo-memory.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/sysinfo-memory.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/tcp.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/tcp.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/thread.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/thread.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/tty.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/tty.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/udp.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/unix/udp.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/uv-common.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/uv-common.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/uv-data-getter-setters.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/uv-data-getter-setters.c.o.d"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/version.c.o"
+  "CMakeFiles/tjs_uv.dir/core/deps/uv/src/version.c.o.d"
+  "libtjs_uv.a"
+  "libtjs_uv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjs_uv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tjsc.dir/core/tjs/src/tjsc.c.o"
+  "CMakeFiles/tjsc.dir/core/tjs/src/tjsc.c.o.d"
+  "tjsc"
+  "tjsc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tjsc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,2871 @@
+/* File generated automatically by the WoT.js compiler. */
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <string.h>
+
+static const uint8_t tjs_m_bin_help[1724] = {
+ 0x02, 0x31, 0x20, 0x40, 0x61, 0x70, 0x70, 0x2f, 0x62, 0x69, 0x6e, 0x2f, 0x68, 0x65, 0x6c, 0x70,
+ 0x2e, 0x6a, 0x73, 0x16, 0x40, 0x74, 0x6a, 0x73, 0x2f, 0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x18,
+ 0x40, 0x74, 0x6a, 0x73, 0x2f, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x16, 0x67, 0x65, 0x74,
+ 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73, 0x0c, 0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x0e,
+ 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x08, 0x68, 0x65, 0x6c, 0x70, 0x08, 0x61, 0x72, 0x67,
+ 0x76, 0x0e, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x10, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e,
+ 0x64, 0x73, 0x0e, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x74, 0x73, 0x0c, 0x74, 0x6f, 0x6b, 0x65, 0x6e,
+ 0x73, 0x06, 0x61, 0x70, 0x70, 0x10, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x08, 0x75,
+ 0x74, 0x69, 0x6c, 0x08, 0x73, 0x6f, 0x72, 0x74, 0x02, 0x2f, 0x06, 0x62, 0x69, 0x6e, 0x10, 0x65,
+ 0x6e, 0x64, 0x73, 0x57, 0x69, 0x74, 0x68, 0x06, 0x2e, 0x6a, 0x73, 0x08, 0x70, 0x75, 0x73, 0x68,
+ 0x12, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x0c, 0x61, 0x70, 0x70, 0x2e, 0x6a,
+ 0x73, 0x0e, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x0c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+ 0x08, 0x74, 0x79, 0x70, 0x65, 0x0c, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x12, 0x70, 0x72, 0x69,
+ 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x18, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73, 0x49,
+ 0x6e, 0x66, 0x6f, 0x0e, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x04, 0x2c, 0x20, 0x0a, 0x70,
+ 0x72, 0x69, 0x6e, 0x74, 0x5e, 0x74, 0x6a, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x4a, 0x61,
+ 0x76, 0x61, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65,
+ 0x20, 0x66, 0x6f, 0x72, 0x20, 0x57, 0x65, 0x62, 0x20, 0x6f, 0x66, 0x20, 0x54, 0x68, 0x69, 0x6e,
+ 0x67, 0x73, 0x0a, 0x0a, 0x0a, 0x77, 0x68, 0x69, 0x74, 0x65, 0x0c, 0x55, 0x73, 0x61, 0x67, 0x65,
+ 0x3a, 0xbe, 0x01, 0x0a, 0x20, 0x20, 0x74, 0x6a, 0x73, 0x20, 0x5b, 0x6f, 0x70, 0x74, 0x69, 0x6f,
+ 0x6e, 0x73, 0x5d, 0x20, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x2e, 0x6a, 0x73, 0x3e, 0x20,
+ 0x5b, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x5d, 0x0a, 0x20, 0x20, 0x74, 0x6a,
+ 0x73, 0x20, 0x5b, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5d, 0x20, 0x3c, 0x63, 0x6f, 0x6d,
+ 0x6d, 0x61, 0x6e, 0x64, 0x3e, 0x20, 0x3c, 0x73, 0x75, 0x62, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e,
+ 0x64, 0x3e, 0x20, 0x5b, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x5d, 0x0a, 0x20,
+ 0x20, 0x0a, 0x10, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x3a, 0xae, 0x05, 0x0a, 0x20, 0x20,
+ 0x2d, 0x76, 0x2c, 0x20, 0x2d, 0x2d, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20,
+ 0x74, 0x6a, 0x73, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x2d, 0x68,
+ 0x2c, 0x20, 0x2d, 0x2d, 0x68, 0x65, 0x6c, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x70, 0x74,
+ 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x64, 0x75, 0x6d,
+ 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x64, 0x75, 0x6d, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79,
+ 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x75, 0x6e, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x64, 0x2d, 0x72,
+ 0x65, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x62, 0x6f, 0x72, 0x74, 0x20, 0x77,
+ 0x68, 0x65, 0x6e, 0x20, 0x61, 0x20, 0x72, 0x65, 0x6a, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x70,
+ 0x72, 0x6f, 0x6d, 0x69, 0x73, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x63, 0x61,
+ 0x75, 0x67, 0x68, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x6d, 0x65, 0x6d,
+ 0x6f, 0x72, 0x79, 0x2d, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x20, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72,
+ 0x79, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x27, 0x6e, 0x27, 0x20, 0x62,
+ 0x79, 0x74, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x73, 0x74, 0x61,
+ 0x63, 0x6b, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b,
+ 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x27, 0x6e, 0x27, 0x20, 0x62, 0x79, 0x74,
+ 0x65, 0x73, 0x0a, 0x0a, 0x12, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73, 0x3a, 0x06, 0x0a,
+ 0x20, 0x20, 0x04, 0x0a, 0x0a, 0x0e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x02, 0x40, 0x10,
+ 0x65, 0x78, 0x65, 0x63, 0x50, 0x61, 0x74, 0x68, 0x02, 0x3a, 0x14, 0x73, 0x63, 0x72, 0x69, 0x70,
+ 0x74, 0x50, 0x61, 0x74, 0x68, 0x1a, 0x43, 0x6f, 0x72, 0x65, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
+ 0x65, 0x73, 0x3a, 0x0a, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x0e, 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63,
+ 0x68, 0x0f, 0xc6, 0x03, 0x02, 0xc8, 0x03, 0xca, 0x03, 0x01, 0x00, 0x02, 0xcc, 0x03, 0x00, 0x02,
+ 0x00, 0xfc, 0x01, 0x00, 0x01, 0xfc, 0x01, 0x01, 0x00, 0x0e, 0x20, 0x06, 0x01, 0xa2, 0x01, 0x00,
+ 0x00, 0x00, 0x04, 0x04, 0x02, 0x21, 0x00, 0xce, 0x03, 0x00, 0x0d, 0xd0, 0x03, 0x01, 0x0d, 0xcc,
+ 0x03, 0x00, 0x01, 0xd2, 0x03, 0x01, 0x01, 0x08, 0xec, 0x08, 0xc2, 0x00, 0xe5, 0xc2, 0x01, 0xe6,
+ 0x29, 0xe2, 0x26, 0x00, 0x00, 0xb7, 0x66, 0x01, 0x00, 0x41, 0xea, 0x00, 0x00, 0x00, 0x52, 0x0e,
+ 0x06, 0x1b, 0x27, 0x00, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x01, 0x05, 0x01, 0x00, 0x0a, 0xc0,
+ 0x01, 0x0e, 0x43, 0x06, 0x01, 0xcc, 0x03, 0x00, 0x07, 0x00, 0x0a, 0x01, 0x00, 0xe0, 0x01, 0x07,
+ 0xd6, 0x03, 0x01, 0x00, 0x30, 0xd8, 0x03, 0x01, 0x01, 0x30, 0xda, 0x03, 0x01, 0x02, 0x30, 0x6e,
+ 0x02, 0x03, 0x30, 0xdc, 0x03, 0x03, 0x04, 0x30, 0xde, 0x03, 0x03, 0x05, 0x30, 0xe0, 0x03, 0x07,
+ 0x06, 0x30, 0xce, 0x03, 0x00, 0x0c, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0x66,
+ 0x00, 0x00, 0x41, 0xf1, 0x00, 0x00, 0x00, 0x42, 0xeb, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x42,
+ 0xf2, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xcb, 0x26, 0x00, 0x00, 0xcc, 0x26, 0x00, 0x00, 0xcd,
+ 0x61, 0x03, 0x00, 0x62, 0x00, 0x00, 0x7f, 0xef, 0x93, 0x00, 0xce, 0x61, 0x05, 0x00, 0x61, 0x04,
+ 0x00, 0x62, 0x03, 0x00, 0x42, 0x5e, 0x00, 0x00, 0x00, 0x04, 0xf3, 0x00, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0xc5, 0x04, 0x62, 0x04, 0x00, 0xb8, 0x47, 0xc5, 0x05, 0x62, 0x05, 0x00, 0x97, 0xed, 0x6c,
+ 0x62, 0x05, 0x00, 0x04, 0xf4, 0x00, 0x00, 0x00, 0xaa, 0xec, 0x45, 0x61, 0x06, 0x00, 0x62, 0x04,
+ 0x00, 0xb9, 0x47, 0xc5, 0x06, 0x62, 0x06, 0x00, 0x11, 0xb1, 0xec, 0x05, 0x0e, 0x06, 0xee, 0x0e,
+ 0x42, 0xf5, 0x00, 0x00, 0x00, 0x04, 0xf6, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0xec, 0x3d, 0x62,
+ 0x02, 0x00, 0x42, 0xf7, 0x00, 0x00, 0x00, 0x62, 0x06, 0x00, 0x42, 0xf8, 0x00, 0x00, 0x00, 0xb7,
+ 0x62, 0x06, 0x00, 0xeb, 0xba, 0x9f, 0x24, 0x02, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xee, 0x1d, 0x62,
+ 0x04, 0x00, 0xb9, 0x47, 0x04, 0xf9, 0x00, 0x00, 0x00, 0xaa, 0xec, 0x10, 0x62, 0x01, 0x00, 0x42,
+ 0xf7, 0x00, 0x00, 0x00, 0x62, 0x05, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x82, 0x00, 0x6a, 0x6c, 0xff,
+ 0xff, 0xff, 0x0e, 0x85, 0x0b, 0x62, 0x02, 0x00, 0x4c, 0xed, 0x00, 0x00, 0x00, 0x62, 0x01, 0x00,
+ 0x4c, 0xec, 0x00, 0x00, 0x00, 0x28, 0xc6, 0x03, 0x0b, 0x10, 0x30, 0x81, 0x17, 0x17, 0x58, 0x5f,
+ 0x26, 0x17, 0x0e, 0x4a, 0x26, 0x85, 0x9b, 0x4f, 0x4f, 0x31, 0x0e, 0x43, 0x06, 0x01, 0xd2, 0x03,
+ 0x03, 0x06, 0x03, 0x14, 0x03, 0x01, 0x86, 0x02, 0x09, 0xf4, 0x03, 0x00, 0x01, 0x00, 0xf6, 0x03,
+ 0x00, 0x01, 0x00, 0xf8, 0x03, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x01, 0x00, 0x70, 0xfc, 0x03, 0x00,
+ 0x00, 0x00, 0xd6, 0x03, 0x01, 0x01, 0x30, 0xfe, 0x03, 0x01, 0x03, 0x30, 0xd8, 0x03, 0x01, 0x04,
+ 0x30, 0xda, 0x03, 0x01, 0x05, 0x30, 0xce, 0x03, 0x00, 0x0c, 0xcc, 0x03, 0x02, 0x00, 0xd0, 0x03,
+ 0x01, 0x0c, 0xc2, 0x00, 0xcc, 0x61, 0x05, 0x00, 0x61, 0x04, 0x00, 0x61, 0x03, 0x00, 0x61, 0x02,
+ 0x00, 0x61, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x41, 0xfd, 0x00, 0x00, 0x00, 0xcb, 0x66,
+ 0x00, 0x00, 0x41, 0xf1, 0x00, 0x00, 0x00, 0x42, 0xeb, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xcd,
+ 0xe0, 0xf0, 0xce, 0x62, 0x03, 0x00, 0x41, 0xec, 0x00, 0x00, 0x00, 0x42, 0x5c, 0x00, 0x00, 0x00,
+ 0x04, 0x01, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xc5, 0x04, 0x62, 0x03, 0x00, 0x41, 0xed, 0x00,
+ 0x00, 0x00, 0x42, 0x5c, 0x00, 0x00, 0x00, 0x04, 0x01, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xc5,
+ 0x05, 0x38, 0x00, 0x01, 0x00, 0x00, 0x42, 0x02, 0x01, 0x00, 0x00, 0x04, 0x03, 0x01, 0x00, 0x00,
+ 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x42, 0x04, 0x01, 0x00, 0x00, 0x04, 0x05, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x04, 0x06, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x42, 0x04, 0x01,
+ 0x00, 0x00, 0x04, 0x07, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x04, 0x08, 0x01, 0x00, 0x00, 0x62,
+ 0x00, 0x00, 0x42, 0x04, 0x01, 0x00, 0x00, 0x04, 0x09, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x04,
+ 0x0a, 0x01, 0x00, 0x00, 0x62, 0x04, 0x00, 0x04, 0x01, 0x01, 0x00, 0x00, 0x62, 0x05, 0x00, 0x04,
+ 0x0b, 0x01, 0x00, 0x00, 0x66, 0x02, 0x00, 0x41, 0x0c, 0x01, 0x00, 0x00, 0x04, 0x0d, 0x01, 0x00,
+ 0x00, 0x66, 0x02, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x04, 0x0f, 0x01, 0x00,
+ 0x00, 0x66, 0x02, 0x00, 0x42, 0x10, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x0f, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0xd5, 0x04, 0xeb, 0x00, 0x00, 0x00, 0xaa, 0xec, 0x0c, 0xc8, 0x04, 0x11, 0x01,
+ 0x00, 0x00, 0x62, 0x02, 0x00, 0xf2, 0x0e, 0x29, 0xc6, 0x03, 0x2e, 0x14, 0x5d, 0x00, 0x0b, 0x26,
+ 0x59, 0x12, 0x76, 0x77, 0x68, 0x00, 0x15, 0x08, 0x00, 0x15, 0x10, 0x6c, 0x54, 0xef, 0x30, 0x3b,
+ 0x0e, 0x43, 0x06, 0x01, 0xfc, 0x03, 0x02, 0x00, 0x02, 0x05, 0x01, 0x01, 0x3a, 0x02, 0xf8, 0x03,
+ 0x00, 0x01, 0x00, 0xd6, 0x03, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x00, 0x0d, 0xd4, 0xeb, 0xec, 0x36,
+ 0x38, 0x00, 0x01, 0x00, 0x00, 0x42, 0x02, 0x01, 0x00, 0x00, 0x66, 0x00, 0x00, 0x42, 0x12, 0x01,
+ 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xd4, 0x42, 0x13, 0x01, 0x00, 0x00,
+ 0xc2, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x38, 0x00, 0x01, 0x00, 0x00, 0x42, 0x02, 0x01, 0x00, 0x00,
+ 0xc3, 0x24, 0x01, 0x00, 0x0e, 0x29, 0xc6, 0x03, 0x36, 0x06, 0x03, 0x17, 0x86, 0x22, 0x22, 0x4f,
+ 0x0e, 0x42, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01, 0x04, 0x00, 0x00, 0x14, 0x01, 0x82, 0x01, 0x00,
+ 0x01, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x42, 0x02, 0x01, 0x00, 0x00, 0xd3, 0x11, 0xed, 0x03,
+ 0x0e, 0xc3, 0x24, 0x01, 0x00, 0x29, 0xc6, 0x03, 0x3a, 0x02, 0x03, 0x62,
+};
+
+static const uint8_t tjs_m_bin_test[1278] = {
+ 0x02, 0x30, 0x20, 0x40, 0x61, 0x70, 0x70, 0x2f, 0x62, 0x69, 0x6e, 0x2f, 0x74, 0x65, 0x73, 0x74,
+ 0x2e, 0x6a, 0x73, 0x12, 0x40, 0x74, 0x6a, 0x73, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x0e, 0x40, 0x74,
+ 0x6a, 0x73, 0x2f, 0x66, 0x73, 0x0e, 0x40, 0x74, 0x6a, 0x73, 0x2f, 0x6f, 0x73, 0x18, 0x40, 0x74,
+ 0x6a, 0x73, 0x2f, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x12, 0x40, 0x74, 0x6a, 0x73, 0x2f,
+ 0x74, 0x65, 0x73, 0x74, 0x0e, 0x6c, 0x6f, 0x61, 0x64, 0x41, 0x6c, 0x6c, 0x0c, 0x72, 0x75, 0x6e,
+ 0x41, 0x6c, 0x6c, 0x08, 0x70, 0x61, 0x74, 0x68, 0x04, 0x66, 0x73, 0x04, 0x6f, 0x73, 0x0e, 0x70,
+ 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x08, 0x74, 0x65, 0x73, 0x74, 0x08, 0x61, 0x72, 0x67, 0x76,
+ 0x0e, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x0c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x08,
+ 0x61, 0x72, 0x67, 0x73, 0x1a, 0x6c, 0x6f, 0x61, 0x64, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f,
+ 0x72, 0x79, 0x18, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x06,
+ 0x63, 0x77, 0x64, 0x02, 0x69, 0x10, 0x70, 0x61, 0x74, 0x68, 0x6e, 0x61, 0x6d, 0x65, 0x10, 0x73,
+ 0x74, 0x61, 0x74, 0x49, 0x6e, 0x66, 0x6f, 0x0e, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x0a,
+ 0x70, 0x72, 0x69, 0x6e, 0x74, 0x4a, 0x52, 0x75, 0x6e, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20,
+ 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x2d, 0x69, 0x6e, 0x20, 0x74,
+ 0x65, 0x73, 0x74, 0x20, 0x72, 0x75, 0x6e, 0x6e, 0x65, 0x72, 0x2e, 0x02, 0x0a, 0x0c, 0x55, 0x73,
+ 0x61, 0x67, 0x65, 0x3a, 0x3c, 0x20, 0x20, 0x74, 0x6a, 0x73, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20,
+ 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x7c, 0x66, 0x69, 0x6c,
+ 0x65, 0x73, 0x3e, 0x0c, 0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x08, 0x73, 0x74, 0x61, 0x74, 0x08,
+ 0x74, 0x79, 0x70, 0x65, 0x12, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x08, 0x66,
+ 0x69, 0x6c, 0x65, 0x0e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x02, 0x40, 0x10, 0x65, 0x78,
+ 0x65, 0x63, 0x50, 0x61, 0x74, 0x68, 0x02, 0x3a, 0x14, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x50,
+ 0x61, 0x74, 0x68, 0x08, 0x64, 0x69, 0x72, 0x73, 0x06, 0x64, 0x69, 0x72, 0x10, 0x66, 0x69, 0x6c,
+ 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x0e, 0x72, 0x65, 0x61, 0x64, 0x64, 0x69, 0x72, 0x10, 0x65, 0x6e,
+ 0x64, 0x73, 0x57, 0x69, 0x74, 0x68, 0x06, 0x2e, 0x6a, 0x73, 0x10, 0x62, 0x61, 0x73, 0x65, 0x6e,
+ 0x61, 0x6d, 0x65, 0x14, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x57, 0x69, 0x74, 0x68, 0x0a, 0x74,
+ 0x65, 0x73, 0x74, 0x2d, 0x0f, 0xc6, 0x03, 0x05, 0xc8, 0x03, 0xca, 0x03, 0xcc, 0x03, 0xce, 0x03,
+ 0xd0, 0x03, 0x00, 0x00, 0x06, 0x00, 0xfc, 0x01, 0x00, 0x01, 0xfc, 0x01, 0x01, 0x02, 0xfc, 0x01,
+ 0x02, 0x03, 0xfc, 0x01, 0x03, 0x04, 0xd2, 0x03, 0x04, 0x05, 0xd4, 0x03, 0x04, 0x00, 0x0e, 0x20,
+ 0x06, 0x01, 0xa2, 0x01, 0x00, 0x00, 0x00, 0x04, 0x07, 0x01, 0x22, 0x00, 0xd6, 0x03, 0x00, 0x0d,
+ 0xd8, 0x03, 0x01, 0x0d, 0xda, 0x03, 0x02, 0x0d, 0xdc, 0x03, 0x03, 0x0d, 0xd2, 0x03, 0x04, 0x0c,
+ 0xd4, 0x03, 0x05, 0x0c, 0xde, 0x03, 0x00, 0x01, 0x08, 0xec, 0x07, 0xc2, 0x00, 0x5f, 0x06, 0x00,
+ 0x29, 0x5e, 0x06, 0x00, 0x26, 0x00, 0x00, 0xb7, 0x66, 0x03, 0x00, 0x41, 0xf0, 0x00, 0x00, 0x00,
+ 0x52, 0x0e, 0x06, 0x1b, 0x27, 0x00, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x01, 0x05, 0x01, 0x00,
+ 0x09, 0xb4, 0x01, 0x0e, 0x60, 0x06, 0x01, 0xde, 0x03, 0x03, 0x06, 0x02, 0x0a, 0x06, 0x02, 0xb0,
+ 0x02, 0x09, 0xe2, 0x03, 0x00, 0x01, 0x00, 0xe4, 0x03, 0x00, 0x01, 0x00, 0xe6, 0x03, 0x00, 0x01,
+ 0x00, 0xe8, 0x03, 0x00, 0x00, 0x40, 0xea, 0x03, 0x00, 0x01, 0x40, 0xec, 0x03, 0x01, 0x00, 0x30,
+ 0xee, 0x03, 0x04, 0x03, 0x20, 0xf0, 0x03, 0x05, 0x04, 0x30, 0xf2, 0x03, 0x05, 0x05, 0x30, 0xd8,
+ 0x03, 0x01, 0x0c, 0xd6, 0x03, 0x00, 0x0c, 0xd2, 0x03, 0x04, 0x0c, 0xda, 0x03, 0x02, 0x0c, 0xd4,
+ 0x03, 0x05, 0x0c, 0xdc, 0x03, 0x03, 0x0c, 0x0d, 0x02, 0x00, 0xd9, 0xc2, 0x00, 0xcb, 0xc2, 0x01,
+ 0xcc, 0x61, 0x02, 0x00, 0xd5, 0xeb, 0xb7, 0xa5, 0xec, 0x46, 0x38, 0xfa, 0x00, 0x00, 0x00, 0x42,
+ 0xfb, 0x00, 0x00, 0x00, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x04, 0xfd, 0x00, 0x00, 0x00, 0x24, 0x02,
+ 0x00, 0x0e, 0x38, 0xfa, 0x00, 0x00, 0x00, 0x42, 0xfb, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0x0e, 0x38, 0xfa, 0x00, 0x00, 0x00, 0x42, 0xfb, 0x00, 0x00, 0x00, 0x04,
+ 0xff, 0x00, 0x00, 0x00, 0x04, 0xfd, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e, 0x06, 0x2e, 0x66,
+ 0x03, 0x00, 0x42, 0xf6, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xcd, 0x61, 0x03, 0x00, 0xb7, 0xce,
+ 0x62, 0x03, 0x00, 0xd5, 0xeb, 0xa4, 0xec, 0x79, 0x61, 0x05, 0x00, 0x61, 0x04, 0x00, 0x66, 0x01,
+ 0x00, 0x42, 0x5c, 0x00, 0x00, 0x00, 0x62, 0x02, 0x00, 0xd5, 0x62, 0x03, 0x00, 0x47, 0x24, 0x02,
+ 0x00, 0xc5, 0x04, 0x66, 0x00, 0x00, 0x42, 0x00, 0x01, 0x00, 0x00, 0x62, 0x04, 0x00, 0x24, 0x01,
+ 0x00, 0x8c, 0x97, 0xed, 0x42, 0x66, 0x00, 0x00, 0x42, 0x01, 0x01, 0x00, 0x00, 0x62, 0x04, 0x00,
+ 0x24, 0x01, 0x00, 0x8c, 0xc5, 0x05, 0x62, 0x05, 0x00, 0x41, 0x02, 0x01, 0x00, 0x00, 0x04, 0x03,
+ 0x01, 0x00, 0x00, 0xaa, 0xec, 0x0a, 0xc7, 0x62, 0x04, 0x00, 0xf1, 0x8c, 0x0e, 0xee, 0x18, 0x62,
+ 0x05, 0x00, 0x41, 0x02, 0x01, 0x00, 0x00, 0x04, 0x04, 0x01, 0x00, 0x00, 0xaa, 0xec, 0x08, 0xc8,
+ 0x62, 0x04, 0x00, 0xf1, 0x8c, 0x0e, 0x62, 0x03, 0x00, 0x92, 0x63, 0x03, 0x00, 0x0e, 0xee, 0x81,
+ 0x66, 0x04, 0x00, 0xf0, 0x8c, 0x0e, 0x38, 0xfa, 0x00, 0x00, 0x00, 0x42, 0xfb, 0x00, 0x00, 0x00,
+ 0xc3, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x66, 0x05, 0x00, 0x41, 0x05, 0x01, 0x00, 0x00, 0x04, 0x06,
+ 0x01, 0x00, 0x00, 0x66, 0x05, 0x00, 0x42, 0x07, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x04, 0x08,
+ 0x01, 0x00, 0x00, 0x66, 0x05, 0x00, 0x42, 0x09, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x05,
+ 0x00, 0x24, 0x01, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x12, 0x18, 0x44, 0x21, 0x7b, 0x62, 0x7b,
+ 0x08, 0x00, 0x01, 0x58, 0x3f, 0x62, 0x6c, 0x53, 0x0f, 0x59, 0x53, 0x27, 0x5d, 0x27, 0x36, 0x22,
+ 0x00, 0x3f, 0x02, 0x0e, 0x62, 0x06, 0x01, 0xe8, 0x03, 0x01, 0x04, 0x01, 0x07, 0x04, 0x00, 0x8d,
+ 0x01, 0x05, 0xf0, 0x03, 0x00, 0x01, 0x00, 0x94, 0x04, 0x01, 0x00, 0x30, 0x96, 0x04, 0x04, 0x01,
+ 0x30, 0x98, 0x04, 0x07, 0x02, 0x30, 0x98, 0x04, 0x09, 0x02, 0x30, 0xd8, 0x03, 0x00, 0x0c, 0xd6,
+ 0x03, 0x01, 0x0c, 0xea, 0x03, 0x01, 0x01, 0xe8, 0x03, 0x00, 0x01, 0x61, 0x00, 0x00, 0x66, 0x00,
+ 0x00, 0x42, 0x00, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x8c, 0x97, 0xec, 0x03, 0x06, 0x2e,
+ 0x66, 0x00, 0x00, 0x42, 0x0d, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x8c, 0xcb, 0x61, 0x01,
+ 0x00, 0x62, 0x00, 0x00, 0x7f, 0xee, 0x5a, 0xcc, 0x62, 0x01, 0x00, 0x41, 0x02, 0x01, 0x00, 0x00,
+ 0xb8, 0xaa, 0xec, 0x22, 0x61, 0x02, 0x00, 0x66, 0x01, 0x00, 0x42, 0x5c, 0x00, 0x00, 0x00, 0xd3,
+ 0x62, 0x01, 0x00, 0x41, 0x37, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0xcd, 0xe1, 0x62, 0x02, 0x00,
+ 0xf1, 0x8c, 0x0e, 0xee, 0x2c, 0x62, 0x01, 0x00, 0x41, 0x02, 0x01, 0x00, 0x00, 0xb9, 0xaa, 0xec,
+ 0x20, 0x61, 0x03, 0x00, 0x66, 0x01, 0x00, 0x42, 0x5c, 0x00, 0x00, 0x00, 0xd3, 0x62, 0x01, 0x00,
+ 0x41, 0x37, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0xce, 0xe2, 0x62, 0x03, 0x00, 0xf1, 0x8c, 0x0e,
+ 0x82, 0x00, 0xec, 0xa4, 0x0e, 0x85, 0x06, 0x2e, 0xc6, 0x03, 0x1d, 0x0d, 0x12, 0x53, 0x08, 0x09,
+ 0x49, 0x36, 0x4e, 0x6c, 0x27, 0x58, 0x6c, 0x27, 0x21, 0x0e, 0x62, 0x06, 0x01, 0xea, 0x03, 0x01,
+ 0x01, 0x01, 0x03, 0x02, 0x00, 0x47, 0x02, 0x98, 0x04, 0x00, 0x01, 0x00, 0x6e, 0x01, 0x00, 0x30,
+ 0xd6, 0x03, 0x01, 0x0c, 0xd2, 0x03, 0x02, 0x0c, 0x61, 0x00, 0x00, 0xd3, 0x97, 0xec, 0x03, 0x06,
+ 0x2e, 0xd3, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x0f, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x97,
+ 0xec, 0x03, 0x06, 0x2e, 0x66, 0x00, 0x00, 0x42, 0x10, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00,
+ 0xcb, 0x62, 0x00, 0x00, 0x42, 0x11, 0x01, 0x00, 0x00, 0x04, 0x12, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x97, 0xec, 0x03, 0x06, 0x2e, 0x66, 0x01, 0x00, 0xd3, 0xf1, 0x8c, 0x0e, 0x06, 0x2e, 0xc6,
+ 0x03, 0x33, 0x0b, 0x12, 0x17, 0x09, 0x5d, 0x08, 0x09, 0x44, 0x62, 0x08, 0x0a, 0x26,
+};
+
+static const uint8_t tjs_m_modules_utils_cmdline[8917] = {
+ 0x02, 0xb3, 0x01, 0x3a, 0x40, 0x61, 0x70, 0x70, 0x2f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73,
+ 0x2f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x2f, 0x63, 0x6d, 0x64, 0x6c, 0x69, 0x6e, 0x65, 0x2e, 0x6a,
+ 0x73, 0x16, 0x40, 0x74, 0x6a, 0x73, 0x2f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x12, 0x40, 0x74,
+ 0x6a, 0x73, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x16, 0x40, 0x74, 0x6a, 0x73, 0x2f, 0x6e, 0x61, 0x74,
+ 0x69, 0x76, 0x65, 0x0e, 0x40, 0x74, 0x6a, 0x73, 0x2f, 0x6f, 0x73, 0x0e, 0x63, 0x6f, 0x6d, 0x6d,
+ 0x61, 0x6e, 0x64, 0x0e, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x08, 0x66, 0x69, 0x6e, 0x64,
+ 0x08, 0x68, 0x65, 0x6c, 0x70, 0x08, 0x6c, 0x6f, 0x61, 0x64, 0x18, 0x70, 0x61, 0x72, 0x73, 0x65,
+ 0x41, 0x70, 0x70, 0x4e, 0x61, 0x6d, 0x65, 0x06, 0x72, 0x75, 0x6e, 0x0a, 0x73, 0x68, 0x65, 0x6c,
+ 0x6c, 0x1c, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73,
+ 0x0c, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x08, 0x70, 0x61, 0x74, 0x68, 0x0c, 0x6e, 0x61, 0x74,
+ 0x69, 0x76, 0x65, 0x04, 0x6f, 0x73, 0x08, 0x75, 0x74, 0x66, 0x38, 0x10, 0x24, 0x63, 0x6f, 0x6e,
+ 0x74, 0x65, 0x78, 0x74, 0x06, 0x74, 0x6a, 0x73, 0x08, 0x6c, 0x69, 0x73, 0x74, 0x1e, 0x6c, 0x6f,
+ 0x61, 0x64, 0x55, 0x73, 0x65, 0x72, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x24, 0x6c, 0x6f,
+ 0x61, 0x64, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+ 0x0c, 0x72, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x0c, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x75,
+ 0x6e, 0x73, 0x65, 0x74, 0x08, 0x74, 0x79, 0x70, 0x65, 0x0d, 0xa1, 0x7b, 0x06, 0x74, 0x4d, 0x91,
+ 0x6e, 0x7f, 0xc2, 0x53, 0x70, 0x65, 0x0a, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x15, 0xfc, 0x5b, 0xfa,
+ 0x51, 0xc2, 0x53, 0x70, 0x65, 0x30, 0x52, 0x07, 0x63, 0x9a, 0x5b, 0x84, 0x76, 0x87, 0x65, 0xf6,
+ 0x4e, 0x15, 0xe5, 0x67, 0xe2, 0x8b, 0x07, 0x63, 0x9a, 0x5b, 0x84, 0x76, 0x0d, 0x54, 0xf0, 0x79,
+ 0x84, 0x76, 0xc2, 0x53, 0x70, 0x65, 0x15, 0xce, 0x4e, 0x07, 0x63, 0x9a, 0x5b, 0x84, 0x76, 0x87,
+ 0x65, 0xf6, 0x4e, 0xfc, 0x5b, 0x65, 0x51, 0xc2, 0x53, 0x70, 0x65, 0x17, 0xd4, 0x8f, 0xde, 0x56,
+ 0x4d, 0x91, 0x6e, 0x7f, 0x87, 0x65, 0xf6, 0x4e, 0x2d, 0x4e, 0x40, 0x62, 0x09, 0x67, 0x84, 0x76,
+ 0x3c, 0x50, 0x0d, 0xa0, 0x52, 0x7d, 0x8f, 0xd8, 0x9e, 0xa4, 0x8b, 0xc2, 0x53, 0x70, 0x65, 0x0f,
+ 0x20, 0x52, 0x64, 0x96, 0x07, 0x63, 0x9a, 0x5b, 0x84, 0x76, 0x06, 0x52, 0xc4, 0x7e, 0x11, 0xcd,
+ 0x91, 0x7d, 0x54, 0x0d, 0x54, 0x07, 0x63, 0x9a, 0x5b, 0x84, 0x76, 0x06, 0x52, 0xc4, 0x7e, 0x15,
+ 0xbe, 0x8b, 0x6e, 0x7f, 0x07, 0x63, 0x9a, 0x5b, 0x84, 0x76, 0x0d, 0x54, 0xf0, 0x79, 0x84, 0x76,
+ 0xc2, 0x53, 0x70, 0x65, 0x15, 0x20, 0x52, 0x64, 0x96, 0x07, 0x63, 0x9a, 0x5b, 0x84, 0x76, 0x0d,
+ 0x54, 0xf0, 0x79, 0x84, 0x76, 0xc2, 0x53, 0x70, 0x65, 0x10, 0x73, 0x75, 0x62, 0x74, 0x69, 0x74,
+ 0x6c, 0x65, 0x10, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x14, 0x63, 0x6f, 0x6e, 0x66,
+ 0x69, 0x67, 0x46, 0x69, 0x6c, 0x65, 0x0e, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x0a, 0x70,
+ 0x72, 0x69, 0x6e, 0x74, 0x32, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3a, 0x20, 0x65, 0x78, 0x70, 0x6f,
+ 0x72, 0x74, 0x20, 0x3c, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0a, 0x0b, 0xfc,
+ 0x5b, 0xfa, 0x51, 0x40, 0x62, 0x09, 0x67, 0x20, 0x00, 0x15, 0x20, 0x00, 0xc2, 0x53, 0x70, 0x65,
+ 0x30, 0x52, 0x07, 0x63, 0x9a, 0x5b, 0x84, 0x76, 0x87, 0x65, 0xf6, 0x4e, 0x0a, 0x00, 0x14, 0x69,
+ 0x73, 0x41, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x06, 0x63, 0x77, 0x64, 0x08, 0x73, 0x61,
+ 0x76, 0x65, 0x22, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x3a, 0x20, 0x45, 0x78, 0x70, 0x6f, 0x72,
+ 0x74, 0x20, 0x74, 0x6f, 0x0c, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x0e, 0x55, 0x73, 0x61, 0x67,
+ 0x65, 0x3a, 0x20, 0x34, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x20, 0x67, 0x65, 0x74, 0x20,
+ 0x3c, 0x6b, 0x65, 0x79, 0x7c, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x12, 0x67,
+ 0x65, 0x74, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x12, 0x67, 0x65, 0x74, 0x4f, 0x62, 0x6a, 0x65,
+ 0x63, 0x74, 0x12, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x69, 0x66, 0x79, 0x06, 0x20, 0x3d, 0x20,
+ 0x0a, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x48, 0x45, 0x63, 0x68, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20,
+ 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x73, 0x29, 0x20,
+ 0x74, 0x6f, 0x20, 0x73, 0x74, 0x64, 0x6f, 0x75, 0x74, 0x2e, 0x0a, 0x02, 0x3b, 0x02, 0x0a, 0x08,
+ 0x64, 0x61, 0x74, 0x61, 0x08, 0x62, 0x6c, 0x75, 0x65, 0x14, 0x0a, 0x3b, 0x20, 0x75, 0x73, 0x61,
+ 0x67, 0x65, 0x3a, 0x20, 0x2c, 0x20, 0x67, 0x65, 0x74, 0x20, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x20,
+ 0x5b, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x2e, 0x2e, 0x2e, 0x5d, 0x0a, 0x10, 0x73, 0x65, 0x74, 0x74,
+ 0x69, 0x6e, 0x67, 0x73, 0x32, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3a, 0x20, 0x69, 0x6d, 0x70, 0x6f,
+ 0x72, 0x74, 0x20, 0x3c, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0a, 0x13, 0xce,
+ 0x4e, 0x07, 0x63, 0x9a, 0x5b, 0x84, 0x76, 0x87, 0x65, 0xf6, 0x4e, 0xfc, 0x5b, 0x65, 0x51, 0x20,
+ 0x00, 0x09, 0x20, 0x00, 0xc2, 0x53, 0x70, 0x65, 0x0a, 0x00, 0x08, 0x6f, 0x70, 0x65, 0x6e, 0x26,
+ 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x3a, 0x20, 0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x66,
+ 0x72, 0x6f, 0x6d, 0x08, 0x6d, 0x6f, 0x64, 0x65, 0x2e, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67,
+ 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x3c, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3e, 0x0a,
+ 0x11, 0xa0, 0x52, 0x7d, 0x8f, 0xd8, 0x9e, 0xa4, 0x8b, 0x84, 0x76, 0xc2, 0x53, 0x70, 0x65, 0x0a,
+ 0x00, 0x0e, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x08, 0x75, 0x73, 0x65, 0x72, 0x0a, 0x4c,
+ 0x6f, 0x61, 0x64, 0x20, 0x26, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x73, 0x65,
+ 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x0a, 0x0a, 0x18, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x43,
+ 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x14, 0x75, 0x73, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67,
+ 0x14, 0x6c, 0x6f, 0x61, 0x64, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x1a, 0x73, 0x79, 0x73, 0x6c,
+ 0x6f, 0x67, 0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x02, 0x65, 0x2a, 0x6c, 0x6f, 0x61, 0x64,
+ 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73, 0x2e, 0x2e,
+ 0x2e, 0x0c, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x0e, 0x77, 0x6f, 0x74, 0x2e, 0x64, 0x69, 0x64,
+ 0x18, 0x77, 0x6f, 0x74, 0x2e, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x14, 0x77, 0x6f,
+ 0x74, 0x2e, 0x73, 0x65, 0x63, 0x72, 0x65, 0x74, 0x14, 0x67, 0x65, 0x74, 0x42, 0x6f, 0x6f, 0x6c,
+ 0x65, 0x61, 0x6e, 0x1c, 0x73, 0x79, 0x73, 0x6c, 0x6f, 0x67, 0x2e, 0x65, 0x6e, 0x61, 0x62, 0x6c,
+ 0x65, 0x64, 0x0e, 0x73, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x10, 0x6c, 0x6f, 0x67, 0x2e, 0x74,
+ 0x79, 0x70, 0x65, 0x0c, 0x73, 0x79, 0x73, 0x6c, 0x6f, 0x67, 0x0e, 0x6e, 0x65, 0x77, 0x4e, 0x61,
+ 0x6d, 0x65, 0x0c, 0x6c, 0x6f, 0x61, 0x64, 0x3a, 0x20, 0x04, 0x20, 0x3d, 0x1a, 0x6e, 0x65, 0x74,
+ 0x77, 0x6f, 0x72, 0x6b, 0x43, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x30, 0x6c, 0x6f, 0x61, 0x64, 0x20,
+ 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73,
+ 0x2e, 0x2e, 0x2e, 0x10, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x16, 0x65, 0x74, 0x68,
+ 0x2e, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x1a, 0x65, 0x74, 0x68, 0x2e, 0x69, 0x6e, 0x74,
+ 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x12, 0x77, 0x6c, 0x61, 0x6e, 0x2e, 0x64, 0x6e, 0x73, 0x31,
+ 0x12, 0x77, 0x6c, 0x61, 0x6e, 0x2e, 0x64, 0x6e, 0x73, 0x32, 0x18, 0x77, 0x6c, 0x61, 0x6e, 0x2e,
+ 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x1c, 0x77, 0x6c, 0x61, 0x6e, 0x2e, 0x69, 0x6e, 0x74,
+ 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x12, 0x77, 0x6c, 0x61, 0x6e, 0x2e, 0x6d, 0x6f, 0x64, 0x65,
+ 0x10, 0x77, 0x6c, 0x61, 0x6e, 0x2e, 0x6b, 0x65, 0x79, 0x12, 0x77, 0x6c, 0x61, 0x6e, 0x2e, 0x73,
+ 0x73, 0x69, 0x64, 0x0e, 0x6f, 0x6c, 0x64, 0x4e, 0x61, 0x6d, 0x65, 0x48, 0x55, 0x73, 0x61, 0x67,
+ 0x65, 0x3a, 0x20, 0x72, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3c, 0x6f, 0x6c, 0x64, 0x2d, 0x6e,
+ 0x61, 0x6d, 0x65, 0x3e, 0x20, 0x3c, 0x6e, 0x65, 0x77, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0a,
+ 0x0d, 0xce, 0x4e, 0x4d, 0x91, 0x6e, 0x7f, 0x87, 0x65, 0xf6, 0x4e, 0x28, 0x00, 0x17, 0x29, 0x00,
+ 0x2d, 0x4e, 0xcd, 0x91, 0x7d, 0x54, 0x0d, 0x54, 0x07, 0x63, 0x9a, 0x5b, 0x84, 0x76, 0x06, 0x52,
+ 0xc4, 0x7e, 0x0a, 0x00, 0x1a, 0x72, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x53, 0x65, 0x63, 0x74, 0x69,
+ 0x6f, 0x6e, 0x0e, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x3a, 0x3a, 0x55, 0x73, 0x61, 0x67, 0x65,
+ 0x3a, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3c, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f,
+ 0x6e, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0a, 0x15, 0x29, 0x00, 0x2d, 0x4e, 0x20, 0x52, 0x64,
+ 0x96, 0x07, 0x63, 0x9a, 0x5b, 0x84, 0x76, 0x06, 0x52, 0xc4, 0x7e, 0x0a, 0x00, 0x1a, 0x72, 0x65,
+ 0x6d, 0x6f, 0x76, 0x65, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x06, 0x70, 0x6f, 0x73, 0x68,
+ 0x53, 0x65, 0x74, 0x73, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+ 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x20, 0x74, 0x6f, 0x20,
+ 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64,
+ 0x65, 0x64, 0x2e, 0x0a, 0x0e, 0x75, 0x73, 0x61, 0x67, 0x65, 0x3a, 0x20, 0x4c, 0x20, 0x73, 0x65,
+ 0x74, 0x20, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x3d, 0x3c, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x20,
+ 0x5b, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x3d, 0x3c, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x2e, 0x2e,
+ 0x2e, 0x5d, 0x0a, 0x0e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x4f, 0x66, 0x02, 0x3d, 0x12, 0x73, 0x75,
+ 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x0c, 0x73, 0x61, 0x76, 0x65, 0x64, 0x2e, 0x0a, 0x6e,
+ 0x61, 0x6d, 0x65, 0x73, 0x66, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+ 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x20, 0x66,
+ 0x72, 0x6f, 0x6d, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f,
+ 0x6e, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x0a, 0x30, 0x20, 0x75, 0x6e, 0x73, 0x65, 0x74, 0x20,
+ 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x20, 0x5b, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x2e, 0x2e, 0x2e, 0x5d,
+ 0x0a, 0x14, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x49, 0x74, 0x65, 0x6d, 0x10, 0x63, 0x6f, 0x6d,
+ 0x6d, 0x61, 0x6e, 0x64, 0x73, 0x08, 0x61, 0x72, 0x67, 0x73, 0x14, 0x73, 0x75, 0x62, 0x63, 0x6f,
+ 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x12, 0x6d, 0x61, 0x78, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x06,
+ 0x6b, 0x65, 0x79, 0x10, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x73, 0x0c, 0x62, 0x72, 0x69,
+ 0x67, 0x68, 0x74, 0x02, 0x20, 0x06, 0x3a, 0x20, 0x27, 0x28, 0x27, 0x3a, 0x20, 0x63, 0x6f, 0x6d,
+ 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x0a, 0x77,
+ 0x68, 0x69, 0x74, 0x65, 0x0c, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3a, 0x04, 0x20, 0x20, 0x2e, 0x20,
+ 0x3c, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x3e, 0x20, 0x5b, 0x61, 0x72, 0x67, 0x75, 0x6d,
+ 0x65, 0x6e, 0x74, 0x73, 0x5d, 0x0a, 0x08, 0x70, 0x75, 0x73, 0x68, 0x12, 0x43, 0x6f, 0x6d, 0x6d,
+ 0x61, 0x6e, 0x64, 0x73, 0x3a, 0x08, 0x73, 0x6f, 0x72, 0x74, 0x0e, 0x66, 0x6f, 0x72, 0x45, 0x61,
+ 0x63, 0x68, 0x0c, 0x70, 0x61, 0x64, 0x45, 0x6e, 0x64, 0x14, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73,
+ 0x57, 0x69, 0x74, 0x68, 0x12, 0x24, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73, 0x0e, 0x64,
+ 0x65, 0x74, 0x61, 0x69, 0x6c, 0x73, 0x0e, 0x61, 0x70, 0x70, 0x6e, 0x61, 0x6d, 0x65, 0x0c, 0x20,
+ 0x20, 0x74, 0x6a, 0x73, 0x20, 0x2a, 0x3c, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x3e, 0x20,
+ 0x5b, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x5d, 0x46, 0x3c, 0x63, 0x6f, 0x6d,
+ 0x6d, 0x61, 0x6e, 0x64, 0x3e, 0x20, 0x3c, 0x73, 0x75, 0x62, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e,
+ 0x64, 0x3e, 0x20, 0x5b, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x5d, 0x0a, 0x08,
+ 0x6b, 0x65, 0x79, 0x73, 0x04, 0x2c, 0x20, 0x16, 0x73, 0x75, 0x62, 0x63, 0x6f, 0x6d, 0x6d, 0x61,
+ 0x6e, 0x64, 0x73, 0x08, 0x63, 0x79, 0x61, 0x6e, 0x14, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x50,
+ 0x61, 0x74, 0x68, 0x0e, 0x64, 0x69, 0x72, 0x6e, 0x61, 0x6d, 0x65, 0x10, 0x65, 0x6e, 0x64, 0x73,
+ 0x57, 0x69, 0x74, 0x68, 0x0e, 0x2f, 0x61, 0x70, 0x70, 0x2e, 0x6a, 0x73, 0x10, 0x62, 0x61, 0x73,
+ 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x06, 0x2e, 0x6a, 0x73, 0x10, 0x65, 0x78, 0x65, 0x63, 0x50, 0x61,
+ 0x74, 0x68, 0x0c, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x0e, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e,
+ 0x73, 0x14, 0x73, 0x75, 0x62, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x06, 0x65, 0x72, 0x72,
+ 0x08, 0x70, 0x69, 0x70, 0x65, 0x0c, 0x73, 0x74, 0x64, 0x6f, 0x75, 0x74, 0x0c, 0x73, 0x74, 0x64,
+ 0x65, 0x72, 0x72, 0x0a, 0x73, 0x70, 0x61, 0x77, 0x6e, 0x12, 0x6f, 0x6e, 0x6d, 0x65, 0x73, 0x73,
+ 0x61, 0x67, 0x65, 0x08, 0x77, 0x61, 0x69, 0x74, 0x08, 0x63, 0x6f, 0x64, 0x65, 0x0c, 0x64, 0x65,
+ 0x63, 0x6f, 0x64, 0x65, 0x0f, 0xc6, 0x03, 0x04, 0xc8, 0x03, 0xca, 0x03, 0xcc, 0x03, 0xce, 0x03,
+ 0x08, 0x00, 0x07, 0xd0, 0x03, 0x00, 0x08, 0xd2, 0x03, 0x00, 0x09, 0xd4, 0x03, 0x00, 0x0a, 0xd6,
+ 0x03, 0x00, 0x0b, 0xd8, 0x03, 0x00, 0x0c, 0xda, 0x03, 0x00, 0x0d, 0xdc, 0x03, 0x00, 0x0e, 0xde,
+ 0x03, 0x00, 0x04, 0x00, 0xfc, 0x01, 0x00, 0x01, 0xfc, 0x01, 0x01, 0x02, 0xfc, 0x01, 0x02, 0x03,
+ 0xfc, 0x01, 0x03, 0x00, 0x0e, 0x20, 0x06, 0x01, 0xa2, 0x01, 0x00, 0x02, 0x00, 0x03, 0x0f, 0x14,
+ 0xb8, 0x01, 0x02, 0xe0, 0x03, 0x02, 0x00, 0x30, 0xee, 0x01, 0x03, 0x01, 0x70, 0xe2, 0x03, 0x00,
+ 0x0d, 0xe4, 0x03, 0x01, 0x0d, 0xe6, 0x03, 0x02, 0x0d, 0xe8, 0x03, 0x03, 0x0d, 0xea, 0x03, 0x00,
+ 0x0d, 0xec, 0x03, 0x01, 0x0d, 0xe0, 0x03, 0x02, 0x09, 0xd0, 0x03, 0x03, 0x01, 0xd2, 0x03, 0x04,
+ 0x01, 0xd4, 0x03, 0x05, 0x01, 0xd6, 0x03, 0x06, 0x01, 0xd8, 0x03, 0x07, 0x01, 0xda, 0x03, 0x08,
+ 0x01, 0xdc, 0x03, 0x09, 0x01, 0xde, 0x03, 0x0a, 0x01, 0x08, 0xec, 0x2a, 0xc2, 0x0c, 0x5f, 0x07,
+ 0x00, 0xc2, 0x0d, 0x5f, 0x08, 0x00, 0xc2, 0x0e, 0x5f, 0x09, 0x00, 0xc2, 0x0f, 0x5f, 0x0a, 0x00,
+ 0xc2, 0x10, 0x5f, 0x0b, 0x00, 0xc2, 0x11, 0x5f, 0x0c, 0x00, 0xc2, 0x12, 0x5f, 0x0d, 0x00, 0xc2,
+ 0x13, 0x5f, 0x0e, 0x00, 0x29, 0x66, 0x02, 0x00, 0x41, 0xf5, 0x00, 0x00, 0x00, 0x5f, 0x04, 0x00,
+ 0x0b, 0x04, 0xf7, 0x00, 0x00, 0x00, 0x4c, 0x37, 0x00, 0x00, 0x00, 0x5f, 0x05, 0x00, 0x61, 0x00,
+ 0x00, 0x06, 0x61, 0x01, 0x00, 0xc1, 0x00, 0x56, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x54,
+ 0x21, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x02, 0x54, 0x42, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x03, 0x54,
+ 0xf8, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x04, 0x54, 0x23, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x05, 0x54,
+ 0xec, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x06, 0x54, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x07, 0x54,
+ 0xfa, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x08, 0x54, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x09, 0x54,
+ 0xfc, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x0a, 0x54, 0x43, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x0b, 0x54,
+ 0xfd, 0x00, 0x00, 0x00, 0x00, 0x06, 0xcc, 0x0e, 0xcf, 0x69, 0x01, 0x00, 0x5f, 0x06, 0x00, 0x06,
+ 0x2e, 0xc6, 0x03, 0x01, 0x30, 0x01, 0x00, 0x2c, 0x10, 0x3b, 0x08, 0x35, 0x00, 0x03, 0x14, 0x00,
+ 0x0f, 0x5a, 0x00, 0x08, 0x46, 0x00, 0x08, 0x26, 0x00, 0x08, 0x36, 0x00, 0x08, 0x30, 0x00, 0x08,
+ 0x62, 0x00, 0x08, 0x74, 0x00, 0x08, 0x2a, 0x00, 0x08, 0x28, 0x00, 0x08, 0x40, 0x00, 0x08, 0x3c,
+ 0x2b, 0x00, 0x0a, 0xc6, 0x04, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x01, 0x01, 0x03, 0x01, 0x00,
+ 0x83, 0x01, 0x02, 0xfc, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0xee, 0x01, 0x01, 0x0d,
+ 0x08, 0xcb, 0x2b, 0x66, 0x00, 0x00, 0x11, 0xec, 0x06, 0xc7, 0x1b, 0x24, 0x00, 0x00, 0x0e, 0xc7,
+ 0xd3, 0x43, 0xfe, 0x00, 0x00, 0x00, 0xc7, 0x04, 0xff, 0x00, 0x00, 0x00, 0x43, 0x00, 0x01, 0x00,
+ 0x00, 0xc7, 0x0b, 0x04, 0x01, 0x01, 0x00, 0x00, 0x4c, 0x21, 0x00, 0x00, 0x00, 0x04, 0x02, 0x01,
+ 0x00, 0x00, 0x4c, 0x42, 0x00, 0x00, 0x00, 0x04, 0x03, 0x01, 0x00, 0x00, 0x4c, 0x23, 0x00, 0x00,
+ 0x00, 0x04, 0x04, 0x01, 0x00, 0x00, 0x4c, 0xf8, 0x00, 0x00, 0x00, 0x04, 0x05, 0x01, 0x00, 0x00,
+ 0x4c, 0xec, 0x00, 0x00, 0x00, 0x04, 0x06, 0x01, 0x00, 0x00, 0x4c, 0xfc, 0x00, 0x00, 0x00, 0x04,
+ 0x07, 0x01, 0x00, 0x00, 0x4c, 0xfb, 0x00, 0x00, 0x00, 0x04, 0x08, 0x01, 0x00, 0x00, 0x4c, 0x43,
+ 0x00, 0x00, 0x00, 0x04, 0x09, 0x01, 0x00, 0x00, 0x4c, 0xfd, 0x00, 0x00, 0x00, 0x43, 0x0a, 0x01,
+ 0x00, 0x00, 0x29, 0xc6, 0x03, 0x18, 0x0e, 0x4f, 0x28, 0x3c, 0x0d, 0x35, 0x35, 0x35, 0x35, 0x35,
+ 0x35, 0x35, 0x35, 0x35, 0x1c, 0x0e, 0x62, 0x07, 0x01, 0x00, 0x01, 0x03, 0x01, 0x06, 0x03, 0x00,
+ 0xa6, 0x01, 0x04, 0x96, 0x04, 0x00, 0x01, 0x00, 0xfc, 0x03, 0x01, 0x00, 0x30, 0x98, 0x04, 0x01,
+ 0x01, 0x30, 0x10, 0x00, 0x01, 0x00, 0xe4, 0x03, 0x01, 0x0c, 0xe8, 0x03, 0x03, 0x0c, 0xe2, 0x03,
+ 0x00, 0x0c, 0x08, 0xcd, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0xc9, 0x41, 0xfe, 0x00, 0x00, 0x00,
+ 0xcb, 0xd3, 0x97, 0xec, 0x39, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04,
+ 0x0f, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01,
+ 0x00, 0x00, 0x04, 0x10, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x04,
+ 0x11, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x06, 0x2e, 0x66, 0x00, 0x00,
+ 0x42, 0x12, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x97, 0xec, 0x19, 0x66, 0x00, 0x00, 0x42,
+ 0x5c, 0x00, 0x00, 0x00, 0x66, 0x01, 0x00, 0x42, 0x13, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xd3,
+ 0x24, 0x02, 0x00, 0xd7, 0x66, 0x02, 0x00, 0x42, 0xec, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x8c, 0xcc, 0x62, 0x01, 0x00, 0x42, 0x14, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00,
+ 0x8c, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x15, 0x01, 0x00,
+ 0x00, 0xd3, 0x24, 0x02, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x31, 0x0c, 0x2b, 0x27, 0x17, 0x62,
+ 0xb2, 0x08, 0x09, 0x4e, 0x7d, 0x53, 0x4b, 0x67, 0x0e, 0x62, 0x07, 0x01, 0x00, 0x01, 0x08, 0x01,
+ 0x0a, 0x02, 0x00, 0x8a, 0x02, 0x09, 0x6e, 0x00, 0x01, 0x00, 0xfc, 0x03, 0x01, 0x00, 0x30, 0xac,
+ 0x04, 0x01, 0x01, 0x30, 0x98, 0x04, 0x01, 0x02, 0x30, 0x82, 0x01, 0x01, 0x03, 0x30, 0xd8, 0x01,
+ 0x01, 0x04, 0x30, 0x6e, 0x08, 0x05, 0x30, 0x82, 0x01, 0x09, 0x06, 0x30, 0x10, 0x00, 0x01, 0x00,
+ 0xec, 0x03, 0x05, 0x0c, 0xe2, 0x03, 0x00, 0x0c, 0x08, 0xc5, 0x07, 0x61, 0x04, 0x00, 0x61, 0x03,
+ 0x00, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0xd3, 0x97, 0xec, 0x2b, 0x38, 0x0d,
+ 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x17, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00,
+ 0x00, 0x00, 0x66, 0x00, 0x00, 0x41, 0x37, 0x00, 0x00, 0x00, 0x04, 0x18, 0x01, 0x00, 0x00, 0x24,
+ 0x02, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x06, 0x2e, 0xc4, 0x07, 0x41, 0xfe, 0x00, 0x00, 0x00, 0xcb,
+ 0x38, 0x0d, 0x01, 0x00, 0x00, 0x41, 0x16, 0x01, 0x00, 0x00, 0xcc, 0x66, 0x01, 0x00, 0x42, 0xec,
+ 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x24, 0x01, 0x00, 0x8c, 0xcd, 0x62, 0x02, 0x00, 0x42, 0x19,
+ 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0xce, 0x62, 0x03, 0x00, 0x07, 0xab, 0xec, 0x16, 0x38,
+ 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x62, 0x03, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0x62, 0x03, 0x00, 0x2e, 0x62, 0x02, 0x00, 0x42, 0x1a, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00,
+ 0xc5, 0x04, 0x62, 0x04, 0x00, 0x07, 0xaa, 0xec, 0x12, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e,
+ 0x01, 0x00, 0x00, 0x07, 0x24, 0x01, 0x00, 0x0e, 0x06, 0x2e, 0x61, 0x05, 0x00, 0x62, 0x04, 0x00,
+ 0x7e, 0xee, 0x49, 0xc5, 0x05, 0x61, 0x06, 0x00, 0x38, 0xa0, 0x00, 0x00, 0x00, 0x42, 0x1b, 0x01,
+ 0x00, 0x00, 0x62, 0x04, 0x00, 0x62, 0x05, 0x00, 0x47, 0x24, 0x01, 0x00, 0xc5, 0x06, 0x38, 0x0d,
+ 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0xc3, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x05,
+ 0x00, 0x04, 0x1c, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x42, 0x1d, 0x01, 0x00, 0x00, 0x62, 0x06,
+ 0x00, 0x24, 0x01, 0x00, 0x24, 0x03, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x81, 0xec, 0xb6, 0x0e, 0x0e,
+ 0x06, 0x2e, 0xc6, 0x03, 0x4a, 0x16, 0x5d, 0x17, 0xcb, 0x08, 0x09, 0x2c, 0x3b, 0x53, 0x44, 0x26,
+ 0x58, 0x12, 0x0a, 0x49, 0x26, 0x4e, 0x08, 0x09, 0x49, 0x71, 0xe4, 0x1c, 0x0e, 0x62, 0x07, 0x01,
+ 0x00, 0x00, 0x07, 0x00, 0x08, 0x02, 0x00, 0x84, 0x02, 0x07, 0xfc, 0x03, 0x01, 0x00, 0x30, 0xac,
+ 0x04, 0x01, 0x01, 0x30, 0x98, 0x04, 0x01, 0x02, 0x30, 0xd8, 0x01, 0x01, 0x03, 0x30, 0x6e, 0x02,
+ 0x04, 0x30, 0x82, 0x01, 0x03, 0x05, 0x30, 0x10, 0x00, 0x01, 0x00, 0xe2, 0x03, 0x00, 0x0c, 0xec,
+ 0x03, 0x05, 0x0c, 0x08, 0xc5, 0x06, 0x61, 0x03, 0x00, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61,
+ 0x00, 0x00, 0xc4, 0x06, 0x41, 0xfe, 0x00, 0x00, 0x00, 0xcb, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x41,
+ 0x16, 0x01, 0x00, 0x00, 0xcc, 0x66, 0x00, 0x00, 0x42, 0xec, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x8c, 0xcd, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04,
+ 0x1e, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01,
+ 0x00, 0x00, 0x04, 0x1f, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x42, 0x1d, 0x01, 0x00, 0x00, 0x62,
+ 0x02, 0x00, 0x41, 0x0b, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0x24,
+ 0x03, 0x00, 0x0e, 0x62, 0x02, 0x00, 0x41, 0x21, 0x01, 0x00, 0x00, 0xce, 0x61, 0x04, 0x00, 0x62,
+ 0x03, 0x00, 0x7e, 0xee, 0x49, 0xc5, 0x04, 0x61, 0x05, 0x00, 0x38, 0xa0, 0x00, 0x00, 0x00, 0x42,
+ 0x1b, 0x01, 0x00, 0x00, 0x62, 0x03, 0x00, 0x62, 0x04, 0x00, 0x47, 0x24, 0x01, 0x00, 0xc5, 0x05,
+ 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0xc3, 0x42, 0x5d, 0x00, 0x00, 0x00,
+ 0x62, 0x01, 0x00, 0x42, 0x22, 0x01, 0x00, 0x00, 0x62, 0x04, 0x00, 0x24, 0x01, 0x00, 0x04, 0x1c,
+ 0x01, 0x00, 0x00, 0x62, 0x05, 0x00, 0x24, 0x03, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x81, 0xec, 0xb6,
+ 0x0e, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x42,
+ 0x1d, 0x01, 0x00, 0x00, 0x04, 0x23, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x66, 0x01,
+ 0x00, 0x41, 0x37, 0x00, 0x00, 0x00, 0x04, 0x24, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x24, 0x01,
+ 0x00, 0x24, 0x01, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x6b, 0x0e, 0x4e, 0x2b, 0x3a, 0x53, 0x62,
+ 0xdb, 0x30, 0x49, 0x71, 0xe4, 0x1d, 0x00, 0x33, 0x02, 0x0e, 0x62, 0x07, 0x01, 0x00, 0x01, 0x04,
+ 0x01, 0x06, 0x03, 0x00, 0xca, 0x01, 0x05, 0x96, 0x04, 0x00, 0x01, 0x00, 0xfc, 0x03, 0x01, 0x00,
+ 0x30, 0xca, 0x04, 0x01, 0x01, 0x30, 0x98, 0x04, 0x01, 0x02, 0x30, 0x10, 0x00, 0x01, 0x00, 0xe4,
+ 0x03, 0x01, 0x0c, 0xe8, 0x03, 0x03, 0x0c, 0xe2, 0x03, 0x00, 0x0c, 0x08, 0xce, 0x61, 0x02, 0x00,
+ 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0xca, 0x41, 0xfe, 0x00, 0x00, 0x00, 0xcb, 0xd3, 0x97, 0xec,
+ 0x39, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x26, 0x01, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x27,
+ 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x04, 0x28, 0x01, 0x00, 0x00,
+ 0x24, 0x02, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x06, 0x2e, 0x66, 0x00, 0x00, 0x42, 0x12, 0x01, 0x00,
+ 0x00, 0xd3, 0x24, 0x01, 0x00, 0x97, 0xec, 0x19, 0x66, 0x00, 0x00, 0x42, 0x5c, 0x00, 0x00, 0x00,
+ 0x66, 0x01, 0x00, 0x42, 0x13, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xd3, 0x24, 0x02, 0x00, 0xd7,
+ 0x66, 0x02, 0x00, 0x42, 0x29, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x8c, 0xcc, 0x66, 0x02,
+ 0x00, 0x42, 0xec, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x24, 0x01, 0x00, 0x8c, 0xcd, 0x62, 0x02,
+ 0x00, 0x42, 0x43, 0x00, 0x00, 0x00, 0x62, 0x01, 0x00, 0x41, 0x21, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0x62, 0x02, 0x00, 0x42, 0x14, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x8c, 0x0e, 0x38,
+ 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x2a, 0x01, 0x00, 0x00, 0xd3, 0x24,
+ 0x02, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x7f, 0x0e, 0x3a, 0x27, 0x17, 0x62, 0xb2, 0x08, 0x09,
+ 0x4e, 0x7d, 0x4b, 0x53, 0x67, 0x45, 0x67, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x02, 0x02, 0x02, 0x06,
+ 0x01, 0x00, 0xa2, 0x01, 0x04, 0xd6, 0x04, 0x00, 0x01, 0x00, 0xdc, 0x01, 0x00, 0x01, 0x00, 0xfc,
+ 0x03, 0x01, 0x00, 0x30, 0x10, 0x00, 0x01, 0x00, 0xec, 0x03, 0x05, 0x0c, 0x08, 0xcc, 0x61, 0x00,
+ 0x00, 0xd3, 0x04, 0x16, 0x00, 0x00, 0x00, 0xab, 0xec, 0x3c, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42,
+ 0x0e, 0x01, 0x00, 0x00, 0x04, 0x17, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x66, 0x00,
+ 0x00, 0x41, 0x37, 0x00, 0x00, 0x00, 0x04, 0x2c, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x2d, 0x01, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0x29, 0xc8, 0x41, 0xfe, 0x00, 0x00, 0x00, 0xcb, 0x62, 0x00, 0x00, 0x04,
+ 0x2e, 0x01, 0x00, 0x00, 0xaa, 0xec, 0x0d, 0xc8, 0x42, 0xfa, 0x00, 0x00, 0x00, 0xd4, 0x24, 0x01,
+ 0x00, 0x0e, 0x29, 0x62, 0x00, 0x00, 0x04, 0x2f, 0x01, 0x00, 0x00, 0xaa, 0xec, 0x0d, 0xc8, 0x42,
+ 0xf9, 0x00, 0x00, 0x00, 0xd4, 0x24, 0x01, 0x00, 0x0e, 0x29, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42,
+ 0x0e, 0x01, 0x00, 0x00, 0x04, 0x30, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x00,
+ 0x00, 0x04, 0x31, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x29, 0xc6, 0x03,
+ 0x9b, 0x01, 0x0c, 0x1c, 0x30, 0xcb, 0x5e, 0x09, 0x26, 0x3a, 0x3b, 0x3f, 0x3b, 0x08, 0xb3, 0x0e,
+ 0x62, 0x07, 0x01, 0x00, 0x01, 0x05, 0x01, 0x05, 0x01, 0x01, 0xd0, 0x01, 0x06, 0xdc, 0x01, 0x00,
+ 0x01, 0x00, 0xe4, 0x04, 0x02, 0x00, 0x70, 0xe6, 0x04, 0x02, 0x01, 0x70, 0xe8, 0x04, 0x02, 0x02,
+ 0x22, 0xea, 0x04, 0x02, 0x03, 0x30, 0xec, 0x04, 0x05, 0x00, 0x03, 0xe2, 0x03, 0x00, 0x0c, 0x38,
+ 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x37, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0x6d, 0x9a, 0x00, 0x00, 0x00, 0x61, 0x03, 0x00, 0xc2, 0x00, 0xcd, 0x61, 0x01, 0x00,
+ 0x61, 0x00, 0x00, 0x66, 0x00, 0x00, 0x42, 0xec, 0x00, 0x00, 0x00, 0x04, 0x38, 0x01, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x8c, 0xcb, 0x66, 0x00, 0x00, 0x42, 0xec, 0x00, 0x00, 0x00, 0x04, 0x2f, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x8c, 0xcc, 0xc2, 0x00, 0x0e, 0x62, 0x02, 0x00, 0x04, 0x39, 0x01,
+ 0x00, 0x00, 0xf1, 0x8c, 0x0e, 0x62, 0x02, 0x00, 0x04, 0x3a, 0x01, 0x00, 0x00, 0xf1, 0x8c, 0x0e,
+ 0x62, 0x02, 0x00, 0x04, 0x3b, 0x01, 0x00, 0x00, 0xf1, 0x8c, 0x0e, 0x62, 0x00, 0x00, 0x42, 0x3c,
+ 0x01, 0x00, 0x00, 0x04, 0x3d, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xce, 0x62, 0x03, 0x00, 0xec,
+ 0x17, 0x62, 0x01, 0x00, 0x42, 0x3e, 0x01, 0x00, 0x00, 0x04, 0x3f, 0x01, 0x00, 0x00, 0x04, 0x40,
+ 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e, 0x62, 0x01, 0x00, 0x42, 0x14, 0x01, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0x8c, 0x0e, 0x69, 0x01, 0x00, 0x69, 0x00, 0x00, 0x0e, 0xee, 0x21, 0xc5, 0x04, 0x6d,
+ 0x1c, 0x00, 0x00, 0x00, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0xc4, 0x04,
+ 0x41, 0x33, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x0e, 0xee, 0x02, 0x2f, 0x06, 0x2e, 0xc6,
+ 0x03, 0xb2, 0x01, 0x12, 0x03, 0x63, 0x58, 0x5d, 0x00, 0x12, 0x2a, 0x14, 0x3a, 0x3a, 0x3b, 0x58,
+ 0x1c, 0x73, 0x63, 0x35, 0x6c, 0x17, 0x0e, 0x62, 0x06, 0x01, 0xe8, 0x04, 0x02, 0x01, 0x02, 0x04,
+ 0x02, 0x00, 0x50, 0x03, 0x6e, 0x00, 0x01, 0x00, 0x82, 0x05, 0x00, 0x01, 0x00, 0x82, 0x01, 0x01,
+ 0x00, 0x30, 0xe4, 0x04, 0x00, 0x0d, 0xe6, 0x04, 0x01, 0x0d, 0x61, 0x00, 0x00, 0x66, 0x00, 0x00,
+ 0x42, 0x19, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0xcb, 0x62, 0x00, 0x00, 0x07, 0xaa, 0xec,
+ 0x03, 0x06, 0x2e, 0xd4, 0x97, 0xec, 0x03, 0xd3, 0xd8, 0x66, 0x01, 0x00, 0x42, 0x3e, 0x01, 0x00,
+ 0x00, 0xd4, 0x62, 0x00, 0x00, 0x24, 0x02, 0x00, 0xec, 0x1f, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42,
+ 0x0e, 0x01, 0x00, 0x00, 0x04, 0x42, 0x01, 0x00, 0x00, 0xd4, 0x9e, 0x04, 0x43, 0x01, 0x00, 0x00,
+ 0x9e, 0x62, 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0xbf, 0x01, 0x09, 0x12,
+ 0x44, 0x26, 0x08, 0x09, 0x17, 0x0f, 0x58, 0x9a, 0x0e, 0x62, 0x07, 0x01, 0x00, 0x01, 0x04, 0x01,
+ 0x04, 0x01, 0x01, 0xf0, 0x01, 0x05, 0xdc, 0x01, 0x00, 0x01, 0x00, 0xe4, 0x04, 0x02, 0x00, 0x70,
+ 0x88, 0x05, 0x02, 0x01, 0x70, 0xe8, 0x04, 0x02, 0x02, 0x22, 0xec, 0x04, 0x05, 0x00, 0x03, 0xe2,
+ 0x03, 0x00, 0x0c, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x45, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x6d, 0xbc, 0x00, 0x00, 0x00, 0xc2, 0x00, 0xcd, 0x61, 0x01,
+ 0x00, 0x61, 0x00, 0x00, 0x66, 0x00, 0x00, 0x42, 0xec, 0x00, 0x00, 0x00, 0x04, 0x38, 0x01, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0x8c, 0xcb, 0x66, 0x00, 0x00, 0x42, 0xec, 0x00, 0x00, 0x00, 0x04, 0x2e,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x8c, 0xcc, 0xc2, 0x00, 0x0e, 0x62, 0x02, 0x00, 0x04, 0x46,
+ 0x01, 0x00, 0x00, 0xf1, 0x8c, 0x0e, 0x62, 0x02, 0x00, 0x04, 0x47, 0x01, 0x00, 0x00, 0xf1, 0x8c,
+ 0x0e, 0x62, 0x02, 0x00, 0x04, 0x48, 0x01, 0x00, 0x00, 0xf1, 0x8c, 0x0e, 0x62, 0x02, 0x00, 0x04,
+ 0x49, 0x01, 0x00, 0x00, 0xf1, 0x8c, 0x0e, 0x62, 0x02, 0x00, 0x04, 0x4a, 0x01, 0x00, 0x00, 0xf1,
+ 0x8c, 0x0e, 0x62, 0x02, 0x00, 0x04, 0x4b, 0x01, 0x00, 0x00, 0xf1, 0x8c, 0x0e, 0x62, 0x02, 0x00,
+ 0x04, 0x4c, 0x01, 0x00, 0x00, 0xf1, 0x8c, 0x0e, 0x62, 0x02, 0x00, 0x04, 0x4d, 0x01, 0x00, 0x00,
+ 0xf1, 0x8c, 0x0e, 0xd3, 0x97, 0xec, 0x17, 0x62, 0x02, 0x00, 0x04, 0x4e, 0x01, 0x00, 0x00, 0xf1,
+ 0x8c, 0x0e, 0x62, 0x02, 0x00, 0x04, 0x4f, 0x01, 0x00, 0x00, 0xf1, 0x8c, 0x0e, 0x62, 0x01, 0x00,
+ 0x42, 0x14, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x8c, 0x0e, 0x69, 0x01, 0x00, 0x69, 0x00, 0x00,
+ 0x0e, 0xee, 0x1f, 0xce, 0x6d, 0x1b, 0x00, 0x00, 0x00, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e,
+ 0x01, 0x00, 0x00, 0xca, 0x41, 0x33, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x0e, 0xee, 0x02,
+ 0x2f, 0x06, 0x2e, 0xc6, 0x03, 0xe3, 0x01, 0x17, 0x03, 0x63, 0x49, 0x5d, 0x00, 0x12, 0x2a, 0x14,
+ 0x3c, 0x3a, 0x3c, 0x3a, 0x3a, 0x3a, 0x3a, 0x3b, 0x17, 0x3a, 0x3c, 0x63, 0x30, 0x67, 0x17, 0x0e,
+ 0x62, 0x06, 0x01, 0xe8, 0x04, 0x02, 0x01, 0x02, 0x04, 0x02, 0x00, 0x50, 0x03, 0x6e, 0x00, 0x01,
+ 0x00, 0x82, 0x05, 0x00, 0x01, 0x00, 0x82, 0x01, 0x01, 0x00, 0x30, 0xe4, 0x04, 0x00, 0x0d, 0x88,
+ 0x05, 0x01, 0x0d, 0x61, 0x00, 0x00, 0x66, 0x00, 0x00, 0x42, 0x19, 0x01, 0x00, 0x00, 0xd3, 0x24,
+ 0x01, 0x00, 0xcb, 0x62, 0x00, 0x00, 0x07, 0xaa, 0xec, 0x03, 0x06, 0x2e, 0xd4, 0x97, 0xec, 0x03,
+ 0xd3, 0xd8, 0x66, 0x01, 0x00, 0x42, 0x3e, 0x01, 0x00, 0x00, 0xd4, 0x62, 0x00, 0x00, 0x24, 0x02,
+ 0x00, 0xec, 0x1f, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x42, 0x01,
+ 0x00, 0x00, 0xd4, 0x9e, 0x04, 0x43, 0x01, 0x00, 0x00, 0x9e, 0x62, 0x00, 0x00, 0x24, 0x02, 0x00,
+ 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0xf0, 0x01, 0x09, 0x12, 0x44, 0x26, 0x08, 0x09, 0x17, 0x0f, 0x58,
+ 0x9a, 0x0e, 0x62, 0x07, 0x01, 0x00, 0x02, 0x03, 0x02, 0x06, 0x01, 0x00, 0x90, 0x01, 0x05, 0xa0,
+ 0x05, 0x00, 0x01, 0x00, 0x82, 0x05, 0x00, 0x01, 0x00, 0xfc, 0x03, 0x01, 0x00, 0x30, 0x98, 0x04,
+ 0x01, 0x01, 0x30, 0x10, 0x00, 0x01, 0x00, 0xe2, 0x03, 0x00, 0x0c, 0x08, 0xcd, 0x61, 0x01, 0x00,
+ 0x61, 0x00, 0x00, 0xc9, 0x41, 0xfe, 0x00, 0x00, 0x00, 0xcb, 0xd3, 0x97, 0xec, 0x39, 0x38, 0x0d,
+ 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x51, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x52, 0x01, 0x00, 0x00,
+ 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x04, 0x53, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0x06, 0x2e, 0x66, 0x00, 0x00, 0x42, 0xec, 0x00, 0x00, 0x00, 0x62, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0x8c, 0xcc, 0x62, 0x01, 0x00, 0x42, 0x54, 0x01, 0x00, 0x00, 0xd3, 0xd4,
+ 0x24, 0x02, 0x00, 0x0e, 0x62, 0x01, 0x00, 0x42, 0x14, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x8c,
+ 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x55, 0x01, 0x00, 0x00,
+ 0x04, 0x6a, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x9e, 0x02, 0x0b,
+ 0x2b, 0x27, 0x17, 0x62, 0xb2, 0x08, 0x09, 0x53, 0x49, 0x45, 0x7b, 0x0e, 0x62, 0x07, 0x01, 0x00,
+ 0x01, 0x03, 0x01, 0x06, 0x01, 0x00, 0x8f, 0x01, 0x04, 0x6e, 0x00, 0x01, 0x00, 0xfc, 0x03, 0x01,
+ 0x00, 0x30, 0x98, 0x04, 0x01, 0x01, 0x30, 0x10, 0x00, 0x01, 0x00, 0xe2, 0x03, 0x00, 0x0c, 0x08,
+ 0xcd, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0xc9, 0x41, 0xfe, 0x00, 0x00, 0x00, 0xcb, 0xd3, 0x97,
+ 0xec, 0x39, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x56, 0x01, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04,
+ 0x52, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x04, 0x57, 0x01, 0x00,
+ 0x00, 0x24, 0x02, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x06, 0x2e, 0x66, 0x00, 0x00, 0x42, 0xec, 0x00,
+ 0x00, 0x00, 0x62, 0x00, 0x00, 0x24, 0x01, 0x00, 0x8c, 0xcc, 0x62, 0x01, 0x00, 0x42, 0x58, 0x01,
+ 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x0e, 0x62, 0x01, 0x00, 0x42, 0x14, 0x01, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0x8c, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x55,
+ 0x01, 0x00, 0x00, 0x04, 0x6a, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03,
+ 0xb2, 0x02, 0x0b, 0x2b, 0x27, 0x17, 0x62, 0xb2, 0x08, 0x09, 0x53, 0x44, 0x45, 0x7b, 0x0e, 0x60,
+ 0x07, 0x01, 0x00, 0x01, 0x07, 0x00, 0x09, 0x02, 0x00, 0xf7, 0x01, 0x08, 0xd8, 0x01, 0x00, 0x01,
+ 0x00, 0xfc, 0x03, 0x01, 0x00, 0x30, 0x98, 0x04, 0x01, 0x01, 0x30, 0xc2, 0x04, 0x01, 0x02, 0x30,
+ 0x82, 0x01, 0x04, 0x03, 0x30, 0xb2, 0x05, 0x05, 0x04, 0x30, 0x6e, 0x07, 0x05, 0x30, 0x10, 0x00,
+ 0x01, 0x00, 0xec, 0x03, 0x05, 0x0c, 0xe2, 0x03, 0x00, 0x0c, 0x08, 0xc5, 0x06, 0x0d, 0x00, 0x00,
+ 0xd7, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0xc4, 0x06, 0x41, 0xfe, 0x00, 0x00,
+ 0x00, 0xcb, 0xd3, 0xb7, 0x47, 0x97, 0xec, 0x3e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01,
+ 0x00, 0x00, 0x04, 0x5a, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00,
+ 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x5b, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x66,
+ 0x00, 0x00, 0x41, 0x37, 0x00, 0x00, 0x00, 0x04, 0x5c, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0x06, 0x2e, 0x66, 0x01, 0x00, 0x42, 0xec, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x8c, 0xcc, 0x0b, 0xcd, 0x61, 0x03, 0x00, 0xd3, 0x7f, 0xee, 0x4a, 0xce, 0x61,
+ 0x04, 0x00, 0x62, 0x03, 0x00, 0x42, 0x5d, 0x01, 0x00, 0x00, 0x04, 0x5e, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0xc5, 0x04, 0x62, 0x04, 0x00, 0xb7, 0xa6, 0xec, 0x2d, 0x61, 0x05, 0x00, 0x62, 0x03,
+ 0x00, 0x42, 0x5f, 0x01, 0x00, 0x00, 0xb7, 0x62, 0x04, 0x00, 0x24, 0x02, 0x00, 0xc5, 0x05, 0x62,
+ 0x02, 0x00, 0x62, 0x05, 0x00, 0x73, 0x62, 0x03, 0x00, 0x42, 0x5f, 0x01, 0x00, 0x00, 0x62, 0x04,
+ 0x00, 0xb8, 0x9e, 0x24, 0x01, 0x00, 0x49, 0x82, 0x00, 0xec, 0xb4, 0x0e, 0x85, 0x62, 0x01, 0x00,
+ 0x42, 0x43, 0x00, 0x00, 0x00, 0x62, 0x02, 0x00, 0x24, 0x01, 0x00, 0xec, 0x23, 0x38, 0x0d, 0x01,
+ 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x60, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0x62, 0x01, 0x00, 0x42, 0x14, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x8c, 0x0e, 0x0a, 0x2e, 0x06,
+ 0x2e, 0xc6, 0x03, 0xc6, 0x02, 0x14, 0x53, 0x2c, 0x21, 0x62, 0xcb, 0x08, 0x09, 0x54, 0x0d, 0x3a,
+ 0x5d, 0x35, 0x58, 0x7c, 0x23, 0x53, 0x62, 0x44, 0x08, 0x08, 0x0e, 0x60, 0x07, 0x01, 0x00, 0x01,
+ 0x05, 0x00, 0x06, 0x02, 0x00, 0xbc, 0x01, 0x06, 0xc2, 0x05, 0x00, 0x01, 0x00, 0xfc, 0x03, 0x01,
+ 0x00, 0x30, 0x98, 0x04, 0x01, 0x01, 0x30, 0xdc, 0x01, 0x01, 0x02, 0x20, 0x6e, 0x04, 0x03, 0x30,
+ 0x10, 0x00, 0x01, 0x00, 0xec, 0x03, 0x05, 0x0c, 0xe2, 0x03, 0x00, 0x0c, 0x08, 0xc5, 0x04, 0x0d,
+ 0x00, 0x00, 0xd7, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0xc4, 0x04, 0x41, 0xfe,
+ 0x00, 0x00, 0x00, 0xcb, 0xd3, 0xb7, 0x47, 0x97, 0xec, 0x3e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42,
+ 0x0e, 0x01, 0x00, 0x00, 0x04, 0x62, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x38, 0x0d, 0x01,
+ 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x5b, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00,
+ 0x00, 0x66, 0x00, 0x00, 0x41, 0x37, 0x00, 0x00, 0x00, 0x04, 0x63, 0x01, 0x00, 0x00, 0x24, 0x02,
+ 0x00, 0x24, 0x01, 0x00, 0x0e, 0x06, 0x2e, 0x66, 0x01, 0x00, 0x42, 0xec, 0x00, 0x00, 0x00, 0x62,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x8c, 0xcc, 0xb7, 0xcd, 0x61, 0x03, 0x00, 0xd3, 0x7f, 0xee, 0x1a,
+ 0xce, 0x62, 0x01, 0x00, 0x42, 0x64, 0x01, 0x00, 0x00, 0x62, 0x03, 0x00, 0x24, 0x01, 0x00, 0xec,
+ 0x09, 0x62, 0x02, 0x00, 0x92, 0x63, 0x02, 0x00, 0x0e, 0x82, 0x00, 0xec, 0xe4, 0x0e, 0x85, 0x62,
+ 0x02, 0x00, 0xec, 0x23, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x60,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x62, 0x01, 0x00, 0x42, 0x14, 0x01, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0x8c, 0x0e, 0x0a, 0x2e, 0x06, 0x2e, 0xc6, 0x03, 0xe7, 0x02, 0x12, 0x53, 0x2c, 0x21,
+ 0x62, 0xcb, 0x08, 0x09, 0x54, 0x0d, 0x2b, 0x53, 0x2c, 0x22, 0x1c, 0x62, 0x44, 0x08, 0x08, 0x0e,
+ 0x43, 0x06, 0x01, 0xd0, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x09, 0x9a, 0x01, 0x02, 0xfc, 0x03,
+ 0x00, 0x01, 0x00, 0xca, 0x05, 0x01, 0x00, 0x70, 0xe0, 0x03, 0x06, 0x08, 0x61, 0x00, 0x00, 0x66,
+ 0x00, 0x00, 0x11, 0xd3, 0x21, 0x01, 0x00, 0xcb, 0x0b, 0x62, 0x00, 0x00, 0x41, 0x00, 0x01, 0x00,
+ 0x00, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x41, 0x0a, 0x01, 0x00, 0x00, 0x4c, 0x0a,
+ 0x01, 0x00, 0x00, 0x0b, 0xc2, 0x00, 0x4d, 0x21, 0x00, 0x00, 0x00, 0x4c, 0x21, 0x00, 0x00, 0x00,
+ 0xc2, 0x01, 0x4d, 0x42, 0x00, 0x00, 0x00, 0x4c, 0x42, 0x00, 0x00, 0x00, 0xc2, 0x02, 0x4d, 0xf8,
+ 0x00, 0x00, 0x00, 0x4c, 0xf8, 0x00, 0x00, 0x00, 0xc2, 0x03, 0x4d, 0x23, 0x00, 0x00, 0x00, 0x4c,
+ 0x23, 0x00, 0x00, 0x00, 0xc2, 0x04, 0x4d, 0xec, 0x00, 0x00, 0x00, 0x4c, 0xec, 0x00, 0x00, 0x00,
+ 0xc2, 0x05, 0x4d, 0x43, 0x00, 0x00, 0x00, 0x4c, 0x43, 0x00, 0x00, 0x00, 0xc2, 0x06, 0x4d, 0xfb,
+ 0x00, 0x00, 0x00, 0x4c, 0xfb, 0x00, 0x00, 0x00, 0xc2, 0x07, 0x4d, 0xfc, 0x00, 0x00, 0x00, 0x4c,
+ 0xfc, 0x00, 0x00, 0x00, 0xc2, 0x08, 0x4d, 0xfd, 0x00, 0x00, 0x00, 0x4c, 0xfd, 0x00, 0x00, 0x00,
+ 0x4c, 0x65, 0x01, 0x00, 0x00, 0x28, 0xc6, 0x03, 0x85, 0x03, 0x10, 0x12, 0x30, 0x08, 0x44, 0x44,
+ 0x08, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x1c, 0x0e, 0x42, 0x06, 0x01, 0x00,
+ 0x01, 0x00, 0x01, 0x03, 0x01, 0x00, 0x0c, 0x01, 0x96, 0x04, 0x00, 0x01, 0x00, 0xca, 0x05, 0x00,
+ 0x0d, 0x66, 0x00, 0x00, 0x42, 0x21, 0x00, 0x00, 0x00, 0xd3, 0x25, 0x01, 0x00, 0xc6, 0x03, 0x8b,
+ 0x03, 0x00, 0x0e, 0x40, 0x06, 0x01, 0x00, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00, 0x18, 0x01, 0xcc,
+ 0x05, 0x00, 0x01, 0x00, 0xca, 0x05, 0x00, 0x0d, 0x0d, 0x00, 0x00, 0xd7, 0x66, 0x00, 0x00, 0x42,
+ 0x42, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0xb7, 0xd3, 0x52, 0x0e, 0x18, 0x27, 0x00, 0x00, 0x28,
+ 0xc6, 0x03, 0x8c, 0x03, 0x00, 0x0e, 0x42, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
+ 0x0b, 0x00, 0xca, 0x05, 0x00, 0x0d, 0x66, 0x00, 0x00, 0x42, 0xf8, 0x00, 0x00, 0x00, 0x25, 0x00,
+ 0x00, 0xc6, 0x03, 0x8d, 0x03, 0x00, 0x0e, 0x42, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01, 0x03, 0x01,
+ 0x00, 0x0c, 0x01, 0x96, 0x04, 0x00, 0x01, 0x00, 0xca, 0x05, 0x00, 0x0d, 0x66, 0x00, 0x00, 0x42,
+ 0x23, 0x00, 0x00, 0x00, 0xd3, 0x25, 0x01, 0x00, 0xc6, 0x03, 0x8e, 0x03, 0x00, 0x0e, 0x40, 0x06,
+ 0x01, 0x00, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00, 0x18, 0x01, 0xcc, 0x05, 0x00, 0x01, 0x00, 0xca,
+ 0x05, 0x00, 0x0d, 0x0d, 0x00, 0x00, 0xd7, 0x66, 0x00, 0x00, 0x42, 0xec, 0x00, 0x00, 0x00, 0x26,
+ 0x00, 0x00, 0xb7, 0xd3, 0x52, 0x0e, 0x18, 0x27, 0x00, 0x00, 0x28, 0xc6, 0x03, 0x8f, 0x03, 0x00,
+ 0x0e, 0x40, 0x06, 0x01, 0x00, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00, 0x18, 0x01, 0xd8, 0x01, 0x00,
+ 0x01, 0x00, 0xca, 0x05, 0x00, 0x0d, 0x0d, 0x00, 0x00, 0xd7, 0x66, 0x00, 0x00, 0x42, 0x43, 0x00,
+ 0x00, 0x00, 0x26, 0x00, 0x00, 0xb7, 0xd3, 0x52, 0x0e, 0x18, 0x27, 0x00, 0x00, 0x28, 0xc6, 0x03,
+ 0x90, 0x03, 0x00, 0x0e, 0x42, 0x06, 0x01, 0x00, 0x02, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0d, 0x02,
+ 0xa0, 0x05, 0x00, 0x01, 0x00, 0x82, 0x05, 0x00, 0x01, 0x00, 0xca, 0x05, 0x00, 0x0d, 0x66, 0x00,
+ 0x00, 0x42, 0xfb, 0x00, 0x00, 0x00, 0xd3, 0xd4, 0x25, 0x02, 0x00, 0xc6, 0x03, 0x91, 0x03, 0x00,
+ 0x0e, 0x42, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01, 0x03, 0x01, 0x00, 0x0c, 0x01, 0x6e, 0x00, 0x01,
+ 0x00, 0xca, 0x05, 0x00, 0x0d, 0x66, 0x00, 0x00, 0x42, 0xfc, 0x00, 0x00, 0x00, 0xd3, 0x25, 0x01,
+ 0x00, 0xc6, 0x03, 0x92, 0x03, 0x00, 0x0e, 0x40, 0x06, 0x01, 0x00, 0x01, 0x00, 0x00, 0x05, 0x01,
+ 0x00, 0x18, 0x01, 0xc2, 0x05, 0x00, 0x01, 0x00, 0xca, 0x05, 0x00, 0x0d, 0x0d, 0x00, 0x00, 0xd7,
+ 0x66, 0x00, 0x00, 0x42, 0xfd, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0xb7, 0xd3, 0x52, 0x0e, 0x18,
+ 0x27, 0x00, 0x00, 0x28, 0xc6, 0x03, 0x93, 0x03, 0x00, 0x0e, 0x41, 0x06, 0x01, 0xd2, 0x03, 0x04,
+ 0x06, 0x03, 0x0a, 0x02, 0x01, 0x8a, 0x03, 0x0a, 0xd0, 0x03, 0x00, 0x01, 0x00, 0xfc, 0x03, 0x00,
+ 0x01, 0x00, 0x6e, 0x00, 0x01, 0x00, 0xcc, 0x05, 0x00, 0x01, 0x00, 0xce, 0x05, 0x01, 0x00, 0x30,
+ 0xac, 0x04, 0x01, 0x01, 0x70, 0xc2, 0x05, 0x01, 0x02, 0x30, 0xd0, 0x05, 0x01, 0x03, 0x60, 0xd2,
+ 0x05, 0x09, 0x06, 0x30, 0xd4, 0x05, 0x01, 0x04, 0x70, 0xd4, 0x03, 0x09, 0x00, 0xec, 0x03, 0x05,
+ 0x0c, 0x0d, 0x03, 0x00, 0xda, 0x61, 0x05, 0x00, 0x61, 0x03, 0x00, 0x61, 0x02, 0x00, 0x61, 0x01,
+ 0x00, 0x61, 0x00, 0x00, 0xdf, 0xd3, 0x41, 0x65, 0x01, 0x00, 0x00, 0xd5, 0xf2, 0xcb, 0x62, 0x00,
+ 0x00, 0xec, 0x15, 0x62, 0x00, 0x00, 0x42, 0x41, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0xb7, 0xd6,
+ 0x52, 0x0e, 0x18, 0x27, 0x00, 0x00, 0x28, 0xd3, 0x41, 0x00, 0x01, 0x00, 0x00, 0xec, 0x1a, 0x38,
+ 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0xd3, 0x41, 0x00, 0x01, 0x00, 0x00, 0x04,
+ 0x20, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x41, 0x16, 0x01,
+ 0x00, 0x00, 0x41, 0x6b, 0x01, 0x00, 0x00, 0xcc, 0xd5, 0xec, 0x38, 0x38, 0x0d, 0x01, 0x00, 0x00,
+ 0x42, 0x0e, 0x01, 0x00, 0x00, 0xc3, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x66, 0x01, 0x00, 0x41, 0x37,
+ 0x00, 0x00, 0x00, 0x04, 0x6c, 0x01, 0x00, 0x00, 0xd4, 0x04, 0x6d, 0x01, 0x00, 0x00, 0xd5, 0x04,
+ 0x6e, 0x01, 0x00, 0x00, 0x24, 0x06, 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e,
+ 0xee, 0x52, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x42,
+ 0x6f, 0x01, 0x00, 0x00, 0x04, 0x70, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x04, 0x20, 0x01, 0x00,
+ 0x00, 0x24, 0x02, 0x00, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04,
+ 0x71, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x66, 0x01, 0x00, 0x41, 0x37, 0x00, 0x00,
+ 0x00, 0x04, 0x6c, 0x01, 0x00, 0x00, 0xd4, 0x04, 0x72, 0x01, 0x00, 0x00, 0x24, 0x04, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0x26, 0x00, 0x00, 0xcd, 0xb8, 0xce, 0x61, 0x04, 0x00, 0xd3, 0x41, 0x65, 0x01,
+ 0x00, 0x00, 0x7e, 0xee, 0x25, 0xc5, 0x04, 0x62, 0x02, 0x00, 0x42, 0x73, 0x01, 0x00, 0x00, 0x62,
+ 0x04, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x62, 0x03, 0x00, 0x62, 0x04, 0x00, 0xeb, 0xa4, 0xec, 0x0a,
+ 0x62, 0x04, 0x00, 0xeb, 0x11, 0x63, 0x03, 0x00, 0x0e, 0x81, 0xec, 0xda, 0x0e, 0x0e, 0xd3, 0x41,
+ 0x0a, 0x01, 0x00, 0x00, 0x11, 0xed, 0x03, 0x0e, 0x0b, 0xc5, 0x05, 0x62, 0x02, 0x00, 0xeb, 0xec,
+ 0x49, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x42, 0x6f,
+ 0x01, 0x00, 0x00, 0x04, 0x74, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x04, 0x20, 0x01, 0x00, 0x00,
+ 0x24, 0x02, 0x00, 0x0e, 0x62, 0x02, 0x00, 0x42, 0x75, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x42,
+ 0x76, 0x01, 0x00, 0x00, 0xc2, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42,
+ 0x0e, 0x01, 0x00, 0x00, 0xc3, 0x24, 0x01, 0x00, 0x0e, 0x09, 0x28, 0xc6, 0x03, 0x9f, 0x03, 0x20,
+ 0x62, 0x35, 0x1c, 0x62, 0x0a, 0x2b, 0x00, 0x19, 0x08, 0x53, 0x12, 0x00, 0x35, 0x04, 0x0d, 0xb2,
+ 0x00, 0x2e, 0x08, 0x17, 0x0d, 0x49, 0x4f, 0x35, 0x31, 0x1e, 0x44, 0x21, 0xb2, 0x54, 0x22, 0x50,
+ 0x0e, 0x42, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01, 0x09, 0x03, 0x00, 0x3a, 0x01, 0x6e, 0x00, 0x01,
+ 0x00, 0xac, 0x04, 0x01, 0x0d, 0xd0, 0x05, 0x03, 0x09, 0xd4, 0x05, 0x05, 0x0d, 0x38, 0x0d, 0x01,
+ 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x6c, 0x01, 0x00, 0x00, 0x66, 0x00, 0x00, 0x42,
+ 0x1d, 0x01, 0x00, 0x00, 0xd3, 0x42, 0x77, 0x01, 0x00, 0x00, 0x66, 0x01, 0x00, 0x04, 0x6c, 0x01,
+ 0x00, 0x00, 0x24, 0x02, 0x00, 0x24, 0x01, 0x00, 0xc3, 0x66, 0x02, 0x00, 0xd3, 0x47, 0x11, 0xed,
+ 0x03, 0x0e, 0xc3, 0x24, 0x04, 0x00, 0x29, 0xc6, 0x03, 0xc3, 0x03, 0x04, 0x03, 0x00, 0x39, 0x02,
+ 0x0e, 0x43, 0x06, 0x01, 0xd4, 0x03, 0x02, 0x02, 0x02, 0x04, 0x00, 0x00, 0x58, 0x04, 0xc2, 0x05,
+ 0x00, 0x01, 0x00, 0x6e, 0x00, 0x01, 0x00, 0x82, 0x01, 0x01, 0x00, 0x30, 0xd2, 0x05, 0x06, 0x01,
+ 0x30, 0x61, 0x00, 0x00, 0xd3, 0x97, 0x11, 0xed, 0x04, 0x0e, 0xd4, 0x97, 0xec, 0x02, 0x29, 0xd3,
+ 0xd4, 0x47, 0xcb, 0x62, 0x00, 0x00, 0x07, 0xab, 0xec, 0x11, 0x0b, 0xd4, 0x4c, 0x37, 0x00, 0x00,
+ 0x00, 0x62, 0x00, 0x00, 0x4c, 0x41, 0x00, 0x00, 0x00, 0x28, 0x61, 0x01, 0x00, 0xd3, 0x7e, 0xee,
+ 0x24, 0xcc, 0x62, 0x01, 0x00, 0x42, 0x78, 0x01, 0x00, 0x00, 0xd4, 0x24, 0x01, 0x00, 0xec, 0x15,
+ 0x0b, 0x62, 0x01, 0x00, 0x4c, 0x37, 0x00, 0x00, 0x00, 0xd3, 0x62, 0x01, 0x00, 0x47, 0x4c, 0x41,
+ 0x00, 0x00, 0x00, 0x28, 0x81, 0xec, 0xdb, 0x0e, 0x29, 0xc6, 0x03, 0xd4, 0x03, 0x0c, 0x12, 0x36,
+ 0x09, 0x17, 0x26, 0x4e, 0x09, 0x2b, 0x49, 0x62, 0x08, 0x17, 0x0e, 0x43, 0x06, 0x01, 0xd6, 0x03,
+ 0x02, 0x06, 0x02, 0x08, 0x01, 0x01, 0xf1, 0x03, 0x08, 0xf2, 0x05, 0x00, 0x01, 0x40, 0xf4, 0x05,
+ 0x00, 0x01, 0x00, 0xac, 0x04, 0x01, 0x00, 0x70, 0xf6, 0x05, 0x01, 0x01, 0x20, 0xca, 0x05, 0x05,
+ 0x02, 0x30, 0xca, 0x05, 0x09, 0x02, 0x30, 0xd0, 0x05, 0x09, 0x04, 0x60, 0xd2, 0x05, 0x0e, 0x05,
+ 0x30, 0xec, 0x03, 0x05, 0x0c, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0x38, 0x0d, 0x01, 0x00, 0x00,
+ 0x41, 0x16, 0x01, 0x00, 0x00, 0x41, 0x6b, 0x01, 0x00, 0x00, 0xcb, 0x38, 0x0d, 0x01, 0x00, 0x00,
+ 0x42, 0x0e, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x42, 0x6f, 0x01, 0x00, 0x00, 0x04, 0x70, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e, 0xc3, 0xcc,
+ 0x66, 0x00, 0x00, 0x41, 0x37, 0x00, 0x00, 0x00, 0x04, 0xf7, 0x00, 0x00, 0x00, 0xab, 0xec, 0x14,
+ 0x66, 0x00, 0x00, 0x41, 0x37, 0x00, 0x00, 0x00, 0x04, 0x6c, 0x01, 0x00, 0x00, 0x9e, 0x11, 0x63,
+ 0x01, 0x00, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x7c, 0x01,
+ 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x01, 0x00, 0x04, 0x7d, 0x01, 0x00, 0x00, 0x24,
+ 0x02, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00,
+ 0x04, 0x7c, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x01, 0x00, 0x04, 0x7e, 0x01,
+ 0x00, 0x00, 0x24, 0x02, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e,
+ 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x42, 0x6f, 0x01, 0x00, 0x00, 0x04, 0x74, 0x01, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e, 0xd3, 0x41, 0x65, 0x01,
+ 0x00, 0x00, 0xec, 0x49, 0x61, 0x02, 0x00, 0x38, 0x97, 0x00, 0x00, 0x00, 0x42, 0x7f, 0x01, 0x00,
+ 0x00, 0xd3, 0x41, 0x65, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xcd, 0x62, 0x02, 0x00, 0xeb, 0xec,
+ 0x2c, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x6c, 0x01, 0x00, 0x00,
+ 0x62, 0x02, 0x00, 0x42, 0x75, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x42, 0x5c, 0x00, 0x00, 0x00,
+ 0x04, 0x80, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x24, 0x02, 0x00, 0x0e, 0xd3, 0x41, 0x81, 0x01,
+ 0x00, 0x00, 0x6a, 0xc4, 0x00, 0x00, 0x00, 0x61, 0x04, 0x00, 0x61, 0x03, 0x00, 0x38, 0x97, 0x00,
+ 0x00, 0x00, 0x42, 0x7f, 0x01, 0x00, 0x00, 0xd3, 0x41, 0x81, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x42, 0x75, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xce, 0x62, 0x03, 0x00, 0xeb, 0x97, 0xec, 0x10,
+ 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0xc3, 0x24, 0x01, 0x00, 0x29, 0xd4,
+ 0x97, 0xec, 0x3e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x6c, 0x01,
+ 0x00, 0x00, 0x62, 0x00, 0x00, 0x42, 0x82, 0x01, 0x00, 0x00, 0x62, 0x03, 0x00, 0x42, 0x5c, 0x00,
+ 0x00, 0x00, 0x04, 0x80, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x24, 0x01, 0x00, 0x24, 0x02, 0x00,
+ 0x0e, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0xc3, 0x24, 0x01, 0x00, 0x29,
+ 0xb8, 0xc5, 0x04, 0x61, 0x05, 0x00, 0x62, 0x03, 0x00, 0x7f, 0xee, 0x16, 0xc5, 0x05, 0x62, 0x04,
+ 0x00, 0x62, 0x05, 0x00, 0xeb, 0xa4, 0xec, 0x0a, 0x62, 0x05, 0x00, 0xeb, 0x11, 0x63, 0x04, 0x00,
+ 0x0e, 0x82, 0x00, 0xec, 0xe8, 0x0e, 0x85, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00,
+ 0x00, 0xc3, 0x24, 0x01, 0x00, 0x0e, 0x62, 0x03, 0x00, 0x42, 0x76, 0x01, 0x00, 0x00, 0xc2, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0x69, 0x04, 0x00, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00,
+ 0x00, 0xc3, 0x24, 0x01, 0x00, 0x29, 0xc6, 0x03, 0xea, 0x03, 0x23, 0x21, 0x55, 0xb3, 0x0d, 0x53,
+ 0x64, 0xb2, 0xb4, 0xb3, 0x3a, 0x67, 0x21, 0x00, 0x2b, 0x0a, 0x58, 0x8f, 0x26, 0x4a, 0x09, 0x17,
+ 0xe9, 0x4a, 0x0a, 0x12, 0x3a, 0x35, 0x31, 0x23, 0x4e, 0x00, 0x08, 0x08, 0x32, 0x49, 0x0e, 0x42,
+ 0x06, 0x01, 0x00, 0x01, 0x02, 0x01, 0x09, 0x03, 0x00, 0x58, 0x03, 0x6e, 0x00, 0x01, 0x00, 0xd0,
+ 0x03, 0x01, 0x00, 0x30, 0x66, 0x01, 0x01, 0x30, 0xf2, 0x05, 0x00, 0x03, 0xac, 0x04, 0x00, 0x0d,
+ 0xd0, 0x05, 0x04, 0x09, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0xdf, 0x41, 0x81, 0x01, 0x00, 0x00,
+ 0xd3, 0x47, 0xcb, 0x62, 0x00, 0x00, 0x11, 0xb1, 0xec, 0x05, 0x0e, 0x06, 0xee, 0x06, 0x41, 0x00,
+ 0x01, 0x00, 0x00, 0xcc, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x6c,
+ 0x01, 0x00, 0x00, 0x66, 0x01, 0x00, 0x42, 0x1d, 0x01, 0x00, 0x00, 0xd3, 0x42, 0x77, 0x01, 0x00,
+ 0x00, 0x66, 0x02, 0x00, 0x04, 0x6c, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x24, 0x01, 0x00, 0xc3,
+ 0x62, 0x01, 0x00, 0x11, 0xed, 0x03, 0x0e, 0xc3, 0x24, 0x04, 0x00, 0x29, 0xc6, 0x03, 0x9a, 0x04,
+ 0x06, 0x21, 0x30, 0x58, 0x00, 0x37, 0x02, 0x0e, 0x62, 0x06, 0x01, 0xd8, 0x03, 0x02, 0x02, 0x02,
+ 0x06, 0x01, 0x00, 0x6b, 0x04, 0xfc, 0x03, 0x00, 0x01, 0x00, 0xdc, 0x01, 0x00, 0x01, 0x00, 0xca,
+ 0x05, 0x03, 0x00, 0x30, 0xca, 0x05, 0x05, 0x00, 0x30, 0xe0, 0x03, 0x06, 0x08, 0xd3, 0x04, 0x2e,
+ 0x01, 0x00, 0x00, 0xaa, 0xec, 0x1c, 0x61, 0x00, 0x00, 0x66, 0x00, 0x00, 0x11, 0xd3, 0x21, 0x01,
+ 0x00, 0xcb, 0x62, 0x00, 0x00, 0x42, 0xfa, 0x00, 0x00, 0x00, 0xd4, 0x24, 0x01, 0x00, 0x0e, 0xee,
+ 0x46, 0xd3, 0x04, 0x2f, 0x01, 0x00, 0x00, 0xaa, 0xec, 0x1c, 0x61, 0x01, 0x00, 0x66, 0x00, 0x00,
+ 0x11, 0xd3, 0x21, 0x01, 0x00, 0xcc, 0x62, 0x01, 0x00, 0x42, 0xf9, 0x00, 0x00, 0x00, 0xd4, 0x24,
+ 0x01, 0x00, 0x0e, 0xee, 0x22, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x04,
+ 0x30, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0xd3, 0x04, 0x31, 0x01, 0x00, 0x00, 0x24,
+ 0x02, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0xa9, 0x04, 0x09, 0x03, 0x3f, 0x30,
+ 0x45, 0x49, 0x30, 0x45, 0x0d, 0xa9, 0x0e, 0x43, 0x06, 0x01, 0xda, 0x03, 0x01, 0x01, 0x01, 0x04,
+ 0x01, 0x00, 0x45, 0x02, 0x86, 0x06, 0x00, 0x01, 0x00, 0x88, 0x06, 0x05, 0x00, 0x30, 0xe4, 0x03,
+ 0x01, 0x0c, 0xd3, 0x97, 0xec, 0x03, 0xc3, 0x28, 0xd3, 0x42, 0x85, 0x01, 0x00, 0x00, 0x04, 0x86,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xec, 0x1f, 0x61, 0x00, 0x00, 0x66, 0x00, 0x00, 0x42, 0x84,
+ 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0xcb, 0x66, 0x00, 0x00, 0x42, 0x87, 0x01, 0x00, 0x00,
+ 0x62, 0x00, 0x00, 0x25, 0x01, 0x00, 0x66, 0x00, 0x00, 0x42, 0x87, 0x01, 0x00, 0x00, 0xd3, 0x04,
+ 0x88, 0x01, 0x00, 0x00, 0x25, 0x02, 0x00, 0xc6, 0x03, 0xc1, 0x04, 0x06, 0x03, 0x17, 0x09, 0x67,
+ 0x44, 0x4b, 0x0e, 0x41, 0x06, 0x01, 0xdc, 0x03, 0x05, 0x02, 0x04, 0x08, 0x05, 0x00, 0xcd, 0x01,
+ 0x07, 0xca, 0x05, 0x00, 0x01, 0x00, 0x92, 0x06, 0x00, 0x01, 0x00, 0x86, 0x06, 0x00, 0x01, 0x00,
+ 0x6e, 0x00, 0x01, 0x00, 0xcc, 0x05, 0x00, 0x01, 0x00, 0x94, 0x06, 0x09, 0x02, 0x30, 0x94, 0x06,
+ 0x01, 0x00, 0x30, 0xec, 0x03, 0x05, 0x0c, 0xda, 0x03, 0x0c, 0x00, 0xd6, 0x03, 0x0a, 0x00, 0xd4,
+ 0x03, 0x09, 0x00, 0xd2, 0x03, 0x08, 0x00, 0x0d, 0x04, 0x00, 0x5c, 0x04, 0x00, 0x61, 0x01, 0x00,
+ 0xd5, 0xec, 0x0c, 0x66, 0x00, 0x00, 0xe0, 0xd5, 0xf1, 0x43, 0x37, 0x00, 0x00, 0x00, 0xd6, 0x97,
+ 0xec, 0x26, 0xd3, 0x41, 0x00, 0x01, 0x00, 0x00, 0xec, 0x1a, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42,
+ 0x0e, 0x01, 0x00, 0x00, 0xd3, 0x41, 0x00, 0x01, 0x00, 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0x24,
+ 0x02, 0x00, 0x0e, 0xe1, 0xd3, 0xf1, 0x29, 0xd3, 0x41, 0x81, 0x01, 0x00, 0x00, 0xec, 0x35, 0x61,
+ 0x00, 0x00, 0xe2, 0xd3, 0x41, 0x81, 0x01, 0x00, 0x00, 0xd6, 0xf2, 0xcb, 0x62, 0x00, 0x00, 0xec,
+ 0x23, 0x5e, 0x04, 0x00, 0x62, 0x00, 0x00, 0x41, 0x41, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x41,
+ 0x37, 0x00, 0x00, 0x00, 0x26, 0x02, 0x00, 0xb9, 0x5b, 0x04, 0x00, 0x52, 0x0e, 0x06, 0x1b, 0x27,
+ 0x00, 0x00, 0x28, 0xe2, 0xd3, 0x41, 0x65, 0x01, 0x00, 0x00, 0xd6, 0xf2, 0xcc, 0x62, 0x01, 0x00,
+ 0xec, 0x17, 0x62, 0x01, 0x00, 0x42, 0x41, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0xb7, 0x5b, 0x04,
+ 0x00, 0x52, 0x0e, 0x18, 0x27, 0x00, 0x00, 0x28, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01,
+ 0x00, 0x00, 0xc3, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x41, 0x37, 0x00, 0x00, 0x00,
+ 0x04, 0x6d, 0x01, 0x00, 0x00, 0xd6, 0x04, 0x6e, 0x01, 0x00, 0x00, 0x24, 0x04, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0x09, 0x28, 0xc6, 0x03, 0xd6, 0x04, 0x14, 0x30, 0x12, 0x3c, 0x17, 0x2b, 0x82, 0x13,
+ 0x0a, 0x3a, 0x35, 0x1c, 0xa8, 0x00, 0x01, 0x08, 0x35, 0x1c, 0x6e, 0x08, 0xd5, 0x0e, 0x62, 0x06,
+ 0x01, 0xde, 0x03, 0x01, 0x04, 0x01, 0x05, 0x02, 0x02, 0xd0, 0x01, 0x05, 0xd0, 0x03, 0x00, 0x01,
+ 0x00, 0x96, 0x06, 0x02, 0x00, 0x30, 0x98, 0x06, 0x02, 0x01, 0x30, 0x94, 0x06, 0x02, 0x02, 0x30,
+ 0x9a, 0x06, 0x09, 0x00, 0x03, 0xea, 0x03, 0x04, 0x0c, 0xe6, 0x03, 0x02, 0x0c, 0x6d, 0xb4, 0x00,
+ 0x00, 0x00, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0xd3, 0x98, 0x04, 0x49, 0x00,
+ 0x00, 0x00, 0xaa, 0xec, 0x10, 0xd3, 0x42, 0x5e, 0x00, 0x00, 0x00, 0x04, 0x6c, 0x01, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0xd7, 0x0b, 0x04, 0x8e, 0x01, 0x00, 0x00, 0x4c, 0x8f, 0x01, 0x00, 0x00, 0x04,
+ 0x8e, 0x01, 0x00, 0x00, 0x4c, 0x90, 0x01, 0x00, 0x00, 0xcb, 0x66, 0x01, 0x00, 0x42, 0x91, 0x01,
+ 0x00, 0x00, 0xd3, 0x62, 0x00, 0x00, 0x24, 0x02, 0x00, 0xcc, 0x62, 0x01, 0x00, 0x41, 0x8f, 0x01,
+ 0x00, 0x00, 0xc2, 0x00, 0x43, 0x92, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x41, 0x90, 0x01, 0x00,
+ 0x00, 0xc2, 0x01, 0x43, 0x92, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x42, 0x93, 0x01, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0x8c, 0xcd, 0x62, 0x01, 0x00, 0x41, 0x8f, 0x01, 0x00, 0x00, 0xec, 0x13, 0x62,
+ 0x01, 0x00, 0x41, 0x8f, 0x01, 0x00, 0x00, 0x38, 0x46, 0x00, 0x00, 0x00, 0x43, 0x92, 0x01, 0x00,
+ 0x00, 0x62, 0x01, 0x00, 0x41, 0x90, 0x01, 0x00, 0x00, 0xec, 0x13, 0x62, 0x01, 0x00, 0x41, 0x90,
+ 0x01, 0x00, 0x00, 0x38, 0x46, 0x00, 0x00, 0x00, 0x43, 0x92, 0x01, 0x00, 0x00, 0x62, 0x02, 0x00,
+ 0x70, 0x2e, 0xce, 0x6d, 0x18, 0x00, 0x00, 0x00, 0x0b, 0xb6, 0x4c, 0x94, 0x01, 0x00, 0x00, 0xca,
+ 0x41, 0x33, 0x00, 0x00, 0x00, 0x4c, 0x90, 0x01, 0x00, 0x00, 0x70, 0x2e, 0x2f, 0xc6, 0x03, 0xfc,
+ 0x04, 0x17, 0x03, 0x49, 0x35, 0x50, 0x73, 0x54, 0x00, 0x08, 0x08, 0x27, 0x00, 0x08, 0x08, 0x27,
+ 0x45, 0x35, 0x5f, 0x35, 0x5f, 0x18, 0x26, 0x62, 0x08, 0x0e, 0x42, 0x06, 0x01, 0x00, 0x01, 0x00,
+ 0x01, 0x05, 0x01, 0x00, 0x20, 0x01, 0xc2, 0x04, 0x00, 0x01, 0x00, 0xea, 0x03, 0x00, 0x0c, 0xd3,
+ 0x07, 0xab, 0xec, 0x1b, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x66, 0x00,
+ 0x00, 0x42, 0x95, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x29, 0xc6,
+ 0x03, 0x87, 0x05, 0x03, 0x03, 0x1c, 0x86, 0x0e, 0x42, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01, 0x05,
+ 0x01, 0x00, 0x20, 0x01, 0xc2, 0x04, 0x00, 0x01, 0x00, 0xea, 0x03, 0x00, 0x0c, 0xd3, 0x07, 0xab,
+ 0xec, 0x1b, 0x38, 0x0d, 0x01, 0x00, 0x00, 0x42, 0x0e, 0x01, 0x00, 0x00, 0x66, 0x00, 0x00, 0x42,
+ 0x95, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x29, 0xc6, 0x03, 0x8d,
+ 0x05, 0x03, 0x03, 0x1c, 0x86,
+};
+
+static const uint8_t tjs_m_modules_utils_getopts[3637] = {
+ 0x02, 0x2f, 0x3a, 0x40, 0x61, 0x70, 0x70, 0x2f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x2f,
+ 0x75, 0x74, 0x69, 0x6c, 0x73, 0x2f, 0x67, 0x65, 0x74, 0x6f, 0x70, 0x74, 0x73, 0x2e, 0x6a, 0x73,
+ 0x0a, 0x70, 0x61, 0x72, 0x73, 0x65, 0x18, 0x70, 0x61, 0x72, 0x73, 0x65, 0x42, 0x6f, 0x6f, 0x6c,
+ 0x65, 0x61, 0x6e, 0x14, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x18, 0x70,
+ 0x61, 0x72, 0x73, 0x65, 0x49, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x16, 0x70, 0x61, 0x72, 0x73,
+ 0x65, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x10, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x41, 0x52, 0x52,
+ 0x14, 0x53, 0x48, 0x4f, 0x52, 0x54, 0x53, 0x50, 0x4c, 0x49, 0x54, 0x0e, 0x69, 0x73, 0x41, 0x72,
+ 0x72, 0x61, 0x79, 0x14, 0x70, 0x61, 0x72, 0x73, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x14, 0x70,
+ 0x61, 0x72, 0x73, 0x65, 0x41, 0x6c, 0x69, 0x61, 0x73, 0x18, 0x70, 0x61, 0x72, 0x73, 0x65, 0x44,
+ 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x18, 0x70, 0x61, 0x72, 0x73, 0x65, 0x4f, 0x70, 0x74, 0x69,
+ 0x6f, 0x6e, 0x73, 0x0a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x06, 0x61, 0x6e, 0x79, 0x0a, 0x6d, 0x61,
+ 0x79, 0x62, 0x65, 0x0a, 0x69, 0x73, 0x4e, 0x61, 0x4e, 0x0e, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x65,
+ 0x73, 0x06, 0x6f, 0x75, 0x74, 0x06, 0x6b, 0x65, 0x79, 0x0a, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x08,
+ 0x70, 0x72, 0x65, 0x76, 0x06, 0x6c, 0x65, 0x6e, 0x02, 0x69, 0x02, 0x6b, 0x08, 0x70, 0x75, 0x73,
+ 0x68, 0x10, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73, 0x0e, 0x6f, 0x70, 0x74, 0x69, 0x6f,
+ 0x6e, 0x73, 0x06, 0x65, 0x6e, 0x64, 0x08, 0x61, 0x72, 0x67, 0x76, 0x0e, 0x73, 0x74, 0x72, 0x69,
+ 0x6e, 0x67, 0x73, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x73, 0x12, 0x73, 0x74, 0x6f, 0x70, 0x45, 0x61,
+ 0x72, 0x6c, 0x79, 0x02, 0x5f, 0x10, 0x67, 0x65, 0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x06, 0x61,
+ 0x72, 0x67, 0x08, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x02, 0x2d, 0x04,
+ 0x2d, 0x2d, 0x0e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x4f, 0x66, 0x02, 0x3d, 0x02, 0x6e, 0x02, 0x6f,
+ 0x0a, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x12, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+ 0x10, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6e, 0x74, 0x0f, 0xc6, 0x03, 0x00, 0x05, 0x00, 0x08,
+ 0xc8, 0x03, 0x00, 0x09, 0xca, 0x03, 0x00, 0x0a, 0xcc, 0x03, 0x00, 0x0b, 0xce, 0x03, 0x00, 0x0c,
+ 0xd0, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x20, 0x06, 0x01, 0xa2, 0x01, 0x00, 0x00, 0x00, 0x02, 0x0d,
+ 0x0c, 0x64, 0x00, 0xd2, 0x03, 0x00, 0x0d, 0xd4, 0x03, 0x01, 0x0d, 0xd6, 0x03, 0x02, 0x0d, 0xd8,
+ 0x03, 0x03, 0x0d, 0xda, 0x03, 0x04, 0x0d, 0xdc, 0x03, 0x05, 0x0d, 0xde, 0x03, 0x06, 0x0d, 0xe0,
+ 0x03, 0x07, 0x0d, 0xc8, 0x03, 0x08, 0x01, 0xca, 0x03, 0x09, 0x01, 0xcc, 0x03, 0x0a, 0x01, 0xce,
+ 0x03, 0x0b, 0x01, 0xd0, 0x03, 0x0c, 0x01, 0x08, 0xec, 0x1b, 0xc2, 0x07, 0x5f, 0x08, 0x00, 0xc2,
+ 0x08, 0x5f, 0x09, 0x00, 0xc2, 0x09, 0x5f, 0x0a, 0x00, 0xc2, 0x0a, 0x5f, 0x0b, 0x00, 0xc2, 0x0b,
+ 0x5f, 0x0c, 0x00, 0x29, 0x26, 0x00, 0x00, 0xe3, 0xc1, 0x00, 0xc1, 0x01, 0x33, 0xe4, 0x38, 0x98,
+ 0x00, 0x00, 0x00, 0x41, 0xeb, 0x00, 0x00, 0x00, 0xe5, 0xc2, 0x02, 0x4d, 0xec, 0x00, 0x00, 0x00,
+ 0xe6, 0xc2, 0x03, 0x4d, 0xed, 0x00, 0x00, 0x00, 0x5f, 0x04, 0x00, 0xc2, 0x04, 0x4d, 0xee, 0x00,
+ 0x00, 0x00, 0x5f, 0x05, 0x00, 0xc2, 0x05, 0x4d, 0xef, 0x00, 0x00, 0x00, 0x5f, 0x06, 0x00, 0xc2,
+ 0x06, 0x4d, 0xf0, 0x00, 0x00, 0x00, 0x5f, 0x07, 0x00, 0x06, 0x2e, 0xc6, 0x03, 0x01, 0x19, 0x01,
+ 0x00, 0x1d, 0x0c, 0x17, 0x21, 0x00, 0x0b, 0x2e, 0x00, 0x08, 0x4a, 0x00, 0x0a, 0x4a, 0x00, 0x0a,
+ 0x4e, 0x00, 0x0a, 0x42, 0x00, 0x0a, 0xd4, 0x03, 0x07, 0x28, 0x24, 0x7c, 0x5b, 0x21, 0x2d, 0x40,
+ 0x5b, 0x2d, 0x60, 0x7b, 0x2d, 0x7e, 0x5d, 0x5b, 0x5c, 0x73, 0x5c, 0x53, 0x5d, 0x2a, 0x07, 0x94,
+ 0x01, 0x01, 0x01, 0x00, 0x43, 0x00, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x04, 0x07, 0xf5,
+ 0xff, 0xff, 0xff, 0x0b, 0x00, 0x09, 0x06, 0x00, 0x00, 0x00, 0x06, 0x07, 0x28, 0x00, 0x00, 0x00,
+ 0x15, 0x03, 0x00, 0x21, 0x00, 0x40, 0x00, 0x5b, 0x00, 0x60, 0x00, 0x7b, 0x00, 0x7e, 0x00, 0x1c,
+ 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f, 0x01, 0x00, 0x00, 0x00,
+ 0x15, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0a, 0x0c, 0x00, 0x0a, 0x0e, 0x43, 0x06, 0x01, 0x00,
+ 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x2e, 0x02, 0xe2, 0x03, 0x00, 0x01, 0x00, 0xe4, 0x03, 0x01,
+ 0x00, 0x30, 0x61, 0x00, 0x00, 0xd3, 0xc3, 0xac, 0xec, 0x03, 0xc3, 0x28, 0xd3, 0x04, 0x02, 0x00,
+ 0x00, 0x00, 0xac, 0xec, 0x03, 0x09, 0x28, 0x38, 0x9a, 0x00, 0x00, 0x00, 0xd3, 0xf1, 0xcb, 0x38,
+ 0xf3, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0xf1, 0xec, 0x03, 0xd3, 0x28, 0x62, 0x00, 0x00, 0x28,
+ 0xc6, 0x03, 0x0f, 0x0c, 0x12, 0x1c, 0x09, 0x35, 0x08, 0x09, 0x2b, 0x3a, 0x08, 0x00, 0x01, 0x08,
+ 0x0e, 0x43, 0x06, 0x01, 0x00, 0x01, 0x08, 0x01, 0x05, 0x01, 0x00, 0xe4, 0x01, 0x09, 0xe8, 0x03,
+ 0x00, 0x01, 0x00, 0xea, 0x03, 0x01, 0x00, 0x30, 0xec, 0x03, 0x01, 0x01, 0x20, 0xee, 0x03, 0x01,
+ 0x02, 0x20, 0xf0, 0x03, 0x01, 0x03, 0x20, 0xf2, 0x03, 0x01, 0x04, 0x20, 0xe2, 0x03, 0x01, 0x05,
+ 0x20, 0xf4, 0x03, 0x01, 0x06, 0x20, 0xf6, 0x03, 0x01, 0x07, 0x20, 0xd6, 0x03, 0x02, 0x0c, 0x61,
+ 0x07, 0x00, 0x61, 0x06, 0x00, 0x61, 0x05, 0x00, 0x61, 0x04, 0x00, 0x61, 0x03, 0x00, 0x61, 0x02,
+ 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0x0b, 0xcb, 0xd3, 0x07, 0xaa, 0xec, 0x05, 0x62, 0x00,
+ 0x00, 0x28, 0x06, 0xcc, 0x06, 0xcd, 0x06, 0xce, 0x06, 0xc5, 0x04, 0x06, 0xc5, 0x05, 0x06, 0xc5,
+ 0x06, 0x06, 0xc5, 0x07, 0xd3, 0x7e, 0xef, 0xa0, 0x00, 0x63, 0x01, 0x00, 0xd3, 0x62, 0x01, 0x00,
+ 0x47, 0x11, 0x63, 0x05, 0x00, 0x0e, 0x62, 0x00, 0x00, 0x62, 0x01, 0x00, 0x73, 0x66, 0x00, 0x00,
+ 0x62, 0x05, 0x00, 0xf1, 0xec, 0x06, 0x62, 0x05, 0x00, 0xee, 0x07, 0x62, 0x05, 0x00, 0x26, 0x01,
+ 0x00, 0x16, 0x49, 0x11, 0x63, 0x02, 0x00, 0x0e, 0xb7, 0x11, 0x63, 0x06, 0x00, 0x0e, 0x62, 0x02,
+ 0x00, 0xeb, 0x11, 0x63, 0x04, 0x00, 0x0e, 0x62, 0x06, 0x00, 0x62, 0x04, 0x00, 0xa4, 0xec, 0x58,
+ 0x62, 0x00, 0x00, 0x62, 0x02, 0x00, 0x62, 0x06, 0x00, 0x47, 0x73, 0x62, 0x01, 0x00, 0x26, 0x01,
+ 0x00, 0x16, 0x49, 0x11, 0x63, 0x03, 0x00, 0x0e, 0xb7, 0x11, 0x63, 0x07, 0x00, 0x0e, 0x62, 0x07,
+ 0x00, 0x62, 0x04, 0x00, 0xa4, 0xec, 0x27, 0x62, 0x06, 0x00, 0x62, 0x07, 0x00, 0xad, 0xec, 0x14,
+ 0x62, 0x03, 0x00, 0x42, 0xfc, 0x00, 0x00, 0x00, 0x62, 0x02, 0x00, 0x62, 0x07, 0x00, 0x47, 0x24,
+ 0x01, 0x00, 0x0e, 0x62, 0x07, 0x00, 0x92, 0x63, 0x07, 0x00, 0x0e, 0xee, 0xd2, 0x62, 0x06, 0x00,
+ 0x92, 0x63, 0x06, 0x00, 0x0e, 0xee, 0xa1, 0x81, 0x6a, 0x60, 0xff, 0xff, 0xff, 0x0e, 0x0e, 0x62,
+ 0x00, 0x00, 0x28, 0xc6, 0x03, 0x26, 0x17, 0x7b, 0x0d, 0x1c, 0x12, 0x09, 0x0d, 0x0d, 0x0d, 0x12,
+ 0x12, 0x12, 0x13, 0x2b, 0x35, 0xae, 0x7b, 0x7c, 0x4e, 0x30, 0x63, 0x35, 0x35, 0x2c, 0x0e, 0x43,
+ 0x06, 0x01, 0x00, 0x02, 0x06, 0x02, 0x04, 0x01, 0x00, 0xa6, 0x01, 0x08, 0xe8, 0x03, 0x00, 0x01,
+ 0x00, 0xfa, 0x03, 0x00, 0x01, 0x00, 0xea, 0x03, 0x01, 0x00, 0x30, 0xec, 0x03, 0x01, 0x01, 0x20,
+ 0xee, 0x03, 0x01, 0x02, 0x20, 0x82, 0x01, 0x01, 0x03, 0x20, 0xf2, 0x03, 0x01, 0x04, 0x20, 0xf4,
+ 0x03, 0x01, 0x05, 0x20, 0xd2, 0x03, 0x00, 0x0c, 0x61, 0x05, 0x00, 0x61, 0x04, 0x00, 0x61, 0x03,
+ 0x00, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0x0b, 0xcb, 0xd3, 0x07, 0xaa, 0x11,
+ 0xed, 0x05, 0x0e, 0xd4, 0x07, 0xaa, 0xec, 0x05, 0x62, 0x00, 0x00, 0x28, 0x06, 0xcc, 0x06, 0xcd,
+ 0x06, 0xce, 0x06, 0xc5, 0x04, 0x06, 0xc5, 0x05, 0xd4, 0x7e, 0xee, 0x6a, 0x63, 0x01, 0x00, 0xd4,
+ 0x62, 0x01, 0x00, 0x47, 0x11, 0x63, 0x03, 0x00, 0x0e, 0xd3, 0x62, 0x01, 0x00, 0x47, 0x11, 0x63,
+ 0x02, 0x00, 0x0e, 0x62, 0x00, 0x00, 0x62, 0x01, 0x00, 0x73, 0x62, 0x03, 0x00, 0x49, 0x62, 0x02,
+ 0x00, 0x38, 0x46, 0x00, 0x00, 0x00, 0xac, 0xec, 0x0c, 0xd3, 0x62, 0x01, 0x00, 0x73, 0x66, 0x00,
+ 0x00, 0x49, 0xee, 0x32, 0xb7, 0x11, 0x63, 0x05, 0x00, 0x0e, 0x62, 0x02, 0x00, 0xeb, 0x11, 0x63,
+ 0x04, 0x00, 0x0e, 0x62, 0x05, 0x00, 0x62, 0x04, 0x00, 0xa4, 0xec, 0x1a, 0x62, 0x00, 0x00, 0x62,
+ 0x02, 0x00, 0x62, 0x05, 0x00, 0x47, 0x73, 0x62, 0x03, 0x00, 0x49, 0x62, 0x05, 0x00, 0x92, 0x63,
+ 0x05, 0x00, 0x0e, 0xee, 0xdf, 0x81, 0xec, 0x95, 0x0e, 0x0e, 0x62, 0x00, 0x00, 0x28, 0xc6, 0x03,
+ 0x4c, 0x15, 0x5d, 0x0d, 0x3f, 0x12, 0x09, 0x0d, 0x0d, 0x0d, 0x12, 0x13, 0x26, 0x35, 0x36, 0x3b,
+ 0x3a, 0x31, 0x0d, 0x7b, 0x4e, 0x36, 0x1d, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x03, 0x07, 0x03, 0x03,
+ 0x01, 0x00, 0xb3, 0x01, 0x0a, 0xe8, 0x03, 0x00, 0x01, 0x00, 0xfc, 0x03, 0x00, 0x01, 0x00, 0x82,
+ 0x01, 0x00, 0x01, 0x00, 0xea, 0x03, 0x01, 0x00, 0x30, 0xf2, 0x03, 0x01, 0x01, 0x20, 0xfe, 0x03,
+ 0x01, 0x02, 0x20, 0xf4, 0x03, 0x01, 0x03, 0x20, 0xf6, 0x03, 0x01, 0x04, 0x20, 0xec, 0x03, 0x07,
+ 0x05, 0x30, 0xee, 0x03, 0x07, 0x06, 0x30, 0xd2, 0x03, 0x00, 0x0c, 0x61, 0x04, 0x00, 0x61, 0x03,
+ 0x00, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0x0b, 0xcb, 0xd4, 0x07, 0xaa, 0xec,
+ 0x05, 0x62, 0x00, 0x00, 0x28, 0x06, 0xcc, 0x06, 0xcd, 0x06, 0xce, 0x06, 0xc5, 0x04, 0xd4, 0x38,
+ 0x46, 0x00, 0x00, 0x00, 0xad, 0x6a, 0x84, 0x00, 0x00, 0x00, 0xb7, 0x11, 0x63, 0x03, 0x00, 0x0e,
+ 0xd4, 0xeb, 0x11, 0x63, 0x01, 0x00, 0x0e, 0x62, 0x03, 0x00, 0x62, 0x01, 0x00, 0xa4, 0xec, 0x6b,
+ 0x61, 0x06, 0x00, 0x61, 0x05, 0x00, 0xd4, 0x62, 0x03, 0x00, 0x47, 0xc5, 0x05, 0xd3, 0x62, 0x05,
+ 0x00, 0x47, 0xc5, 0x06, 0x62, 0x00, 0x00, 0x62, 0x05, 0x00, 0xd5, 0x49, 0x62, 0x06, 0x00, 0x38,
+ 0x46, 0x00, 0x00, 0x00, 0xac, 0xec, 0x0c, 0xd3, 0x62, 0x05, 0x00, 0x73, 0x66, 0x00, 0x00, 0x49,
+ 0xee, 0x2f, 0xb7, 0x11, 0x63, 0x04, 0x00, 0x0e, 0x62, 0x06, 0x00, 0xeb, 0x11, 0x63, 0x02, 0x00,
+ 0x0e, 0x62, 0x04, 0x00, 0x62, 0x02, 0x00, 0xa4, 0xec, 0x17, 0x62, 0x00, 0x00, 0x62, 0x06, 0x00,
+ 0x62, 0x04, 0x00, 0x47, 0xd5, 0x49, 0x62, 0x04, 0x00, 0x92, 0x63, 0x04, 0x00, 0x0e, 0xee, 0xe2,
+ 0x62, 0x03, 0x00, 0x92, 0x63, 0x03, 0x00, 0x0e, 0xee, 0x8e, 0x62, 0x00, 0x00, 0x28, 0xc6, 0x03,
+ 0x72, 0x15, 0x4e, 0x0d, 0x1c, 0x12, 0x09, 0x0d, 0x0d, 0x0d, 0x13, 0x3f, 0x8f, 0x26, 0x27, 0x2c,
+ 0x3a, 0x31, 0x0d, 0x7b, 0x3f, 0x36, 0x37, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x05, 0x04, 0x05, 0x04,
+ 0x01, 0x00, 0xa7, 0x01, 0x09, 0xea, 0x03, 0x00, 0x01, 0x00, 0xec, 0x03, 0x00, 0x01, 0x00, 0x82,
+ 0x01, 0x00, 0x01, 0x00, 0xe8, 0x03, 0x00, 0x01, 0x00, 0x9a, 0x01, 0x00, 0x01, 0x00, 0xf4, 0x03,
+ 0x01, 0x00, 0x20, 0xf0, 0x03, 0x01, 0x01, 0x20, 0xee, 0x03, 0x01, 0x02, 0x30, 0xf2, 0x03, 0x01,
+ 0x03, 0x30, 0xd6, 0x03, 0x02, 0x0c, 0x61, 0x03, 0x00, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61,
+ 0x00, 0x00, 0x06, 0xcb, 0x06, 0xcc, 0xd6, 0xd4, 0x47, 0xcd, 0x62, 0x02, 0x00, 0x38, 0x46, 0x00,
+ 0x00, 0x00, 0xac, 0xec, 0x04, 0xb6, 0xee, 0x05, 0x62, 0x02, 0x00, 0xeb, 0xce, 0x62, 0x03, 0x00,
+ 0xb7, 0xa7, 0x11, 0xed, 0x14, 0x0e, 0x5b, 0x04, 0x00, 0x38, 0x46, 0x00, 0x00, 0x00, 0xac, 0x11,
+ 0xed, 0x07, 0x0e, 0x5b, 0x04, 0x00, 0xd4, 0xf1, 0xec, 0x63, 0xd3, 0xd4, 0x47, 0x11, 0x63, 0x01,
+ 0x00, 0x0e, 0x62, 0x01, 0x00, 0x38, 0x46, 0x00, 0x00, 0x00, 0xac, 0xec, 0x07, 0xd3, 0xd4, 0xd5,
+ 0x49, 0xee, 0x24, 0x66, 0x00, 0x00, 0x62, 0x01, 0x00, 0xf1, 0xec, 0x10, 0x62, 0x01, 0x00, 0x42,
+ 0xfc, 0x00, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0x0e, 0xee, 0x0c, 0xd3, 0xd4, 0x73, 0x62, 0x01,
+ 0x00, 0xd5, 0x26, 0x02, 0x00, 0x49, 0xb7, 0x11, 0x63, 0x00, 0x00, 0x0e, 0x62, 0x00, 0x00, 0x62,
+ 0x03, 0x00, 0xa4, 0xec, 0x18, 0xd3, 0x62, 0x02, 0x00, 0x62, 0x00, 0x00, 0x47, 0x73, 0xd3, 0xd4,
+ 0x47, 0x49, 0x62, 0x00, 0x00, 0x92, 0x63, 0x00, 0x00, 0x0e, 0xee, 0xe1, 0x29, 0xc6, 0x03, 0x9a,
+ 0x01, 0x13, 0x3f, 0x0d, 0x0d, 0x17, 0x63, 0x94, 0x2c, 0x3a, 0x17, 0x0d, 0x30, 0x44, 0x0d, 0x00,
+ 0x0b, 0x08, 0x4e, 0x44, 0x36, 0x0e, 0x43, 0x06, 0x01, 0xc8, 0x03, 0x02, 0x15, 0x02, 0x06, 0x06,
+ 0x01, 0xea, 0x08, 0x17, 0x80, 0x04, 0x00, 0x01, 0x00, 0xfc, 0x03, 0x00, 0x01, 0x00, 0x9a, 0x01,
+ 0x01, 0x00, 0x30, 0xe8, 0x03, 0x01, 0x01, 0x30, 0x82, 0x04, 0x01, 0x02, 0x70, 0x84, 0x04, 0x01,
+ 0x03, 0x30, 0xd8, 0x01, 0x01, 0x04, 0x30, 0x86, 0x04, 0x01, 0x05, 0x30, 0x88, 0x04, 0x01, 0x06,
+ 0x30, 0xea, 0x03, 0x01, 0x07, 0x30, 0xec, 0x03, 0x01, 0x08, 0x20, 0x82, 0x01, 0x01, 0x09, 0x20,
+ 0x8a, 0x04, 0x00, 0x00, 0x00, 0xf2, 0x03, 0x01, 0x0a, 0x30, 0xf4, 0x03, 0x02, 0x0c, 0x20, 0x8c,
+ 0x04, 0x03, 0x0d, 0x30, 0xfe, 0x03, 0x0e, 0x0e, 0x30, 0x8e, 0x04, 0x12, 0x0f, 0x30, 0x8e, 0x04,
+ 0x18, 0x0f, 0x30, 0x90, 0x04, 0x19, 0x0e, 0x30, 0xfe, 0x03, 0x19, 0x12, 0x30, 0xf6, 0x03, 0x1a,
+ 0x13, 0x20, 0x8e, 0x04, 0x24, 0x14, 0x30, 0xd8, 0x03, 0x03, 0x0c, 0xda, 0x03, 0x04, 0x0c, 0xde,
+ 0x03, 0x06, 0x0c, 0xdc, 0x03, 0x05, 0x0c, 0xe0, 0x03, 0x07, 0x0c, 0xd4, 0x03, 0x01, 0x0c, 0xc2,
+ 0x00, 0xc5, 0x0a, 0x61, 0x0b, 0x00, 0x61, 0x09, 0x00, 0x61, 0x08, 0x00, 0x61, 0x07, 0x00, 0x61,
+ 0x06, 0x00, 0x61, 0x05, 0x00, 0x61, 0x04, 0x00, 0x61, 0x03, 0x00, 0x61, 0x02, 0x00, 0x61, 0x01,
+ 0x00, 0x61, 0x00, 0x00, 0xd4, 0x11, 0xed, 0x03, 0x0e, 0x0b, 0xdc, 0x41, 0x4d, 0x00, 0x00, 0x00,
+ 0xcb, 0x66, 0x01, 0x00, 0xd4, 0x41, 0xf7, 0x00, 0x00, 0x00, 0xf1, 0xcc, 0x66, 0x02, 0x00, 0x62,
+ 0x01, 0x00, 0xd4, 0x41, 0x49, 0x00, 0x00, 0x00, 0xc3, 0xf3, 0xcd, 0x66, 0x02, 0x00, 0x62, 0x01,
+ 0x00, 0xd4, 0x41, 0x48, 0x00, 0x00, 0x00, 0x09, 0xf3, 0xce, 0x66, 0x03, 0x00, 0x62, 0x01, 0x00,
+ 0xd4, 0x41, 0x16, 0x00, 0x00, 0x00, 0xf2, 0xc5, 0x04, 0xd4, 0x41, 0x03, 0x01, 0x00, 0x00, 0xc5,
+ 0x05, 0x26, 0x00, 0x00, 0xc5, 0x06, 0x0b, 0x62, 0x06, 0x00, 0x4c, 0x04, 0x01, 0x00, 0x00, 0xc5,
+ 0x07, 0x06, 0xc5, 0x08, 0x06, 0xc5, 0x09, 0xd3, 0xeb, 0xc5, 0x0b, 0x61, 0x0c, 0x00, 0xb7, 0xc5,
+ 0x0c, 0x62, 0x0c, 0x00, 0x62, 0x0b, 0x00, 0xa4, 0x6a, 0x56, 0x03, 0x00, 0x00, 0x61, 0x0d, 0x00,
+ 0xd3, 0x62, 0x0c, 0x00, 0x47, 0xc5, 0x0d, 0x62, 0x0d, 0x00, 0xb7, 0x47, 0x04, 0x09, 0x01, 0x00,
+ 0x00, 0xad, 0x11, 0xed, 0x0b, 0x0e, 0x62, 0x0d, 0x00, 0x04, 0x09, 0x01, 0x00, 0x00, 0xac, 0xec,
+ 0x3b, 0x62, 0x05, 0x00, 0xec, 0x24, 0x62, 0x0c, 0x00, 0x62, 0x0b, 0x00, 0xa4, 0x6a, 0x16, 0x03,
+ 0x00, 0x00, 0x62, 0x06, 0x00, 0x42, 0xfc, 0x00, 0x00, 0x00, 0xd3, 0x62, 0x0c, 0x00, 0x92, 0x63,
+ 0x0c, 0x00, 0x47, 0x24, 0x01, 0x00, 0x0e, 0xee, 0xde, 0x62, 0x06, 0x00, 0x42, 0xfc, 0x00, 0x00,
+ 0x00, 0x62, 0x0d, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xef, 0xeb, 0x02, 0x62, 0x0d, 0x00, 0x04, 0x0a,
+ 0x01, 0x00, 0x00, 0xac, 0xec, 0x25, 0x62, 0x0c, 0x00, 0x90, 0x11, 0x63, 0x0c, 0x00, 0x62, 0x0b,
+ 0x00, 0xa4, 0x6a, 0xd1, 0x02, 0x00, 0x00, 0x62, 0x06, 0x00, 0x42, 0xfc, 0x00, 0x00, 0x00, 0xd3,
+ 0x62, 0x0c, 0x00, 0x47, 0x24, 0x01, 0x00, 0x0e, 0xee, 0xdd, 0x62, 0x0d, 0x00, 0xb8, 0x47, 0x04,
+ 0x09, 0x01, 0x00, 0x00, 0xac, 0x6a, 0x55, 0x01, 0x00, 0x00, 0x61, 0x0e, 0x00, 0x62, 0x0d, 0x00,
+ 0x42, 0x0b, 0x01, 0x00, 0x00, 0x04, 0x0c, 0x01, 0x00, 0x00, 0xb9, 0x24, 0x02, 0x00, 0xc5, 0x0e,
+ 0x62, 0x0d, 0x00, 0xb9, 0x47, 0x04, 0x0d, 0x01, 0x00, 0x00, 0xac, 0xec, 0x46, 0x62, 0x0d, 0x00,
+ 0xba, 0x47, 0x04, 0x0e, 0x01, 0x00, 0x00, 0xac, 0xec, 0x39, 0x62, 0x0d, 0x00, 0xbb, 0x47, 0x04,
+ 0x09, 0x01, 0x00, 0x00, 0xac, 0xec, 0x2c, 0x62, 0x0d, 0x00, 0x42, 0x0f, 0x01, 0x00, 0x00, 0xbc,
+ 0x62, 0x0e, 0x00, 0xb7, 0xa7, 0xec, 0x06, 0x62, 0x0e, 0x00, 0xee, 0x06, 0x38, 0x46, 0x00, 0x00,
+ 0x00, 0x24, 0x02, 0x00, 0x11, 0x63, 0x08, 0x00, 0x0e, 0x09, 0x11, 0x63, 0x09, 0x00, 0x0e, 0xef,
+ 0xd2, 0x00, 0x62, 0x0e, 0x00, 0xb7, 0xa7, 0xec, 0x4c, 0x61, 0x0f, 0x00, 0x62, 0x0d, 0x00, 0x42,
+ 0x0f, 0x01, 0x00, 0x00, 0xb9, 0x62, 0x0e, 0x00, 0x24, 0x02, 0x00, 0x11, 0x63, 0x08, 0x00, 0x0e,
+ 0x62, 0x0d, 0x00, 0x42, 0x0f, 0x01, 0x00, 0x00, 0x62, 0x0e, 0x00, 0xb8, 0x9e, 0x24, 0x01, 0x00,
+ 0xc5, 0x0f, 0x62, 0x03, 0x00, 0x62, 0x08, 0x00, 0x47, 0x38, 0x46, 0x00, 0x00, 0x00, 0xad, 0x11,
+ 0xed, 0x0b, 0x0e, 0xc4, 0x0a, 0x62, 0x08, 0x00, 0x62, 0x0f, 0x00, 0xf2, 0x11, 0x63, 0x09, 0x00,
+ 0x0e, 0xef, 0x80, 0x00, 0x62, 0x0d, 0x00, 0x42, 0x0f, 0x01, 0x00, 0x00, 0xb9, 0x24, 0x01, 0x00,
+ 0x11, 0x63, 0x08, 0x00, 0x0e, 0x62, 0x03, 0x00, 0x62, 0x08, 0x00, 0x47, 0x38, 0x46, 0x00, 0x00,
+ 0x00, 0xad, 0x11, 0x63, 0x09, 0x00, 0x0e, 0x62, 0x09, 0x00, 0x97, 0xec, 0x56, 0x62, 0x0b, 0x00,
+ 0x62, 0x0c, 0x00, 0xb8, 0x9e, 0xac, 0x11, 0xed, 0x11, 0x0e, 0xd3, 0x62, 0x0c, 0x00, 0xb8, 0x9e,
+ 0x47, 0xb7, 0x47, 0x04, 0x09, 0x01, 0x00, 0x00, 0xac, 0xec, 0x1b, 0x62, 0x02, 0x00, 0x62, 0x08,
+ 0x00, 0x47, 0x38, 0x46, 0x00, 0x00, 0x00, 0xac, 0xec, 0x04, 0x0a, 0xee, 0x02, 0xc3, 0x11, 0x63,
+ 0x09, 0x00, 0x0e, 0xee, 0x1e, 0x61, 0x10, 0x00, 0xd3, 0x62, 0x0c, 0x00, 0x90, 0x11, 0x63, 0x0c,
+ 0x00, 0x47, 0xc5, 0x10, 0xc4, 0x0a, 0x62, 0x08, 0x00, 0x62, 0x10, 0x00, 0xf2, 0x11, 0x63, 0x09,
+ 0x00, 0x0e, 0x66, 0x04, 0x00, 0x62, 0x07, 0x00, 0x62, 0x08, 0x00, 0x62, 0x09, 0x00, 0x62, 0x01,
+ 0x00, 0x62, 0x00, 0x00, 0x22, 0x05, 0x00, 0x0e, 0xef, 0x5b, 0x01, 0x61, 0x12, 0x00, 0x61, 0x11,
+ 0x00, 0x66, 0x05, 0x00, 0xb9, 0x43, 0x56, 0x00, 0x00, 0x00, 0x66, 0x05, 0x00, 0x42, 0x87, 0x00,
+ 0x00, 0x00, 0x62, 0x0d, 0x00, 0x24, 0x01, 0x00, 0xc5, 0x11, 0x62, 0x11, 0x00, 0x11, 0xb1, 0xec,
+ 0x05, 0x0e, 0x06, 0xee, 0x06, 0x41, 0x58, 0x00, 0x00, 0x00, 0x11, 0xed, 0x03, 0x0e, 0xb7, 0xc5,
+ 0x12, 0x62, 0x11, 0x00, 0x11, 0xec, 0x07, 0x0e, 0x62, 0x11, 0x00, 0xb7, 0x47, 0x11, 0x63, 0x09,
+ 0x00, 0x0e, 0x61, 0x13, 0x00, 0xb8, 0xc5, 0x13, 0x62, 0x13, 0x00, 0x62, 0x12, 0x00, 0xa4, 0x6a,
+ 0x04, 0x01, 0x00, 0x00, 0x62, 0x0d, 0x00, 0x62, 0x13, 0x00, 0x47, 0x11, 0x63, 0x08, 0x00, 0x0e,
+ 0x62, 0x13, 0x00, 0xb8, 0x9e, 0x62, 0x12, 0x00, 0xa4, 0xec, 0x35, 0x62, 0x02, 0x00, 0x62, 0x08,
+ 0x00, 0x47, 0x38, 0x46, 0x00, 0x00, 0x00, 0xac, 0x11, 0xed, 0x1d, 0x0e, 0x62, 0x0d, 0x00, 0x42,
+ 0x10, 0x01, 0x00, 0x00, 0x62, 0x13, 0x00, 0xb8, 0x9e, 0x62, 0x12, 0x00, 0x11, 0x63, 0x13, 0x00,
+ 0x24, 0x02, 0x00, 0x62, 0x09, 0x00, 0x9e, 0x11, 0x63, 0x09, 0x00, 0x0e, 0xef, 0x96, 0x00, 0x62,
+ 0x09, 0x00, 0xc3, 0xac, 0xec, 0x6f, 0x62, 0x0b, 0x00, 0x62, 0x0c, 0x00, 0xb8, 0x9e, 0xac, 0x11,
+ 0xed, 0x11, 0x0e, 0xd3, 0x62, 0x0c, 0x00, 0xb8, 0x9e, 0x47, 0xb7, 0x47, 0x04, 0x09, 0x01, 0x00,
+ 0x00, 0xac, 0xec, 0x1a, 0x62, 0x02, 0x00, 0x62, 0x08, 0x00, 0x47, 0x38, 0x46, 0x00, 0x00, 0x00,
+ 0xac, 0x11, 0xed, 0x03, 0x0e, 0xc3, 0x11, 0x63, 0x09, 0x00, 0x0e, 0xee, 0x57, 0x62, 0x03, 0x00,
+ 0x62, 0x08, 0x00, 0x47, 0x38, 0x46, 0x00, 0x00, 0x00, 0xad, 0x11, 0x63, 0x09, 0x00, 0x0e, 0x62,
+ 0x09, 0x00, 0x97, 0xec, 0x3f, 0x61, 0x14, 0x00, 0xd3, 0x62, 0x0c, 0x00, 0x90, 0x11, 0x63, 0x0c,
+ 0x00, 0x47, 0xc5, 0x14, 0xc4, 0x0a, 0x62, 0x08, 0x00, 0x62, 0x14, 0x00, 0xf2, 0x11, 0x63, 0x09,
+ 0x00, 0x0e, 0xee, 0x20, 0x62, 0x03, 0x00, 0x62, 0x08, 0x00, 0x47, 0x38, 0x46, 0x00, 0x00, 0x00,
+ 0xad, 0x11, 0xed, 0x0b, 0x0e, 0xc4, 0x0a, 0x62, 0x08, 0x00, 0x62, 0x09, 0x00, 0xf2, 0x11, 0x63,
+ 0x09, 0x00, 0x0e, 0x66, 0x04, 0x00, 0x62, 0x07, 0x00, 0x62, 0x08, 0x00, 0x62, 0x09, 0x00, 0x62,
+ 0x01, 0x00, 0x62, 0x00, 0x00, 0x22, 0x05, 0x00, 0x0e, 0x62, 0x13, 0x00, 0x92, 0x63, 0x13, 0x00,
+ 0x0e, 0xef, 0xf6, 0xfe, 0x62, 0x0c, 0x00, 0x92, 0x63, 0x0c, 0x00, 0x0e, 0xef, 0xa4, 0xfc, 0x62,
+ 0x04, 0x00, 0x7e, 0xee, 0x22, 0x63, 0x08, 0x00, 0x62, 0x07, 0x00, 0x62, 0x08, 0x00, 0x47, 0x38,
+ 0x46, 0x00, 0x00, 0x00, 0xac, 0xec, 0x10, 0x62, 0x07, 0x00, 0x62, 0x08, 0x00, 0x73, 0x62, 0x04,
+ 0x00, 0x62, 0x08, 0x00, 0x47, 0x49, 0x81, 0xec, 0xdd, 0x0e, 0x0e, 0x62, 0x03, 0x00, 0x7e, 0xee,
+ 0x1b, 0x63, 0x08, 0x00, 0x62, 0x07, 0x00, 0x62, 0x08, 0x00, 0x47, 0x38, 0x46, 0x00, 0x00, 0x00,
+ 0xac, 0xec, 0x09, 0x62, 0x07, 0x00, 0x62, 0x08, 0x00, 0x09, 0x49, 0x81, 0xec, 0xe4, 0x0e, 0x0e,
+ 0x62, 0x02, 0x00, 0x7e, 0xee, 0x1b, 0x63, 0x08, 0x00, 0x62, 0x07, 0x00, 0x62, 0x08, 0x00, 0x47,
+ 0x38, 0x46, 0x00, 0x00, 0x00, 0xac, 0xec, 0x09, 0x62, 0x07, 0x00, 0x62, 0x08, 0x00, 0xc3, 0x49,
+ 0x81, 0xec, 0xe4, 0x0e, 0x0e, 0x62, 0x07, 0x00, 0x28, 0xc6, 0x03, 0xc4, 0x01, 0x54, 0xbc, 0x26,
+ 0x21, 0x3c, 0x50, 0x4e, 0x4e, 0x2b, 0x1c, 0x3b, 0x12, 0x00, 0x03, 0x18, 0x17, 0x6c, 0x27, 0x85,
+ 0x1c, 0x3f, 0x6c, 0x0f, 0x50, 0x49, 0x58, 0x58, 0x0e, 0x62, 0x62, 0xc6, 0xad, 0x22, 0x44, 0x67,
+ 0x5d, 0x9f, 0x12, 0x58, 0x5d, 0x21, 0x99, 0x7c, 0x1c, 0x3f, 0x00, 0x0e, 0x0a, 0x72, 0x30, 0x30,
+ 0x53, 0x76, 0x59, 0x5d, 0x40, 0x3a, 0xf9, 0x35, 0x99, 0x77, 0x0d, 0x5d, 0x30, 0x3f, 0x00, 0x0e,
+ 0x08, 0x0d, 0xa0, 0x71, 0x3b, 0x3c, 0x30, 0x4e, 0x4f, 0x1e, 0x30, 0x4e, 0x2c, 0x1e, 0x30, 0x4e,
+ 0x2c, 0x1d, 0x0e, 0x43, 0x06, 0x01, 0x8a, 0x04, 0x02, 0x00, 0x02, 0x02, 0x02, 0x00, 0x15, 0x02,
+ 0xec, 0x03, 0x00, 0x01, 0x00, 0x82, 0x01, 0x00, 0x01, 0x00, 0x82, 0x04, 0x02, 0x0d, 0xd8, 0x03,
+ 0x00, 0x0c, 0x66, 0x00, 0x00, 0xd3, 0x47, 0x38, 0x46, 0x00, 0x00, 0x00, 0xac, 0xec, 0x07, 0x66,
+ 0x01, 0x00, 0xd4, 0xf1, 0x28, 0xd4, 0x28, 0xc6, 0x03, 0xdc, 0x01, 0x01, 0x03, 0x0e, 0x43, 0x06,
+ 0x01, 0xca, 0x03, 0x01, 0x00, 0x01, 0x03, 0x01, 0x00, 0x40, 0x01, 0x82, 0x01, 0x00, 0x01, 0x00,
+ 0xd0, 0x03, 0x0c, 0x00, 0xd3, 0x07, 0xaa, 0xec, 0x03, 0xd3, 0x28, 0x38, 0x98, 0x00, 0x00, 0x00,
+ 0x42, 0xeb, 0x00, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0xec, 0x05, 0xd3, 0xb7, 0x47, 0xd7, 0xd3,
+ 0x98, 0x04, 0x48, 0x00, 0x00, 0x00, 0xaa, 0xec, 0x03, 0xd3, 0x28, 0xd3, 0x98, 0x04, 0x47, 0x00,
+ 0x00, 0x00, 0xaa, 0xec, 0x05, 0xd3, 0xb7, 0xab, 0x28, 0xdf, 0xd3, 0xf1, 0xdb, 0x04, 0x03, 0x00,
+ 0x00, 0x00, 0xaa, 0x28, 0xc6, 0x03, 0xcc, 0x02, 0x0c, 0x03, 0x1c, 0x08, 0x09, 0x53, 0x19, 0x35,
+ 0x09, 0x3a, 0x12, 0x09, 0x17, 0x0e, 0x43, 0x06, 0x01, 0xcc, 0x03, 0x01, 0x00, 0x01, 0x03, 0x01,
+ 0x00, 0x39, 0x01, 0x82, 0x01, 0x00, 0x01, 0x00, 0xd0, 0x03, 0x0c, 0x00, 0xd3, 0x07, 0xaa, 0xec,
+ 0x03, 0xd3, 0x28, 0x38, 0x98, 0x00, 0x00, 0x00, 0x42, 0xeb, 0x00, 0x00, 0x00, 0xd3, 0x24, 0x01,
+ 0x00, 0xec, 0x05, 0xd3, 0xb7, 0x47, 0xd7, 0xd3, 0x98, 0x04, 0x47, 0x00, 0x00, 0x00, 0xaa, 0xec,
+ 0x03, 0xd3, 0x28, 0xdf, 0xd3, 0xf1, 0xd7, 0x38, 0x9a, 0x00, 0x00, 0x00, 0x42, 0xe6, 0x00, 0x00,
+ 0x00, 0xd3, 0x25, 0x01, 0x00, 0xc6, 0x03, 0xe5, 0x02, 0x0a, 0x03, 0x1c, 0x08, 0x09, 0x53, 0x19,
+ 0x35, 0x08, 0x09, 0x17, 0x0e, 0x43, 0x06, 0x01, 0xce, 0x03, 0x01, 0x00, 0x01, 0x03, 0x01, 0x00,
+ 0x39, 0x01, 0x82, 0x01, 0x00, 0x01, 0x00, 0xd0, 0x03, 0x0c, 0x00, 0xd3, 0x07, 0xaa, 0xec, 0x03,
+ 0xd3, 0x28, 0x38, 0x98, 0x00, 0x00, 0x00, 0x42, 0xeb, 0x00, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00,
+ 0xec, 0x05, 0xd3, 0xb7, 0x47, 0xd7, 0xd3, 0x98, 0x04, 0x47, 0x00, 0x00, 0x00, 0xaa, 0xec, 0x03,
+ 0xd3, 0x28, 0xdf, 0xd3, 0xf1, 0xd7, 0x38, 0x9a, 0x00, 0x00, 0x00, 0x42, 0x11, 0x01, 0x00, 0x00,
+ 0xd3, 0x25, 0x01, 0x00, 0xc6, 0x03, 0xfb, 0x02, 0x0a, 0x03, 0x1c, 0x08, 0x09, 0x53, 0x19, 0x35,
+ 0x08, 0x09, 0x17, 0x0e, 0x43, 0x06, 0x01, 0xd0, 0x03, 0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x24,
+ 0x01, 0x82, 0x01, 0x00, 0x01, 0x00, 0xd3, 0x07, 0xaa, 0xec, 0x03, 0xd3, 0x28, 0x38, 0x98, 0x00,
+ 0x00, 0x00, 0x42, 0xeb, 0x00, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0xec, 0x05, 0xd3, 0xb7, 0x47,
+ 0xd7, 0x38, 0x9b, 0x00, 0x00, 0x00, 0xd3, 0x23, 0x01, 0x00, 0xc6, 0x03, 0x91, 0x03, 0x06, 0x03,
+ 0x1c, 0x08, 0x09, 0x53, 0x19,
+};
+
+static const uint8_t tjs_m_modules_utils_sax[21342] = {
+ 0x02, 0xaf, 0x04, 0x32, 0x40, 0x61, 0x70, 0x70, 0x2f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73,
+ 0x2f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x2f, 0x73, 0x61, 0x78, 0x2e, 0x6a, 0x73, 0x06, 0x73, 0x61,
+ 0x78, 0x0c, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x12, 0x53, 0x41, 0x58, 0x50, 0x61, 0x72, 0x73,
+ 0x65, 0x72, 0x18, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x12,
+ 0x53, 0x41, 0x58, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x04, 0x65, 0x78, 0x0e, 0x62, 0x75, 0x66,
+ 0x66, 0x65, 0x72, 0x73, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72,
+ 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x18, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x42, 0x75, 0x66, 0x66,
+ 0x65, 0x72, 0x73, 0x18, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73,
+ 0x0c, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x16, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x57, 0x72,
+ 0x61, 0x70, 0x73, 0x0a, 0x43, 0x44, 0x41, 0x54, 0x41, 0x0e, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50,
+ 0x45, 0x1a, 0x58, 0x4d, 0x4c, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x53, 0x50, 0x41, 0x43, 0x45, 0x1e,
+ 0x58, 0x4d, 0x4c, 0x4e, 0x53, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x53, 0x50, 0x41, 0x43, 0x45, 0x0c,
+ 0x72, 0x6f, 0x6f, 0x74, 0x4e, 0x53, 0x12, 0x6e, 0x61, 0x6d, 0x65, 0x53, 0x74, 0x61, 0x72, 0x74,
+ 0x10, 0x6e, 0x61, 0x6d, 0x65, 0x42, 0x6f, 0x64, 0x79, 0x16, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79,
+ 0x53, 0x74, 0x61, 0x72, 0x74, 0x14, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x42, 0x6f, 0x64, 0x79,
+ 0x18, 0x69, 0x73, 0x57, 0x68, 0x69, 0x74, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x0e, 0x69, 0x73,
+ 0x51, 0x75, 0x6f, 0x74, 0x65, 0x16, 0x69, 0x73, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x45, 0x6e,
+ 0x64, 0x0e, 0x69, 0x73, 0x4d, 0x61, 0x74, 0x63, 0x68, 0x10, 0x6e, 0x6f, 0x74, 0x4d, 0x61, 0x74,
+ 0x63, 0x68, 0x02, 0x53, 0x02, 0x73, 0x08, 0x65, 0x6d, 0x69, 0x74, 0x10, 0x65, 0x6d, 0x69, 0x74,
+ 0x4e, 0x6f, 0x64, 0x65, 0x12, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x54, 0x65, 0x78, 0x74, 0x10, 0x74,
+ 0x65, 0x78, 0x74, 0x6f, 0x70, 0x74, 0x73, 0x0a, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x06, 0x65, 0x6e,
+ 0x64, 0x14, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x46, 0x61, 0x69, 0x6c, 0x0c, 0x6e, 0x65, 0x77,
+ 0x54, 0x61, 0x67, 0x0a, 0x71, 0x6e, 0x61, 0x6d, 0x65, 0x0c, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+ 0x0e, 0x6f, 0x70, 0x65, 0x6e, 0x54, 0x61, 0x67, 0x10, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x54, 0x61,
+ 0x67, 0x16, 0x70, 0x61, 0x72, 0x73, 0x65, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x1e, 0x62, 0x65,
+ 0x67, 0x69, 0x6e, 0x57, 0x68, 0x69, 0x74, 0x65, 0x53, 0x70, 0x61, 0x63, 0x65, 0x0c, 0x63, 0x68,
+ 0x61, 0x72, 0x41, 0x74, 0x0a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x22, 0x4d, 0x41, 0x58, 0x5f, 0x42,
+ 0x55, 0x46, 0x46, 0x45, 0x52, 0x5f, 0x4c, 0x45, 0x4e, 0x47, 0x54, 0x48, 0x0e, 0x63, 0x6f, 0x6d,
+ 0x6d, 0x65, 0x6e, 0x74, 0x10, 0x73, 0x67, 0x6d, 0x6c, 0x44, 0x65, 0x63, 0x6c, 0x10, 0x74, 0x65,
+ 0x78, 0x74, 0x4e, 0x6f, 0x64, 0x65, 0x0e, 0x74, 0x61, 0x67, 0x4e, 0x61, 0x6d, 0x65, 0x0e, 0x64,
+ 0x6f, 0x63, 0x74, 0x79, 0x70, 0x65, 0x18, 0x70, 0x72, 0x6f, 0x63, 0x49, 0x6e, 0x73, 0x74, 0x4e,
+ 0x61, 0x6d, 0x65, 0x18, 0x70, 0x72, 0x6f, 0x63, 0x49, 0x6e, 0x73, 0x74, 0x42, 0x6f, 0x64, 0x79,
+ 0x0c, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x14, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x4e, 0x61,
+ 0x6d, 0x65, 0x16, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x0a, 0x63,
+ 0x64, 0x61, 0x74, 0x61, 0x0c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x08, 0x74, 0x65, 0x78, 0x74,
+ 0x2a, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x69, 0x6e, 0x73, 0x74, 0x72,
+ 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x1e, 0x73, 0x67, 0x6d, 0x6c, 0x64, 0x65, 0x63, 0x6c, 0x61,
+ 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x6f, 0x70, 0x65, 0x6e, 0x74, 0x61, 0x67, 0x73, 0x74,
+ 0x61, 0x72, 0x74, 0x12, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x0e, 0x6f, 0x70,
+ 0x65, 0x6e, 0x74, 0x61, 0x67, 0x10, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x74, 0x61, 0x67, 0x12, 0x6f,
+ 0x70, 0x65, 0x6e, 0x63, 0x64, 0x61, 0x74, 0x61, 0x14, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x63, 0x64,
+ 0x61, 0x74, 0x61, 0x0a, 0x72, 0x65, 0x61, 0x64, 0x79, 0x1a, 0x6f, 0x70, 0x65, 0x6e, 0x6e, 0x61,
+ 0x6d, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x1c, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x6e, 0x61, 0x6d,
+ 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x0c, 0x45, 0x56, 0x45, 0x4e, 0x54, 0x53, 0x0c, 0x63, 0x72,
+ 0x65, 0x61, 0x74, 0x65, 0x08, 0x6b, 0x65, 0x79, 0x73, 0x0c, 0x72, 0x65, 0x73, 0x75, 0x6d, 0x65,
+ 0x0a, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x0a, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x0e, 0x72, 0x65, 0x71,
+ 0x75, 0x69, 0x72, 0x65, 0x0c, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x0c, 0x66, 0x69, 0x6c, 0x74,
+ 0x65, 0x72, 0x04, 0x6f, 0x6e, 0x0e, 0x5b, 0x43, 0x44, 0x41, 0x54, 0x41, 0x5b, 0x48, 0x68, 0x74,
+ 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+ 0x58, 0x4d, 0x4c, 0x2f, 0x31, 0x39, 0x39, 0x38, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x70, 0x61,
+ 0x63, 0x65, 0x3a, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33,
+ 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x32, 0x30, 0x30, 0x30, 0x2f, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x2f,
+ 0x06, 0x78, 0x6d, 0x6c, 0x0a, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e,
+ 0x20, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x5f, 0x57, 0x48, 0x49, 0x54, 0x45, 0x53, 0x50, 0x41, 0x43,
+ 0x45, 0x08, 0x54, 0x45, 0x58, 0x54, 0x16, 0x54, 0x45, 0x58, 0x54, 0x5f, 0x45, 0x4e, 0x54, 0x49,
+ 0x54, 0x59, 0x12, 0x4f, 0x50, 0x45, 0x4e, 0x5f, 0x57, 0x41, 0x4b, 0x41, 0x12, 0x53, 0x47, 0x4d,
+ 0x4c, 0x5f, 0x44, 0x45, 0x43, 0x4c, 0x20, 0x53, 0x47, 0x4d, 0x4c, 0x5f, 0x44, 0x45, 0x43, 0x4c,
+ 0x5f, 0x51, 0x55, 0x4f, 0x54, 0x45, 0x44, 0x1c, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x5f,
+ 0x51, 0x55, 0x4f, 0x54, 0x45, 0x44, 0x16, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x44,
+ 0x54, 0x44, 0x24, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x44, 0x54, 0x44, 0x5f, 0x51,
+ 0x55, 0x4f, 0x54, 0x45, 0x44, 0x20, 0x43, 0x4f, 0x4d, 0x4d, 0x45, 0x4e, 0x54, 0x5f, 0x53, 0x54,
+ 0x41, 0x52, 0x54, 0x49, 0x4e, 0x47, 0x0e, 0x43, 0x4f, 0x4d, 0x4d, 0x45, 0x4e, 0x54, 0x1c, 0x43,
+ 0x4f, 0x4d, 0x4d, 0x45, 0x4e, 0x54, 0x5f, 0x45, 0x4e, 0x44, 0x49, 0x4e, 0x47, 0x1a, 0x43, 0x4f,
+ 0x4d, 0x4d, 0x45, 0x4e, 0x54, 0x5f, 0x45, 0x4e, 0x44, 0x45, 0x44, 0x18, 0x43, 0x44, 0x41, 0x54,
+ 0x41, 0x5f, 0x45, 0x4e, 0x44, 0x49, 0x4e, 0x47, 0x1c, 0x43, 0x44, 0x41, 0x54, 0x41, 0x5f, 0x45,
+ 0x4e, 0x44, 0x49, 0x4e, 0x47, 0x5f, 0x32, 0x12, 0x50, 0x52, 0x4f, 0x43, 0x5f, 0x49, 0x4e, 0x53,
+ 0x54, 0x1c, 0x50, 0x52, 0x4f, 0x43, 0x5f, 0x49, 0x4e, 0x53, 0x54, 0x5f, 0x42, 0x4f, 0x44, 0x59,
+ 0x20, 0x50, 0x52, 0x4f, 0x43, 0x5f, 0x49, 0x4e, 0x53, 0x54, 0x5f, 0x45, 0x4e, 0x44, 0x49, 0x4e,
+ 0x47, 0x10, 0x4f, 0x50, 0x45, 0x4e, 0x5f, 0x54, 0x41, 0x47, 0x1c, 0x4f, 0x50, 0x45, 0x4e, 0x5f,
+ 0x54, 0x41, 0x47, 0x5f, 0x53, 0x4c, 0x41, 0x53, 0x48, 0x0c, 0x41, 0x54, 0x54, 0x52, 0x49, 0x42,
+ 0x16, 0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x2a, 0x41, 0x54, 0x54,
+ 0x52, 0x49, 0x42, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x5f, 0x53, 0x41, 0x57, 0x5f, 0x57, 0x48, 0x49,
+ 0x54, 0x45, 0x18, 0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x26,
+ 0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x5f, 0x51, 0x55, 0x4f,
+ 0x54, 0x45, 0x44, 0x26, 0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45,
+ 0x5f, 0x43, 0x4c, 0x4f, 0x53, 0x45, 0x44, 0x2a, 0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x5f, 0x56,
+ 0x41, 0x4c, 0x55, 0x45, 0x5f, 0x55, 0x4e, 0x51, 0x55, 0x4f, 0x54, 0x45, 0x44, 0x2a, 0x41, 0x54,
+ 0x54, 0x52, 0x49, 0x42, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x5f, 0x45, 0x4e, 0x54, 0x49, 0x54,
+ 0x59, 0x5f, 0x51, 0x2a, 0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45,
+ 0x5f, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x5f, 0x55, 0x12, 0x43, 0x4c, 0x4f, 0x53, 0x45, 0x5f,
+ 0x54, 0x41, 0x47, 0x26, 0x43, 0x4c, 0x4f, 0x53, 0x45, 0x5f, 0x54, 0x41, 0x47, 0x5f, 0x53, 0x41,
+ 0x57, 0x5f, 0x57, 0x48, 0x49, 0x54, 0x45, 0x0c, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x1a, 0x53,
+ 0x43, 0x52, 0x49, 0x50, 0x54, 0x5f, 0x45, 0x4e, 0x44, 0x49, 0x4e, 0x47, 0x0a, 0x53, 0x54, 0x41,
+ 0x54, 0x45, 0x02, 0x26, 0x06, 0x61, 0x6d, 0x70, 0x02, 0x3e, 0x04, 0x67, 0x74, 0x02, 0x3c, 0x04,
+ 0x6c, 0x74, 0x02, 0x22, 0x08, 0x71, 0x75, 0x6f, 0x74, 0x02, 0x27, 0x08, 0x61, 0x70, 0x6f, 0x73,
+ 0x18, 0x58, 0x4d, 0x4c, 0x5f, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x49, 0x45, 0x53, 0x0a, 0x41, 0x45,
+ 0x6c, 0x69, 0x67, 0x0c, 0x41, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0a, 0x41, 0x63, 0x69, 0x72, 0x63,
+ 0x0c, 0x41, 0x67, 0x72, 0x61, 0x76, 0x65, 0x0a, 0x41, 0x72, 0x69, 0x6e, 0x67, 0x0c, 0x41, 0x74,
+ 0x69, 0x6c, 0x64, 0x65, 0x08, 0x41, 0x75, 0x6d, 0x6c, 0x0c, 0x43, 0x63, 0x65, 0x64, 0x69, 0x6c,
+ 0x06, 0x45, 0x54, 0x48, 0x0c, 0x45, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0a, 0x45, 0x63, 0x69, 0x72,
+ 0x63, 0x0c, 0x45, 0x67, 0x72, 0x61, 0x76, 0x65, 0x08, 0x45, 0x75, 0x6d, 0x6c, 0x0c, 0x49, 0x61,
+ 0x63, 0x75, 0x74, 0x65, 0x0a, 0x49, 0x63, 0x69, 0x72, 0x63, 0x0c, 0x49, 0x67, 0x72, 0x61, 0x76,
+ 0x65, 0x08, 0x49, 0x75, 0x6d, 0x6c, 0x0c, 0x4e, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x0c, 0x4f, 0x61,
+ 0x63, 0x75, 0x74, 0x65, 0x0a, 0x4f, 0x63, 0x69, 0x72, 0x63, 0x0c, 0x4f, 0x67, 0x72, 0x61, 0x76,
+ 0x65, 0x0c, 0x4f, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x0c, 0x4f, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x08,
+ 0x4f, 0x75, 0x6d, 0x6c, 0x0a, 0x54, 0x48, 0x4f, 0x52, 0x4e, 0x0c, 0x55, 0x61, 0x63, 0x75, 0x74,
+ 0x65, 0x0a, 0x55, 0x63, 0x69, 0x72, 0x63, 0x0c, 0x55, 0x67, 0x72, 0x61, 0x76, 0x65, 0x08, 0x55,
+ 0x75, 0x6d, 0x6c, 0x0c, 0x59, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0c, 0x61, 0x61, 0x63, 0x75, 0x74,
+ 0x65, 0x0a, 0x61, 0x63, 0x69, 0x72, 0x63, 0x0a, 0x61, 0x65, 0x6c, 0x69, 0x67, 0x0c, 0x61, 0x67,
+ 0x72, 0x61, 0x76, 0x65, 0x0a, 0x61, 0x72, 0x69, 0x6e, 0x67, 0x0c, 0x61, 0x74, 0x69, 0x6c, 0x64,
+ 0x65, 0x08, 0x61, 0x75, 0x6d, 0x6c, 0x0c, 0x63, 0x63, 0x65, 0x64, 0x69, 0x6c, 0x0c, 0x65, 0x61,
+ 0x63, 0x75, 0x74, 0x65, 0x0a, 0x65, 0x63, 0x69, 0x72, 0x63, 0x0c, 0x65, 0x67, 0x72, 0x61, 0x76,
+ 0x65, 0x06, 0x65, 0x74, 0x68, 0x08, 0x65, 0x75, 0x6d, 0x6c, 0x0c, 0x69, 0x61, 0x63, 0x75, 0x74,
+ 0x65, 0x0a, 0x69, 0x63, 0x69, 0x72, 0x63, 0x0c, 0x69, 0x67, 0x72, 0x61, 0x76, 0x65, 0x08, 0x69,
+ 0x75, 0x6d, 0x6c, 0x0c, 0x6e, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x0c, 0x6f, 0x61, 0x63, 0x75, 0x74,
+ 0x65, 0x0a, 0x6f, 0x63, 0x69, 0x72, 0x63, 0x0c, 0x6f, 0x67, 0x72, 0x61, 0x76, 0x65, 0x0c, 0x6f,
+ 0x73, 0x6c, 0x61, 0x73, 0x68, 0x0c, 0x6f, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x08, 0x6f, 0x75, 0x6d,
+ 0x6c, 0x0a, 0x73, 0x7a, 0x6c, 0x69, 0x67, 0x0a, 0x74, 0x68, 0x6f, 0x72, 0x6e, 0x0c, 0x75, 0x61,
+ 0x63, 0x75, 0x74, 0x65, 0x0a, 0x75, 0x63, 0x69, 0x72, 0x63, 0x0c, 0x75, 0x67, 0x72, 0x61, 0x76,
+ 0x65, 0x08, 0x75, 0x75, 0x6d, 0x6c, 0x0c, 0x79, 0x61, 0x63, 0x75, 0x74, 0x65, 0x08, 0x79, 0x75,
+ 0x6d, 0x6c, 0x08, 0x63, 0x6f, 0x70, 0x79, 0x06, 0x72, 0x65, 0x67, 0x08, 0x6e, 0x62, 0x73, 0x70,
+ 0x0a, 0x69, 0x65, 0x78, 0x63, 0x6c, 0x08, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x70, 0x6f, 0x75, 0x6e,
+ 0x64, 0x0c, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x06, 0x79, 0x65, 0x6e, 0x0c, 0x62, 0x72, 0x76,
+ 0x62, 0x61, 0x72, 0x08, 0x73, 0x65, 0x63, 0x74, 0x06, 0x75, 0x6d, 0x6c, 0x08, 0x6f, 0x72, 0x64,
+ 0x66, 0x0a, 0x6c, 0x61, 0x71, 0x75, 0x6f, 0x06, 0x6e, 0x6f, 0x74, 0x06, 0x73, 0x68, 0x79, 0x08,
+ 0x6d, 0x61, 0x63, 0x72, 0x06, 0x64, 0x65, 0x67, 0x0c, 0x70, 0x6c, 0x75, 0x73, 0x6d, 0x6e, 0x08,
+ 0x73, 0x75, 0x70, 0x31, 0x08, 0x73, 0x75, 0x70, 0x32, 0x08, 0x73, 0x75, 0x70, 0x33, 0x0a, 0x61,
+ 0x63, 0x75, 0x74, 0x65, 0x0a, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x08, 0x70, 0x61, 0x72, 0x61, 0x0c,
+ 0x6d, 0x69, 0x64, 0x64, 0x6f, 0x74, 0x0a, 0x63, 0x65, 0x64, 0x69, 0x6c, 0x08, 0x6f, 0x72, 0x64,
+ 0x6d, 0x0a, 0x72, 0x61, 0x71, 0x75, 0x6f, 0x0c, 0x66, 0x72, 0x61, 0x63, 0x31, 0x34, 0x0c, 0x66,
+ 0x72, 0x61, 0x63, 0x31, 0x32, 0x0c, 0x66, 0x72, 0x61, 0x63, 0x33, 0x34, 0x0c, 0x69, 0x71, 0x75,
+ 0x65, 0x73, 0x74, 0x0a, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x0c, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65,
+ 0x0a, 0x4f, 0x45, 0x6c, 0x69, 0x67, 0x0a, 0x6f, 0x65, 0x6c, 0x69, 0x67, 0x0c, 0x53, 0x63, 0x61,
+ 0x72, 0x6f, 0x6e, 0x0c, 0x73, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x08, 0x59, 0x75, 0x6d, 0x6c, 0x08,
+ 0x66, 0x6e, 0x6f, 0x66, 0x08, 0x63, 0x69, 0x72, 0x63, 0x0a, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x0a,
+ 0x41, 0x6c, 0x70, 0x68, 0x61, 0x08, 0x42, 0x65, 0x74, 0x61, 0x0a, 0x47, 0x61, 0x6d, 0x6d, 0x61,
+ 0x0a, 0x44, 0x65, 0x6c, 0x74, 0x61, 0x0e, 0x45, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x08, 0x5a,
+ 0x65, 0x74, 0x61, 0x06, 0x45, 0x74, 0x61, 0x0a, 0x54, 0x68, 0x65, 0x74, 0x61, 0x08, 0x49, 0x6f,
+ 0x74, 0x61, 0x0a, 0x4b, 0x61, 0x70, 0x70, 0x61, 0x0c, 0x4c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x04,
+ 0x4d, 0x75, 0x04, 0x4e, 0x75, 0x04, 0x58, 0x69, 0x0e, 0x4f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e,
+ 0x04, 0x50, 0x69, 0x06, 0x52, 0x68, 0x6f, 0x0a, 0x53, 0x69, 0x67, 0x6d, 0x61, 0x06, 0x54, 0x61,
+ 0x75, 0x0e, 0x55, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x06, 0x50, 0x68, 0x69, 0x06, 0x43, 0x68,
+ 0x69, 0x06, 0x50, 0x73, 0x69, 0x0a, 0x4f, 0x6d, 0x65, 0x67, 0x61, 0x0a, 0x61, 0x6c, 0x70, 0x68,
+ 0x61, 0x08, 0x62, 0x65, 0x74, 0x61, 0x0a, 0x67, 0x61, 0x6d, 0x6d, 0x61, 0x0a, 0x64, 0x65, 0x6c,
+ 0x74, 0x61, 0x0e, 0x65, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x08, 0x7a, 0x65, 0x74, 0x61, 0x06,
+ 0x65, 0x74, 0x61, 0x0a, 0x74, 0x68, 0x65, 0x74, 0x61, 0x08, 0x69, 0x6f, 0x74, 0x61, 0x0a, 0x6b,
+ 0x61, 0x70, 0x70, 0x61, 0x0c, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x04, 0x6d, 0x75, 0x04, 0x6e,
+ 0x75, 0x04, 0x78, 0x69, 0x0e, 0x6f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x04, 0x70, 0x69, 0x06,
+ 0x72, 0x68, 0x6f, 0x0c, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x66, 0x0a, 0x73, 0x69, 0x67, 0x6d, 0x61,
+ 0x06, 0x74, 0x61, 0x75, 0x0e, 0x75, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x06, 0x70, 0x68, 0x69,
+ 0x06, 0x63, 0x68, 0x69, 0x06, 0x70, 0x73, 0x69, 0x0a, 0x6f, 0x6d, 0x65, 0x67, 0x61, 0x10, 0x74,
+ 0x68, 0x65, 0x74, 0x61, 0x73, 0x79, 0x6d, 0x0a, 0x75, 0x70, 0x73, 0x69, 0x68, 0x06, 0x70, 0x69,
+ 0x76, 0x08, 0x65, 0x6e, 0x73, 0x70, 0x08, 0x65, 0x6d, 0x73, 0x70, 0x0c, 0x74, 0x68, 0x69, 0x6e,
+ 0x73, 0x70, 0x08, 0x7a, 0x77, 0x6e, 0x6a, 0x06, 0x7a, 0x77, 0x6a, 0x06, 0x6c, 0x72, 0x6d, 0x06,
+ 0x72, 0x6c, 0x6d, 0x0a, 0x6e, 0x64, 0x61, 0x73, 0x68, 0x0a, 0x6d, 0x64, 0x61, 0x73, 0x68, 0x0a,
+ 0x6c, 0x73, 0x71, 0x75, 0x6f, 0x0a, 0x72, 0x73, 0x71, 0x75, 0x6f, 0x0a, 0x73, 0x62, 0x71, 0x75,
+ 0x6f, 0x0a, 0x6c, 0x64, 0x71, 0x75, 0x6f, 0x0a, 0x72, 0x64, 0x71, 0x75, 0x6f, 0x0a, 0x62, 0x64,
+ 0x71, 0x75, 0x6f, 0x0c, 0x64, 0x61, 0x67, 0x67, 0x65, 0x72, 0x0c, 0x44, 0x61, 0x67, 0x67, 0x65,
+ 0x72, 0x08, 0x62, 0x75, 0x6c, 0x6c, 0x0c, 0x68, 0x65, 0x6c, 0x6c, 0x69, 0x70, 0x0c, 0x70, 0x65,
+ 0x72, 0x6d, 0x69, 0x6c, 0x0a, 0x70, 0x72, 0x69, 0x6d, 0x65, 0x0a, 0x50, 0x72, 0x69, 0x6d, 0x65,
+ 0x0c, 0x6c, 0x73, 0x61, 0x71, 0x75, 0x6f, 0x0c, 0x72, 0x73, 0x61, 0x71, 0x75, 0x6f, 0x0a, 0x6f,
+ 0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x66, 0x72, 0x61, 0x73, 0x6c, 0x08, 0x65, 0x75, 0x72, 0x6f, 0x0a,
+ 0x69, 0x6d, 0x61, 0x67, 0x65, 0x0c, 0x77, 0x65, 0x69, 0x65, 0x72, 0x70, 0x08, 0x72, 0x65, 0x61,
+ 0x6c, 0x0a, 0x74, 0x72, 0x61, 0x64, 0x65, 0x0e, 0x61, 0x6c, 0x65, 0x66, 0x73, 0x79, 0x6d, 0x08,
+ 0x6c, 0x61, 0x72, 0x72, 0x08, 0x75, 0x61, 0x72, 0x72, 0x08, 0x72, 0x61, 0x72, 0x72, 0x08, 0x64,
+ 0x61, 0x72, 0x72, 0x08, 0x68, 0x61, 0x72, 0x72, 0x0a, 0x63, 0x72, 0x61, 0x72, 0x72, 0x08, 0x6c,
+ 0x41, 0x72, 0x72, 0x08, 0x75, 0x41, 0x72, 0x72, 0x08, 0x72, 0x41, 0x72, 0x72, 0x08, 0x64, 0x41,
+ 0x72, 0x72, 0x08, 0x68, 0x41, 0x72, 0x72, 0x0c, 0x66, 0x6f, 0x72, 0x61, 0x6c, 0x6c, 0x08, 0x70,
+ 0x61, 0x72, 0x74, 0x0a, 0x65, 0x78, 0x69, 0x73, 0x74, 0x0a, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x0a,
+ 0x6e, 0x61, 0x62, 0x6c, 0x61, 0x08, 0x69, 0x73, 0x69, 0x6e, 0x0a, 0x6e, 0x6f, 0x74, 0x69, 0x6e,
+ 0x04, 0x6e, 0x69, 0x08, 0x70, 0x72, 0x6f, 0x64, 0x06, 0x73, 0x75, 0x6d, 0x0a, 0x6d, 0x69, 0x6e,
+ 0x75, 0x73, 0x0c, 0x6c, 0x6f, 0x77, 0x61, 0x73, 0x74, 0x0a, 0x72, 0x61, 0x64, 0x69, 0x63, 0x08,
+ 0x70, 0x72, 0x6f, 0x70, 0x0a, 0x69, 0x6e, 0x66, 0x69, 0x6e, 0x06, 0x61, 0x6e, 0x67, 0x06, 0x61,
+ 0x6e, 0x64, 0x04, 0x6f, 0x72, 0x06, 0x63, 0x61, 0x70, 0x06, 0x63, 0x75, 0x70, 0x06, 0x69, 0x6e,
+ 0x74, 0x0c, 0x74, 0x68, 0x65, 0x72, 0x65, 0x34, 0x06, 0x73, 0x69, 0x6d, 0x08, 0x63, 0x6f, 0x6e,
+ 0x67, 0x0a, 0x61, 0x73, 0x79, 0x6d, 0x70, 0x04, 0x6e, 0x65, 0x0a, 0x65, 0x71, 0x75, 0x69, 0x76,
+ 0x04, 0x6c, 0x65, 0x04, 0x67, 0x65, 0x06, 0x73, 0x75, 0x62, 0x06, 0x73, 0x75, 0x70, 0x08, 0x6e,
+ 0x73, 0x75, 0x62, 0x08, 0x73, 0x75, 0x62, 0x65, 0x08, 0x73, 0x75, 0x70, 0x65, 0x0a, 0x6f, 0x70,
+ 0x6c, 0x75, 0x73, 0x0c, 0x6f, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x08, 0x70, 0x65, 0x72, 0x70, 0x08,
+ 0x73, 0x64, 0x6f, 0x74, 0x0a, 0x6c, 0x63, 0x65, 0x69, 0x6c, 0x0a, 0x72, 0x63, 0x65, 0x69, 0x6c,
+ 0x0c, 0x6c, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x0c, 0x72, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x08, 0x6c,
+ 0x61, 0x6e, 0x67, 0x08, 0x72, 0x61, 0x6e, 0x67, 0x06, 0x6c, 0x6f, 0x7a, 0x0c, 0x73, 0x70, 0x61,
+ 0x64, 0x65, 0x73, 0x0a, 0x63, 0x6c, 0x75, 0x62, 0x73, 0x0c, 0x68, 0x65, 0x61, 0x72, 0x74, 0x73,
+ 0x0a, 0x64, 0x69, 0x61, 0x6d, 0x73, 0x10, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x49, 0x45, 0x53, 0x0e,
+ 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x1a, 0x66, 0x72, 0x6f, 0x6d, 0x43, 0x6f, 0x64, 0x65,
+ 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x0c, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x06, 0x6f, 0x70, 0x74,
+ 0x0e, 0x6f, 0x6e, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x12, 0x6f, 0x6e, 0x6f, 0x70, 0x65, 0x6e, 0x74,
+ 0x61, 0x67, 0x14, 0x6f, 0x6e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x74, 0x61, 0x67, 0x0c, 0x6f, 0x6e,
+ 0x74, 0x65, 0x78, 0x74, 0x0a, 0x6f, 0x6e, 0x65, 0x6e, 0x64, 0x02, 0x63, 0x02, 0x71, 0x26, 0x62,
+ 0x75, 0x66, 0x66, 0x65, 0x72, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69,
+ 0x6f, 0x6e, 0x12, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x63, 0x61, 0x73, 0x65, 0x1a, 0x6c, 0x6f, 0x77,
+ 0x65, 0x72, 0x63, 0x61, 0x73, 0x65, 0x74, 0x61, 0x67, 0x73, 0x16, 0x74, 0x6f, 0x4c, 0x6f, 0x77,
+ 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x16, 0x74, 0x6f, 0x55, 0x70, 0x70, 0x65, 0x72, 0x43, 0x61,
+ 0x73, 0x65, 0x12, 0x6c, 0x6f, 0x6f, 0x73, 0x65, 0x43, 0x61, 0x73, 0x65, 0x08, 0x74, 0x61, 0x67,
+ 0x73, 0x0e, 0x73, 0x61, 0x77, 0x52, 0x6f, 0x6f, 0x74, 0x14, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x64,
+ 0x52, 0x6f, 0x6f, 0x74, 0x0c, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x64, 0x06, 0x74, 0x61, 0x67, 0x10,
+ 0x6e, 0x6f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x65, 0x1c, 0x73,
+ 0x74, 0x72, 0x69, 0x63, 0x74, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x14, 0x61, 0x74,
+ 0x74, 0x72, 0x69, 0x62, 0x4c, 0x69, 0x73, 0x74, 0x04, 0x6e, 0x73, 0x10, 0x70, 0x6f, 0x73, 0x69,
+ 0x74, 0x69, 0x6f, 0x6e, 0x1a, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69,
+ 0x6f, 0x6e, 0x0c, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x08, 0x6c, 0x69, 0x6e, 0x65, 0x0e, 0x6f,
+ 0x6e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x02, 0x6f, 0x02, 0x46, 0x08, 0x6e, 0x65, 0x77, 0x66, 0x02,
+ 0x61, 0x02, 0x69, 0x1c, 0x68, 0x61, 0x73, 0x4f, 0x77, 0x6e, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72,
+ 0x74, 0x79, 0x08, 0x70, 0x75, 0x73, 0x68, 0x14, 0x6d, 0x61, 0x78, 0x41, 0x6c, 0x6c, 0x6f, 0x77,
+ 0x65, 0x64, 0x12, 0x6d, 0x61, 0x78, 0x41, 0x63, 0x74, 0x75, 0x61, 0x6c, 0x02, 0x6c, 0x06, 0x6c,
+ 0x65, 0x6e, 0x02, 0x6d, 0x06, 0x6d, 0x61, 0x78, 0x0e, 0x6f, 0x6e, 0x63, 0x64, 0x61, 0x74, 0x61,
+ 0x10, 0x6f, 0x6e, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x38, 0x4d, 0x61, 0x78, 0x20, 0x62, 0x75,
+ 0x66, 0x66, 0x65, 0x72, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x65, 0x78, 0x63, 0x65,
+ 0x65, 0x64, 0x65, 0x64, 0x3a, 0x20, 0x04, 0x65, 0x76, 0x04, 0x6d, 0x65, 0x0e, 0x5f, 0x70, 0x61,
+ 0x72, 0x73, 0x65, 0x72, 0x10, 0x72, 0x65, 0x61, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x10, 0x5f, 0x64,
+ 0x65, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x04, 0x65, 0x72, 0x02, 0x68, 0x24, 0x72, 0x65, 0x6d, 0x6f,
+ 0x76, 0x65, 0x41, 0x6c, 0x6c, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x73, 0x08, 0x64,
+ 0x61, 0x74, 0x61, 0x04, 0x53, 0x44, 0x0c, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x10, 0x69, 0x73,
+ 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x1c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65,
+ 0x63, 0x6f, 0x64, 0x65, 0x72, 0x1a, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x44, 0x65, 0x63, 0x6f,
+ 0x64, 0x65, 0x72, 0x08, 0x75, 0x74, 0x66, 0x38, 0x0a, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x0e, 0x68,
+ 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x0e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x4f, 0x66, 0x08, 0x63,
+ 0x61, 0x6c, 0x6c, 0x08, 0x61, 0x72, 0x67, 0x73, 0x0c, 0x73, 0x70, 0x6c, 0x69, 0x63, 0x65, 0x02,
+ 0x20, 0x02, 0x0a, 0x02, 0x0d, 0x02, 0x09, 0x0a, 0x72, 0x65, 0x67, 0x65, 0x78, 0x08, 0x74, 0x65,
+ 0x73, 0x74, 0x06, 0x6b, 0x65, 0x79, 0x02, 0x65, 0x18, 0x66, 0x72, 0x6f, 0x6d, 0x43, 0x68, 0x61,
+ 0x72, 0x43, 0x6f, 0x64, 0x65, 0x0a, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x10, 0x6e, 0x6f, 0x64, 0x65,
+ 0x54, 0x79, 0x70, 0x65, 0x08, 0x74, 0x72, 0x69, 0x6d, 0x12, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c,
+ 0x69, 0x7a, 0x65, 0x0e, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x0e, 0x0a, 0x4c, 0x69, 0x6e,
+ 0x65, 0x3a, 0x20, 0x12, 0x0a, 0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3a, 0x20, 0x0e, 0x0a, 0x43,
+ 0x68, 0x61, 0x72, 0x3a, 0x20, 0x22, 0x55, 0x6e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x64, 0x20, 0x72,
+ 0x6f, 0x6f, 0x74, 0x20, 0x74, 0x61, 0x67, 0x1c, 0x55, 0x6e, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74,
+ 0x65, 0x64, 0x20, 0x65, 0x6e, 0x64, 0x2c, 0x62, 0x61, 0x64, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20,
+ 0x74, 0x6f, 0x20, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x46, 0x61, 0x69, 0x6c, 0x0c, 0x70, 0x61,
+ 0x72, 0x65, 0x6e, 0x74, 0x14, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x1c,
+ 0x6f, 0x6e, 0x6f, 0x70, 0x65, 0x6e, 0x74, 0x61, 0x67, 0x73, 0x74, 0x61, 0x72, 0x74, 0x10, 0x71,
+ 0x75, 0x61, 0x6c, 0x4e, 0x61, 0x6d, 0x65, 0x0c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x0a, 0x6c,
+ 0x6f, 0x63, 0x61, 0x6c, 0x02, 0x3a, 0x04, 0x71, 0x6e, 0x3a, 0x78, 0x6d, 0x6c, 0x3a, 0x20, 0x70,
+ 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x62, 0x6f,
+ 0x75, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x10, 0x41, 0x63, 0x74, 0x75, 0x61, 0x6c, 0x3a, 0x20,
+ 0x3e, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x6d,
+ 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x20,
+ 0x16, 0x6f, 0x6e, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x16, 0x73, 0x65, 0x6c,
+ 0x66, 0x43, 0x6c, 0x6f, 0x73, 0x69, 0x6e, 0x67, 0x04, 0x6e, 0x76, 0x06, 0x75, 0x72, 0x69, 0x34,
+ 0x55, 0x6e, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x70, 0x61, 0x63,
+ 0x65, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3a, 0x20, 0x12, 0x73, 0x74, 0x72, 0x69, 0x6e,
+ 0x67, 0x69, 0x66, 0x79, 0x1a, 0x69, 0x73, 0x53, 0x65, 0x6c, 0x66, 0x43, 0x6c, 0x6f, 0x73, 0x69,
+ 0x6e, 0x67, 0x02, 0x70, 0x1e, 0x6f, 0x6e, 0x6f, 0x70, 0x65, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x73,
+ 0x70, 0x61, 0x63, 0x65, 0x02, 0x74, 0x0e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x54, 0x6f, 0x02, 0x78,
+ 0x2c, 0x57, 0x65, 0x69, 0x72, 0x64, 0x20, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x20, 0x63, 0x6c, 0x6f,
+ 0x73, 0x65, 0x20, 0x74, 0x61, 0x67, 0x2e, 0x06, 0x3c, 0x2f, 0x3e, 0x04, 0x3c, 0x2f, 0x28, 0x55,
+ 0x6e, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x20,
+ 0x74, 0x61, 0x67, 0x2e, 0x55, 0x6e, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x63, 0x6c,
+ 0x6f, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x61, 0x67, 0x3a, 0x20, 0x06, 0x70, 0x6f, 0x70, 0x02,
+ 0x6e, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x70, 0x61,
+ 0x63, 0x65, 0x10, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x4c, 0x43, 0x06, 0x6e, 0x75, 0x6d, 0x0c,
+ 0x6e, 0x75, 0x6d, 0x53, 0x74, 0x72, 0x02, 0x23, 0x0a, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x10, 0x70,
+ 0x61, 0x72, 0x73, 0x65, 0x49, 0x6e, 0x74, 0x0a, 0x69, 0x73, 0x4e, 0x61, 0x4e, 0x30, 0x49, 0x6e,
+ 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20,
+ 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x02, 0x3b, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x54, 0x61,
+ 0x67, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x40, 0x4e, 0x6f, 0x6e, 0x2d, 0x77, 0x68,
+ 0x69, 0x74, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20,
+ 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x61, 0x67, 0x2e, 0x0c, 0x72, 0x65, 0x73, 0x75, 0x6c,
+ 0x74, 0x0c, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x06, 0x70, 0x61, 0x64, 0x16, 0x72, 0x65, 0x74,
+ 0x75, 0x72, 0x6e, 0x53, 0x74, 0x61, 0x74, 0x65, 0x0c, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x68,
+ 0x43, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x61, 0x66, 0x74,
+ 0x65, 0x72, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x2e, 0x20, 0x41, 0x73, 0x73, 0x69, 0x67, 0x6e,
+ 0x20, 0x61, 0x6e, 0x20, 0x6f, 0x6e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x68, 0x61, 0x6e, 0x64,
+ 0x6c, 0x65, 0x72, 0x2e, 0x03, 0xff, 0xfe, 0x12, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e,
+ 0x67, 0x3e, 0x54, 0x65, 0x78, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x6f, 0x75, 0x74, 0x73,
+ 0x69, 0x64, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+ 0x2e, 0x02, 0x2f, 0x02, 0x21, 0x02, 0x3f, 0x16, 0x55, 0x6e, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65,
+ 0x64, 0x20, 0x3c, 0x16, 0x6f, 0x6e, 0x6f, 0x70, 0x65, 0x6e, 0x63, 0x64, 0x61, 0x74, 0x61, 0x04,
+ 0x2d, 0x2d, 0x56, 0x49, 0x6e, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x70, 0x72, 0x69, 0x61, 0x74, 0x65,
+ 0x6c, 0x79, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x64, 0x6f, 0x63, 0x74, 0x79,
+ 0x70, 0x65, 0x20, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x6f,
+ 0x6e, 0x73, 0x67, 0x6d, 0x6c, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+ 0x12, 0x6f, 0x6e, 0x64, 0x6f, 0x63, 0x74, 0x79, 0x70, 0x65, 0x02, 0x5b, 0x02, 0x5d, 0x02, 0x2d,
+ 0x12, 0x6f, 0x6e, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x4d, 0x61, 0x6c, 0x66, 0x6f,
+ 0x72, 0x6d, 0x65, 0x64, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x18, 0x6f, 0x6e, 0x63,
+ 0x6c, 0x6f, 0x73, 0x65, 0x63, 0x64, 0x61, 0x74, 0x61, 0x04, 0x5d, 0x5d, 0x2e, 0x6f, 0x6e, 0x70,
+ 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63,
+ 0x74, 0x69, 0x6f, 0x6e, 0x08, 0x62, 0x6f, 0x64, 0x79, 0x3a, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69,
+ 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x74,
+ 0x61, 0x67, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x5c, 0x46, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x2d,
+ 0x73, 0x6c, 0x61, 0x73, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x69, 0x6e, 0x67,
+ 0x20, 0x74, 0x61, 0x67, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
+ 0x64, 0x20, 0x62, 0x79, 0x20, 0x3e, 0x2c, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x61,
+ 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x02, 0x3d, 0x2e,
+ 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75,
+ 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x30, 0x55, 0x6e, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x64,
+ 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+ 0x40, 0x4e, 0x6f, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x62,
+ 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
+ 0x73, 0x3e, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x74, 0x61, 0x67, 0x6e, 0x61, 0x6d,
+ 0x65, 0x20, 0x69, 0x6e, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x61, 0x67,
+ 0x2e, 0x3c, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x74, 0x61, 0x67, 0x6e, 0x61, 0x6d,
+ 0x65, 0x20, 0x69, 0x6e, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x61, 0x67,
+ 0x42, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74,
+ 0x65, 0x72, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x74,
+ 0x61, 0x67, 0x40, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61,
+ 0x63, 0x74, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x20, 0x6e,
+ 0x61, 0x6d, 0x65, 0x1e, 0x55, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x74,
+ 0x65, 0x3a, 0x20, 0x24, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x46, 0x72, 0x6f, 0x6d, 0x43, 0x68,
+ 0x61, 0x72, 0x43, 0x6f, 0x64, 0x65, 0x0a, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x10, 0x4d, 0x41, 0x58,
+ 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x12, 0x63, 0x6f, 0x64, 0x65, 0x55, 0x6e, 0x69, 0x74, 0x73, 0x1a,
+ 0x68, 0x69, 0x67, 0x68, 0x53, 0x75, 0x72, 0x72, 0x6f, 0x67, 0x61, 0x74, 0x65, 0x18, 0x6c, 0x6f,
+ 0x77, 0x53, 0x75, 0x72, 0x72, 0x6f, 0x67, 0x61, 0x74, 0x65, 0x12, 0x63, 0x6f, 0x64, 0x65, 0x50,
+ 0x6f, 0x69, 0x6e, 0x74, 0x10, 0x69, 0x73, 0x46, 0x69, 0x6e, 0x69, 0x74, 0x65, 0x28, 0x49, 0x6e,
+ 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74,
+ 0x3a, 0x20, 0x0f, 0xc6, 0x03, 0x00, 0x05, 0x00, 0x00, 0xc8, 0x03, 0x00, 0x01, 0xca, 0x03, 0x00,
+ 0x03, 0xcc, 0x03, 0x00, 0x09, 0xce, 0x03, 0x00, 0x0a, 0xd0, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x20,
+ 0x06, 0x01, 0xa2, 0x01, 0x00, 0x01, 0x00, 0x13, 0x2b, 0x31, 0xa6, 0x1a, 0x01, 0xd2, 0x03, 0x07,
+ 0x00, 0x03, 0xc8, 0x03, 0x00, 0x0d, 0xca, 0x03, 0x01, 0x0d, 0xd4, 0x03, 0x02, 0x01, 0xcc, 0x03,
+ 0x03, 0x01, 0xd6, 0x03, 0x04, 0x01, 0xd8, 0x03, 0x05, 0x01, 0xda, 0x03, 0x06, 0x01, 0xdc, 0x03,
+ 0x07, 0x01, 0xde, 0x03, 0x08, 0x01, 0xce, 0x03, 0x09, 0x01, 0xd0, 0x03, 0x0a, 0x01, 0xe0, 0x03,
+ 0x0b, 0x01, 0xe2, 0x03, 0x0c, 0x01, 0xe4, 0x03, 0x0d, 0x01, 0xe6, 0x03, 0x0e, 0x01, 0xe8, 0x03,
+ 0x0f, 0x01, 0xea, 0x03, 0x10, 0x01, 0xec, 0x03, 0x11, 0x01, 0xee, 0x03, 0x12, 0x01, 0xf0, 0x03,
+ 0x13, 0x01, 0xf2, 0x03, 0x14, 0x01, 0xf4, 0x03, 0x15, 0x01, 0xf6, 0x03, 0x16, 0x01, 0xf8, 0x03,
+ 0x17, 0x01, 0xfa, 0x03, 0x18, 0x01, 0xfc, 0x03, 0x19, 0x01, 0xfe, 0x03, 0x1a, 0x01, 0x80, 0x04,
+ 0x1b, 0x01, 0x82, 0x04, 0x1c, 0x01, 0x84, 0x04, 0x1d, 0x01, 0x86, 0x04, 0x1e, 0x01, 0x88, 0x04,
+ 0x1f, 0x01, 0x8a, 0x04, 0x20, 0x01, 0x8c, 0x04, 0x21, 0x01, 0x8e, 0x04, 0x22, 0x01, 0x90, 0x04,
+ 0x23, 0x01, 0x92, 0x04, 0x24, 0x01, 0x94, 0x04, 0x25, 0x01, 0x96, 0x04, 0x26, 0x01, 0x98, 0x04,
+ 0x27, 0x01, 0x9a, 0x04, 0x28, 0x01, 0x9c, 0x04, 0x29, 0x01, 0x9e, 0x04, 0x2a, 0x01, 0x08, 0x6a,
+ 0x8a, 0x00, 0x00, 0x00, 0xc2, 0x01, 0xe6, 0xc2, 0x04, 0x5f, 0x04, 0x00, 0xc2, 0x05, 0x5f, 0x05,
+ 0x00, 0xc2, 0x06, 0x5f, 0x06, 0x00, 0xc2, 0x0d, 0x5f, 0x09, 0x00, 0xc2, 0x0e, 0x5f, 0x0a, 0x00,
+ 0xc2, 0x1a, 0x5f, 0x14, 0x00, 0xc2, 0x1b, 0x5f, 0x15, 0x00, 0xc2, 0x1c, 0x5f, 0x16, 0x00, 0xc2,
+ 0x1d, 0x5f, 0x17, 0x00, 0xc2, 0x1e, 0x5f, 0x18, 0x00, 0xc2, 0x20, 0x5f, 0x1b, 0x00, 0xc2, 0x21,
+ 0x5f, 0x1c, 0x00, 0xc2, 0x22, 0x5f, 0x1d, 0x00, 0xc2, 0x23, 0x5f, 0x1e, 0x00, 0xc2, 0x24, 0x5f,
+ 0x1f, 0x00, 0xc2, 0x25, 0x5f, 0x20, 0x00, 0xc2, 0x26, 0x5f, 0x21, 0x00, 0xc2, 0x27, 0x5f, 0x22,
+ 0x00, 0xc2, 0x28, 0x5f, 0x23, 0x00, 0xc2, 0x29, 0x5f, 0x24, 0x00, 0xc2, 0x2a, 0x5f, 0x25, 0x00,
+ 0xc2, 0x2b, 0x5f, 0x26, 0x00, 0xc2, 0x2c, 0x5f, 0x27, 0x00, 0xc2, 0x2d, 0x5f, 0x28, 0x00, 0xc2,
+ 0x2e, 0x5f, 0x29, 0x00, 0xc2, 0x2f, 0x5f, 0x2a, 0x00, 0x29, 0x0b, 0xe3, 0xc2, 0x00, 0x4d, 0xe5,
+ 0x00, 0x00, 0x00, 0xe4, 0x66, 0x00, 0x00, 0xe2, 0x43, 0xe6, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00,
+ 0x5e, 0x0a, 0x00, 0x43, 0xe8, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x5e, 0x09, 0x00, 0x43, 0xe7,
+ 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0xbf, 0x40, 0xc0, 0x00, 0x04, 0x9b, 0x43, 0x10, 0x01, 0x00,
+ 0x00, 0x04, 0x11, 0x01, 0x00, 0x00, 0x04, 0x12, 0x01, 0x00, 0x00, 0x04, 0x13, 0x01, 0x00, 0x00,
+ 0x04, 0x14, 0x01, 0x00, 0x00, 0x04, 0x15, 0x01, 0x00, 0x00, 0x04, 0x16, 0x01, 0x00, 0x00, 0x04,
+ 0x17, 0x01, 0x00, 0x00, 0x04, 0x18, 0x01, 0x00, 0x00, 0x04, 0x19, 0x01, 0x00, 0x00, 0x04, 0x1a,
+ 0x01, 0x00, 0x00, 0x04, 0x1b, 0x01, 0x00, 0x00, 0x04, 0x1c, 0x01, 0x00, 0x00, 0x26, 0x0c, 0x00,
+ 0xe5, 0x66, 0x00, 0x00, 0x04, 0x1d, 0x01, 0x00, 0x00, 0x04, 0x1e, 0x01, 0x00, 0x00, 0x04, 0x1f,
+ 0x01, 0x00, 0x00, 0x04, 0x15, 0x01, 0x00, 0x00, 0x04, 0x11, 0x01, 0x00, 0x00, 0x04, 0x20, 0x01,
+ 0x00, 0x00, 0x04, 0x21, 0x01, 0x00, 0x00, 0x04, 0x22, 0x01, 0x00, 0x00, 0x04, 0x23, 0x01, 0x00,
+ 0x00, 0x04, 0x24, 0x01, 0x00, 0x00, 0x04, 0x1b, 0x01, 0x00, 0x00, 0x04, 0x25, 0x01, 0x00, 0x00,
+ 0x04, 0x04, 0x01, 0x00, 0x00, 0x04, 0x05, 0x01, 0x00, 0x00, 0x04, 0x26, 0x01, 0x00, 0x00, 0x04,
+ 0x1c, 0x01, 0x00, 0x00, 0x04, 0x27, 0x01, 0x00, 0x00, 0x04, 0x28, 0x01, 0x00, 0x00, 0x26, 0x12,
+ 0x00, 0x43, 0x29, 0x01, 0x00, 0x00, 0x38, 0x97, 0x00, 0x00, 0x00, 0x41, 0x2a, 0x01, 0x00, 0x00,
+ 0x97, 0xec, 0x0d, 0x38, 0x97, 0x00, 0x00, 0x00, 0xc2, 0x02, 0x43, 0x2a, 0x01, 0x00, 0x00, 0x38,
+ 0x97, 0x00, 0x00, 0x00, 0x41, 0x2b, 0x01, 0x00, 0x00, 0x97, 0xec, 0x0d, 0x38, 0x97, 0x00, 0x00,
+ 0x00, 0xc2, 0x03, 0x43, 0x2b, 0x01, 0x00, 0x00, 0xe2, 0x0b, 0xc2, 0x07, 0x4d, 0x05, 0x01, 0x00,
+ 0x00, 0x4c, 0x05, 0x01, 0x00, 0x00, 0x5e, 0x2a, 0x00, 0x4c, 0x0f, 0x01, 0x00, 0x00, 0xc2, 0x08,
+ 0x4d, 0x2c, 0x01, 0x00, 0x00, 0x4c, 0x2c, 0x01, 0x00, 0x00, 0xc2, 0x09, 0x4d, 0x2d, 0x01, 0x00,
+ 0x00, 0x4c, 0x2d, 0x01, 0x00, 0x00, 0xc2, 0x0a, 0x4d, 0x2e, 0x01, 0x00, 0x00, 0x4c, 0x2e, 0x01,
+ 0x00, 0x00, 0x43, 0x3c, 0x00, 0x00, 0x00, 0x6d, 0x1a, 0x00, 0x00, 0x00, 0x38, 0x2f, 0x01, 0x00,
+ 0x00, 0x04, 0x30, 0x01, 0x00, 0x00, 0xf1, 0x41, 0xee, 0x00, 0x00, 0x00, 0x5f, 0x07, 0x00, 0x0e,
+ 0xee, 0x15, 0xcb, 0x6d, 0x11, 0x00, 0x00, 0x00, 0xc2, 0x0b, 0x4d, 0xee, 0x00, 0x00, 0x00, 0x5f,
+ 0x07, 0x00, 0x0e, 0xee, 0x02, 0x2f, 0x66, 0x00, 0x00, 0x41, 0x29, 0x01, 0x00, 0x00, 0x42, 0x31,
+ 0x01, 0x00, 0x00, 0xc2, 0x0c, 0x24, 0x01, 0x00, 0x5f, 0x08, 0x00, 0x5e, 0x0a, 0x00, 0x38, 0x97,
+ 0x00, 0x00, 0x00, 0x42, 0x2a, 0x01, 0x00, 0x00, 0x5e, 0x07, 0x00, 0x41, 0x3c, 0x00, 0x00, 0x00,
+ 0x0b, 0x0b, 0x5e, 0x0a, 0x00, 0x4c, 0x41, 0x00, 0x00, 0x00, 0x4c, 0x3d, 0x00, 0x00, 0x00, 0x24,
+ 0x02, 0x00, 0x43, 0x3c, 0x00, 0x00, 0x00, 0x5e, 0x0a, 0x00, 0x41, 0x3c, 0x00, 0x00, 0x00, 0xc2,
+ 0x0f, 0x43, 0x0f, 0x01, 0x00, 0x00, 0x5e, 0x0a, 0x00, 0x41, 0x3c, 0x00, 0x00, 0x00, 0xc2, 0x10,
+ 0x43, 0x05, 0x01, 0x00, 0x00, 0x5e, 0x0a, 0x00, 0x41, 0x3c, 0x00, 0x00, 0x00, 0xc2, 0x11, 0x43,
+ 0x32, 0x01, 0x00, 0x00, 0x04, 0x33, 0x01, 0x00, 0x00, 0x5f, 0x0b, 0x00, 0x04, 0xf1, 0x00, 0x00,
+ 0x00, 0x5f, 0x0c, 0x00, 0x04, 0x34, 0x01, 0x00, 0x00, 0x5f, 0x0d, 0x00, 0x04, 0x35, 0x01, 0x00,
+ 0x00, 0x5f, 0x0e, 0x00, 0x0b, 0x5e, 0x0d, 0x00, 0x4c, 0x36, 0x01, 0x00, 0x00, 0x5e, 0x0e, 0x00,
+ 0x4c, 0x37, 0x01, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0xc1, 0x12, 0xc1, 0x13, 0x33, 0x5f, 0x10, 0x00,
+ 0xc1, 0x14, 0xc1, 0x15, 0x33, 0x5f, 0x11, 0x00, 0xc1, 0x16, 0xc1, 0x17, 0x33, 0x5f, 0x12, 0x00,
+ 0xc1, 0x18, 0xc1, 0x19, 0x33, 0x5f, 0x13, 0x00, 0xb7, 0x5f, 0x19, 0x00, 0x66, 0x00, 0x00, 0x0b,
+ 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x38, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92,
+ 0x5f, 0x19, 0x00, 0x4c, 0x39, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c,
+ 0x3a, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x3b, 0x01, 0x00, 0x00,
+ 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x3c, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92,
+ 0x5f, 0x19, 0x00, 0x4c, 0x3d, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c,
+ 0x3e, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0xf1, 0x00, 0x00, 0x00,
+ 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x3f, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92,
+ 0x5f, 0x19, 0x00, 0x4c, 0x40, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c,
+ 0x41, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x42, 0x01, 0x00, 0x00,
+ 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x43, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92,
+ 0x5f, 0x19, 0x00, 0x4c, 0x44, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c,
+ 0x45, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0xf0, 0x00, 0x00, 0x00,
+ 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x46, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92,
+ 0x5f, 0x19, 0x00, 0x4c, 0x47, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c,
+ 0x48, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x49, 0x01, 0x00, 0x00,
+ 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x4a, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92,
+ 0x5f, 0x19, 0x00, 0x4c, 0x4b, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c,
+ 0x4c, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x4d, 0x01, 0x00, 0x00,
+ 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x4e, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92,
+ 0x5f, 0x19, 0x00, 0x4c, 0x4f, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c,
+ 0x50, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x51, 0x01, 0x00, 0x00,
+ 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x52, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92,
+ 0x5f, 0x19, 0x00, 0x4c, 0x53, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c,
+ 0x54, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x55, 0x01, 0x00, 0x00,
+ 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x56, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92,
+ 0x5f, 0x19, 0x00, 0x4c, 0x57, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c,
+ 0x58, 0x01, 0x00, 0x00, 0x5e, 0x19, 0x00, 0x92, 0x5f, 0x19, 0x00, 0x4c, 0x59, 0x01, 0x00, 0x00,
+ 0x43, 0x5a, 0x01, 0x00, 0x00, 0x66, 0x00, 0x00, 0x0b, 0x04, 0x5b, 0x01, 0x00, 0x00, 0x4c, 0x5c,
+ 0x01, 0x00, 0x00, 0x04, 0x5d, 0x01, 0x00, 0x00, 0x4c, 0x5e, 0x01, 0x00, 0x00, 0x04, 0x5f, 0x01,
+ 0x00, 0x00, 0x4c, 0x60, 0x01, 0x00, 0x00, 0x04, 0x61, 0x01, 0x00, 0x00, 0x4c, 0x62, 0x01, 0x00,
+ 0x00, 0x04, 0x63, 0x01, 0x00, 0x00, 0x4c, 0x64, 0x01, 0x00, 0x00, 0x43, 0x65, 0x01, 0x00, 0x00,
+ 0x66, 0x00, 0x00, 0x0b, 0x04, 0x5b, 0x01, 0x00, 0x00, 0x4c, 0x5c, 0x01, 0x00, 0x00, 0x04, 0x5d,
+ 0x01, 0x00, 0x00, 0x4c, 0x5e, 0x01, 0x00, 0x00, 0x04, 0x5f, 0x01, 0x00, 0x00, 0x4c, 0x60, 0x01,
+ 0x00, 0x00, 0x04, 0x61, 0x01, 0x00, 0x00, 0x4c, 0x62, 0x01, 0x00, 0x00, 0x04, 0x63, 0x01, 0x00,
+ 0x00, 0x4c, 0x64, 0x01, 0x00, 0x00, 0xc0, 0xc6, 0x00, 0x4c, 0x66, 0x01, 0x00, 0x00, 0xc0, 0xc1,
+ 0x00, 0x4c, 0x67, 0x01, 0x00, 0x00, 0xc0, 0xc2, 0x00, 0x4c, 0x68, 0x01, 0x00, 0x00, 0xc0, 0xc0,
+ 0x00, 0x4c, 0x69, 0x01, 0x00, 0x00, 0xc0, 0xc5, 0x00, 0x4c, 0x6a, 0x01, 0x00, 0x00, 0xc0, 0xc3,
+ 0x00, 0x4c, 0x6b, 0x01, 0x00, 0x00, 0xc0, 0xc4, 0x00, 0x4c, 0x6c, 0x01, 0x00, 0x00, 0xc0, 0xc7,
+ 0x00, 0x4c, 0x6d, 0x01, 0x00, 0x00, 0xc0, 0xd0, 0x00, 0x4c, 0x6e, 0x01, 0x00, 0x00, 0xc0, 0xc9,
+ 0x00, 0x4c, 0x6f, 0x01, 0x00, 0x00, 0xc0, 0xca, 0x00, 0x4c, 0x70, 0x01, 0x00, 0x00, 0xc0, 0xc8,
+ 0x00, 0x4c, 0x71, 0x01, 0x00, 0x00, 0xc0, 0xcb, 0x00, 0x4c, 0x72, 0x01, 0x00, 0x00, 0xc0, 0xcd,
+ 0x00, 0x4c, 0x73, 0x01, 0x00, 0x00, 0xc0, 0xce, 0x00, 0x4c, 0x74, 0x01, 0x00, 0x00, 0xc0, 0xcc,
+ 0x00, 0x4c, 0x75, 0x01, 0x00, 0x00, 0xc0, 0xcf, 0x00, 0x4c, 0x76, 0x01, 0x00, 0x00, 0xc0, 0xd1,
+ 0x00, 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc0, 0xd3, 0x00, 0x4c, 0x78, 0x01, 0x00, 0x00, 0xc0, 0xd4,
+ 0x00, 0x4c, 0x79, 0x01, 0x00, 0x00, 0xc0, 0xd2, 0x00, 0x4c, 0x7a, 0x01, 0x00, 0x00, 0xc0, 0xd8,
+ 0x00, 0x4c, 0x7b, 0x01, 0x00, 0x00, 0xc0, 0xd5, 0x00, 0x4c, 0x7c, 0x01, 0x00, 0x00, 0xc0, 0xd6,
+ 0x00, 0x4c, 0x7d, 0x01, 0x00, 0x00, 0xc0, 0xde, 0x00, 0x4c, 0x7e, 0x01, 0x00, 0x00, 0xc0, 0xda,
+ 0x00, 0x4c, 0x7f, 0x01, 0x00, 0x00, 0xc0, 0xdb, 0x00, 0x4c, 0x80, 0x01, 0x00, 0x00, 0xc0, 0xd9,
+ 0x00, 0x4c, 0x81, 0x01, 0x00, 0x00, 0xc0, 0xdc, 0x00, 0x4c, 0x82, 0x01, 0x00, 0x00, 0xc0, 0xdd,
+ 0x00, 0x4c, 0x83, 0x01, 0x00, 0x00, 0xc0, 0xe1, 0x00, 0x4c, 0x84, 0x01, 0x00, 0x00, 0xc0, 0xe2,
+ 0x00, 0x4c, 0x85, 0x01, 0x00, 0x00, 0xc0, 0xe6, 0x00, 0x4c, 0x86, 0x01, 0x00, 0x00, 0xc0, 0xe0,
+ 0x00, 0x4c, 0x87, 0x01, 0x00, 0x00, 0xc0, 0xe5, 0x00, 0x4c, 0x88, 0x01, 0x00, 0x00, 0xc0, 0xe3,
+ 0x00, 0x4c, 0x89, 0x01, 0x00, 0x00, 0xc0, 0xe4, 0x00, 0x4c, 0x8a, 0x01, 0x00, 0x00, 0xc0, 0xe7,
+ 0x00, 0x4c, 0x8b, 0x01, 0x00, 0x00, 0xc0, 0xe9, 0x00, 0x4c, 0x8c, 0x01, 0x00, 0x00, 0xc0, 0xea,
+ 0x00, 0x4c, 0x8d, 0x01, 0x00, 0x00, 0xc0, 0xe8, 0x00, 0x4c, 0x8e, 0x01, 0x00, 0x00, 0xc0, 0xf0,
+ 0x00, 0x4c, 0x8f, 0x01, 0x00, 0x00, 0xc0, 0xeb, 0x00, 0x4c, 0x90, 0x01, 0x00, 0x00, 0xc0, 0xed,
+ 0x00, 0x4c, 0x91, 0x01, 0x00, 0x00, 0xc0, 0xee, 0x00, 0x4c, 0x92, 0x01, 0x00, 0x00, 0xc0, 0xec,
+ 0x00, 0x4c, 0x93, 0x01, 0x00, 0x00, 0xc0, 0xef, 0x00, 0x4c, 0x94, 0x01, 0x00, 0x00, 0xc0, 0xf1,
+ 0x00, 0x4c, 0x95, 0x01, 0x00, 0x00, 0xc0, 0xf3, 0x00, 0x4c, 0x96, 0x01, 0x00, 0x00, 0xc0, 0xf4,
+ 0x00, 0x4c, 0x97, 0x01, 0x00, 0x00, 0xc0, 0xf2, 0x00, 0x4c, 0x98, 0x01, 0x00, 0x00, 0xc0, 0xf8,
+ 0x00, 0x4c, 0x99, 0x01, 0x00, 0x00, 0xc0, 0xf5, 0x00, 0x4c, 0x9a, 0x01, 0x00, 0x00, 0xc0, 0xf6,
+ 0x00, 0x4c, 0x9b, 0x01, 0x00, 0x00, 0xc0, 0xdf, 0x00, 0x4c, 0x9c, 0x01, 0x00, 0x00, 0xc0, 0xfe,
+ 0x00, 0x4c, 0x9d, 0x01, 0x00, 0x00, 0xc0, 0xfa, 0x00, 0x4c, 0x9e, 0x01, 0x00, 0x00, 0xc0, 0xfb,
+ 0x00, 0x4c, 0x9f, 0x01, 0x00, 0x00, 0xc0, 0xf9, 0x00, 0x4c, 0xa0, 0x01, 0x00, 0x00, 0xc0, 0xfc,
+ 0x00, 0x4c, 0xa1, 0x01, 0x00, 0x00, 0xc0, 0xfd, 0x00, 0x4c, 0xa2, 0x01, 0x00, 0x00, 0xc0, 0xff,
+ 0x00, 0x4c, 0xa3, 0x01, 0x00, 0x00, 0xc0, 0xa9, 0x00, 0x4c, 0xa4, 0x01, 0x00, 0x00, 0xc0, 0xae,
+ 0x00, 0x4c, 0xa5, 0x01, 0x00, 0x00, 0xc0, 0xa0, 0x00, 0x4c, 0xa6, 0x01, 0x00, 0x00, 0xc0, 0xa1,
+ 0x00, 0x4c, 0xa7, 0x01, 0x00, 0x00, 0xc0, 0xa2, 0x00, 0x4c, 0xa8, 0x01, 0x00, 0x00, 0xc0, 0xa3,
+ 0x00, 0x4c, 0xa9, 0x01, 0x00, 0x00, 0xc0, 0xa4, 0x00, 0x4c, 0xaa, 0x01, 0x00, 0x00, 0xc0, 0xa5,
+ 0x00, 0x4c, 0xab, 0x01, 0x00, 0x00, 0xc0, 0xa6, 0x00, 0x4c, 0xac, 0x01, 0x00, 0x00, 0xc0, 0xa7,
+ 0x00, 0x4c, 0xad, 0x01, 0x00, 0x00, 0xc0, 0xa8, 0x00, 0x4c, 0xae, 0x01, 0x00, 0x00, 0xc0, 0xaa,
+ 0x00, 0x4c, 0xaf, 0x01, 0x00, 0x00, 0xc0, 0xab, 0x00, 0x4c, 0xb0, 0x01, 0x00, 0x00, 0xc0, 0xac,
+ 0x00, 0x4c, 0xb1, 0x01, 0x00, 0x00, 0xc0, 0xad, 0x00, 0x4c, 0xb2, 0x01, 0x00, 0x00, 0xc0, 0xaf,
+ 0x00, 0x4c, 0xb3, 0x01, 0x00, 0x00, 0xc0, 0xb0, 0x00, 0x4c, 0xb4, 0x01, 0x00, 0x00, 0xc0, 0xb1,
+ 0x00, 0x4c, 0xb5, 0x01, 0x00, 0x00, 0xc0, 0xb9, 0x00, 0x4c, 0xb6, 0x01, 0x00, 0x00, 0xc0, 0xb2,
+ 0x00, 0x4c, 0xb7, 0x01, 0x00, 0x00, 0xc0, 0xb3, 0x00, 0x4c, 0xb8, 0x01, 0x00, 0x00, 0xc0, 0xb4,
+ 0x00, 0x4c, 0xb9, 0x01, 0x00, 0x00, 0xc0, 0xb5, 0x00, 0x4c, 0xba, 0x01, 0x00, 0x00, 0xc0, 0xb6,
+ 0x00, 0x4c, 0xbb, 0x01, 0x00, 0x00, 0xc0, 0xb7, 0x00, 0x4c, 0xbc, 0x01, 0x00, 0x00, 0xc0, 0xb8,
+ 0x00, 0x4c, 0xbd, 0x01, 0x00, 0x00, 0xc0, 0xba, 0x00, 0x4c, 0xbe, 0x01, 0x00, 0x00, 0xc0, 0xbb,
+ 0x00, 0x4c, 0xbf, 0x01, 0x00, 0x00, 0xc0, 0xbc, 0x00, 0x4c, 0xc0, 0x01, 0x00, 0x00, 0xc0, 0xbd,
+ 0x00, 0x4c, 0xc1, 0x01, 0x00, 0x00, 0xc0, 0xbe, 0x00, 0x4c, 0xc2, 0x01, 0x00, 0x00, 0xc0, 0xbf,
+ 0x00, 0x4c, 0xc3, 0x01, 0x00, 0x00, 0xc0, 0xd7, 0x00, 0x4c, 0xc4, 0x01, 0x00, 0x00, 0xc0, 0xf7,
+ 0x00, 0x4c, 0xc5, 0x01, 0x00, 0x00, 0xc0, 0x52, 0x01, 0x4c, 0xc6, 0x01, 0x00, 0x00, 0xc0, 0x53,
+ 0x01, 0x4c, 0xc7, 0x01, 0x00, 0x00, 0xc0, 0x60, 0x01, 0x4c, 0xc8, 0x01, 0x00, 0x00, 0xc0, 0x61,
+ 0x01, 0x4c, 0xc9, 0x01, 0x00, 0x00, 0xc0, 0x78, 0x01, 0x4c, 0xca, 0x01, 0x00, 0x00, 0xc0, 0x92,
+ 0x01, 0x4c, 0xcb, 0x01, 0x00, 0x00, 0xc0, 0xc6, 0x02, 0x4c, 0xcc, 0x01, 0x00, 0x00, 0xc0, 0xdc,
+ 0x02, 0x4c, 0xcd, 0x01, 0x00, 0x00, 0xc0, 0x91, 0x03, 0x4c, 0xce, 0x01, 0x00, 0x00, 0xc0, 0x92,
+ 0x03, 0x4c, 0xcf, 0x01, 0x00, 0x00, 0xc0, 0x93, 0x03, 0x4c, 0xd0, 0x01, 0x00, 0x00, 0xc0, 0x94,
+ 0x03, 0x4c, 0xd1, 0x01, 0x00, 0x00, 0xc0, 0x95, 0x03, 0x4c, 0xd2, 0x01, 0x00, 0x00, 0xc0, 0x96,
+ 0x03, 0x4c, 0xd3, 0x01, 0x00, 0x00, 0xc0, 0x97, 0x03, 0x4c, 0xd4, 0x01, 0x00, 0x00, 0xc0, 0x98,
+ 0x03, 0x4c, 0xd5, 0x01, 0x00, 0x00, 0xc0, 0x99, 0x03, 0x4c, 0xd6, 0x01, 0x00, 0x00, 0xc0, 0x9a,
+ 0x03, 0x4c, 0xd7, 0x01, 0x00, 0x00, 0xc0, 0x9b, 0x03, 0x4c, 0xd8, 0x01, 0x00, 0x00, 0xc0, 0x9c,
+ 0x03, 0x4c, 0xd9, 0x01, 0x00, 0x00, 0xc0, 0x9d, 0x03, 0x4c, 0xda, 0x01, 0x00, 0x00, 0xc0, 0x9e,
+ 0x03, 0x4c, 0xdb, 0x01, 0x00, 0x00, 0xc0, 0x9f, 0x03, 0x4c, 0xdc, 0x01, 0x00, 0x00, 0xc0, 0xa0,
+ 0x03, 0x4c, 0xdd, 0x01, 0x00, 0x00, 0xc0, 0xa1, 0x03, 0x4c, 0xde, 0x01, 0x00, 0x00, 0xc0, 0xa3,
+ 0x03, 0x4c, 0xdf, 0x01, 0x00, 0x00, 0xc0, 0xa4, 0x03, 0x4c, 0xe0, 0x01, 0x00, 0x00, 0xc0, 0xa5,
+ 0x03, 0x4c, 0xe1, 0x01, 0x00, 0x00, 0xc0, 0xa6, 0x03, 0x4c, 0xe2, 0x01, 0x00, 0x00, 0xc0, 0xa7,
+ 0x03, 0x4c, 0xe3, 0x01, 0x00, 0x00, 0xc0, 0xa8, 0x03, 0x4c, 0xe4, 0x01, 0x00, 0x00, 0xc0, 0xa9,
+ 0x03, 0x4c, 0xe5, 0x01, 0x00, 0x00, 0xc0, 0xb1, 0x03, 0x4c, 0xe6, 0x01, 0x00, 0x00, 0xc0, 0xb2,
+ 0x03, 0x4c, 0xe7, 0x01, 0x00, 0x00, 0xc0, 0xb3, 0x03, 0x4c, 0xe8, 0x01, 0x00, 0x00, 0xc0, 0xb4,
+ 0x03, 0x4c, 0xe9, 0x01, 0x00, 0x00, 0xc0, 0xb5, 0x03, 0x4c, 0xea, 0x01, 0x00, 0x00, 0xc0, 0xb6,
+ 0x03, 0x4c, 0xeb, 0x01, 0x00, 0x00, 0xc0, 0xb7, 0x03, 0x4c, 0xec, 0x01, 0x00, 0x00, 0xc0, 0xb8,
+ 0x03, 0x4c, 0xed, 0x01, 0x00, 0x00, 0xc0, 0xb9, 0x03, 0x4c, 0xee, 0x01, 0x00, 0x00, 0xc0, 0xba,
+ 0x03, 0x4c, 0xef, 0x01, 0x00, 0x00, 0xc0, 0xbb, 0x03, 0x4c, 0xf0, 0x01, 0x00, 0x00, 0xc0, 0xbc,
+ 0x03, 0x4c, 0xf1, 0x01, 0x00, 0x00, 0xc0, 0xbd, 0x03, 0x4c, 0xf2, 0x01, 0x00, 0x00, 0xc0, 0xbe,
+ 0x03, 0x4c, 0xf3, 0x01, 0x00, 0x00, 0xc0, 0xbf, 0x03, 0x4c, 0xf4, 0x01, 0x00, 0x00, 0xc0, 0xc0,
+ 0x03, 0x4c, 0xf5, 0x01, 0x00, 0x00, 0xc0, 0xc1, 0x03, 0x4c, 0xf6, 0x01, 0x00, 0x00, 0xc0, 0xc2,
+ 0x03, 0x4c, 0xf7, 0x01, 0x00, 0x00, 0xc0, 0xc3, 0x03, 0x4c, 0xf8, 0x01, 0x00, 0x00, 0xc0, 0xc4,
+ 0x03, 0x4c, 0xf9, 0x01, 0x00, 0x00, 0xc0, 0xc5, 0x03, 0x4c, 0xfa, 0x01, 0x00, 0x00, 0xc0, 0xc6,
+ 0x03, 0x4c, 0xfb, 0x01, 0x00, 0x00, 0xc0, 0xc7, 0x03, 0x4c, 0xfc, 0x01, 0x00, 0x00, 0xc0, 0xc8,
+ 0x03, 0x4c, 0xfd, 0x01, 0x00, 0x00, 0xc0, 0xc9, 0x03, 0x4c, 0xfe, 0x01, 0x00, 0x00, 0xc0, 0xd1,
+ 0x03, 0x4c, 0xff, 0x01, 0x00, 0x00, 0xc0, 0xd2, 0x03, 0x4c, 0x00, 0x02, 0x00, 0x00, 0xc0, 0xd6,
+ 0x03, 0x4c, 0x01, 0x02, 0x00, 0x00, 0xc0, 0x02, 0x20, 0x4c, 0x02, 0x02, 0x00, 0x00, 0xc0, 0x03,
+ 0x20, 0x4c, 0x03, 0x02, 0x00, 0x00, 0xc0, 0x09, 0x20, 0x4c, 0x04, 0x02, 0x00, 0x00, 0xc0, 0x0c,
+ 0x20, 0x4c, 0x05, 0x02, 0x00, 0x00, 0xc0, 0x0d, 0x20, 0x4c, 0x06, 0x02, 0x00, 0x00, 0xc0, 0x0e,
+ 0x20, 0x4c, 0x07, 0x02, 0x00, 0x00, 0xc0, 0x0f, 0x20, 0x4c, 0x08, 0x02, 0x00, 0x00, 0xc0, 0x13,
+ 0x20, 0x4c, 0x09, 0x02, 0x00, 0x00, 0xc0, 0x14, 0x20, 0x4c, 0x0a, 0x02, 0x00, 0x00, 0xc0, 0x18,
+ 0x20, 0x4c, 0x0b, 0x02, 0x00, 0x00, 0xc0, 0x19, 0x20, 0x4c, 0x0c, 0x02, 0x00, 0x00, 0xc0, 0x1a,
+ 0x20, 0x4c, 0x0d, 0x02, 0x00, 0x00, 0xc0, 0x1c, 0x20, 0x4c, 0x0e, 0x02, 0x00, 0x00, 0xc0, 0x1d,
+ 0x20, 0x4c, 0x0f, 0x02, 0x00, 0x00, 0xc0, 0x1e, 0x20, 0x4c, 0x10, 0x02, 0x00, 0x00, 0xc0, 0x20,
+ 0x20, 0x4c, 0x11, 0x02, 0x00, 0x00, 0xc0, 0x21, 0x20, 0x4c, 0x12, 0x02, 0x00, 0x00, 0xc0, 0x22,
+ 0x20, 0x4c, 0x13, 0x02, 0x00, 0x00, 0xc0, 0x26, 0x20, 0x4c, 0x14, 0x02, 0x00, 0x00, 0xc0, 0x30,
+ 0x20, 0x4c, 0x15, 0x02, 0x00, 0x00, 0xc0, 0x32, 0x20, 0x4c, 0x16, 0x02, 0x00, 0x00, 0xc0, 0x33,
+ 0x20, 0x4c, 0x17, 0x02, 0x00, 0x00, 0xc0, 0x39, 0x20, 0x4c, 0x18, 0x02, 0x00, 0x00, 0xc0, 0x3a,
+ 0x20, 0x4c, 0x19, 0x02, 0x00, 0x00, 0xc0, 0x3e, 0x20, 0x4c, 0x1a, 0x02, 0x00, 0x00, 0xc0, 0x44,
+ 0x20, 0x4c, 0x1b, 0x02, 0x00, 0x00, 0xc0, 0xac, 0x20, 0x4c, 0x1c, 0x02, 0x00, 0x00, 0xc0, 0x11,
+ 0x21, 0x4c, 0x1d, 0x02, 0x00, 0x00, 0xc0, 0x18, 0x21, 0x4c, 0x1e, 0x02, 0x00, 0x00, 0xc0, 0x1c,
+ 0x21, 0x4c, 0x1f, 0x02, 0x00, 0x00, 0xc0, 0x22, 0x21, 0x4c, 0x20, 0x02, 0x00, 0x00, 0xc0, 0x35,
+ 0x21, 0x4c, 0x21, 0x02, 0x00, 0x00, 0xc0, 0x90, 0x21, 0x4c, 0x22, 0x02, 0x00, 0x00, 0xc0, 0x91,
+ 0x21, 0x4c, 0x23, 0x02, 0x00, 0x00, 0xc0, 0x92, 0x21, 0x4c, 0x24, 0x02, 0x00, 0x00, 0xc0, 0x93,
+ 0x21, 0x4c, 0x25, 0x02, 0x00, 0x00, 0xc0, 0x94, 0x21, 0x4c, 0x26, 0x02, 0x00, 0x00, 0xc0, 0xb5,
+ 0x21, 0x4c, 0x27, 0x02, 0x00, 0x00, 0xc0, 0xd0, 0x21, 0x4c, 0x28, 0x02, 0x00, 0x00, 0xc0, 0xd1,
+ 0x21, 0x4c, 0x29, 0x02, 0x00, 0x00, 0xc0, 0xd2, 0x21, 0x4c, 0x2a, 0x02, 0x00, 0x00, 0xc0, 0xd3,
+ 0x21, 0x4c, 0x2b, 0x02, 0x00, 0x00, 0xc0, 0xd4, 0x21, 0x4c, 0x2c, 0x02, 0x00, 0x00, 0xc0, 0x00,
+ 0x22, 0x4c, 0x2d, 0x02, 0x00, 0x00, 0xc0, 0x02, 0x22, 0x4c, 0x2e, 0x02, 0x00, 0x00, 0xc0, 0x03,
+ 0x22, 0x4c, 0x2f, 0x02, 0x00, 0x00, 0xc0, 0x05, 0x22, 0x4c, 0x30, 0x02, 0x00, 0x00, 0xc0, 0x07,
+ 0x22, 0x4c, 0x31, 0x02, 0x00, 0x00, 0xc0, 0x08, 0x22, 0x4c, 0x32, 0x02, 0x00, 0x00, 0xc0, 0x09,
+ 0x22, 0x4c, 0x33, 0x02, 0x00, 0x00, 0xc0, 0x0b, 0x22, 0x4c, 0x34, 0x02, 0x00, 0x00, 0xc0, 0x0f,
+ 0x22, 0x4c, 0x35, 0x02, 0x00, 0x00, 0xc0, 0x11, 0x22, 0x4c, 0x36, 0x02, 0x00, 0x00, 0xc0, 0x12,
+ 0x22, 0x4c, 0x37, 0x02, 0x00, 0x00, 0xc0, 0x17, 0x22, 0x4c, 0x38, 0x02, 0x00, 0x00, 0xc0, 0x1a,
+ 0x22, 0x4c, 0x39, 0x02, 0x00, 0x00, 0xc0, 0x1d, 0x22, 0x4c, 0x3a, 0x02, 0x00, 0x00, 0xc0, 0x1e,
+ 0x22, 0x4c, 0x3b, 0x02, 0x00, 0x00, 0xc0, 0x20, 0x22, 0x4c, 0x3c, 0x02, 0x00, 0x00, 0xc0, 0x27,
+ 0x22, 0x4c, 0x3d, 0x02, 0x00, 0x00, 0xc0, 0x28, 0x22, 0x4c, 0x3e, 0x02, 0x00, 0x00, 0xc0, 0x29,
+ 0x22, 0x4c, 0x3f, 0x02, 0x00, 0x00, 0xc0, 0x2a, 0x22, 0x4c, 0x40, 0x02, 0x00, 0x00, 0xc0, 0x2b,
+ 0x22, 0x4c, 0x41, 0x02, 0x00, 0x00, 0xc0, 0x34, 0x22, 0x4c, 0x42, 0x02, 0x00, 0x00, 0xc0, 0x3c,
+ 0x22, 0x4c, 0x43, 0x02, 0x00, 0x00, 0xc0, 0x45, 0x22, 0x4c, 0x44, 0x02, 0x00, 0x00, 0xc0, 0x48,
+ 0x22, 0x4c, 0x45, 0x02, 0x00, 0x00, 0xc0, 0x60, 0x22, 0x4c, 0x46, 0x02, 0x00, 0x00, 0xc0, 0x61,
+ 0x22, 0x4c, 0x47, 0x02, 0x00, 0x00, 0xc0, 0x64, 0x22, 0x4c, 0x48, 0x02, 0x00, 0x00, 0xc0, 0x65,
+ 0x22, 0x4c, 0x49, 0x02, 0x00, 0x00, 0xc0, 0x82, 0x22, 0x4c, 0x4a, 0x02, 0x00, 0x00, 0xc0, 0x83,
+ 0x22, 0x4c, 0x4b, 0x02, 0x00, 0x00, 0xc0, 0x84, 0x22, 0x4c, 0x4c, 0x02, 0x00, 0x00, 0xc0, 0x86,
+ 0x22, 0x4c, 0x4d, 0x02, 0x00, 0x00, 0xc0, 0x87, 0x22, 0x4c, 0x4e, 0x02, 0x00, 0x00, 0xc0, 0x95,
+ 0x22, 0x4c, 0x4f, 0x02, 0x00, 0x00, 0xc0, 0x97, 0x22, 0x4c, 0x50, 0x02, 0x00, 0x00, 0xc0, 0xa5,
+ 0x22, 0x4c, 0x51, 0x02, 0x00, 0x00, 0xc0, 0xc5, 0x22, 0x4c, 0x52, 0x02, 0x00, 0x00, 0xc0, 0x08,
+ 0x23, 0x4c, 0x53, 0x02, 0x00, 0x00, 0xc0, 0x09, 0x23, 0x4c, 0x54, 0x02, 0x00, 0x00, 0xc0, 0x0a,
+ 0x23, 0x4c, 0x55, 0x02, 0x00, 0x00, 0xc0, 0x0b, 0x23, 0x4c, 0x56, 0x02, 0x00, 0x00, 0xc0, 0x29,
+ 0x23, 0x4c, 0x57, 0x02, 0x00, 0x00, 0xc0, 0x2a, 0x23, 0x4c, 0x58, 0x02, 0x00, 0x00, 0xc0, 0xca,
+ 0x25, 0x4c, 0x59, 0x02, 0x00, 0x00, 0xc0, 0x60, 0x26, 0x4c, 0x5a, 0x02, 0x00, 0x00, 0xc0, 0x63,
+ 0x26, 0x4c, 0x5b, 0x02, 0x00, 0x00, 0xc0, 0x65, 0x26, 0x4c, 0x5c, 0x02, 0x00, 0x00, 0xc0, 0x66,
+ 0x26, 0x4c, 0x5d, 0x02, 0x00, 0x00, 0x43, 0x5e, 0x02, 0x00, 0x00, 0x38, 0x97, 0x00, 0x00, 0x00,
+ 0x42, 0x2b, 0x01, 0x00, 0x00, 0x66, 0x00, 0x00, 0x41, 0x5e, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x42, 0x5f, 0x02, 0x00, 0x00, 0xc2, 0x1f, 0x24, 0x01, 0x00, 0x0e, 0x66, 0x00, 0x00, 0x41, 0x5a,
+ 0x01, 0x00, 0x00, 0x7e, 0xee, 0x1c, 0x5f, 0x1a, 0x00, 0x66, 0x00, 0x00, 0x41, 0x5a, 0x01, 0x00,
+ 0x00, 0x66, 0x00, 0x00, 0x41, 0x5a, 0x01, 0x00, 0x00, 0x5e, 0x1a, 0x00, 0x47, 0x5e, 0x1a, 0x00,
+ 0x49, 0x81, 0xec, 0xe3, 0x0e, 0x0e, 0x66, 0x00, 0x00, 0x41, 0x5a, 0x01, 0x00, 0x00, 0x5f, 0x19,
+ 0x00, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x41, 0x60, 0x02, 0x00, 0x00, 0x97, 0xec, 0x05, 0xc2, 0x30,
+ 0xf0, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x01, 0xa0, 0x03, 0x01, 0x00, 0x8c, 0x01, 0x02, 0x0e, 0x2c,
+ 0x30, 0x3a, 0x00, 0x0b, 0x16, 0x4a, 0x1c, 0x80, 0x67, 0x44, 0x09, 0x2b, 0x1c, 0x1c, 0x1c, 0x1c,
+ 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x12, 0x00, 0x05,
+ 0x5a, 0x44, 0x00, 0x05, 0x0a, 0x28, 0x44, 0x00, 0x05, 0x08, 0x00, 0x07, 0x72, 0x0d, 0x3f, 0x2b,
+ 0x3f, 0x3f, 0x3f, 0x1e, 0x1c, 0x62, 0x30, 0x35, 0x18, 0x45, 0x00, 0x08, 0x68, 0x71, 0x08, 0x2b,
+ 0x1c, 0x2c, 0x00, 0x08, 0x1c, 0x27, 0x00, 0x08, 0x0c, 0x27, 0x00, 0x08, 0x16, 0x00, 0x07, 0x08,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x00, 0x14, 0x10, 0x2c, 0x2c, 0x2b, 0x00, 0x08, 0x2c, 0x17, 0x17, 0x3f,
+ 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+ 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+ 0x3f, 0x3f, 0x3f, 0x1d, 0x17, 0x35, 0x35, 0x35, 0x35, 0x35, 0x1d, 0x17, 0x35, 0x35, 0x35, 0x35,
+ 0x35, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+ 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x1d, 0x00, 0x1a, 0x08, 0x22, 0x49, 0x7b,
+ 0x1e, 0x00, 0x0b, 0xf8, 0x0d, 0x00, 0x0d, 0x66, 0x17, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x02, 0x00,
+ 0x02, 0x04, 0x01, 0x00, 0x08, 0x02, 0xc2, 0x09, 0x00, 0x01, 0x00, 0xc4, 0x09, 0x00, 0x01, 0x00,
+ 0xcc, 0x03, 0x03, 0x00, 0xdf, 0x11, 0xd3, 0xd4, 0x21, 0x02, 0x00, 0x28, 0xc6, 0x03, 0x03, 0x00,
+ 0x0e, 0x43, 0x06, 0x01, 0xcc, 0x03, 0x02, 0x02, 0x02, 0x05, 0x06, 0x00, 0xc4, 0x03, 0x04, 0xc2,
+ 0x09, 0x00, 0x01, 0x00, 0xc4, 0x09, 0x00, 0x01, 0x00, 0xca, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00,
+ 0x01, 0x00, 0xcc, 0x03, 0x03, 0x00, 0xd8, 0x03, 0x05, 0x00, 0xc8, 0x03, 0x00, 0x0c, 0xfc, 0x03,
+ 0x19, 0x00, 0xe8, 0x03, 0x0f, 0x00, 0x80, 0x04, 0x1b, 0x00, 0x08, 0xcc, 0xc8, 0xdf, 0xa8, 0x97,
+ 0xec, 0x09, 0xdf, 0x11, 0xd3, 0xd4, 0x21, 0x02, 0x00, 0x28, 0xc8, 0x38, 0x46, 0x00, 0x00, 0x00,
+ 0x43, 0x63, 0x02, 0x00, 0x00, 0xc8, 0x38, 0x46, 0x00, 0x00, 0x00, 0x43, 0x64, 0x02, 0x00, 0x00,
+ 0xc8, 0x38, 0x46, 0x00, 0x00, 0x00, 0x43, 0x65, 0x02, 0x00, 0x00, 0xc8, 0x38, 0x46, 0x00, 0x00,
+ 0x00, 0x43, 0x66, 0x02, 0x00, 0x00, 0xc8, 0x38, 0x46, 0x00, 0x00, 0x00, 0x43, 0x67, 0x02, 0x00,
+ 0x00, 0xc8, 0xcb, 0xe0, 0xc7, 0xf1, 0x0e, 0xc7, 0xc7, 0xc3, 0x15, 0x43, 0x68, 0x02, 0x00, 0x00,
+ 0x43, 0x69, 0x02, 0x00, 0x00, 0xc7, 0x66, 0x02, 0x00, 0x41, 0x10, 0x01, 0x00, 0x00, 0x43, 0x6a,
+ 0x02, 0x00, 0x00, 0xc7, 0xd4, 0x11, 0xed, 0x03, 0x0e, 0x0b, 0x43, 0x62, 0x02, 0x00, 0x00, 0xc7,
+ 0x41, 0x62, 0x02, 0x00, 0x00, 0xc7, 0x41, 0x62, 0x02, 0x00, 0x00, 0x41, 0x6b, 0x02, 0x00, 0x00,
+ 0x11, 0xed, 0x0d, 0x0e, 0xc7, 0x41, 0x62, 0x02, 0x00, 0x00, 0x41, 0x6c, 0x02, 0x00, 0x00, 0x43,
+ 0x6b, 0x02, 0x00, 0x00, 0xc7, 0xc7, 0x41, 0x62, 0x02, 0x00, 0x00, 0x41, 0x6b, 0x02, 0x00, 0x00,
+ 0xec, 0x08, 0x04, 0x6d, 0x02, 0x00, 0x00, 0xee, 0x06, 0x04, 0x6e, 0x02, 0x00, 0x00, 0x43, 0x6f,
+ 0x02, 0x00, 0x00, 0xc7, 0x26, 0x00, 0x00, 0x43, 0x70, 0x02, 0x00, 0x00, 0xc7, 0xc7, 0xc7, 0x09,
+ 0x15, 0x43, 0x71, 0x02, 0x00, 0x00, 0x15, 0x43, 0x72, 0x02, 0x00, 0x00, 0x43, 0x73, 0x02, 0x00,
+ 0x00, 0xc7, 0xc7, 0x07, 0x15, 0x43, 0x04, 0x01, 0x00, 0x00, 0x43, 0x74, 0x02, 0x00, 0x00, 0xc7,
+ 0xd3, 0x97, 0x97, 0x43, 0x61, 0x02, 0x00, 0x00, 0xc7, 0xd3, 0x11, 0xed, 0x0d, 0x0e, 0xc7, 0x41,
+ 0x62, 0x02, 0x00, 0x00, 0x41, 0x75, 0x02, 0x00, 0x00, 0x97, 0x97, 0x43, 0x75, 0x02, 0x00, 0x00,
+ 0xc7, 0xe2, 0x41, 0x38, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7, 0xc7, 0x41, 0x62,
+ 0x02, 0x00, 0x00, 0x41, 0x77, 0x02, 0x00, 0x00, 0x43, 0x77, 0x02, 0x00, 0x00, 0xc7, 0xc7, 0x41,
+ 0x77, 0x02, 0x00, 0x00, 0xec, 0x18, 0x38, 0x97, 0x00, 0x00, 0x00, 0x42, 0x2a, 0x01, 0x00, 0x00,
+ 0x66, 0x02, 0x00, 0x41, 0x65, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xee, 0x16, 0x38, 0x97, 0x00,
+ 0x00, 0x00, 0x42, 0x2a, 0x01, 0x00, 0x00, 0x66, 0x02, 0x00, 0x41, 0x5e, 0x02, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x43, 0x5e, 0x02, 0x00, 0x00, 0xc7, 0x26, 0x00, 0x00, 0x43, 0x78, 0x02, 0x00, 0x00,
+ 0xc7, 0x41, 0x62, 0x02, 0x00, 0x00, 0x41, 0x37, 0x01, 0x00, 0x00, 0xec, 0x17, 0xc7, 0x38, 0x97,
+ 0x00, 0x00, 0x00, 0x42, 0x2a, 0x01, 0x00, 0x00, 0x5e, 0x04, 0x00, 0x24, 0x01, 0x00, 0x43, 0x79,
+ 0x02, 0x00, 0x00, 0xc7, 0xc7, 0x41, 0x62, 0x02, 0x00, 0x00, 0x41, 0x7a, 0x02, 0x00, 0x00, 0x09,
+ 0xad, 0x43, 0x7b, 0x02, 0x00, 0x00, 0xc7, 0x41, 0x7b, 0x02, 0x00, 0x00, 0xec, 0x16, 0xc7, 0xc7,
+ 0xc7, 0xb7, 0x15, 0x43, 0x7c, 0x02, 0x00, 0x00, 0x15, 0x43, 0x7d, 0x02, 0x00, 0x00, 0x43, 0x7a,
+ 0x02, 0x00, 0x00, 0x5e, 0x05, 0x00, 0xc7, 0x04, 0x7e, 0x02, 0x00, 0x00, 0xf2, 0x29, 0xc6, 0x03,
+ 0x2f, 0x25, 0x0d, 0x21, 0x26, 0x09, 0x3a, 0x3a, 0x3a, 0x3a, 0x3b, 0x0d, 0x17, 0x49, 0x49, 0x3f,
+ 0xbc, 0x9e, 0x30, 0x6c, 0x49, 0x30, 0x7b, 0x3f, 0x58, 0x00, 0x3a, 0x02, 0x00, 0x09, 0x0a, 0x44,
+ 0x00, 0x16, 0x08, 0x62, 0x2b, 0x6d, 0x35, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x01, 0x02, 0x01, 0x02,
+ 0x00, 0x01, 0x10, 0x03, 0xfe, 0x09, 0x00, 0x01, 0x00, 0x80, 0x0a, 0x00, 0x00, 0x00, 0x82, 0x0a,
+ 0x00, 0x01, 0x00, 0xc2, 0x00, 0xcf, 0xd3, 0x43, 0x3c, 0x00, 0x00, 0x00, 0xc7, 0x11, 0x21, 0x00,
+ 0x00, 0xd0, 0x28, 0xc6, 0x03, 0x5b, 0x03, 0x0e, 0x26, 0x1c, 0x0e, 0x43, 0x06, 0x01, 0x80, 0x0a,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x29, 0xc6, 0x03, 0x5c, 0x00, 0x0e, 0x43, 0x06,
+ 0x01, 0x00, 0x01, 0x02, 0x01, 0x04, 0x00, 0x00, 0x27, 0x03, 0xfe, 0x09, 0x00, 0x01, 0x00, 0x84,
+ 0x0a, 0x00, 0x00, 0x00, 0x86, 0x0a, 0x00, 0x01, 0x00, 0x26, 0x00, 0x00, 0xcb, 0xd3, 0x7e, 0xee,
+ 0x19, 0xcc, 0xd3, 0x42, 0x84, 0x02, 0x00, 0x00, 0xc8, 0x24, 0x01, 0x00, 0xec, 0x0c, 0xc7, 0x42,
+ 0x85, 0x02, 0x00, 0x00, 0xc8, 0x24, 0x01, 0x00, 0x0e, 0x81, 0xec, 0xe6, 0x0e, 0x0e, 0xc7, 0x28,
+ 0xc6, 0x03, 0x64, 0x03, 0x03, 0x17, 0xa8, 0x0e, 0x43, 0x06, 0x01, 0xd6, 0x03, 0x01, 0x06, 0x01,
+ 0x06, 0x05, 0x00, 0xc9, 0x01, 0x07, 0xca, 0x03, 0x00, 0x01, 0x00, 0x8c, 0x0a, 0x00, 0x00, 0x00,
+ 0x8e, 0x0a, 0x00, 0x01, 0x00, 0x86, 0x0a, 0x00, 0x02, 0x00, 0x90, 0x0a, 0x00, 0x03, 0x00, 0x92,
+ 0x0a, 0x00, 0x04, 0x00, 0x94, 0x0a, 0x00, 0x05, 0x00, 0xc8, 0x03, 0x00, 0x0c, 0xd4, 0x03, 0x02,
+ 0x00, 0x84, 0x04, 0x1d, 0x00, 0x82, 0x04, 0x1c, 0x00, 0x88, 0x04, 0x1f, 0x00, 0x38, 0x9f, 0x00,
+ 0x00, 0x00, 0x42, 0x8b, 0x02, 0x00, 0x00, 0x66, 0x00, 0x00, 0x41, 0x10, 0x01, 0x00, 0x00, 0xbf,
+ 0x0a, 0x24, 0x02, 0x00, 0xcb, 0xb7, 0xcc, 0xb7, 0xcd, 0xe0, 0xeb, 0xce, 0xc9, 0xca, 0xa4, 0x6a,
+ 0x8a, 0x00, 0x00, 0x00, 0xd3, 0xe0, 0xc9, 0x47, 0x47, 0xeb, 0xc6, 0x04, 0xc7, 0xa6, 0xec, 0x65,
+ 0xe0, 0xc9, 0x47, 0x11, 0x04, 0x13, 0x01, 0x00, 0x00, 0xac, 0xec, 0x07, 0xe1, 0xd3, 0xf1, 0x0e,
+ 0xee, 0x52, 0x11, 0x04, 0x1b, 0x01, 0x00, 0x00, 0xac, 0xec, 0x19, 0xe2, 0xd3, 0x04, 0x8c, 0x02,
+ 0x00, 0x00, 0xd3, 0x41, 0x1b, 0x01, 0x00, 0x00, 0xf3, 0x0e, 0xd3, 0xc3, 0x43, 0x1b, 0x01, 0x00,
+ 0x00, 0xee, 0x31, 0x11, 0x04, 0x1c, 0x01, 0x00, 0x00, 0xac, 0xec, 0x19, 0xe2, 0xd3, 0x04, 0x8d,
+ 0x02, 0x00, 0x00, 0xd3, 0x41, 0x1c, 0x01, 0x00, 0x00, 0xf3, 0x0e, 0xd3, 0xc3, 0x43, 0x1c, 0x01,
+ 0x00, 0x00, 0xee, 0x10, 0x5e, 0x04, 0x00, 0xd3, 0x04, 0x8e, 0x02, 0x00, 0x00, 0xe0, 0xc9, 0x47,
+ 0x9e, 0xf2, 0x0e, 0x0e, 0x38, 0x9f, 0x00, 0x00, 0x00, 0x42, 0x8b, 0x02, 0x00, 0x00, 0xc8, 0xc4,
+ 0x04, 0x24, 0x02, 0x00, 0xcc, 0x94, 0x02, 0xef, 0x74, 0xff, 0x66, 0x00, 0x00, 0x41, 0x10, 0x01,
+ 0x00, 0x00, 0xc8, 0x9f, 0xc5, 0x05, 0xd3, 0xc4, 0x05, 0xd3, 0x41, 0x7a, 0x02, 0x00, 0x00, 0x9e,
+ 0x43, 0x6a, 0x02, 0x00, 0x00, 0x29, 0xc6, 0x03, 0x6b, 0x1a, 0x03, 0x7b, 0x0d, 0x44, 0x21, 0x00,
+ 0x06, 0x0a, 0x12, 0x30, 0x17, 0x0e, 0x30, 0x4e, 0x26, 0x0e, 0x30, 0x4e, 0x26, 0x0f, 0x4e, 0x09,
+ 0x58, 0x1d, 0x3f, 0x4e, 0x0e, 0x43, 0x06, 0x01, 0xd8, 0x03, 0x01, 0x02, 0x01, 0x03, 0x01, 0x00,
+ 0x15, 0x03, 0xca, 0x03, 0x00, 0x01, 0x00, 0x86, 0x0a, 0x00, 0x00, 0x00, 0x90, 0x0a, 0x00, 0x01,
+ 0x00, 0xd4, 0x03, 0x02, 0x00, 0xb7, 0xcb, 0xdf, 0xeb, 0xcc, 0xc7, 0xc8, 0xa4, 0xec, 0x0b, 0xd3,
+ 0xdf, 0xc7, 0x47, 0xc3, 0x49, 0x94, 0x00, 0xee, 0xf2, 0x29, 0xc6, 0x03, 0x8f, 0x01, 0x04, 0x03,
+ 0x35, 0x21, 0x17, 0x0e, 0x43, 0x06, 0x01, 0xda, 0x03, 0x01, 0x00, 0x01, 0x04, 0x02, 0x00, 0x45,
+ 0x01, 0xca, 0x03, 0x00, 0x01, 0x00, 0x84, 0x04, 0x1d, 0x00, 0x82, 0x04, 0x1c, 0x00, 0xdf, 0xd3,
+ 0xf1, 0x0e, 0xd3, 0x41, 0x1b, 0x01, 0x00, 0x00, 0xc3, 0xad, 0xec, 0x17, 0xe0, 0xd3, 0x04, 0x8c,
+ 0x02, 0x00, 0x00, 0xd3, 0x41, 0x1b, 0x01, 0x00, 0x00, 0xf3, 0x0e, 0xd3, 0xc3, 0x43, 0x1b, 0x01,
+ 0x00, 0x00, 0xd3, 0x41, 0x1c, 0x01, 0x00, 0x00, 0xc3, 0xad, 0xec, 0x17, 0xe0, 0xd3, 0x04, 0x8d,
+ 0x02, 0x00, 0x00, 0xd3, 0x41, 0x1c, 0x01, 0x00, 0x00, 0xf3, 0x0e, 0xd3, 0xc3, 0x43, 0x1c, 0x01,
+ 0x00, 0x00, 0x29, 0xc6, 0x03, 0x95, 0x01, 0x08, 0x03, 0x17, 0x35, 0x4e, 0x27, 0x35, 0x4e, 0x27,
+ 0x0e, 0x43, 0x06, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x06, 0x01, 0x10, 0x00, 0x01,
+ 0x00, 0x8a, 0x04, 0x20, 0x00, 0x08, 0xcb, 0xdf, 0xc7, 0xf1, 0x29, 0xc6, 0x03, 0xa2, 0x01, 0x00,
+ 0x0e, 0x43, 0x06, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x0b, 0x01, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xcb, 0xc7, 0x07, 0x43, 0x04, 0x01, 0x00, 0x00, 0xc7, 0x28, 0xc6, 0x03, 0xa4, 0x01,
+ 0x00, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0c, 0x01, 0x10, 0x00,
+ 0x01, 0x00, 0x08, 0xcb, 0xc7, 0x42, 0x0f, 0x01, 0x00, 0x00, 0x07, 0x25, 0x01, 0x00, 0xc6, 0x03,
+ 0xa5, 0x01, 0x00, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x06, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0xda, 0x03, 0x06, 0x00, 0x08, 0xcb, 0xdf, 0xc7, 0xf1, 0x29, 0xc6, 0x03,
+ 0xa6, 0x01, 0x00, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+ 0x29, 0xc6, 0x03, 0xad, 0x01, 0x00, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00,
+ 0x00, 0x13, 0x01, 0x9e, 0x0a, 0x00, 0x01, 0x00, 0xd3, 0x04, 0x04, 0x01, 0x00, 0x00, 0xad, 0x11,
+ 0xec, 0x09, 0x0e, 0xd3, 0x04, 0x05, 0x01, 0x00, 0x00, 0xad, 0x28, 0xc6, 0x03, 0xb0, 0x01, 0x01,
+ 0x03, 0x0e, 0x43, 0x06, 0x01, 0xce, 0x03, 0x02, 0x00, 0x02, 0x04, 0x01, 0x00, 0x08, 0x02, 0xc2,
+ 0x09, 0x00, 0x01, 0x00, 0xc4, 0x09, 0x00, 0x01, 0x00, 0xd0, 0x03, 0x0a, 0x00, 0xdf, 0x11, 0xd3,
+ 0xd4, 0x21, 0x02, 0x00, 0x28, 0xc6, 0x03, 0xb4, 0x01, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xd0,
+ 0x03, 0x02, 0x02, 0x02, 0x05, 0x04, 0x03, 0x65, 0x04, 0xc2, 0x09, 0x00, 0x01, 0x00, 0xc4, 0x09,
+ 0x00, 0x01, 0x00, 0xa0, 0x0a, 0x00, 0x00, 0x40, 0x10, 0x00, 0x01, 0x00, 0xd0, 0x03, 0x0a, 0x00,
+ 0xdc, 0x03, 0x07, 0x00, 0xcc, 0x03, 0x03, 0x00, 0xde, 0x03, 0x08, 0x00, 0x08, 0xcc, 0xc8, 0xdf,
+ 0xa8, 0x97, 0xec, 0x09, 0xdf, 0x11, 0xd3, 0xd4, 0x21, 0x02, 0x00, 0x28, 0xe0, 0x42, 0x5b, 0x00,
+ 0x00, 0x00, 0xc8, 0x24, 0x01, 0x00, 0x0e, 0xc8, 0xe1, 0x11, 0xd3, 0xd4, 0x21, 0x02, 0x00, 0x43,
+ 0x91, 0x02, 0x00, 0x00, 0xc8, 0x0a, 0x43, 0x3f, 0x00, 0x00, 0x00, 0xc8, 0x0a, 0x43, 0x92, 0x02,
+ 0x00, 0x00, 0xc8, 0xcb, 0xc8, 0x41, 0x91, 0x02, 0x00, 0x00, 0xc2, 0x00, 0x43, 0x67, 0x02, 0x00,
+ 0x00, 0xc8, 0x41, 0x91, 0x02, 0x00, 0x00, 0xc2, 0x01, 0x43, 0x63, 0x02, 0x00, 0x00, 0xc8, 0x07,
+ 0x43, 0x93, 0x02, 0x00, 0x00, 0xe2, 0x42, 0x5f, 0x02, 0x00, 0x00, 0xc2, 0x02, 0x24, 0x01, 0x00,
+ 0x29, 0xc6, 0x03, 0xb8, 0x01, 0x14, 0x0d, 0x21, 0x26, 0x09, 0x3b, 0x44, 0x26, 0x27, 0x0e, 0x22,
+ 0x27, 0x00, 0x06, 0x0c, 0x27, 0x27, 0x00, 0x06, 0x20, 0x1c, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0x03, 0x01, 0x00, 0x0f, 0x00, 0xa0, 0x0a, 0x00, 0x01, 0xdf, 0x42, 0x00, 0x01, 0x00,
+ 0x00, 0x04, 0x05, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x29, 0xc6, 0x03, 0xc5, 0x01, 0x02, 0x03,
+ 0x49, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01, 0x04, 0x01, 0x00, 0x1d, 0x01, 0xa8, 0x0a,
+ 0x00, 0x01, 0x00, 0xa0, 0x0a, 0x00, 0x01, 0xdf, 0x42, 0x00, 0x01, 0x00, 0x00, 0x04, 0x04, 0x01,
+ 0x00, 0x00, 0xd3, 0x24, 0x02, 0x00, 0x0e, 0xdf, 0x41, 0x91, 0x02, 0x00, 0x00, 0x07, 0x43, 0x04,
+ 0x01, 0x00, 0x00, 0x29, 0xc6, 0x03, 0xc9, 0x01, 0x05, 0x03, 0x00, 0x10, 0x08, 0x3f, 0x0e, 0x43,
+ 0x06, 0x01, 0x00, 0x01, 0x00, 0x01, 0x06, 0x01, 0x02, 0x3b, 0x01, 0x9e, 0x0a, 0x00, 0x01, 0x40,
+ 0xa0, 0x0a, 0x00, 0x01, 0x38, 0x97, 0x00, 0x00, 0x00, 0x42, 0x66, 0x00, 0x00, 0x00, 0xdf, 0x04,
+ 0x32, 0x01, 0x00, 0x00, 0xd3, 0x9e, 0x0b, 0xc2, 0x00, 0x4d, 0x42, 0x00, 0x00, 0x00, 0x4c, 0x42,
+ 0x00, 0x00, 0x00, 0xc2, 0x01, 0x4d, 0x43, 0x00, 0x00, 0x00, 0x4c, 0x43, 0x00, 0x00, 0x00, 0x0a,
+ 0x4c, 0x40, 0x00, 0x00, 0x00, 0x09, 0x4c, 0x3e, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x29, 0xc6,
+ 0x03, 0xd3, 0x01, 0x09, 0x03, 0x64, 0x00, 0x0c, 0x10, 0x3f, 0x21, 0x21, 0x12, 0x0e, 0x43, 0x06,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x0f, 0x00, 0xa0, 0x0a, 0x00, 0x00, 0x9e, 0x0a,
+ 0x00, 0x03, 0xdf, 0x41, 0x91, 0x02, 0x00, 0x00, 0x04, 0x32, 0x01, 0x00, 0x00, 0xe0, 0x9e, 0x47,
+ 0x28, 0xc6, 0x03, 0xd5, 0x01, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01, 0x04,
+ 0x02, 0x00, 0x2c, 0x01, 0xaa, 0x0a, 0x00, 0x01, 0x00, 0xa0, 0x0a, 0x00, 0x00, 0x9e, 0x0a, 0x00,
+ 0x03, 0xd3, 0x97, 0xec, 0x1d, 0xdf, 0x42, 0x96, 0x02, 0x00, 0x00, 0xe0, 0x24, 0x01, 0x00, 0x0e,
+ 0xdf, 0x41, 0x91, 0x02, 0x00, 0x00, 0x04, 0x32, 0x01, 0x00, 0x00, 0xe0, 0x9e, 0xd3, 0x49, 0xd3,
+ 0x28, 0xdf, 0x42, 0x32, 0x01, 0x00, 0x00, 0xe0, 0xd3, 0x24, 0x02, 0x00, 0x29, 0xc6, 0x03, 0xd8,
+ 0x01, 0x07, 0x03, 0x17, 0x3a, 0x4e, 0x08, 0x08, 0x3a, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x01, 0x02,
+ 0x01, 0x04, 0x00, 0x00, 0x8b, 0x01, 0x03, 0xae, 0x0a, 0x00, 0x01, 0x00, 0xb0, 0x0a, 0x00, 0x00,
+ 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xcc, 0x37, 0x99, 0x02, 0x00, 0x00, 0xf7, 0xec, 0x58, 0x38,
+ 0x99, 0x02, 0x00, 0x00, 0x41, 0x9a, 0x02, 0x00, 0x00, 0xf7, 0xec, 0x4b, 0x38, 0x99, 0x02, 0x00,
+ 0x00, 0x42, 0x9a, 0x02, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0xec, 0x3b, 0xc8, 0x41, 0x93, 0x02,
+ 0x00, 0x00, 0x97, 0xec, 0x22, 0x38, 0x2f, 0x01, 0x00, 0x00, 0x04, 0x9b, 0x02, 0x00, 0x00, 0xf1,
+ 0x41, 0x9c, 0x02, 0x00, 0x00, 0xcb, 0xc8, 0xc7, 0x11, 0x04, 0x9d, 0x02, 0x00, 0x00, 0x21, 0x01,
+ 0x00, 0x43, 0x93, 0x02, 0x00, 0x00, 0xc8, 0x41, 0x93, 0x02, 0x00, 0x00, 0x42, 0x0f, 0x01, 0x00,
+ 0x00, 0xd3, 0x24, 0x01, 0x00, 0xd7, 0xc8, 0x41, 0x91, 0x02, 0x00, 0x00, 0x42, 0x0f, 0x01, 0x00,
+ 0x00, 0xd3, 0x42, 0x38, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xc8, 0x42,
+ 0x00, 0x01, 0x00, 0x00, 0x04, 0x97, 0x02, 0x00, 0x00, 0xd3, 0x24, 0x02, 0x00, 0x0e, 0x0a, 0x28,
+ 0xc6, 0x03, 0xec, 0x01, 0x0a, 0x0d, 0x2b, 0x44, 0x53, 0x30, 0x58, 0x54, 0x55, 0x7b, 0x53, 0x0e,
+ 0x43, 0x06, 0x01, 0x00, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x25, 0x02, 0xbc, 0x0a, 0x00, 0x01,
+ 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xcb, 0xd3, 0xec, 0x10, 0xd3, 0xeb, 0xec, 0x0c, 0xc7, 0x42,
+ 0x0f, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x0e, 0xc7, 0x41, 0x91, 0x02, 0x00, 0x00, 0x42,
+ 0x05, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x0e, 0x0a, 0x28, 0xc6, 0x03, 0xfc, 0x01, 0x04, 0x0d,
+ 0x26, 0x3b, 0x4e, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x02, 0x02, 0x02, 0x05, 0x02, 0x01, 0x49, 0x04,
+ 0x9e, 0x0a, 0x00, 0x01, 0x40, 0xbe, 0x0a, 0x00, 0x01, 0x00, 0xa0, 0x0a, 0x00, 0x00, 0x40, 0x10,
+ 0x00, 0x01, 0x00, 0xde, 0x03, 0x08, 0x00, 0xdc, 0x03, 0x07, 0x00, 0x08, 0xcc, 0xc8, 0xcf, 0x41,
+ 0x91, 0x02, 0x00, 0x00, 0x04, 0x32, 0x01, 0x00, 0x00, 0xd3, 0x9e, 0x47, 0x97, 0xec, 0x20, 0xdf,
+ 0x42, 0xa0, 0x02, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0xb6, 0xad, 0xec, 0x12, 0xc7, 0x41, 0x91,
+ 0x02, 0x00, 0x00, 0x04, 0x32, 0x01, 0x00, 0x00, 0xd3, 0x9e, 0x73, 0xc2, 0x00, 0x49, 0xe0, 0x41,
+ 0x3c, 0x00, 0x00, 0x00, 0x41, 0x32, 0x01, 0x00, 0x00, 0x42, 0xa1, 0x02, 0x00, 0x00, 0xc7, 0xd3,
+ 0xd4, 0x25, 0x03, 0x00, 0xc6, 0x03, 0x84, 0x02, 0x07, 0x0d, 0x08, 0x9e, 0x00, 0x0e, 0x08, 0x14,
+ 0x0e, 0x43, 0x06, 0x01, 0x00, 0x00, 0x02, 0x00, 0x05, 0x02, 0x00, 0x3e, 0x02, 0xc4, 0x0a, 0x00,
+ 0x00, 0x00, 0x9c, 0x01, 0x00, 0x01, 0x00, 0x9e, 0x0a, 0x00, 0x03, 0xa0, 0x0a, 0x00, 0x01, 0x0c,
+ 0x00, 0xcc, 0xc8, 0xeb, 0xb8, 0xac, 0xec, 0x09, 0xc8, 0xb7, 0x47, 0x26, 0x01, 0x00, 0xee, 0x10,
+ 0x38, 0x98, 0x00, 0x00, 0x00, 0x42, 0x5b, 0x00, 0x00, 0x00, 0x07, 0xc8, 0x24, 0x02, 0x00, 0xcf,
+ 0x42, 0xa3, 0x02, 0x00, 0x00, 0xb7, 0xb7, 0xdf, 0x24, 0x03, 0x00, 0x0e, 0xe0, 0x41, 0x00, 0x01,
+ 0x00, 0x00, 0x42, 0x5b, 0x00, 0x00, 0x00, 0xe0, 0xc7, 0x24, 0x02, 0x00, 0x29, 0xc6, 0x03, 0x87,
+ 0x02, 0x04, 0x12, 0x94, 0x44, 0x53, 0x07, 0xb2, 0x02, 0x5b, 0x3a, 0x5f, 0x41, 0x2d, 0x5a, 0x61,
+ 0x2d, 0x7a, 0x5c, 0x75, 0x30, 0x30, 0x43, 0x30, 0x2d, 0x5c, 0x75, 0x30, 0x30, 0x44, 0x36, 0x5c,
+ 0x75, 0x30, 0x30, 0x44, 0x38, 0x2d, 0x5c, 0x75, 0x30, 0x30, 0x46, 0x36, 0x5c, 0x75, 0x30, 0x30,
+ 0x46, 0x38, 0x2d, 0x5c, 0x75, 0x30, 0x32, 0x46, 0x46, 0x5c, 0x75, 0x30, 0x33, 0x37, 0x30, 0x2d,
+ 0x5c, 0x75, 0x30, 0x33, 0x37, 0x44, 0x5c, 0x75, 0x30, 0x33, 0x37, 0x46, 0x2d, 0x5c, 0x75, 0x31,
+ 0x46, 0x46, 0x46, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x43, 0x2d, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x44,
+ 0x5c, 0x75, 0x32, 0x30, 0x37, 0x30, 0x2d, 0x5c, 0x75, 0x32, 0x31, 0x38, 0x46, 0x5c, 0x75, 0x32,
+ 0x43, 0x30, 0x30, 0x2d, 0x5c, 0x75, 0x32, 0x46, 0x45, 0x46, 0x5c, 0x75, 0x33, 0x30, 0x30, 0x31,
+ 0x2d, 0x5c, 0x75, 0x44, 0x37, 0x46, 0x46, 0x5c, 0x75, 0x46, 0x39, 0x30, 0x30, 0x2d, 0x5c, 0x75,
+ 0x46, 0x44, 0x43, 0x46, 0x5c, 0x75, 0x46, 0x44, 0x46, 0x30, 0x2d, 0x5c, 0x75, 0x46, 0x46, 0x46,
+ 0x44, 0x5d, 0x07, 0xac, 0x01, 0x00, 0x01, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00,
+ 0x00, 0x04, 0x07, 0xf5, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x15, 0x0f, 0x00, 0x3a, 0x00, 0x3a, 0x00,
+ 0x41, 0x00, 0x5a, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x7a, 0x00, 0xc0, 0x00, 0xd6, 0x00,
+ 0xd8, 0x00, 0xf6, 0x00, 0xf8, 0x00, 0xff, 0x02, 0x70, 0x03, 0x7d, 0x03, 0x7f, 0x03, 0xff, 0x1f,
+ 0x0c, 0x20, 0x0d, 0x20, 0x70, 0x20, 0x8f, 0x21, 0x00, 0x2c, 0xef, 0x2f, 0x01, 0x30, 0xff, 0xd7,
+ 0x00, 0xf9, 0xcf, 0xfd, 0xf0, 0xfd, 0xfd, 0xff, 0x0c, 0x00, 0x0a, 0x07, 0xfa, 0x02, 0x5b, 0x3a,
+ 0x5f, 0x41, 0x2d, 0x5a, 0x61, 0x2d, 0x7a, 0x5c, 0x75, 0x30, 0x30, 0x43, 0x30, 0x2d, 0x5c, 0x75,
+ 0x30, 0x30, 0x44, 0x36, 0x5c, 0x75, 0x30, 0x30, 0x44, 0x38, 0x2d, 0x5c, 0x75, 0x30, 0x30, 0x46,
+ 0x36, 0x5c, 0x75, 0x30, 0x30, 0x46, 0x38, 0x2d, 0x5c, 0x75, 0x30, 0x32, 0x46, 0x46, 0x5c, 0x75,
+ 0x30, 0x33, 0x37, 0x30, 0x2d, 0x5c, 0x75, 0x30, 0x33, 0x37, 0x44, 0x5c, 0x75, 0x30, 0x33, 0x37,
+ 0x46, 0x2d, 0x5c, 0x75, 0x31, 0x46, 0x46, 0x46, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x43, 0x2d, 0x5c,
+ 0x75, 0x32, 0x30, 0x30, 0x44, 0x5c, 0x75, 0x32, 0x30, 0x37, 0x30, 0x2d, 0x5c, 0x75, 0x32, 0x31,
+ 0x38, 0x46, 0x5c, 0x75, 0x32, 0x43, 0x30, 0x30, 0x2d, 0x5c, 0x75, 0x32, 0x46, 0x45, 0x46, 0x5c,
+ 0x75, 0x33, 0x30, 0x30, 0x31, 0x2d, 0x5c, 0x75, 0x44, 0x37, 0x46, 0x46, 0x5c, 0x75, 0x46, 0x39,
+ 0x30, 0x30, 0x2d, 0x5c, 0x75, 0x46, 0x44, 0x43, 0x46, 0x5c, 0x75, 0x46, 0x44, 0x46, 0x30, 0x2d,
+ 0x5c, 0x75, 0x46, 0x46, 0x46, 0x44, 0x5c, 0x75, 0x30, 0x30, 0x42, 0x37, 0x5c, 0x75, 0x30, 0x33,
+ 0x30, 0x30, 0x2d, 0x5c, 0x75, 0x30, 0x33, 0x36, 0x46, 0x5c, 0x75, 0x32, 0x30, 0x33, 0x46, 0x2d,
+ 0x5c, 0x75, 0x32, 0x30, 0x34, 0x30, 0x2e, 0x5c, 0x64, 0x2d, 0x5d, 0x07, 0xbc, 0x01, 0x00, 0x01,
+ 0x00, 0x57, 0x00, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x04, 0x07, 0xf5, 0xff, 0xff, 0xff,
+ 0x0b, 0x00, 0x15, 0x11, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x41, 0x00, 0x5a,
+ 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x7a, 0x00, 0xb7, 0x00, 0xb7, 0x00, 0xc0, 0x00, 0xd6,
+ 0x00, 0xd8, 0x00, 0xf6, 0x00, 0xf8, 0x00, 0x7d, 0x03, 0x7f, 0x03, 0xff, 0x1f, 0x0c, 0x20, 0x0d,
+ 0x20, 0x3f, 0x20, 0x40, 0x20, 0x70, 0x20, 0x8f, 0x21, 0x00, 0x2c, 0xef, 0x2f, 0x01, 0x30, 0xff,
+ 0xd7, 0x00, 0xf9, 0xcf, 0xfd, 0xf0, 0xfd, 0xfd, 0xff, 0x0c, 0x00, 0x0a, 0x07, 0xb4, 0x02, 0x5b,
+ 0x23, 0x3a, 0x5f, 0x41, 0x2d, 0x5a, 0x61, 0x2d, 0x7a, 0x5c, 0x75, 0x30, 0x30, 0x43, 0x30, 0x2d,
+ 0x5c, 0x75, 0x30, 0x30, 0x44, 0x36, 0x5c, 0x75, 0x30, 0x30, 0x44, 0x38, 0x2d, 0x5c, 0x75, 0x30,
+ 0x30, 0x46, 0x36, 0x5c, 0x75, 0x30, 0x30, 0x46, 0x38, 0x2d, 0x5c, 0x75, 0x30, 0x32, 0x46, 0x46,
+ 0x5c, 0x75, 0x30, 0x33, 0x37, 0x30, 0x2d, 0x5c, 0x75, 0x30, 0x33, 0x37, 0x44, 0x5c, 0x75, 0x30,
+ 0x33, 0x37, 0x46, 0x2d, 0x5c, 0x75, 0x31, 0x46, 0x46, 0x46, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x43,
+ 0x2d, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x44, 0x5c, 0x75, 0x32, 0x30, 0x37, 0x30, 0x2d, 0x5c, 0x75,
+ 0x32, 0x31, 0x38, 0x46, 0x5c, 0x75, 0x32, 0x43, 0x30, 0x30, 0x2d, 0x5c, 0x75, 0x32, 0x46, 0x45,
+ 0x46, 0x5c, 0x75, 0x33, 0x30, 0x30, 0x31, 0x2d, 0x5c, 0x75, 0x44, 0x37, 0x46, 0x46, 0x5c, 0x75,
+ 0x46, 0x39, 0x30, 0x30, 0x2d, 0x5c, 0x75, 0x46, 0x44, 0x43, 0x46, 0x5c, 0x75, 0x46, 0x44, 0x46,
+ 0x30, 0x2d, 0x5c, 0x75, 0x46, 0x46, 0x46, 0x44, 0x5d, 0x07, 0xb4, 0x01, 0x00, 0x01, 0x00, 0x53,
+ 0x00, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x04, 0x07, 0xf5, 0xff, 0xff, 0xff, 0x0b, 0x00,
+ 0x15, 0x10, 0x00, 0x23, 0x00, 0x23, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x41, 0x00, 0x5a, 0x00, 0x5f,
+ 0x00, 0x5f, 0x00, 0x61, 0x00, 0x7a, 0x00, 0xc0, 0x00, 0xd6, 0x00, 0xd8, 0x00, 0xf6, 0x00, 0xf8,
+ 0x00, 0xff, 0x02, 0x70, 0x03, 0x7d, 0x03, 0x7f, 0x03, 0xff, 0x1f, 0x0c, 0x20, 0x0d, 0x20, 0x70,
+ 0x20, 0x8f, 0x21, 0x00, 0x2c, 0xef, 0x2f, 0x01, 0x30, 0xff, 0xd7, 0x00, 0xf9, 0xcf, 0xfd, 0xf0,
+ 0xfd, 0xfd, 0xff, 0x0c, 0x00, 0x0a, 0x07, 0xfc, 0x02, 0x5b, 0x23, 0x3a, 0x5f, 0x41, 0x2d, 0x5a,
+ 0x61, 0x2d, 0x7a, 0x5c, 0x75, 0x30, 0x30, 0x43, 0x30, 0x2d, 0x5c, 0x75, 0x30, 0x30, 0x44, 0x36,
+ 0x5c, 0x75, 0x30, 0x30, 0x44, 0x38, 0x2d, 0x5c, 0x75, 0x30, 0x30, 0x46, 0x36, 0x5c, 0x75, 0x30,
+ 0x30, 0x46, 0x38, 0x2d, 0x5c, 0x75, 0x30, 0x32, 0x46, 0x46, 0x5c, 0x75, 0x30, 0x33, 0x37, 0x30,
+ 0x2d, 0x5c, 0x75, 0x30, 0x33, 0x37, 0x44, 0x5c, 0x75, 0x30, 0x33, 0x37, 0x46, 0x2d, 0x5c, 0x75,
+ 0x31, 0x46, 0x46, 0x46, 0x5c, 0x75, 0x32, 0x30, 0x30, 0x43, 0x2d, 0x5c, 0x75, 0x32, 0x30, 0x30,
+ 0x44, 0x5c, 0x75, 0x32, 0x30, 0x37, 0x30, 0x2d, 0x5c, 0x75, 0x32, 0x31, 0x38, 0x46, 0x5c, 0x75,
+ 0x32, 0x43, 0x30, 0x30, 0x2d, 0x5c, 0x75, 0x32, 0x46, 0x45, 0x46, 0x5c, 0x75, 0x33, 0x30, 0x30,
+ 0x31, 0x2d, 0x5c, 0x75, 0x44, 0x37, 0x46, 0x46, 0x5c, 0x75, 0x46, 0x39, 0x30, 0x30, 0x2d, 0x5c,
+ 0x75, 0x46, 0x44, 0x43, 0x46, 0x5c, 0x75, 0x46, 0x44, 0x46, 0x30, 0x2d, 0x5c, 0x75, 0x46, 0x46,
+ 0x46, 0x44, 0x5c, 0x75, 0x30, 0x30, 0x42, 0x37, 0x5c, 0x75, 0x30, 0x33, 0x30, 0x30, 0x2d, 0x5c,
+ 0x75, 0x30, 0x33, 0x36, 0x46, 0x5c, 0x75, 0x32, 0x30, 0x33, 0x46, 0x2d, 0x5c, 0x75, 0x32, 0x30,
+ 0x34, 0x30, 0x2e, 0x5c, 0x64, 0x2d, 0x5d, 0x07, 0xc4, 0x01, 0x00, 0x01, 0x00, 0x5b, 0x00, 0x00,
+ 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x04, 0x07, 0xf5, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x15, 0x12,
+ 0x00, 0x23, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x41, 0x00, 0x5a,
+ 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x7a, 0x00, 0xb7, 0x00, 0xb7, 0x00, 0xc0, 0x00, 0xd6,
+ 0x00, 0xd8, 0x00, 0xf6, 0x00, 0xf8, 0x00, 0x7d, 0x03, 0x7f, 0x03, 0xff, 0x1f, 0x0c, 0x20, 0x0d,
+ 0x20, 0x3f, 0x20, 0x40, 0x20, 0x70, 0x20, 0x8f, 0x21, 0x00, 0x2c, 0xef, 0x2f, 0x01, 0x30, 0xff,
+ 0xd7, 0x00, 0xf9, 0xcf, 0xfd, 0xf0, 0xfd, 0xfd, 0xff, 0x0c, 0x00, 0x0a, 0x0e, 0x43, 0x06, 0x01,
+ 0xf2, 0x03, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x29, 0x01, 0xd0, 0x09, 0x00, 0x01, 0x00, 0xd3,
+ 0x04, 0xa4, 0x02, 0x00, 0x00, 0xac, 0x11, 0xed, 0x1f, 0x0e, 0xd3, 0x04, 0xa5, 0x02, 0x00, 0x00,
+ 0xac, 0x11, 0xed, 0x14, 0x0e, 0xd3, 0x04, 0xa6, 0x02, 0x00, 0x00, 0xac, 0x11, 0xed, 0x09, 0x0e,
+ 0xd3, 0x04, 0xa7, 0x02, 0x00, 0x00, 0xac, 0x28, 0xc6, 0x03, 0xa6, 0x02, 0x01, 0x03, 0x0e, 0x43,
+ 0x06, 0x01, 0xf4, 0x03, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x13, 0x01, 0xd0, 0x09, 0x00, 0x01,
+ 0x00, 0xd3, 0x04, 0x61, 0x01, 0x00, 0x00, 0xac, 0x11, 0xed, 0x09, 0x0e, 0xd3, 0x04, 0x63, 0x01,
+ 0x00, 0x00, 0xac, 0x28, 0xc6, 0x03, 0xaa, 0x02, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xf6, 0x03,
+ 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x0f, 0x01, 0xd0, 0x09, 0x00, 0x01, 0x00, 0xf2, 0x03, 0x14,
+ 0x00, 0xd3, 0x04, 0x5d, 0x01, 0x00, 0x00, 0xac, 0x11, 0xed, 0x05, 0x0e, 0xdf, 0xd3, 0xf1, 0x28,
+ 0xc6, 0x03, 0xae, 0x02, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xf8, 0x03, 0x02, 0x00, 0x02, 0x03,
+ 0x00, 0x00, 0x0a, 0x02, 0xd0, 0x0a, 0x00, 0x01, 0x00, 0xd0, 0x09, 0x00, 0x01, 0x00, 0xd3, 0x42,
+ 0xa9, 0x02, 0x00, 0x00, 0xd4, 0x25, 0x01, 0x00, 0xc6, 0x03, 0xb2, 0x02, 0x01, 0x03, 0x0e, 0x43,
+ 0x06, 0x01, 0xfa, 0x03, 0x02, 0x00, 0x02, 0x03, 0x01, 0x00, 0x06, 0x02, 0xd0, 0x0a, 0x00, 0x01,
+ 0x00, 0xd0, 0x09, 0x00, 0x01, 0x00, 0xf8, 0x03, 0x17, 0x00, 0xdf, 0xd3, 0xd4, 0xf2, 0x97, 0x28,
+ 0xc6, 0x03, 0xb6, 0x02, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x01, 0x02, 0x01, 0x03, 0x01,
+ 0x00, 0x32, 0x03, 0xd4, 0x0a, 0x00, 0x01, 0x00, 0xd6, 0x0a, 0x00, 0x00, 0x00, 0xfe, 0x03, 0x00,
+ 0x01, 0x00, 0xc8, 0x03, 0x00, 0x0c, 0x66, 0x00, 0x00, 0x41, 0x5e, 0x02, 0x00, 0x00, 0xd3, 0x47,
+ 0xcf, 0x98, 0x04, 0x47, 0x00, 0x00, 0x00, 0xac, 0xec, 0x11, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x42,
+ 0xac, 0x02, 0x00, 0x00, 0xc7, 0x24, 0x01, 0x00, 0xee, 0x02, 0xc7, 0xcc, 0x66, 0x00, 0x00, 0x41,
+ 0x5e, 0x02, 0x00, 0x00, 0xd3, 0xc8, 0x49, 0x29, 0xc6, 0x03, 0xea, 0x04, 0x04, 0x03, 0x35, 0x8f,
+ 0x3a, 0x0e, 0x43, 0x06, 0x01, 0x80, 0x04, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x0f, 0x03, 0xca,
+ 0x03, 0x00, 0x01, 0x00, 0xda, 0x0a, 0x00, 0x01, 0x00, 0xae, 0x0a, 0x00, 0x01, 0x00, 0xd3, 0xd4,
+ 0x47, 0x11, 0xec, 0x09, 0x0e, 0xd3, 0xd4, 0x48, 0xd5, 0x24, 0x01, 0x00, 0x29, 0xc6, 0x03, 0xf7,
+ 0x04, 0x02, 0x03, 0x49, 0x0e, 0x43, 0x06, 0x01, 0x82, 0x04, 0x03, 0x00, 0x03, 0x04, 0x02, 0x00,
+ 0x12, 0x03, 0xca, 0x03, 0x00, 0x01, 0x00, 0xdc, 0x0a, 0x00, 0x01, 0x00, 0xae, 0x0a, 0x00, 0x01,
+ 0x00, 0x84, 0x04, 0x1d, 0x00, 0x80, 0x04, 0x1b, 0x00, 0xd3, 0x41, 0x13, 0x01, 0x00, 0x00, 0xec,
+ 0x05, 0xdf, 0xd3, 0xf1, 0x0e, 0xe0, 0xd3, 0xd4, 0xd5, 0xf3, 0x29, 0xc6, 0x03, 0xfb, 0x04, 0x03,
+ 0x03, 0x3f, 0x1c, 0x0e, 0x43, 0x06, 0x01, 0x84, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x00, 0x33,
+ 0x01, 0xca, 0x03, 0x00, 0x01, 0x00, 0x86, 0x04, 0x1e, 0x00, 0x80, 0x04, 0x1b, 0x00, 0xd3, 0xdf,
+ 0xd3, 0x41, 0x62, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x13, 0x01, 0x00, 0x00, 0xf2, 0x43, 0x13, 0x01,
+ 0x00, 0x00, 0xd3, 0x41, 0x13, 0x01, 0x00, 0x00, 0xec, 0x10, 0xe0, 0xd3, 0x04, 0x66, 0x02, 0x00,
+ 0x00, 0xd3, 0x41, 0x13, 0x01, 0x00, 0x00, 0xf3, 0x0e, 0xd3, 0xc3, 0x43, 0x13, 0x01, 0x00, 0x00,
+ 0x29, 0xc6, 0x03, 0x80, 0x05, 0x04, 0x03, 0x67, 0x76, 0x26, 0x0e, 0x43, 0x06, 0x01, 0x86, 0x04,
+ 0x02, 0x00, 0x02, 0x04, 0x00, 0x02, 0x30, 0x02, 0xc4, 0x09, 0x00, 0x01, 0x00, 0xba, 0x04, 0x00,
+ 0x01, 0x00, 0xd3, 0x41, 0xaf, 0x02, 0x00, 0x00, 0xec, 0x0b, 0xd4, 0x42, 0xaf, 0x02, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xd8, 0xd3, 0x41, 0xb0, 0x02, 0x00, 0x00, 0xec, 0x15, 0xd4, 0x42, 0xb1, 0x02,
+ 0x00, 0x00, 0xc1, 0x00, 0xc1, 0x01, 0x33, 0x04, 0xa4, 0x02, 0x00, 0x00, 0x24, 0x02, 0x00, 0xd8,
+ 0xd4, 0x28, 0xc6, 0x03, 0x86, 0x05, 0x03, 0x03, 0x5d, 0x8f, 0x07, 0x06, 0x5c, 0x73, 0x2b, 0x07,
+ 0xa8, 0x01, 0x01, 0x01, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x04, 0x07,
+ 0xf5, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x1c, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff,
+ 0xff, 0xff, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x15, 0x0a, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x20, 0x00,
+ 0x20, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0x80, 0x16, 0x80, 0x16, 0x00, 0x20, 0x0a, 0x20, 0x28, 0x20,
+ 0x29, 0x20, 0x2f, 0x20, 0x2f, 0x20, 0x5f, 0x20, 0x5f, 0x20, 0x00, 0x30, 0x00, 0x30, 0xff, 0xfe,
+ 0xff, 0xfe, 0x0a, 0x0c, 0x00, 0x0a, 0x0e, 0x43, 0x06, 0x01, 0x88, 0x04, 0x02, 0x00, 0x02, 0x04,
+ 0x02, 0x00, 0x53, 0x02, 0xca, 0x03, 0x00, 0x01, 0x00, 0xa8, 0x0a, 0x00, 0x01, 0x00, 0x84, 0x04,
+ 0x1d, 0x00, 0x80, 0x04, 0x1b, 0x00, 0xdf, 0xd3, 0xf1, 0x0e, 0xd3, 0x41, 0x7b, 0x02, 0x00, 0x00,
+ 0xec, 0x2a, 0xd4, 0x04, 0xb2, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x7d, 0x02, 0x00, 0x00, 0x9e, 0x04,
+ 0xb3, 0x02, 0x00, 0x00, 0x9e, 0xd3, 0x41, 0x7c, 0x02, 0x00, 0x00, 0x9e, 0x04, 0xb4, 0x02, 0x00,
+ 0x00, 0x9e, 0xd3, 0x41, 0x68, 0x02, 0x00, 0x00, 0x9e, 0x9e, 0xd8, 0x38, 0x99, 0x00, 0x00, 0x00,
+ 0x11, 0xd4, 0x21, 0x01, 0x00, 0xd8, 0xd3, 0xd4, 0x43, 0x04, 0x01, 0x00, 0x00, 0xe0, 0xd3, 0x04,
+ 0x63, 0x02, 0x00, 0x00, 0xd4, 0xf3, 0x0e, 0xd3, 0x28, 0xc6, 0x03, 0x8c, 0x05, 0x09, 0x03, 0x17,
+ 0x2b, 0x5d, 0x44, 0x36, 0x3a, 0x26, 0x35, 0x0e, 0x43, 0x06, 0x01, 0x8a, 0x04, 0x01, 0x00, 0x01,
+ 0x05, 0x06, 0x00, 0x88, 0x01, 0x01, 0xca, 0x03, 0x00, 0x01, 0x00, 0x8c, 0x04, 0x21, 0x00, 0xfc,
+ 0x03, 0x19, 0x00, 0x88, 0x04, 0x1f, 0x00, 0x84, 0x04, 0x1d, 0x00, 0x80, 0x04, 0x1b, 0x00, 0xcc,
+ 0x03, 0x03, 0x00, 0xd3, 0x41, 0x71, 0x02, 0x00, 0x00, 0xec, 0x13, 0xd3, 0x41, 0x72, 0x02, 0x00,
+ 0x00, 0x97, 0xec, 0x0a, 0xdf, 0xd3, 0x04, 0xb5, 0x02, 0x00, 0x00, 0xf2, 0x0e, 0xd3, 0x41, 0x76,
+ 0x02, 0x00, 0x00, 0xe0, 0x41, 0x38, 0x01, 0x00, 0x00, 0xad, 0xec, 0x28, 0xd3, 0x41, 0x76, 0x02,
+ 0x00, 0x00, 0xe0, 0x41, 0x39, 0x01, 0x00, 0x00, 0xad, 0xec, 0x19, 0xd3, 0x41, 0x76, 0x02, 0x00,
+ 0x00, 0xe0, 0x41, 0x3a, 0x01, 0x00, 0x00, 0xad, 0xec, 0x0a, 0xe1, 0xd3, 0x04, 0xb6, 0x02, 0x00,
+ 0x00, 0xf2, 0x0e, 0xe2, 0xd3, 0xf1, 0x0e, 0xd3, 0xc3, 0x43, 0x68, 0x02, 0x00, 0x00, 0xd3, 0x0a,
+ 0x43, 0x73, 0x02, 0x00, 0x00, 0x5e, 0x04, 0x00, 0xd3, 0x04, 0x67, 0x02, 0x00, 0x00, 0xf2, 0x0e,
+ 0x5e, 0x05, 0x00, 0x42, 0xa1, 0x02, 0x00, 0x00, 0xd3, 0xd3, 0x41, 0x61, 0x02, 0x00, 0x00, 0xd3,
+ 0x41, 0x62, 0x02, 0x00, 0x00, 0x24, 0x03, 0x00, 0x0e, 0xd3, 0x28, 0xc6, 0x03, 0x99, 0x05, 0x0b,
+ 0x03, 0x85, 0x4e, 0x4e, 0x4e, 0x31, 0x17, 0x26, 0x26, 0x3a, 0x80, 0x0e, 0x43, 0x06, 0x01, 0x8c,
+ 0x04, 0x02, 0x00, 0x02, 0x03, 0x02, 0x00, 0x2f, 0x02, 0xca, 0x03, 0x00, 0x01, 0x00, 0x66, 0x00,
+ 0x01, 0x00, 0xcc, 0x03, 0x03, 0x00, 0x88, 0x04, 0x1f, 0x00, 0xd3, 0x98, 0x04, 0x4a, 0x00, 0x00,
+ 0x00, 0xad, 0x11, 0xed, 0x06, 0x0e, 0xd3, 0xdf, 0xa8, 0x97, 0xec, 0x10, 0x38, 0x99, 0x00, 0x00,
+ 0x00, 0x11, 0x04, 0xb7, 0x02, 0x00, 0x00, 0x21, 0x01, 0x00, 0x2f, 0xd3, 0x41, 0x61, 0x02, 0x00,
+ 0x00, 0xec, 0x06, 0xe0, 0xd3, 0xd4, 0xf2, 0x0e, 0x29, 0xc6, 0x03, 0xa8, 0x05, 0x06, 0x03, 0x5d,
+ 0x49, 0x08, 0x2b, 0x1d, 0x0e, 0x43, 0x06, 0x01, 0x8e, 0x04, 0x01, 0x02, 0x01, 0x04, 0x01, 0x00,
+ 0x7e, 0x03, 0xca, 0x03, 0x00, 0x01, 0x00, 0xf0, 0x0a, 0x00, 0x00, 0x00, 0xe8, 0x09, 0x00, 0x01,
+ 0x00, 0x82, 0x04, 0x1c, 0x00, 0xd3, 0x41, 0x61, 0x02, 0x00, 0x00, 0x97, 0xec, 0x17, 0xd3, 0xd3,
+ 0x41, 0x14, 0x01, 0x00, 0x00, 0xd3, 0x41, 0x6f, 0x02, 0x00, 0x00, 0x48, 0x24, 0x00, 0x00, 0x43,
+ 0x14, 0x01, 0x00, 0x00, 0xd3, 0x41, 0x70, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x70, 0x02, 0x00, 0x00,
+ 0xeb, 0xb8, 0x9f, 0x47, 0x11, 0xed, 0x03, 0x0e, 0xd3, 0xcb, 0xd3, 0x0b, 0xd3, 0x41, 0x14, 0x01,
+ 0x00, 0x00, 0x4c, 0x37, 0x00, 0x00, 0x00, 0x0b, 0x4c, 0xb9, 0x02, 0x00, 0x00, 0x15, 0x43, 0x74,
+ 0x02, 0x00, 0x00, 0xcc, 0xd3, 0x41, 0x62, 0x02, 0x00, 0x00, 0x41, 0x37, 0x01, 0x00, 0x00, 0xec,
+ 0x0d, 0xc8, 0xc7, 0x41, 0x79, 0x02, 0x00, 0x00, 0x43, 0x79, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x78,
+ 0x02, 0x00, 0x00, 0xb7, 0x43, 0x30, 0x00, 0x00, 0x00, 0xdf, 0xd3, 0x04, 0xba, 0x02, 0x00, 0x00,
+ 0xc8, 0xf3, 0x29, 0xc6, 0x03, 0xb1, 0x05, 0x08, 0x03, 0x9e, 0x71, 0x87, 0x44, 0x40, 0x3f, 0x30,
+ 0x0e, 0x43, 0x06, 0x01, 0x90, 0x04, 0x02, 0x04, 0x02, 0x03, 0x00, 0x00, 0x52, 0x06, 0x6e, 0x00,
+ 0x01, 0x00, 0xc2, 0x04, 0x00, 0x01, 0x00, 0x86, 0x0a, 0x00, 0x00, 0x00, 0xf6, 0x0a, 0x00, 0x01,
+ 0x00, 0xf8, 0x0a, 0x00, 0x02, 0x00, 0xfa, 0x0a, 0x00, 0x03, 0x00, 0xd3, 0x42, 0xa0, 0x02, 0x00,
+ 0x00, 0x04, 0xbe, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0xcf, 0xb7, 0xa4, 0xec, 0x08, 0xc3, 0xd3,
+ 0x26, 0x02, 0x00, 0xee, 0x0f, 0xd3, 0x42, 0x5e, 0x00, 0x00, 0x00, 0x04, 0xbe, 0x02, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0xd0, 0xb7, 0x47, 0xcd, 0xc8, 0xb8, 0x47, 0xce, 0xd4, 0xec, 0x12, 0xd3, 0x04,
+ 0x37, 0x01, 0x00, 0x00, 0xac, 0xec, 0x09, 0x04, 0x37, 0x01, 0x00, 0x00, 0xcd, 0xc3, 0xce, 0x0b,
+ 0xc9, 0x4c, 0xbc, 0x02, 0x00, 0x00, 0xca, 0x4c, 0xbd, 0x02, 0x00, 0x00, 0x28, 0xc6, 0x03, 0xbe,
+ 0x05, 0x08, 0x03, 0x49, 0x85, 0x17, 0x19, 0x3f, 0x21, 0x0f, 0x0e, 0x43, 0x06, 0x01, 0x92, 0x04,
+ 0x01, 0x05, 0x01, 0x05, 0x05, 0x00, 0xbe, 0x03, 0x06, 0xca, 0x03, 0x00, 0x01, 0x00, 0xfe, 0x0a,
+ 0x00, 0x00, 0x00, 0xf8, 0x0a, 0x00, 0x01, 0x00, 0xfa, 0x0a, 0x00, 0x02, 0x00, 0xe8, 0x09, 0x00,
+ 0x03, 0x00, 0xf0, 0x0a, 0x00, 0x04, 0x00, 0x90, 0x04, 0x23, 0x00, 0xe4, 0x03, 0x0d, 0x00, 0x8c,
+ 0x04, 0x21, 0x00, 0xe6, 0x03, 0x0e, 0x00, 0x82, 0x04, 0x1c, 0x00, 0xd3, 0x41, 0x61, 0x02, 0x00,
+ 0x00, 0x97, 0xec, 0x17, 0xd3, 0xd3, 0x41, 0x19, 0x01, 0x00, 0x00, 0xd3, 0x41, 0x6f, 0x02, 0x00,
+ 0x00, 0x48, 0x24, 0x00, 0x00, 0x43, 0x19, 0x01, 0x00, 0x00, 0xd3, 0x41, 0x78, 0x02, 0x00, 0x00,
+ 0x42, 0xa0, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x19, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xb6, 0xad,
+ 0x11, 0xed, 0x1b, 0x0e, 0xd3, 0x41, 0x74, 0x02, 0x00, 0x00, 0x41, 0xb9, 0x02, 0x00, 0x00, 0x42,
+ 0x84, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x19, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xec, 0x10, 0xd3,
+ 0xd3, 0xc3, 0x15, 0x43, 0x1a, 0x01, 0x00, 0x00, 0x43, 0x19, 0x01, 0x00, 0x00, 0x29, 0xd3, 0x41,
+ 0x62, 0x02, 0x00, 0x00, 0x41, 0x37, 0x01, 0x00, 0x00, 0x6a, 0x05, 0x01, 0x00, 0x00, 0xdf, 0xd3,
+ 0x41, 0x19, 0x01, 0x00, 0x00, 0x0a, 0xf2, 0xcf, 0x41, 0xbc, 0x02, 0x00, 0x00, 0xcc, 0xc7, 0x41,
+ 0xbd, 0x02, 0x00, 0x00, 0xcd, 0xc8, 0x04, 0x37, 0x01, 0x00, 0x00, 0xac, 0x6a, 0xc2, 0x00, 0x00,
+ 0x00, 0xc9, 0x04, 0x36, 0x01, 0x00, 0x00, 0xac, 0xec, 0x2c, 0xd3, 0x41, 0x1a, 0x01, 0x00, 0x00,
+ 0xe0, 0xad, 0xec, 0x22, 0xe1, 0xd3, 0x04, 0xc0, 0x02, 0x00, 0x00, 0xe0, 0x9e, 0x04, 0xa5, 0x02,
+ 0x00, 0x00, 0x9e, 0x04, 0xc1, 0x02, 0x00, 0x00, 0x9e, 0xd3, 0x41, 0x1a, 0x01, 0x00, 0x00, 0x9e,
+ 0xf2, 0x0e, 0xef, 0x8c, 0x00, 0xc9, 0x04, 0x37, 0x01, 0x00, 0x00, 0xac, 0xec, 0x2b, 0xd3, 0x41,
+ 0x1a, 0x01, 0x00, 0x00, 0xe2, 0xad, 0xec, 0x21, 0xe1, 0xd3, 0x04, 0xc2, 0x02, 0x00, 0x00, 0xe2,
+ 0x9e, 0x04, 0xa5, 0x02, 0x00, 0x00, 0x9e, 0x04, 0xc1, 0x02, 0x00, 0x00, 0x9e, 0xd3, 0x41, 0x1a,
+ 0x01, 0x00, 0x00, 0x9e, 0xf2, 0x0e, 0xee, 0x58, 0xd3, 0x41, 0x74, 0x02, 0x00, 0x00, 0xce, 0xd3,
+ 0x41, 0x70, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x70, 0x02, 0x00, 0x00, 0xeb, 0xb8, 0x9f, 0x47, 0x11,
+ 0xed, 0x03, 0x0e, 0xd3, 0xc5, 0x04, 0xca, 0x41, 0x79, 0x02, 0x00, 0x00, 0xc4, 0x04, 0x41, 0x79,
+ 0x02, 0x00, 0x00, 0xac, 0xec, 0x1b, 0xca, 0x38, 0x97, 0x00, 0x00, 0x00, 0x42, 0x2a, 0x01, 0x00,
+ 0x00, 0xc4, 0x04, 0x41, 0x79, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x43, 0x79, 0x02, 0x00, 0x00,
+ 0xca, 0x41, 0x79, 0x02, 0x00, 0x00, 0xc9, 0x73, 0xd3, 0x41, 0x1a, 0x01, 0x00, 0x00, 0x49, 0xd3,
+ 0x41, 0x78, 0x02, 0x00, 0x00, 0x42, 0x85, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x19, 0x01, 0x00, 0x00,
+ 0xd3, 0x41, 0x1a, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xee, 0x3c, 0xd3,
+ 0x41, 0x74, 0x02, 0x00, 0x00, 0x41, 0xb9, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x19, 0x01, 0x00, 0x00,
+ 0x73, 0xd3, 0x41, 0x1a, 0x01, 0x00, 0x00, 0x49, 0x5e, 0x04, 0x00, 0xd3, 0x04, 0xc3, 0x02, 0x00,
+ 0x00, 0x0b, 0xd3, 0x41, 0x19, 0x01, 0x00, 0x00, 0x4c, 0x37, 0x00, 0x00, 0x00, 0xd3, 0x41, 0x1a,
+ 0x01, 0x00, 0x00, 0x4c, 0x41, 0x00, 0x00, 0x00, 0xf3, 0x0e, 0xd3, 0xd3, 0xc3, 0x15, 0x43, 0x1a,
+ 0x01, 0x00, 0x00, 0x43, 0x19, 0x01, 0x00, 0x00, 0x29, 0xc6, 0x03, 0xcd, 0x05, 0x24, 0x03, 0x30,
+ 0x73, 0x85, 0x8a, 0x4a, 0x09, 0x53, 0x30, 0x26, 0x27, 0x40, 0x62, 0x26, 0x44, 0x35, 0x71, 0x26,
+ 0x44, 0x35, 0x0d, 0x26, 0x76, 0x53, 0x86, 0x00, 0x0f, 0x0e, 0x99, 0x0e, 0x80, 0x35, 0x3a, 0x3a,
+ 0x0f, 0x49, 0x0e, 0x43, 0x06, 0x01, 0x94, 0x04, 0x02, 0x0d, 0x02, 0x06, 0x04, 0x01, 0xd3, 0x04,
+ 0x0f, 0xca, 0x03, 0x00, 0x01, 0x40, 0x88, 0x0b, 0x00, 0x01, 0x00, 0xe8, 0x09, 0x00, 0x00, 0x40,
+ 0xfe, 0x0a, 0x00, 0x01, 0x00, 0xf0, 0x0a, 0x00, 0x02, 0x00, 0x86, 0x0a, 0x00, 0x03, 0x00, 0x90,
+ 0x0a, 0x00, 0x04, 0x00, 0x8a, 0x0b, 0x00, 0x05, 0x00, 0x6e, 0x00, 0x06, 0x00, 0x82, 0x01, 0x00,
+ 0x07, 0x00, 0xf6, 0x0a, 0x00, 0x08, 0x00, 0xf8, 0x0a, 0x00, 0x09, 0x00, 0xfa, 0x0a, 0x00, 0x0a,
+ 0x00, 0x8c, 0x0b, 0x00, 0x0b, 0x00, 0x84, 0x0a, 0x00, 0x0c, 0x00, 0x82, 0x04, 0x1c, 0x00, 0x90,
+ 0x04, 0x23, 0x00, 0x8c, 0x04, 0x21, 0x00, 0xfc, 0x03, 0x19, 0x00, 0xd3, 0x41, 0x62, 0x02, 0x00,
+ 0x00, 0x41, 0x37, 0x01, 0x00, 0x00, 0x6a, 0xa8, 0x01, 0x00, 0x00, 0xd3, 0x41, 0x74, 0x02, 0x00,
+ 0x00, 0xcb, 0xe0, 0xd3, 0x41, 0x14, 0x01, 0x00, 0x00, 0xf1, 0xcc, 0xc7, 0xc8, 0x41, 0xbc, 0x02,
+ 0x00, 0x00, 0x43, 0xbc, 0x02, 0x00, 0x00, 0xc7, 0xc8, 0x41, 0xbd, 0x02, 0x00, 0x00, 0x43, 0xbd,
+ 0x02, 0x00, 0x00, 0xc7, 0xc7, 0x41, 0x79, 0x02, 0x00, 0x00, 0xc8, 0x41, 0xbc, 0x02, 0x00, 0x00,
+ 0x47, 0x11, 0xed, 0x03, 0x0e, 0xc3, 0x43, 0xc6, 0x02, 0x00, 0x00, 0xc7, 0x41, 0xbc, 0x02, 0x00,
+ 0x00, 0xec, 0x33, 0xc7, 0x41, 0xc6, 0x02, 0x00, 0x00, 0x97, 0xec, 0x2a, 0xe1, 0xd3, 0x04, 0xc7,
+ 0x02, 0x00, 0x00, 0x38, 0xa0, 0x00, 0x00, 0x00, 0x42, 0xc8, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x14,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x9e, 0xf2, 0x0e, 0xc7, 0xc8, 0x41, 0xbc, 0x02, 0x00, 0x00,
+ 0x43, 0xc6, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x70, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x70, 0x02, 0x00,
+ 0x00, 0xeb, 0xb8, 0x9f, 0x47, 0x11, 0xed, 0x03, 0x0e, 0xd3, 0xcd, 0xc7, 0x41, 0x79, 0x02, 0x00,
+ 0x00, 0xec, 0x2e, 0xc9, 0x41, 0x79, 0x02, 0x00, 0x00, 0xc7, 0x41, 0x79, 0x02, 0x00, 0x00, 0xad,
+ 0xec, 0x1f, 0x38, 0x97, 0x00, 0x00, 0x00, 0x42, 0x2b, 0x01, 0x00, 0x00, 0xc7, 0x41, 0x79, 0x02,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x42, 0x5f, 0x02, 0x00, 0x00, 0xc2, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xb7, 0xce, 0xd3, 0x41, 0x78, 0x02, 0x00, 0x00, 0xeb, 0xc5, 0x04, 0xca, 0xc4, 0x04, 0xa4, 0x6a,
+ 0xc3, 0x00, 0x00, 0x00, 0xd3, 0x41, 0x78, 0x02, 0x00, 0x00, 0xca, 0x47, 0xc6, 0x05, 0xb7, 0x47,
+ 0xc5, 0x06, 0xc4, 0x05, 0xb8, 0x47, 0xc5, 0x07, 0xe0, 0xc4, 0x06, 0x0a, 0xf2, 0xc6, 0x08, 0x41,
+ 0xbc, 0x02, 0x00, 0x00, 0xc5, 0x09, 0xc4, 0x08, 0x41, 0xbd, 0x02, 0x00, 0x00, 0xc5, 0x0a, 0xc4,
+ 0x09, 0xc3, 0xac, 0xec, 0x04, 0xc3, 0xee, 0x0f, 0xc7, 0x41, 0x79, 0x02, 0x00, 0x00, 0xc4, 0x09,
+ 0x47, 0x11, 0xed, 0x03, 0x0e, 0xc3, 0xc5, 0x0b, 0x0b, 0xc4, 0x06, 0x4c, 0x37, 0x00, 0x00, 0x00,
+ 0xc4, 0x07, 0x4c, 0x41, 0x00, 0x00, 0x00, 0xc4, 0x09, 0x4c, 0xbc, 0x02, 0x00, 0x00, 0xc4, 0x0a,
+ 0x4c, 0xbd, 0x02, 0x00, 0x00, 0xc4, 0x0b, 0x4c, 0xc6, 0x02, 0x00, 0x00, 0xc5, 0x0c, 0xc4, 0x09,
+ 0xec, 0x32, 0xc4, 0x09, 0x04, 0x37, 0x01, 0x00, 0x00, 0xad, 0xec, 0x28, 0xc4, 0x0b, 0x97, 0xec,
+ 0x23, 0xe1, 0xd3, 0x04, 0xc7, 0x02, 0x00, 0x00, 0x38, 0xa0, 0x00, 0x00, 0x00, 0x42, 0xc8, 0x02,
+ 0x00, 0x00, 0xc4, 0x09, 0x24, 0x01, 0x00, 0x9e, 0xf2, 0x0e, 0xc4, 0x0c, 0xc4, 0x09, 0x43, 0xc6,
+ 0x02, 0x00, 0x00, 0xd3, 0x41, 0x74, 0x02, 0x00, 0x00, 0x41, 0xb9, 0x02, 0x00, 0x00, 0xc4, 0x06,
+ 0xc4, 0x0c, 0x49, 0xdf, 0xd3, 0x04, 0xc3, 0x02, 0x00, 0x00, 0xc4, 0x0c, 0xf3, 0x0e, 0x94, 0x03,
+ 0xef, 0x3a, 0xff, 0xd3, 0x41, 0x78, 0x02, 0x00, 0x00, 0xb7, 0x43, 0x30, 0x00, 0x00, 0x00, 0xd3,
+ 0x41, 0x74, 0x02, 0x00, 0x00, 0xd4, 0x97, 0x97, 0x43, 0xc9, 0x02, 0x00, 0x00, 0xd3, 0x0a, 0x43,
+ 0x71, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x70, 0x02, 0x00, 0x00, 0x42, 0x85, 0x02, 0x00, 0x00, 0xd3,
+ 0x41, 0x74, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xdf, 0xd3, 0x04, 0x64, 0x02, 0x00, 0x00,
+ 0xd3, 0x41, 0x74, 0x02, 0x00, 0x00, 0xf3, 0x0e, 0xd4, 0x97, 0xec, 0x48, 0xd3, 0x41, 0x75, 0x02,
+ 0x00, 0x00, 0x97, 0xec, 0x25, 0xd3, 0x41, 0x14, 0x01, 0x00, 0x00, 0x42, 0x6d, 0x02, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0x04, 0x1c, 0x01, 0x00, 0x00, 0xac, 0xec, 0x0f, 0xd3, 0xe2, 0x41, 0x58, 0x01,
+ 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x0d, 0xd3, 0xe2, 0x41, 0x3a, 0x01, 0x00, 0x00,
+ 0x43, 0x76, 0x02, 0x00, 0x00, 0xd3, 0x07, 0x43, 0x74, 0x02, 0x00, 0x00, 0xd3, 0xc3, 0x43, 0x14,
+ 0x01, 0x00, 0x00, 0xd3, 0xd3, 0xc3, 0x15, 0x43, 0x1a, 0x01, 0x00, 0x00, 0x43, 0x19, 0x01, 0x00,
+ 0x00, 0xd3, 0x41, 0x78, 0x02, 0x00, 0x00, 0xb7, 0x43, 0x30, 0x00, 0x00, 0x00, 0x29, 0xc6, 0x03,
+ 0x81, 0x06, 0x39, 0x03, 0x54, 0x28, 0x30, 0x3f, 0x3f, 0x7c, 0x58, 0x26, 0x71, 0x41, 0x71, 0x76,
+ 0x00, 0x18, 0x0a, 0x00, 0x06, 0x0c, 0x67, 0x2b, 0x21, 0x21, 0x1c, 0x30, 0x30, 0x80, 0x08, 0x26,
+ 0x26, 0x26, 0x26, 0x26, 0x00, 0x02, 0x08, 0x62, 0x26, 0x5d, 0x31, 0x53, 0x3a, 0x1c, 0x41, 0x4b,
+ 0x26, 0x6c, 0x4e, 0x18, 0x9e, 0x3f, 0x0d, 0x40, 0x26, 0x27, 0x49, 0x3f, 0x0e, 0x43, 0x06, 0x01,
+ 0x00, 0x01, 0x00, 0x01, 0x06, 0x03, 0x00, 0x1d, 0x01, 0x94, 0x0b, 0x00, 0x01, 0x00, 0x82, 0x04,
+ 0x00, 0x00, 0xca, 0x03, 0x00, 0x03, 0xe8, 0x09, 0x00, 0x01, 0xdf, 0xe0, 0x04, 0xcb, 0x02, 0x00,
+ 0x00, 0x0b, 0xd3, 0x4c, 0xbc, 0x02, 0x00, 0x00, 0xe1, 0x41, 0x79, 0x02, 0x00, 0x00, 0xd3, 0x47,
+ 0x4c, 0xc6, 0x02, 0x00, 0x00, 0xf3, 0x29, 0xc6, 0x03, 0x94, 0x06, 0x05, 0x03, 0x2b, 0x21, 0x44,
+ 0x08, 0x0e, 0x43, 0x06, 0x01, 0x96, 0x04, 0x01, 0x09, 0x01, 0x05, 0x03, 0x01, 0xa4, 0x04, 0x0a,
+ 0xca, 0x03, 0x00, 0x01, 0x40, 0x98, 0x0b, 0x00, 0x00, 0x00, 0xa8, 0x04, 0x00, 0x01, 0x00, 0x9a,
+ 0x0b, 0x00, 0x02, 0x00, 0xda, 0x04, 0x00, 0x03, 0x00, 0xfe, 0x03, 0x00, 0x04, 0x00, 0xe8, 0x09,
+ 0x00, 0x05, 0x40, 0x9c, 0x0b, 0x00, 0x06, 0x00, 0x86, 0x0a, 0x00, 0x07, 0x00, 0xf0, 0x0a, 0x00,
+ 0x08, 0x00, 0x82, 0x04, 0x1c, 0x00, 0x8c, 0x04, 0x21, 0x00, 0xfc, 0x03, 0x19, 0x00, 0xd3, 0x41,
+ 0x14, 0x01, 0x00, 0x00, 0x97, 0xec, 0x28, 0xe0, 0xd3, 0x04, 0xcf, 0x02, 0x00, 0x00, 0xf2, 0x0e,
+ 0xd3, 0x42, 0x13, 0x01, 0x00, 0x00, 0x04, 0xd0, 0x02, 0x00, 0x00, 0x9e, 0x43, 0x13, 0x01, 0x00,
+ 0x00, 0xd3, 0xe1, 0x41, 0x3a, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0x29, 0xd3, 0x41,
+ 0x1c, 0x01, 0x00, 0x00, 0xec, 0x57, 0xd3, 0x41, 0x14, 0x01, 0x00, 0x00, 0x04, 0x1c, 0x01, 0x00,
+ 0x00, 0xad, 0xec, 0x33, 0xd3, 0x42, 0x1c, 0x01, 0x00, 0x00, 0x04, 0xd1, 0x02, 0x00, 0x00, 0xd3,
+ 0x41, 0x14, 0x01, 0x00, 0x00, 0x9e, 0x04, 0x5d, 0x01, 0x00, 0x00, 0x9e, 0x9e, 0x43, 0x1c, 0x01,
+ 0x00, 0x00, 0xd3, 0xc3, 0x43, 0x14, 0x01, 0x00, 0x00, 0xd3, 0xe1, 0x41, 0x58, 0x01, 0x00, 0x00,
+ 0x43, 0x76, 0x02, 0x00, 0x00, 0x29, 0xdf, 0xd3, 0x04, 0x8d, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x1c,
+ 0x01, 0x00, 0x00, 0xf3, 0x0e, 0xd3, 0xc3, 0x43, 0x1c, 0x01, 0x00, 0x00, 0xd3, 0x41, 0x70, 0x02,
+ 0x00, 0x00, 0xeb, 0xcb, 0xd3, 0x41, 0x14, 0x01, 0x00, 0x00, 0xcc, 0xd3, 0x41, 0x61, 0x02, 0x00,
+ 0x00, 0x97, 0xec, 0x0d, 0xc8, 0xd3, 0x41, 0x6f, 0x02, 0x00, 0x00, 0x48, 0x24, 0x00, 0x00, 0xcc,
+ 0xc8, 0xcd, 0xc7, 0x91, 0xcb, 0xec, 0x1e, 0xd3, 0x41, 0x70, 0x02, 0x00, 0x00, 0xc7, 0x47, 0xd2,
+ 0x41, 0x37, 0x00, 0x00, 0x00, 0xc9, 0xad, 0xec, 0x0c, 0xe0, 0xd3, 0x04, 0xd2, 0x02, 0x00, 0x00,
+ 0xf2, 0x0e, 0xee, 0xdf, 0xc7, 0xb7, 0xa4, 0xec, 0x3c, 0xe0, 0xd3, 0x04, 0xd3, 0x02, 0x00, 0x00,
+ 0xd3, 0x41, 0x14, 0x01, 0x00, 0x00, 0x9e, 0xf2, 0x0e, 0xd3, 0x42, 0x13, 0x01, 0x00, 0x00, 0x04,
+ 0xd1, 0x02, 0x00, 0x00, 0xd3, 0x41, 0x14, 0x01, 0x00, 0x00, 0x9e, 0x04, 0x5d, 0x01, 0x00, 0x00,
+ 0x9e, 0x9e, 0x43, 0x13, 0x01, 0x00, 0x00, 0xd3, 0xe1, 0x41, 0x3a, 0x01, 0x00, 0x00, 0x43, 0x76,
+ 0x02, 0x00, 0x00, 0x29, 0xd3, 0xc8, 0x43, 0x14, 0x01, 0x00, 0x00, 0xd3, 0x41, 0x70, 0x02, 0x00,
+ 0x00, 0xeb, 0xc5, 0x04, 0xc4, 0x04, 0x91, 0xc5, 0x04, 0xc7, 0xa6, 0x6a, 0xbc, 0x00, 0x00, 0x00,
+ 0xd3, 0xd3, 0x41, 0x70, 0x02, 0x00, 0x00, 0x42, 0xd4, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00, 0x15,
+ 0x43, 0x74, 0x02, 0x00, 0x00, 0xc5, 0x05, 0xd3, 0xd3, 0x41, 0x74, 0x02, 0x00, 0x00, 0x41, 0x37,
+ 0x00, 0x00, 0x00, 0x43, 0x14, 0x01, 0x00, 0x00, 0xdf, 0xd3, 0x04, 0x65, 0x02, 0x00, 0x00, 0xd3,
+ 0x41, 0x14, 0x01, 0x00, 0x00, 0xf3, 0x0e, 0x0b, 0xc5, 0x06, 0xc4, 0x05, 0x41, 0x79, 0x02, 0x00,
+ 0x00, 0x7e, 0xee, 0x13, 0xc5, 0x07, 0xc4, 0x06, 0xc4, 0x07, 0x73, 0xc4, 0x05, 0x41, 0x79, 0x02,
+ 0x00, 0x00, 0xc4, 0x07, 0x47, 0x49, 0x81, 0xec, 0xec, 0x0e, 0x0e, 0xd3, 0x41, 0x70, 0x02, 0x00,
+ 0x00, 0xd3, 0x41, 0x70, 0x02, 0x00, 0x00, 0xeb, 0xb8, 0x9f, 0x47, 0x11, 0xed, 0x03, 0x0e, 0xd3,
+ 0xc5, 0x08, 0xd3, 0x41, 0x62, 0x02, 0x00, 0x00, 0x41, 0x37, 0x01, 0x00, 0x00, 0x6a, 0x76, 0xff,
+ 0xff, 0xff, 0xc4, 0x05, 0x41, 0x79, 0x02, 0x00, 0x00, 0xc4, 0x08, 0x41, 0x79, 0x02, 0x00, 0x00,
+ 0xad, 0x6a, 0x62, 0xff, 0xff, 0xff, 0x38, 0x97, 0x00, 0x00, 0x00, 0x42, 0x2b, 0x01, 0x00, 0x00,
+ 0xc4, 0x05, 0x41, 0x79, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x42, 0x5f, 0x02, 0x00, 0x00, 0xc2,
+ 0x00, 0x24, 0x01, 0x00, 0x0e, 0xef, 0x3e, 0xff, 0xc7, 0xb7, 0xac, 0xec, 0x08, 0xd3, 0x0a, 0x43,
+ 0x72, 0x02, 0x00, 0x00, 0xd3, 0xd3, 0xd3, 0xc3, 0x15, 0x43, 0x19, 0x01, 0x00, 0x00, 0x15, 0x43,
+ 0x1a, 0x01, 0x00, 0x00, 0x43, 0x14, 0x01, 0x00, 0x00, 0xd3, 0x41, 0x78, 0x02, 0x00, 0x00, 0xb7,
+ 0x43, 0x30, 0x00, 0x00, 0x00, 0xd3, 0xe1, 0x41, 0x3a, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00,
+ 0x00, 0x29, 0xc6, 0x03, 0xd0, 0x06, 0x34, 0x03, 0x30, 0x30, 0x58, 0x40, 0x09, 0x2b, 0x49, 0x99,
+ 0x26, 0x40, 0x08, 0x4e, 0x00, 0x07, 0x0a, 0x2b, 0x26, 0x30, 0x40, 0x0d, 0x1c, 0x2b, 0x36, 0x30,
+ 0x00, 0x02, 0x0c, 0x1c, 0x53, 0x99, 0x40, 0x08, 0x26, 0x30, 0x3f, 0x76, 0x58, 0x4f, 0x12, 0x3f,
+ 0x53, 0x1d, 0x76, 0xb8, 0x82, 0x22, 0x12, 0x3f, 0x6c, 0x3f, 0x3f, 0x0e, 0x43, 0x06, 0x01, 0x00,
+ 0x01, 0x01, 0x01, 0x05, 0x03, 0x00, 0x1f, 0x02, 0x94, 0x0b, 0x00, 0x01, 0x00, 0xaa, 0x0b, 0x00,
+ 0x00, 0x00, 0xe8, 0x09, 0x05, 0x01, 0x82, 0x04, 0x00, 0x00, 0xca, 0x03, 0x00, 0x03, 0xdf, 0x41,
+ 0x79, 0x02, 0x00, 0x00, 0xd3, 0x47, 0xcb, 0xe0, 0xe1, 0x04, 0xd6, 0x02, 0x00, 0x00, 0x0b, 0xd3,
+ 0x4c, 0xbc, 0x02, 0x00, 0x00, 0xc7, 0x4c, 0xc6, 0x02, 0x00, 0x00, 0xf3, 0x29, 0xc6, 0x03, 0x8b,
+ 0x07, 0x03, 0x03, 0x30, 0x6c, 0x0e, 0x43, 0x06, 0x01, 0x98, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01,
+ 0x02, 0xf1, 0x01, 0x05, 0xca, 0x03, 0x00, 0x01, 0x00, 0xb0, 0x04, 0x00, 0x00, 0x00, 0xae, 0x0b,
+ 0x00, 0x01, 0x00, 0xb0, 0x0b, 0x00, 0x02, 0x00, 0xb2, 0x0b, 0x00, 0x03, 0x00, 0x8c, 0x04, 0x21,
+ 0x00, 0xd3, 0x41, 0x18, 0x01, 0x00, 0x00, 0xcf, 0x42, 0x6d, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00,
+ 0xcc, 0xc3, 0xce, 0xd3, 0x41, 0x5e, 0x02, 0x00, 0x00, 0xc7, 0x47, 0xec, 0x0a, 0xd3, 0x41, 0x5e,
+ 0x02, 0x00, 0x00, 0xc7, 0x47, 0x28, 0xd3, 0x41, 0x5e, 0x02, 0x00, 0x00, 0xc8, 0x47, 0xec, 0x0a,
+ 0xd3, 0x41, 0x5e, 0x02, 0x00, 0x00, 0xc8, 0x47, 0x28, 0xc8, 0xcf, 0x42, 0x0e, 0x01, 0x00, 0x00,
+ 0xb7, 0x24, 0x01, 0x00, 0x04, 0xda, 0x02, 0x00, 0x00, 0xac, 0xec, 0x55, 0xc7, 0x42, 0x0e, 0x01,
+ 0x00, 0x00, 0xb8, 0x24, 0x01, 0x00, 0x04, 0xce, 0x02, 0x00, 0x00, 0xac, 0xec, 0x23, 0xc7, 0x42,
+ 0xdb, 0x02, 0x00, 0x00, 0xb9, 0x24, 0x01, 0x00, 0xcb, 0x38, 0xdc, 0x02, 0x00, 0x00, 0xc7, 0xbf,
+ 0x10, 0xf2, 0xd1, 0x42, 0x38, 0x00, 0x00, 0x00, 0xbf, 0x10, 0x24, 0x01, 0x00, 0xce, 0xee, 0x21,
+ 0xc7, 0x42, 0xdb, 0x02, 0x00, 0x00, 0xb8, 0x24, 0x01, 0x00, 0xcb, 0x38, 0xdc, 0x02, 0x00, 0x00,
+ 0xc7, 0xbf, 0x0a, 0xf2, 0xd1, 0x42, 0x38, 0x00, 0x00, 0x00, 0xbf, 0x0a, 0x24, 0x01, 0x00, 0xce,
+ 0xc7, 0x42, 0xb1, 0x02, 0x00, 0x00, 0xc1, 0x00, 0xc1, 0x01, 0x33, 0xc3, 0x24, 0x02, 0x00, 0xcb,
+ 0x38, 0xdd, 0x02, 0x00, 0x00, 0xc9, 0xf1, 0x11, 0xed, 0x0d, 0x0e, 0xca, 0x42, 0x6d, 0x02, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0xc7, 0xad, 0xec, 0x1d, 0xdf, 0xd3, 0x04, 0xde, 0x02, 0x00, 0x00, 0xf2,
+ 0x0e, 0x04, 0x5b, 0x01, 0x00, 0x00, 0xd3, 0x41, 0x18, 0x01, 0x00, 0x00, 0x9e, 0x04, 0xdf, 0x02,
+ 0x00, 0x00, 0x9e, 0x28, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x42, 0x60, 0x02, 0x00, 0x00, 0xc9, 0x25,
+ 0x01, 0x00, 0xc6, 0x03, 0x97, 0x07, 0x19, 0x03, 0x21, 0x36, 0x0e, 0x35, 0x2b, 0x08, 0x35, 0x2b,
+ 0x08, 0x0d, 0x58, 0x5d, 0x3a, 0x35, 0x3a, 0x0d, 0x3a, 0x35, 0x3c, 0x53, 0x7b, 0x30, 0x5d, 0x09,
+ 0x07, 0x06, 0x5e, 0x30, 0x2b, 0x07, 0x5a, 0x00, 0x01, 0x00, 0x26, 0x00, 0x00, 0x00, 0x08, 0x06,
+ 0x00, 0x00, 0x00, 0x04, 0x07, 0xf5, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x05, 0x1c, 0x04, 0x00, 0x00,
+ 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00,
+ 0x0a, 0x0c, 0x00, 0x0a, 0x0e, 0x43, 0x06, 0x01, 0x9a, 0x04, 0x02, 0x00, 0x02, 0x03, 0x03, 0x00,
+ 0x45, 0x02, 0xca, 0x03, 0x00, 0x01, 0x00, 0xd0, 0x09, 0x00, 0x01, 0x00, 0xfc, 0x03, 0x19, 0x00,
+ 0xf2, 0x03, 0x14, 0x00, 0x8c, 0x04, 0x21, 0x00, 0xd4, 0x04, 0x5f, 0x01, 0x00, 0x00, 0xac, 0xec,
+ 0x1a, 0xd3, 0xdf, 0x41, 0x3c, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xd3, 0xd3, 0x41,
+ 0x7a, 0x02, 0x00, 0x00, 0x43, 0xe0, 0x02, 0x00, 0x00, 0x29, 0xe0, 0xd4, 0xf1, 0x97, 0xec, 0x1d,
+ 0xe1, 0xd3, 0x04, 0xe1, 0x02, 0x00, 0x00, 0xf2, 0x0e, 0xd3, 0xd4, 0x43, 0x13, 0x01, 0x00, 0x00,
+ 0xd3, 0xdf, 0x41, 0x3a, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0x29, 0xc6, 0x03, 0xb8,
+ 0x07, 0x08, 0x03, 0x30, 0x3f, 0x3f, 0x28, 0x30, 0x26, 0x40, 0x0e, 0x43, 0x06, 0x01, 0x9c, 0x04,
+ 0x02, 0x01, 0x02, 0x03, 0x00, 0x00, 0x15, 0x03, 0xbc, 0x0a, 0x00, 0x01, 0x00, 0x86, 0x0a, 0x00,
+ 0x01, 0x00, 0xc4, 0x0b, 0x00, 0x00, 0x00, 0xc3, 0xcb, 0xd4, 0xd3, 0xeb, 0xa4, 0xec, 0x0c, 0xd3,
+ 0x42, 0x0e, 0x01, 0x00, 0x00, 0xd4, 0x24, 0x01, 0x00, 0xcb, 0xc7, 0x28, 0xc6, 0x03, 0xc5, 0x07,
+ 0x04, 0x03, 0x0d, 0x21, 0x3b, 0x0e, 0x43, 0x06, 0x01, 0x9e, 0x04, 0x01, 0x08, 0x01, 0x08, 0x19,
+ 0x00, 0xfc, 0x1e, 0x09, 0xbc, 0x0a, 0x00, 0x01, 0x00, 0xca, 0x03, 0x00, 0x00, 0x00, 0x86, 0x0a,
+ 0x00, 0x01, 0x00, 0xd0, 0x09, 0x00, 0x02, 0x00, 0xc6, 0x0b, 0x00, 0x03, 0x00, 0xc8, 0x0b, 0x00,
+ 0x04, 0x00, 0xca, 0x0b, 0x00, 0x05, 0x00, 0xcc, 0x0b, 0x00, 0x06, 0x00, 0x10, 0x00, 0x01, 0x00,
+ 0x88, 0x04, 0x1f, 0x00, 0x8a, 0x04, 0x20, 0x00, 0x9c, 0x04, 0x29, 0x00, 0xfc, 0x03, 0x19, 0x00,
+ 0x9a, 0x04, 0x28, 0x00, 0xf2, 0x03, 0x14, 0x00, 0x8c, 0x04, 0x21, 0x00, 0xf8, 0x03, 0x17, 0x00,
+ 0xea, 0x03, 0x10, 0x00, 0xe0, 0x03, 0x0b, 0x00, 0x82, 0x04, 0x1c, 0x00, 0xe2, 0x03, 0x0c, 0x00,
+ 0xf4, 0x03, 0x15, 0x00, 0x86, 0x04, 0x1e, 0x00, 0xec, 0x03, 0x11, 0x00, 0x8e, 0x04, 0x22, 0x00,
+ 0x94, 0x04, 0x25, 0x00, 0x96, 0x04, 0x26, 0x00, 0x92, 0x04, 0x24, 0x00, 0xf6, 0x03, 0x16, 0x00,
+ 0xfa, 0x03, 0x18, 0x00, 0x98, 0x04, 0x27, 0x00, 0xf0, 0x03, 0x13, 0x00, 0xee, 0x03, 0x12, 0x00,
+ 0xd6, 0x03, 0x04, 0x00, 0x08, 0xc5, 0x07, 0xc4, 0x07, 0xcb, 0xc4, 0x07, 0x41, 0x04, 0x01, 0x00,
+ 0x00, 0xec, 0x09, 0xc4, 0x07, 0x41, 0x04, 0x01, 0x00, 0x00, 0x2f, 0xc7, 0x41, 0x73, 0x02, 0x00,
+ 0x00, 0xec, 0x0b, 0xdf, 0xc7, 0x04, 0xe7, 0x02, 0x00, 0x00, 0x23, 0x02, 0x00, 0xd3, 0xf5, 0xec,
+ 0x06, 0xe0, 0xc7, 0x23, 0x01, 0x00, 0xd3, 0x98, 0x04, 0x4a, 0x00, 0x00, 0x00, 0xac, 0xec, 0x0b,
+ 0xd3, 0x42, 0x38, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xd7, 0xb7, 0xcc, 0xc3, 0xcd, 0xe1, 0xd3,
+ 0xc8, 0x92, 0xcc, 0xf2, 0xcd, 0xc7, 0xc9, 0x43, 0x68, 0x02, 0x00, 0x00, 0xc9, 0x97, 0x6b, 0x0a,
+ 0x0f, 0x00, 0x00, 0xc7, 0x41, 0x7b, 0x02, 0x00, 0x00, 0xec, 0x37, 0xc7, 0x42, 0x7a, 0x02, 0x00,
+ 0x00, 0x90, 0x43, 0x7a, 0x02, 0x00, 0x00, 0xc9, 0x04, 0xa5, 0x02, 0x00, 0x00, 0xac, 0xec, 0x16,
+ 0xc7, 0x42, 0x7d, 0x02, 0x00, 0x00, 0x90, 0x43, 0x7d, 0x02, 0x00, 0x00, 0xc7, 0xb7, 0x43, 0x7c,
+ 0x02, 0x00, 0x00, 0xee, 0x0d, 0xc7, 0x42, 0x7c, 0x02, 0x00, 0x00, 0x90, 0x43, 0x7c, 0x02, 0x00,
+ 0x00, 0xc7, 0x41, 0x76, 0x02, 0x00, 0x00, 0x11, 0xe2, 0x41, 0x38, 0x01, 0x00, 0x00, 0xac, 0xec,
+ 0x24, 0xc7, 0xe2, 0x41, 0x39, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc9, 0x04, 0xe8,
+ 0x02, 0x00, 0x00, 0xac, 0xec, 0x04, 0x0e, 0xee, 0x86, 0x5e, 0x04, 0x00, 0xc7, 0xc9, 0xf2, 0x0e,
+ 0x0e, 0xef, 0x7c, 0xff, 0x11, 0xe2, 0x41, 0x39, 0x01, 0x00, 0x00, 0xac, 0xec, 0x0c, 0x5e, 0x04,
+ 0x00, 0xc7, 0xc9, 0xf2, 0x0e, 0x0e, 0xef, 0x67, 0xff, 0x11, 0xe2, 0x41, 0x3a, 0x01, 0x00, 0x00,
+ 0xac, 0x6a, 0x25, 0x01, 0x00, 0x00, 0xc7, 0x41, 0x71, 0x02, 0x00, 0x00, 0x6a, 0x8b, 0x00, 0x00,
+ 0x00, 0xc7, 0x41, 0x72, 0x02, 0x00, 0x00, 0x97, 0x6a, 0x7f, 0x00, 0x00, 0x00, 0xc8, 0xb8, 0x9f,
+ 0xce, 0xc9, 0xec, 0x5c, 0xc9, 0x04, 0x5f, 0x01, 0x00, 0x00, 0xad, 0xec, 0x53, 0xc9, 0x04, 0x5b,
+ 0x01, 0x00, 0x00, 0xad, 0xec, 0x4a, 0xe1, 0xd3, 0xc8, 0x92, 0xcc, 0xf2, 0xd1, 0xec, 0xe3, 0xc7,
+ 0x41, 0x7b, 0x02, 0x00, 0x00, 0xec, 0xdb, 0xc7, 0x42, 0x7a, 0x02, 0x00, 0x00, 0x90, 0x43, 0x7a,
+ 0x02, 0x00, 0x00, 0xc9, 0x04, 0xa5, 0x02, 0x00, 0x00, 0xac, 0xec, 0x16, 0xc7, 0x42, 0x7d, 0x02,
+ 0x00, 0x00, 0x90, 0x43, 0x7d, 0x02, 0x00, 0x00, 0xc7, 0xb7, 0x43, 0x7c, 0x02, 0x00, 0x00, 0xee,
+ 0xb1, 0xc7, 0x42, 0x7c, 0x02, 0x00, 0x00, 0x90, 0x43, 0x7c, 0x02, 0x00, 0x00, 0xee, 0xa3, 0xc7,
+ 0x42, 0x13, 0x01, 0x00, 0x00, 0xd3, 0x42, 0xe9, 0x02, 0x00, 0x00, 0xca, 0xc8, 0xb8, 0x9f, 0x24,
+ 0x02, 0x00, 0x9e, 0x43, 0x13, 0x01, 0x00, 0x00, 0xc9, 0x04, 0x5f, 0x01, 0x00, 0x00, 0xac, 0xec,
+ 0x39, 0xc7, 0x41, 0x71, 0x02, 0x00, 0x00, 0x11, 0xec, 0x13, 0x0e, 0xc7, 0x41, 0x72, 0x02, 0x00,
+ 0x00, 0x11, 0xec, 0x09, 0x0e, 0xc7, 0x41, 0x61, 0x02, 0x00, 0x00, 0x97, 0x97, 0xec, 0x1b, 0xc7,
+ 0xe2, 0x41, 0x3c, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7, 0xc7, 0x41, 0x7a, 0x02,
+ 0x00, 0x00, 0x43, 0xe0, 0x02, 0x00, 0x00, 0xee, 0x4b, 0x5e, 0x05, 0x00, 0xc9, 0xf1, 0x97, 0xec,
+ 0x1f, 0xc7, 0x41, 0x71, 0x02, 0x00, 0x00, 0x97, 0x11, 0xed, 0x08, 0x0e, 0xc7, 0x41, 0x72, 0x02,
+ 0x00, 0x00, 0xec, 0x0c, 0x5e, 0x06, 0x00, 0xc7, 0x04, 0xea, 0x02, 0x00, 0x00, 0xf2, 0x0e, 0xc9,
+ 0x04, 0x5b, 0x01, 0x00, 0x00, 0xac, 0xec, 0x0f, 0xc7, 0xe2, 0x41, 0x3b, 0x01, 0x00, 0x00, 0x43,
+ 0x76, 0x02, 0x00, 0x00, 0xee, 0x0e, 0xc7, 0x42, 0x13, 0x01, 0x00, 0x00, 0xc9, 0x9e, 0x43, 0x13,
+ 0x01, 0x00, 0x00, 0x0e, 0xef, 0x39, 0xfe, 0x11, 0xe2, 0x41, 0x58, 0x01, 0x00, 0x00, 0xac, 0xec,
+ 0x29, 0xc9, 0x04, 0x5f, 0x01, 0x00, 0x00, 0xac, 0xec, 0x0f, 0xc7, 0xe2, 0x41, 0x59, 0x01, 0x00,
+ 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x0e, 0xc7, 0x42, 0x1c, 0x01, 0x00, 0x00, 0xc9, 0x9e,
+ 0x43, 0x1c, 0x01, 0x00, 0x00, 0x0e, 0xef, 0x07, 0xfe, 0x11, 0xe2, 0x41, 0x59, 0x01, 0x00, 0x00,
+ 0xac, 0xec, 0x3b, 0xc9, 0x04, 0xeb, 0x02, 0x00, 0x00, 0xac, 0xec, 0x0f, 0xc7, 0xe2, 0x41, 0x56,
+ 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x20, 0xc7, 0x42, 0x1c, 0x01, 0x00, 0x00,
+ 0x04, 0x5f, 0x01, 0x00, 0x00, 0xc9, 0x9e, 0x9e, 0x43, 0x1c, 0x01, 0x00, 0x00, 0xc7, 0xe2, 0x41,
+ 0x58, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0x0e, 0xef, 0xc3, 0xfd, 0x11, 0xe2, 0x41,
+ 0x3c, 0x01, 0x00, 0x00, 0xac, 0x6a, 0xfa, 0x00, 0x00, 0x00, 0xc9, 0x04, 0xec, 0x02, 0x00, 0x00,
+ 0xac, 0xec, 0x17, 0xc7, 0xe2, 0x41, 0x3d, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7,
+ 0xc3, 0x43, 0x12, 0x01, 0x00, 0x00, 0xef, 0xd5, 0x00, 0x5e, 0x05, 0x00, 0xc9, 0xf1, 0x6b, 0xcd,
+ 0x00, 0x00, 0x00, 0x5e, 0x07, 0x00, 0x5e, 0x08, 0x00, 0xc9, 0xf2, 0xec, 0x17, 0xc7, 0xe2, 0x41,
+ 0x4b, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7, 0xc9, 0x43, 0x14, 0x01, 0x00, 0x00,
+ 0xef, 0xab, 0x00, 0xc9, 0x04, 0xeb, 0x02, 0x00, 0x00, 0xac, 0xec, 0x17, 0xc7, 0xe2, 0x41, 0x56,
+ 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7, 0xc3, 0x43, 0x14, 0x01, 0x00, 0x00, 0xef,
+ 0x8c, 0x00, 0xc9, 0x04, 0xed, 0x02, 0x00, 0x00, 0xac, 0xec, 0x1d, 0xc7, 0xe2, 0x41, 0x48, 0x01,
+ 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7, 0xc7, 0xc3, 0x15, 0x43, 0x17, 0x01, 0x00, 0x00,
+ 0x43, 0x16, 0x01, 0x00, 0x00, 0xee, 0x66, 0x5e, 0x06, 0x00, 0xc7, 0x04, 0xee, 0x02, 0x00, 0x00,
+ 0xf2, 0x0e, 0xc7, 0x41, 0xe0, 0x02, 0x00, 0x00, 0xb8, 0x9e, 0xc7, 0x41, 0x7a, 0x02, 0x00, 0x00,
+ 0xa4, 0xec, 0x2b, 0xc7, 0x41, 0x7a, 0x02, 0x00, 0x00, 0xc7, 0x41, 0xe0, 0x02, 0x00, 0x00, 0x9f,
+ 0xc5, 0x04, 0x38, 0x98, 0x00, 0x00, 0x00, 0x11, 0xc4, 0x04, 0x21, 0x01, 0x00, 0x42, 0x5c, 0x00,
+ 0x00, 0x00, 0x04, 0xa4, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0xc9, 0x9e, 0xcd, 0xc7, 0x42, 0x13,
+ 0x01, 0x00, 0x00, 0x04, 0x5f, 0x01, 0x00, 0x00, 0xc9, 0x9e, 0x9e, 0x43, 0x13, 0x01, 0x00, 0x00,
+ 0xc7, 0xe2, 0x41, 0x3a, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0x0e, 0xef, 0xc0, 0xfc,
+ 0x11, 0xe2, 0x41, 0x3d, 0x01, 0x00, 0x00, 0xac, 0x6a, 0x20, 0x01, 0x00, 0x00, 0xc7, 0x41, 0x12,
+ 0x01, 0x00, 0x00, 0xc9, 0x9e, 0x42, 0x6e, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00, 0x5e, 0x09, 0x00,
+ 0xac, 0xec, 0x29, 0x5e, 0x0a, 0x00, 0xc7, 0x04, 0xef, 0x02, 0x00, 0x00, 0xf2, 0x0e, 0xc7, 0xe2,
+ 0x41, 0xf0, 0x00, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7, 0xc3, 0x43, 0x12, 0x01, 0x00,
+ 0x00, 0xc7, 0xc3, 0x43, 0x1b, 0x01, 0x00, 0x00, 0xef, 0xdc, 0x00, 0xc7, 0x41, 0x12, 0x01, 0x00,
+ 0x00, 0xc9, 0x9e, 0x04, 0xf0, 0x02, 0x00, 0x00, 0xac, 0xec, 0x1e, 0xc7, 0xe2, 0x41, 0x43, 0x01,
+ 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7, 0xc3, 0x43, 0x11, 0x01, 0x00, 0x00, 0xc7, 0xc3,
+ 0x43, 0x12, 0x01, 0x00, 0x00, 0xef, 0xaf, 0x00, 0xc7, 0x41, 0x12, 0x01, 0x00, 0x00, 0xc9, 0x9e,
+ 0x42, 0x6e, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00, 0x5e, 0x0b, 0x00, 0xac, 0xec, 0x3a, 0xc7, 0xe2,
+ 0x41, 0xf1, 0x00, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7, 0x41, 0x15, 0x01, 0x00, 0x00,
+ 0x11, 0xed, 0x08, 0x0e, 0xc7, 0x41, 0x71, 0x02, 0x00, 0x00, 0xec, 0x0c, 0x5e, 0x06, 0x00, 0xc7,
+ 0x04, 0xf1, 0x02, 0x00, 0x00, 0xf2, 0x0e, 0xc7, 0xc3, 0x43, 0x15, 0x01, 0x00, 0x00, 0xc7, 0xc3,
+ 0x43, 0x12, 0x01, 0x00, 0x00, 0xee, 0x5f, 0xc9, 0x04, 0x5d, 0x01, 0x00, 0x00, 0xac, 0xec, 0x27,
+ 0x5e, 0x0a, 0x00, 0xc7, 0x04, 0xf2, 0x02, 0x00, 0x00, 0xc7, 0x41, 0x12, 0x01, 0x00, 0x00, 0xf3,
+ 0x0e, 0xc7, 0xc3, 0x43, 0x12, 0x01, 0x00, 0x00, 0xc7, 0xe2, 0x41, 0x3a, 0x01, 0x00, 0x00, 0x43,
+ 0x76, 0x02, 0x00, 0x00, 0xee, 0x30, 0x5e, 0x0c, 0x00, 0xc9, 0xf1, 0xec, 0x1c, 0xc7, 0xe2, 0x41,
+ 0x3e, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7, 0x42, 0x12, 0x01, 0x00, 0x00, 0xc9,
+ 0x9e, 0x43, 0x12, 0x01, 0x00, 0x00, 0xee, 0x0e, 0xc7, 0x42, 0x12, 0x01, 0x00, 0x00, 0xc9, 0x9e,
+ 0x43, 0x12, 0x01, 0x00, 0x00, 0x0e, 0xef, 0x97, 0xfb, 0x11, 0xe2, 0x41, 0x3e, 0x01, 0x00, 0x00,
+ 0xac, 0xec, 0x2f, 0xc9, 0xc7, 0x41, 0x69, 0x02, 0x00, 0x00, 0xac, 0xec, 0x14, 0xc7, 0xe2, 0x41,
+ 0x3d, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7, 0xc3, 0x43, 0x69, 0x02, 0x00, 0x00,
+ 0xc7, 0x42, 0x12, 0x01, 0x00, 0x00, 0xc9, 0x9e, 0x43, 0x12, 0x01, 0x00, 0x00, 0x0e, 0xef, 0x5f,
+ 0xfb, 0x11, 0xe2, 0x41, 0xf1, 0x00, 0x00, 0x00, 0xac, 0xec, 0x72, 0xc9, 0x04, 0x5d, 0x01, 0x00,
+ 0x00, 0xac, 0xec, 0x27, 0xc7, 0xe2, 0x41, 0x3a, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00,
+ 0x5e, 0x0a, 0x00, 0xc7, 0x04, 0xf3, 0x02, 0x00, 0x00, 0xc7, 0x41, 0x15, 0x01, 0x00, 0x00, 0xf3,
+ 0x0e, 0xc7, 0x0a, 0x43, 0x15, 0x01, 0x00, 0x00, 0xee, 0x3f, 0xc7, 0x42, 0x15, 0x01, 0x00, 0x00,
+ 0xc9, 0x9e, 0x43, 0x15, 0x01, 0x00, 0x00, 0xc9, 0x04, 0xf4, 0x02, 0x00, 0x00, 0xac, 0xec, 0x0f,
+ 0xc7, 0xe2, 0x41, 0x40, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x1b, 0x5e, 0x0c,
+ 0x00, 0xc9, 0xf1, 0xec, 0x14, 0xc7, 0xe2, 0x41, 0x3f, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00,
+ 0x00, 0xc7, 0xc9, 0x43, 0x69, 0x02, 0x00, 0x00, 0x0e, 0xef, 0xe4, 0xfa, 0x11, 0xe2, 0x41, 0x3f,
+ 0x01, 0x00, 0x00, 0xac, 0xec, 0x2f, 0xc7, 0x42, 0x15, 0x01, 0x00, 0x00, 0xc9, 0x9e, 0x43, 0x15,
+ 0x01, 0x00, 0x00, 0xc9, 0xc7, 0x41, 0x69, 0x02, 0x00, 0x00, 0xac, 0xec, 0x14, 0xc7, 0xc3, 0x43,
+ 0x69, 0x02, 0x00, 0x00, 0xc7, 0xe2, 0x41, 0xf1, 0x00, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00,
+ 0x0e, 0xef, 0xac, 0xfa, 0x11, 0xe2, 0x41, 0x40, 0x01, 0x00, 0x00, 0xac, 0xec, 0x43, 0xc7, 0x42,
+ 0x15, 0x01, 0x00, 0x00, 0xc9, 0x9e, 0x43, 0x15, 0x01, 0x00, 0x00, 0xc9, 0x04, 0xf5, 0x02, 0x00,
+ 0x00, 0xac, 0xec, 0x0f, 0xc7, 0xe2, 0x41, 0xf1, 0x00, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00,
+ 0xee, 0x1b, 0x5e, 0x0c, 0x00, 0xc9, 0xf1, 0xec, 0x14, 0xc7, 0xe2, 0x41, 0x41, 0x01, 0x00, 0x00,
+ 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7, 0xc9, 0x43, 0x69, 0x02, 0x00, 0x00, 0x0e, 0xef, 0x60, 0xfa,
+ 0x11, 0xe2, 0x41, 0x41, 0x01, 0x00, 0x00, 0xac, 0xec, 0x2f, 0xc7, 0x42, 0x15, 0x01, 0x00, 0x00,
+ 0xc9, 0x9e, 0x43, 0x15, 0x01, 0x00, 0x00, 0xc9, 0xc7, 0x41, 0x69, 0x02, 0x00, 0x00, 0xac, 0xec,
+ 0x14, 0xc7, 0xe2, 0x41, 0x40, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7, 0xc3, 0x43,
+ 0x69, 0x02, 0x00, 0x00, 0x0e, 0xef, 0x28, 0xfa, 0x11, 0xe2, 0x41, 0x43, 0x01, 0x00, 0x00, 0xac,
+ 0xec, 0x29, 0xc9, 0x04, 0xf6, 0x02, 0x00, 0x00, 0xac, 0xec, 0x0f, 0xc7, 0xe2, 0x41, 0x44, 0x01,
+ 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x0e, 0xc7, 0x42, 0x11, 0x01, 0x00, 0x00, 0xc9,
+ 0x9e, 0x43, 0x11, 0x01, 0x00, 0x00, 0x0e, 0xef, 0xf6, 0xf9, 0x11, 0xe2, 0x41, 0x44, 0x01, 0x00,
+ 0x00, 0xac, 0xec, 0x71, 0xc9, 0x04, 0xf6, 0x02, 0x00, 0x00, 0xac, 0xec, 0x45, 0xc7, 0xe2, 0x41,
+ 0x45, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7, 0x5e, 0x0d, 0x00, 0xc7, 0x41, 0x62,
+ 0x02, 0x00, 0x00, 0xc7, 0x41, 0x11, 0x01, 0x00, 0x00, 0xf2, 0x43, 0x11, 0x01, 0x00, 0x00, 0xc7,
+ 0x41, 0x11, 0x01, 0x00, 0x00, 0xec, 0x12, 0x5e, 0x0a, 0x00, 0xc7, 0x04, 0xf7, 0x02, 0x00, 0x00,
+ 0xc7, 0x41, 0x11, 0x01, 0x00, 0x00, 0xf3, 0x0e, 0xc7, 0xc3, 0x43, 0x11, 0x01, 0x00, 0x00, 0xee,
+ 0x20, 0xc7, 0x42, 0x11, 0x01, 0x00, 0x00, 0x04, 0xf6, 0x02, 0x00, 0x00, 0xc9, 0x9e, 0x9e, 0x43,
+ 0x11, 0x01, 0x00, 0x00, 0xc7, 0xe2, 0x41, 0x43, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00,
+ 0x0e, 0xef, 0x7c, 0xf9, 0x11, 0xe2, 0x41, 0x45, 0x01, 0x00, 0x00, 0xac, 0xec, 0x46, 0xc9, 0x04,
+ 0x5d, 0x01, 0x00, 0x00, 0xad, 0xec, 0x2d, 0x5e, 0x06, 0x00, 0xc7, 0x04, 0xf8, 0x02, 0x00, 0x00,
+ 0xf2, 0x0e, 0xc7, 0x42, 0x11, 0x01, 0x00, 0x00, 0x04, 0xf0, 0x02, 0x00, 0x00, 0xc9, 0x9e, 0x9e,
+ 0x43, 0x11, 0x01, 0x00, 0x00, 0xc7, 0xe2, 0x41, 0x43, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00,
+ 0x00, 0xee, 0x0d, 0xc7, 0xe2, 0x41, 0x3a, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0x0e,
+ 0xef, 0x2d, 0xf9, 0x11, 0xe2, 0x41, 0xf0, 0x00, 0x00, 0x00, 0xac, 0xec, 0x29, 0xc9, 0x04, 0xf5,
+ 0x02, 0x00, 0x00, 0xac, 0xec, 0x0f, 0xc7, 0xe2, 0x41, 0x46, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02,
+ 0x00, 0x00, 0xee, 0x0e, 0xc7, 0x42, 0x1b, 0x01, 0x00, 0x00, 0xc9, 0x9e, 0x43, 0x1b, 0x01, 0x00,
+ 0x00, 0x0e, 0xef, 0xfb, 0xf8, 0x11, 0xe2, 0x41, 0x46, 0x01, 0x00, 0x00, 0xac, 0xec, 0x3b, 0xc9,
+ 0x04, 0xf5, 0x02, 0x00, 0x00, 0xac, 0xec, 0x0f, 0xc7, 0xe2, 0x41, 0x47, 0x01, 0x00, 0x00, 0x43,
+ 0x76, 0x02, 0x00, 0x00, 0xee, 0x20, 0xc7, 0x42, 0x1b, 0x01, 0x00, 0x00, 0x04, 0xf5, 0x02, 0x00,
+ 0x00, 0xc9, 0x9e, 0x9e, 0x43, 0x1b, 0x01, 0x00, 0x00, 0xc7, 0xe2, 0x41, 0xf0, 0x00, 0x00, 0x00,
+ 0x43, 0x76, 0x02, 0x00, 0x00, 0x0e, 0xef, 0xb7, 0xf8, 0x11, 0xe2, 0x41, 0x47, 0x01, 0x00, 0x00,
+ 0xac, 0x6a, 0x85, 0x00, 0x00, 0x00, 0xc9, 0x04, 0x5d, 0x01, 0x00, 0x00, 0xac, 0xec, 0x3a, 0xc7,
+ 0x41, 0x1b, 0x01, 0x00, 0x00, 0xec, 0x12, 0x5e, 0x0a, 0x00, 0xc7, 0x04, 0x8c, 0x02, 0x00, 0x00,
+ 0xc7, 0x41, 0x1b, 0x01, 0x00, 0x00, 0xf3, 0x0e, 0x5e, 0x0a, 0x00, 0xc7, 0x04, 0xf9, 0x02, 0x00,
+ 0x00, 0xf2, 0x0e, 0xc7, 0xc3, 0x43, 0x1b, 0x01, 0x00, 0x00, 0xc7, 0xe2, 0x41, 0x3a, 0x01, 0x00,
+ 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x3c, 0xc9, 0x04, 0xf5, 0x02, 0x00, 0x00, 0xac, 0xec,
+ 0x14, 0xc7, 0x42, 0x1b, 0x01, 0x00, 0x00, 0x04, 0xf5, 0x02, 0x00, 0x00, 0x9e, 0x43, 0x1b, 0x01,
+ 0x00, 0x00, 0xee, 0x20, 0xc7, 0x42, 0x1b, 0x01, 0x00, 0x00, 0x04, 0xfa, 0x02, 0x00, 0x00, 0xc9,
+ 0x9e, 0x9e, 0x43, 0x1b, 0x01, 0x00, 0x00, 0xc7, 0xe2, 0x41, 0xf0, 0x00, 0x00, 0x00, 0x43, 0x76,
+ 0x02, 0x00, 0x00, 0x0e, 0xef, 0x29, 0xf8, 0x11, 0xe2, 0x41, 0x48, 0x01, 0x00, 0x00, 0xac, 0xec,
+ 0x3e, 0xc9, 0x04, 0xed, 0x02, 0x00, 0x00, 0xac, 0xec, 0x0f, 0xc7, 0xe2, 0x41, 0x4a, 0x01, 0x00,
+ 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x23, 0x5e, 0x05, 0x00, 0xc9, 0xf1, 0xec, 0x0f, 0xc7,
+ 0xe2, 0x41, 0x49, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x0e, 0xc7, 0x42, 0x16,
+ 0x01, 0x00, 0x00, 0xc9, 0x9e, 0x43, 0x16, 0x01, 0x00, 0x00, 0x0e, 0xef, 0xe2, 0xf7, 0x11, 0xe2,
+ 0x41, 0x49, 0x01, 0x00, 0x00, 0xac, 0xec, 0x3d, 0xc7, 0x41, 0x17, 0x01, 0x00, 0x00, 0x97, 0xec,
+ 0x0c, 0x5e, 0x05, 0x00, 0xc9, 0xf1, 0xec, 0x05, 0x0e, 0xef, 0xc4, 0xf7, 0xc9, 0x04, 0xed, 0x02,
+ 0x00, 0x00, 0xac, 0xec, 0x0f, 0xc7, 0xe2, 0x41, 0x4a, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00,
+ 0x00, 0xee, 0x0e, 0xc7, 0x42, 0x17, 0x01, 0x00, 0x00, 0xc9, 0x9e, 0x43, 0x17, 0x01, 0x00, 0x00,
+ 0x0e, 0xef, 0x9c, 0xf7, 0x11, 0xe2, 0x41, 0x4a, 0x01, 0x00, 0x00, 0xac, 0xec, 0x6b, 0xc9, 0x04,
+ 0x5d, 0x01, 0x00, 0x00, 0xac, 0xec, 0x3f, 0x5e, 0x0a, 0x00, 0xc7, 0x04, 0xfb, 0x02, 0x00, 0x00,
+ 0x0b, 0xc7, 0x41, 0x16, 0x01, 0x00, 0x00, 0x4c, 0x37, 0x00, 0x00, 0x00, 0xc7, 0x41, 0x17, 0x01,
+ 0x00, 0x00, 0x4c, 0xfc, 0x02, 0x00, 0x00, 0xf3, 0x0e, 0xc7, 0xc7, 0xc3, 0x15, 0x43, 0x17, 0x01,
+ 0x00, 0x00, 0x43, 0x16, 0x01, 0x00, 0x00, 0xc7, 0xe2, 0x41, 0x3a, 0x01, 0x00, 0x00, 0x43, 0x76,
+ 0x02, 0x00, 0x00, 0xee, 0x20, 0xc7, 0x42, 0x17, 0x01, 0x00, 0x00, 0x04, 0xed, 0x02, 0x00, 0x00,
+ 0xc9, 0x9e, 0x9e, 0x43, 0x17, 0x01, 0x00, 0x00, 0xc7, 0xe2, 0x41, 0x49, 0x01, 0x00, 0x00, 0x43,
+ 0x76, 0x02, 0x00, 0x00, 0x0e, 0xef, 0x28, 0xf7, 0x11, 0xe2, 0x41, 0x4b, 0x01, 0x00, 0x00, 0xac,
+ 0xec, 0x6b, 0x5e, 0x07, 0x00, 0x5e, 0x0e, 0x00, 0xc9, 0xf2, 0xec, 0x10, 0xc7, 0x42, 0x14, 0x01,
+ 0x00, 0x00, 0xc9, 0x9e, 0x43, 0x14, 0x01, 0x00, 0x00, 0xee, 0x4e, 0x5e, 0x0f, 0x00, 0xc7, 0xf1,
+ 0x0e, 0xc9, 0x04, 0x5d, 0x01, 0x00, 0x00, 0xac, 0xec, 0x09, 0x5e, 0x10, 0x00, 0xc7, 0xf1, 0x0e,
+ 0xee, 0x37, 0xc9, 0x04, 0xeb, 0x02, 0x00, 0x00, 0xac, 0xec, 0x0f, 0xc7, 0xe2, 0x41, 0x4c, 0x01,
+ 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x20, 0x5e, 0x05, 0x00, 0xc9, 0xf1, 0x97, 0xec,
+ 0x0c, 0x5e, 0x06, 0x00, 0xc7, 0x04, 0xfd, 0x02, 0x00, 0x00, 0xf2, 0x0e, 0xc7, 0xe2, 0x41, 0x4d,
+ 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0x0e, 0xef, 0xb4, 0xf6, 0x11, 0xe2, 0x41, 0x4c,
+ 0x01, 0x00, 0x00, 0xac, 0xec, 0x34, 0xc9, 0x04, 0x5d, 0x01, 0x00, 0x00, 0xac, 0xec, 0x10, 0x5e,
+ 0x10, 0x00, 0xc7, 0x0a, 0xf2, 0x0e, 0x5e, 0x11, 0x00, 0xc7, 0xf1, 0x0e, 0xee, 0x18, 0x5e, 0x06,
+ 0x00, 0xc7, 0x04, 0xfe, 0x02, 0x00, 0x00, 0xf2, 0x0e, 0xc7, 0xe2, 0x41, 0x4d, 0x01, 0x00, 0x00,
+ 0x43, 0x76, 0x02, 0x00, 0x00, 0x0e, 0xef, 0x77, 0xf6, 0x11, 0xe2, 0x41, 0x4d, 0x01, 0x00, 0x00,
+ 0xac, 0xec, 0x69, 0x5e, 0x05, 0x00, 0xc9, 0xf1, 0xec, 0x05, 0x0e, 0xef, 0x62, 0xf6, 0xc9, 0x04,
+ 0x5d, 0x01, 0x00, 0x00, 0xac, 0xec, 0x09, 0x5e, 0x10, 0x00, 0xc7, 0xf1, 0x0e, 0xee, 0x49, 0xc9,
+ 0x04, 0xeb, 0x02, 0x00, 0x00, 0xac, 0xec, 0x0f, 0xc7, 0xe2, 0x41, 0x4c, 0x01, 0x00, 0x00, 0x43,
+ 0x76, 0x02, 0x00, 0x00, 0xee, 0x32, 0x5e, 0x07, 0x00, 0x5e, 0x08, 0x00, 0xc9, 0xf2, 0xec, 0x1d,
+ 0xc7, 0xc9, 0x43, 0x19, 0x01, 0x00, 0x00, 0xc7, 0xc3, 0x43, 0x1a, 0x01, 0x00, 0x00, 0xc7, 0xe2,
+ 0x41, 0x4e, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x0c, 0x5e, 0x06, 0x00, 0xc7,
+ 0x04, 0xff, 0x02, 0x00, 0x00, 0xf2, 0x0e, 0x0e, 0xef, 0x05, 0xf6, 0x11, 0xe2, 0x41, 0x4e, 0x01,
+ 0x00, 0x00, 0xac, 0x6a, 0x86, 0x00, 0x00, 0x00, 0xc9, 0x04, 0x00, 0x03, 0x00, 0x00, 0xac, 0xec,
+ 0x0f, 0xc7, 0xe2, 0x41, 0x50, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x68, 0xc9,
+ 0x04, 0x5d, 0x01, 0x00, 0x00, 0xac, 0xec, 0x26, 0x5e, 0x06, 0x00, 0xc7, 0x04, 0x01, 0x03, 0x00,
+ 0x00, 0xf2, 0x0e, 0xc7, 0xc7, 0x41, 0x19, 0x01, 0x00, 0x00, 0x43, 0x1a, 0x01, 0x00, 0x00, 0x5e,
+ 0x12, 0x00, 0xc7, 0xf1, 0x0e, 0x5e, 0x10, 0x00, 0xc7, 0xf1, 0x0e, 0xee, 0x3a, 0x5e, 0x05, 0x00,
+ 0xc9, 0xf1, 0xec, 0x0f, 0xc7, 0xe2, 0x41, 0x4f, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00,
+ 0xee, 0x25, 0x5e, 0x07, 0x00, 0x5e, 0x0e, 0x00, 0xc9, 0xf2, 0xec, 0x10, 0xc7, 0x42, 0x19, 0x01,
+ 0x00, 0x00, 0xc9, 0x9e, 0x43, 0x19, 0x01, 0x00, 0x00, 0xee, 0x0c, 0x5e, 0x06, 0x00, 0xc7, 0x04,
+ 0xff, 0x02, 0x00, 0x00, 0xf2, 0x0e, 0x0e, 0xef, 0x76, 0xf5, 0x11, 0xe2, 0x41, 0x4f, 0x01, 0x00,
+ 0x00, 0xac, 0x6a, 0xbb, 0x00, 0x00, 0x00, 0xc9, 0x04, 0x00, 0x03, 0x00, 0x00, 0xac, 0xec, 0x10,
+ 0xc7, 0xe2, 0x41, 0x50, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xef, 0x9d, 0x00, 0x5e,
+ 0x05, 0x00, 0xc9, 0xf1, 0xec, 0x05, 0x0e, 0xef, 0x46, 0xf5, 0x5e, 0x06, 0x00, 0xc7, 0x04, 0x01,
+ 0x03, 0x00, 0x00, 0xf2, 0x0e, 0xc7, 0x41, 0x74, 0x02, 0x00, 0x00, 0x41, 0xb9, 0x02, 0x00, 0x00,
+ 0xc7, 0x41, 0x19, 0x01, 0x00, 0x00, 0xc3, 0x49, 0xc7, 0xc3, 0x43, 0x1a, 0x01, 0x00, 0x00, 0x5e,
+ 0x0a, 0x00, 0xc7, 0x04, 0xc3, 0x02, 0x00, 0x00, 0x0b, 0xc7, 0x41, 0x19, 0x01, 0x00, 0x00, 0x4c,
+ 0x37, 0x00, 0x00, 0x00, 0xc3, 0x4c, 0x41, 0x00, 0x00, 0x00, 0xf3, 0x0e, 0xc7, 0xc3, 0x43, 0x19,
+ 0x01, 0x00, 0x00, 0xc9, 0x04, 0x5d, 0x01, 0x00, 0x00, 0xac, 0xec, 0x09, 0x5e, 0x10, 0x00, 0xc7,
+ 0xf1, 0x0e, 0xee, 0x37, 0x5e, 0x07, 0x00, 0x5e, 0x08, 0x00, 0xc9, 0xf2, 0xec, 0x16, 0xc7, 0xc9,
+ 0x43, 0x19, 0x01, 0x00, 0x00, 0xc7, 0xe2, 0x41, 0x4e, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00,
+ 0x00, 0xee, 0x18, 0x5e, 0x06, 0x00, 0xc7, 0x04, 0xff, 0x02, 0x00, 0x00, 0xf2, 0x0e, 0xc7, 0xe2,
+ 0x41, 0x4d, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0x0e, 0xef, 0xb2, 0xf4, 0x11, 0xe2,
+ 0x41, 0x50, 0x01, 0x00, 0x00, 0xac, 0xec, 0x4a, 0x5e, 0x05, 0x00, 0xc9, 0xf1, 0xec, 0x05, 0x0e,
+ 0xef, 0x9d, 0xf4, 0x5e, 0x0c, 0x00, 0xc9, 0xf1, 0xec, 0x16, 0xc7, 0xc9, 0x43, 0x69, 0x02, 0x00,
+ 0x00, 0xc7, 0xe2, 0x41, 0x51, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x1f, 0x5e,
+ 0x06, 0x00, 0xc7, 0x04, 0x02, 0x03, 0x00, 0x00, 0xf2, 0x0e, 0xc7, 0xe2, 0x41, 0x53, 0x01, 0x00,
+ 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xc7, 0xc9, 0x43, 0x1a, 0x01, 0x00, 0x00, 0x0e, 0xef, 0x5f,
+ 0xf4, 0x11, 0xe2, 0x41, 0x51, 0x01, 0x00, 0x00, 0xac, 0xec, 0x50, 0xc9, 0xc7, 0x41, 0x69, 0x02,
+ 0x00, 0x00, 0xad, 0xec, 0x29, 0xc9, 0x04, 0x5b, 0x01, 0x00, 0x00, 0xac, 0xec, 0x0f, 0xc7, 0xe2,
+ 0x41, 0x54, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x0e, 0xc7, 0x42, 0x1a, 0x01,
+ 0x00, 0x00, 0xc9, 0x9e, 0x43, 0x1a, 0x01, 0x00, 0x00, 0x0e, 0xef, 0x23, 0xf4, 0x5e, 0x12, 0x00,
+ 0xc7, 0xf1, 0x0e, 0xc7, 0xc3, 0x43, 0x69, 0x02, 0x00, 0x00, 0xc7, 0xe2, 0x41, 0x52, 0x01, 0x00,
+ 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0x0e, 0xef, 0x06, 0xf4, 0x11, 0xe2, 0x41, 0x52, 0x01, 0x00,
+ 0x00, 0xac, 0x6a, 0x81, 0x00, 0x00, 0x00, 0x5e, 0x05, 0x00, 0xc9, 0xf1, 0xec, 0x0f, 0xc7, 0xe2,
+ 0x41, 0x4d, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x65, 0xc9, 0x04, 0x5d, 0x01,
+ 0x00, 0x00, 0xac, 0xec, 0x09, 0x5e, 0x10, 0x00, 0xc7, 0xf1, 0x0e, 0xee, 0x54, 0xc9, 0x04, 0xeb,
+ 0x02, 0x00, 0x00, 0xac, 0xec, 0x0f, 0xc7, 0xe2, 0x41, 0x4c, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02,
+ 0x00, 0x00, 0xee, 0x3d, 0x5e, 0x07, 0x00, 0x5e, 0x08, 0x00, 0xc9, 0xf2, 0xec, 0x28, 0x5e, 0x06,
+ 0x00, 0xc7, 0x04, 0x03, 0x03, 0x00, 0x00, 0xf2, 0x0e, 0xc7, 0xc9, 0x43, 0x19, 0x01, 0x00, 0x00,
+ 0xc7, 0xc3, 0x43, 0x1a, 0x01, 0x00, 0x00, 0xc7, 0xe2, 0x41, 0x4e, 0x01, 0x00, 0x00, 0x43, 0x76,
+ 0x02, 0x00, 0x00, 0xee, 0x0c, 0x5e, 0x06, 0x00, 0xc7, 0x04, 0xff, 0x02, 0x00, 0x00, 0xf2, 0x0e,
+ 0x0e, 0xef, 0x7c, 0xf3, 0x11, 0xe2, 0x41, 0x53, 0x01, 0x00, 0x00, 0xac, 0xec, 0x58, 0x5e, 0x13,
+ 0x00, 0xc9, 0xf1, 0x97, 0xec, 0x29, 0xc9, 0x04, 0x5b, 0x01, 0x00, 0x00, 0xac, 0xec, 0x0f, 0xc7,
+ 0xe2, 0x41, 0x55, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x0e, 0xc7, 0x42, 0x1a,
+ 0x01, 0x00, 0x00, 0xc9, 0x9e, 0x43, 0x1a, 0x01, 0x00, 0x00, 0x0e, 0xef, 0x42, 0xf3, 0x5e, 0x12,
+ 0x00, 0xc7, 0xf1, 0x0e, 0xc9, 0x04, 0x5d, 0x01, 0x00, 0x00, 0xac, 0xec, 0x09, 0x5e, 0x10, 0x00,
+ 0xc7, 0xf1, 0x0e, 0xee, 0x0d, 0xc7, 0xe2, 0x41, 0x4d, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00,
+ 0x00, 0x0e, 0xef, 0x1b, 0xf3, 0x11, 0xe2, 0x41, 0x56, 0x01, 0x00, 0x00, 0xac, 0x6a, 0xe6, 0x00,
+ 0x00, 0x00, 0xc7, 0x41, 0x14, 0x01, 0x00, 0x00, 0x97, 0xec, 0x58, 0x5e, 0x05, 0x00, 0xc9, 0xf1,
+ 0xec, 0x05, 0x0e, 0xef, 0xfa, 0xf2, 0x5e, 0x14, 0x00, 0x5e, 0x08, 0x00, 0xc9, 0xf2, 0xec, 0x39,
+ 0xc7, 0x41, 0x1c, 0x01, 0x00, 0x00, 0xec, 0x23, 0xc7, 0x42, 0x1c, 0x01, 0x00, 0x00, 0x04, 0xd1,
+ 0x02, 0x00, 0x00, 0xc9, 0x9e, 0x9e, 0x43, 0x1c, 0x01, 0x00, 0x00, 0xc7, 0xe2, 0x41, 0x58, 0x01,
+ 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xef, 0x98, 0x00, 0x5e, 0x06, 0x00, 0xc7, 0x04, 0x04,
+ 0x03, 0x00, 0x00, 0xf2, 0x0e, 0xef, 0x8a, 0x00, 0xc7, 0xc9, 0x43, 0x14, 0x01, 0x00, 0x00, 0xef,
+ 0x80, 0x00, 0xc9, 0x04, 0x5d, 0x01, 0x00, 0x00, 0xac, 0xec, 0x09, 0x5e, 0x11, 0x00, 0xc7, 0xf1,
+ 0x0e, 0xee, 0x6e, 0x5e, 0x07, 0x00, 0x5e, 0x0e, 0x00, 0xc9, 0xf2, 0xec, 0x10, 0xc7, 0x42, 0x14,
+ 0x01, 0x00, 0x00, 0xc9, 0x9e, 0x43, 0x14, 0x01, 0x00, 0x00, 0xee, 0x55, 0xc7, 0x41, 0x1c, 0x01,
+ 0x00, 0x00, 0xec, 0x2e, 0xc7, 0x42, 0x1c, 0x01, 0x00, 0x00, 0x04, 0xd1, 0x02, 0x00, 0x00, 0xc7,
+ 0x41, 0x14, 0x01, 0x00, 0x00, 0x9e, 0x9e, 0x43, 0x1c, 0x01, 0x00, 0x00, 0xc7, 0xc3, 0x43, 0x14,
+ 0x01, 0x00, 0x00, 0xc7, 0xe2, 0x41, 0x58, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00, 0xee,
+ 0x20, 0x5e, 0x05, 0x00, 0xc9, 0xf1, 0x97, 0xec, 0x0c, 0x5e, 0x06, 0x00, 0xc7, 0x04, 0x05, 0x03,
+ 0x00, 0x00, 0xf2, 0x0e, 0xc7, 0xe2, 0x41, 0x57, 0x01, 0x00, 0x00, 0x43, 0x76, 0x02, 0x00, 0x00,
+ 0x0e, 0xef, 0x2c, 0xf2, 0x11, 0xe2, 0x41, 0x57, 0x01, 0x00, 0x00, 0xac, 0xec, 0x2c, 0x5e, 0x05,
+ 0x00, 0xc9, 0xf1, 0xec, 0x05, 0x0e, 0xef, 0x17, 0xf2, 0xc9, 0x04, 0x5d, 0x01, 0x00, 0x00, 0xac,
+ 0xec, 0x09, 0x5e, 0x11, 0x00, 0xc7, 0xf1, 0x0e, 0xee, 0x0c, 0x5e, 0x06, 0x00, 0xc7, 0x04, 0x06,
+ 0x03, 0x00, 0x00, 0xf2, 0x0e, 0x0e, 0xef, 0xf7, 0xf1, 0x11, 0xe2, 0x41, 0x3b, 0x01, 0x00, 0x00,
+ 0xac, 0xed, 0x18, 0x11, 0xe2, 0x41, 0x54, 0x01, 0x00, 0x00, 0xac, 0xed, 0x0e, 0x11, 0xe2, 0x41,
+ 0x55, 0x01, 0x00, 0x00, 0xac, 0x6a, 0xdc, 0x00, 0x00, 0x00, 0xc7, 0x41, 0x76, 0x02, 0x00, 0x00,
+ 0x11, 0xe2, 0x41, 0x3b, 0x01, 0x00, 0x00, 0xac, 0xec, 0x12, 0xe2, 0x41, 0x3a, 0x01, 0x00, 0x00,
+ 0xc5, 0x05, 0x04, 0x13, 0x01, 0x00, 0x00, 0xc5, 0x06, 0xee, 0x35, 0x11, 0xe2, 0x41, 0x54, 0x01,
+ 0x00, 0x00, 0xac, 0xec, 0x12, 0xe2, 0x41, 0x51, 0x01, 0x00, 0x00, 0xc5, 0x05, 0x04, 0x1a, 0x01,
+ 0x00, 0x00, 0xc5, 0x06, 0xee, 0x1a, 0x11, 0xe2, 0x41, 0x55, 0x01, 0x00, 0x00, 0xac, 0xec, 0x10,
+ 0xe2, 0x41, 0x53, 0x01, 0x00, 0x00, 0xc5, 0x05, 0x04, 0x1a, 0x01, 0x00, 0x00, 0xc5, 0x06, 0x0e,
+ 0xc9, 0x04, 0xdf, 0x02, 0x00, 0x00, 0xac, 0xec, 0x1f, 0xc7, 0xc4, 0x06, 0x73, 0x13, 0x47, 0x5e,
+ 0x15, 0x00, 0xc7, 0xf1, 0x9e, 0x49, 0xc7, 0xc3, 0x43, 0x18, 0x01, 0x00, 0x00, 0xc7, 0xc4, 0x05,
+ 0x43, 0x76, 0x02, 0x00, 0x00, 0xee, 0x58, 0x5e, 0x07, 0x00, 0xc7, 0x41, 0x18, 0x01, 0x00, 0x00,
+ 0xeb, 0xec, 0x06, 0x5e, 0x16, 0x00, 0xee, 0x04, 0x5e, 0x17, 0x00, 0xc9, 0xf2, 0xec, 0x10, 0xc7,
+ 0x42, 0x18, 0x01, 0x00, 0x00, 0xc9, 0x9e, 0x43, 0x18, 0x01, 0x00, 0x00, 0xee, 0x31, 0x5e, 0x06,
+ 0x00, 0xc7, 0x04, 0x07, 0x03, 0x00, 0x00, 0xf2, 0x0e, 0xc7, 0xc4, 0x06, 0x73, 0x13, 0x47, 0x04,
+ 0x5b, 0x01, 0x00, 0x00, 0xc7, 0x41, 0x18, 0x01, 0x00, 0x00, 0x9e, 0xc9, 0x9e, 0x9e, 0x49, 0xc7,
+ 0xc3, 0x43, 0x18, 0x01, 0x00, 0x00, 0xc7, 0xc4, 0x05, 0x43, 0x76, 0x02, 0x00, 0x00, 0x0e, 0xef,
+ 0xfe, 0xf0, 0x38, 0x99, 0x00, 0x00, 0x00, 0x11, 0xc7, 0x04, 0x08, 0x03, 0x00, 0x00, 0xc7, 0x41,
+ 0x76, 0x02, 0x00, 0x00, 0x9e, 0x21, 0x02, 0x00, 0x2f, 0xc7, 0x41, 0x7a, 0x02, 0x00, 0x00, 0xc7,
+ 0x41, 0x6a, 0x02, 0x00, 0x00, 0xa7, 0xec, 0x07, 0x5e, 0x18, 0x00, 0xc7, 0xf1, 0x0e, 0xc7, 0x28,
+ 0xc6, 0x03, 0xcd, 0x07, 0xae, 0x03, 0x12, 0x12, 0x30, 0x26, 0x08, 0x2b, 0x26, 0x13, 0x17, 0x1d,
+ 0x35, 0x36, 0x0d, 0x0e, 0x26, 0x27, 0x0d, 0x1e, 0x2b, 0x3f, 0x30, 0x3f, 0x26, 0x0d, 0x00, 0x0c,
+ 0x08, 0x21, 0x35, 0x3f, 0x30, 0x13, 0x26, 0x18, 0x35, 0x26, 0x18, 0x44, 0x76, 0x17, 0x6c, 0x26,
+ 0x35, 0x3f, 0x30, 0x3f, 0x26, 0x0d, 0x41, 0x0d, 0x81, 0xc6, 0x3f, 0x3f, 0x0d, 0x8a, 0x3b, 0x30,
+ 0x3f, 0x0d, 0x46, 0x18, 0x36, 0x30, 0x3f, 0x0d, 0x45, 0x18, 0x35, 0x30, 0x3f, 0x0d, 0x62, 0x40,
+ 0x18, 0x45, 0x30, 0x3f, 0x26, 0x2c, 0x4e, 0x3f, 0x26, 0x3f, 0x3f, 0x26, 0x3f, 0x3f, 0x49, 0x0d,
+ 0x3b, 0x58, 0x4e, 0x8b, 0x62, 0x40, 0x18, 0x44, 0x71, 0x3a, 0x3f, 0x26, 0x26, 0x62, 0x3f, 0x26,
+ 0x26, 0x80, 0x3f, 0x5d, 0x30, 0x0e, 0x26, 0x26, 0x3a, 0x58, 0x26, 0x3f, 0x30, 0x3f, 0x44, 0x0d,
+ 0x45, 0x18, 0x35, 0x35, 0x3f, 0x27, 0x44, 0x18, 0x35, 0x30, 0x3f, 0x58, 0x26, 0x0d, 0x44, 0x30,
+ 0x3f, 0x30, 0x3f, 0x28, 0x18, 0x35, 0x44, 0x35, 0x26, 0x40, 0x18, 0x35, 0x44, 0x30, 0x3f, 0x30,
+ 0x3f, 0x27, 0x18, 0x35, 0x44, 0x35, 0x3f, 0x27, 0x18, 0x35, 0x30, 0x3f, 0x0d, 0x45, 0x18, 0x35,
+ 0x30, 0x3f, 0x71, 0x2b, 0x59, 0x26, 0x0d, 0x62, 0x40, 0x18, 0x35, 0x30, 0x3c, 0x62, 0x3f, 0x0d,
+ 0x40, 0x18, 0x35, 0x30, 0x3f, 0x0d, 0x45, 0x18, 0x35, 0x30, 0x3f, 0x0d, 0x62, 0x40, 0x18, 0x44,
+ 0x30, 0x2b, 0x59, 0x3a, 0x26, 0x3f, 0x3a, 0x58, 0x0d, 0x62, 0x40, 0x18, 0x35, 0x30, 0x3f, 0x30,
+ 0x3f, 0x0d, 0x45, 0x18, 0x35, 0x53, 0x17, 0x30, 0x3f, 0x0d, 0x45, 0x18, 0x35, 0x30, 0x35, 0x3a,
+ 0x3a, 0x0d, 0x49, 0x3f, 0x0d, 0x62, 0x40, 0x18, 0x35, 0x35, 0x44, 0x0d, 0x21, 0x30, 0x21, 0x3a,
+ 0x3f, 0x0d, 0x2b, 0x3b, 0x41, 0x18, 0x35, 0x30, 0x26, 0x21, 0x0d, 0x3a, 0x40, 0x18, 0x36, 0x26,
+ 0x17, 0x30, 0x21, 0x3a, 0x3f, 0x3f, 0x26, 0x26, 0x3f, 0x0d, 0x3b, 0x18, 0x44, 0x30, 0x3f, 0x3a,
+ 0x3a, 0x3f, 0x21, 0x21, 0x30, 0x3f, 0x3f, 0x44, 0x0d, 0x3b, 0x18, 0x44, 0x30, 0x3f, 0x35, 0x18,
+ 0x3a, 0x62, 0x26, 0x35, 0x3a, 0x21, 0x0d, 0x26, 0x30, 0x21, 0x3f, 0x26, 0x3f, 0x0d, 0x3a, 0x41,
+ 0x18, 0x35, 0x26, 0x17, 0x26, 0x26, 0x3f, 0x0d, 0x3a, 0x3f, 0x27, 0x18, 0x35, 0x35, 0x30, 0x3f,
+ 0x0d, 0x45, 0x18, 0x21, 0x26, 0x3f, 0x18, 0x44, 0x26, 0x3f, 0x3a, 0x21, 0x3a, 0x3f, 0x3f, 0x3a,
+ 0x26, 0x26, 0x3f, 0x0d, 0x3b, 0x18, 0x35, 0x2b, 0x30, 0x3f, 0x0d, 0x45, 0x18, 0x21, 0x30, 0x21,
+ 0x0d, 0x40, 0x18, 0x44, 0x30, 0x26, 0x17, 0x35, 0x2b, 0x62, 0x3f, 0x12, 0x3b, 0x12, 0x27, 0x3f,
+ 0x21, 0x3f, 0x44, 0x35, 0x7b, 0x26, 0x3f, 0x0d, 0x2b, 0x3b, 0x40, 0x18, 0x35, 0x26, 0x18, 0x30,
+ 0x21, 0x0d, 0x3b, 0x18, 0x35, 0x35, 0x46, 0x21, 0x35, 0x2b, 0x26, 0x0e, 0x35, 0x2b, 0x26, 0x0e,
+ 0x35, 0x2b, 0x27, 0x09, 0x30, 0x44, 0x26, 0x2b, 0x85, 0x44, 0x0d, 0x3a, 0x71, 0x26, 0x2d, 0x19,
+ 0x73, 0x09, 0x4e, 0x22, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x01, 0x62,
+ 0x03, 0x92, 0x0c, 0x00, 0x00, 0x40, 0x94, 0x0c, 0x00, 0x01, 0x40, 0xc0, 0x09, 0x00, 0x02, 0x00,
+ 0x38, 0x9b, 0x00, 0x00, 0x00, 0x41, 0xac, 0x02, 0x00, 0x00, 0xcb, 0x38, 0x9f, 0x00, 0x00, 0x00,
+ 0x41, 0x0a, 0x03, 0x00, 0x00, 0xcc, 0xc2, 0x00, 0x4d, 0x60, 0x02, 0x00, 0x00, 0xcd, 0x38, 0x97,
+ 0x00, 0x00, 0x00, 0x41, 0x66, 0x00, 0x00, 0x00, 0xec, 0x2d, 0x38, 0x97, 0x00, 0x00, 0x00, 0x42,
+ 0x66, 0x00, 0x00, 0x00, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x04, 0x60, 0x02, 0x00, 0x00, 0x0b, 0xc9,
+ 0x4c, 0x41, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0x3e, 0x00, 0x00, 0x00, 0x0a, 0x4c, 0x3f, 0x00, 0x00,
+ 0x00, 0x24, 0x03, 0x00, 0x0e, 0x29, 0x38, 0x9b, 0x00, 0x00, 0x00, 0xc9, 0x43, 0x60, 0x02, 0x00,
+ 0x00, 0x29, 0xc6, 0x03, 0xf2, 0x0b, 0x0e, 0x03, 0x3a, 0x00, 0x0b, 0x4a, 0x2c, 0x3f, 0x6c, 0x21,
+ 0x21, 0x21, 0x17, 0x08, 0x3b, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x00, 0x09, 0x00, 0x05, 0x02, 0x00,
+ 0xe5, 0x01, 0x09, 0x96, 0x0c, 0x00, 0x00, 0x00, 0x98, 0x0c, 0x00, 0x01, 0x00, 0x9a, 0x0c, 0x00,
+ 0x02, 0x00, 0x9c, 0x0c, 0x00, 0x03, 0x00, 0xb0, 0x01, 0x00, 0x04, 0x00, 0x60, 0x00, 0x05, 0x00,
+ 0xc4, 0x0b, 0x00, 0x06, 0x00, 0x9e, 0x0c, 0x00, 0x07, 0x00, 0x9c, 0x01, 0x00, 0x01, 0x00, 0x94,
+ 0x0c, 0x01, 0x01, 0x92, 0x0c, 0x00, 0x01, 0x0c, 0x00, 0xc5, 0x08, 0xc0, 0x00, 0x40, 0xcb, 0x26,
+ 0x00, 0x00, 0xcc, 0xb6, 0xc5, 0x04, 0xc4, 0x08, 0xeb, 0xc6, 0x05, 0x97, 0xec, 0x03, 0xc3, 0x28,
+ 0xc3, 0xc5, 0x06, 0xc4, 0x04, 0x90, 0xc6, 0x04, 0xc4, 0x05, 0xa4, 0x6a, 0xbd, 0x00, 0x00, 0x00,
+ 0x38, 0x9a, 0x00, 0x00, 0x00, 0xc4, 0x08, 0xc4, 0x04, 0x47, 0xf1, 0xc5, 0x07, 0x38, 0x10, 0x03,
+ 0x00, 0x00, 0xc4, 0x07, 0xf1, 0x97, 0x11, 0xed, 0x1d, 0x0e, 0xc4, 0x07, 0xb7, 0xa4, 0x11, 0xed,
+ 0x15, 0x0e, 0xc4, 0x07, 0x01, 0xff, 0xff, 0x10, 0x00, 0xa6, 0x11, 0xed, 0x09, 0x0e, 0xdf, 0xc4,
+ 0x07, 0xf1, 0xc4, 0x07, 0xad, 0xec, 0x10, 0x38, 0xce, 0x00, 0x00, 0x00, 0x04, 0x11, 0x03, 0x00,
+ 0x00, 0xc4, 0x07, 0x9e, 0xf1, 0x2f, 0xc4, 0x07, 0x01, 0xff, 0xff, 0x00, 0x00, 0xa5, 0xec, 0x0f,
+ 0xc8, 0x42, 0x85, 0x02, 0x00, 0x00, 0xc4, 0x07, 0x24, 0x01, 0x00, 0x0e, 0xee, 0x2e, 0xc4, 0x07,
+ 0x01, 0x00, 0x00, 0x01, 0x00, 0x9f, 0xc6, 0x07, 0xbf, 0x0a, 0xa2, 0x01, 0x00, 0xd8, 0x00, 0x00,
+ 0x9e, 0xcd, 0xc4, 0x07, 0xc0, 0x00, 0x04, 0x9d, 0x01, 0x00, 0xdc, 0x00, 0x00, 0x9e, 0xce, 0xc8,
+ 0x42, 0x85, 0x02, 0x00, 0x00, 0xc9, 0xca, 0x24, 0x02, 0x00, 0x0e, 0xc4, 0x04, 0xb8, 0x9e, 0xc4,
+ 0x05, 0xac, 0x11, 0xed, 0x06, 0x0e, 0xc8, 0xeb, 0xc7, 0xa6, 0x6a, 0x58, 0xff, 0xff, 0xff, 0xc4,
+ 0x06, 0xe0, 0x42, 0x5b, 0x00, 0x00, 0x00, 0x07, 0xc8, 0x24, 0x02, 0x00, 0x9e, 0xc5, 0x06, 0xc8,
+ 0xb7, 0x43, 0x30, 0x00, 0x00, 0x00, 0xef, 0x3c, 0xff, 0xc4, 0x06, 0x28, 0xc6, 0x03, 0xf5, 0x0b,
+ 0x1d, 0x17, 0x17, 0x19, 0x12, 0x12, 0x1c, 0x08, 0x08, 0x12, 0x44, 0x45, 0x44, 0x2b, 0x3f, 0x26,
+ 0x0d, 0x49, 0x08, 0x35, 0x3f, 0x0e, 0x35, 0x35, 0x44, 0x40, 0x67, 0x53, 0x27, 0x12,
+};
+
+static const uint8_t tjs_m_build_app[1932] = {
+ 0x02, 0x45, 0x22, 0x40, 0x61, 0x70, 0x70, 0x2f, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x2f, 0x61, 0x70,
+ 0x70, 0x2e, 0x6a, 0x73, 0x18, 0x40, 0x74, 0x6a, 0x73, 0x2f, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73,
+ 0x73, 0x14, 0x40, 0x74, 0x6a, 0x73, 0x2f, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x30, 0x2e, 0x2e, 0x2f,
+ 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x2f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x2f, 0x63, 0x6d,
+ 0x64, 0x6c, 0x69, 0x6e, 0x65, 0x30, 0x2e, 0x2e, 0x2f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73,
+ 0x2f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x2f, 0x67, 0x65, 0x74, 0x6f, 0x70, 0x74, 0x73, 0x14, 0x2e,
+ 0x2f, 0x73, 0x72, 0x63, 0x2f, 0x6c, 0x69, 0x6e, 0x6b, 0x18, 0x2e, 0x2f, 0x73, 0x72, 0x63, 0x2f,
+ 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x0e, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x0a, 0x73,
+ 0x68, 0x65, 0x6c, 0x6c, 0x0e, 0x63, 0x6d, 0x64, 0x6c, 0x69, 0x6e, 0x65, 0x0e, 0x67, 0x65, 0x74,
+ 0x6f, 0x70, 0x74, 0x73, 0x08, 0x6c, 0x69, 0x6e, 0x6b, 0x0c, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65,
+ 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x50, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x52, 0x6f, 0x6f,
+ 0x74, 0x12, 0x24, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73, 0x3e, 0x54, 0x68, 0x69, 0x73,
+ 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c,
+ 0x20, 0x66, 0x6f, 0x72, 0x20, 0x57, 0x6f, 0x54, 0x2e, 0x6a, 0x73, 0x0a, 0x74, 0x69, 0x74, 0x6c,
+ 0x65, 0x0c, 0x75, 0x6e, 0x6c, 0x69, 0x6e, 0x6b, 0x0e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
+ 0x10, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73, 0x06, 0x72, 0x75, 0x6e, 0x08, 0x61, 0x72,
+ 0x67, 0x76, 0x10, 0x62, 0x61, 0x73, 0x65, 0x50, 0x61, 0x74, 0x68, 0x0c, 0x63, 0x6f, 0x6c, 0x6f,
+ 0x72, 0x73, 0x10, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x02, 0x65, 0x06, 0x70, 0x77,
+ 0x64, 0x0e, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x2f, 0x63, 0x6f, 0x72, 0x65, 0x2f,
+ 0x74, 0x6a, 0x73, 0x2f, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x2f, 0x74, 0x6a, 0x73, 0x2e,
+ 0x68, 0x0c, 0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x0a, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x06, 0x72,
+ 0x65, 0x64, 0x62, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x3a, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+ 0x74, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x6e,
+ 0x6f, 0x74, 0x20, 0x54, 0x4a, 0x53, 0x20, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x72,
+ 0x6f, 0x6f, 0x74, 0x2e, 0x08, 0x61, 0x72, 0x67, 0x73, 0x0e, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e,
+ 0x73, 0x0e, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x0a, 0x70, 0x61, 0x72, 0x73, 0x65, 0x02,
+ 0x62, 0x10, 0x62, 0x61, 0x73, 0x65, 0x70, 0x61, 0x74, 0x68, 0x0e, 0x65, 0x78, 0x65, 0x70, 0x61,
+ 0x74, 0x68, 0x02, 0x6f, 0x0c, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x02, 0x6c, 0x0e, 0x6c, 0x69,
+ 0x62, 0x6e, 0x61, 0x6d, 0x65, 0x0a, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x16, 0x2e, 0x2f, 0x62, 0x75,
+ 0x69, 0x6c, 0x64, 0x2f, 0x74, 0x6a, 0x73, 0x0e, 0x42, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x0e,
+ 0x6f, 0x75, 0x74, 0x70, 0x61, 0x74, 0x68, 0x02, 0x5f, 0x0a, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x7a,
+ 0x53, 0x79, 0x6d, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20,
+ 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x0a, 0x0a, 0x55,
+ 0x73, 0x61, 0x67, 0x65, 0x3a, 0x20, 0x74, 0x6a, 0x73, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20,
+ 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x3c, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3e, 0x0a, 0x68, 0x52, 0x65,
+ 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 0x6f, 0x6c, 0x64,
+ 0x65, 0x72, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x73, 0x0a, 0x0a, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3a,
+ 0x20, 0x74, 0x6a, 0x73, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x75, 0x6e, 0x6c, 0x69, 0x6e,
+ 0x6b, 0x0a, 0x08, 0x64, 0x61, 0x74, 0x61, 0x08, 0x63, 0x6f, 0x64, 0x65, 0x08, 0x64, 0x61, 0x74,
+ 0x65, 0x06, 0x6c, 0x6f, 0x67, 0x22, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x46, 0x69,
+ 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x08, 0x72, 0x65, 0x61, 0x64, 0x20, 0x43, 0x75, 0x72,
+ 0x72, 0x65, 0x6e, 0x74, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x10, 0x76, 0x65,
+ 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x16, 0x67, 0x65, 0x74, 0x46, 0x75, 0x6c, 0x6c, 0x59, 0x65,
+ 0x61, 0x72, 0x02, 0x2e, 0x10, 0x67, 0x65, 0x74, 0x4d, 0x6f, 0x6e, 0x74, 0x68, 0x0e, 0x67, 0x65,
+ 0x74, 0x44, 0x61, 0x74, 0x65, 0x18, 0x4e, 0x65, 0x77, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f,
+ 0x6e, 0x3a, 0x0a, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x0a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x30, 0x73,
+ 0x65, 0x74, 0x28, 0x54, 0x4a, 0x53, 0x5f, 0x50, 0x52, 0x4f, 0x4a, 0x45, 0x43, 0x54, 0x5f, 0x56,
+ 0x45, 0x52, 0x53, 0x4f, 0x49, 0x4e, 0x20, 0x04, 0x29, 0x0a, 0x0f, 0xc6, 0x03, 0x06, 0xc8, 0x03,
+ 0xca, 0x03, 0xcc, 0x03, 0xce, 0x03, 0xd0, 0x03, 0xd2, 0x03, 0x00, 0x00, 0x06, 0x00, 0xfc, 0x01,
+ 0x00, 0x01, 0x2c, 0x01, 0x02, 0xfc, 0x01, 0x02, 0x03, 0xfc, 0x01, 0x03, 0x04, 0xfc, 0x01, 0x04,
+ 0x05, 0xfc, 0x01, 0x05, 0x00, 0x0e, 0x20, 0x06, 0x01, 0xa2, 0x01, 0x00, 0x00, 0x00, 0x05, 0x08,
+ 0x05, 0x5d, 0x00, 0xd4, 0x03, 0x00, 0x0d, 0xd6, 0x03, 0x01, 0x0c, 0xd8, 0x03, 0x02, 0x0d, 0xda,
+ 0x03, 0x03, 0x0d, 0xdc, 0x03, 0x04, 0x0d, 0xde, 0x03, 0x05, 0x0d, 0xe0, 0x03, 0x00, 0x01, 0xe2,
+ 0x03, 0x01, 0x0d, 0x08, 0xec, 0x07, 0xc2, 0x00, 0x5f, 0x06, 0x00, 0x29, 0x0b, 0x04, 0xf2, 0x00,
+ 0x00, 0x00, 0x4c, 0xf3, 0x00, 0x00, 0x00, 0x0b, 0xc2, 0x01, 0x54, 0xef, 0x00, 0x00, 0x00, 0x04,
+ 0xc2, 0x02, 0x54, 0xee, 0x00, 0x00, 0x00, 0x04, 0xc2, 0x03, 0x54, 0xf4, 0x00, 0x00, 0x00, 0x04,
+ 0xc2, 0x04, 0x54, 0xf5, 0x00, 0x00, 0x00, 0x04, 0x4c, 0xf6, 0x00, 0x00, 0x00, 0x5f, 0x07, 0x00,
+ 0x66, 0x02, 0x00, 0x42, 0xf7, 0x00, 0x00, 0x00, 0x66, 0x07, 0x00, 0x26, 0x01, 0x00, 0xb8, 0x66,
+ 0x00, 0x00, 0x41, 0xf8, 0x00, 0x00, 0x00, 0x52, 0x0e, 0x18, 0x27, 0x00, 0x00, 0x0e, 0x06, 0x2e,
+ 0xc6, 0x03, 0x01, 0x15, 0x01, 0x00, 0x09, 0x38, 0x08, 0x35, 0x00, 0x01, 0x4c, 0x00, 0x08, 0x18,
+ 0x00, 0x08, 0x18, 0x00, 0x08, 0x32, 0x2b, 0x1c, 0x13, 0x0e, 0x62, 0x06, 0x01, 0xe0, 0x03, 0x00,
+ 0x04, 0x00, 0x06, 0x01, 0x00, 0x72, 0x04, 0xf2, 0x03, 0x01, 0x00, 0x30, 0xf4, 0x03, 0x01, 0x01,
+ 0x30, 0xf6, 0x03, 0x02, 0x02, 0x30, 0xf8, 0x03, 0x03, 0x02, 0x03, 0xd6, 0x03, 0x01, 0x0c, 0x61,
+ 0x01, 0x00, 0x61, 0x00, 0x00, 0x66, 0x00, 0x00, 0x42, 0xfd, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
+ 0xcb, 0x38, 0xfe, 0x00, 0x00, 0x00, 0x41, 0xfa, 0x00, 0x00, 0x00, 0xcc, 0x6d, 0x2c, 0x00, 0x00,
+ 0x00, 0x61, 0x02, 0x00, 0x66, 0x00, 0x00, 0x42, 0x5c, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x04,
+ 0xff, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0xcd, 0x66, 0x00, 0x00, 0x42, 0x00, 0x01, 0x00, 0x00,
+ 0x62, 0x02, 0x00, 0x24, 0x01, 0x00, 0x8c, 0x70, 0x2e, 0xce, 0x6d, 0x25, 0x00, 0x00, 0x00, 0x38,
+ 0xfe, 0x00, 0x00, 0x00, 0x42, 0x01, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x42, 0x02, 0x01, 0x00,
+ 0x00, 0x04, 0x03, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x09, 0x70, 0x2e,
+ 0x2f, 0xc6, 0x03, 0x0d, 0x0a, 0x21, 0x3f, 0x3c, 0x2b, 0x67, 0x54, 0x26, 0x99, 0x0d, 0x08, 0x0e,
+ 0x60, 0x07, 0x01, 0x00, 0x01, 0x02, 0x00, 0x06, 0x02, 0x00, 0xf8, 0x01, 0x03, 0x88, 0x04, 0x00,
+ 0x01, 0x00, 0x8a, 0x04, 0x01, 0x00, 0x30, 0x8c, 0x04, 0x01, 0x01, 0x30, 0xda, 0x03, 0x03, 0x0c,
+ 0xde, 0x03, 0x05, 0x0c, 0x0d, 0x00, 0x00, 0xd7, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0x66, 0x00,
+ 0x00, 0x42, 0x07, 0x01, 0x00, 0x00, 0xd3, 0x0b, 0x0b, 0x04, 0x08, 0x01, 0x00, 0x00, 0x4c, 0x09,
+ 0x01, 0x00, 0x00, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x4c, 0x0a, 0x01, 0x00, 0x00, 0x04, 0x0b, 0x01,
+ 0x00, 0x00, 0x4c, 0x0c, 0x01, 0x00, 0x00, 0x04, 0x0d, 0x01, 0x00, 0x00, 0x4c, 0x0e, 0x01, 0x00,
+ 0x00, 0x4c, 0x0f, 0x01, 0x00, 0x00, 0x0b, 0x04, 0x10, 0x01, 0x00, 0x00, 0x4c, 0x0c, 0x01, 0x00,
+ 0x00, 0x4c, 0x16, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0xcb, 0x66, 0x01, 0x00, 0x41, 0x11, 0x01,
+ 0x00, 0x00, 0x11, 0x21, 0x00, 0x00, 0xcc, 0x62, 0x00, 0x00, 0x41, 0x09, 0x01, 0x00, 0x00, 0xec,
+ 0x17, 0x62, 0x01, 0x00, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x41, 0x09, 0x01, 0x00,
+ 0x00, 0xf1, 0x43, 0x09, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x41, 0x0a, 0x01, 0x00, 0x00, 0xec,
+ 0x17, 0x62, 0x01, 0x00, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x41, 0x0a, 0x01, 0x00,
+ 0x00, 0xf1, 0x43, 0x0a, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x41, 0x0e, 0x01, 0x00, 0x00, 0xec,
+ 0x17, 0x62, 0x01, 0x00, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x41, 0x0e, 0x01, 0x00,
+ 0x00, 0xf1, 0x43, 0x0e, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x41, 0x0c, 0x01, 0x00, 0x00, 0xec,
+ 0x17, 0x62, 0x01, 0x00, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x41, 0x0c, 0x01, 0x00,
+ 0x00, 0xf1, 0x43, 0x12, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x42, 0xef, 0x00, 0x00, 0x00, 0x62,
+ 0x00, 0x00, 0x41, 0x13, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x8c, 0x2e, 0xc6, 0x03, 0x24, 0x17,
+ 0x35, 0x35, 0x08, 0x35, 0x35, 0x35, 0x35, 0x1c, 0x08, 0x35, 0x1c, 0x18, 0x44, 0x35, 0x73, 0x35,
+ 0x73, 0x35, 0x73, 0x35, 0x00, 0x16, 0x08, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x03,
+ 0x01, 0x00, 0x24, 0x01, 0xa8, 0x04, 0x00, 0x01, 0x00, 0xdc, 0x03, 0x04, 0x0c, 0xd3, 0x97, 0xec,
+ 0x14, 0x38, 0xfe, 0x00, 0x00, 0x00, 0x42, 0x01, 0x01, 0x00, 0x00, 0x04, 0x15, 0x01, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0x66, 0x00, 0x00, 0x42, 0xee, 0x00, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00,
+ 0x29, 0xc6, 0x03, 0x4a, 0x04, 0x03, 0x17, 0x64, 0x3f, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x00,
+ 0x01, 0x03, 0x01, 0x00, 0x24, 0x01, 0xa8, 0x04, 0x00, 0x01, 0x00, 0xdc, 0x03, 0x04, 0x0c, 0xd3,
+ 0x97, 0xec, 0x14, 0x38, 0xfe, 0x00, 0x00, 0x00, 0x42, 0x01, 0x01, 0x00, 0x00, 0x04, 0x16, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x66, 0x00, 0x00, 0x42, 0xf4, 0x00, 0x00, 0x00, 0xd3, 0x24,
+ 0x01, 0x00, 0x29, 0xc6, 0x03, 0x56, 0x04, 0x03, 0x17, 0x64, 0x3f, 0x0e, 0x62, 0x07, 0x01, 0x00,
+ 0x01, 0x05, 0x01, 0x0a, 0x03, 0x00, 0x95, 0x02, 0x06, 0xf6, 0x03, 0x00, 0x01, 0x00, 0xf4, 0x03,
+ 0x01, 0x00, 0x30, 0xae, 0x04, 0x01, 0x01, 0x30, 0xb0, 0x04, 0x01, 0x02, 0x30, 0xb2, 0x04, 0x01,
+ 0x03, 0x30, 0xea, 0x03, 0x01, 0x04, 0x30, 0xe0, 0x03, 0x06, 0x00, 0xd6, 0x03, 0x01, 0x0c, 0xd4,
+ 0x03, 0x00, 0x0c, 0x61, 0x04, 0x00, 0x61, 0x03, 0x00, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61,
+ 0x00, 0x00, 0xdf, 0xf0, 0x8c, 0x97, 0xec, 0x03, 0x06, 0x2e, 0x38, 0xfe, 0x00, 0x00, 0x00, 0x41,
+ 0xfa, 0x00, 0x00, 0x00, 0xcb, 0x66, 0x01, 0x00, 0x42, 0x5c, 0x00, 0x00, 0x00, 0x66, 0x01, 0x00,
+ 0x42, 0xfd, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xd3, 0x24, 0x02, 0x00, 0xd7, 0x38, 0xfe, 0x00,
+ 0x00, 0x00, 0x42, 0x1a, 0x01, 0x00, 0x00, 0x04, 0x1b, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x02, 0x00,
+ 0x0e, 0x66, 0x01, 0x00, 0x42, 0x1c, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x8c, 0xcc, 0x38,
+ 0xfe, 0x00, 0x00, 0x00, 0x42, 0x1a, 0x01, 0x00, 0x00, 0x04, 0x1d, 0x01, 0x00, 0x00, 0x62, 0x01,
+ 0x00, 0x24, 0x02, 0x00, 0x0e, 0x66, 0x02, 0x00, 0x41, 0x1e, 0x01, 0x00, 0x00, 0x41, 0x18, 0x01,
+ 0x00, 0x00, 0xcd, 0x38, 0xa1, 0x00, 0x00, 0x00, 0x11, 0x21, 0x00, 0x00, 0xce, 0xc3, 0x42, 0x5d,
+ 0x00, 0x00, 0x00, 0x62, 0x03, 0x00, 0x42, 0x1f, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xbf, 0x64,
+ 0x9d, 0x04, 0x20, 0x01, 0x00, 0x00, 0x62, 0x03, 0x00, 0x42, 0x21, 0x01, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0xb8, 0x9e, 0x04, 0x20, 0x01, 0x00, 0x00, 0x62, 0x03, 0x00, 0x42, 0x22, 0x01, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0x62, 0x02, 0x00, 0xb8, 0x9e, 0x24, 0x07, 0x00,
+ 0xc5, 0x04, 0x38, 0xfe, 0x00, 0x00, 0x00, 0x42, 0x1a, 0x01, 0x00, 0x00, 0x04, 0x23, 0x01, 0x00,
+ 0x00, 0x62, 0x00, 0x00, 0x42, 0x24, 0x01, 0x00, 0x00, 0x62, 0x04, 0x00, 0x24, 0x01, 0x00, 0x24,
+ 0x02, 0x00, 0x0e, 0x66, 0x01, 0x00, 0x42, 0x25, 0x01, 0x00, 0x00, 0xd3, 0x04, 0x26, 0x01, 0x00,
+ 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x04, 0x00, 0x04, 0x27, 0x01, 0x00, 0x00, 0x24, 0x02,
+ 0x00, 0x24, 0x02, 0x00, 0x8c, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x63, 0x10, 0x4e, 0x21, 0x08, 0x09,
+ 0x3a, 0x7b, 0x68, 0x49, 0x71, 0x4a, 0x35, 0x00, 0x45, 0x02, 0xa9, 0xb2,
+};
+
+static const uint8_t tjs_m_build_src_bundle[3472] = {
+ 0x02, 0x5c, 0x30, 0x40, 0x61, 0x70, 0x70, 0x2f, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x2f, 0x73, 0x72,
+ 0x63, 0x2f, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x2e, 0x6a, 0x73, 0x0e, 0x40, 0x74, 0x6a, 0x73,
+ 0x2f, 0x6f, 0x73, 0x0e, 0x40, 0x74, 0x6a, 0x73, 0x2f, 0x66, 0x73, 0x12, 0x40, 0x74, 0x6a, 0x73,
+ 0x2f, 0x70, 0x61, 0x74, 0x68, 0x16, 0x40, 0x74, 0x6a, 0x73, 0x2f, 0x6e, 0x61, 0x74, 0x69, 0x76,
+ 0x65, 0x16, 0x69, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x4d, 0x61, 0x74, 0x63, 0x68, 0x0e, 0x42, 0x75,
+ 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x04, 0x6f, 0x73, 0x04, 0x66, 0x73, 0x08, 0x70, 0x61, 0x74, 0x68,
+ 0x0c, 0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x0a, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x0c, 0x62, 0x75,
+ 0x6e, 0x64, 0x6c, 0x65, 0x0e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x12, 0x6c, 0x69, 0x73,
+ 0x74, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x08, 0x70, 0x61, 0x63, 0x6b, 0x10, 0x66, 0x69, 0x6c, 0x65,
+ 0x6e, 0x61, 0x6d, 0x65, 0x0e, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x02, 0x6d, 0x02, 0x6e,
+ 0x04, 0x64, 0x70, 0x02, 0x6a, 0x02, 0x69, 0x08, 0x66, 0x69, 0x6c, 0x6c, 0x06, 0x6d, 0x61, 0x70,
+ 0x02, 0x3f, 0x0c, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x0c, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+ 0x08, 0x76, 0x69, 0x65, 0x77, 0x1a, 0x74, 0x61, 0x67, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x53,
+ 0x69, 0x7a, 0x65, 0x0e, 0x74, 0x61, 0x67, 0x53, 0x69, 0x7a, 0x65, 0x10, 0x6e, 0x61, 0x6d, 0x65,
+ 0x53, 0x69, 0x7a, 0x65, 0x0c, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x06, 0x72, 0x65, 0x74, 0x0e,
+ 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x08, 0x66, 0x69, 0x6e, 0x64, 0x0e, 0x63, 0x6f, 0x6e,
+ 0x73, 0x6f, 0x6c, 0x65, 0x0a, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
+ 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x08, 0x64, 0x61, 0x74, 0x61,
+ 0x12, 0x67, 0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x10, 0x67, 0x65, 0x74, 0x55, 0x69,
+ 0x6e, 0x74, 0x38, 0x06, 0x6c, 0x6f, 0x67, 0x0e, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x18,
+ 0x65, 0x76, 0x61, 0x6c, 0x42, 0x79, 0x74, 0x65, 0x43, 0x6f, 0x64, 0x65, 0x08, 0x69, 0x74, 0x65,
+ 0x6d, 0x0a, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x08, 0x6c, 0x69, 0x73, 0x74, 0x08, 0x66, 0x69, 0x6c,
+ 0x65, 0x02, 0x65, 0x0e, 0x65, 0x78, 0x65, 0x70, 0x61, 0x74, 0x68, 0x10, 0x62, 0x61, 0x73, 0x65,
+ 0x70, 0x61, 0x74, 0x68, 0x06, 0x63, 0x77, 0x64, 0x08, 0x70, 0x75, 0x73, 0x68, 0x0e, 0x62, 0x75,
+ 0x6e, 0x64, 0x6c, 0x65, 0x3a, 0x10, 0x70, 0x61, 0x74, 0x68, 0x6e, 0x61, 0x6d, 0x65, 0x16, 0x74,
+ 0x65, 0x78, 0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x10, 0x66, 0x69, 0x6c, 0x65, 0x64,
+ 0x61, 0x74, 0x61, 0x0e, 0x74, 0x61, 0x67, 0x4e, 0x61, 0x6d, 0x65, 0x16, 0x54, 0x65, 0x78, 0x74,
+ 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x10, 0x72, 0x65, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65,
+ 0x0e, 0x6c, 0x69, 0x62, 0x6e, 0x61, 0x6d, 0x65, 0x0c, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x14,
+ 0x62, 0x79, 0x74, 0x65, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x12, 0x73, 0x65, 0x74, 0x55, 0x69,
+ 0x6e, 0x74, 0x33, 0x32, 0x10, 0x73, 0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x10, 0x62, 0x61,
+ 0x73, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x0c, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x0e, 0x64, 0x69,
+ 0x72, 0x6e, 0x61, 0x6d, 0x65, 0x0e, 0x64, 0x69, 0x72, 0x65, 0x6e, 0x74, 0x73, 0x0c, 0x64, 0x69,
+ 0x72, 0x65, 0x6e, 0x74, 0x0e, 0x72, 0x65, 0x61, 0x64, 0x64, 0x69, 0x72, 0x08, 0x74, 0x79, 0x70,
+ 0x65, 0x0e, 0x65, 0x78, 0x65, 0x64, 0x61, 0x74, 0x61, 0x16, 0x66, 0x69, 0x6c, 0x65, 0x45, 0x6e,
+ 0x64, 0x53, 0x69, 0x7a, 0x65, 0x16, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x53, 0x69, 0x7a,
+ 0x65, 0x14, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x18, 0x6f, 0x75, 0x74,
+ 0x70, 0x75, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x12, 0x6d, 0x61, 0x67, 0x69, 0x63, 0x43,
+ 0x6f, 0x64, 0x65, 0x14, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x56, 0x69, 0x65, 0x77, 0x0a, 0x70,
+ 0x72, 0x69, 0x6e, 0x74, 0x10, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x3a, 0x20, 0x0e, 0x2c, 0x20,
+ 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x12, 0x65, 0x78, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x1c,
+ 0x2c, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x16, 0x2c,
+ 0x20, 0x6f, 0x75, 0x74, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x18, 0x40, 0x74, 0x6a, 0x73, 0x2f,
+ 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x12, 0x77, 0x72, 0x69, 0x74, 0x65, 0x46, 0x69, 0x6c,
+ 0x65, 0x0e, 0x6f, 0x75, 0x74, 0x70, 0x61, 0x74, 0x68, 0x12, 0x57, 0x72, 0x69, 0x74, 0x65, 0x20,
+ 0x74, 0x6f, 0x20, 0x08, 0x40, 0x61, 0x70, 0x70, 0x12, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x2f, 0x74,
+ 0x6a, 0x73, 0x0f, 0xc6, 0x03, 0x04, 0xc8, 0x03, 0xca, 0x03, 0xcc, 0x03, 0xce, 0x03, 0x02, 0x00,
+ 0x04, 0xd0, 0x03, 0x00, 0x05, 0xd2, 0x03, 0x00, 0x04, 0x00, 0xfc, 0x01, 0x00, 0x01, 0xfc, 0x01,
+ 0x01, 0x02, 0xfc, 0x01, 0x02, 0x03, 0xfc, 0x01, 0x03, 0x00, 0x0e, 0x20, 0x06, 0x01, 0xa2, 0x01,
+ 0x00, 0x02, 0x00, 0x03, 0x06, 0x08, 0x4e, 0x02, 0xd2, 0x03, 0x02, 0x00, 0x30, 0xee, 0x01, 0x03,
+ 0x01, 0x70, 0xd4, 0x03, 0x00, 0x0d, 0xd6, 0x03, 0x01, 0x0d, 0xd8, 0x03, 0x02, 0x0d, 0xda, 0x03,
+ 0x03, 0x0d, 0xd0, 0x03, 0x00, 0x01, 0xd2, 0x03, 0x01, 0x09, 0x08, 0xec, 0x07, 0xc2, 0x00, 0x5f,
+ 0x04, 0x00, 0x29, 0x61, 0x00, 0x00, 0x06, 0x61, 0x01, 0x00, 0xc1, 0x06, 0x56, 0xe9, 0x00, 0x00,
+ 0x00, 0x00, 0xc2, 0x01, 0x54, 0xee, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x02, 0x54, 0xef, 0x00, 0x00,
+ 0x00, 0x00, 0xc2, 0x03, 0x54, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x04, 0x54, 0xf1, 0x00, 0x00,
+ 0x00, 0x00, 0xc2, 0x05, 0x54, 0xf2, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x07, 0x50, 0xcc, 0x0e, 0xcf,
+ 0x69, 0x01, 0x00, 0x5f, 0x05, 0x00, 0x06, 0x2e, 0xc6, 0x03, 0x01, 0x14, 0x01, 0x00, 0x09, 0x64,
+ 0x00, 0x0f, 0x58, 0x00, 0x08, 0x40, 0x00, 0x08, 0x3c, 0x00, 0x08, 0x38, 0x00, 0x08, 0x64, 0x2b,
+ 0x0e, 0x43, 0x06, 0x01, 0xd0, 0x03, 0x02, 0x06, 0x02, 0x05, 0x00, 0x01, 0xba, 0x02, 0x08, 0xe6,
+ 0x03, 0x00, 0x01, 0x00, 0xe8, 0x03, 0x00, 0x01, 0x00, 0xea, 0x03, 0x01, 0x00, 0x30, 0xec, 0x03,
+ 0x01, 0x01, 0x70, 0xee, 0x03, 0x01, 0x02, 0x30, 0xf0, 0x03, 0x04, 0x03, 0x20, 0xf2, 0x03, 0x08,
+ 0x03, 0x20, 0xf0, 0x03, 0x0a, 0x05, 0x20, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00,
+ 0xd3, 0xd4, 0xaa, 0xec, 0x03, 0x0a, 0x28, 0xd3, 0xeb, 0xcb, 0xd4, 0xeb, 0xcc, 0x38, 0x98, 0x00,
+ 0x00, 0x00, 0x11, 0x62, 0x00, 0x00, 0xb8, 0x9e, 0x21, 0x01, 0x00, 0x42, 0xfa, 0x00, 0x00, 0x00,
+ 0xb7, 0x24, 0x01, 0x00, 0x42, 0xfb, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x24, 0x01, 0x00, 0xcd, 0x62,
+ 0x02, 0x00, 0xb7, 0x47, 0xb7, 0x0a, 0x49, 0x61, 0x03, 0x00, 0xb8, 0xce, 0x62, 0x03, 0x00, 0x62,
+ 0x01, 0x00, 0xa5, 0xec, 0x2f, 0xd4, 0x62, 0x03, 0x00, 0xb8, 0x9f, 0x47, 0x04, 0x7e, 0x00, 0x00,
+ 0x00, 0xac, 0xec, 0x16, 0x62, 0x02, 0x00, 0xb7, 0x47, 0x62, 0x03, 0x00, 0x73, 0x62, 0x02, 0x00,
+ 0xb7, 0x47, 0x62, 0x03, 0x00, 0xb8, 0x9f, 0x47, 0x49, 0x62, 0x03, 0x00, 0x92, 0x63, 0x03, 0x00,
+ 0x0e, 0xee, 0xca, 0x61, 0x04, 0x00, 0xb8, 0xc5, 0x04, 0x62, 0x04, 0x00, 0x62, 0x00, 0x00, 0xa5,
+ 0x6a, 0xa4, 0x00, 0x00, 0x00, 0x61, 0x05, 0x00, 0xb8, 0xc5, 0x05, 0x62, 0x05, 0x00, 0x62, 0x01,
+ 0x00, 0xa5, 0x6a, 0x87, 0x00, 0x00, 0x00, 0xd4, 0x62, 0x05, 0x00, 0xb8, 0x9f, 0x47, 0x04, 0xfc,
+ 0x00, 0x00, 0x00, 0xac, 0x11, 0xed, 0x11, 0x0e, 0xd3, 0x62, 0x04, 0x00, 0xb8, 0x9f, 0x47, 0xd4,
+ 0x62, 0x05, 0x00, 0xb8, 0x9f, 0x47, 0xac, 0xec, 0x1e, 0x62, 0x02, 0x00, 0x62, 0x04, 0x00, 0x47,
+ 0x62, 0x05, 0x00, 0x73, 0x62, 0x02, 0x00, 0x62, 0x04, 0x00, 0xb8, 0x9f, 0x47, 0x62, 0x05, 0x00,
+ 0xb8, 0x9f, 0x47, 0x49, 0xee, 0x3a, 0xd4, 0x62, 0x05, 0x00, 0xb8, 0x9f, 0x47, 0x04, 0x7e, 0x00,
+ 0x00, 0x00, 0xac, 0xec, 0x2b, 0x62, 0x02, 0x00, 0x62, 0x04, 0x00, 0x47, 0x62, 0x05, 0x00, 0x73,
+ 0x62, 0x02, 0x00, 0x62, 0x04, 0x00, 0xb8, 0x9f, 0x47, 0x62, 0x05, 0x00, 0x47, 0x11, 0xed, 0x0f,
+ 0x0e, 0x62, 0x02, 0x00, 0x62, 0x04, 0x00, 0x47, 0x62, 0x05, 0x00, 0xb8, 0x9f, 0x47, 0x49, 0x62,
+ 0x05, 0x00, 0x92, 0x63, 0x05, 0x00, 0x0e, 0xef, 0x73, 0xff, 0x62, 0x04, 0x00, 0x92, 0x63, 0x04,
+ 0x00, 0x0e, 0xef, 0x56, 0xff, 0x62, 0x02, 0x00, 0x62, 0x00, 0x00, 0x47, 0x62, 0x01, 0x00, 0x47,
+ 0x28, 0xc6, 0x03, 0x10, 0x14, 0x30, 0x1c, 0x08, 0x09, 0x12, 0x12, 0xad, 0x2d, 0x49, 0x4e, 0x6d,
+ 0x36, 0x5d, 0x5d, 0xad, 0x8a, 0x58, 0xd6, 0x3a, 0x3b, 0x0e, 0x42, 0x06, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0x04, 0x01, 0x00, 0x17, 0x00, 0xec, 0x03, 0x01, 0x0d, 0x38, 0x98, 0x00, 0x00, 0x00, 0x11,
+ 0x66, 0x00, 0x00, 0xb8, 0x9e, 0x21, 0x01, 0x00, 0x42, 0xfa, 0x00, 0x00, 0x00, 0x09, 0x25, 0x01,
+ 0x00, 0xc6, 0x03, 0x17, 0x00, 0x0e, 0x62, 0x07, 0x01, 0x00, 0x01, 0x0a, 0x01, 0x05, 0x01, 0x01,
+ 0xdf, 0x01, 0x0b, 0x6e, 0x00, 0x01, 0x40, 0xfa, 0x03, 0x01, 0x00, 0x30, 0xfc, 0x03, 0x01, 0x01,
+ 0x30, 0xfe, 0x03, 0x01, 0x02, 0x30, 0x80, 0x04, 0x01, 0x03, 0x30, 0x82, 0x04, 0x01, 0x04, 0x30,
+ 0x84, 0x04, 0x01, 0x05, 0x30, 0x86, 0x04, 0x01, 0x06, 0x30, 0x60, 0x01, 0x07, 0x30, 0x88, 0x04,
+ 0x01, 0x08, 0x30, 0x10, 0x00, 0x01, 0x00, 0xda, 0x03, 0x03, 0x0c, 0x08, 0xc5, 0x09, 0x61, 0x08,
+ 0x00, 0x61, 0x07, 0x00, 0x61, 0x06, 0x00, 0x61, 0x05, 0x00, 0x61, 0x04, 0x00, 0x61, 0x03, 0x00,
+ 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0xc4, 0x09, 0x41, 0x05, 0x01, 0x00, 0x00,
+ 0x42, 0x06, 0x01, 0x00, 0x00, 0xc2, 0x00, 0x24, 0x01, 0x00, 0xcb, 0x62, 0x00, 0x00, 0x97, 0xec,
+ 0x17, 0x38, 0x07, 0x01, 0x00, 0x00, 0x42, 0x08, 0x01, 0x00, 0x00, 0x04, 0x09, 0x01, 0x00, 0x00,
+ 0xd3, 0x24, 0x02, 0x00, 0x0e, 0x06, 0x2e, 0x62, 0x00, 0x00, 0x41, 0x0a, 0x01, 0x00, 0x00, 0xcc,
+ 0x38, 0xb3, 0x00, 0x00, 0x00, 0x11, 0x62, 0x01, 0x00, 0x41, 0xfe, 0x00, 0x00, 0x00, 0x21, 0x01,
+ 0x00, 0xcd, 0xbf, 0x08, 0xce, 0x62, 0x02, 0x00, 0x42, 0x0b, 0x01, 0x00, 0x00, 0xb7, 0x24, 0x01,
+ 0x00, 0xc5, 0x04, 0x62, 0x02, 0x00, 0x42, 0x0c, 0x01, 0x00, 0x00, 0xbe, 0x24, 0x01, 0x00, 0xc5,
+ 0x05, 0x38, 0x07, 0x01, 0x00, 0x00, 0x42, 0x0d, 0x01, 0x00, 0x00, 0x62, 0x04, 0x00, 0x62, 0x05,
+ 0x00, 0x24, 0x02, 0x00, 0x0e, 0x62, 0x03, 0x00, 0x62, 0x05, 0x00, 0x9e, 0xc5, 0x06, 0x62, 0x04,
+ 0x00, 0x62, 0x05, 0x00, 0x9f, 0xc5, 0x07, 0x66, 0x00, 0x00, 0x41, 0x0e, 0x01, 0x00, 0x00, 0x42,
+ 0x0f, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x41, 0xfe, 0x00, 0x00, 0x00, 0x62, 0x06, 0x00, 0x62,
+ 0x07, 0x00, 0x24, 0x03, 0x00, 0xc5, 0x08, 0x38, 0x07, 0x01, 0x00, 0x00, 0x42, 0x0d, 0x01, 0x00,
+ 0x00, 0x62, 0x08, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x4a, 0x10, 0x99, 0x5d,
+ 0x21, 0x67, 0x08, 0x09, 0x30, 0x5e, 0x12, 0x49, 0x4a, 0x68, 0x30, 0x30, 0xa3, 0x58, 0x0e, 0x42,
+ 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x09, 0x01, 0xa0, 0x04, 0x00, 0x01, 0x00,
+ 0x6e, 0x00, 0x03, 0xd3, 0x41, 0x37, 0x00, 0x00, 0x00, 0xdf, 0xac, 0x28, 0xc6, 0x03, 0x4b, 0x00,
+ 0x0e, 0x62, 0x07, 0x01, 0x00, 0x01, 0x06, 0x01, 0x09, 0x02, 0x00, 0xd7, 0x01, 0x07, 0xa2, 0x04,
+ 0x00, 0x01, 0x00, 0xa4, 0x04, 0x01, 0x00, 0x30, 0xa6, 0x04, 0x06, 0x01, 0x30, 0xe2, 0x03, 0x07,
+ 0x02, 0x30, 0xe6, 0x03, 0x08, 0x01, 0x30, 0xa8, 0x04, 0x0b, 0x04, 0x03, 0x10, 0x00, 0x01, 0x00,
+ 0xda, 0x03, 0x03, 0x0c, 0xd4, 0x03, 0x00, 0x0c, 0x08, 0xc5, 0x05, 0x61, 0x00, 0x00, 0xc4, 0x05,
+ 0x41, 0x15, 0x01, 0x00, 0x00, 0x97, 0xec, 0x13, 0xc4, 0x05, 0x66, 0x00, 0x00, 0x42, 0x15, 0x01,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0x43, 0x15, 0x01, 0x00, 0x00, 0xc4, 0x05, 0x41, 0x16, 0x01, 0x00,
+ 0x00, 0x97, 0xec, 0x13, 0xc4, 0x05, 0x66, 0x01, 0x00, 0x42, 0x17, 0x01, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0x43, 0x16, 0x01, 0x00, 0x00, 0x26, 0x00, 0x00, 0xcb, 0x61, 0x01, 0x00, 0xd3, 0x7f, 0xee,
+ 0x31, 0xcc, 0x61, 0x02, 0x00, 0xc4, 0x05, 0x42, 0xf1, 0x00, 0x00, 0x00, 0xc4, 0x05, 0x41, 0x16,
+ 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x24, 0x02, 0x00, 0x8c, 0xcd, 0x62, 0x00, 0x00, 0x42, 0x18,
+ 0x01, 0x00, 0x00, 0x26, 0x00, 0x00, 0xb7, 0x62, 0x02, 0x00, 0x52, 0x0e, 0x18, 0x27, 0x00, 0x00,
+ 0x0e, 0x82, 0x00, 0xec, 0xcd, 0x0e, 0x85, 0x61, 0x03, 0x00, 0x62, 0x00, 0x00, 0x7f, 0xee, 0x3c,
+ 0xce, 0x6d, 0x16, 0x00, 0x00, 0x00, 0xc4, 0x05, 0x42, 0xf0, 0x00, 0x00, 0x00, 0x62, 0x03, 0x00,
+ 0x24, 0x01, 0x00, 0x8c, 0x0e, 0x0e, 0xee, 0x24, 0xc5, 0x04, 0x6d, 0x1f, 0x00, 0x00, 0x00, 0x38,
+ 0x07, 0x01, 0x00, 0x00, 0x42, 0x08, 0x01, 0x00, 0x00, 0x04, 0x19, 0x01, 0x00, 0x00, 0x62, 0x03,
+ 0x00, 0xc4, 0x04, 0x24, 0x03, 0x00, 0x0e, 0x0e, 0xee, 0x02, 0x2f, 0x82, 0x00, 0xec, 0xc2, 0x0e,
+ 0x85, 0xc4, 0x05, 0x42, 0xf2, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x8c, 0x0e, 0x06, 0x2e, 0xc6,
+ 0x03, 0x64, 0x12, 0x21, 0x35, 0x5f, 0x35, 0x5f, 0x18, 0x3a, 0x71, 0x71, 0x22, 0x35, 0x1c, 0x4f,
+ 0x35, 0x7b, 0x17, 0x22, 0x3f, 0x0e, 0x62, 0x07, 0x01, 0x00, 0x01, 0x0b, 0x01, 0x05, 0x03, 0x00,
+ 0xd3, 0x02, 0x0c, 0xb4, 0x04, 0x00, 0x01, 0x00, 0xb6, 0x04, 0x01, 0x00, 0x30, 0xe6, 0x03, 0x01,
+ 0x01, 0x30, 0xb8, 0x04, 0x01, 0x02, 0x30, 0x6e, 0x01, 0x03, 0x30, 0x94, 0x04, 0x01, 0x04, 0x30,
+ 0xba, 0x04, 0x01, 0x05, 0x30, 0x82, 0x04, 0x01, 0x06, 0x30, 0x80, 0x04, 0x01, 0x07, 0x30, 0xfc,
+ 0x03, 0x01, 0x08, 0x30, 0xfe, 0x03, 0x01, 0x09, 0x30, 0x10, 0x00, 0x01, 0x00, 0xd8, 0x03, 0x02,
+ 0x0c, 0xd6, 0x03, 0x01, 0x0c, 0xda, 0x03, 0x03, 0x0c, 0x08, 0xc5, 0x0a, 0x61, 0x09, 0x00, 0x61,
+ 0x08, 0x00, 0x61, 0x07, 0x00, 0x61, 0x06, 0x00, 0x61, 0x05, 0x00, 0x61, 0x04, 0x00, 0x61, 0x03,
+ 0x00, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0x38, 0x1e, 0x01, 0x00, 0x00, 0x11,
+ 0x21, 0x00, 0x00, 0xcb, 0x66, 0x00, 0x00, 0x42, 0x5c, 0x00, 0x00, 0x00, 0xc4, 0x0a, 0x41, 0x16,
+ 0x01, 0x00, 0x00, 0xd3, 0x24, 0x02, 0x00, 0xcc, 0x66, 0x01, 0x00, 0x42, 0x1f, 0x01, 0x00, 0x00,
+ 0x62, 0x01, 0x00, 0x24, 0x01, 0x00, 0x8c, 0xcd, 0x62, 0x02, 0x00, 0x07, 0xaa, 0xec, 0x03, 0x06,
+ 0x2e, 0x66, 0x00, 0x00, 0x42, 0x5c, 0x00, 0x00, 0x00, 0xc4, 0x0a, 0x41, 0x20, 0x01, 0x00, 0x00,
+ 0xd3, 0x24, 0x02, 0x00, 0xce, 0x66, 0x02, 0x00, 0x41, 0x0e, 0x01, 0x00, 0x00, 0x42, 0xf0, 0x00,
+ 0x00, 0x00, 0x62, 0x02, 0x00, 0x41, 0xfe, 0x00, 0x00, 0x00, 0x62, 0x03, 0x00, 0x24, 0x02, 0x00,
+ 0xc5, 0x04, 0x62, 0x00, 0x00, 0x42, 0x21, 0x01, 0x00, 0x00, 0x62, 0x03, 0x00, 0x24, 0x01, 0x00,
+ 0xc5, 0x05, 0x62, 0x05, 0x00, 0x41, 0x22, 0x01, 0x00, 0x00, 0x62, 0x04, 0x00, 0x41, 0x22, 0x01,
+ 0x00, 0x00, 0x9e, 0xc5, 0x06, 0xbf, 0x08, 0xc5, 0x07, 0x38, 0xaa, 0x00, 0x00, 0x00, 0x11, 0x62,
+ 0x06, 0x00, 0x62, 0x07, 0x00, 0x9e, 0x21, 0x01, 0x00, 0xc5, 0x08, 0x38, 0xb3, 0x00, 0x00, 0x00,
+ 0x11, 0x62, 0x08, 0x00, 0x41, 0xfe, 0x00, 0x00, 0x00, 0x21, 0x01, 0x00, 0xc5, 0x09, 0x62, 0x09,
+ 0x00, 0x42, 0x23, 0x01, 0x00, 0x00, 0xb7, 0x62, 0x06, 0x00, 0x24, 0x02, 0x00, 0x0e, 0x62, 0x09,
+ 0x00, 0x42, 0x24, 0x01, 0x00, 0x00, 0xbe, 0x62, 0x05, 0x00, 0x41, 0x22, 0x01, 0x00, 0x00, 0x24,
+ 0x02, 0x00, 0x0e, 0x62, 0x08, 0x00, 0x42, 0x43, 0x00, 0x00, 0x00, 0x62, 0x05, 0x00, 0x62, 0x07,
+ 0x00, 0x24, 0x02, 0x00, 0x0e, 0x62, 0x08, 0x00, 0x42, 0x43, 0x00, 0x00, 0x00, 0x38, 0xaa, 0x00,
+ 0x00, 0x00, 0x11, 0x62, 0x04, 0x00, 0x21, 0x01, 0x00, 0x62, 0x07, 0x00, 0x62, 0x05, 0x00, 0x41,
+ 0x22, 0x01, 0x00, 0x00, 0x9e, 0x24, 0x02, 0x00, 0x0e, 0xc4, 0x0a, 0x41, 0x05, 0x01, 0x00, 0x00,
+ 0x42, 0x18, 0x01, 0x00, 0x00, 0x0b, 0x62, 0x03, 0x00, 0x4c, 0x37, 0x00, 0x00, 0x00, 0x62, 0x08,
+ 0x00, 0x4c, 0x0a, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x85, 0x01,
+ 0x13, 0xa8, 0x35, 0x67, 0x53, 0x26, 0x08, 0x09, 0x67, 0x95, 0x53, 0x62, 0x18, 0x5d, 0x62, 0x53,
+ 0x6c, 0x5d, 0xb8, 0xa8, 0x0e, 0x62, 0x07, 0x01, 0x00, 0x02, 0x05, 0x02, 0x09, 0x03, 0x00, 0xa0,
+ 0x01, 0x07, 0xca, 0x04, 0x00, 0x01, 0x00, 0x6e, 0x00, 0x01, 0x00, 0xcc, 0x04, 0x01, 0x00, 0x30,
+ 0xce, 0x04, 0x01, 0x01, 0x30, 0xe6, 0x03, 0x01, 0x02, 0x30, 0xd0, 0x04, 0x01, 0x03, 0x30, 0xd2,
+ 0x04, 0x04, 0x04, 0x30, 0xd8, 0x03, 0x02, 0x0c, 0xd6, 0x03, 0x01, 0x0c, 0xd0, 0x03, 0x04, 0x00,
+ 0x61, 0x03, 0x00, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0x26, 0x00, 0x00, 0xcb,
+ 0xd4, 0x97, 0xec, 0x05, 0x62, 0x00, 0x00, 0x2e, 0x66, 0x00, 0x00, 0x42, 0x27, 0x01, 0x00, 0x00,
+ 0xd4, 0x24, 0x01, 0x00, 0xcc, 0x66, 0x00, 0x00, 0x42, 0x25, 0x01, 0x00, 0x00, 0xd4, 0x24, 0x01,
+ 0x00, 0xcd, 0x66, 0x01, 0x00, 0x42, 0x2a, 0x01, 0x00, 0x00, 0x66, 0x00, 0x00, 0x42, 0x5c, 0x00,
+ 0x00, 0x00, 0xd3, 0x62, 0x01, 0x00, 0x24, 0x02, 0x00, 0x24, 0x01, 0x00, 0x8c, 0xce, 0x61, 0x04,
+ 0x00, 0x62, 0x03, 0x00, 0x7f, 0xee, 0x40, 0xc5, 0x04, 0x62, 0x04, 0x00, 0x41, 0x2b, 0x01, 0x00,
+ 0x00, 0xb8, 0xab, 0xed, 0x32, 0xe1, 0x62, 0x04, 0x00, 0x41, 0x37, 0x00, 0x00, 0x00, 0x62, 0x02,
+ 0x00, 0xf2, 0xec, 0x23, 0x62, 0x00, 0x00, 0x42, 0x18, 0x01, 0x00, 0x00, 0x66, 0x00, 0x00, 0x42,
+ 0x5c, 0x00, 0x00, 0x00, 0x62, 0x01, 0x00, 0x62, 0x04, 0x00, 0x41, 0x37, 0x00, 0x00, 0x00, 0x24,
+ 0x02, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x82, 0x00, 0xec, 0xbe, 0x0e, 0x85, 0x62, 0x00, 0x00, 0x2e,
+ 0xc6, 0x03, 0xa2, 0x01, 0x0e, 0x40, 0x17, 0x17, 0x12, 0x09, 0x44, 0x45, 0x8f, 0x3a, 0x35, 0x0f,
+ 0x4e, 0xae, 0x22, 0x0e, 0x62, 0x07, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x0a, 0x01, 0x00, 0x82, 0x04,
+ 0x0e, 0xaa, 0x04, 0x01, 0x00, 0x30, 0xd8, 0x04, 0x01, 0x01, 0x30, 0xda, 0x04, 0x01, 0x02, 0x30,
+ 0x8a, 0x04, 0x01, 0x03, 0x30, 0xdc, 0x04, 0x01, 0x04, 0x20, 0xfa, 0x03, 0x04, 0x0d, 0x30, 0xde,
+ 0x04, 0x01, 0x05, 0x30, 0xe0, 0x04, 0x01, 0x07, 0x30, 0x86, 0x04, 0x01, 0x08, 0x20, 0xfa, 0x03,
+ 0x06, 0x0d, 0x30, 0xb6, 0x04, 0x01, 0x09, 0x30, 0xe2, 0x04, 0x01, 0x0b, 0x30, 0xe4, 0x04, 0x01,
+ 0x0c, 0x30, 0x10, 0x00, 0x01, 0x00, 0xd6, 0x03, 0x01, 0x0c, 0x08, 0xc5, 0x0d, 0x61, 0x0c, 0x00,
+ 0x61, 0x0b, 0x00, 0x61, 0x0a, 0x00, 0x61, 0x08, 0x00, 0x61, 0x07, 0x00, 0x61, 0x06, 0x00, 0x61,
+ 0x04, 0x00, 0x61, 0x03, 0x00, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0xc4, 0x0d,
+ 0x41, 0x15, 0x01, 0x00, 0x00, 0xcb, 0x66, 0x00, 0x00, 0x42, 0x1f, 0x01, 0x00, 0x00, 0x62, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0x8c, 0xcc, 0x62, 0x01, 0x00, 0x07, 0xaa, 0xec, 0x03, 0x06, 0x2e, 0xbf,
+ 0x10, 0xcd, 0xc4, 0x0d, 0x41, 0x05, 0x01, 0x00, 0x00, 0xce, 0xb7, 0xc5, 0x04, 0x61, 0x05, 0x00,
+ 0x62, 0x03, 0x00, 0x7f, 0xee, 0x19, 0xc5, 0x05, 0x62, 0x04, 0x00, 0x62, 0x05, 0x00, 0x41, 0x0a,
+ 0x01, 0x00, 0x00, 0x41, 0x22, 0x01, 0x00, 0x00, 0x9e, 0x11, 0x63, 0x04, 0x00, 0x0e, 0x82, 0x00,
+ 0xec, 0xe5, 0x0e, 0x85, 0x62, 0x01, 0x00, 0x41, 0x22, 0x01, 0x00, 0x00, 0x62, 0x04, 0x00, 0x9e,
+ 0x62, 0x02, 0x00, 0x9e, 0xc5, 0x06, 0x38, 0xaa, 0x00, 0x00, 0x00, 0x11, 0x62, 0x06, 0x00, 0x21,
+ 0x01, 0x00, 0xc5, 0x07, 0x62, 0x07, 0x00, 0x42, 0x43, 0x00, 0x00, 0x00, 0x62, 0x01, 0x00, 0xb7,
+ 0x24, 0x02, 0x00, 0x0e, 0x62, 0x01, 0x00, 0x41, 0x22, 0x01, 0x00, 0x00, 0xc5, 0x08, 0x61, 0x09,
+ 0x00, 0x62, 0x03, 0x00, 0x7f, 0xee, 0x65, 0xc5, 0x09, 0x62, 0x07, 0x00, 0x42, 0x43, 0x00, 0x00,
+ 0x00, 0x62, 0x09, 0x00, 0x41, 0x0a, 0x01, 0x00, 0x00, 0x62, 0x08, 0x00, 0x24, 0x02, 0x00, 0x0e,
+ 0x62, 0x08, 0x00, 0x62, 0x09, 0x00, 0x41, 0x0a, 0x01, 0x00, 0x00, 0x41, 0x22, 0x01, 0x00, 0x00,
+ 0x9e, 0x11, 0x63, 0x08, 0x00, 0x0e, 0x38, 0x07, 0x01, 0x00, 0x00, 0x42, 0x33, 0x01, 0x00, 0x00,
+ 0x04, 0x34, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x09, 0x00, 0x41, 0x37, 0x00,
+ 0x00, 0x00, 0x04, 0x35, 0x01, 0x00, 0x00, 0x62, 0x09, 0x00, 0x41, 0x0a, 0x01, 0x00, 0x00, 0x41,
+ 0x22, 0x01, 0x00, 0x00, 0x24, 0x03, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x82, 0x00, 0xec, 0x99, 0x0e,
+ 0x85, 0x38, 0x07, 0x01, 0x00, 0x00, 0x42, 0x33, 0x01, 0x00, 0x00, 0x04, 0x36, 0x01, 0x00, 0x00,
+ 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x01, 0x00, 0x41, 0x22, 0x01, 0x00, 0x00, 0x04, 0x37, 0x01,
+ 0x00, 0x00, 0x62, 0x04, 0x00, 0x04, 0x38, 0x01, 0x00, 0x00, 0x62, 0x06, 0x00, 0x24, 0x05, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0x38, 0x1e, 0x01, 0x00, 0x00, 0x11, 0x21, 0x00, 0x00, 0xc5, 0x0a, 0x62,
+ 0x0a, 0x00, 0x42, 0x21, 0x01, 0x00, 0x00, 0x04, 0x39, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xc5,
+ 0x0b, 0x62, 0x01, 0x00, 0x41, 0x22, 0x01, 0x00, 0x00, 0x62, 0x04, 0x00, 0x9e, 0x11, 0x63, 0x08,
+ 0x00, 0x0e, 0x62, 0x07, 0x00, 0x42, 0x43, 0x00, 0x00, 0x00, 0x62, 0x0b, 0x00, 0x62, 0x08, 0x00,
+ 0x24, 0x02, 0x00, 0x0e, 0x38, 0xb3, 0x00, 0x00, 0x00, 0x11, 0x62, 0x07, 0x00, 0x41, 0xfe, 0x00,
+ 0x00, 0x00, 0x21, 0x01, 0x00, 0xc5, 0x0c, 0x62, 0x0c, 0x00, 0x42, 0x23, 0x01, 0x00, 0x00, 0x62,
+ 0x08, 0x00, 0xbf, 0x0c, 0x9e, 0x62, 0x01, 0x00, 0x41, 0x22, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00,
+ 0x0e, 0x66, 0x00, 0x00, 0x42, 0x3a, 0x01, 0x00, 0x00, 0xc4, 0x0d, 0x41, 0x3b, 0x01, 0x00, 0x00,
+ 0x62, 0x07, 0x00, 0x24, 0x02, 0x00, 0x8c, 0x0e, 0x38, 0x07, 0x01, 0x00, 0x00, 0x42, 0x33, 0x01,
+ 0x00, 0x00, 0x04, 0x3c, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0xc4, 0x0d, 0x41, 0x3b,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0xbe, 0x01,
+ 0x22, 0xb7, 0x2c, 0x53, 0x26, 0x08, 0x09, 0x13, 0x2b, 0x12, 0x3a, 0x71, 0x22, 0x5d, 0x49, 0x55,
+ 0x35, 0x3a, 0x76, 0x71, 0x00, 0x35, 0x02, 0x22, 0x00, 0x33, 0x06, 0x3a, 0x5d, 0x58, 0x5f, 0x62,
+ 0x87, 0x77, 0xad, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0f, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0xee, 0x01, 0x01, 0x0d, 0x08, 0xcb, 0x2b, 0x66, 0x00, 0x00, 0x11, 0xec,
+ 0x06, 0xc7, 0x1b, 0x24, 0x00, 0x00, 0x29, 0xc6, 0x03, 0xeb, 0x01, 0x00, 0x0e, 0x48, 0x05, 0x01,
+ 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x00, 0x3e, 0x02, 0x10, 0x00, 0x01, 0x00, 0xe8, 0x01, 0x00,
+ 0x01, 0x00, 0x0c, 0x04, 0xcc, 0x08, 0xcb, 0xee, 0x01, 0xc7, 0xc3, 0x4c, 0x16, 0x01, 0x00, 0x00,
+ 0xc7, 0xc3, 0x4c, 0x15, 0x01, 0x00, 0x00, 0xc7, 0x26, 0x00, 0x00, 0x4c, 0x11, 0x01, 0x00, 0x00,
+ 0xc7, 0x04, 0x3d, 0x01, 0x00, 0x00, 0x4c, 0x20, 0x01, 0x00, 0x00, 0xc7, 0x26, 0x00, 0x00, 0x4c,
+ 0x05, 0x01, 0x00, 0x00, 0xc7, 0x04, 0x3e, 0x01, 0x00, 0x00, 0x4c, 0x3b, 0x01, 0x00, 0x00, 0x29,
+ 0xc6, 0x03, 0x00, 0x0c, 0x00, 0x05, 0x68, 0x32, 0x28, 0x32, 0x3c, 0x32, 0x00, 0x0b, 0xd0, 0x02,
+};
+
+static const uint8_t tjs_m_build_src_link[1870] = {
+ 0x02, 0x3f, 0x2c, 0x40, 0x61, 0x70, 0x70, 0x2f, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x2f, 0x73, 0x72,
+ 0x63, 0x2f, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x6a, 0x73, 0x0e, 0x40, 0x74, 0x6a, 0x73, 0x2f, 0x6f,
+ 0x73, 0x0e, 0x40, 0x74, 0x6a, 0x73, 0x2f, 0x66, 0x73, 0x08, 0x6c, 0x69, 0x6e, 0x6b, 0x0c, 0x75,
+ 0x6e, 0x6c, 0x69, 0x6e, 0x6b, 0x04, 0x6f, 0x73, 0x04, 0x66, 0x73, 0x04, 0x72, 0x6d, 0x10, 0x6d,
+ 0x61, 0x6b, 0x65, 0x4c, 0x69, 0x6e, 0x6b, 0x0c, 0x6d, 0x6b, 0x64, 0x69, 0x72, 0x70, 0x1c, 0x4c,
+ 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x42, 0x49, 0x4e, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x22, 0x49, 0x4e,
+ 0x53, 0x54, 0x41, 0x4c, 0x4c, 0x5f, 0x52, 0x4f, 0x4f, 0x54, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x1c,
+ 0x2f, 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x2f, 0x62, 0x69, 0x6e, 0x1c, 0x2f,
+ 0x75, 0x73, 0x72, 0x2f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x2f, 0x74, 0x6a, 0x73, 0x0e, 0x63, 0x6f,
+ 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x08, 0x61, 0x72, 0x67, 0x73, 0x0e, 0x6f, 0x70, 0x74, 0x69, 0x6f,
+ 0x6e, 0x73, 0x0e, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x0c, 0x72, 0x65, 0x73, 0x75, 0x6c,
+ 0x74, 0x02, 0x65, 0x0a, 0x73, 0x70, 0x61, 0x77, 0x6e, 0x08, 0x77, 0x61, 0x69, 0x74, 0x10, 0x66,
+ 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x0c, 0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x0c, 0x63,
+ 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x0e, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x10, 0x72, 0x65,
+ 0x61, 0x64, 0x6c, 0x69, 0x6e, 0x6b, 0x0a, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x04, 0x20, 0x2a, 0x0a,
+ 0x77, 0x68, 0x69, 0x74, 0x65, 0x04, 0x2d, 0x3e, 0x08, 0x62, 0x6c, 0x75, 0x65, 0x04, 0x20, 0x2b,
+ 0x0a, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x04, 0x6c, 0x6e, 0x06, 0x2d, 0x73, 0x66, 0x0a, 0x6d, 0x6b,
+ 0x64, 0x69, 0x72, 0x04, 0x2d, 0x70, 0x0a, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x18, 0x50, 0x52, 0x4f,
+ 0x4a, 0x45, 0x43, 0x54, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x1c, 0x42, 0x55, 0x49, 0x4c, 0x44, 0x5f,
+ 0x42, 0x49, 0x4e, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x0a, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x0a, 0x6c,
+ 0x6f, 0x63, 0x61, 0x6c, 0x08, 0x64, 0x74, 0x30, 0x32, 0x08, 0x64, 0x74, 0x30, 0x31, 0x06, 0x63,
+ 0x77, 0x64, 0x0e, 0x2f, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x2f, 0x46, 0x53, 0x79, 0x6d, 0x6c, 0x69,
+ 0x6e, 0x6b, 0x73, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x6a,
+ 0x65, 0x63, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x27, 0x04, 0x27,
+ 0x0a, 0x0a, 0x2f, 0x63, 0x6f, 0x6e, 0x66, 0x08, 0x2f, 0x61, 0x70, 0x70, 0x08, 0x2f, 0x62, 0x69,
+ 0x6e, 0x06, 0x74, 0x6a, 0x73, 0x08, 0x74, 0x6a, 0x73, 0x63, 0x0a, 0x2f, 0x62, 0x69, 0x6e, 0x2f,
+ 0x02, 0x2f, 0x10, 0x2f, 0x61, 0x70, 0x70, 0x2f, 0x61, 0x70, 0x70, 0x20, 0x0a, 0x4c, 0x69, 0x6e,
+ 0x6b, 0x20, 0x66, 0x69, 0x6e, 0x69, 0x73, 0x68, 0x65, 0x64, 0x2e, 0x0a, 0x0c, 0x72, 0x65, 0x6d,
+ 0x6f, 0x76, 0x65, 0x24, 0x0a, 0x55, 0x6e, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x66, 0x69, 0x6e, 0x69,
+ 0x73, 0x68, 0x65, 0x64, 0x2e, 0x0a, 0x06, 0x2d, 0x72, 0x66, 0x04, 0x20, 0x2d, 0x06, 0x72, 0x65,
+ 0x64, 0x0f, 0xc6, 0x03, 0x02, 0xc8, 0x03, 0xca, 0x03, 0x02, 0x00, 0x08, 0xcc, 0x03, 0x00, 0x09,
+ 0xce, 0x03, 0x00, 0x02, 0x00, 0xfc, 0x01, 0x00, 0x01, 0xfc, 0x01, 0x01, 0x00, 0x0e, 0x20, 0x06,
+ 0x01, 0xa2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x06, 0x30, 0x00, 0xd0, 0x03, 0x00, 0x0d, 0xd2,
+ 0x03, 0x01, 0x0d, 0x8e, 0x02, 0x00, 0x01, 0xd4, 0x03, 0x01, 0x01, 0xd6, 0x03, 0x02, 0x01, 0xd8,
+ 0x03, 0x03, 0x01, 0xda, 0x03, 0x04, 0x0d, 0xdc, 0x03, 0x05, 0x0d, 0xcc, 0x03, 0x06, 0x01, 0xce,
+ 0x03, 0x07, 0x01, 0x08, 0xec, 0x1c, 0xc2, 0x00, 0xe5, 0xc2, 0x01, 0xe6, 0xc2, 0x02, 0x5f, 0x04,
+ 0x00, 0xc2, 0x03, 0x5f, 0x05, 0x00, 0xc2, 0x04, 0x5f, 0x08, 0x00, 0xc2, 0x05, 0x5f, 0x09, 0x00,
+ 0x29, 0x04, 0xef, 0x00, 0x00, 0x00, 0x5f, 0x06, 0x00, 0x04, 0xf0, 0x00, 0x00, 0x00, 0x5f, 0x07,
+ 0x00, 0x06, 0x2e, 0xc6, 0x03, 0x01, 0x09, 0x01, 0x00, 0x1e, 0x80, 0x01, 0x2b, 0x00, 0x08, 0x7e,
+ 0x0e, 0x62, 0x06, 0x01, 0x8e, 0x02, 0x03, 0x03, 0x03, 0x06, 0x01, 0x00, 0x38, 0x06, 0xe2, 0x03,
+ 0x00, 0x01, 0x00, 0xe4, 0x03, 0x00, 0x01, 0x00, 0xe6, 0x03, 0x00, 0x01, 0x00, 0xe8, 0x03, 0x02,
+ 0x00, 0x30, 0xea, 0x03, 0x02, 0x01, 0x30, 0xec, 0x03, 0x03, 0x00, 0x03, 0xd0, 0x03, 0x00, 0x0c,
+ 0x6d, 0x2b, 0x00, 0x00, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0x66, 0x00, 0x00, 0x42, 0xf7,
+ 0x00, 0x00, 0x00, 0xd3, 0xd4, 0xd5, 0x24, 0x03, 0x00, 0xcb, 0x62, 0x00, 0x00, 0x42, 0xf8, 0x00,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0x8c, 0xcc, 0x62, 0x01, 0x00, 0x70, 0x2e, 0xcd, 0x6d, 0x07, 0x00,
+ 0x00, 0x00, 0x0e, 0xee, 0x02, 0x2f, 0x06, 0x2e, 0xc6, 0x03, 0x0b, 0x07, 0x03, 0x3a, 0x4e, 0x44,
+ 0x17, 0x26, 0x17, 0x0e, 0x62, 0x06, 0x01, 0xd4, 0x03, 0x01, 0x00, 0x01, 0x04, 0x02, 0x00, 0x1f,
+ 0x01, 0xf2, 0x03, 0x00, 0x01, 0x00, 0xd2, 0x03, 0x01, 0x0c, 0x8e, 0x02, 0x02, 0x00, 0x66, 0x00,
+ 0x00, 0x42, 0xfa, 0x00, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x8c, 0xec, 0x0f, 0xe0, 0x04, 0xea,
+ 0x00, 0x00, 0x00, 0xd3, 0x26, 0x01, 0x00, 0x0b, 0xf3, 0x8c, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x18,
+ 0x03, 0x03, 0x4e, 0x4a, 0x0e, 0x62, 0x06, 0x01, 0xd6, 0x03, 0x02, 0x03, 0x02, 0x09, 0x02, 0x00,
+ 0xbc, 0x01, 0x05, 0xae, 0x01, 0x00, 0x01, 0x00, 0x6e, 0x00, 0x01, 0x00, 0xf6, 0x03, 0x01, 0x00,
+ 0x30, 0xf2, 0x03, 0x02, 0x01, 0x30, 0xec, 0x03, 0x05, 0x01, 0x03, 0xd2, 0x03, 0x01, 0x0c, 0x8e,
+ 0x02, 0x02, 0x00, 0x61, 0x00, 0x00, 0x38, 0xfc, 0x00, 0x00, 0x00, 0x41, 0xfb, 0x00, 0x00, 0x00,
+ 0xcb, 0x6d, 0x60, 0x00, 0x00, 0x00, 0x61, 0x01, 0x00, 0x66, 0x00, 0x00, 0x42, 0xfd, 0x00, 0x00,
+ 0x00, 0xd4, 0x24, 0x01, 0x00, 0x8c, 0xcc, 0x62, 0x01, 0x00, 0xd3, 0xaa, 0xec, 0x34, 0x38, 0xfc,
+ 0x00, 0x00, 0x00, 0x42, 0xfe, 0x00, 0x00, 0x00, 0x04, 0xff, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00,
+ 0x42, 0x00, 0x01, 0x00, 0x00, 0xd4, 0x24, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x00, 0x62, 0x00,
+ 0x00, 0x42, 0x02, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x24, 0x04, 0x00, 0x0e, 0x06, 0x70,
+ 0x2e, 0x66, 0x00, 0x00, 0x42, 0xe7, 0x00, 0x00, 0x00, 0xd4, 0x24, 0x01, 0x00, 0x8c, 0x0e, 0x0e,
+ 0xee, 0x0b, 0xcd, 0x6d, 0x07, 0x00, 0x00, 0x00, 0x0e, 0xee, 0x02, 0x2f, 0x38, 0xfc, 0x00, 0x00,
+ 0x00, 0x42, 0xfe, 0x00, 0x00, 0x00, 0x04, 0x03, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x42, 0x04,
+ 0x01, 0x00, 0x00, 0xd4, 0x24, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x42,
+ 0x02, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x24, 0x04, 0x00, 0x0e, 0xe0, 0x04, 0x05, 0x01,
+ 0x00, 0x00, 0x04, 0x06, 0x01, 0x00, 0x00, 0xd3, 0xd4, 0x26, 0x03, 0x00, 0x0b, 0xf3, 0x2e, 0xc6,
+ 0x03, 0x23, 0x0c, 0x14, 0x3a, 0x2b, 0x49, 0x26, 0xf3, 0x0d, 0x09, 0x4a, 0x31, 0x18, 0xf3, 0x0e,
+ 0x62, 0x06, 0x01, 0xd8, 0x03, 0x01, 0x00, 0x01, 0x04, 0x01, 0x00, 0x15, 0x01, 0xf2, 0x03, 0x00,
+ 0x01, 0x00, 0x8e, 0x02, 0x02, 0x00, 0xdf, 0x04, 0x07, 0x01, 0x00, 0x00, 0x04, 0x08, 0x01, 0x00,
+ 0x00, 0xd3, 0x26, 0x02, 0x00, 0x0b, 0xf3, 0x8c, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x3c, 0x02, 0x03,
+ 0x62, 0x0e, 0x62, 0x06, 0x01, 0xcc, 0x03, 0x01, 0x04, 0x01, 0x0a, 0x06, 0x00, 0xca, 0x02, 0x05,
+ 0x92, 0x04, 0x00, 0x01, 0x00, 0x94, 0x04, 0x01, 0x00, 0x30, 0x96, 0x04, 0x01, 0x01, 0x30, 0x98,
+ 0x04, 0x01, 0x02, 0x30, 0x6e, 0x04, 0x03, 0x30, 0xd0, 0x03, 0x00, 0x0c, 0xdc, 0x03, 0x07, 0x0c,
+ 0xd8, 0x03, 0x05, 0x00, 0xda, 0x03, 0x06, 0x0c, 0xd6, 0x03, 0x04, 0x00, 0xd4, 0x03, 0x03, 0x00,
+ 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0xd3, 0x11, 0xed, 0x07, 0x0e, 0x04, 0x0d,
+ 0x01, 0x00, 0x00, 0xdb, 0x04, 0x0e, 0x01, 0x00, 0x00, 0xaa, 0x11, 0xed, 0x09, 0x0e, 0xd3, 0x04,
+ 0x0f, 0x01, 0x00, 0x00, 0xaa, 0xec, 0x03, 0x06, 0x2e, 0x66, 0x00, 0x00, 0x42, 0x10, 0x01, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0xcb, 0xc3, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x04, 0x11,
+ 0x01, 0x00, 0x00, 0xd3, 0x24, 0x03, 0x00, 0xcc, 0x38, 0xfc, 0x00, 0x00, 0x00, 0x42, 0xfe, 0x00,
+ 0x00, 0x00, 0x04, 0x12, 0x01, 0x00, 0x00, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x66, 0x01, 0x00, 0x04,
+ 0x13, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xe1, 0xc3, 0x42, 0x5d, 0x00,
+ 0x00, 0x00, 0x66, 0x03, 0x00, 0x24, 0x01, 0x00, 0xf1, 0x8c, 0x0e, 0xe1, 0xc3, 0x42, 0x5d, 0x00,
+ 0x00, 0x00, 0x66, 0x01, 0x00, 0x04, 0x14, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0xf1, 0x8c, 0x0e,
+ 0x5e, 0x04, 0x00, 0xc3, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x04, 0x15, 0x01, 0x00,
+ 0x00, 0x24, 0x02, 0x00, 0xc3, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x01, 0x00, 0x04, 0x15, 0x01,
+ 0x00, 0x00, 0x24, 0x02, 0x00, 0xf2, 0x8c, 0x0e, 0x5e, 0x04, 0x00, 0x62, 0x01, 0x00, 0xc3, 0x42,
+ 0x5d, 0x00, 0x00, 0x00, 0x66, 0x01, 0x00, 0x04, 0x16, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0xf2,
+ 0x8c, 0x0e, 0x04, 0x17, 0x01, 0x00, 0x00, 0x04, 0x18, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00, 0xcd,
+ 0x61, 0x03, 0x00, 0x62, 0x02, 0x00, 0x7f, 0xee, 0x30, 0xce, 0x5e, 0x04, 0x00, 0xc3, 0x42, 0x5d,
+ 0x00, 0x00, 0x00, 0x66, 0x01, 0x00, 0x04, 0x19, 0x01, 0x00, 0x00, 0x62, 0x03, 0x00, 0x24, 0x03,
+ 0x00, 0xc3, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x66, 0x03, 0x00, 0x04, 0x1a, 0x01, 0x00, 0x00, 0x62,
+ 0x03, 0x00, 0x24, 0x03, 0x00, 0xf2, 0x8c, 0x0e, 0x82, 0x00, 0xec, 0xce, 0x0e, 0x85, 0x5e, 0x05,
+ 0x00, 0xc3, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x04, 0x1b, 0x01, 0x00, 0x00, 0x24,
+ 0x02, 0x00, 0xf1, 0x8c, 0x0e, 0x38, 0xfc, 0x00, 0x00, 0x00, 0x42, 0xfe, 0x00, 0x00, 0x00, 0x04,
+ 0x1c, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x44, 0x12, 0x30, 0x3a,
+ 0x62, 0x08, 0x09, 0x3f, 0x63, 0xb4, 0x53, 0x6d, 0xcb, 0x86, 0x4b, 0x35, 0xe9, 0x22, 0x76, 0x62,
+ 0x0e, 0x62, 0x06, 0x01, 0xce, 0x03, 0x01, 0x04, 0x01, 0x09, 0x05, 0x01, 0x99, 0x01, 0x05, 0x92,
+ 0x04, 0x00, 0x01, 0x00, 0xba, 0x04, 0x00, 0x00, 0x00, 0x98, 0x04, 0x01, 0x00, 0x30, 0x6e, 0x02,
+ 0x04, 0x30, 0x94, 0x04, 0x01, 0x02, 0x30, 0xd2, 0x03, 0x01, 0x0c, 0x8e, 0x02, 0x02, 0x00, 0xda,
+ 0x03, 0x06, 0x0c, 0xd0, 0x03, 0x00, 0x0c, 0xdc, 0x03, 0x07, 0x0c, 0xc2, 0x00, 0xcb, 0x61, 0x03,
+ 0x00, 0x61, 0x01, 0x00, 0x38, 0xfc, 0x00, 0x00, 0x00, 0x42, 0xfe, 0x00, 0x00, 0x00, 0xc3, 0x24,
+ 0x01, 0x00, 0x0e, 0x04, 0x17, 0x01, 0x00, 0x00, 0x04, 0x18, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00,
+ 0xcc, 0x61, 0x02, 0x00, 0x62, 0x01, 0x00, 0x7f, 0xee, 0x1a, 0xcd, 0xc7, 0xc3, 0x42, 0x5d, 0x00,
+ 0x00, 0x00, 0x66, 0x02, 0x00, 0x04, 0x1a, 0x01, 0x00, 0x00, 0x62, 0x02, 0x00, 0x24, 0x03, 0x00,
+ 0xf1, 0x8c, 0x0e, 0x82, 0x00, 0xec, 0xe4, 0x0e, 0x85, 0x66, 0x03, 0x00, 0x42, 0x10, 0x01, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0xce, 0xc7, 0xc3, 0x42, 0x5d, 0x00, 0x00, 0x00, 0x62, 0x03, 0x00, 0x04,
+ 0x1b, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0xf1, 0x8c, 0x0e, 0xc7, 0xc3, 0x42, 0x5d, 0x00, 0x00,
+ 0x00, 0x66, 0x04, 0x00, 0x04, 0x16, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0xf1, 0x8c, 0x0e, 0x38,
+ 0xfc, 0x00, 0x00, 0x00, 0x42, 0xfe, 0x00, 0x00, 0x00, 0x04, 0x1e, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x65, 0x0c, 0x00, 0x09, 0x20, 0x4e, 0x49, 0x35, 0x7b, 0x22,
+ 0x3f, 0x6c, 0x6d, 0x62, 0x0e, 0x62, 0x06, 0x01, 0xba, 0x04, 0x01, 0x01, 0x01, 0x06, 0x02, 0x00,
+ 0x51, 0x02, 0xf2, 0x03, 0x00, 0x01, 0x00, 0xf6, 0x03, 0x03, 0x00, 0x30, 0xd2, 0x03, 0x00, 0x0c,
+ 0x8e, 0x02, 0x01, 0x00, 0x66, 0x00, 0x00, 0x42, 0xfa, 0x00, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00,
+ 0x8c, 0xec, 0x41, 0x61, 0x00, 0x00, 0xe0, 0x04, 0xea, 0x00, 0x00, 0x00, 0x04, 0x1f, 0x01, 0x00,
+ 0x00, 0xd3, 0x26, 0x02, 0x00, 0x0b, 0xf3, 0x8c, 0x0e, 0x38, 0xfc, 0x00, 0x00, 0x00, 0x41, 0xfb,
+ 0x00, 0x00, 0x00, 0xcb, 0x38, 0xfc, 0x00, 0x00, 0x00, 0x42, 0xfe, 0x00, 0x00, 0x00, 0x04, 0x20,
+ 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x42, 0x21, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x24,
+ 0x02, 0x00, 0x0e, 0x06, 0x2e, 0xc6, 0x03, 0x6b, 0x05, 0x03, 0x5d, 0x63, 0x3a, 0x9f,
+};
+
+static uint32_t tjs_module_count = 8;
+static const char* tjs_module_names[] = {
+    "@app/bin/help.js",
+    "@app/bin/test.js",
+    "@app/modules/utils/cmdline.js",
+    "@app/modules/utils/getopts.js",
+    "@app/modules/utils/sax.js",
+    "@app/build/app.js",
+    "@app/build/src/bundle.js",
+    "@app/build/src/link.js",
+    NULL
+};
+
+static const uint8_t* tjs_module_data[] = {
+    tjs_m_bin_help,
+    tjs_m_bin_test,
+    tjs_m_modules_utils_cmdline,
+    tjs_m_modules_utils_getopts,
+    tjs_m_modules_utils_sax,
+    tjs_m_build_app,
+    tjs_m_build_src_bundle,
+    tjs_m_build_src_link,
+    NULL
+};
+
+static const size_t tjs_module_size[] = {
+    1724,
+    1278,
+    8917,
+    3637,
+    21342,
+    1932,
+    3472,
+    1870,
+    0
+};
+
+
+const uint8_t* tjs_get_app_module_data(const char* name, uint32_t* psize)
+{
+    if (name == NULL) {
+        return NULL;
+    }
+
+    int count = tjs_module_count;
+    for (int i = 0; i < count; i++) {
+        const char* module_name = tjs_module_names[i];
+        if (module_name && strcmp(name, module_name) == 0) {
+            *psize = tjs_module_size[i];
+            return tjs_module_data[i];
+        }
+    }
+
+    return NULL;
+}
+
+const char* tjs_get_app_module_name(int index)
+{
+    if (index < 0 || index > tjs_module_count) {
+        return NULL;
+    }
+
+    return tjs_module_names[index];
+}
+
+extern int tjs_module_add_module(const char* name, const uint8_t* data, uint32_t data_len);
+int tjs_app_module_init()
+{
+    int count = tjs_module_count;
+    for (int i = 0; i < count; i++) {
+        const char* module_name = tjs_module_names[i];
+        if (module_name) {
+            tjs_module_add_module(module_name, tjs_module_data[i], tjs_module_size[i]);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+/*
+ * QuickJS libuv bindings
+ *
+ * Copyright (c) 2019-present Saúl Ibarra Corretgé <s@saghul.net>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef TJS_VERSION_H
+#define TJS_VERSION_H
+
+#define TJS_VERSION_MAJOR 24
+#define TJS_VERSION_MINOR 11
+#define TJS_VERSION_PATCH 7
+#define TJS_VERSION_TWEAK 462
+#define TJS_VERSION_SUFFIX "-dev"
+#define TJS_VERSION_STRING "24.11.7.462"
+
+#define QJS_VERSION_STR "2024-01-13"
+#define TJS_PLATFORM "linux"
+#define TJS_ARCH "x86_64"
+#define TJS_BOARD "local"
+#define TJS_ROOT "/usr/local/tjs/"
+#define GIT_VERSION "3d37bf1"
+
+const char* tjs_board(void);
+const char* tjs_build(void);
+const char* tjs_version(void);
+const char* tjs_core_board(void);
+const char* tjs_core_build(void);
+const char* tjs_core_version(void);
+const int tjs_code(void);
+const int tjs_core_code(void);
+
+#endif
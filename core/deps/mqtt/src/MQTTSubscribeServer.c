@@ -49,12 +49,17 @@ int MQTTDeserialize_subscribe(unsigned char* dup, unsigned short* packetid, int
 
 	curdata += (rc = MQTTPacket_decodeBuf(curdata, &mylen)); /* read remaining length */
 	enddata = curdata + mylen;
+	rc = 0; /* the remaining length is not a result */
 
+	if (enddata - curdata < 2) /* do we have enough data to read the packet identifier? */
+		goto exit;
 	*packetid = readInt(&curdata);
 
 	*count = 0;
 	while (curdata < enddata)
 	{
+		if (*count >= maxcount)
+			goto exit;
 		if (!readMQTTLenString(&topicFilters[*count], &curdata, enddata))
 			goto exit;
 		if (curdata >= enddata) /* do we have enough data to read the req_qos version byte? */
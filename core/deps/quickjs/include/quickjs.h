@@ -418,6 +418,51 @@ typedef struct JSMemoryUsage {
 void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s);
 void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt);
 
+/* heap walking */
+typedef enum JSHeapNodeTypeEnum {
+    JS_HEAP_NODE_OBJECT,
+    JS_HEAP_NODE_FUNCTION_BYTECODE,
+    JS_HEAP_NODE_SHAPE,
+    JS_HEAP_NODE_VAR_REF,
+    JS_HEAP_NODE_ASYNC_FUNCTION,
+    JS_HEAP_NODE_CONTEXT,
+} JSHeapNodeTypeEnum;
+
+typedef enum JSHeapEdgeTypeEnum {
+    JS_HEAP_EDGE_PROPERTY, /* 'name' is the property atom */
+    JS_HEAP_EDGE_ELEMENT, /* 'name' is the array index */
+    JS_HEAP_EDGE_INTERNAL, /* 'name' is JS_ATOM_NULL */
+} JSHeapEdgeTypeEnum;
+
+typedef struct JSHeapNodeInfo {
+    const void *id; /* address of the GC object, unique while it is alive */
+    JSHeapNodeTypeEnum type;
+    JSClassID class_id; /* JS_HEAP_NODE_OBJECT only, 0 otherwise */
+    /* class name of the objects, function name of the functions or
+       the name of the constructor for the instances of JS classes.
+       JS_ATOM_NULL if unknown. The atom is not duplicated. */
+    JSAtom name;
+    /* self size in bytes. The strings referenced by the object are
+       accounted for in proportion to their reference count */
+    size_t size;
+    int ref_count;
+} JSHeapNodeInfo;
+
+typedef struct JSHeapVisitor {
+    void (*node)(void *opaque, const JSHeapNodeInfo *node);
+    /* reference from the last visited node to the GC object 'to'. Can
+       be NULL if only the nodes are needed. */
+    void (*edge)(void *opaque, JSHeapEdgeTypeEnum type, uint32_t name, const void *to);
+    void *opaque;
+} JSHeapVisitor;
+
+/* call the visitor for every GC object of the runtime and its
+   references. No JS code is executed and no GC object is allocated or
+   freed during the walk. */
+void JS_VisitHeap(JSRuntime *rt, const JSHeapVisitor *visitor);
+/* return the name of a class or JS_ATOM_NULL. The atom is not duplicated. */
+JSAtom JS_GetClassNameRT(JSRuntime *rt, JSClassID class_id);
+
 /* atom support */
 #define JS_ATOM_NULL 0
 
@@ -710,6 +755,12 @@ static inline const char *JS_ToCString(JSContext *ctx, JSValueConst val1)
     return JS_ToCStringLen2(ctx, NULL, val1, 0);
 }
 void JS_FreeCString(JSContext *ctx, const char *ptr);
+/* direct access to the characters of a string: 8 bit (Latin-1) or 16 bit
+   (UTF-16) depending on '*pis_wide_char'. Return NULL if not a string. */
+const void *JS_GetStringBuffer(JSValueConst val, size_t *plen, JS_BOOL *pis_wide_char);
+/* allocate a string of 'len' characters which must be filled by the caller
+   through '*pbuf' before the string is used */
+JSValue JS_NewStringBuffer(JSContext *ctx, size_t len, JS_BOOL is_wide_char, void **pbuf);
 
 JSValue JS_NewObjectProtoClass(JSContext *ctx, JSValueConst proto, JSClassID class_id);
 JSValue JS_NewObjectClass(JSContext *ctx, int class_id);
@@ -811,6 +862,8 @@ JSValue JS_ParseJSON(JSContext *ctx, const char *buf, size_t buf_len,
 #define JS_PARSE_JSON_EXT (1 << 0) /* allow extended JSON */
 JSValue JS_ParseJSON2(JSContext *ctx, const char *buf, size_t buf_len,
                       const char *filename, int flags);
+/* apply the JSON.parse() 'reviver' to a parsed value. 'obj' is freed. */
+JSValue JS_ReviveJSON(JSContext *ctx, JSValue obj, JSValueConst reviver);
 JSValue JS_JSONStringify(JSContext *ctx, JSValueConst obj,
                          JSValueConst replacer, JSValueConst space0);
 
@@ -821,6 +874,9 @@ JSValue JS_NewArrayBuffer(JSContext *ctx, uint8_t *buf, size_t len,
 JSValue JS_NewArrayBufferCopy(JSContext *ctx, const uint8_t *buf, size_t len);
 void JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj);
 uint8_t *JS_GetArrayBuffer(JSContext *ctx, size_t *psize, JSValueConst obj);
+JS_BOOL JS_IsArrayBuffer(JSValueConst obj);
+JS_BOOL JS_IsTypedArray(JSValueConst obj);
+JS_BOOL JS_IsPrimitiveObject(JSValueConst obj);
 JSValue JS_GetTypedArrayBuffer(JSContext *ctx, JSValueConst obj,
                                size_t *pbyte_offset,
                                size_t *pbyte_length,
@@ -853,8 +909,29 @@ void JS_SetHostPromiseRejectionTracker(JSRuntime *rt, JSHostPromiseRejectionTrac
 /* return != 0 if the JS code needs to be interrupted */
 typedef int JSInterruptHandler(JSRuntime *rt, void *opaque);
 void JS_SetInterruptHandler(JSRuntime *rt, JSInterruptHandler *cb, void *opaque);
+
+/* stack sampling */
+typedef struct JSStackFrameInfo {
+    JSAtom func_name; /* JS_ATOM_NULL if anonymous */
+    JSAtom filename; /* JS_ATOM_NULL for native functions */
+    int line_num; /* line of the function definition, -1 if unknown */
+} JSStackFrameInfo;
+
+/* fill 'frames' with the current call stack, innermost first, and return
+   the number of frames. No JS code is executed, so it can be called from
+   the interrupt handler. The atoms must be freed with JS_FreeAtom(). */
+int JS_GetStackFrames(JSContext *ctx, JSStackFrameInfo *frames, int max_frames);
 /* if can_block is TRUE, Atomics.wait() can be used */
 void JS_SetCanBlock(JSRuntime *rt, JS_BOOL can_block);
+
+/* Atomics.waitAsync() support */
+typedef struct JSAtomicsWaiter JSAtomicsWaiter;
+typedef void JSAtomicsNotifyFunc(void *opaque);
+int JS_AtomicsWaitAsync(JSContext *ctx, JSAtomicsWaiter **pwaiter,
+                        JSValueConst obj, JSValueConst idx,
+                        JSValueConst value,
+                        JSAtomicsNotifyFunc *func, void *opaque);
+JS_BOOL JS_AtomicsFreeWaiter(JSRuntime *rt, JSAtomicsWaiter *waiter);
 /* set the [IsHTMLDDA] internal slot */
 void JS_SetIsHTMLDDA(JSContext *ctx, JSValueConst obj);
 
@@ -275,6 +275,9 @@ struct JSRuntime {
     JSInterruptHandler *interrupt_handler;
     void *interrupt_opaque;
 
+    /* used by JS_VisitHeap() */
+    const JSHeapVisitor *heap_visitor;
+
     JSHostPromiseRejectionTracker *host_promise_rejection_tracker;
     void *host_promise_rejection_tracker_opaque;
     
@@ -3938,6 +3941,35 @@ JSValue JS_NewStringLen(JSContext *ctx, const char *buf, size_t buf_len)
     return JS_EXCEPTION;
 }
 
+const void *JS_GetStringBuffer(JSValueConst val, size_t *plen, BOOL *pis_wide_char)
+{
+    JSString *str;
+    if (JS_VALUE_GET_TAG(val) != JS_TAG_STRING)
+        return NULL;
+    str = JS_VALUE_GET_STRING(val);
+    *plen = str->len;
+    *pis_wide_char = str->is_wide_char;
+    return str->u.str8;
+}
+
+JSValue JS_NewStringBuffer(JSContext *ctx, size_t len, BOOL is_wide_char, void **pbuf)
+{
+    JSString *str;
+    if (len == 0) {
+        *pbuf = NULL;
+        return JS_AtomToString(ctx, JS_ATOM_empty_string);
+    }
+    if (len > JS_STRING_LEN_MAX)
+        return JS_ThrowInternalError(ctx, "string too long");
+    str = js_alloc_string(ctx, len, is_wide_char);
+    if (!str)
+        return JS_EXCEPTION;
+    if (!is_wide_char)
+        str->u.str8[len] = '\0';
+    *pbuf = str->u.str8;
+    return JS_MKPTR(JS_TAG_STRING, str);
+}
+
 static JSValue JS_ConcatString3(JSContext *ctx, const char *str1,
                                 JSValue str2, const char *str3)
 {
@@ -6226,6 +6258,278 @@ void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s)
         s->js_func_size + s->js_func_code_size + s->js_func_pc2line_size;
 }
 
+/* heap walking */
+
+static double js_heap_value_size(JSValueConst val)
+{
+    JSString *str;
+    if (JS_VALUE_GET_TAG(val) != JS_TAG_STRING)
+        return 0;
+    str = JS_VALUE_GET_STRING(val);
+    if (str->atom_type)
+        return 0;
+    return (double)(sizeof(*str) + (str->len << str->is_wide_char) +
+                    1 - str->is_wide_char) / str->header.ref_count;
+}
+
+static size_t js_heap_bytecode_size(JSFunctionBytecode *b)
+{
+    size_t size;
+    size = offsetof(JSFunctionBytecode, debug);
+    size += (b->arg_count + b->var_count) * sizeof(*b->vardefs);
+    size += b->cpool_count * sizeof(*b->cpool);
+    size += b->closure_var_count * sizeof(*b->closure_var);
+    if (!b->read_only_bytecode && b->byte_code_buf)
+        size += b->byte_code_len;
+    if (b->has_debug) {
+        size += sizeof(*b) - offsetof(JSFunctionBytecode, debug);
+        if (b->debug.source)
+            size += b->debug.source_len + 1;
+        size += b->debug.pc2line_len;
+    }
+    return size;
+}
+
+/* name of a function object without calling any getter. The name is
+   only returned if it is already an atom. */
+static JSAtom js_heap_function_name(JSRuntime *rt, JSObject *p)
+{
+    JSProperty *pr;
+    JSShapeProperty *prs;
+    JSString *str;
+    JSAtom atom;
+
+    if (js_class_has_bytecode(p->class_id) &&
+        p->u.func.function_bytecode->func_name != JS_ATOM_NULL)
+        return p->u.func.function_bytecode->func_name;
+    prs = find_own_property(&pr, p, JS_ATOM_name);
+    if (!prs || (prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL ||
+        JS_VALUE_GET_TAG(pr->u.value) != JS_TAG_STRING)
+        return JS_ATOM_NULL;
+    str = JS_VALUE_GET_STRING(pr->u.value);
+    if (str->atom_type == JS_ATOM_TYPE_STRING)
+        return js_get_atom_index(rt, str);
+    if (str->is_wide_char || str->len == 0)
+        return JS_ATOM_NULL;
+    atom = __JS_FindAtom(rt, (const char *)str->u.str8, str->len,
+                         JS_ATOM_TYPE_STRING);
+    /* the atom stays alive because it already existed */
+    JS_FreeAtomRT(rt, atom);
+    return atom;
+}
+
+/* name of the constructor for the instances of JS classes */
+static JSAtom js_heap_object_name(JSRuntime *rt, JSObject *p)
+{
+    JSObject *proto;
+    JSProperty *pr;
+    JSShapeProperty *prs;
+    JSAtom name = JS_ATOM_NULL;
+
+    if (p->class_id == JS_CLASS_OBJECT) {
+        proto = p->shape->proto;
+        if (proto) {
+            prs = find_own_property(&pr, proto, JS_ATOM_constructor);
+            if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL &&
+                JS_VALUE_GET_TAG(pr->u.value) == JS_TAG_OBJECT &&
+                JS_VALUE_GET_OBJ(pr->u.value)->is_constructor)
+                name = js_heap_function_name(rt, JS_VALUE_GET_OBJ(pr->u.value));
+        }
+    } else if (js_class_has_bytecode(p->class_id) ||
+               rt->class_array[p->class_id].call) {
+        name = js_heap_function_name(rt, p);
+    }
+    if (name == JS_ATOM_NULL)
+        name = rt->class_array[p->class_id].class_name;
+    return name;
+}
+
+static void js_heap_visit_mark(JSRuntime *rt, JSGCObjectHeader *gp)
+{
+    const JSHeapVisitor *visitor = rt->heap_visitor;
+    visitor->edge(visitor->opaque, JS_HEAP_EDGE_INTERNAL, JS_ATOM_NULL, gp);
+}
+
+static void js_heap_visit_object(JSRuntime *rt, JSObject *p,
+                                 const JSHeapVisitor *visitor)
+{
+    JSShape *sh = p->shape;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSClassGCMark *gc_mark;
+    void *opaque = visitor->opaque;
+    int i, flags;
+
+    visitor->edge(opaque, JS_HEAP_EDGE_INTERNAL, JS_ATOM_NULL, &sh->header);
+    prs = get_shape_prop(sh);
+    for(i = 0; i < sh->prop_count; i++, prs++) {
+        pr = &p->prop[i];
+        if (prs->atom == JS_ATOM_NULL)
+            continue;
+        flags = prs->flags & JS_PROP_TMASK;
+        if (flags == JS_PROP_GETSET) {
+            if (pr->u.getset.getter)
+                visitor->edge(opaque, JS_HEAP_EDGE_PROPERTY, prs->atom,
+                              &pr->u.getset.getter->header);
+            if (pr->u.getset.setter)
+                visitor->edge(opaque, JS_HEAP_EDGE_PROPERTY, prs->atom,
+                              &pr->u.getset.setter->header);
+        } else if (flags == JS_PROP_VARREF) {
+            visitor->edge(opaque, JS_HEAP_EDGE_PROPERTY, prs->atom,
+                          &pr->u.var_ref->header);
+        } else if (flags == JS_PROP_AUTOINIT) {
+            js_autoinit_mark(rt, pr, js_heap_visit_mark);
+        } else if (JS_VALUE_GET_TAG(pr->u.value) == JS_TAG_OBJECT) {
+            visitor->edge(opaque, JS_HEAP_EDGE_PROPERTY, prs->atom,
+                          JS_VALUE_GET_PTR(pr->u.value));
+        }
+    }
+
+    if (p->class_id == JS_CLASS_ARRAY || p->class_id == JS_CLASS_ARGUMENTS) {
+        /* same references as js_array_mark() */
+        for(i = 0; i < p->u.array.count; i++) {
+            JSValueConst val = p->u.array.u.values[i];
+            if (JS_VALUE_GET_TAG(val) == JS_TAG_OBJECT)
+                visitor->edge(opaque, JS_HEAP_EDGE_ELEMENT, i,
+                              JS_VALUE_GET_PTR(val));
+        }
+    } else if (p->class_id != JS_CLASS_OBJECT) {
+        gc_mark = rt->class_array[p->class_id].gc_mark;
+        if (gc_mark)
+            gc_mark(rt, JS_MKPTR(JS_TAG_OBJECT, p), js_heap_visit_mark);
+    }
+}
+
+static void js_heap_node_info(JSRuntime *rt, JSGCObjectHeader *gp,
+                              JSHeapNodeInfo *info)
+{
+    double size = 0;
+    int i;
+
+    memset(info, 0, sizeof(*info));
+    info->id = gp;
+    info->ref_count = gp->ref_count;
+    switch(gp->gc_obj_type) {
+    case JS_GC_OBJ_TYPE_JS_OBJECT:
+        {
+            JSObject *p = (JSObject *)gp;
+            JSShape *sh = p->shape;
+            JSShapeProperty *prs;
+
+            info->type = JS_HEAP_NODE_OBJECT;
+            info->class_id = p->class_id;
+            info->name = js_heap_object_name(rt, p);
+            size = sizeof(*p);
+            if (p->prop) {
+                size += sh->prop_size * sizeof(*p->prop);
+                prs = get_shape_prop(sh);
+                for(i = 0; i < sh->prop_count; i++, prs++) {
+                    if (prs->atom != JS_ATOM_NULL && !(prs->flags & JS_PROP_TMASK))
+                        size += js_heap_value_size(p->prop[i].u.value);
+                }
+            }
+            switch(p->class_id) {
+            case JS_CLASS_ARRAY:
+            case JS_CLASS_ARGUMENTS:
+                if (p->fast_array) {
+                    size += p->u.array.count * sizeof(*p->u.array.u.values);
+                    for(i = 0; i < p->u.array.count; i++)
+                        size += js_heap_value_size(p->u.array.u.values[i]);
+                }
+                break;
+            case JS_CLASS_ARRAY_BUFFER:
+            case JS_CLASS_SHARED_ARRAY_BUFFER:
+                if (p->u.array_buffer)
+                    size += sizeof(*p->u.array_buffer) + p->u.array_buffer->byte_length;
+                break;
+            case JS_CLASS_BYTECODE_FUNCTION:
+                if (p->u.func.var_refs)
+                    size += p->u.func.function_bytecode->closure_var_count *
+                        sizeof(*p->u.func.var_refs);
+                break;
+            case JS_CLASS_BOUND_FUNCTION:
+                size += sizeof(*p->u.bound_function) +
+                    p->u.bound_function->argc * sizeof(*p->u.bound_function->argv);
+                break;
+            case JS_CLASS_NUMBER:
+            case JS_CLASS_STRING:
+            case JS_CLASS_BOOLEAN:
+            case JS_CLASS_SYMBOL:
+            case JS_CLASS_DATE:
+            case JS_CLASS_BIG_INT:
+                size += js_heap_value_size(p->u.object_data);
+                break;
+            default:
+                break;
+            }
+        }
+        break;
+    case JS_GC_OBJ_TYPE_FUNCTION_BYTECODE:
+        {
+            JSFunctionBytecode *b = (JSFunctionBytecode *)gp;
+            info->type = JS_HEAP_NODE_FUNCTION_BYTECODE;
+            info->name = b->func_name;
+            size = js_heap_bytecode_size(b);
+        }
+        break;
+    case JS_GC_OBJ_TYPE_SHAPE:
+        {
+            JSShape *sh = (JSShape *)gp;
+            info->type = JS_HEAP_NODE_SHAPE;
+            size = get_shape_size(sh->prop_hash_mask + 1, sh->prop_size);
+        }
+        break;
+    case JS_GC_OBJ_TYPE_VAR_REF:
+        {
+            JSVarRef *var_ref = (JSVarRef *)gp;
+            info->type = JS_HEAP_NODE_VAR_REF;
+            size = sizeof(*var_ref);
+            if (var_ref->is_detached)
+                size += js_heap_value_size(var_ref->value);
+        }
+        break;
+    case JS_GC_OBJ_TYPE_ASYNC_FUNCTION:
+        info->type = JS_HEAP_NODE_ASYNC_FUNCTION;
+        size = sizeof(JSAsyncFunctionState);
+        break;
+    case JS_GC_OBJ_TYPE_JS_CONTEXT:
+        info->type = JS_HEAP_NODE_CONTEXT;
+        size = sizeof(JSContext) + sizeof(JSValue) * rt->class_count;
+        break;
+    default:
+        abort();
+    }
+    info->size = (size_t)size;
+}
+
+void JS_VisitHeap(JSRuntime *rt, const JSHeapVisitor *visitor)
+{
+    struct list_head *el;
+    JSGCObjectHeader *gp;
+    JSHeapNodeInfo info;
+
+    rt->heap_visitor = visitor;
+    list_for_each(el, &rt->gc_obj_list) {
+        gp = list_entry(el, JSGCObjectHeader, link);
+        js_heap_node_info(rt, gp, &info);
+        visitor->node(visitor->opaque, &info);
+        if (!visitor->edge)
+            continue;
+        if (gp->gc_obj_type == JS_GC_OBJ_TYPE_JS_OBJECT)
+            js_heap_visit_object(rt, (JSObject *)gp, visitor);
+        else
+            mark_children(rt, gp, js_heap_visit_mark);
+    }
+    rt->heap_visitor = NULL;
+}
+
+JSAtom JS_GetClassNameRT(JSRuntime *rt, JSClassID class_id)
+{
+    if (class_id >= rt->class_count)
+        return JS_ATOM_NULL;
+    return rt->class_array[class_id].class_name;
+}
+
 void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt)
 {
     fprintf(fp, "QuickJS memory usage -- "
@@ -6585,6 +6889,44 @@ static void build_backtrace(JSContext *ctx, JSValueConst error_obj,
                            JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
 }
 
+int JS_GetStackFrames(JSContext *ctx, JSStackFrameInfo *frames, int max_frames)
+{
+    JSStackFrame *sf;
+    JSStackFrameInfo *fi;
+    JSObject *p;
+    JSProperty *pr;
+    JSShapeProperty *prs;
+    int n = 0;
+
+    for(sf = ctx->rt->current_stack_frame; sf != NULL && n < max_frames;
+        sf = sf->prev_frame) {
+        if (JS_VALUE_GET_TAG(sf->cur_func) != JS_TAG_OBJECT)
+            continue;
+        p = JS_VALUE_GET_OBJ(sf->cur_func);
+        fi = &frames[n++];
+        fi->func_name = JS_ATOM_NULL;
+        fi->filename = JS_ATOM_NULL;
+        fi->line_num = -1;
+        if (js_class_has_bytecode(p->class_id)) {
+            JSFunctionBytecode *b = p->u.func.function_bytecode;
+            fi->func_name = JS_DupAtom(ctx, b->func_name);
+            if (b->has_debug) {
+                fi->filename = JS_DupAtom(ctx, b->debug.filename);
+                fi->line_num = b->debug.line_num;
+            }
+        } else {
+            /* same rule as get_func_name() */
+            prs = find_own_property(&pr, p, JS_ATOM_name);
+            if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL &&
+                JS_VALUE_GET_TAG(pr->u.value) == JS_TAG_STRING) {
+                JSValue name = JS_DupValue(ctx, pr->u.value);
+                fi->func_name = JS_NewAtomStr(ctx, JS_VALUE_GET_STRING(name));
+            }
+        }
+    }
+    return n;
+}
+
 /* Note: it is important that no exception is returned by this function */
 static BOOL is_backtrace_needed(JSContext *ctx, JSValueConst obj)
 {
@@ -45051,11 +45393,33 @@ static JSValue internalize_json_property(JSContext *ctx, JSValueConst holder,
     return JS_EXCEPTION;
 }
 
+/* apply the JSON.parse() 'reviver' to a parsed value. 'obj' is freed. */
+JSValue JS_ReviveJSON(JSContext *ctx, JSValue obj, JSValueConst reviver)
+{
+    JSValue root;
+
+    if (JS_IsException(obj) || !JS_IsFunction(ctx, reviver))
+        return obj;
+    root = JS_NewObject(ctx);
+    if (JS_IsException(root)) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    if (JS_DefinePropertyValue(ctx, root, JS_ATOM_empty_string, obj,
+                               JS_PROP_C_W_E) < 0) {
+        JS_FreeValue(ctx, root);
+        return JS_EXCEPTION;
+    }
+    obj = internalize_json_property(ctx, root, JS_ATOM_empty_string,
+                                    reviver);
+    JS_FreeValue(ctx, root);
+    return obj;
+}
+
 static JSValue js_json_parse(JSContext *ctx, JSValueConst this_val,
                              int argc, JSValueConst *argv)
 {
-    JSValue obj, root;
-    JSValueConst reviver;
+    JSValue obj;
     const char *str;
     size_t len;
 
@@ -45064,24 +45428,8 @@ static JSValue js_json_parse(JSContext *ctx, JSValueConst this_val,
         return JS_EXCEPTION;
     obj = JS_ParseJSON(ctx, str, len, "<input>");
     JS_FreeCString(ctx, str);
-    if (JS_IsException(obj))
-        return obj;
-    if (argc > 1 && JS_IsFunction(ctx, argv[1])) {
-        reviver = argv[1];
-        root = JS_NewObject(ctx);
-        if (JS_IsException(root)) {
-            JS_FreeValue(ctx, obj);
-            return JS_EXCEPTION;
-        }
-        if (JS_DefinePropertyValue(ctx, root, JS_ATOM_empty_string, obj,
-                                   JS_PROP_C_W_E) < 0) {
-            JS_FreeValue(ctx, root);
-            return JS_EXCEPTION;
-        }
-        obj = internalize_json_property(ctx, root, JS_ATOM_empty_string,
-                                        reviver);
-        JS_FreeValue(ctx, root);
-    }
+    if (argc > 1)
+        obj = JS_ReviveJSON(ctx, obj, argv[1]);
     return obj;
 }
 
@@ -52805,6 +53153,48 @@ uint8_t *JS_GetArrayBuffer(JSContext *ctx, size_t *psize, JSValueConst obj)
     return NULL;
 }
 
+/* return TRUE if 'obj' is an ArrayBuffer or a SharedArrayBuffer (never
+   throws) */
+JS_BOOL JS_IsArrayBuffer(JSValueConst obj)
+{
+    JSObject *p;
+    if (JS_VALUE_GET_TAG(obj) != JS_TAG_OBJECT)
+        return FALSE;
+    p = JS_VALUE_GET_OBJ(obj);
+    return p->class_id == JS_CLASS_ARRAY_BUFFER ||
+        p->class_id == JS_CLASS_SHARED_ARRAY_BUFFER;
+}
+
+/* return TRUE if 'obj' is a typed array (never throws) */
+JS_BOOL JS_IsTypedArray(JSValueConst obj)
+{
+    JSObject *p;
+    if (JS_VALUE_GET_TAG(obj) != JS_TAG_OBJECT)
+        return FALSE;
+    p = JS_VALUE_GET_OBJ(obj);
+    return p->class_id >= JS_CLASS_UINT8C_ARRAY &&
+        p->class_id <= JS_CLASS_FLOAT64_ARRAY;
+}
+
+/* return TRUE if 'obj' is a Number, String, Boolean or BigInt object
+   (never throws) */
+JS_BOOL JS_IsPrimitiveObject(JSValueConst obj)
+{
+    JSObject *p;
+    if (JS_VALUE_GET_TAG(obj) != JS_TAG_OBJECT)
+        return FALSE;
+    p = JS_VALUE_GET_OBJ(obj);
+    switch(p->class_id) {
+    case JS_CLASS_NUMBER:
+    case JS_CLASS_STRING:
+    case JS_CLASS_BOOLEAN:
+    case JS_CLASS_BIG_INT:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
 static JSValue js_array_buffer_slice(JSContext *ctx,
                                      JSValueConst this_val,
                                      int argc, JSValueConst *argv, int class_id)
@@ -55291,12 +55681,15 @@ static JSValue js_atomics_isLockFree(JSContext *ctx,
     return JS_NewBool(ctx, ret);
 }
 
-typedef struct JSAtomicsWaiter {
+struct JSAtomicsWaiter {
     struct list_head link;
     BOOL linked;
     pthread_cond_t cond;
     int32_t *ptr;
-} JSAtomicsWaiter;
+    /* used by JS_AtomicsWaitAsync() instead of 'cond' */
+    JSAtomicsNotifyFunc *notify_func;
+    void *notify_opaque;
+};
 
 static pthread_mutex_t js_atomics_mutex = PTHREAD_MUTEX_INITIALIZER;
 static struct list_head js_atomics_waiter_list =
@@ -55354,6 +55747,7 @@ static JSValue js_atomics_wait(JSContext *ctx,
 
     waiter = &waiter_s;
     waiter->ptr = ptr;
+    waiter->notify_func = NULL;
     pthread_cond_init(&waiter->cond, NULL);
     waiter->linked = TRUE;
     list_add_tail(&waiter->link, &js_atomics_waiter_list);
@@ -55422,15 +55816,91 @@ static JSValue js_atomics_notify(JSContext *ctx,
                     break;
             }
         }
-        list_for_each(el, &waiter_list) {
+        list_for_each_safe(el, el1, &waiter_list) {
             waiter = list_entry(el, JSAtomicsWaiter, link);
-            pthread_cond_signal(&waiter->cond);
+            if (waiter->notify_func) {
+                /* the async waiter may be freed as soon as the mutex is
+                   released */
+                list_del(&waiter->link);
+                waiter->notify_func(waiter->notify_opaque);
+            } else {
+                pthread_cond_signal(&waiter->cond);
+            }
         }
         pthread_mutex_unlock(&js_atomics_mutex);
     }
     return JS_NewInt32(ctx, n);
 }
 
+/* Non blocking version of Atomics.wait(). Return -1 if exception, 0 if
+   the value is not equal or 1 if '*pwaiter' was added to the wait
+   list. 'func' is called from the thread calling Atomics.notify() while
+   holding the atomics mutex. The waiter must be released with
+   JS_AtomicsFreeWaiter(). */
+int JS_AtomicsWaitAsync(JSContext *ctx, JSAtomicsWaiter **pwaiter,
+                        JSValueConst obj, JSValueConst idx,
+                        JSValueConst value,
+                        JSAtomicsNotifyFunc *func, void *opaque)
+{
+    int64_t v;
+    int32_t v32;
+    void *ptr;
+    JSAtomicsWaiter *waiter;
+    int size_log2, res;
+
+    *pwaiter = NULL;
+    ptr = js_atomics_get_ptr(ctx, NULL, &size_log2, NULL, obj, idx, 2);
+    if (!ptr)
+        return -1;
+    if (size_log2 == 3) {
+        if (JS_ToBigInt64(ctx, &v, value))
+            return -1;
+    } else {
+        if (JS_ToInt32(ctx, &v32, value))
+            return -1;
+        v = v32;
+    }
+
+    waiter = js_malloc(ctx, sizeof(*waiter));
+    if (!waiter)
+        return -1;
+    waiter->ptr = ptr;
+    waiter->notify_func = func;
+    waiter->notify_opaque = opaque;
+
+    pthread_mutex_lock(&js_atomics_mutex);
+    if (size_log2 == 3) {
+        res = *(int64_t *)ptr != v;
+    } else {
+        res = *(int32_t *)ptr != v;
+    }
+    if (res) {
+        pthread_mutex_unlock(&js_atomics_mutex);
+        js_free(ctx, waiter);
+        return 0;
+    }
+    waiter->linked = TRUE;
+    list_add_tail(&waiter->link, &js_atomics_waiter_list);
+    pthread_mutex_unlock(&js_atomics_mutex);
+    *pwaiter = waiter;
+    return 1;
+}
+
+/* Remove the waiter from the wait list and free it. Return TRUE if it
+   was woken up by Atomics.notify(). */
+JS_BOOL JS_AtomicsFreeWaiter(JSRuntime *rt, JSAtomicsWaiter *waiter)
+{
+    BOOL notified;
+
+    pthread_mutex_lock(&js_atomics_mutex);
+    notified = !waiter->linked;
+    if (waiter->linked)
+        list_del(&waiter->link);
+    pthread_mutex_unlock(&js_atomics_mutex);
+    js_free_rt(rt, waiter);
+    return notified;
+}
+
 static const JSCFunctionListEntry js_atomics_funcs[] = {
     JS_CFUNC_MAGIC_DEF("add", 3, js_atomics_op, ATOMICS_OP_ADD ),
     JS_CFUNC_MAGIC_DEF("and", 3, js_atomics_op, ATOMICS_OP_AND ),
@@ -30,6 +30,12 @@ int dbuffer_putc(dbuffer_t* s, uint8_t c);
 int dbuffer_putstr(dbuffer_t* s, const char* str);
 void dbuffer_free(dbuffer_t* s);
 
+/** 转移缓存区的所有权并重新初始化 s, 返回的内存不再计入 dbuffer_get_usage() */
+uint8_t* dbuffer_detach(dbuffer_t* s, size_t* size);
+
+/** 返回当前所有缓存区的数量和已分配的字节数 */
+void dbuffer_get_usage(int64_t* count, int64_t* size);
+
 static inline int dbuffer_put_u16(dbuffer_t* s, uint16_t val)
 {
     return dbuffer_put(s, (uint8_t*)&val, 2);
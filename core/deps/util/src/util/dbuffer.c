@@ -9,6 +9,16 @@
 
 /* Dynamic buffer package */
 
+/* 所有缓存区的数量和已分配的字节数, 可能在多个线程中使用 */
+static int64_t dbuffer_total_count = 0;
+static int64_t dbuffer_total_size = 0;
+
+void dbuffer_get_usage(int64_t *count, int64_t *size)
+{
+    *count = __atomic_load_n(&dbuffer_total_count, __ATOMIC_RELAXED);
+    *size = __atomic_load_n(&dbuffer_total_size, __ATOMIC_RELAXED);
+}
+
 static void *dbuffer_default_realloc(void *opaque, void *ptr, size_t size)
 {
     return realloc(ptr, size);
@@ -47,6 +57,9 @@ int dbuffer_realloc(dbuffer_t *s, size_t new_size)
             s->error = TRUE;
             return -1;
         }
+        if (!s->buf)
+            __atomic_add_fetch(&dbuffer_total_count, 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&dbuffer_total_size, (int64_t)(new_size - s->allocated_size), __ATOMIC_RELAXED);
         s->buf = new_buf;
         s->allocated_size = new_size;
     }
@@ -97,12 +110,28 @@ int dbuffer_putstr(dbuffer_t *s, const char *str)
     return dbuffer_put(s, (const uint8_t *)str, strlen(str));
 }
 
+/* 转移缓存区的所有权, 返回的内存由调用者使用 realloc_func 对应的方法释放 */
+uint8_t *dbuffer_detach(dbuffer_t *s, size_t *size)
+{
+    uint8_t *buf = s->buf;
+    if (size)
+        *size = s->size;
+    if (buf) {
+        __atomic_sub_fetch(&dbuffer_total_count, 1, __ATOMIC_RELAXED);
+        __atomic_sub_fetch(&dbuffer_total_size, (int64_t)s->allocated_size, __ATOMIC_RELAXED);
+    }
+    dbuffer_init2(s, s->opaque, s->realloc_func);
+    return buf;
+}
+
 void dbuffer_free(dbuffer_t *s)
 {
     /* we test s->buf as a fail safe to avoid crashing if dbuffer_free()
        is called twice */
     if (s->buf) {
         s->realloc_func(s->opaque, s->buf, 0);
+        __atomic_sub_fetch(&dbuffer_total_count, 1, __ATOMIC_RELAXED);
+        __atomic_sub_fetch(&dbuffer_total_size, (int64_t)s->allocated_size, __ATOMIC_RELAXED);
     }
     memset(s, 0, sizeof(*s));
 }
@@ -279,9 +279,12 @@ class Worker extends EventTarget {
         return 'Worker';
     }
 
-    /** @param {any[]} args */
-    postMessage(...args) {
-        this[kWorker].postMessage(args);
+    /**
+     * 发送消息, SharedArrayBuffer 只传递引用, 不会复制数据
+     * @param {any} message
+     */
+    postMessage(message) {
+        this[kWorker].postMessage(message);
     }
 
     terminate() {
@@ -303,6 +306,28 @@ Object.defineProperty(window, 'Worker', {
     value: Worker
 });
 
+// Atomics.waitAsync
+
+/**
+ * 不阻塞当前线程的 Atomics.wait, 主线程中也可以使用
+ * @param {Int32Array | BigInt64Array} typedArray 使用 SharedArrayBuffer 的数组
+ * @param {number} index
+ * @param {number | bigint} value
+ * @param {number} [timeout] 超时时间 (毫秒), 默认一直等待
+ * @returns {{ async: boolean, value: string | Promise<string> }}
+ */
+function waitAsync(typedArray, index, value, timeout) {
+    const result = native.waitAsync(typedArray, index, value, timeout);
+    return { async: typeof result !== 'string', value: result };
+}
+
+Object.defineProperty(Atomics, 'waitAsync', {
+    enumerable: false,
+    configurable: true,
+    writable: true,
+    value: waitAsync
+});
+
 // Navigator
 Object.defineProperty(window, 'navigator', {
     enumerable: true,
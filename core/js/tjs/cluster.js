@@ -0,0 +1,349 @@
+// @ts-check
+/// <reference path ="../../types/index.d.ts" />
+import * as native from '@tjs/native';
+import * as util from '@tjs/util';
+
+import { defineEventAttribute } from '@tjs/event-target';
+
+/** 传递给工作进程的环境变量, 值为工作进程 ID */
+const WORKER_ID_ENV = 'TJS_CLUSTER_WORKER';
+
+/** 工作进程中 IPC 管道的文件描述符 */
+const IPC_FD = 3;
+
+const workerIdValue = native.getenv(WORKER_ID_ENV);
+
+/** 当前是否是工作进程 */
+export const isWorker = !!workerIdValue;
+
+/** 当前是否是主进程 */
+export const isPrimary = !isWorker;
+
+/** 当前工作进程的 ID, 主进程为 0 */
+export const workerId = Number(workerIdValue) || 0;
+
+/**
+ * 共享侦听端口的方式
+ * - `reuseport`: 每个工作进程用 SO_REUSEPORT 绑定同一个端口, 由内核分配连接
+ * - `shared`: 由主进程绑定端口, 然后通过 IPC 管道把句柄传递给所有工作进程
+ */
+export const SCHED_REUSEPORT = 'reuseport';
+export const SCHED_SHARED = 'shared';
+
+/** @type {{ schedulingPolicy: string }} */
+export const settings = { schedulingPolicy: SCHED_REUSEPORT };
+
+/** @type {Map<number, Worker>} 主进程创建的所有工作进程 */
+export const workers = new Map();
+
+let nextWorkerId = 1;
+
+/**
+ * 在 IPC 管道上收发消息和句柄
+ * - 消息格式和 `os.execFile()` 的 `send()` 相同 (util.encodeMessage)
+ */
+class Channel extends EventTarget {
+    /** @param {native.Pipe} pipe */
+    constructor(pipe) {
+        super();
+
+        this.pipe = pipe;
+
+        const parser = new util.MessageParser();
+        parser.onmessage = (event) => {
+            const message = event.data?.data;
+
+            /** @type {native.TCP=} */
+            let handle;
+            if (message?.handle && pipe.pendingCount() > 0) {
+                handle = /** @type {native.TCP} */ (pipe.accept());
+            }
+
+            const messageEvent = new MessageEvent('message', { data: message });
+            // @ts-ignore
+            messageEvent.handle = handle;
+            this.dispatchEvent(messageEvent);
+        };
+
+        pipe.onmessage = (data) => {
+            if (data == null) {
+                this.close();
+                return;
+            }
+
+            parser.execute(data);
+        };
+    }
+
+    close() {
+        const pipe = this.pipe;
+        if (pipe) {
+            // @ts-ignore
+            this.pipe = undefined;
+            pipe.onmessage = undefined;
+            pipe.close();
+
+            this.dispatchEvent(new Event('close'));
+        }
+    }
+
+    /**
+     * @param {any} message
+     * @param {native.TCP=} handle 要传递的句柄
+     */
+    async send(message, handle) {
+        const pipe = this.pipe;
+        if (!pipe) {
+            return false;
+        }
+
+        if (handle) {
+            message = Object.assign({}, message, { handle: true });
+        }
+
+        const data = util.encodeMessage(message);
+        if (data == null) {
+            return false;
+        }
+
+        if (handle) {
+            await pipe.write2(data, handle);
+
+        } else {
+            await pipe.write(data);
+        }
+
+        return true;
+    }
+}
+
+defineEventAttribute(Channel.prototype, 'close');
+defineEventAttribute(Channel.prototype, 'message');
+
+/**
+ * 代表一个工作进程 (在主进程中)
+ */
+export class Worker extends EventTarget {
+    /**
+     * @param {number} id
+     * @param {native.ChildProcess} subprocess
+     */
+    constructor(id, subprocess) {
+        super();
+
+        /** @type number 工作进程 ID */
+        this.id = id;
+
+        /** @type native.ChildProcess */
+        this.process = subprocess;
+
+        /** @type {Channel=} */
+        this.channel = undefined;
+
+        const ipc = subprocess.ipc;
+        if (ipc) {
+            this.channel = new Channel(ipc);
+            this.channel.onmessage = (event) => {
+                this.onChannelMessage(event);
+            };
+        }
+
+        /** @type {Promise<native.ProcessResult>} */
+        this.exited = subprocess.wait().then((result) => {
+            workers.delete(this.id);
+            this.channel?.close();
+            this.dispatchEvent(new CustomEvent('exit', { detail: result }));
+            return result;
+        });
+    }
+
+    get [Symbol.toStringTag]() {
+        return 'Worker';
+    }
+
+    get pid() {
+        return this.process.pid;
+    }
+
+    /** @param {number} [signal] */
+    kill(signal) {
+        this.process.kill(signal || native.signals.SIGTERM);
+    }
+
+    /**
+     * @param {*} message
+     */
+    async onChannelMessage(message) {
+        const data = message.data;
+        if (data?.type == 'listen') {
+            // 工作进程不能用 SO_REUSEPORT 时, 由主进程绑定端口后把句柄传过去
+            try {
+                const handle = getSharedHandle(data.address);
+                await this.channel?.send({ type: 'listening', address: data.address }, handle);
+
+            } catch (error) {
+                await this.channel?.send({ type: 'listening', address: data.address, error: error.message });
+            }
+
+            return;
+        }
+
+        this.dispatchEvent(new MessageEvent('message', { data }));
+    }
+
+    /**
+     * 发送消息给工作进程
+     * @param {*} message
+     */
+    send(message) {
+        return this.channel?.send(message);
+    }
+}
+
+defineEventAttribute(Worker.prototype, 'exit');
+defineEventAttribute(Worker.prototype, 'message');
+
+/** @type {Map<string, native.TCP>} 主进程中共享的侦听句柄 */
+const sharedHandles = new Map();
+
+/**
+ * @param {native.SocketAddress} address
+ * @returns {native.TCP}
+ */
+function getSharedHandle(address) {
+    const key = `${address.address || '0.0.0.0'}:${address.port}`;
+    let handle = sharedHandles.get(key);
+    if (!handle) {
+        handle = new native.TCP();
+        handle.bind(normalizeAddress(address));
+        sharedHandles.set(key, handle);
+    }
+
+    return handle;
+}
+
+/**
+ * @param {native.SocketAddress} address
+ * @returns {native.SocketAddress}
+ */
+function normalizeAddress(address) {
+    return { address: address.address || '0.0.0.0', port: address.port, family: address.family || 4 };
+}
+
+/**
+ * 创建一个工作进程, 它会以相同的参数运行当前的脚本
+ * @param {{ args?: string[], env?: { [key: string]: string } }} [options]
+ * @returns {Worker}
+ */
+export function fork(options) {
+    if (!isPrimary) {
+        throw new Error('fork() can only be called in the primary process');
+    }
+
+    const id = nextWorkerId++;
+    const env = Object.assign({}, native.environ(), options?.env);
+    env[WORKER_ID_ENV] = String(id);
+
+    const args = options?.args || process.argv.slice(1);
+    const subprocess = native.spawn([native.exepath(), ...args], { env, ipc: true });
+
+    const worker = new Worker(id, subprocess);
+    workers.set(id, worker);
+    return worker;
+}
+
+/** @type {Channel=} 工作进程到主进程的 IPC 通道 */
+let primaryChannel;
+
+function getPrimaryChannel() {
+    if (!primaryChannel && isWorker) {
+        const pipe = new native.Pipe(true);
+        pipe.open(IPC_FD);
+        primaryChannel = new Channel(pipe);
+    }
+
+    return primaryChannel;
+}
+
+/**
+ * 从主进程获取一个共享的侦听句柄
+ * @param {native.SocketAddress} address
+ * @returns {Promise<native.TCP>}
+ */
+function requestSharedHandle(address) {
+    const channel = getPrimaryChannel();
+    if (!channel) {
+        return Promise.reject(new Error('No IPC channel to the primary process'));
+    }
+
+    return new Promise((resolve, reject) => {
+        /** @param {*} event */
+        const onMessage = (event) => {
+            const data = event.data;
+            if (data?.type != 'listening' || data.address?.port != address.port) {
+                return;
+            }
+
+            channel.removeEventListener('message', onMessage);
+            if (event.handle) {
+                resolve(event.handle);
+
+            } else {
+                reject(new Error(data.error || 'Failed to get the listening handle'));
+            }
+        };
+
+        channel.addEventListener('message', onMessage);
+        channel.send({ type: 'listen', address }).catch(reject);
+    });
+}
+
+/**
+ * 绑定一个可以在多个工作进程之间共享的 TCP 端口
+ * - 返回的句柄已绑定但还未开始侦听, 可以通过 `handle` 选项传给 `net.Server`
+ *   或 `http.createServer()`
+ * - 优先使用 SO_REUSEPORT, 不支持时通过 IPC 管道从主进程获取共享的句柄
+ * @param {native.SocketAddress} address
+ * @returns {Promise<native.TCP>}
+ */
+export async function bind(address) {
+    address = normalizeAddress(address);
+    if (isPrimary) {
+        return getSharedHandle(address);
+    }
+
+    if (settings.schedulingPolicy == SCHED_REUSEPORT) {
+        const handle = new native.TCP();
+        try {
+            handle.bind(address, native.TCP.REUSEPORT);
+            return handle;
+
+        } catch (error) {
+            handle.close();
+            if (error.errno != native.errors.UV_ENOTSUP) {
+                throw error;
+            }
+        }
+    }
+
+    return requestSharedHandle(address);
+}
+
+/**
+ * 发送消息给主进程 (在工作进程中)
+ * @param {*} message
+ */
+export function send(message) {
+    return getPrimaryChannel()?.send(message);
+}
+
+/**
+ * 接收主进程发来的消息 (在工作进程中)
+ * @param {(message: any) => void} listener
+ */
+export function onmessage(listener) {
+    getPrimaryChannel()?.addEventListener('message', (event) => {
+        // @ts-ignore
+        listener(event.data);
+    });
+}
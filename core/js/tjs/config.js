@@ -1,7 +1,7 @@
 // @ts-check
 /// <reference path ="../../types/index.d.ts" />
 import * as fs from '@tjs/fs';
-import { join, basename } from '@tjs/path';
+import { join, basename, dirname } from '@tjs/path';
 
 const options = {
     root: navigator.root || '/system/wotjs/'
@@ -170,7 +170,10 @@ export class Config {
             name,
 
             /** @type number */
-            updateCount: 0
+            updateCount: 0,
+
+            /** @type fs.FSWatcher|undefined */
+            watcher: undefined
         };
     }
 
@@ -958,6 +961,44 @@ export class Config {
     toObject() {
         return parseFlatMap(this.data);
     }
+
+    /**
+     * 停止监视配置文件
+     */
+    unwatch() {
+        const $properties = this.$properties;
+        $properties.watcher?.close();
+        $properties.watcher = undefined;
+    }
+
+    /**
+     * 监视配置文件, 文件被修改后重新加载
+     * - 监视的是所在的目录, 所以通过重命名替换的配置文件也能被发现
+     * @param {(config: Config) => void} [onchange] 重新加载后调用
+     */
+    watch(onchange) {
+        this.unwatch();
+
+        const filename = this.filename;
+        const watcher = fs.watch(dirname(filename), async (events) => {
+            const changed = events.some((event) => event.path == filename || event.type == 'overflow');
+            if (!changed) {
+                return;
+            }
+
+            // 忽略内容没有变化的事件 (比如只修改了访问时间)
+            const filestat = await this.statFile(filename);
+            const lastStat = this.$properties.filestat;
+            if (filestat && lastStat && filestat.mtime == lastStat.mtime && filestat.size == lastStat.size) {
+                return;
+            }
+
+            await this.load();
+            onchange?.(this);
+        });
+
+        this.$properties.watcher = watcher;
+    }
 }
 
 /**
@@ -1185,31 +1185,39 @@ export const $logFormatter = {
     },
 
     /**
-     * 打印日志信息
+     * 返回打印到控制台的日志文本
      * @param {string} level 日志级别: d, l, i, w, a, e
      * @param {string} lineNumber 行号信息
-     * @param {any[]} args 
+     * @param {string} message 已格式化的日志内容
      */
-    printConsole(level, lineNumber, ...args) {
-        let printf = print;
+    formatConsole(level, lineNumber, message) {
         let start = $colors.COLORS.gray;
         if (level == 'i') {
             start = $colors.COLORS.green;
 
         } else if (level == 'w' || level == 'a') {
             start = $colors.COLORS.yellow;
-            printf = alert;
 
         } else if (level == 'e') {
             start = $colors.COLORS.red;
-            printf = alert;
         }
 
         const gray = $colors.COLORS.gray;
         const none = $colors.COLORS.none;
         const now = $logFormatter.formatTime(native.os.uptime());
 
-        printf(`${start}[${now}]${none} ${format(true, ...args)}\n${gray} ${lineNumber}${none}`);
+        return `${start}[${now}]${none} ${message}\n${gray} ${lineNumber}${none}`;
+    },
+
+    /**
+     * 打印日志信息
+     * @param {string} level 日志级别: d, l, i, w, a, e
+     * @param {string} lineNumber 行号信息
+     * @param {any[]} args 
+     */
+    printConsole(level, lineNumber, ...args) {
+        const printf = (level == 'w' || level == 'a' || level == 'e') ? alert : print;
+        printf($logFormatter.formatConsole(level, lineNumber, format(true, ...args)));
     },
 
     getFileLine() {
@@ -1281,6 +1289,16 @@ export function printConsole(level, lineNumber, ...args) {
     return true;
 }
 
+/**
+ * 返回打印到控制台的日志文本
+ * @param {string} level 日志级别: `d`,`l`,`i`,`w`,`e`,`a`
+ * @param {string} lineNumber 源代码行号信息
+ * @param {string} message 已格式化的日志内容
+ */
+export function formatConsole(level, lineNumber, message) {
+    return $logFormatter.formatConsole(level, lineNumber, message);
+}
+
 /**
  * @param {Function} onPrintLog 
  */
@@ -1291,6 +1309,18 @@ export function setPrintLog(onPrintLog) {
     }
 }
 
+/**
+ * 各种日志对应的 syslog 日志级别
+ */
+const LOG_LEVELS = {
+    d: 7,
+    l: 7,
+    i: 6,
+    a: 5,
+    w: 4,
+    e: 3
+};
+
 /**
  * 控制台工具
  */
@@ -1327,6 +1357,12 @@ export class Console {
 
         /** @type Function | null */
         this.onPrintLog = null;
+
+        /** @type number 输出的最大 syslog 日志级别, 大于这个级别的日志在格式化之前就被过滤 */
+        this.level = 7;
+
+        /** @type boolean 是否记录日志所在的源代码行号, 需要生成调用栈, 开销较大 */
+        this.fileLine = true;
     }
 
     get [Symbol.toStringTag]() {
@@ -1365,6 +1401,16 @@ export class Console {
         this.print(name + ': ' + span + ' ms');
     }
 
+    /**
+     * 返回打印到控制台的日志文本
+     * @param {string} level 日志级别: `d`,`l`,`i`,`w`,`e`,`a`
+     * @param {string} lineNumber 源代码行号信息
+     * @param {string} message 已格式化的日志内容
+     */
+    formatConsole(level, lineNumber, message) {
+        return $logFormatter.formatConsole(level, lineNumber, message);
+    }
+
     /**
      * 打印日志信息
      * @param {string} level 日志级别: `d`,`l`,`i`,`w`,`e`,`a`
@@ -1398,7 +1444,10 @@ export class Console {
      * @param {any[]} args 
      */
     debug(message, ...args) {
-        this.printLog('d', $logFormatter.getFileLine(), message, ...args);
+        if (LOG_LEVELS.d <= this.level) {
+            const line = this.fileLine ? $logFormatter.getFileLine() : '';
+            this.printLog('d', line, message, ...args);
+        }
     }
 
     /** 
@@ -1406,7 +1455,10 @@ export class Console {
      * @param {any[]} args 
      */
     log(message, ...args) {
-        this.printLog('l', $logFormatter.getFileLine(), message, ...args);
+        if (LOG_LEVELS.l <= this.level) {
+            const line = this.fileLine ? $logFormatter.getFileLine() : '';
+            this.printLog('l', line, message, ...args);
+        }
     }
 
     /** 
@@ -1414,7 +1466,10 @@ export class Console {
      * @param {any[]} args 
      */
     info(message, ...args) {
-        this.printLog('i', $logFormatter.getFileLine(), message, ...args);
+        if (LOG_LEVELS.i <= this.level) {
+            const line = this.fileLine ? $logFormatter.getFileLine() : '';
+            this.printLog('i', line, message, ...args);
+        }
     }
 
     /** 
@@ -1422,7 +1477,10 @@ export class Console {
      * @param {any[]} args 
      */
     warn(message, ...args) {
-        this.printLog('w', $logFormatter.getFileLine(), message, ...args);
+        if (LOG_LEVELS.w <= this.level) {
+            const line = this.fileLine ? $logFormatter.getFileLine() : '';
+            this.printLog('w', line, message, ...args);
+        }
     }
 
     /** 
@@ -1430,7 +1488,10 @@ export class Console {
      * @param {any[]} args 
      */
     error(message, ...args) {
-        this.printLog('e', $logFormatter.getFileLine(), message, ...args);
+        if (LOG_LEVELS.e <= this.level) {
+            const line = this.fileLine ? $logFormatter.getFileLine() : '';
+            this.printLog('e', line, message, ...args);
+        }
     }
 
     /**
@@ -1440,11 +1501,12 @@ export class Console {
      * @returns 
      */
     assert(expression, message) {
-        if (expression) {
+        if (expression || LOG_LEVELS.a > this.level) {
             return;
         }
 
-        this.printLog('a', $logFormatter.getFileLine(), message || 'console.assert');
+        const line = this.fileLine ? $logFormatter.getFileLine() : '';
+        this.printLog('a', line, message || 'console.assert');
     }
 
     /** @param {*} o */
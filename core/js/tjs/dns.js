@@ -2,10 +2,207 @@
 /// <reference path ="../../types/index.d.ts" />
 import * as native from '@tjs/native';
 const dns = native.dns;
+const errors = native.errors;
 
 export const ADDRCONFIG = dns.AI_ADDRCONFIG;
 export const V4MAPPED = dns.AI_V4MAPPED;
 
+/** getaddrinfo 的结果没有 TTL 信息, 使用这个缓存时间 (秒) */
+const DEFAULT_TTL = 30;
+
+/** 域名不存在且应答中没有 SOA 记录时的缓存时间 (秒) */
+const DEFAULT_NEGATIVE_TTL = 5;
+
+/** 最长的缓存时间 (秒) */
+const DEFAULT_MAX_TTL = 3600;
+
+/** 最多缓存的记录个数, 超过后删除最早加入的记录 */
+const MAX_CACHE_SIZE = 256;
+
+const RCODE_NXDOMAIN = 3;
+
+const PF_INET = 2;
+const PF_INET6 = 10;
+
+const cacheOptions = {
+    enabled: true,
+    ttl: DEFAULT_TTL,
+    negativeTtl: DEFAULT_NEGATIVE_TTL,
+    maxTtl: DEFAULT_MAX_TTL
+};
+
+/**
+ * 缓存的查询结果 (或者域名不存在的错误)
+ * @typedef CacheEntry
+ * @property {any[]} [value]
+ * @property {any} [error]
+ * @property {number} expires
+ */
+
+/** @type Map<string, CacheEntry> */
+const cache = new Map();
+
+/** 正在进行的查询, 相同的并发查询只查询一次 @type Map<string, Promise<CacheEntry>> */
+const pending = new Map();
+
+/**
+ * 内置的 DNS 客户端, 没有设置时 `lookup()` 使用系统的 getaddrinfo
+ * @type {native.dns.Resolver=}
+ */
+let resolver;
+
+/**
+ * 修改 DNS 缓存和解析方式
+ * @param {object} options
+ * @param {boolean} [options.cache] 是否缓存解析结果, 默认为 true
+ * @param {number} [options.ttl] getaddrinfo 结果的缓存时间 (秒)
+ * @param {number} [options.negativeTtl] 域名不存在时的默认缓存时间 (秒)
+ * @param {number} [options.maxTtl] 最长的缓存时间 (秒)
+ * @param {boolean|native.dns.ResolverOptions} [options.resolver] `lookup()` 是否使用内置的 DNS 客户端
+ */
+export function configure(options) {
+    if (options?.cache != null) {
+        cacheOptions.enabled = !!options.cache;
+    }
+
+    for (const name of ['ttl', 'negativeTtl', 'maxTtl']) {
+        const value = options?.[name];
+        if (value != null) {
+            if (typeof value != 'number' || !(value >= 0)) {
+                throw new TypeError(`invalid argument: ${name} must be a non-negative number`);
+            }
+
+            cacheOptions[name] = value;
+        }
+    }
+
+    if (options?.resolver != null) {
+        resolver?.close();
+        resolver = undefined;
+
+        if (options.resolver) {
+            const resolverOptions = (typeof options.resolver == 'object') ? options.resolver : undefined;
+            resolver = new dns.Resolver(resolverOptions);
+        }
+    }
+
+    clearCache();
+}
+
+/**
+ * 清除缓存的解析结果
+ */
+export function clearCache() {
+    cache.clear();
+}
+
+/**
+ * @param {any} error
+ */
+function isNotFound(error) {
+    const errno = error?.errno;
+    return errno == errors.UV_EAI_NONAME || errno == errors.UV_EAI_NODATA;
+}
+
+/**
+ * 缓存并合并查询
+ * @param {string} key
+ * @param {() => Promise<{ value: any[], ttl: number }>} resolve
+ * @returns {Promise<CacheEntry>}
+ */
+function resolveCached(key, resolve) {
+    const entry = cache.get(key);
+    if (entry) {
+        if (entry.expires > performance.now()) {
+            return Promise.resolve(entry);
+        }
+
+        cache.delete(key);
+    }
+
+    let promise = pending.get(key);
+    if (promise) {
+        return promise;
+    }
+
+    /**
+     * @param {CacheEntry} entry
+     * @param {number} ttl
+     */
+    function onResult(entry, ttl) {
+        pending.delete(key);
+
+        ttl = Math.min(ttl, cacheOptions.maxTtl);
+        if (cacheOptions.enabled && ttl > 0) {
+            entry.expires = performance.now() + ttl * 1000;
+            if (cache.size >= MAX_CACHE_SIZE) {
+                cache.delete(cache.keys().next().value);
+            }
+
+            cache.set(key, entry);
+        }
+
+        return entry;
+    }
+
+    promise = resolve().then((result) => {
+        return onResult({ value: result.value, expires: 0 }, result.ttl);
+
+    }, (error) => {
+        // 只缓存域名不存在的错误, 不缓存超时等临时错误
+        const ttl = isNotFound(error) ? (error.ttl || cacheOptions.negativeTtl) : 0;
+        return onResult({ error, expires: 0 }, ttl);
+    });
+
+    pending.set(key, promise);
+    return promise;
+}
+
+/**
+ * 使用内置的 DNS 客户端查询
+ * @param {native.dns.Resolver} resolver
+ * @param {string} name
+ * @param {number} type
+ */
+function queryRecords(resolver, name, type) {
+    return resolveCached(type + '/' + name.toLowerCase(), async () => {
+        const result = await resolver.query(name, type);
+        if (result.rcode == 0 && result.answers.length > 0) {
+            return { value: result.answers, ttl: result.ttl };
+        }
+
+        const notFound = (result.rcode == 0 || result.rcode == RCODE_NXDOMAIN);
+        const error = new native.Error(notFound ? errors.UV_EAI_NONAME : errors.UV_EAI_AGAIN);
+        error.rcode = result.rcode;
+        error.ttl = result.ttl;
+        throw error;
+    });
+}
+
+/**
+ * @param {any} error
+ * @param {string} hostname
+ */
+function createError(error, hostname) {
+    const err = new Error(error.message + ': ' + hostname);
+    err.code = error.code;
+    err.errno = error.errno;
+    err.hostname = hostname;
+    return err;
+}
+
+/**
+ * @param {string} hostname
+ */
+function isIPv4(hostname) {
+    const parts = hostname.split('.');
+    if (parts.length != 4) {
+        return false;
+    }
+
+    return parts.every(part => /^\d{1,3}$/.test(part) && Number(part) <= 255);
+}
+
 /**
  * Address
  * @typedef AddressInfo
@@ -28,9 +225,6 @@ export async function lookup(hostname, options) {
     let flags = 0;
     let family = -1;
 
-    const PF_INET = 2;
-    const PF_INET6 = 10;
-
     // Parse arguments
     if (typeof hostname != 'string') {
         throw TypeError('hostname argument must be a string');
@@ -64,40 +258,135 @@ export async function lookup(hostname, options) {
         return;
     }
 
-    /** @param {native.dns.AddressInfo} result */
-    function getAddress(result) {
-        const addressInfo = result && result.address;
-        if (!addressInfo) {
-            return;
-        }
+    // IPv4 地址不需要解析
+    if (family != PF_INET6 && isIPv4(hostname)) {
+        const address = { address: hostname, family: 4 };
+        return options?.all ? [address] : address;
+    }
 
-        const address = { address: addressInfo.address };
-        address.family = addressInfo.family;
-        return address;
+    /** @type CacheEntry */
+    let entry;
+    if (resolver) {
+        entry = await lookupRecords(resolver, hostname, family);
+
+    } else {
+        const key = family + '/' + flags + '/' + hostname.toLowerCase();
+        entry = await resolveCached(key, async () => {
+            const params = { family, flags };
+            const result = await dns.getaddrinfo(hostname, params);
+            const value = (result || []).map(item => item.address).filter(address => address);
+            return { value, ttl: cacheOptions.ttl };
+        });
     }
 
-    try {
-        const params = { family, flags };
-        const result = await dns.getaddrinfo(hostname, params);
-        if (!result) {
-            return;
-        }
+    if (entry.error) {
+        throw createError(entry.error, hostname);
+    }
 
-        if (options?.all) {
-            const addresses = [];
-            for (let i = 0; i < result.length; i++) {
-                addresses.push(getAddress(result[i]));
-            }
+    // 返回新的对象, 调用者可能会修改返回的地址
+    /** @param {{ address: string, family: number }} address */
+    function getAddress(address) {
+        return address && { address: address.address, family: address.family };
+    }
+
+    const addresses = entry.value || [];
+    if (options?.all) {
+        return addresses.map(getAddress);
+
+    } else {
+        return getAddress(addresses[0]);
+    }
+};
+
+/**
+ * 通过内置的 DNS 客户端查询 A 和 (或) AAAA 记录
+ * @param {native.dns.Resolver} resolver
+ * @param {string} hostname
+ * @param {number} family
+ * @returns {Promise<CacheEntry>}
+ */
+async function lookupRecords(resolver, hostname, family) {
+    const types = [];
+    if (family != PF_INET6) {
+        types.push(dns.Resolver.A);
+    }
 
-            return addresses;
+    if (family != PF_INET) {
+        types.push(dns.Resolver.AAAA);
+    }
 
-        } else {
-            return getAddress(result[0]);
+    const entries = await Promise.all(types.map(type => queryRecords(resolver, hostname, type)));
+    const value = [];
+    for (const entry of entries) {
+        for (const answer of entry.value || []) {
+            const addressFamily = (answer.type == dns.Resolver.AAAA) ? 6 : 4;
+            value.push({ address: answer.address, family: addressFamily });
         }
+    }
 
-    } catch (err) {
-        err.message = err.message + ': ' + hostname;
-        err.hostname = hostname;
-        throw err;
+    if (value.length == 0) {
+        return { error: entries[0].error || entries[1]?.error, expires: 0 };
     }
-};
+
+    return { value, expires: 0 };
+}
+
+/**
+ * 返回 `resolve*()` 使用的 DNS 客户端, 没有通过 `configure()` 设置时使用默认的配置
+ */
+function getResolver() {
+    if (!resolver) {
+        resolver = new dns.Resolver();
+    }
+
+    return resolver;
+}
+
+/**
+ * @param {string} hostname
+ * @param {number} type
+ */
+async function resolveRecords(hostname, type) {
+    if (typeof hostname != 'string') {
+        throw TypeError('hostname argument must be a string');
+    }
+
+    const entry = await queryRecords(getResolver(), hostname, type);
+    if (entry.error) {
+        throw createError(entry.error, hostname);
+    }
+
+    return entry.value || [];
+}
+
+/**
+ * 查询 IPv4 地址 (A 记录)
+ * @param {string} hostname
+ * @param {{ ttl?: boolean }} [options] ttl 为 true 时返回 `{ address, ttl }` 列表
+ * @returns {Promise<any[]>}
+ */
+export async function resolve4(hostname, options) {
+    const answers = await resolveRecords(hostname, dns.Resolver.A);
+    return answers.map(answer => options?.ttl ? { address: answer.address, ttl: answer.ttl } : answer.address);
+}
+
+/**
+ * 查询 IPv6 地址 (AAAA 记录)
+ * @param {string} hostname
+ * @param {{ ttl?: boolean }} [options] ttl 为 true 时返回 `{ address, ttl }` 列表
+ * @returns {Promise<any[]>}
+ */
+export async function resolve6(hostname, options) {
+    const answers = await resolveRecords(hostname, dns.Resolver.AAAA);
+    return answers.map(answer => options?.ttl ? { address: answer.address, ttl: answer.ttl } : answer.address);
+}
+
+/**
+ * 查询服务记录 (SRV 记录), 如 `_mqtt._tcp.example.com`
+ * @param {string} hostname
+ * @returns {Promise<{ priority: number, weight: number, port: number, name: string }[]>}
+ */
+export async function resolveSrv(hostname) {
+    const answers = await resolveRecords(hostname, dns.Resolver.SRV);
+    return answers.map(answer => ({ priority: answer.priority, weight: answer.weight, port: answer.port, name: answer.name }));
+}
@@ -6,75 +6,227 @@ const util = native.util;
 
 const FORMATS = {
     hex: util.CODE_HEX,
-    base64: util.CODE_BASE64
+    base64: util.CODE_BASE64,
+    base64url: util.CODE_BASE64URL
 };
 
 export const utf8 = native.utf8;
 const toString = native.utf8.decode;
 const toBuffer = native.utf8.encode;
+const encodeInto = native.utf8.encodeInto;
+
+/**
+ * 返回末尾不完整的 UTF-8 字节序列的长度
+ * @param {Uint8Array} bytes 
+ * @param {number} offset 开始的位置
+ */
+function incompleteLength(bytes, offset) {
+    const length = bytes.length;
+    for (let i = 1; i <= 3 && i <= length - offset; i++) {
+        const byte = bytes[length - i];
+        if ((byte & 0xc0) != 0x80) {
+            // 找到了首字节
+            const size = byte >= 0xf0 ? 4 : byte >= 0xe0 ? 3 : byte >= 0xc0 ? 2 : 1;
+            return size > i ? i : 0;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @param {BufferSource} input 
+ * @returns {Uint8Array}
+ */
+function toUint8Array(input) {
+    if (input instanceof Uint8Array) {
+        return input;
+
+    } else if (ArrayBuffer.isView(input)) {
+        return new Uint8Array(input.buffer, input.byteOffset, input.byteLength);
+    }
+
+    return new Uint8Array(input);
+}
 
 export class TextDecoder {
     /**
+     * 只支持 UTF-8
      * @param {string=} label 
-     * @param {any=} options 
+     * @param {{ fatal?: boolean, ignoreBOM?: boolean }=} options 
      */
     constructor(label, options) {
-        this.encoding = label;
-        this.options = options;
+        this.encoding = 'utf-8';
+        this.fatal = !!options?.fatal;
+        this.ignoreBOM = !!options?.ignoreBOM;
+
+        /** 上一次 stream 解码剩余的不完整的字节序列 @type {Uint8Array|undefined} */
+        this.pending = undefined;
+
+        /** 是否需要检查 BOM */
+        this.bomSeen = false;
     }
 
     /**
-     * @param {BufferSource} input 
-     * @param {any=} options 
+     * @param {BufferSource} [input] 
+     * @param {{ stream?: boolean }=} options `stream` 为 true 时表示后面还有数据, 末尾不完整的字节序列会留到下一次解码
      * @returns string
      */
     decode(input, options) {
-        if (input == null || input == undefined) {
+        if (typeof input == 'string') {
             return input;
+        }
 
-        } else if (typeof input == 'string') {
-            return input;
+        const stream = !!options?.stream;
+        let bytes = (input == null) ? new Uint8Array(0) : toUint8Array(input);
+
+        const pending = this.pending;
+        if (pending) {
+            const joined = new Uint8Array(pending.length + bytes.length);
+            joined.set(pending);
+            joined.set(bytes, pending.length);
+            bytes = joined;
+            this.pending = undefined;
+        }
+
+        let offset = 0;
+        let length = bytes.length;
+
+        if (!this.ignoreBOM && !this.bomSeen) {
+            if (length < 3 && stream && bytes[0] == 0xef && (length < 2 || bytes[1] == 0xbb)) {
+                // 还不能确定是否是 BOM
+                this.pending = bytes.slice();
+                return '';
+            }
+
+            if (length > 0) {
+                this.bomSeen = true;
+                if (bytes[0] == 0xef && bytes[1] == 0xbb && bytes[2] == 0xbf) {
+                    offset = 3;
+                    length -= 3;
+                }
+            }
         }
 
-        if (input.byteLength == 0) {
+        if (stream) {
+            const tail = incompleteLength(bytes, offset);
+            if (tail > 0) {
+                this.pending = bytes.slice(bytes.length - tail);
+                length -= tail;
+            }
+
+        } else {
+            this.bomSeen = false;
+        }
+
+        if (length <= 0) {
             return '';
         }
 
-        return toString(input);
+        return toString(bytes, offset, length, this.fatal ? utf8.FATAL : 0);
     }
 }
 
 export class TextEncoder {
     /**
-     * @param {string=} label 
-     * @param {any=} options 
+     * 只支持 UTF-8
      */
-    constructor(label, options) {
-        this.encoding = label;
-        this.options = options;
+    constructor() {
+        this.encoding = 'utf-8';
     }
 
     /** 
+     * 不是字符串的参数原样返回
      * @param {string} input 
-     * @param {any=} options 
      * @return {Uint8Array}
      */
-    encode(input, options) {
+    encode(input = '') {
         if (typeof input != 'string') {
             return input;
         }
 
         return toBuffer(input);
     }
+
+    /**
+     * 把字符串编码到指定的缓存区中, 不会写入不完整的字符
+     * @param {string} source 
+     * @param {Uint8Array} destination 
+     * @returns {{ read: number, written: number }} 读取的 UTF-16 单元数和写入的字节数
+     */
+    encodeInto(source, destination) {
+        return encodeInto(String(source), destination);
+    }
 }
 
 Object.defineProperty(window, 'TextDecoder', { enumerable: true, configurable: true, writable: true, value: TextDecoder });
 Object.defineProperty(window, 'TextEncoder', { enumerable: true, configurable: true, writable: true, value: TextEncoder });
 
+/**
+ * 分块编码为 hex/base64/base64url 字符串, 用于流式的数据
+ * - base64 每 3 个字节为一组, 不完整的组留到下一次编码
+ * - 所有块编码后的字符串连接起来和一次编码全部数据的结果相同
+ */
+export class BinaryEncoder {
+    /**
+     * @param {string} [format] `hex`,`base64`,`base64url`
+     */
+    constructor(format = 'base64') {
+        this.format = format;
+        this.type = FORMATS[format] || util.CODE_HEX;
+
+        /** 上一次剩余的不完整的组 @type {Uint8Array|undefined} */
+        this.pending = undefined;
+    }
+
+    /**
+     * @param {BufferSource} [input] 
+     * @param {{ stream?: boolean }} [options] `stream` 为 true 时表示后面还有数据
+     * @returns {string}
+     */
+    encode(input, options) {
+        const stream = !!options?.stream;
+        let bytes = (input == null) ? new Uint8Array(0) : toUint8Array(input);
+        let result = '';
+
+        const pending = this.pending;
+        if (pending) {
+            // 先和剩余的字节组成一个完整的组
+            const count = Math.min(3 - pending.length, bytes.length);
+            const group = new Uint8Array(pending.length + count);
+            group.set(pending);
+            group.set(bytes.subarray(0, count), pending.length);
+            bytes = bytes.subarray(count);
+            this.pending = undefined;
+
+            if (group.length < 3 && stream) {
+                this.pending = group;
+                return '';
+            }
+
+            result = util.encode(group, this.type);
+        }
+
+        if (stream && this.type != util.CODE_HEX) {
+            const rest = bytes.length % 3;
+            if (rest > 0) {
+                this.pending = bytes.slice(bytes.length - rest);
+                bytes = bytes.subarray(0, bytes.length - rest);
+            }
+        }
+
+        if (bytes.length > 0) {
+            result += util.encode(bytes, this.type);
+        }
+
+        return result;
+    }
+}
+
 /**
  * to string
  * @param {ArrayBuffer|Uint8Array} data 
- * @param {string} format `hex`,`base64`
+ * @param {string} format `hex`,`base64`,`base64url`
  * @returns {string}
  */
 export function encode(data, format) {
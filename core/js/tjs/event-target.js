@@ -46,10 +46,11 @@ class Event {
             throw TypeError('Value must be an object.');
         }
 
+        eventType = String(eventType);
         this[kEventState] = {
             eventInit,
             eventPhase: 2,
-            eventType: String(eventType),
+            eventType,
             // currentTarget: null,
             // canceled: false,
             // stopped: false,
@@ -60,7 +61,7 @@ class Event {
 
         // https://heycam.github.io/webidl/#Unforgeable
         Object.defineProperty(this, 'isTrusted', { value: false, enumerable: true });
-        Object.defineProperty(this, 'type', { value: String(eventType), enumerable: true });
+        Object.defineProperty(this, 'type', { value: eventType, enumerable: true });
     }
 
     get [Symbol.toStringTag]() {
@@ -281,10 +282,13 @@ function setPassiveListener(event, passiveListener) {
  */
 
 /**
- * @type {WeakMap<object, Map<string, ListenerNode>>}
+ * 监听器列表直接保存在对象的 Symbol 属性上, 比通过 WeakMap 查找要快
+ * - kListeners: Map<string, ListenerNode>
+ * - kAttributes: 缓存 `onX` 属性对应的监听函数
  * @private
  */
-const listenersMap = new WeakMap();
+const kListeners = Symbol('kListeners');
+const kAttributes = Symbol('kAttributes');
 
 // Listener types
 const CAPTURE = 1;
@@ -307,7 +311,7 @@ function isObject(x) {
  * @private
  */
 function getListeners(eventTarget) {
-    const listeners = listenersMap.get(eventTarget);
+    const listeners = eventTarget?.[kListeners];
     if (listeners == null) {
         throw new TypeError("'this' is expected an EventTarget object, but got another value.");
     }
@@ -324,16 +328,8 @@ function getListeners(eventTarget) {
 function defineEventAttributeDescriptor(eventName) {
     return {
         get() {
-            const listeners = getListeners(this);
-            let node = listeners.get(eventName);
-            while (node != null) {
-                if (node.listenerType === ATTRIBUTE) {
-                    return node.listener;
-                }
-
-                node = node.next;
-            }
-            return null;
+            getListeners(this);
+            return this[kAttributes][eventName] ?? null;
         },
 
         set(listener) {
@@ -342,6 +338,7 @@ function defineEventAttributeDescriptor(eventName) {
             }
 
             const listeners = getListeners(this);
+            this[kAttributes][eventName] = listener;
 
             // Traverse to the tail while removing old value.
             let prev = null;
@@ -412,7 +409,8 @@ class EventTarget {
     }
 
     __init() {
-        listenersMap.set(this, new Map());
+        Object.defineProperty(this, kListeners, { value: new Map(), writable: true });
+        Object.defineProperty(this, kAttributes, { value: Object.create(null), writable: true });
     }
 
     /**
@@ -492,6 +490,19 @@ class EventTarget {
             return true;
         }
 
+        // Fast path: 只有一个普通的监听函数 (比如 `onmessage`)
+        if (node.next === null && !node.once && !node.passive && typeof node.listener === 'function') {
+            try {
+                node.listener.call(this, event);
+
+            } catch (err) {
+                console.error(err);
+            }
+
+            setEventPhase(event, 0);
+            return !event.defaultPrevented;
+        }
+
         // This doesn't process capturing phase and bubbling phase.
         // This isn't participating in a tree.
         let prev = null;
@@ -541,6 +552,16 @@ class EventTarget {
         return !event.defaultPrevented;
     }
 
+    /**
+     * 是否注册了指定名称的事件的监听器
+     * - 可以用来在没有监听器时跳过创建事件对象
+     * @param {string} eventName 
+     * @returns {boolean}
+     */
+    hasEventListener(eventName) {
+        return getListeners(this).has(eventName);
+    }
+
     /**
      * 
      * @param {string} eventName 
@@ -614,12 +635,15 @@ class EventTarget {
 
         if (eventName) {
             removeEventListeners(eventName);
+            delete this[kAttributes][eventName];
             return;
         }
 
         for (const name of listeners.keys()) {
             removeEventListeners(name);
         }
+
+        this[kAttributes] = Object.create(null);
     }
 
 }
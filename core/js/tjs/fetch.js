@@ -4,13 +4,18 @@
 
 import * as native from '@tjs/native';
 import * as dns from '@tjs/dns';
+import * as json from '@tjs/json';
 import * as streams from '@tjs/streams';
 import * as process from '@tjs/process';
 
 const http = native.http;
 const zlib = native.zlib;
+const parseJSON = native.utf8.parseJSON;
 const DEBUG = 0;
 
+/** 应答消息体未读取的数据超过这个值时暂停从连接读取数据 */
+const BODY_HIGH_WATER_MARK = 64 * 1024;
+
 /**
  * RequestOptions
  * @typedef RequestOptions
@@ -501,7 +506,25 @@ export class Body {
     // text -> json
     async json() {
         try {
-            const text = await this.text();
+            const body = await this._fullyReadBody();
+            if (body.arrayBuffer) {
+                // 直接从 UTF-8 字节解析, 不需要先解码为字符串
+                if (!body.arrayBuffer.byteLength) {
+                    return;
+                }
+
+                return parseJSON(body.arrayBuffer);
+            }
+
+            let text = body.text;
+            if (body.blob) {
+                text = await body.blob.text();
+
+            } else if (body.formData) {
+                // @ts-ignore
+                text = await body.formData.toBlob().text();
+            }
+
             if (!text || !text.length) {
                 return;
             }
@@ -513,6 +536,31 @@ export class Body {
         }
     }
 
+    /**
+     * 逐个读取消息体中顶层 JSON 数组的记录
+     * - 消息体是流时边接收边解析, 不需要缓存整个消息体
+     * @param {json.ParseOptions} [options]
+     * @returns {AsyncGenerator<any, void, unknown>}
+     */
+    async* jsonRecords(options) {
+        const readStream = this._body;
+        if (readStream && !this._bodyUsed) {
+            this._bodyUsed = true;
+            delete this._body;
+
+            yield* json.parseStream(readStream, options);
+            return;
+        }
+
+        const data = await this.arrayBuffer();
+        const parser = new json.JSONParser(options);
+        if (data) {
+            yield* parser.write(data);
+        }
+
+        yield* parser.end();
+    }
+
     /**
      * 从 Stream 中读取所有内容
      * @param {ReadableStream=} readStream 
@@ -1140,7 +1188,16 @@ export class FetchConnection {
         }
 
         if (data) {
-            requestContext.readController?.enqueue(new Uint8Array(data));
+            const readController = requestContext.readController;
+            if (readController) {
+                readController.enqueue(new Uint8Array(data));
+
+                // 应用读取得比较慢, 暂停从连接读取数据
+                if ((readController.desiredSize || 0) <= 0) {
+                    this.socket?.pause();
+                }
+            }
+
             requestContext.loadedLength = (requestContext.loadedLength || 0) + data.byteLength;
             this.updated = Date.now();
             // console.log('fetch:', 'body:', requestContext.loadedLength);
@@ -1193,6 +1250,9 @@ export class FetchConnection {
             this.setReadyState(FetchConnection.IDLE);
         }
 
+        // 继续读取下一个应答消息
+        this.socket?.resume();
+
         // console.log('fetch:', 'end:', connection);
         requestContext.readController?.close();
         requestContext.readController = undefined;
@@ -1273,11 +1333,19 @@ export class FetchConnection {
             /** @type ReadableStream<Uint8Array> */
             // @ts-ignore
             requestContext.readStream = new streams.ReadableStream({
+                type: 'bytes',
                 start(controller) {
                     // @ts-ignore
                     requestContext.readController = controller;
+                },
+                pull: () => {
+                    // 数据已被读取, 恢复读取
+                    if (this.context == requestContext) {
+                        this.updated = Date.now();
+                        this.socket?.resume();
+                    }
                 }
-            });
+            }, { highWaterMark: BODY_HIGH_WATER_MARK });
 
             response._body = requestContext.readStream;
         }
@@ -1329,6 +1397,7 @@ export class FetchConnection {
             headers?.set('Host', options.host);
 
             let bodyData = null;
+            let isChunked = false;
             const bodyStream = request.body;
             if (!bodyStream) {
                 bodyData = await request.arrayBuffer();
@@ -1337,6 +1406,11 @@ export class FetchConnection {
                         headers?.set('Content-Length', bodyData.byteLength);
                     }
                 }
+
+            } else if (headers?.get('Content-Length') == null) {
+                // 长度未知的流, 使用分块传输编码
+                headers?.set('Transfer-Encoding', 'chunked');
+                isChunked = true;
             }
 
             // 2. Encode request headers
@@ -1369,7 +1443,7 @@ export class FetchConnection {
                 // console.log('fetch:', 'body:', bodyData);
 
             } else if (bodyStream) {
-                await this.sendRequestBody(bodyStream);
+                await this.sendRequestBody(bodyStream, isChunked);
             }
 
             // 5. 请求发送完毕，清理相关的资源
@@ -1387,8 +1461,9 @@ export class FetchConnection {
     /**
      * @private
      * @param {ReadableStream} body 
+     * @param {boolean} [isChunked] 是否使用分块传输编码
      */
-    async sendRequestBody(body) {
+    async sendRequestBody(body, isChunked) {
         const socket = this.socket;
 
         const reader = body.getReader();
@@ -1403,10 +1478,27 @@ export class FetchConnection {
 
             } else if (result.value != null) {
                 // console.log('data:', result.value.length, util.hash(result.value, 'md5'));
-                await socket?.write(result.value);
+                if (isChunked) {
+                    const data = (typeof result.value == 'string') ? native.utf8.encode(result.value) : result.value;
+                    if (!data.byteLength) {
+                        continue;
+                    }
+
+                    await socket?.write(data.byteLength.toString(16) + '\r\n');
+                    await socket?.write(data);
+                    await socket?.write('\r\n');
+
+                } else {
+                    await socket?.write(result.value);
+                }
+
                 this.updated = Date.now();
             }
         }
+
+        if (isChunked) {
+            await socket?.write('0\r\n\r\n');
+        }
     }
 
     /**
@@ -2,6 +2,7 @@
 /// <reference path ="../../types/index.d.ts" />
 import * as native from '@tjs/native';
 import * as path from '@tjs/path';
+import { defineEventAttribute, EventTarget } from '@tjs/event-target';
 
 const fs = native.fs;
 const join = path.join;
@@ -24,8 +25,51 @@ export const stat = fs.stat;
 export const statfs = fs.statfs;
 export const symlink = fs.symlink;
 export const unlink = fs.unlink;
-export const utimes = fs.utimes;
-export const watch = fs.watch;
+
+/**
+ * 内存映射访问方式建议
+ */
+const MADVISE = {
+    normal: fs.MADV_NORMAL,
+    random: fs.MADV_RANDOM,
+    sequential: fs.MADV_SEQUENTIAL,
+    willneed: fs.MADV_WILLNEED,
+    dontneed: fs.MADV_DONTNEED
+};
+
+/**
+ * 将文件映射到内存
+ * - 返回的 ArrayBuffer 直接使用映射的内存, 在被回收时解除映射
+ * - 同一进程内 (包括 Worker) 对同一文件同一区域的可写映射共用同一块内存
+ * - 只读映射使用写时复制, 写入 ArrayBuffer 只修改它自己的副本, 不会修改文件, 其他映射也看不到
+ * - 映射期间不要截断这个文件
+ * @param {string} filename 
+ * @param {object} [options]
+ * @param {number} [options.offset] 开始位置
+ * @param {number} [options.length] 映射的长度, 默认到文件末尾
+ * @param {boolean} [options.readonly] 是否只读, 默认为 true
+ * @param {'normal'|'random'|'sequential'|'willneed'|'dontneed'} [options.advice] 访问方式建议
+ * @returns {ArrayBuffer}
+ */
+export function mmap(filename, options) {
+    const advice = options?.advice;
+    return fs.mmap(filename, { ...options, advice: advice ? MADVISE[advice] : undefined });
+}
+
+/**
+ * 给内核提供映射内存的访问方式建议
+ * - 只接受 mmap() 返回的内存, 其他 ArrayBuffer 抛出 EINVAL 错误
+ * @param {ArrayBuffer|ArrayBufferView} buffer mmap() 返回的 ArrayBuffer 或它的视图
+ * @param {'normal'|'random'|'sequential'|'willneed'|'dontneed'} advice 
+ */
+export function madvise(buffer, advice) {
+    const value = MADVISE[advice];
+    if (value == null) {
+        throw new TypeError(`Invalid advice: ${advice}`);
+    }
+
+    fs.madvise(buffer, value);
+}
 
 /**
  * @param {string} filename 
@@ -39,6 +83,158 @@ export async function truncate(filename, len) {
     }
 }
 
+/**
+ * 修改文件的访问和修改时间
+ * @param {string} filename 
+ * @param {number|Date} atime 访问时间, 数字表示秒
+ * @param {number|Date} mtime 修改时间, 数字表示秒
+ */
+export async function utimes(filename, atime, mtime) {
+    const toSeconds = (/** @type {number|Date} */ time) => (time instanceof Date) ? time.getTime() / 1000 : Number(time);
+    await fs.utimes(filename, toSeconds(atime), toSeconds(mtime));
+}
+
+/** 正在使用的监视器, 以免没有被引用的监视器被回收 */
+const activeWatchers = new Set();
+
+/**
+ * 文件系统监视器
+ * - 同一时间段内发生的事件被合并为一批, 通过 `change` 事件的 `data` 属性返回
+ */
+export class FSWatcher extends EventTarget {
+    /**
+     * @param {string} filename 
+     * @param {native.fs.WatchOptions} [options] 
+     * @param {(events: native.fs.WatchEvent[]) => void} [listener] 
+     */
+    constructor(filename, options, listener) {
+        super();
+
+        /** @type {native.fs.Watcher | undefined} */
+        this.handle = fs.watch(filename, options || {}, (events) => {
+            listener?.(events);
+
+            if (this.hasEventListener('change')) {
+                this.dispatchEvent(new MessageEvent('change', { data: events }));
+            }
+        });
+
+        activeWatchers.add(this);
+    }
+
+    get path() {
+        return this.handle?.path;
+    }
+
+    close() {
+        const handle = this.handle;
+        if (handle) {
+            this.handle = undefined;
+            activeWatchers.delete(this);
+            handle.close();
+            this.dispatchEvent(new Event('close'));
+        }
+    }
+}
+
+defineEventAttribute(FSWatcher.prototype, 'change');
+defineEventAttribute(FSWatcher.prototype, 'close');
+
+/**
+ * 监视文件或目录的变化
+ * - Linux 下基于 inotify, 支持递归监视子目录, 重命名事件包含原来的路径
+ * - 在 `delay` 毫秒内发生的事件会被合并成一批: 多次修改只报告一次, 创建后又删除的文件不报告
+ * @param {string} filename 文件或目录名
+ * @param {native.fs.WatchOptions | ((events: native.fs.WatchEvent[]) => void)} [options]
+ * @param {(events: native.fs.WatchEvent[]) => void} [listener] 
+ * @returns {FSWatcher}
+ */
+export function watch(filename, options, listener) {
+    if (typeof options == 'function') {
+        listener = options;
+        options = undefined;
+    }
+
+    return new FSWatcher(filename, options, listener);
+}
+
+/** 复制或删除目录时同时进行的最大操作数 */
+const MAX_PARALLEL_OPERATIONS = 8;
+
+/**
+ * 以有限的并发数对每一项执行指定的异步操作
+ * @template T
+ * @param {T[]} items 
+ * @param {(item: T) => Promise<any>} callback 
+ * @param {number} [limit] 最大并发数
+ */
+async function forEachParallel(items, callback, limit = MAX_PARALLEL_OPERATIONS) {
+    let index = 0;
+    async function next() {
+        while (index < items.length) {
+            await callback(items[index++]);
+        }
+    }
+
+    const tasks = [];
+    for (let i = 0; i < limit && i < items.length; i++) {
+        tasks.push(next());
+    }
+
+    await Promise.all(tasks);
+}
+
+/**
+ * 遍历目录树, 每次返回一批目录项
+ * - 遍历在线程池中进行, 不会为每个目录项单独发起请求
+ * - 父目录总是在它的子目录项之前返回
+ * @param {string} root 根目录
+ * @param {object} [options]
+ * @param {boolean} [options.stat] 同时返回每个目录项的 lstat 信息
+ * @param {number} [options.maxDepth] 最大深度, 根目录下的目录项深度为 1
+ * @param {number} [options.batchSize] 每批最多返回的目录项数
+ * @param {(entry: native.fs.WalkEntry) => boolean} [options.filter] 返回 false 时忽略这个目录项, 并且不会进入这个目录
+ * @returns {AsyncGenerator<native.fs.WalkEntry[]>}
+ */
+export async function* walk(root, options) {
+    const filter = options?.filter;
+    const walker = fs.walk(root, options);
+
+    try {
+        /** @type string[] */
+        let skip = [];
+        for (;;) {
+            const entries = await walker.read(skip);
+            if (entries.length == 0) {
+                break;
+            }
+
+            if (!filter) {
+                yield entries;
+                continue;
+            }
+
+            skip = [];
+            const result = [];
+            for (const entry of entries) {
+                if (filter(entry)) {
+                    result.push(entry);
+
+                } else if (entry.type == fs.UV_DIRENT_DIR) {
+                    skip.push(entry.path);
+                }
+            }
+
+            if (result.length > 0) {
+                yield result;
+            }
+        }
+
+    } finally {
+        walker.close();
+    }
+}
+
 /**
  * @param {string} src 
  * @param {string} dest 
@@ -84,33 +280,50 @@ export async function cp(src, dest, options) {
     }
 
     /**
+     * 复制整个目录
+     * - 每一批中的目录的父目录都已在之前的批次中创建
      * @param {string} src 
      * @param {string} dest 
      */
     async function copyDir(src, dest) {
         await mkdir(dest, options);
 
-        const dirs = await readdir(src);
-        for await (const dir of dirs) {
-            const subsrc = path.join(src, dir.name);
-            const subdest = path.join(dest, dir.name);
+        const maxDepth = recursive ? undefined : 1;
 
-            if (dir.type == 2) { // dir
-                // console.log('cp:', subsrc, subdest);
-                if (recursive) {
-                    await cp(subsrc, subdest);
-                }
+        /** @param {native.fs.WalkEntry} entry */
+        const target = (entry) => join(dest, path.relative(src, entry.path));
 
-            } else if (dir.type == 1) { // file
-                // console.log(subsrc, subdest);
-                await fs.copyFile(subsrc, subdest);
+        for await (const entries of walk(src, { maxDepth })) {
+            const dirs = [];
+            const files = [];
+            for (const entry of entries) {
+                if (entry.type == fs.UV_DIRENT_DIR) {
+                    if (recursive) {
+                        dirs.push(entry);
+                    }
 
-            } else if (dir.type == 3) { // link
-                const target = await readlink(subsrc);
-                if (target) {
-                    await symlink(target, subdest);
+                } else {
+                    files.push(entry);
                 }
             }
+
+            await forEachParallel(dirs, async (entry) => {
+                if (!await exists(target(entry))) {
+                    await fs.mkdir(target(entry));
+                }
+            });
+
+            await forEachParallel(files, async (entry) => {
+                if (entry.type == fs.UV_DIRENT_FILE) {
+                    await fs.copyFile(entry.path, target(entry));
+
+                } else if (entry.type == fs.UV_DIRENT_LINK) {
+                    const link = await readlink(entry.path);
+                    if (link) {
+                        await symlink(link, target(entry));
+                    }
+                }
+            });
         }
     }
 
@@ -182,20 +395,30 @@ export async function rm(path, options) {
 
     /**
      * 删除指定的目录以及文件
+     * - 先删除所有文件, 再从最深的目录开始删除所有目录
      * @param {string} pathname 目录名
      */
     async function rmdir(pathname) {
-        const files = await readdir(pathname);
-        for (const file of files) {
-            if (file.type == 2) {
-                await rmdir(join(pathname, file.name));
+        /** @type string[][] 按深度分组的目录 */
+        const dirs = [[pathname]];
 
-            } else {
-                await remove(join(pathname, file.name));
+        for await (const entries of walk(pathname)) {
+            const files = [];
+            for (const entry of entries) {
+                if (entry.type == fs.UV_DIRENT_DIR) {
+                    (dirs[entry.depth] ??= []).push(entry.path);
+
+                } else {
+                    files.push(entry.path);
+                }
             }
+
+            await forEachParallel(files, remove);
         }
 
-        return await fs.rmdir(pathname);
+        for (let depth = dirs.length - 1; depth >= 0; depth--) {
+            await forEachParallel(dirs[depth] || [], fs.rmdir);
+        }
     }
 
     if (!recursive) {
@@ -265,6 +488,9 @@ export async function exists(filename) {
     }
 }
 
+/** readdir 每次读取的目录项数 */
+const READDIR_BATCH_SIZE = 256;
+
 /**
  * Read dir
  * @param {string} filename 
@@ -274,10 +500,16 @@ export async function readdir(filename) {
     try {
         const dir = await fs.opendir(filename);
         const result = [];
-        for await (const dirent of dir) {
-            result.push(dirent);
+        for (;;) {
+            const entries = await dir.read(READDIR_BATCH_SIZE);
+            if (entries.length == 0) {
+                break;
+            }
+
+            result.push(...entries);
         }
 
+        await dir.close();
         return result;
 
     } catch (err) {
@@ -287,34 +519,46 @@ export async function readdir(filename) {
 }
 
 /**
- * Append to file
+ * @typedef {object} WriteFileOptions
+ * @property {string} [encoding] 
+ * @property {number} [mode] 新建文件的权限, 原子写入时默认保留原文件的权限
+ * @property {string} [flag] 指定了 'w' 或 'a' 以外的标志时, 使用 open/write/close 写入
+ * @property {boolean} [atomic] 先写入临时文件再重命名, 中途失败不会留下不完整的文件
+ * @property {boolean|'group'} [fsync] 写入后同步到磁盘, 'group' 表示与同时进行的其他写入合并目录同步
+ */
+
+/**
  * @param {string} filename 
- * @param {string|ArrayBuffer} data 
- * @param {string|{encoding?: string, mode?: number, flag?: string}} options 
- * @returns {Promise<void>}
+ * @param {string|ArrayBuffer|ArrayBufferView} data 
+ * @param {string|WriteFileOptions|undefined} options 
+ * @param {string} defaultFlag
  */
-export async function appendFile(filename, data, options) {
-    let flag = 'a';
-    let mode = 0o666;
-    let encoding;
-    if (typeof options == 'object') {
-        encoding = options.encoding;
+async function writeFileWithOptions(filename, data, options, defaultFlag) {
+    if (typeof options == 'string') {
+        options = { encoding: options };
 
-        if (options.mode) {
-            mode = options.mode;
-        }
+    } else if (options == null || typeof options != 'object') {
+        options = {};
+    }
 
-        if (options.flag) {
-            flag = options.flag;
+    const flag = options.flag || defaultFlag;
+    if (flag == defaultFlag) {
+        // 打开, 写入, 同步和关闭在同一个工作项中完成
+        const nativeOptions = { atomic: options.atomic, fsync: options.fsync, mode: options.mode };
+        if (defaultFlag == 'a') {
+            return fs.appendFile(filename, data, nativeOptions);
         }
 
-    } else if (typeof options == 'string') {
-        encoding = options;
+        return fs.writeFile(filename, data, nativeOptions);
     }
 
     try {
-        const file = await fs.open(filename, flag, mode);
-        await file.write(data, encoding);
+        const file = await fs.open(filename, flag, options.mode || 0o666);
+        await file.write(data, options.encoding);
+        if (options.fsync) {
+            await file.sync();
+        }
+
         await file.close();
 
     } catch (err) {
@@ -323,6 +567,17 @@ export async function appendFile(filename, data, options) {
     }
 }
 
+/**
+ * Append to file
+ * @param {string} filename 
+ * @param {string|ArrayBuffer|ArrayBufferView} data 
+ * @param {string|WriteFileOptions} [options] 
+ * @returns {Promise<void>}
+ */
+export async function appendFile(filename, data, options) {
+    return writeFileWithOptions(filename, data, options, 'a');
+}
+
 /**
  * Read from file
  * @param {string} filename 
@@ -398,38 +653,58 @@ export async function readTextFile(filename, options) {
 /**
  * Write to file
  * @param {string} filename 
- * @param {string|ArrayBuffer} data 
- * @param {string|{encoding?: string, mode?: number, flag?: string}} options 
+ * @param {string|ArrayBuffer|ArrayBufferView} data 
+ * @param {string|WriteFileOptions} [options] 
+ * @returns {Promise<void>}
  */
 export async function writeFile(filename, data, options) {
-    let flag = 'w';
-    let mode = 0o666;
-    let encoding;
-    if (typeof options == 'object') {
-        encoding = options.encoding;
+    return writeFileWithOptions(filename, data, options, 'w');
+}
 
-        if (options.mode) {
-            mode = options.mode;
-        }
+/**
+ * 循环使用的一组缓存区
+ * - 用于流式读写文件时避免为每个数据块分配新的缓存区
+ * - next() 返回的缓存区在之后第 `count` 次调用 next() 时被重新使用
+ */
+export class BufferRing {
+    /**
+     * @param {number} count 缓存区的个数
+     * @param {number} byteLength 每个缓存区的大小
+     */
+    constructor(count, byteLength) {
+        /** @type Uint8Array[] */
+        this.buffers = [];
+        this.byteLength = byteLength;
+        this.count = count;
+        this.index = 0;
+    }
 
-        if (options.flag) {
-            flag = options.flag;
+    /**
+     * 返回下一个缓存区
+     */
+    next() {
+        const index = this.index;
+        this.index = (index + 1) % this.count;
+
+        let buffer = this.buffers[index];
+        if (!buffer) {
+            buffer = new Uint8Array(this.byteLength);
+            this.buffers[index] = buffer;
         }
 
-    } else if (typeof options == 'string') {
-        encoding = options;
+        return buffer;
     }
-
-    const file = await fs.open(filename, flag, mode);
-    await file.write(data, encoding);
-    await file.close();
 }
 
+/** 文件流循环使用的缓存区的个数 */
+const STREAM_BUFFER_COUNT = 4;
+
 /**
  * 创建一个文件流
+ * - 指定 `recycle` 时数据块使用循环的缓存区, 每个数据块只在读取之后的 3 个数据块之前有效
  * @param {string} filename 
- * @param {{ chunkSize?: number, onprogress?: (event: {loaded: number, total: number}) => void}} options 
- * @returns {Promise<ReadableStream<Uint8Array>>}
+ * @param {{ chunkSize?: number, recycle?: boolean, onprogress?: (event: {loaded: number, total: number}) => void}} options
+ * @returns {Promise<ReadableStream>}
  */
 export async function readableStream(filename, options) {
     // eslint-disable-next-line no-unused-vars
@@ -443,12 +718,42 @@ export async function readableStream(filename, options) {
     let loadedLength = 0;
     const BUFFER_SIZE = options?.chunkSize || 32 * 1024;
     const onprogress = options?.onprogress;
+    const ring = options?.recycle ? new BufferRing(STREAM_BUFFER_COUNT, BUFFER_SIZE) : null;
+
+    /**
+     * 读取下一个数据块
+     * @param {native.FileHandle} file
+     */
+    async function read(file) {
+        if (ring) {
+            const buffer = ring.next();
+            const length = await file.readInto(buffer);
+            return buffer.subarray(0, length);
+        }
+
+        return new Uint8Array(await file.read(BUFFER_SIZE));
+    }
+
+    /**
+     * 读取下一个数据块到指定的缓存区中
+     * @param {native.FileHandle} file
+     * @param {ArrayBufferView} view
+     */
+    async function readInto(file, view) {
+        const length = await file.readInto(view);
+        return new Uint8Array(view.buffer, view.byteOffset, length);
+    }
 
     const stream = new ReadableStream({
+        type: 'bytes',
         pull(controller) {
             async function readChunk() {
-                const chunkData = await file?.read(BUFFER_SIZE);
-                if (chunkData == null || chunkData.byteLength == 0) {
+                // BYOB 模式: 直接读取到调用者提供的缓存区中
+                // @ts-ignore
+                const request = controller.byobRequest;
+                const view = request?.view;
+                const data = file && (view ? await readInto(file, view) : await read(file));
+                if (data == null || data.byteLength == 0) {
                     controller.close();
 
                     if (file) {
@@ -459,9 +764,13 @@ export async function readableStream(filename, options) {
                     return;
                 }
 
-                loadedLength += chunkData.byteLength;
-                const data = new Uint8Array(chunkData);
-                controller.enqueue(data);
+                loadedLength += data.byteLength;
+                if (view) {
+                    request.respond(data.byteLength);
+
+                } else {
+                    controller.enqueue(data);
+                }
 
                 if (onprogress) {
                     onprogress({ loaded: loadedLength, total: statInfo.size });
@@ -476,7 +785,7 @@ export async function readableStream(filename, options) {
                 file = null;
             }
         }
-    });
+    }, { highWaterMark: BUFFER_SIZE });
 
     return stream;
 }
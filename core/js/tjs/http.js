@@ -2,6 +2,7 @@
 /// <reference path ="../../types/index.d.ts" />
 import * as native from '@tjs/native';
 import * as formdata from '@tjs/form-data';
+import * as json from '@tjs/json';
 
 import { defineEventAttribute } from '@tjs/event-target';
 
@@ -183,12 +184,13 @@ export class IncomingMessage {
 
     async json() {
         try {
-            const body = await this.text();
+            // 直接从 UTF-8 字节解析, 不需要先解码为字符串
+            const body = await this.arrayBuffer();
             if (body == null) {
                 return;
             }
 
-            return JSON.parse(body);
+            return native.utf8.parseJSON(body);
 
         } catch (err) {
             this.error = err;
@@ -348,6 +350,28 @@ export class ServerResponse extends EventTarget {
         return this.headers.get(field);
     }
 
+    /**
+     * 以分块传输编码发送 JSON 数据
+     * - 增量序列化, 不会生成整个 JSON 字符串, 适合发送大的数组
+     * @param {any} value 
+     * @param {json.StringifyOptions} [options]
+     */
+    async json(value, options) {
+        if (!this.isHeadersSent) {
+            this.type('json');
+        }
+
+        for (const chunk of json.stringifyChunks(value, options)) {
+            if (!this._isWritable()) {
+                break;
+            }
+
+            await this.write(chunk);
+        }
+
+        await this.end();
+    }
+
     /**
      * redirect
      * @param {number} status 
@@ -364,6 +388,26 @@ export class ServerResponse extends EventTarget {
     async send(data) {
         if (data == null) {
             return;
+
+        } else if (data instanceof ReadableStream) {
+            const reader = data.getReader();
+            while (true) {
+                if (!this._isWritable()) {
+                    // 连接已经关闭
+                    await reader.cancel();
+                    break;
+                }
+
+                const result = await reader.read();
+                if (result.done) {
+                    break;
+                }
+
+                await this.write(result.value);
+            }
+
+            await this.end();
+            return;
         }
 
         if (typeof data == 'object') {
@@ -414,6 +458,14 @@ export class ServerResponse extends EventTarget {
         }
     }
 
+    /** 
+     * 是否还可以继续发送消息内容
+     * @returns {boolean}
+     */
+    _isWritable() {
+        return this.socket != null;
+    }
+
     /** @param {ArrayBuffer|ArrayBufferView} data */
     async write(data) {
         const socket = this.socket;
@@ -746,8 +798,13 @@ export class Server extends EventTarget {
         const backlog = options.backlog || 100;
 
         // console.log('bind', address, backlog);
-        const socket = new native.TCP();
-        socket.bind(address);
+        /** @type native.TCP */
+        let socket = options.handle;
+        if (!socket) {
+            socket = new native.TCP();
+            socket.bind(address, options.reusePort ? native.TCP.REUSEPORT : 0);
+        }
+
         socket.listen(backlog);
 
         this.server = socket;
@@ -774,12 +831,198 @@ export class Server extends EventTarget {
 defineEventAttribute(Server.prototype, 'error');
 defineEventAttribute(Server.prototype, 'close');
 
+// ////////////////////////////////////////////////////////////
+// NativeServerResponse
+
+/**
+ * 原生 HTTP 服务器的应答消息
+ * - 消息体会先缓存起来，在 `end()` 时和消息头一起由原生层一次性发送
+ */
+export class NativeServerResponse extends ServerResponse {
+    /**
+     * @param {IncomingMessage} request 
+     * @param {native.http.ServerRequest} handle 
+     */
+    constructor(request, handle) {
+        super(request);
+
+        /** @type {native.http.ServerRequest=} */
+        this._handle = handle;
+
+        /** @type {(string|ArrayBuffer|ArrayBufferView)[]} */
+        this._chunks = [];
+    }
+
+    get [Symbol.toStringTag]() {
+        return 'NativeServerResponse';
+    }
+
+    _isWritable() {
+        return this._handle != null;
+    }
+
+    /** @param {*=} data */
+    async end(data) {
+        const handle = this._handle;
+        if (!handle) {
+            return;
+        }
+
+        if (data) {
+            await this.write(data);
+        }
+
+        this._handle = undefined;
+        this.isHeadersSent = true;
+
+        const chunks = this._chunks;
+        this._chunks = [];
+
+        try {
+            handle.respond(this.status, this.headers.map, chunks, this.statusText);
+
+        } catch (error) {
+            handle.respond(500);
+        }
+
+        this.removeAllEventListeners();
+    }
+
+    /** @param {ArrayBuffer|ArrayBufferView|string} data */
+    async write(data) {
+        if (!this._handle) {
+            return;
+        }
+
+        this.bodyUsed = true;
+        if (data) {
+            this._chunks.push(data);
+        }
+    }
+
+    async writeHead() {
+
+    }
+}
+
+// ////////////////////////////////////////////////////////////
+// NativeServer
+
+/**
+ * 原生 HTTP 服务器
+ * - 连接管理、请求解析、keep-alive、pipelining 和应答序列化都在原生层完成
+ * - 每个请求只调用一次 JS
+ */
+export class NativeServer extends EventTarget {
+    /**
+     * @param {*} options 
+     * @param {RequestListener=} requestListener 
+     */
+    constructor(options, requestListener) {
+        super();
+
+        /** @type any */
+        this.options = options;
+
+        /** @type {RequestListener=} */
+        this.requestListener = requestListener;
+
+        /** @type {native.http.Server=} */
+        this.server = undefined;
+    }
+
+    get [Symbol.toStringTag]() {
+        return 'NativeServer';
+    }
+
+    /** @returns {native.SocketAddress=} */
+    address() {
+        return this.server?.address();
+    }
+
+    /**
+     * 关闭这个服务
+     */
+    close() {
+        const server = this.server;
+        if (server) {
+            this.server = undefined;
+
+            server.onerror = undefined;
+            server.onrequest = undefined;
+            server.close();
+        }
+
+        this.removeAllEventListeners();
+    }
+
+    /**
+     * 处理请求
+     * @param {native.http.ServerRequest} handle 
+     */
+    async handleRequest(handle) {
+        const request = new IncomingMessage(handle);
+        request._rawBody = handle.body;
+
+        const response = new NativeServerResponse(request, handle);
+        const requestListener = this.requestListener;
+
+        try {
+            if (requestListener) {
+                await requestListener(request, response);
+            }
+
+        } catch (error) {
+            this.dispatchEvent(new ErrorEvent('error', { error }));
+
+            if (!response.isHeadersSent) {
+                response.setStatus(500);
+                await response.end();
+            }
+        }
+    }
+
+    /**
+     * 开始这个服务
+     * @returns {Promise<this>}
+     */
+    async start() {
+        const options = this.options || {};
+        const address = { address: '0.0.0.0', port: 80, family: 4 };
+        address.address = options.host || '0.0.0.0';
+        address.port = options.port || 80;
+        const backlog = options.backlog || 100;
+
+        const server = new http.Server(options);
+        const flags = options.reusePort ? native.TCP.REUSEPORT : 0;
+        server.listen(options.handle || address, backlog, flags);
+
+        this.server = server;
+
+        server.onerror = (error) => {
+            this.dispatchEvent(new ErrorEvent('error', { error }));
+        };
+
+        server.onrequest = (handle) => {
+            this.handleRequest(handle);
+        };
+
+        return this;
+    }
+}
+
+defineEventAttribute(NativeServer.prototype, 'error');
+
 /**
  * 
- * @param {*} options 
+ * @param {*} options `options.native` 为 true 时使用原生 HTTP 服务器
  * @param {*} requestListener 
- * @returns {Server}
+ * @returns {Server|NativeServer}
  */
 export function createServer(options, requestListener) {
+    if (options?.native) {
+        return new NativeServer(options, requestListener);
+    }
+
     return new Server(options, requestListener);
 }
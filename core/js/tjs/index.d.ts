@@ -22,6 +22,9 @@ interface MQTTPacket {
 
 	returnCode?: number; // CONNACK
 	sessionPresent?: number; // CONNACK
+
+	reasonCode?: number; // MQTT 5
+	properties?: any; // MQTT 5
 }
 
 /**
@@ -35,4 +38,5 @@ interface MQTTRequest {
 	retained?: number;
 	dup?: number;
 	pid?: number;
+	properties?: any;
 }
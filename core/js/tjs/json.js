@@ -0,0 +1,140 @@
+// @ts-check
+/// <reference path ="../../types/index.d.ts" />
+import * as native from '@tjs/native';
+import * as streams from '@tjs/streams';
+
+const json = native.json;
+
+/** 默认的分块大小 (字节) */
+export const CHUNK_SIZE = json.CHUNK_SIZE;
+
+/**
+ * @typedef {object} StringifyOptions
+ * @property {number|string} [space] 缩进, 同 JSON.stringify 的 space 参数
+ * @property {number} [chunkSize] 每个分块的大致大小 (字节)
+ */
+
+/**
+ * @typedef {object} ParseOptions
+ * @property {number} [maxLength] 单个记录的最大长度 (字节), 默认不限制
+ */
+
+/**
+ * 增量序列化为 UTF-8 编码的分块
+ * - 输出的内容和 JSON.stringify(value, null, space) 相同, 但不会生成整个字符串
+ * - 超过分块大小的长字符串会被分到多个分块中
+ * @param {any} value
+ * @param {StringifyOptions} [options]
+ * @returns {Generator<Uint8Array, void, unknown>}
+ */
+export function* stringifyChunks(value, options) {
+    const writer = new json.Writer(value, options?.space, options?.chunkSize || CHUNK_SIZE);
+
+    try {
+        while (true) {
+            const chunk = writer.read();
+            if (!chunk) {
+                break;
+            }
+
+            yield chunk;
+        }
+
+    } finally {
+        writer.close();
+    }
+}
+
+/**
+ * 返回一个按需序列化的流, 每次读取时才生成下一个分块
+ * @param {any} value
+ * @param {StringifyOptions} [options]
+ * @returns {ReadableStream<Uint8Array>}
+ */
+export function stringifyStream(value, options) {
+    const writer = new json.Writer(value, options?.space, options?.chunkSize || CHUNK_SIZE);
+
+    return streams.createReadableStream({
+        async pull(controller) {
+            try {
+                const chunk = writer.read();
+                if (chunk) {
+                    controller.enqueue(chunk);
+
+                } else {
+                    controller.close();
+                }
+
+            } catch (err) {
+                writer.close();
+                controller.error(err);
+            }
+        },
+
+        async cancel() {
+            writer.close();
+        }
+    });
+}
+
+/**
+ * 增量解析器
+ * - 根值为数组时, 每收到一个完整的元素就解析并返回这个元素 (记录)
+ * - 根值不是数组时, 在 end() 时返回整个文档的值
+ */
+export class JSONParser {
+    /** @param {ParseOptions} [options] */
+    constructor(options) {
+        this._parser = new json.Parser(options?.maxLength || 0);
+    }
+
+    get [Symbol.toStringTag]() {
+        return 'JSONParser';
+    }
+
+    /**
+     * 写入一块 UTF-8 编码的数据
+     * @param {BufferSource} data
+     * @returns {any[]} 这块数据中完成的记录
+     */
+    write(data) {
+        return this._parser.write(data);
+    }
+
+    /**
+     * 结束解析, 文档不完整时抛出 SyntaxError
+     * @returns {any[]} 剩余的记录
+     */
+    end() {
+        return this._parser.end();
+    }
+}
+
+/**
+ * 从流中逐个读取顶层数组中的记录
+ * @param {ReadableStream<BufferSource>|AsyncIterable<BufferSource>} source
+ * @param {ParseOptions} [options]
+ * @returns {AsyncGenerator<any, void, unknown>}
+ */
+export async function* parseStream(source, options) {
+    const parser = new JSONParser(options);
+
+    if (source instanceof ReadableStream) {
+        const reader = source.getReader();
+        while (true) {
+            const result = await reader.read();
+            if (result.done) {
+                break;
+            }
+
+            yield* parser.write(result.value);
+        }
+
+    } else {
+        for await (const chunk of source) {
+            yield* parser.write(chunk);
+        }
+    }
+
+    yield* parser.end();
+}
@@ -7,9 +7,32 @@ import * as os from '@tjs/os';
 import * as process from '@tjs/process';
 
 import { defineEventAttribute } from '@tjs/event-target';
+import { parseJSON } from '@tjs/util';
 
 const TAG = 'jsonrpc:';
 
+const $textEncoder = new TextEncoder();
+const CRLF = new Uint8Array([0x0d, 0x0a]);
+
+/**
+ * 查找 `\r\n` 的位置
+ * @param {Uint8Array} buffer 
+ * @param {number} offset 开始查找的位置
+ * @returns {number} 没有找到则返回 -1
+ */
+function findCRLF(buffer, offset) {
+    let pos = buffer.indexOf(0x0d, offset);
+    while (pos >= 0 && pos + 1 < buffer.byteLength) {
+        if (buffer[pos + 1] == 0x0a) {
+            return pos;
+        }
+
+        pos = buffer.indexOf(0x0d, pos + 1);
+    }
+
+    return -1;
+}
+
 /**
  * @typedef JsonrpcResponse
  * @property {number=} id
@@ -125,7 +148,7 @@ export class JsonrpcSession extends EventTarget {
         /** @type number 下一次请求的 ID */
         this._nextRequestId = 1;
 
-        /** @type {string=} 读缓存区 */
+        /** @type {Uint8Array=} 读缓存区 */
         this._readBuffer = undefined;
 
         /** @type {Map<number, JsonrpcQueueRequest>} 已经发送但还未收到应答的请求 */
@@ -404,13 +427,13 @@ export class JsonrpcSession extends EventTarget {
 
     /**
      * 处理收到的消息
-     * @param {string} data 
+     * @param {string|Uint8Array} data 消息内容，可以是字符串或 UTF-8 编码的字节
      */
     processMessage(data) {
         this.updated = Date.now();
 
         try {
-            const message = JSON.parse(data);
+            const message = (typeof data == 'string') ? JSON.parse(data) : parseJSON(data);
             if (!message) {
                 return;
             }
@@ -539,8 +562,14 @@ export class JsonrpcSession extends EventTarget {
             return;
         }
 
-        let packet = JSON.stringify(message);
-        packet = packet.length.toString(16) + '\r\n' + packet + '\r\n';
+        // 消息长度按 UTF-8 字节数计算
+        const body = $textEncoder.encode(JSON.stringify(message));
+        const header = $textEncoder.encode(body.byteLength.toString(16) + '\r\n');
+
+        const packet = new Uint8Array(header.byteLength + body.byteLength + 2);
+        packet.set(header, 0);
+        packet.set(body, header.byteLength);
+        packet.set(CRLF, header.byteLength + body.byteLength);
         await socket.write(packet);
     }
 
@@ -743,36 +772,48 @@ export class JsonrpcSession extends EventTarget {
      * @param {ArrayBufferLike} data 
      */
     _onSocketData(data) {
-        const textDecoder = new TextDecoder();
-        this._readBuffer = (this._readBuffer || '') + textDecoder.decode(data);
+        const chunk = new Uint8Array(data);
+        let buffer = this._readBuffer;
+        if (buffer && buffer.byteLength) {
+            const merged = new Uint8Array(buffer.byteLength + chunk.byteLength);
+            merged.set(buffer, 0);
+            merged.set(chunk, buffer.byteLength);
+            buffer = merged;
 
-        while (this._readBuffer && this._readBuffer.length) {
-            const buffer = this._readBuffer;
+        } else {
+            buffer = chunk;
+        }
 
-            if (buffer.length > JsonrpcClient.MAX_MESSAGE_SIZE) {
-                this._readBuffer = '';
+        let offset = 0;
+        while (offset < buffer.byteLength) {
+            if (buffer.byteLength - offset > JsonrpcClient.MAX_MESSAGE_SIZE) {
+                this._readBuffer = undefined;
                 return;
             }
 
-            // 16 进制数字字符串表示的消息长度，如：3130\r\n 表示长度 10
-            const pos = buffer.indexOf('\r\n');
-            if (!(pos >= 0)) {
-                return;
+            // 16 进制数字字符串表示的消息长度 (字节数)，如：3130\r\n 表示长度 10
+            const pos = findCRLF(buffer, offset);
+            if (pos < 0) {
+                break;
             }
 
-            const value = buffer.substring(0, pos);
+            const value = String.fromCharCode(...buffer.subarray(offset, Math.min(pos, offset + 16)));
             const size = Number.parseInt(value, 16);
-            const chunkSize = pos + size + 4;
-            if (buffer.length < chunkSize) {
+            const start = pos + 2;
+            const end = start + size;
+            if (!(size >= 0) || pos - offset > 16) {
+                this._readBuffer = undefined;
                 return;
-            }
 
-            const offset = pos + 2;
-            const message = buffer.substring(offset, offset + size);
-            this._readBuffer = buffer.substring(chunkSize);
+            } else if (buffer.byteLength < end + 2) {
+                break;
+            }
 
-            this.processMessage(message);
+            offset = end + 2;
+            this.processMessage(buffer.subarray(start, end));
         }
+
+        this._readBuffer = (offset < buffer.byteLength) ? buffer.slice(offset) : undefined;
     }
 
     /**
@@ -24,15 +24,24 @@ export const SYSLOG_LEVELS = {
 };
 
 const $context = {
+    /** 是否同时打印到控制台 */
+    echo: false,
+
     options: {
         /** 进程名，syslog 输出时会用到 */
         name: 'tjs',
 
-        /** 输出级别，暂时没有用到 */
+        /** 输出级别，低于这个级别的日志在格式化之前就被过滤 */
         level: 'debug',
 
-        /** 输出方式，支持 console 和 syslog */
-        type: 'console'
+        /** 输出方式，支持 console, syslog 和 file */
+        type: 'console',
+
+        /** 日志文件名，输出方式为 file 时有效 */
+        filename: undefined,
+
+        /** 日志缓冲区最多可以缓存的日志条数 */
+        capacity: undefined
     }
 };
 
@@ -42,41 +51,140 @@ export const syslog = {
 };
 
 /**
- * 输出日志信息到 syslog
+ * 异步日志缓冲区
+ * - 日志先写入固定大小的环形缓冲区，由后台线程批量写入控制台, stderr, 文件或 syslog
+ * - 缓冲区满时直接丢弃日志并计数，不会阻塞事件循环
+ */
+export const logger = native.logger;
+
+/**
+ * 输出日志信息到异步日志缓冲区
+ * - 只有在日志会被输出时才格式化参数
  * @param {string} level 日志级别: `d`,`l`,`i`,`w`,`e`,`a`
  * @param {string} line 源代码行号信息
  * @param  {...any} args 
  */
 export function printSyslog(level, line, ...args) {
+    const syslogLevel = SYSLOG_LEVELS[level] ?? 7;
+    if (!logger.accept(syslogLevel)) {
+        return true;
+    }
+
     const message = console.inspect(false, ...args);
-    const syslogLevel = SYSLOG_LEVELS[level] || 7;
-    // console.print('printSyslog:', syslogLevel, message, line);
-    native.syslog(syslogLevel, message);
+    if ($context.echo) {
+        // 在终端中运行时同时打印到控制台, 复用格式化后的消息
+        // @ts-ignore
+        logger.write(syslogLevel, message, console.formatConsole(level, line, message));
+
+    } else {
+        logger.write(syslogLevel, message);
+    }
 
-    // @ts-ignore
-    console.printConsole(level, line, ...args);
     return true;
 }
 
+/**
+ * 通过异步日志缓冲区打印日志到控制台
+ * @param {string} level 日志级别: `d`,`l`,`i`,`w`,`e`,`a`
+ * @param {string} line 源代码行号信息
+ * @param  {...any} args 
+ */
+export function printConsole(level, line, ...args) {
+    const syslogLevel = SYSLOG_LEVELS[level] ?? 7;
+    if (logger.accept(syslogLevel)) {
+        // @ts-ignore
+        logger.write(syslogLevel, console.formatConsole(level, line, console.inspect(true, ...args)));
+    }
+
+    return true;
+}
+
+function getLevel() {
+    return SYSLOG_LEVELS[$context.options.level] ?? 7;
+}
+
 /**
  * 启用 syslog
  * - 将 console 日志重定向到 syslog
  */
 export function openSyslog() {
-    native.openlog($context.options.name);
+    const options = $context.options;
+    $context.echo = native.isatty(1);
+
+    logger.open({
+        level: getLevel(),
+        sinks: logger.SINK_SYSLOG | ($context.echo ? logger.SINK_CONSOLE : 0),
+        capacity: options.capacity,
+        ident: options.name
+    });
+
+    // @ts-ignore 只有打印到控制台时才需要源代码行号
+    window.console.fileLine = $context.echo;
 
     // @ts-ignore 注入 syslog 到 console 对象
     window.console.onPrintLog = printSyslog;
 }
 
-export function openConsole() {
+/**
+ * 启用日志文件
+ * - 将 console 日志重定向到指定的文件
+ */
+export function openFile() {
+    const options = $context.options;
+    logger.open({
+        level: getLevel(),
+        sinks: logger.SINK_FILE,
+        capacity: options.capacity,
+        filename: options.filename
+    });
+
+    $context.echo = false;
+
+    // @ts-ignore
+    window.console.fileLine = false;
+
     // @ts-ignore 注入 syslog 到 console 对象
-    window.console.onPrintLog = console.printConsole;
+    window.console.onPrintLog = printSyslog;
+}
+
+/**
+ * 启用控制台
+ * - console 日志经过异步日志缓冲区打印到控制台
+ */
+export function openConsole() {
+    const options = $context.options;
+    logger.open({
+        level: getLevel(),
+        sinks: logger.SINK_CONSOLE,
+        capacity: options.capacity
+    });
+
+    $context.echo = false;
+
+    // @ts-ignore
+    window.console.fileLine = true;
+
+    // @ts-ignore 注入到 console 对象
+    window.console.onPrintLog = printConsole;
+}
+
+/**
+ * 等待缓冲区中的日志都写入完成
+ */
+export function flush() {
+    logger.flush();
+}
+
+/**
+ * 返回日志缓冲区的统计信息
+ */
+export function stats() {
+    return logger.stats();
 }
 
 /** 
  * 配置日志输出
- * - 支持输出日志信息到 console 或 syslog
+ * - 支持输出日志信息到 console, syslog 或文件
  * - 当输出到 syslog 时可指定进程名称
  * @param {any} config 
  */
@@ -85,24 +193,40 @@ export function config(config) {
         return { ...$context.options };
     }
 
+    const options = $context.options;
     if (config.name) {
-        $context.options.name = config.name;
+        options.name = config.name;
     }
 
     if (config.level) {
-        $context.options.level = config.level;
+        options.level = config.level;
     }
 
     if (config.type) {
-        $context.options.type = config.type;
+        options.type = config.type;
     }
 
-    if ($context.options.type == 'syslog') {
+    if (config.filename) {
+        options.filename = config.filename;
+    }
+
+    if (config.capacity) {
+        options.capacity = config.capacity;
+    }
+
+    const level = getLevel();
+    // @ts-ignore
+    window.console.level = level;
+
+    if (options.type == 'syslog') {
         openSyslog();
 
-    } else if ($context.options.type == 'console') {
+    } else if (options.type == 'file') {
+        openFile();
+
+    } else if (options.type == 'console') {
         openConsole();
     }
 
-    return { ...$context.options };
+    return { ...options };
 }
@@ -3,13 +3,18 @@
 /// <reference path ="./index.d.ts" />
 import * as native from '@tjs/native';
 import * as dns from '@tjs/dns';
+import * as fs from '@tjs/fs';
+import * as path from '@tjs/path';
 import * as tls from '@tjs/tls';
 import { defineEventAttribute } from '@tjs/event-target';
 
 /**
+ * @typedef {import('@tjs/mqtt').MQTTBrokerListenOptions} MQTTBrokerListenOptions
+ * @typedef {import('@tjs/mqtt').MQTTBrokerOptions} MQTTBrokerOptions
  * @typedef {import('@tjs/mqtt').MQTTClient} BaseClient
  * @typedef {import('@tjs/mqtt').MQTTClientOptions} MQTTClientOptions
  * @typedef {import('@tjs/mqtt').MQTTPublishOptions} MQTTPublishOptions
+ * @typedef {import('@tjs/mqtt').MQTTQueueOptions} MQTTQueueOptions
  * @typedef {(error?:Error, result?:any) => void} PromiseCallback
  */
 
@@ -17,22 +22,48 @@ const mqtt = native.mqtt;
 
 const TAG = 'mqtt:';
 
+const encodeUTF8 = native.utf8.encode;
+const decodeUTF8 = native.utf8.decode;
+const crc32 = native.zlib.crc32;
+
 // ////////////////////////////////////////////////////////////
 // MQTT Store
 
+/** 内存缓存默认最多保存的消息数 */
+const STORE_LIMIT = 100;
+
+/**
+ * 内存中的离线消息缓存
+ */
 export class MQTTStore {
     /**
-     * @param {any=} options 
+     * @param {{ limit?: number }=} options 
      */
     constructor(options) {
         this._options = { ...options };
 
         /** @type MQTTRequest[] */
         this._sendQueue = [];
+
+        /** @type number 最后一次 read() 返回的消息数 */
+        this._readCount = 0;
     }
 
     clear() {
         this._sendQueue.splice(0);
+        this._readCount = 0;
+    }
+
+    async close() {
+        this.clear();
+    }
+
+    /**
+     * 删除最后一次 read() 返回的消息
+     */
+    async commit() {
+        this._sendQueue.splice(0, this._readCount);
+        this._readCount = 0;
     }
 
     pop() {
@@ -44,13 +75,744 @@ export class MQTTStore {
      */
     put(packet) {
         const sendQueue = this._sendQueue;
+        if (sendQueue.length > (this._options.limit || STORE_LIMIT)) {
+            throw new Error('Request cache store is full.');
+        }
+
         sendQueue.push(packet);
     }
 
-    size() {
-        return this._sendQueue.length;
+    /**
+     * 读取最早的几个消息, 调用 commit() 后才会删除
+     * @param {number} max 
+     * @returns {Promise<MQTTRequest[]>}
+     */
+    async read(max) {
+        const messages = this._sendQueue.slice(0, max);
+        this._readCount = messages.length;
+        return messages;
+    }
+
+    size() {
+        return this._sendQueue.length;
+    }
+}
+
+// ////////////////////////////////////////////////////////////
+// MQTT Disk Store
+
+/** 记录头: 消息体长度 (4 字节) + 消息体的 CRC32 (4 字节), 小端 */
+const RECORD_HEADER_SIZE = 8;
+
+/** 消息体头: 标志 (1 字节) + 保留 (1 字节) + 主题长度 (2 字节) */
+const RECORD_BODY_HEADER_SIZE = 4;
+
+/** 超过这个长度的记录被认为已损坏 */
+const RECORD_MAX_SIZE = 64 * 1024 * 1024;
+
+const RECORD_FLAG_QOS = 0x03;
+const RECORD_FLAG_RETAIN = 0x04;
+const RECORD_FLAG_STRING = 0x08;
+
+/** 每次读取段文件的数据块大小 */
+const SEGMENT_BLOCK_SIZE = 64 * 1024;
+
+const SEGMENT_SUFFIX = '.seg';
+
+/** 保存已确认位置的文件 */
+const CURSOR_FILENAME = 'cursor.json';
+
+/** 等待写入的数据超过这个大小时立即写入 */
+const FLUSH_SIZE = 256 * 1024;
+
+/** 保存已确认位置的间隔 (毫秒) */
+const CURSOR_SAVE_INTERVAL = 1000;
+
+/**
+ * @typedef MQTTQueueSegment
+ * @property {number} id 序号, 也是文件名
+ * @property {number} size 有效数据的字节数
+ * @property {number} count 还没有确认的消息数
+ */
+
+/**
+ * @typedef MQTTQueueCursor
+ * @property {number} id 段序号
+ * @property {number} offset 段内的位置
+ */
+
+/**
+ * 编码一条记录
+ * @param {MQTTRequest} message
+ * @returns {Uint8Array}
+ */
+function encodeRecord(message) {
+    const topic = encodeUTF8(message.topic || '');
+    const payload = message.payload;
+    const isString = typeof payload == 'string';
+
+    let data;
+    if (isString) {
+        data = encodeUTF8(payload);
+
+    } else if (ArrayBuffer.isView(payload)) {
+        data = new Uint8Array(payload.buffer, payload.byteOffset, payload.byteLength);
+
+    } else {
+        data = new Uint8Array(payload || 0);
+    }
+
+    const bodyLength = RECORD_BODY_HEADER_SIZE + topic.length + data.length;
+    const record = new Uint8Array(RECORD_HEADER_SIZE + bodyLength);
+    const view = new DataView(record.buffer);
+
+    let flags = (message.qos || 0) & RECORD_FLAG_QOS;
+    if (message.retained) {
+        flags |= RECORD_FLAG_RETAIN;
+    }
+
+    if (isString) {
+        flags |= RECORD_FLAG_STRING;
+    }
+
+    view.setUint8(RECORD_HEADER_SIZE, flags);
+    view.setUint16(RECORD_HEADER_SIZE + 2, topic.length, true);
+    record.set(topic, RECORD_HEADER_SIZE + RECORD_BODY_HEADER_SIZE);
+    record.set(data, RECORD_HEADER_SIZE + RECORD_BODY_HEADER_SIZE + topic.length);
+
+    view.setUint32(0, bodyLength, true);
+    view.setUint32(4, crc32(record, 0, RECORD_HEADER_SIZE, bodyLength), true);
+    return record;
+}
+
+/**
+ * 解码一条记录的消息体
+ * @param {Uint8Array} data
+ * @param {number} offset 消息体开始的位置
+ * @param {number} length 消息体的长度
+ * @returns {MQTTRequest}
+ */
+function decodeRecord(data, offset, length) {
+    const flags = data[offset];
+    const topicLength = data[offset + 2] | (data[offset + 3] << 8);
+    const topicOffset = offset + RECORD_BODY_HEADER_SIZE;
+    const payloadOffset = topicOffset + topicLength;
+    const payloadLength = offset + length - payloadOffset;
+
+    /** @type MQTTRequest */
+    const message = {};
+    message.topic = decodeUTF8(data, topicOffset, topicLength);
+    message.qos = flags & RECORD_FLAG_QOS;
+    message.retained = (flags & RECORD_FLAG_RETAIN) ? 1 : 0;
+    message.payload = (flags & RECORD_FLAG_STRING)
+        ? decodeUTF8(data, payloadOffset, payloadLength)
+        : data.buffer.slice(data.byteOffset + payloadOffset, data.byteOffset + payloadOffset + payloadLength);
+
+    return message;
+}
+
+/**
+ * 检查数据中指定位置的记录
+ * @param {Uint8Array} data
+ * @param {number} offset
+ * @returns {number} 记录的总长度; 数据不完整时返回需要的长度的相反数; 记录无效时返回 0
+ */
+function checkRecord(data, offset) {
+    if (offset + RECORD_HEADER_SIZE > data.length) {
+        return -RECORD_HEADER_SIZE;
+    }
+
+    const view = new DataView(data.buffer, data.byteOffset + offset, RECORD_HEADER_SIZE);
+    const bodyLength = view.getUint32(0, true);
+    if (bodyLength < RECORD_BODY_HEADER_SIZE || bodyLength > RECORD_MAX_SIZE) {
+        return 0;
+    }
+
+    const size = RECORD_HEADER_SIZE + bodyLength;
+    if (offset + size > data.length) {
+        return -size;
+    }
+
+    if (crc32(data, 0, offset + RECORD_HEADER_SIZE, bodyLength) !== view.getUint32(4, true)) {
+        return 0;
+    }
+
+    return size;
+}
+
+/**
+ * 基于磁盘文件的离线消息队列
+ * - 消息以带 CRC32 校验的记录追加到段文件 (`<id>.seg`) 中, 超过 segmentSize 后开始新的段
+ * - 写入由定时器合并批量进行, 每批只同步一次磁盘
+ * - 总大小超过 maxBytes 时丢弃最早的段
+ * - 已确认的位置定时保存在 cursor.json 中, 所有消息都已确认的段会被删除
+ * - 打开时检查所有的段, 丢弃不完整或校验失败的记录
+ */
+export class MQTTDiskStore {
+    /**
+     * @param {MQTTQueueOptions} options 
+     */
+    constructor(options) {
+        if (!options?.path) {
+            throw new TypeError('The queue path is required');
+        }
+
+        this._options = {
+            segmentSize: 1024 * 1024,
+            maxBytes: 64 * 1024 * 1024,
+            flushInterval: 100,
+            fsync: true,
+            ...options
+        };
+
+        /** @type string 队列目录 */
+        this.path = options.path;
+
+        /** @type number 因超过 maxBytes 而被丢弃的消息数 */
+        this.dropped = 0;
+
+        /** @type MQTTQueueSegment[] */
+        this._segments = [];
+
+        /** @type MQTTQueueCursor 已确认的位置 */
+        this._cursor = { id: 0, offset: 0 };
+
+        /** @type boolean 已确认的位置是否还没有保存 */
+        this._cursorChanged = false;
+
+        /** @type any */
+        this._cursorTimer = null;
+
+        /** @type {{ cursor: MQTTQueueCursor, counts: Map<number,number>, count: number } | null} 最后一次 read() 的结果 */
+        this._readResult = null;
+
+        /** @type {{ id: number, file: fs.FileHandle } | null} 读取中的段文件 */
+        this._reader = null;
+
+        /** @type {{ id: number, file: fs.FileHandle } | null} 写入中的段文件 */
+        this._writer = null;
+
+        /** @type number 段文件中还没有确认的消息数 */
+        this._count = 0;
+
+        /** @type number 段文件的总大小 */
+        this._byteLength = 0;
+
+        /** @type Uint8Array[] 等待写入的记录 */
+        this._pending = [];
+        this._pendingSize = 0;
+
+        /** @type number 正在写入的消息数 */
+        this._writingCount = 0;
+
+        /** @type any */
+        this._flushTimer = null;
+
+        /** @type Promise<void> | null */
+        this._flushPromise = null;
+
+        /** @type Promise<void> | null */
+        this._openPromise = null;
+
+        this._closed = false;
+    }
+
+    get [Symbol.toStringTag]() {
+        return 'MQTTDiskStore';
+    }
+
+    /** 段文件的总大小 */
+    get byteLength() {
+        return this._byteLength;
+    }
+
+    /**
+     * 删除所有消息
+     */
+    async clear() {
+        this._pending = [];
+        this._pendingSize = 0;
+
+        await this.flush();
+
+        this._closeFile('_reader');
+        this._closeFile('_writer');
+        this._readResult = null;
+
+        for (const segment of this._segments) {
+            await fs.unlink(this._getFilename(segment.id)).catch(() => {});
+        }
+
+        const last = this._segments[this._segments.length - 1];
+        this._segments = [];
+        this._cursor = { id: last ? last.id + 1 : 0, offset: 0 };
+        this._cursorChanged = true;
+        this._count = 0;
+        this._byteLength = 0;
+
+        await this._saveCursor();
+    }
+
+    /**
+     * 写入所有消息并关闭文件
+     */
+    async close() {
+        if (this._flushTimer) {
+            clearTimeout(this._flushTimer);
+            this._flushTimer = null;
+        }
+
+        await this.flush();
+
+        if (this._cursorTimer) {
+            clearTimeout(this._cursorTimer);
+            this._cursorTimer = null;
+        }
+
+        await this._saveCursor();
+
+        this._closed = true;
+        this._closeFile('_reader');
+        this._closeFile('_writer');
+    }
+
+    /**
+     * 确认最后一次 read() 返回的消息, 这些消息不会再被读取
+     */
+    async commit() {
+        const result = this._readResult;
+        if (!result) {
+            return;
+        }
+
+        this._readResult = null;
+
+        for (const segment of this._segments) {
+            segment.count -= result.counts.get(segment.id) || 0;
+        }
+
+        this._count -= result.count;
+        this._cursor = result.cursor;
+        this._cursorChanged = true;
+
+        // 删除已全部确认的段, 正在写入的段除外
+        const segments = this._segments;
+        while (segments.length > 1) {
+            const segment = segments[0];
+            if (segment.id > this._cursor.id || (segment.id == this._cursor.id && this._cursor.offset < segment.size)) {
+                break;
+            }
+
+            await this._removeSegment(segment);
+            if (this._cursor.id == segment.id) {
+                this._cursor = { id: segments[0].id, offset: 0 };
+            }
+        }
+
+        if (!this._cursorTimer) {
+            this._cursorTimer = setTimeout(() => {
+                this._cursorTimer = null;
+                this._saveCursor();
+            }, CURSOR_SAVE_INTERVAL);
+        }
+    }
+
+    /**
+     * 写入所有等待中的消息
+     * @returns {Promise<void>}
+     */
+    flush() {
+        const previous = this._flushPromise || Promise.resolve();
+        const promise = previous.then(() => this._onFlush());
+        this._flushPromise = promise;
+
+        promise.finally(() => {
+            if (this._flushPromise === promise) {
+                this._flushPromise = null;
+            }
+        });
+
+        return promise;
+    }
+
+    /**
+     * 打开队列目录并检查所有的段
+     * @returns {Promise<void>}
+     */
+    open() {
+        if (!this._openPromise) {
+            this._openPromise = this._onOpen();
+        }
+
+        return this._openPromise;
+    }
+
+    /**
+     * 添加一个消息, 消息会在稍后批量写入
+     * @param {MQTTRequest} message 
+     */
+    put(message) {
+        if (this._closed) {
+            throw new Error('Queue is closed');
+        }
+
+        const record = encodeRecord(message);
+        this._pending.push(record);
+        this._pendingSize += record.length;
+
+        if (this._pendingSize >= FLUSH_SIZE) {
+            this.flush();
+
+        } else if (!this._flushTimer) {
+            this._flushTimer = setTimeout(() => {
+                this._flushTimer = null;
+                this.flush();
+            }, this._options.flushInterval);
+        }
+    }
+
+    /**
+     * 从已确认的位置开始读取消息, 调用 commit() 后才会确认
+     * @param {number} max 最多读取的消息数
+     * @returns {Promise<MQTTRequest[]>}
+     */
+    async read(max) {
+        await this.flush();
+
+        /** @type MQTTRequest[] */
+        const messages = [];
+        const counts = new Map();
+        const segments = this._segments;
+
+        let { id, offset } = this._cursor;
+        let index = segments.findIndex(segment => segment.id == id);
+        if (index < 0 && segments.length > 0) {
+            index = 0;
+            id = segments[0].id;
+            offset = 0;
+        }
+
+        let readSize = SEGMENT_BLOCK_SIZE;
+        while (index >= 0 && index < segments.length && messages.length < max) {
+            const segment = segments[index];
+            if (offset >= segment.size) {
+                if (index == segments.length - 1) {
+                    break;
+                }
+
+                index++;
+                id = segments[index].id;
+                offset = 0;
+                continue;
+            }
+
+            const file = await this._openFile('_reader', id, 'r');
+            const length = Math.min(readSize, segment.size - offset);
+            const data = new Uint8Array(await file.read(length, offset));
+
+            let position = 0;
+            let required = 0;
+            while (messages.length < max) {
+                const size = checkRecord(data, position);
+                if (size < 0 && offset + position - size <= segment.size) {
+                    required = -size;
+                    break;
+
+                } else if (size <= 0) {
+                    // 读取时发现损坏的记录, 丢弃这个段中剩下的数据
+                    console.warn(TAG, `discard invalid data after ${offset + position} in segment ${id}`);
+                    this._count -= segment.count - (counts.get(id) || 0);
+                    this._byteLength -= segment.size - (offset + position);
+                    segment.count = counts.get(id) || 0;
+                    segment.size = offset + position;
+                    break;
+                }
+
+                messages.push(decodeRecord(data, position + RECORD_HEADER_SIZE, size - RECORD_HEADER_SIZE));
+                counts.set(id, (counts.get(id) || 0) + 1);
+                position += size;
+            }
+
+            offset += position;
+            readSize = (position == 0 && required > 0) ? Math.max(SEGMENT_BLOCK_SIZE, required) : SEGMENT_BLOCK_SIZE;
+        }
+
+        this._readResult = { cursor: { id, offset }, counts, count: messages.length };
+        return messages;
+    }
+
+    size() {
+        return this._count + this._writingCount + this._pending.length;
+    }
+
+    /**
+     * @param {'_reader'|'_writer'} name
+     */
+    _closeFile(name) {
+        const current = this[name];
+        if (current) {
+            this[name] = null;
+            current.file.close();
+        }
+    }
+
+    /**
+     * @param {number} id 
+     */
+    _getFilename(id) {
+        return path.join(this.path, String(id).padStart(10, '0') + SEGMENT_SUFFIX);
+    }
+
+    /**
+     * 加载已确认的位置
+     * @returns {Promise<MQTTQueueCursor|undefined>}
+     */
+    async _loadCursor() {
+        try {
+            const text = await fs.readFile(path.join(this.path, CURSOR_FILENAME), 'utf-8');
+            const cursor = JSON.parse(String(text));
+            if (Number.isInteger(cursor?.id) && Number.isInteger(cursor?.offset)) {
+                return cursor;
+            }
+
+        } catch (e) {
+            // 不存在或已损坏
+        }
+    }
+
+    async _onFlush() {
+        await this.open();
+
+        const records = this._pending;
+        if (records.length == 0) {
+            return;
+        }
+
+        this._pending = [];
+        this._pendingSize = 0;
+        this._writingCount = records.length;
+
+        try {
+            let start = 0;
+            while (start < records.length) {
+                const segments = this._segments;
+                let segment = segments[segments.length - 1];
+                if (!segment || segment.size >= this._options.segmentSize) {
+                    segment = { id: segment ? segment.id + 1 : this._cursor.id, size: 0, count: 0 };
+                    segments.push(segment);
+                }
+
+                // 当前段能容纳的记录, 至少一个
+                let end = start;
+                let size = segment.size;
+                do {
+                    size += records[end++].length;
+                } while (end < records.length && size + records[end].length <= this._options.segmentSize);
+
+                await this._writeSegment(segment, records.slice(start, end));
+                start = end;
+            }
+
+        } finally {
+            this._writingCount = 0;
+        }
+
+        await this._trim();
+    }
+
+    async _onOpen() {
+        const dirname = this.path;
+        await fs.mkdir(dirname, { recursive: true });
+
+        const ids = [];
+        for (const entry of await fs.readdir(dirname)) {
+            const name = entry.name;
+            if (name.endsWith(SEGMENT_SUFFIX)) {
+                const id = Number(name.substring(0, name.length - SEGMENT_SUFFIX.length));
+                if (Number.isInteger(id) && id >= 0) {
+                    ids.push(id);
+                }
+            }
+        }
+
+        ids.sort((a, b) => a - b);
+
+        const cursor = await this._loadCursor() || { id: ids[0] || 0, offset: 0 };
+        if (!ids.includes(cursor.id)) {
+            cursor.id = ids.find(id => id > cursor.id) ?? cursor.id;
+            cursor.offset = 0;
+        }
+
+        for (const id of ids) {
+            const filename = this._getFilename(id);
+            if (id < cursor.id) {
+                // 已全部确认的段
+                await fs.unlink(filename).catch(() => {});
+                continue;
+            }
+
+            const start = (id == cursor.id) ? cursor.offset : 0;
+            const segment = await this._scanSegment(id, start);
+            this._segments.push(segment);
+            this._count += segment.count;
+            this._byteLength += segment.size;
+        }
+
+        if (cursor.offset > (this._segments[0]?.size || 0)) {
+            cursor.offset = 0;
+        }
+
+        this._cursor = cursor;
+    }
+
+    /**
+     * @param {'_reader'|'_writer'} name
+     * @param {number} id 
+     * @param {string} flags 
+     * @returns {Promise<fs.FileHandle>}
+     */
+    async _openFile(name, id, flags) {
+        const current = this[name];
+        if (current && current.id == id) {
+            return current.file;
+        }
+
+        this._closeFile(name);
+
+        const file = await fs.open(this._getFilename(id), flags);
+        this[name] = { id, file };
+        return file;
+    }
+
+    /**
+     * @param {MQTTQueueSegment} segment 
+     */
+    async _removeSegment(segment) {
+        const index = this._segments.indexOf(segment);
+        if (index >= 0) {
+            this._segments.splice(index, 1);
+        }
+
+        if (this._reader?.id == segment.id) {
+            this._closeFile('_reader');
+        }
+
+        this._count -= segment.count;
+        this._byteLength -= segment.size;
+        await fs.unlink(this._getFilename(segment.id)).catch(() => {});
+    }
+
+    async _saveCursor() {
+        if (!this._cursorChanged) {
+            return;
+        }
+
+        this._cursorChanged = false;
+        try {
+            const filename = path.join(this.path, CURSOR_FILENAME);
+            await fs.writeFile(filename, JSON.stringify(this._cursor), { atomic: true });
+
+        } catch (e) {
+            this._cursorChanged = true;
+        }
+    }
+
+    /**
+     * 检查段文件中的所有记录, 截断不完整或校验失败的数据
+     * @param {number} id 
+     * @param {number} start 开始检查的位置
+     * @returns {Promise<MQTTQueueSegment>}
+     */
+    async _scanSegment(id, start) {
+        const file = await fs.open(this._getFilename(id), 'r+');
+
+        try {
+            const fileSize = (await file.stat()).size;
+            const segment = { id, size: fileSize, count: 0 };
+
+            let position = Math.min(start, fileSize);
+            let readSize = SEGMENT_BLOCK_SIZE;
+            while (position < fileSize) {
+                const length = Math.min(readSize, fileSize - position);
+                const data = new Uint8Array(await file.read(length, position));
+
+                let offset = 0;
+                let size = 0;
+                while ((size = checkRecord(data, offset)) > 0) {
+                    segment.count++;
+                    offset += size;
+                }
+
+                if (size < 0 && position + data.length < fileSize) {
+                    // 记录跨越了读取的范围, 从记录开始的位置重新读取
+                    position += offset;
+                    readSize = Math.max(SEGMENT_BLOCK_SIZE, -size);
+                    continue;
+                }
+
+                if (size < 0 && offset == data.length) {
+                    position += offset;
+                    continue;
+                }
+
+                // 无效或不完整的数据
+                console.warn(TAG, `discard invalid data after ${position + offset} in segment ${id}`);
+                await file.truncate(position + offset);
+                segment.size = position + offset;
+                break;
+            }
+
+            return segment;
+
+        } finally {
+            await file.close();
+        }
+    }
+
+    /**
+     * 追加记录到指定的段
+     * @param {MQTTQueueSegment} segment 
+     * @param {Uint8Array[]} records 
+     */
+    async _writeSegment(segment, records) {
+        const file = await this._openFile('_writer', segment.id, 'a');
+
+        // writev 最多可以使用 1024 个缓存区
+        let size = 0;
+        for (let i = 0; i < records.length; i += 1024) {
+            size += await file.writev(records.slice(i, i + 1024));
+        }
+
+        if (this._options.fsync) {
+            await file.sync();
+        }
+
+        segment.size += size;
+        segment.count += records.length;
+        this._count += records.length;
+        this._byteLength += size;
+        this._writingCount -= records.length;
     }
 
+    /**
+     * 总大小超过 maxBytes 时丢弃最早的段
+     */
+    async _trim() {
+        const segments = this._segments;
+        while (this._byteLength > this._options.maxBytes && segments.length > 1) {
+            const segment = segments[0];
+            this.dropped += segment.count;
+            await this._removeSegment(segment);
+
+            if (this._cursor.id <= segment.id) {
+                this._cursor = { id: segments[0].id, offset: 0 };
+                this._cursorChanged = true;
+            }
+
+            // 正在读取的消息已被丢弃
+            this._readResult = null;
+        }
+    }
 }
 
 // ////////////////////////////////////////////////////////////
@@ -102,6 +864,12 @@ export const ERRORS = {
     162: 'Wildcard Subscriptions not supported'
 };
 
+/** MQTT 5 协议版本号 */
+const MQTT5 = 5;
+
+/** MQTT 5: 没有属性的消息 */
+const EMPTY_PROPERTIES = Object.freeze({});
+
 /**
  * @param {any} value
  * @return {number}
@@ -137,7 +905,7 @@ export class MQTTClient extends EventTarget {
         /** @type number 当前连接状态 */
         this.readyState = MQTTClient.INIT;
 
-        /** @type {MQTTStore=} 用来在断网时缓存 QoS 为 0 的消息 */
+        /** @type {MQTTStore|MQTTDiskStore|undefined} 用来在断网时缓存消息 */
         this._cacheStore = undefined;
 
         /** @type any */
@@ -146,8 +914,17 @@ export class MQTTClient extends EventTarget {
         /** @type number 最后一次重连时间 */
         this._lastConnectTime = 0;
 
-        /** @type number 最后一次分配的消息 ID */
-        this._lastMessageId = 0;
+        /** @type number 当前开启的合并写入的层数, 大于 0 时不会自动发送 */
+        this._corked = 0;
+
+        /** @type number 正在等待确认的 QoS 1/2 消息数 */
+        this._inflight = 0;
+
+        /** @type {Map<number, string>} MQTT 5: 服务端使用的主题别名 */
+        this._incomingAliases = new Map();
+
+        /** @type {{resolve: () => void, reject: (error: Error) => void}[]} 等待发送窗口的消息 */
+        this._inflightWaiters = [];
 
         /** @type number 最后一次发送 PING 消息的时间 */
         this._lastPingTime = 0;
@@ -164,6 +941,12 @@ export class MQTTClient extends EventTarget {
         /** @type Object<string,PromiseCallback> */
         this._outgoingPromises = {};
 
+        /** @type native.mqtt.PacketIds 分配消息 ID, 跳过还没有确认的 ID */
+        this._packetIds = new mqtt.PacketIds();
+
+        /** @type {{promise: Promise<void>, resolve: () => void, reject: (error: Error) => void}=} 下一次发送 */
+        this._pendingWrite = undefined;
+
         this._readyPromise = {
             /** @type {boolean} */
             pending: false,
@@ -172,10 +955,16 @@ export class MQTTClient extends EventTarget {
             promise: undefined
         };
 
+        /** @type number MQTT 5: 服务端同时处理的 QoS 1/2 消息数 */
+        this._receiveMaximum = 65535;
+
+        /** @type {Promise<void>|undefined} 正在重发缓存的消息 */
+        this._replayPromise = undefined;
+
         /** @type number 连接重试次数 */
         this._retryCount = 0;
 
-        /** @type native.TCP | native.TLS | undefined */
+        /** @type native.TCP | native.TLS | native.Pipe | undefined */
         this._socket = undefined;
 
         /** @type any */
@@ -184,12 +973,23 @@ export class MQTTClient extends EventTarget {
             reconnectPeriod: 0
         };
 
+        /** @type number|undefined MQTT 5: 服务端指定的保活时间 */
+        this._serverKeepAlive = undefined;
+
         /** @type {{[key: string]: number}} 记录订阅的主题，重连后可自动重新订阅 */
         this._subscribeTopics = {};
 
+        /** @type {Map<string, {topicAlias: number}>} MQTT 5: 已分配的主题别名, 只在当前连接中有效 */
+        this._topicAliases = new Map();
+
+        /** @type number MQTT 5: 服务端允许使用的主题别名数 */
+        this._topicAliasMaximum = 0;
+
         /** @type string MQTT 服务器地址 */
         this.url = '';
 
+        /** @type native.mqtt.Writer 合并同一轮事件循环中要发送的消息 */
+        this._writer = new mqtt.Writer();
     }
 
     get [Symbol.toStringTag]() {
@@ -222,6 +1022,10 @@ export class MQTTClient extends EventTarget {
             callback(error);
         }
 
+        for (const waiter of this._inflightWaiters.splice(0)) {
+            waiter.reject(new Error('Client is closed'));
+        }
+
         // parser
         const mqttParser = this._mqttParser;
         if (mqttParser) {
@@ -244,11 +1048,11 @@ export class MQTTClient extends EventTarget {
             this.dispatchEvent(event);
         }
 
-        // Clear cache
+        // Close cache
         const cacheStore = this._cacheStore;
         if (cacheStore) {
             this._cacheStore = undefined;
-            cacheStore.clear();
+            await cacheStore.close();
         }
 
         // 关闭重连定时器
@@ -300,7 +1104,10 @@ export class MQTTClient extends EventTarget {
             const options = self._options;
 
             let socket = null;
-            if (options.secure) {
+            if (options.path) {
+                socket = new native.Pipe();
+
+            } else if (options.secure) {
                 socket = new native.TLS({ cacert: tls.rootCertificates.join('') });
 
             } else {
@@ -334,10 +1141,16 @@ export class MQTTClient extends EventTarget {
             // const connectTimeout = options.connectTimeout || 10 * 1000;
 
             do {
-                // 1. lookup
-                const address = await lookup(host);
-                if (address == null) {
-                    break;
+                // 1. lookup, 指定了 path 时使用 Unix 域套接字
+                /** @type any */
+                let address = options.path;
+                if (!address) {
+                    address = await lookup(host);
+                    if (address == null) {
+                        break;
+                    }
+
+                    address.port = options.port || (options.secure ? 8883 : 1883);
                 }
 
                 // 2. create socket
@@ -345,7 +1158,6 @@ export class MQTTClient extends EventTarget {
 
                 // 3. connect
                 // console.log('connect:', address);
-                address.port = options.port || (options.secure ? 8883 : 1883);
                 await socket.connect(address);
                 if (this.readyState != MQTTClient.CONNECTING) {
                     break; // 如果连接被取消了
@@ -416,6 +1228,9 @@ export class MQTTClient extends EventTarget {
 
         } else if (type == mqtt.PUBLISH) {
             this.handleMessage(packet);
+
+        } else if (type == mqtt.DISCONNECT) {
+            this.handleDisconnect(packet);
         }
     }
 
@@ -436,12 +1251,46 @@ export class MQTTClient extends EventTarget {
         return this._statInfo;
     }
 
+    /**
+     * 收到服务端发送的 Disconnect 消息 (MQTT 5)
+     * @param {MQTTPacket} message 
+     */
+    handleDisconnect(message) {
+        const reasonCode = message.reasonCode || 0;
+        if (reasonCode >= 0x80) {
+            const error = new Error('Disconnected by server: ' + reasonCode);
+            error.code = reasonCode;
+            this._onError(error);
+        }
+
+        this._onSocketClose();
+    }
+
     /**
      * 处理收到的 Publish 消息
+     * - MQTT 5: 将主题别名替换为相应的主题
      * @param {MQTTPacket} message 
      */
     handleMessage(message) {
-        this.dispatchEvent(new MessageEvent('message', { data: message }));
+        const alias = message.properties?.topicAlias;
+        if (alias) {
+            if (message.topic) {
+                this._incomingAliases.set(alias, message.topic);
+
+            } else {
+                message.topic = this._incomingAliases.get(alias);
+                if (!message.topic) {
+                    const error = new Error('Topic Alias invalid: ' + alias);
+                    error.code = 0x94;
+                    this._onError(error);
+                    return;
+                }
+            }
+        }
+
+        if (this.hasEventListener('message')) {
+            this.dispatchEvent(new MessageEvent('message', { data: message }));
+        }
     }
 
     /**
@@ -470,6 +1319,12 @@ export class MQTTClient extends EventTarget {
         this._lastPingTime = now;
         this._lastPongTime = now;
 
+        // MQTT 5: 服务端的限制
+        const properties = conack.properties;
+        this._receiveMaximum = properties?.receiveMaximum || 65535;
+        this._serverKeepAlive = properties?.serverKeepAlive;
+        this._topicAliasMaximum = properties?.topicAliasMaximum || 0;
+
         // 连接成功
         this._resolvePromise('connect', conack);
     }
@@ -490,7 +1345,16 @@ export class MQTTClient extends EventTarget {
         // console.log('mqtt:', '_onPublishAck:', message);
         // @ts-ignore
         const pid = message.packetId || 0;
-        this._resolvePromise('publish:' + pid, message);
+
+        // MQTT 5: 大于等于 0x80 的原因码表示发布失败
+        let error;
+        const reasonCode = message.reasonCode || 0;
+        if (reasonCode >= 0x80) {
+            error = new Error('Publish rejected: ' + reasonCode);
+            error.code = reasonCode;
+        }
+
+        this._resolvePromise('publish:' + pid, message, error);
     }
 
     /**
@@ -527,14 +1391,23 @@ export class MQTTClient extends EventTarget {
             return;
         }
 
-        this._cacheStore = new MQTTStore();
-
         if (url) {
             this.setURL(url);
         }
 
         this.setOptions(options || {});
 
+        const queue = this._options.queue;
+        if (queue?.path) {
+            // 断网时缓存到磁盘
+            const cacheStore = new MQTTDiskStore(queue);
+            cacheStore.open().catch(error => this._onError(error));
+            this._cacheStore = cacheStore;
+
+        } else {
+            this._cacheStore = new MQTTStore();
+        }
+
         this.startParser();
         this.startTimer();
 
@@ -554,16 +1427,10 @@ export class MQTTClient extends EventTarget {
         message.topic = topic;
         message.payload = payload;
         message.qos = (message.qos || 0) >>> 0;
-        message.pid = this._getNextMessageId();
-
-        if (this.readyState != MQTTClient.OPEN) {
-            // 断网时，缓存到队列
-            const cacheStore = this._cacheStore;
-            if (cacheStore && cacheStore.size() > 100) {
-                throw new Error('Request cache store is full.');
-            }
 
-            cacheStore?.put(message);
+        if (this.readyState != MQTTClient.OPEN || this._replayPromise) {
+            // 断网或正在重发缓存的消息时，缓存到队列以保持消息的顺序
+            this._cacheStore?.put(message);
             return true;
 
         } else {
@@ -639,25 +1506,106 @@ export class MQTTClient extends EventTarget {
     }
 
     /**
-     * 返回下一个消息 ID
+     * 等待 QoS 1/2 消息的发送窗口
+     * @returns {Promise<void>|undefined}
+     */
+    _acquireInflight() {
+        const maxInflight = Math.min(this._options.maxInflight || 16, this._receiveMaximum);
+        if (this._inflight < maxInflight) {
+            this._inflight++;
+            return;
+        }
+
+        return new Promise((resolve, reject) => {
+            this._inflightWaiters.push({ resolve, reject });
+        });
+    }
+
+    /**
+     * 发送缓存区中所有等待发送的消息
+     */
+    _flushWrites() {
+        const pendingWrite = this._pendingWrite;
+        if (!pendingWrite || this._corked > 0) {
+            return;
+        }
+
+        this._pendingWrite = undefined;
+
+        const data = this._writer.flush();
+        const socket = this._socket;
+        if (!data || !socket) {
+            pendingWrite.resolve();
+            return;
+        }
+
+        socket.write(data).then(pendingWrite.resolve, pendingWrite.reject);
+    }
+
+    /**
+     * 是否使用 MQTT 5 协议
+     */
+    _isMQTT5() {
+        return this._options.protocolVersion == MQTT5;
+    }
+
+    /**
+     * 返回下一个消息 ID, 使用完后需要调用 `_packetIds.release()` 释放
      * @return {number} 1~65535
      */
     _getNextMessageId() {
-        this._lastMessageId++;
-        const nextMessageId = this._lastMessageId;
-        if (this._lastMessageId >= 65536) {
-            this._lastMessageId = 1;
+        const pid = this._packetIds.alloc();
+        if (!pid) {
+            throw new Error('No packet id available');
+        }
+
+        return pid;
+    }
+
+    /**
+     * 释放 QoS 1/2 消息的发送窗口, 直接转给下一个等待的消息
+     */
+    _releaseInflight() {
+        const waiter = this._inflightWaiters.shift();
+        if (waiter) {
+            waiter.resolve();
+
+        } else {
+            this._inflight--;
+        }
+    }
+
+    /**
+     * 在下一个微任务中发送缓存区中的所有消息
+     * @returns {Promise<void>} 数据被写入 Socket 后完成
+     */
+    _scheduleWrite() {
+        let pendingWrite = this._pendingWrite;
+        if (!pendingWrite) {
+            /** @type any */
+            const callbacks = {};
+            const promise = new Promise((resolve, reject) => {
+                callbacks.resolve = resolve;
+                callbacks.reject = reject;
+            });
+
+            pendingWrite = { promise, ...callbacks };
+            this._pendingWrite = pendingWrite;
+
+            if (this._corked == 0) {
+                Promise.resolve().then(() => this._flushWrites());
+            }
         }
 
-        return nextMessageId;
+        return pendingWrite.promise;
     }
 
     async _onCheckKeepAlive() {
         const now = Date.now();
         const options = this._options;
 
-        // Keep alive
-        const keepAlive = options.keepalive != null ? options.keepalive : 60;
+        // Keep alive, MQTT 5 服务端可以指定保活时间
+        const keepAlive = this._serverKeepAlive ?? (options.keepalive != null ? options.keepalive : 60);
         if (keepAlive > 0) {
             const lastPongTime = this._lastPongTime || 0;
             const lastPingTime = this._lastPingTime || 0;
@@ -705,6 +1653,10 @@ export class MQTTClient extends EventTarget {
      */
     async _onCheckTimer() {
         if (this.readyState == MQTTClient.OPEN) {
+            if (this._cacheStore?.size()) {
+                this._replayStore();
+            }
+
             await this._onCheckKeepAlive();
 
         } else if (this.readyState == MQTTClient.CONNECTING) {
@@ -761,14 +1713,63 @@ export class MQTTClient extends EventTarget {
         }
 
         // 发送缓存的消息
-        const cacheStore = this._cacheStore;
-        while (this.readyState == MQTTClient.OPEN) {
-            const message = cacheStore?.pop();
-            if (!message) {
-                break;
+        await this._replayStore();
+    }
+
+    /**
+     * 重发缓存的消息
+     * - 每次最多同时发送 maxInflight 个消息, 全部确认后才从缓存中删除
+     * - 发送速度不超过 queue.replayRate 个消息每秒
+     * @returns {Promise<void>}
+     */
+    _replayStore() {
+        if (!this._replayPromise) {
+            this._replayPromise = this._onReplayStore().finally(() => {
+                this._replayPromise = undefined;
+            });
+        }
+
+        return this._replayPromise;
+    }
+
+    async _onReplayStore() {
+        const options = this._options;
+        const maxInflight = options.maxInflight || 16;
+        const replayRate = options.queue?.replayRate || 1000;
+
+        try {
+            while (this.readyState == MQTTClient.OPEN) {
+                const cacheStore = this._cacheStore;
+                const messages = await cacheStore?.read(maxInflight);
+                if (!cacheStore || !messages?.length) {
+                    break;
+                }
+
+                const startTime = Date.now();
+                await Promise.all(messages.map(message => {
+                    return this.sendPublish(message);
+                }));
+
+                await cacheStore.commit();
+
+                const delay = messages.length * 1000 / replayRate - (Date.now() - startTime);
+                if (delay > 0) {
+                    await new Promise(resolve => setTimeout(resolve, delay));
+                }
             }
 
-            await this.sendPublish(message);
+        } catch (error) {
+            // 未确认的消息留在缓存中, 稍后重发
+            this._onError(error);
+        }
+    }
+
+    /**
+     * 每发送一个消息时调用
+     */
+    _onPacketSend() {
+        if (this.hasEventListener('packetsend')) {
+            this.dispatchEvent(new Event('packetsend'));
         }
     }
 
@@ -776,6 +1777,9 @@ export class MQTTClient extends EventTarget {
      * 主动或被动关闭相关的 Socket, 并释放相应的资源
      */
     _onSocketClose() {
+        // 丢弃还没有发送的数据
+        this._writer.reset();
+
         const socket = this._socket;
         if (socket) {
             this._socket = undefined;
@@ -869,8 +1873,26 @@ export class MQTTClient extends EventTarget {
     async sendConnect() {
         const connectTimeout = this._options.connectTimeout || 10 * 1000;
 
+        // 主题别名只在一个连接中有效
+        this._incomingAliases.clear();
+        this._topicAliases.clear();
+        this._topicAliasMaximum = 0;
+        this._receiveMaximum = 65535;
+        this._serverKeepAlive = undefined;
+
         // console.log(TAG, '_sendConnectMessage:');
-        const options = this._options;
+        let options = this._options;
+        if (this._isMQTT5()) {
+            const properties = {
+                ...options.properties,
+                sessionExpiryInterval: options.sessionExpiryInterval,
+                receiveMaximum: options.receiveMaximum,
+                topicAliasMaximum: options.topicAliasMaximum
+            };
+
+            options = { ...options, properties };
+        }
+
         const message = mqtt.encodeConnect(options);
         await this.write(message);
 
@@ -902,7 +1924,8 @@ export class MQTTClient extends EventTarget {
 
     /**
      * 发送 Publish 消息
-     * - 如果 QoS 为 1 及以上，将等到 PUBACK 或者超时才返回
+     * - 消息直接编码到发送缓存区中, 同一轮事件循环中的消息会合并发送
+     * - 如果 QoS 为 1 及以上，最多同时有 maxInflight 个消息等待确认, 将等到 PUBACK 或者超时才返回
      * @param {MQTTRequest} message 要发送的消息
      * @returns {Promise<MQTTPacket|undefined>}
      */
@@ -912,19 +1935,73 @@ export class MQTTClient extends EventTarget {
             return;
         }
 
-        const payload = message.payload;
+        const qos = message.qos || 0;
+        if (qos < 1) {
+            this._writePublish(message, 0);
+            this._onPacketSend();
+            await this._scheduleWrite();
+            return;
+        }
+
+        await this._acquireInflight();
+
+        let pid = 0;
+        try {
+            pid = this._getNextMessageId();
+            this._writePublish(message, pid);
+            this._onPacketSend();
+
+            // 先注册再发送, 以免在写入完成前就收到了 PUBACK
+            const timeout = 2000;
+            const type = 'publish:' + pid;
+            const promise = this._createPromise(type, timeout);
+            await this._scheduleWrite().catch(error => this._resolvePromise(type, undefined, error));
+            return await promise;
+
+        } finally {
+            this._packetIds.release(pid);
+            this._releaseInflight();
+        }
+    }
+
+    /**
+     * 编码 Publish 消息到发送缓存区中
+     * - MQTT 5: 自动分配主题别名, 同一个主题第一次发送时同时发送主题和别名, 之后只发送别名
+     * - 别名用完后新的主题不再分配别名
+     * @param {MQTTRequest} message
+     * @param {number} pid
+     */
+    _writePublish(message, pid) {
+        const payload = message.payload ?? '';
         const dup = message.dup || 0;
         const qos = message.qos || 0;
         const retained = message.retained || 0;
-        const pid = message.pid || 0;
 
-        const packet = mqtt.encodePublish(topic, payload, dup, qos, retained, pid);
-        await this.write(packet);
+        let topic = message.topic || '';
+        if (!this._isMQTT5()) {
+            this._writer.publish(topic, payload, dup, qos, retained, pid);
+            return;
+        }
 
-        if (qos >= 1) {
-            const timeout = 2000;
-            return this._createPromise('publish:' + pid, timeout);
+        let properties = message.properties || EMPTY_PROPERTIES;
+        const aliases = this._topicAliases;
+        let alias = aliases.get(topic);
+        if (alias) {
+            topic = '';
+
+        } else if (aliases.size < this._topicAliasMaximum && this._options.topicAlias !== false) {
+            // 编码成功后才记录新的别名
+            alias = { topicAlias: aliases.size + 1 };
+            this._writer.publish(topic, payload, dup, qos, retained, pid, { ...properties, ...alias });
+            aliases.set(topic, alias);
+            return;
         }
+
+        if (alias) {
+            properties = (properties == EMPTY_PROPERTIES) ? alias : { ...properties, ...alias };
+        }
+
+        this._writer.publish(topic, payload, dup, qos, retained, pid, properties);
     }
 
     /**
@@ -956,6 +2033,11 @@ export class MQTTClient extends EventTarget {
             options.host = '127.0.0.1';
         }
 
+        // path
+        if (params?.path != null) {
+            options.path = params.path;
+        }
+
         // port
         if (params?.port != null) {
             options.port = parseInt(params.port);
@@ -1037,11 +2119,51 @@ export class MQTTClient extends EventTarget {
         if (params?.secure != null) {
             options.secure = params.secure;
         }
+
+        // maxInflight
+        if (params?.maxInflight != null) {
+            options.maxInflight = parseInt(params.maxInflight);
+        }
+
+        const maxInflight = options.maxInflight;
+        if (!maxInflight || isNaN(maxInflight)) {
+            options.maxInflight = 16;
+        }
+
+        // queue
+        if (params?.queue != null) {
+            options.queue = params.queue;
+        }
+
+        // MQTT 5
+        if (params?.protocolVersion != null) {
+            options.protocolVersion = parseInt(params.protocolVersion);
+        }
+
+        if (params?.sessionExpiryInterval != null) {
+            options.sessionExpiryInterval = parseInt(params.sessionExpiryInterval);
+        }
+
+        if (params?.receiveMaximum != null) {
+            options.receiveMaximum = parseInt(params.receiveMaximum);
+        }
+
+        if (params?.topicAliasMaximum != null) {
+            options.topicAliasMaximum = parseInt(params.topicAliasMaximum);
+        }
+
+        if (params?.topicAlias != null) {
+            options.topicAlias = params.topicAlias;
+        }
+
+        if (params?.properties != null) {
+            options.properties = params.properties;
+        }
     }
 
     /**
      * 当创建了新的 Socket
-     * @param {native.TCP|native.TLS} socket 
+     * @param {native.TCP|native.TLS|native.Pipe} socket 
      */
     setSocket(socket) {
         this._socket = socket;
@@ -1091,7 +2213,7 @@ export class MQTTClient extends EventTarget {
             return;
         }
 
-        const mqttParser = new mqtt.Parser();
+        const mqttParser = new mqtt.Parser({ protocolVersion: this._options.protocolVersion });
         mqttParser.onmessage = async (message) => {
             try {
                 await this.dispatchPacket(message);
@@ -1131,14 +2253,19 @@ export class MQTTClient extends EventTarget {
 
         const dup = options?.dup || 0;
         const pid = this._getNextMessageId();
-        const packet = mqtt.encodeSubscribe(topic, dup, pid);
-        // console.log('mqtt:', 'subscribe:', topic);
+        try {
+            const properties = this._isMQTT5() ? EMPTY_PROPERTIES : undefined;
+            const packet = mqtt.encodeSubscribe(topic, dup, pid, properties);
+            // console.log('mqtt:', 'subscribe:', topic);
 
-        await this.write(packet);
+            await this.write(packet);
 
-        const timeout = 2000;
-        const promise = this._createPromise('subscribe:' + pid, timeout);
-        return promise;
+            const timeout = 2000;
+            return await this._createPromise('subscribe:' + pid, timeout);
+
+        } finally {
+            this._packetIds.release(pid);
+        }
     }
 
     /**
@@ -1160,23 +2287,54 @@ export class MQTTClient extends EventTarget {
 
         const dup = options?.dup || 0;
         const pid = this._getNextMessageId();
-        const packet = mqtt.encodeUnsubscribe(topic, dup, pid);
+        try {
+            const properties = this._isMQTT5() ? EMPTY_PROPERTIES : undefined;
+            const packet = mqtt.encodeUnsubscribe(topic, dup, pid, properties);
 
-        await this.write(packet);
+            await this.write(packet);
 
-        const timeout = 2000;
-        const promise = this._createPromise('unsubscribe:' + pid, timeout);
-        return promise;
+            const timeout = 2000;
+            return await this._createPromise('unsubscribe:' + pid, timeout);
+
+        } finally {
+            this._packetIds.release(pid);
+        }
+    }
+
+    /**
+     * 开始合并写入, 之后的消息会先保存在发送缓存区中, 直到调用 uncork() 才一起发送
+     * - 可以嵌套调用, 需要调用相同次数的 uncork()
+     */
+    cork() {
+        this._corked++;
+    }
+
+    /**
+     * 结束合并写入, 并发送缓存区中所有的消息
+     * @returns {Promise<void>}
+     */
+    async uncork() {
+        if (this._corked > 0) {
+            this._corked--;
+        }
+
+        const pendingWrite = this._pendingWrite;
+        if (this._corked == 0 && pendingWrite) {
+            this._flushWrites();
+            await pendingWrite.promise;
+        }
     }
 
     /**
      * 发送指定的消息
+     * - 同一轮事件循环中的消息会合并为一次写入
      * @param {ArrayBuffer} packet 
+     * @returns {Promise<void>}
      */
     async write(packet) {
-        // console.log('_sendMessage', message);
-        this.dispatchEvent(new Event('packetsend'));
-        await this._socket?.write(packet);
+        this._writer.write(packet);
+        this._onPacketSend();
+        await this._scheduleWrite();
     }
 }
 
@@ -1208,6 +2366,129 @@ defineEventAttribute(MQTTClient.prototype, 'open');
 defineEventAttribute(MQTTClient.prototype, 'packetreceive');
 defineEventAttribute(MQTTClient.prototype, 'packetsend');
 
+// ////////////////////////////////////////////////////////////
+// MQTT Broker
+
+/**
+ * 内嵌的 MQTT 服务器, 用于本机进程之间交换消息
+ * - 连接管理, 消息解析, 主题匹配和转发都在原生层完成, 不经过 JS
+ * - 支持 QoS 0/1 和保留消息, 只支持 clean session
+ * - 同一个消息只编码一次, 所有订阅者共享同一个缓存区
+ * - 可以同时侦听 TCP 地址和 Unix 域套接字
+ */
+export class MQTTBroker extends EventTarget {
+    /**
+     * @param {MQTTBrokerOptions=} options 
+     */
+    constructor(options) {
+        super();
+
+        /** @type MQTTBrokerOptions */
+        this.options = options || {};
+
+        /** @type {native.mqtt.Broker=} */
+        this._broker = undefined;
+    }
+
+    get [Symbol.toStringTag]() {
+        return 'MQTTBroker';
+    }
+
+    /**
+     * 返回第一个侦听的地址
+     * @returns {native.SocketAddress|string|undefined}
+     */
+    address() {
+        return this._broker?.addresses()[0];
+    }
+
+    /**
+     * 返回所有侦听的地址, Unix 域套接字为路径
+     * @returns {(native.SocketAddress|string)[]}
+     */
+    addresses() {
+        return this._broker?.addresses() || [];
+    }
+
+    /**
+     * 停止侦听并关闭所有连接
+     */
+    close() {
+        const broker = this._broker;
+        if (broker) {
+            this._broker = undefined;
+
+            broker.onerror = undefined;
+            broker.close();
+        }
+
+        this.removeAllEventListeners();
+    }
+
+    /**
+     * 开始侦听, 可以多次调用以同时侦听多个地址
+     * @param {MQTTBrokerListenOptions} options `path` 为 Unix 域套接字的路径, 否则侦听 `host:port`
+     * @returns {this}
+     */
+    listen(options) {
+        let broker = this._broker;
+        if (!broker) {
+            broker = new mqtt.Broker(this.options);
+            broker.onerror = (error) => {
+                this.dispatchEvent(new ErrorEvent('error', { error }));
+            };
+
+            this._broker = broker;
+        }
+
+        const backlog = options.backlog || 511;
+        if (options.path) {
+            broker.listen(options.path, backlog);
+
+        } else {
+            const address = { address: options.host || '0.0.0.0', port: options.port ?? 1883 };
+            const flags = options.reusePort ? native.TCP.REUSEPORT : 0;
+            broker.listen(address, backlog, flags);
+        }
+
+        return this;
+    }
+
+    /**
+     * 在本进程内直接发布一个消息
+     * @param {string} topic 
+     * @param {string|ArrayBuffer|ArrayBufferView} payload 
+     * @param {MQTTPublishOptions=} options 
+     * @returns {number} 发送的订阅者数量
+     */
+    publish(topic, payload, options) {
+        const broker = this._broker;
+        if (!broker) {
+            throw new Error('The broker is not listening');
+        }
+
+        return broker.publish(topic, payload ?? '', options?.qos || 0, !!options?.retained);
+    }
+
+    /**
+     * @returns {native.mqtt.BrokerStats|undefined}
+     */
+    stats() {
+        return this._broker?.stats();
+    }
+}
+
+defineEventAttribute(MQTTBroker.prototype, 'error');
+
+/**
+ * 创建一个内嵌的 MQTT 服务器
+ * @param {MQTTBrokerOptions=} options 
+ * @returns {MQTTBroker}
+ */
+export function createBroker(options) {
+    return new MQTTBroker(options);
+}
+
 // ////////////////////////////////////////////////////////////
 // MQTT
 
@@ -2,12 +2,16 @@
 /// <reference path ="../../types/index.d.ts" />
 import * as native from '@tjs/native';
 import * as dns from '@tjs/dns';
+import * as streams from '@tjs/streams';
 import { defineEventAttribute } from '@tjs/event-target';
 
 /** @typedef {import("@tjs/net").SocketAddress} SocketAddress */
 
 /* global MessageEvent Event ErrorEvent */
 
+/** `Socket.readable` 默认的高水位线, 队列中未读取的数据超过这个值时暂停从连接读取数据 */
+const SOCKET_HIGH_WATER_MARK = 64 * 1024;
+
 // ////////////////////////////////////////////////////////////
 // Socket
 
@@ -19,6 +23,21 @@ export class Socket extends EventTarget {
     /** @type {native.TCP|native.Pipe=} */
     #handle = undefined;
 
+    /** @type {boolean} 连接是否已关闭 */
+    #isClosed = false;
+
+    /** @type {boolean} 是否已暂停读取 */
+    #paused = false;
+
+    /** @type {ReadableStream<Uint8Array>=} */
+    #readable = undefined;
+
+    /** @type {ReadableStreamDefaultController<Uint8Array>=} */
+    #readController = undefined;
+
+    /** @type {WritableStream<any>=} */
+    #writable = undefined;
+
     /** @param {any} [options] */
     constructor(options) {
         super();
@@ -53,6 +72,60 @@ export class Socket extends EventTarget {
         return this.readyState == Socket.CONNECTING;
     }
 
+    /**
+     * 以字节流的方式读取这个连接收到的数据
+     * - 未读取的数据超过高水位线时暂停从连接读取数据, 直到数据被读取
+     * @returns {ReadableStream<Uint8Array>}
+     */
+    get readable() {
+        if (!this.#readable) {
+            this.#readable = new streams.ReadableStream({
+                type: 'bytes',
+                start: (controller) => {
+                    this.#readController = controller;
+                },
+                pull: () => {
+                    this.resume();
+                },
+                cancel: () => {
+                    this.#readController = undefined;
+                    this.close();
+                }
+            }, { highWaterMark: SOCKET_HIGH_WATER_MARK });
+
+            if (this.#isClosed) {
+                this.#readController?.close();
+                this.#readController = undefined;
+            }
+        }
+
+        // @ts-ignore
+        return this.#readable;
+    }
+
+    /**
+     * 以流的方式向这个连接写数据
+     * - 每次写入都会等待前一次写入完成
+     * @returns {WritableStream<any>}
+     */
+    get writable() {
+        if (!this.#writable) {
+            this.#writable = new streams.WritableStream({
+                write: (chunk) => {
+                    if (this.#isClosed) {
+                        throw new Error('Socket is closed');
+                    }
+
+                    return this.write(chunk);
+                },
+                close: () => this.shutdown()
+            });
+        }
+
+        // @ts-ignore
+        return this.#writable;
+    }
+
     /** 
      * @param {number|string|Object<string,any>} port 
      * @param {string=} host 
@@ -153,6 +226,30 @@ export class Socket extends EventTarget {
         return this.#handle?.address();
     }
 
+    /**
+     * 暂停从连接读取数据
+     */
+    pause() {
+        if (!this.#paused) {
+            this.#paused = true;
+            this.#handle?.pause();
+        }
+
+        return this;
+    }
+
+    /**
+     * 恢复从连接读取数据
+     */
+    resume() {
+        if (this.#paused) {
+            this.#paused = false;
+            this.#handle?.resume();
+        }
+
+        return this;
+    }
+
     /** 主动关闭这个连接 */
     close() {
         this.#onClose();
@@ -238,6 +335,7 @@ export class Socket extends EventTarget {
      */
     #onClose() {
         this.connected = undefined;
+        this.#isClosed = true;
 
         if (this.readyState != Socket.CLOSED) {
             this.readyState = Socket.CLOSED;
@@ -254,6 +352,12 @@ export class Socket extends EventTarget {
             handle.onconnect = undefined;
             handle.close();
         }
+
+        const readController = this.#readController;
+        if (readController) {
+            this.#readController = undefined;
+            readController.close();
+        }
     }
 
     /**
@@ -271,6 +375,8 @@ export class Socket extends EventTarget {
         }
 
         this.#handle = handle;
+        this.#isClosed = false;
+        this.#paused = false;
 
         handle.onerror = (error) => {
             this.#onError(error);
@@ -282,9 +388,21 @@ export class Socket extends EventTarget {
 
             } else {
                 this.bytesRead += message.byteLength;
+
+                const readController = this.#readController;
+                if (readController) {
+                    readController.enqueue(new Uint8Array(message));
+
+                    // 队列已满, 暂停读取直到数据被读取
+                    if ((readController.desiredSize || 0) <= 0) {
+                        this.pause();
+                    }
+                }
             }
 
-            this.dispatchEvent(new MessageEvent('message', { data: message }));
+            if (this.hasEventListener('message')) {
+                this.dispatchEvent(new MessageEvent('message', { data: message }));
+            }
         };
     }
 }
@@ -353,7 +471,9 @@ export class Server extends EventTarget {
 
     /**
      * Start a server listening for connections.
-     * @param {string|SocketAddress} options 
+     * - `options.reusePort`: 设置 SO_REUSEPORT, 允许多个进程侦听同一个端口
+     * - 也可以是一个已绑定的 TCP 句柄, 比如 `cluster.bind()` 返回的句柄
+     * @param {string|SocketAddress|native.TCP} options 
      * @param {number=} backlog 
      */
     listen(options, backlog) {
@@ -368,10 +488,15 @@ export class Server extends EventTarget {
                 handle.bind(name);
                 this.#handle = handle;
 
+            } else if (Object.prototype.toString.call(options) == '[object TCP]') {
+                // native.TCP 没有 prototype 属性, 不能使用 instanceof
+                this.#handle = /** @type native.TCP */ (options);
+
             } else {
                 const address = options;
+                const flags = address.reusePort ? native.TCP.REUSEPORT : 0;
                 const handle = new native.TCP();
-                handle.bind(address);
+                handle.bind(address, flags);
                 this.#handle = handle;
             }
 
@@ -449,7 +574,7 @@ export class UDPSocket extends EventTarget {
 
     /**
      * 
-     * @param {{ port?: number, address?: string }} address 
+     * @param {{ port?: number, address?: string, reusePort?: boolean }} address 
      * @param {number|undefined} flags 
      */
     bind(address, flags) {
@@ -463,6 +588,10 @@ export class UDPSocket extends EventTarget {
             flags = undefined;
         }
 
+        if (options?.reusePort) {
+            flags = (flags || 0) | native.UDP.REUSEPORT;
+        }
+
         const handle = this.#handle;
         handle?.bind(options, flags);
 
@@ -524,6 +653,10 @@ export class UDPSocket extends EventTarget {
         }
 
         handle.onmessage = (message) => {
+            if (!this.hasEventListener('message')) {
+                return;
+            }
+
             const event = new MessageEvent('message', { data: message.data });
             // @ts-ignore
             event.address = message.address;
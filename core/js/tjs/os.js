@@ -3,7 +3,6 @@
 import * as native from '@tjs/native';
 
 const os = native.os;
-const utf8 = native.utf8;
 
 // const
 export const arch = native.arch;
@@ -135,8 +134,9 @@ export async function execFile(file, args, options) {
 
 /**
  * 执行一个命令并获取执行结果
+ * 在本地收集输出, 进程结束并且输出都读完后才返回
  * @param {string|string[]} command 要执行的命令
- * @param {native.SpawnOptions} [options]
+ * @param {native.ExecOptions} [options]
  * @returns {Promise<native.ProcessResult>} 返回这个命令输出的内容
  */
 export async function exec(command, options) {
@@ -144,57 +144,8 @@ export async function exec(command, options) {
         command = command.split(' ');
     }
 
-    options = Object.assign({}, options);
-    if (!options.stdout) {
-        options.stdout = 'pipe';
-    }
-
-    if (!options.stderr) {
-        options.stderr = 'pipe';
-    }
-
     try {
-        // console.log('exec', command);
-        const subprocess = native.spawn(command, options);
-
-        const stdout = [];
-        const stderr = [];
-
-        if (subprocess.stdout) {
-            subprocess.stdout.onmessage = (data) => {
-                if (data != null) {
-                    stdout.push(utf8.decode(data));
-                }
-            };
-        }
-
-        if (subprocess.stderr) {
-            subprocess.stderr.onmessage = (data) => {
-                if (data != null) {
-                    stderr.push(utf8.decode(data));
-                }
-            };
-        }
-
-        const result = await subprocess.wait();
-
-        if (subprocess.stdout) {
-            subprocess.stdout.onmessage = undefined;
-        }
-
-        if (subprocess.stderr) {
-            subprocess.stderr.onmessage = undefined;
-        }
-
-        if (stdout.length) {
-            result.stdout = stdout.join('');
-        }
-
-        if (stderr.length) {
-            result.stderr = stderr.join('');
-        }
-
-        return result;
+        return await native.exec(command, options);
 
     } catch (err) {
         return { code: -1, stderr: err.message, error: err };
@@ -1452,3 +1452,4 @@ export const format = p.format;
 export const isAbsolute = p.isAbsolute;
 export const join = p.join;
 export const parse = p.parse;
+export const relative = p.relative;
@@ -87,6 +87,100 @@ class Performance {
             this._entries.splice(this._entries.indexOf(entry), 1);
         }
     }
+
+    /**
+     * 开始 CPU 采样
+     * - 采样线程按指定的间隔请求采样, 由 QuickJS 在执行 JS 代码时记录当前的调用栈
+     * - 采样数超过 maxSamples 时覆盖最早的采样
+     * @param {{ interval?: number, maxSamples?: number }} [options] interval 为采样间隔 (微秒)
+     */
+    startProfiling(options) {
+        native.profiler.start(options?.interval || 0, options?.maxSamples || 0);
+    }
+
+    /**
+     * 停止 CPU 采样
+     * - 'cpuprofile': 返回 Chrome DevTools 的 .cpuprofile 格式的对象 (默认)
+     * - 'collapsed': 返回折叠的调用栈文本, 可以用 flamegraph.pl 等工具生成火焰图
+     * @param {{ format?: 'cpuprofile' | 'collapsed' }} [options]
+     */
+    stopProfiling(options) {
+        const profile = native.profiler.stop();
+        if (!profile) {
+            return undefined;
+
+        } else if (options?.format === 'collapsed') {
+            return toCollapsedStacks(profile);
+        }
+
+        return profile;
+    }
+
+    get isProfiling() {
+        return native.profiler.isProfiling();
+    }
+
+    /**
+     * 内存使用情况
+     * - usedJSHeapSize, totalJSHeapSize, jsHeapSizeLimit: 和浏览器的 performance.memory 相同
+     * - classes: 各个类的对象数和字节数
+     * - native: 流, 定时器, TLS, 缓存区等原生对象的数量和字节数
+     */
+    get memory() {
+        const statistics = native.heap.getStatistics();
+        return {
+            usedJSHeapSize: statistics.memoryUsedSize,
+            totalJSHeapSize: statistics.mallocSize,
+            jsHeapSizeLimit: statistics.mallocLimit < 0 ? Infinity : statistics.mallocLimit,
+            ...statistics
+        };
+    }
+
+    /**
+     * 生成 Chrome DevTools 格式的堆快照
+     * - 在当前线程执行一次 GC 并遍历所有对象, 在线程池中写入文件
+     * @param {string} [filename] 默认为当前目录下的 Heap.<date>.<time>.<pid>.heapsnapshot
+     * @returns {Promise<string>} 快照文件名
+     */
+    heapSnapshot(filename) {
+        return native.heap.writeSnapshot(filename);
+    }
+}
+
+/**
+ * 生成折叠的调用栈, 每行为 `root;caller;callee count`
+ */
+function toCollapsedStacks(profile) {
+    const names = [];
+    const parents = [];
+    for (const node of profile.nodes) {
+        const frame = node.callFrame;
+        let name = frame.functionName || '(anonymous)';
+        if (frame.url) {
+            name += ' (' + frame.url + (frame.lineNumber >= 0 ? ':' + (frame.lineNumber + 1) : '') + ')';
+        }
+
+        names[node.id] = name.replace(/;/g, ',');
+        for (const child of node.children) {
+            parents[child] = node.id;
+        }
+    }
+
+    const lines = [];
+    for (const node of profile.nodes) {
+        if (!node.hitCount) {
+            continue;
+        }
+
+        const stack = [];
+        for (let id = node.id; id; id = parents[id]) {
+            stack.push(names[id]);
+        }
+
+        lines.push(stack.reverse().join(';') + ' ' + node.hitCount);
+    }
+
+    return lines.join('\n');
 }
 
 function hrtimeMs() {
@@ -60,6 +60,21 @@ export const signal = native.signal;
 export const title = native.os.processTitle;
 export const unsetenv = native.unsetenv;
 
+/**
+ * 执行一个命令, 返回它的退出状态和输出
+ * 输出在本地缓存区中收集 (或按行分割), 超时后先发送 killSignal, 再发送 SIGKILL
+ * @param {string|string[]} command 要执行的命令
+ * @param {native.ExecOptions} [options]
+ * @returns {Promise<native.ExecResult>}
+ */
+export function exec(command, options) {
+    if (typeof command == 'string') {
+        command = command.split(' ');
+    }
+
+    return native.exec(command, options);
+}
+
 /** @param {number} code */
 export function exit(code) {
     if (code == null) {
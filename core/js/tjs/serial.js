@@ -294,7 +294,9 @@ export class SerialPort extends EventTarget {
         }
 
         handle.onmessage = (data) => {
-            this.dispatchEvent(new MessageEvent('message', { data }));
+            if (this.hasEventListener('message')) {
+                this.dispatchEvent(new MessageEvent('message', { data }));
+            }
         };
 
         handle.onclose = () => {
@@ -2,6 +2,7 @@
 /// <reference path ="../../types/index.d.ts" />
 import { Event } from '@tjs/event-target';
 import * as fs from '@tjs/fs';
+import * as native from '@tjs/native';
 import * as path from '@tjs/path';
 import * as os from '@tjs/os';
 import * as process from '@tjs/process';
@@ -22,10 +23,96 @@ export class StorageEvent extends Event {
     }
 }
 
-export const STORAGE_LIMIT = 1024 * 640;
+/** 超过这个长度的值不常驻内存, 只在读取时从文件加载 */
+const INLINE_VALUE_SIZE = 256;
+
+/** 无效数据超过这个大小, 并且超过文件大小的一半时开始压缩 */
+const COMPACT_MIN_SIZE = 64 * 1024;
+
+/** 打开或压缩文件时每次读写的数据块大小 */
+const BLOCK_SIZE = 64 * 1024;
+
+/** 删除标记 */
+const REMOVED_VALUE = 'X';
+
+const CHAR_BLOCK = 0x23; // '#'
+const CHAR_LEGACY = 0x24; // '$'
+const CHAR_COMMA = 0x2c;
+const CHAR_EQUAL = 0x3d;
+const CHAR_LF = 0x0a;
+
+const encodeUTF8 = native.utf8.encode;
+const decodeUTF8 = native.utf8.decode;
+const parseJSON = native.utf8.parseJSON;
+const crc32 = native.zlib.crc32;
+
+/**
+ * 不常驻内存的值在文件中的位置
+ * @typedef StorageRecord
+ * @property {number} offset 值在文件中的位置
+ * @property {number} length 值的字节数
+ * @property {number} size 整条记录的字节数
+ */
+
+/**
+ * 记录占用的字节数 (对于常驻内存的值, 非 ASCII 字符时是估计值)
+ * @param {string} key
+ * @param {string | StorageRecord} value
+ */
+function recordSize(key, value) {
+    if (typeof value == 'string') {
+        return key.length + value.length + 2;
+    }
+
+    return value.size;
+}
+
+/**
+ * 生成一个数据块
+ * - 格式为 `#<crc32>,<length>\n<records>`, 每条记录为 `<key>=<value>\n`
+ * - 每次写入都是一个完整的数据块, 打开时丢弃不完整或校验失败的数据块
+ * @param {string} text 所有记录
+ * @returns {{ data: Uint8Array, bodyOffset: number }}
+ */
+function encodeBlock(text) {
+    const body = encodeUTF8(text);
+    const crc = crc32(body).toString(16).padStart(8, '0');
+    const header = encodeUTF8(`#${crc},${body.length}\n`);
+
+    const data = new Uint8Array(header.length + body.length);
+    data.set(header, 0);
+    data.set(body, header.length);
+    return { data, bodyOffset: header.length };
+}
+
+/**
+ * 找出数据块中不常驻内存的值在文件中的位置
+ * @param {Uint8Array} data 数据块
+ * @param {number} bodyOffset 记录开始的位置
+ * @param {number} fileOffset 数据块在文件中的位置
+ * @param {(string|null)[]} largeKeys 按记录顺序排列, 只有不常驻内存的值才有键名
+ * @param {(key: string, record: StorageRecord) => void} callback
+ */
+function locateValues(data, bodyOffset, fileOffset, largeKeys, callback) {
+    let position = bodyOffset;
+    for (const key of largeKeys) {
+        const end = data.indexOf(CHAR_LF, position);
+        if (key != null) {
+            const equal = data.indexOf(CHAR_EQUAL, position);
+            const offset = fileOffset + equal + 1;
+            callback(key, { offset, length: end - equal - 1, size: end + 1 - position });
+        }
+
+        position = end + 1;
+    }
+}
 
 /**
  * 文件 Key-Value 存储
+ * - 日志结构: 所有修改都以数据块的形式追加到文件末尾, 每个数据块带 CRC32 校验值
+ * - 小的值常驻内存, 大的值只保存在文件中的位置, 读取时才加载
+ * - 修改会合并在一起, 由定时器批量写入并同步到磁盘
+ * - 无效数据过多时在后台压缩文件
  */
 export class FileStorage {
     /**
@@ -38,22 +125,28 @@ export class FileStorage {
         /** @type string | null */
         this.filename = filename;
 
-        /** @type number */
+        /** @type number 文件大小 */
         this.fileSize = 0;
 
-        /** @type number */
+        /** @type number 文件中的记录数 */
         this.lineCount = 0;
 
-        /** @type string[] */
-        this.queue = [];
+        /** @type number 文件中无效记录的字节数 */
+        this.deadSize = 0;
+
+        /** @type Map<string,string|null> 等待写入的值, null 表示删除 */
+        this.queue = new Map();
+
+        /** @type boolean 是否需要先清空文件 */
+        this.truncatePending = false;
 
         /** @type any */
         this.flushTimer = null;
 
-        /** @type any */
+        /** @type Promise<void> | null */
         this.flushPromise = null;
 
-        /** @type Map<string,any> */
+        /** @type Map<string,string|StorageRecord> 值 (JSON 格式) 或值在文件中的位置 */
         this.values = new Map();
     }
 
@@ -62,7 +155,7 @@ export class FileStorage {
     }
 
     get length() {
-        return this.lineCount;
+        return this.values.size;
     }
 
     get size() {
@@ -73,13 +166,13 @@ export class FileStorage {
      * 关闭
      */
     async close() {
-        const promise = this.flushPromise;
-        if (promise) {
-            await promise;
-        } else {
-            await this.onFlush();
+        if (this.flushTimer) {
+            clearTimeout(this.flushTimer);
+            this.flushTimer = null;
         }
 
+        await this.flush();
+
         const file = this.file;
         if (file) {
             this.file = undefined;
@@ -90,36 +183,69 @@ export class FileStorage {
         this.values = new Map();
         this.lineCount = 0;
         this.fileSize = 0;
+        this.deadSize = 0;
     }
 
     clear() {
         this.values = new Map();
-        this.lineCount = 0;
-        this.fileSize = 0;
+        this.queue = new Map();
+        this.truncatePending = true;
 
-        this.enqueue('');
+        this.scheduleFlush();
     }
 
     /**
-     * 
-     * @param {string} line 
+     * @param {string} key
+     * @param {string|null} value 
      */
-    enqueue(line) {
-        this.queue.push(line);
+    enqueue(key, value) {
+        const queue = this.queue;
+        const values = this.values;
 
+        // 已写入文件的旧值成为无效数据
+        const previous = values.get(key);
+        if (previous != null && !queue.has(key)) {
+            this.deadSize += recordSize(key, previous);
+        }
+
+        if (value == null) {
+            values.delete(key);
+
+        } else {
+            values.set(key, value);
+        }
+
+        queue.set(key, value);
+        this.scheduleFlush();
+    }
+
+    scheduleFlush() {
         if (this.flushTimer) {
             return;
         }
 
         this.flushTimer = setTimeout(() => {
             this.flushTimer = null;
+            this.flush();
+        }, 100);
+    }
 
-            if (this.flushPromise) {
-                return;
+    /**
+     * 写入所有等待中的修改
+     * @returns {Promise<void>}
+     */
+    flush() {
+        const previous = this.flushPromise || Promise.resolve();
+        const promise = previous.then(() => this.onFlush());
+        this.flushPromise = promise;
+
+        promise.finally(() => {
+            if (this.flushPromise === promise) {
+                this.flushPromise = null;
             }
+        });
 
-            this.flushPromise = this.onFlush();
-        }, 100);
+        return promise;
     }
 
     /**
@@ -129,14 +255,39 @@ export class FileStorage {
      */
     getItem(key) {
         const value = this.values.get(key);
+        if (value == null) {
+            return null;
+        }
+
         try {
-            return JSON.parse(value);
+            return (typeof value == 'string') ? JSON.parse(value) : parseJSON(this.readValue(value));
 
         } catch (e) {
             return null;
         }
     }
 
+    /**
+     * 从文件中读取不常驻内存的值
+     * - getItem() 是同步的 Web Storage 接口, 所以只能同步读取; 每次只读取一个值
+     *   (打开和压缩文件时都使用异步读取)
+     * @param {StorageRecord} record
+     * @returns {ArrayBuffer} UTF-8 编码的 JSON 数据
+     */
+    readValue(record) {
+        const file = this.file;
+        if (file == null) {
+            throw new Error('Storage is not open');
+        }
+
+        const data = file.readSync(record.length, record.offset);
+        if (data.byteLength != record.length) {
+            throw new Error('Invalid storage record');
+        }
+
+        return data;
+    }
+
     /**
      * 打开
      */
@@ -165,76 +316,166 @@ export class FileStorage {
             return;
         }
 
-        // console.log(statInfo);
         this.file = file;
         this.fileSize = statInfo.size;
+        this.lineCount = 0;
+        this.deadSize = 0;
 
-        if (statInfo.size <= 0) {
-            return;
+        if (statInfo.size > 0) {
+            await this.load(file, statInfo.size);
         }
+    }
 
-        const textDecoder = new TextDecoder();
-        const data = await this.file.read(statInfo.size, 0);
-        const text = textDecoder.decode(data);
+    /**
+     * 读取并重放整个日志文件
+     * - 遇到不完整或校验失败的数据块时, 丢弃它和它之后的所有数据
+     * @param {fs.FileHandle} file
+     * @param {number} fileSize
+     */
+    async load(file, fileSize) {
+        let position = 0;
+        let readSize = BLOCK_SIZE;
+
+        while (position < fileSize) {
+            const length = Math.min(readSize, fileSize - position);
+            const data = new Uint8Array(await file.read(length, position));
+
+            let offset = 0;
+            let required = 0;
+            while (offset < data.length) {
+                const end = data.indexOf(CHAR_LF, offset);
+                if (end < 0) {
+                    required = (data.length - offset) * 2;
+                    break;
+                }
 
-        // console.log(text);
-        let state = 0;
-        let pos = 0;
+                const type = data[offset];
+                if (type == CHAR_LEGACY) {
+                    // 旧格式的记录: `$<length>,<key>=<value>\n`, 没有校验值
+                    const start = data.indexOf(CHAR_COMMA, offset) + 1;
+                    if (start <= 0 || start > end) {
+                        break;
+                    }
 
-        let offset = 0;
-        const length = text.length;
-        let index = null;
-        let key = null;
-        let value = null;
-        let lines = 0;
-        const values = this.values;
+                    const lineLength = end + 1 - start;
+                    this.replay(decodeUTF8(data, start, lineLength), position + start, data, start, lineLength);
+                    offset = end + 1;
+                    continue;
 
-        while (pos < length) {
-            if (state == 0) {
-                pos = text.indexOf(',', offset);
-                if (pos < 0) {
+                } else if (type != CHAR_BLOCK) {
                     break;
                 }
 
-                index = text.substring(offset + 1, pos);
-                state = 1;
-
-            } else if (state == 1) {
-                pos = text.indexOf('=', offset);
-                if (pos < 0) {
+                const header = decodeUTF8(data, offset + 1, end - offset - 1);
+                const separator = header.indexOf(',');
+                const crc = Number.parseInt(header.substring(0, separator), 16);
+                const bodyLength = Number(header.substring(separator + 1));
+                if (separator < 0 || !Number.isInteger(bodyLength) || bodyLength < 0) {
                     break;
                 }
 
-                key = text.substring(offset, pos).trim();
-                state = 2;
+                const bodyOffset = end + 1;
+                if (bodyOffset + bodyLength > data.length) {
+                    required = bodyOffset + bodyLength - offset;
+                    break;
+                }
 
-            } else {
-                pos = text.indexOf('\n', offset);
-                if (pos < 0) {
-                    pos = text.length;
+                if (crc32(data, 0, bodyOffset, bodyLength) !== crc) {
+                    break;
                 }
 
-                value = text.substring(offset, pos);
-                // console.log(index, key, value);
+                const text = decodeUTF8(data, bodyOffset, bodyLength);
+                this.replay(text, position + bodyOffset, data, bodyOffset, bodyLength);
+                offset = bodyOffset + bodyLength;
+            }
 
-                if (key) {
-                    if (value == 'X') {
-                        values.delete(key);
-                    } else {
-                        values.set(key, value);
-                    }
+            if (offset < data.length) {
+                if (required > 0 && position + data.length < fileSize) {
+                    // 数据块跨越了读取的范围, 从数据块开始的位置重新读取
+                    position += offset;
+                    readSize = Math.max(BLOCK_SIZE, required);
+                    continue;
                 }
 
-                lines++;
-                state = 0;
+                // 无效或不完整的数据
+                await this.truncate(file, position + offset);
+                return;
+            }
+
+            position += offset;
+            readSize = BLOCK_SIZE;
+        }
+    }
+
+    /**
+     * 重放数据块中的所有记录
+     * @param {string} text 记录内容
+     * @param {number} fileOffset 记录在文件中的位置
+     * @param {Uint8Array} data 记录的原始数据
+     * @param {number} dataOffset 记录在原始数据中的位置
+     * @param {number} byteLength 记录的字节数
+     */
+    replay(text, fileOffset, data, dataOffset, byteLength) {
+        const values = this.values;
+        const length = text.length;
+
+        // 只有 ASCII 字符时字符位置就是字节位置
+        const ascii = text.length == byteLength;
+        let position = 0;
+        let bytePosition = dataOffset;
+
+        while (position < length) {
+            let end = text.indexOf('\n', position);
+            if (end < 0) {
+                end = length;
+            }
+
+            const equal = text.indexOf('=', position);
+            if (equal < 0 || equal > end) {
+                position = end + 1;
+                bytePosition = data.indexOf(CHAR_LF, bytePosition) + 1;
+                continue;
+            }
+
+            const key = text.substring(position, equal).trim();
+            const previous = values.get(key);
+            if (previous != null) {
+                this.deadSize += recordSize(key, previous);
+            }
+
+            if (end - equal - 1 > INLINE_VALUE_SIZE) {
+                // 只记录值在文件中的位置
+                const byteEnd = data.indexOf(CHAR_LF, bytePosition);
+                const byteEqual = data.indexOf(CHAR_EQUAL, bytePosition);
+                const offset = fileOffset + byteEqual + 1 - dataOffset;
+                values.set(key, { offset, length: byteEnd - byteEqual - 1, size: byteEnd + 1 - bytePosition });
+
+            } else {
+                const value = text.substring(equal + 1, end);
+                if (value == REMOVED_VALUE || key == '') {
+                    values.delete(key);
+                    this.deadSize += end + 1 - position;
+
+                } else {
+                    values.set(key, value);
+                }
             }
 
-            // console.log(state, text.substring(offset, pos));
-            offset = pos + 1;
+            this.lineCount++;
+            position = end + 1;
+            bytePosition = ascii ? dataOffset + position : data.indexOf(CHAR_LF, bytePosition) + 1;
         }
+    }
 
-        this.index = Number.parseInt(index || '') || 0;
-        this.lineCount = lines;
+    /**
+     * 丢弃文件中指定位置之后的无效数据
+     * @param {fs.FileHandle} file
+     * @param {number} length
+     */
+    async truncate(file, length) {
+        console.warn(`FileStorage: discard invalid data after ${length} in ${this.filename}`);
+        await file.truncate(length);
+        this.fileSize = length;
     }
 
     /**
@@ -255,90 +496,177 @@ export class FileStorage {
     }
 
     /**
-     * 合并
-     * @returns 
+     * 压缩: 只保留有效的记录, 写入到新的文件后替换原来的文件
      */
     async merge() {
-        // 1. save
         const filename = this.filename;
-        if (!filename) {
+        const file = this.file;
+        if (!filename || !file) {
             return;
         }
 
-        const tempnamp = filename + '.2';
-        let lineCount = 0;
-        let fileSize = 0;
+        const tempname = filename + '.2';
+        const tempfile = await fs.open(tempname, 'w');
 
-        {
-            const file = await fs.open(tempnamp, 'ra');
-            if (file == null) {
-                return;
-            }
+        /** @type {[string, string|StorageRecord][]} 写入新文件的值 */
+        const entries = [];
 
-            const values = this.values;
-            for (const [key, value] of values.entries()) {
-                const length = key.length + value.length + 1;
-                const line = `$${length},${key}=${value}\n`;
-                await file.write(line);
+        /** @type {Map<string, StorageRecord>} 不常驻内存的值在新文件中的位置 */
+        const records = new Map();
 
-                lineCount++;
-                fileSize += line.length;
-                // console.log('line:', line);
+        let fileSize = 0;
+        let lines = [];
+        let textLength = 0;
+
+        /** @type {(string|null)[]} */
+        let largeKeys = [];
+        let hasLargeValue = false;
+
+        const writeBlock = async () => {
+            const { data, bodyOffset } = encodeBlock(lines.join(''));
+            if (hasLargeValue) {
+                locateValues(data, bodyOffset, fileSize, largeKeys, (key, record) => {
+                    records.set(key, record);
+                });
             }
 
-            await file.close();
-        }
+            await tempfile.write(data);
+            fileSize += data.length;
 
-        // 2. close
-        let file = this.file;
-        if (file != null) {
-            await file.close();
-        }
+            lines = [];
+            textLength = 0;
+            largeKeys = [];
+            hasLargeValue = false;
+        };
 
-        // 3. rename
         try {
-            await fs.unlink(filename);
-        } catch (e) {
+            const queue = this.queue;
+            for (const [key, value] of this.values) {
+                if (queue.has(key)) {
+                    // 还未写入, 压缩完成后再追加到新文件
+                    continue;
+                }
+
+                let text = value;
+                if (typeof text != 'string') {
+                    text = decodeUTF8(await file.read(text.length, text.offset));
+                }
+
+                const line = `${key}=${text}\n`;
+                const isLarge = text.length > INLINE_VALUE_SIZE;
+                entries.push([key, value]);
+                lines.push(line);
+                largeKeys.push(isLarge ? key : null);
+                hasLargeValue = hasLargeValue || isLarge;
+                textLength += line.length;
+
+                if (textLength >= BLOCK_SIZE) {
+                    await writeBlock();
+                }
+            }
+
+            if (lines.length > 0) {
+                await writeBlock();
+            }
+
+            await tempfile.sync();
+
+        } finally {
+            await tempfile.close();
         }
 
-        await fs.rename(tempnamp, filename);
+        await fs.rename(tempname, filename);
+        const newFile = await fs.open(filename, 'ra');
 
-        // 4. open
-        file = await fs.open(filename, 'ra');
-        this.file = file;
+        // 在压缩期间被修改或删除的记录在新文件中是无效数据
+        let deadSize = 0;
+        const values = this.values;
+        for (const [key, value] of entries) {
+            const record = records.get(key);
+            if (values.get(key) !== value) {
+                deadSize += record ? record.size : recordSize(key, value);
+
+            } else if (record) {
+                values.set(key, record);
+            }
+        }
+
+        this.file = newFile;
         this.fileSize = fileSize;
-        this.lineCount = lineCount;
+        this.lineCount = entries.length;
+        this.deadSize = deadSize;
+
+        await file.close();
     }
 
     async onFlush() {
         try {
+            const file = this.file;
+            if (file == null) {
+                return;
+            }
+
+            if (this.truncatePending) {
+                this.truncatePending = false;
+                await file.truncate(0);
+
+                this.fileSize = 0;
+                this.lineCount = 0;
+                this.deadSize = 0;
+            }
+
             const queue = this.queue;
-            if (queue.length <= 0) {
+            if (queue.size <= 0) {
                 return;
             }
 
-            this.queue = [];
+            this.queue = new Map();
 
-            for (const line of queue) {
-                if (line == '') {
-                    await this.merge();
-                    continue;
+            // 所有修改合并为一个数据块, 一次写入
+            const lines = [];
+
+            /** @type {(string|null)[]} */
+            const largeKeys = [];
+            let hasLargeValue = false;
+            let removedSize = 0;
+
+            for (const [key, value] of queue) {
+                const line = `${key}=${value ?? REMOVED_VALUE}\n`;
+                const isLarge = value != null && value.length > INLINE_VALUE_SIZE;
+                lines.push(line);
+                largeKeys.push(isLarge ? key : null);
+                hasLargeValue = hasLargeValue || isLarge;
+
+                if (value == null) {
+                    removedSize += line.length;
                 }
+            }
 
-                const file = this.file;
-                await file?.write(line);
+            const fileOffset = this.fileSize;
+            const { data, bodyOffset } = encodeBlock(lines.join(''));
+            await file.write(data);
+            await file.sync();
+
+            this.fileSize += data.length;
+            this.lineCount += queue.size;
+            this.deadSize += removedSize + bodyOffset;
+
+            // 写入后大的值不再常驻内存
+            if (hasLargeValue) {
+                const values = this.values;
+                locateValues(data, bodyOffset, fileOffset, largeKeys, (key, record) => {
+                    if (values.get(key) === queue.get(key)) {
+                        values.set(key, record);
+                    }
+                });
             }
 
-            const values = this.values;
-            if (this.lineCount >= values.size * 10) {
+            if (this.deadSize >= COMPACT_MIN_SIZE && this.deadSize * 2 >= this.fileSize) {
                 await this.merge();
             }
 
         } catch (e) {
             console.log(e);
-
-        } finally {
-            this.flushPromise = null;
         }
     }
 
@@ -361,20 +689,11 @@ export class FileStorage {
             return;
         }
 
-        const values = this.values;
-        if (!values.has(name)) {
+        if (!this.values.has(name)) {
             return;
         }
 
-        this.values.delete(name);
-
-        const length = name.length + 2;
-        const line = `$${length},${name}=X\n`;
-
-        this.enqueue(line);
-
-        this.lineCount++;
-        this.fileSize += line.length;
+        this.enqueue(name, null);
     }
 
     /**
@@ -392,26 +711,18 @@ export class FileStorage {
             return;
         }
 
+        // 键名不能包含记录的分隔符
         const name = key.trim();
-        if (name == '') {
+        if (name == '' || name.includes('=') || name.includes('\n')) {
             return;
         }
 
-        const values = this.values;
         const rawValue = JSON.stringify(value);
-        if (rawValue === values.get(name)) {
+        if (rawValue === this.values.get(name)) {
             return;
         }
 
-        values.set(name, rawValue);
-
-        const length = name.length + rawValue.length + 1;
-        const line = `$${length},${name}=${rawValue}\n`;
-
-        this.enqueue(line);
-
-        this.lineCount++;
-        this.fileSize += line.length;
+        this.enqueue(name, rawValue);
     }
 }
 
@@ -421,7 +732,7 @@ const kStorageFile = Symbol('StorageFile');
  * 实现 Web Storage API 接口
  * - sessionStorage 保存在 /tmp 目录下，设备重启后会丢失
  * - localStorage 保存在 Flash，设备重启也不会丢失
- * - 文件最大大小限制在 640KB
+ * - 数据以日志结构保存, 无效数据过多时会自动压缩
  */
 export class Storage {
     /** 
@@ -541,7 +852,7 @@ export class StorageManager {
             return;
         }
 
-        return storage.file?.onFlush();
+        return storage.file?.flush();
     }
 
     async flush() {
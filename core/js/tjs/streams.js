@@ -14,15 +14,21 @@ export class ReadableStreamDefaultController {
      */
     constructor(stream) {
         this.#ownerStream = stream;
-
-        /** @type {number} */
-        this.desiredSize = 0;
     }
 
     get [Symbol.toStringTag]() {
         return 'ReadableStreamDefaultController';
     }
 
+    /**
+     * 填满内部队列还需要的大小, 小于等于 0 表示底层数据源应暂停产生数据
+     * @returns {number|null}
+     */
+    get desiredSize() {
+        const ownerStream = this.#ownerStream;
+        return ownerStream ? ownerStream._getDesiredSize() : 0;
+    }
+
     /** 
      * 用于关闭关联的流。
      * closes the associated stream. 
@@ -64,6 +70,88 @@ export class ReadableStreamDefaultController {
     }
 }
 
+/**
+ * 字节流 (`type: 'bytes'`) 的控制器
+ * - 通过 `byobRequest` 底层数据源可以直接把数据写入到读取者提供的缓存区中
+ */
+export class ReadableByteStreamController extends ReadableStreamDefaultController {
+    /**
+     * @param {ReadableStream<Uint8Array>} stream 
+     */
+    constructor(stream) {
+        super(stream);
+
+        /** @type {ReadableStreamBYOBRequest|null} */
+        this._byobRequest = null;
+    }
+
+    get [Symbol.toStringTag]() {
+        return 'ReadableByteStreamController';
+    }
+
+    /**
+     * 当前等待填充的读请求, 没有时为 null
+     */
+    get byobRequest() {
+        return this._byobRequest;
+    }
+}
+
+/**
+ * 等待底层数据源填充的读请求
+ */
+export class ReadableStreamBYOBRequest {
+    /** @type {ReadableStream<Uint8Array>=} owner */
+    #ownerStream = undefined;
+
+    /**
+     * @param {ReadableStream<Uint8Array>} stream 
+     * @param {ArrayBufferView} view 
+     */
+    constructor(stream, view) {
+        this.#ownerStream = stream;
+
+        /** @type {ArrayBufferView|null} 要写入的缓存区 */
+        this.view = view;
+    }
+
+    get [Symbol.toStringTag]() {
+        return 'ReadableStreamBYOBRequest';
+    }
+
+    /**
+     * 通知已经向 `view` 写入了 `bytesWritten` 个字节
+     * @param {number} bytesWritten 
+     */
+    respond(bytesWritten) {
+        const ownerStream = this.#ownerStream;
+        const view = this.view;
+        if (!ownerStream || !view) {
+            throw new TypeError('This BYOB request has been invalidated');
+
+        } else if (bytesWritten < 0 || bytesWritten > view.byteLength) {
+            throw new RangeError('bytesWritten out of range');
+        }
+
+        this.#ownerStream = undefined;
+        this.view = null;
+        ownerStream._respond(view, bytesWritten);
+    }
+
+    /**
+     * 通知数据已写入到新的 view 中, 新的 view 必须和原来的 view 使用同一个缓存区以及相同的起始位置
+     * @param {ArrayBufferView} view 
+     */
+    respondWithNewView(view) {
+        const current = this.view;
+        if (!current || view.buffer !== current.buffer || view.byteOffset != current.byteOffset) {
+            throw new TypeError('Invalid view');
+        }
+
+        this.respond(view.byteLength);
+    }
+}
+
 /**
  * @template R
  * implements ReadableStreamGenericReader<R>
@@ -125,6 +213,13 @@ export class ReadableStreamDefaultReader {
      * @throws TypeError 源对象不是 ReadableStreamDefaultReader，或者流没有所有者。
      */
     async read() {
+        return this._read(undefined);
+    }
+
+    /**
+     * @param {ArrayBufferView=} view BYOB 模式下要写入的缓存区
+     */
+    async _read(view) {
         if (this.#isLockReleased) {
             throw new TypeError('releaseLock is called');
         }
@@ -135,7 +230,7 @@ export class ReadableStreamDefaultReader {
             throw new TypeError('onwer stream is null');
         }
 
-        const result = await ownerStream.read();
+        const result = await ownerStream.read(view);
         if (result.done) {
             ownerStream._resolveClosedPromise();
             this.releaseLock();
@@ -171,6 +266,35 @@ export class ReadableStreamDefaultReader {
     }
 }
 
+/**
+ * BYOB (bring your own buffer) 模式的 reader
+ * - 数据直接写入到调用者提供的缓存区中, 避免额外的内存分配
+ * @extends {ReadableStreamDefaultReader<ArrayBufferView>}
+ */
+export class ReadableStreamBYOBReader extends ReadableStreamDefaultReader {
+    get [Symbol.toStringTag]() {
+        return 'ReadableStreamBYOBReader';
+    }
+
+    /**
+     * 读取数据到指定的缓存区中
+     * @template {ArrayBufferView} T
+     * @param {T} view 
+     * @returns {Promise<{done: boolean, value: T|undefined}>} value 是和 `view` 使用同一个缓存区的新的 view
+     */
+    // @ts-ignore
+    async read(view) {
+        if (!ArrayBuffer.isView(view)) {
+            throw new TypeError('view must be an ArrayBufferView');
+
+        } else if (view.byteLength == 0) {
+            throw new TypeError('view must have non-zero byteLength');
+        }
+
+        return this._read(view);
+    }
+}
+
 /**
  * @typedef UnderlyingSource
  * @property {(controller:ReadableStreamDefaultController) => void =} start A user-defined function that is invoked immediately when the ReadableStream is created.
@@ -179,9 +303,63 @@ export class ReadableStreamDefaultReader {
  * @property {string=} type Must be 'bytes' or undefined.
  * @property {number=} autoAllocateChunkSize Used only when type is equal to 'bytes'.
  * 
- * @typedef {{}} QueuingStrategy
- * @property {number=} highWaterMark 
- * @property {number=} size 
+ * @typedef QueuingStrategy
+ * @property {number=} highWaterMark 内部队列的高水位线, 字节流的单位为字节, 否则为 `size` 的单位 (默认为数据块的个数)
+ * @property {(chunk: any) => number =} size 计算数据块的大小
+ */
+
+/**
+ * 读请求
+ * @typedef ReadRequest
+ * @property {(err?: any, result?: any) => void} callback
+ * @property {ArrayBufferView=} view BYOB 模式下要写入的缓存区
+ * @property {number=} filled BYOB 模式下已写入 `view` 但还不足一个元素的字节数
+ * @property {ArrayBufferView=} target 当前 byobRequest 的缓存区
+ */
+
+/**
+ * 返回 ArrayBufferView 每个元素的字节数
+ * @param {ArrayBufferView} view 
+ */
+function getElementSize(view) {
+    // @ts-ignore
+    return view.BYTES_PER_ELEMENT || 1;
+}
+
+/**
+ * 创建和 `view` 同类型, 同一个缓存区的新的 view
+ * @param {ArrayBufferView} view 
+ * @param {number} byteLength 
+ */
+function createViewOf(view, byteLength) {
+    // @ts-ignore
+    const Constructor = view.constructor;
+    return new Constructor(view.buffer, view.byteOffset, byteLength / getElementSize(view));
+}
+
+/**
+ * @param {number|undefined} highWaterMark 
+ * @param {number} defaultValue 
+ */
+function validateHighWaterMark(highWaterMark, defaultValue) {
+    if (highWaterMark === undefined) {
+        return defaultValue;
+    }
+
+    highWaterMark = Number(highWaterMark);
+    if (isNaN(highWaterMark) || highWaterMark < 0) {
+        throw new RangeError('Invalid highWaterMark');
+    }
+
+    return highWaterMark;
+}
+
+/**
+ * @typedef PipeOptions
+ * @property {boolean=} preventAbort 读取发生错误时不中止目标流
+ * @property {boolean=} preventCancel 写入发生错误时不取消源流
+ * @property {boolean=} preventClose 源流结束时不关闭目标流
+ * @property {AbortSignal=} signal 用于中止传输
  */
 
 /**
@@ -195,6 +373,10 @@ export class ReadableStream {
      * @param {QueuingStrategy} queuingStrategy 
      */
     constructor(underlyingSource, queuingStrategy) {
+        const type = underlyingSource?.type;
+        if (type !== undefined && type != 'bytes') {
+            throw new RangeError('Invalid type: ' + type);
+        }
 
         /** @type {((err?: any, result?: any) => void) | undefined} */
         this._closedPromiseCallback = undefined;
@@ -203,7 +385,19 @@ export class ReadableStream {
         this._closedPromise = undefined;
 
         /** @type ReadableStreamDefaultController | undefined */
-        this._controller = new ReadableStreamDefaultController(this);
+        this._controller = (type == 'bytes') ? new ReadableByteStreamController(this) : new ReadableStreamDefaultController(this);
+
+        /** @type number 内部队列的高水位线 */
+        this._highWaterMark = validateHighWaterMark(queuingStrategy?.highWaterMark, (type == 'bytes') ? 0 : 1);
+
+        /** @type boolean 是否正在调用 pull */
+        this._pulling = false;
+
+        /** @type boolean 调用 pull 期间又产生了新的读取需求 */
+        this._pullAgain = false;
+
+        /** @type number 内部队列中所有数据块的总大小 */
+        this._queueTotalSize = 0;
 
         /** @type QueuingStrategy */
         this._queuingStrategy = queuingStrategy;
@@ -214,7 +408,7 @@ export class ReadableStream {
         /** @type R[] */
         this._readBuffer = [];
 
-        /** @type any[] */
+        /** @type ReadRequest[] */
         this._readRequests = [];
 
         /** @type string `closed` | `errored` | `readable` */
@@ -223,6 +417,9 @@ export class ReadableStream {
         /** @type Error | undefined */
         this._storedError = undefined;
 
+        /** @type string | undefined `bytes` 或 undefined */
+        this._type = type;
+
         /** @type UnderlyingSource | undefined */
         this._underlyingSource = underlyingSource;
 
@@ -273,6 +470,7 @@ export class ReadableStream {
                 readBuffer.pop();
             }
 
+            this._queueTotalSize = 0;
             this._onCancelStream(reason);
             this._onDestoryStream();
         }
@@ -290,6 +488,7 @@ export class ReadableStream {
 
     /**
      * Appends a new chunk of data to the <ReadableStream>'s queue.
+     * - 字节流只接受 ArrayBuffer 或 ArrayBufferView, 数据不会被复制, 调用者不能再修改它
      * @param {R|null} chunk 
      */
     enqueue(chunk) {
@@ -302,7 +501,29 @@ export class ReadableStream {
             return;
         }
 
+        if (this._type == 'bytes') {
+            /** @type any */
+            const data = chunk;
+            if (data instanceof ArrayBuffer) {
+                chunk = /** @type any */ (new Uint8Array(data));
+
+            } else if (!ArrayBuffer.isView(data)) {
+                throw new TypeError('chunk must be an ArrayBuffer or ArrayBufferView');
+
+            } else if (!(data instanceof Uint8Array)) {
+                chunk = /** @type any */ (new Uint8Array(data.buffer, data.byteOffset, data.byteLength));
+            }
+
+            // 数据源没有使用 byobRequest, 而是直接提交了数据
+            this._invalidateBYOBRequest();
+
+            if (data.byteLength == 0) {
+                return;
+            }
+        }
+
         this._readBuffer.push(chunk);
+        this._queueTotalSize += this._sizeOf(chunk);
         this._resolveReadPromisesWithChunk();
     }
 
@@ -317,6 +538,7 @@ export class ReadableStream {
 
         this._storedError = err;
         this._setState('errored');
+        this._invalidateBYOBRequest();
 
         this._resolveClosedPromise();
         this._rejectReadPromises(err);
@@ -325,21 +547,36 @@ export class ReadableStream {
     /**
      * 返回一个 reader
      * - 将锁定这个 stream
+     * @param {{mode?: 'byob'}=} options `mode` 为 `byob` 时返回 ReadableStreamBYOBReader, 只适用于字节流
      * @returns ReadableStreamDefaultReader
      */
-    getReader() {
+    getReader(options) {
         // 1. If IsReadableStreamLocked(stream) is true, throw a TypeError exception.
         if (this.locked) {
             throw new TypeError('The stream is locked');
         }
 
-        const reader = new ReadableStreamDefaultReader(this);
+        const mode = options?.mode;
+        let reader = null;
+        if (mode == 'byob') {
+            if (this._type != 'bytes') {
+                throw new TypeError('BYOB reader requires a byte stream');
+            }
+
+            reader = new ReadableStreamBYOBReader(this);
+
+        } else if (mode !== undefined) {
+            throw new RangeError('Invalid mode: ' + mode);
+
+        } else {
+            reader = new ReadableStreamDefaultReader(this);
+        }
 
         if (this.state == 'closed') {
             reader._closedPromise = Promise.resolve(undefined);
 
         } else if (this.state == 'errored') {
-            reader._closedPromise = Promise.reject(this._storedError);
+            reader._closedPromise = createRejected(this._storedError);
 
         } else {
             this._closedPromise = new Promise((resolve, reject) => {
@@ -362,12 +599,111 @@ export class ReadableStream {
         return reader;
     }
 
+    /**
+     * 通过 `transform` 转换这个流
+     * @template T
+     * @param {{writable: WritableStream<R>, readable: ReadableStream<T>}} transform
+     * @param {PipeOptions=} options
+     * @returns {ReadableStream<T>} 即 `transform.readable`
+     */
+    pipeThrough(transform, options) {
+        const { writable, readable } = transform;
+        if (this.locked) {
+            throw new TypeError('The stream is locked');
+
+        } else if (writable.locked) {
+            throw new TypeError('The destination stream is locked');
+        }
+
+        this.pipeTo(writable, options).catch(() => { });
+        return readable;
+    }
+
+    /**
+     * 把这个流中的数据全部写入到 `destination` 中
+     * - 每次写入前都会等待 `writer.ready`, 当目标写得比较慢时不会无限制地读取和缓存数据
+     * @param {WritableStream<R>} destination
+     * @param {PipeOptions=} options
+     * @returns {Promise<void>}
+     */
+    async pipeTo(destination, options) {
+        if (this.locked) {
+            throw new TypeError('The stream is locked');
+
+        } else if (destination.locked) {
+            throw new TypeError('The destination stream is locked');
+        }
+
+        const reader = this.getReader();
+        const writer = destination.getWriter();
+
+        // 中止信号
+        const signal = options?.signal;
+        let onabort = null;
+
+        // 在 Promise.race() 添加处理函数之前就可能被拒绝, 所以标记为已处理
+        const aborted = createDeferred(true);
+        if (signal) {
+            onabort = () => {
+                const error = new Error('The operation was aborted');
+                error.name = 'AbortError';
+                aborted.reject(error);
+            };
+
+            if (signal.aborted) {
+                onabort();
+
+            } else {
+                signal.addEventListener('abort', onabort);
+            }
+        }
+
+        try {
+            while (true) {
+                // 目标流的队列已满时等待
+                await Promise.race([writer.ready, aborted.promise]);
+
+                const result = await Promise.race([reader.read(), aborted.promise]);
+                if (result.done) {
+                    break;
+                }
+
+                // 写入失败时会通过 `writer.ready` 返回错误
+                writer.write(result.value).catch(() => { });
+            }
+
+            if (!options?.preventClose) {
+                await writer.close();
+            }
+
+        } catch (err) {
+            if (!options?.preventAbort) {
+                await writer.abort(err).catch(() => { });
+            }
+
+            if (!options?.preventCancel) {
+                await reader.cancel(err).catch(() => { });
+            }
+
+            throw err;
+
+        } finally {
+            if (signal && onabort) {
+                signal.removeEventListener('abort', onabort);
+            }
+
+            reader.releaseLock();
+            writer.releaseLock();
+        }
+    }
+
     /**
      * Requests the next chunk of data from the underlying <ReadableStream> and 
      * returns a promise that is fulfilled with the data once it is available.
+     * @param {ArrayBufferView=} view BYOB 模式下要写入的缓存区
      * @returns 
      */
-    read() {
+    read(view) {
         // 2. Let promise be a new promise.
         const promise = new Promise((resolve, reject) => {
             // console.log('streams:', 'read: wait');
@@ -382,7 +718,7 @@ export class ReadableStream {
                 }
             };
 
-            this._readRequests.push(callback);
+            this._readRequests.push({ callback, view });
         });
 
         // 4. Perform ReadableStreamDefaultReaderRead(this, readRequest).
@@ -392,6 +728,81 @@ export class ReadableStream {
         return promise;
     }
 
+    /**
+     * 从内部队列中复制数据到读请求的 `view` 中
+     * @param {ReadRequest} request
+     */
+    _fillView(request) {
+        // 只复制整数个元素, 剩余的字节留在内部队列中
+        // 不足一个元素时先移到 `view` 中, 等待后面的数据
+        const view = /** @type ArrayBufferView */ (request.view);
+        const filled = request.filled || 0;
+        const elementSize = getElementSize(view);
+        const byteLength = filled + Math.min(view.byteLength - filled, this._queueTotalSize);
+        const total = (byteLength < elementSize) ? (byteLength - filled) : (byteLength - (byteLength % elementSize) - filled);
+        if (total <= 0) {
+            return;
+        }
+
+        /** @type any[] */
+        const readBuffer = this._readBuffer;
+        const target = new Uint8Array(view.buffer, view.byteOffset + filled, total);
+
+        let offset = 0;
+        while (offset < total) {
+            /** @type Uint8Array */
+            const chunk = readBuffer[0];
+            const size = Math.min(chunk.byteLength, total - offset);
+            if (size == chunk.byteLength) {
+                target.set(chunk, offset);
+                readBuffer.shift();
+
+            } else {
+                target.set(chunk.subarray(0, size), offset);
+                readBuffer[0] = chunk.subarray(size);
+            }
+
+            offset += size;
+        }
+
+        this._queueTotalSize -= total;
+        if (filled + total < elementSize) {
+            request.filled = filled + total;
+            return;
+        }
+
+        return { done: false, value: createViewOf(view, filled + total) };
+    }
+
+    /**
+     * 返回填满内部队列还需要的大小
+     * @returns {number|null}
+     */
+    _getDesiredSize() {
+        if (this._state == 'errored') {
+            return null;
+
+        } else if (this._state == 'closed') {
+            return 0;
+        }
+
+        return this._highWaterMark - this._queueTotalSize;
+    }
+
+    /**
+     * 使当前的 byobRequest 失效
+     */
+    _invalidateBYOBRequest() {
+        const controller = this._controller;
+        if (controller instanceof ReadableByteStreamController) {
+            const request = controller._byobRequest;
+            if (request) {
+                controller._byobRequest = null;
+                request.view = null;
+            }
+        }
+    }
+
     /**
      * 
      * @param {any=} reason 
@@ -415,14 +826,40 @@ export class ReadableStream {
         this._resolveReadPromises();
     }
 
+    /**
+     * 当有未完成的读请求或者内部队列还没有满时调用 pull
+     * - 同一时间只会有一个 pull 在执行
+     */
     _onPullStream() {
         const controller = this._controller;
         const pull = this._underlyingSource?.pull;
-        if (pull && controller) {
-            pull(controller).then(() => {
+        if (!pull || !controller || this._state != 'readable') {
+            return;
+        }
 
-            });
+        const desiredSize = this._getDesiredSize() || 0;
+        if (!this._readRequests.length && desiredSize <= 0) {
+            return;
+
+        } else if (this._pulling) {
+            this._pullAgain = true;
+            return;
         }
+
+        this._pulling = true;
+        this._setupBYOBRequest();
+
+        invokeAndThen(() => pull(controller), () => {
+            this._pulling = false;
+            if (this._pullAgain) {
+                this._pullAgain = false;
+                this._onPullStream();
+            }
+
+        }, (err) => {
+            this._pulling = false;
+            this.error(err);
+        });
     }
 
     /**
@@ -432,8 +869,8 @@ export class ReadableStream {
     _rejectReadPromises(err) {
         const requests = this._readRequests;
         while (requests.length) {
-            const callback = requests.shift();
-            callback(err);
+            const request = requests.shift();
+            request?.callback(err);
         }
     }
 
@@ -459,15 +896,24 @@ export class ReadableStream {
             return;
         }
 
+        let dequeued = false;
+        const queueTotalSize = this._queueTotalSize;
         const requests = this._readRequests;
         while (requests.length) {
-            const result = this._nextChunk();
+            const request = requests[0];
+            const result = this._nextChunk(request);
             if (!result) {
                 break;
             }
 
-            const callback = requests.shift();
-            callback(null, result);
+            requests.shift();
+            dequeued = true;
+            request.callback(null, result);
+        }
+
+        // 内部队列低于高水位线后继续拉取数据
+        if (dequeued || this._queueTotalSize < queueTotalSize) {
+            this._onPullStream();
         }
     }
 
@@ -475,12 +921,20 @@ export class ReadableStream {
      * 履行 read 承诺
      */
     _resolveReadPromisesWithoutChunk() {
-        const result = { done: true, value: undefined };
-
         const requests = this._readRequests;
         while (requests.length) {
-            const callback = requests.shift();
-            callback(null, result);
+            const request = requests.shift();
+            const view = request?.view;
+
+            if (view && request.filled) {
+                // 剩余的字节不足一个元素
+                request.callback(new TypeError('Insufficient bytes to fill elements in the given buffer'));
+                continue;
+            }
+
+            // BYOB 模式下返回长度为 0 的 view
+            const value = view ? createViewOf(view, 0) : undefined;
+            request?.callback(null, { done: true, value });
         }
     }
 
@@ -517,6 +971,61 @@ export class ReadableStream {
         this._onPullStream();
     }
 
+    /**
+     * 底层数据源已经向 byobRequest 的缓存区写入了 `bytesWritten` 个字节
+     * @param {ArrayBufferView} view
+     * @param {number} bytesWritten
+     */
+    _respond(view, bytesWritten) {
+        const controller = this._controller;
+        if (controller instanceof ReadableByteStreamController) {
+            controller._byobRequest = null;
+        }
+
+        const request = this._readRequests[0];
+        if (bytesWritten == 0 || this._state != 'readable' || !request) {
+            return;
+        }
+
+        if (request.view && request.target !== view) {
+            // 读请求已经改变, 数据复制到内部队列中
+            const data = new Uint8Array(view.buffer, view.byteOffset, bytesWritten);
+            // @ts-ignore
+            this.enqueue(data.slice());
+            return;
+        }
+
+        // 数据已经直接写入了读取者的缓存区 (或者自动分配的缓存区)
+        let value;
+        if (request.view) {
+            const filled = (request.filled || 0) + bytesWritten;
+            const remainder = filled % getElementSize(request.view);
+            if (filled == remainder) {
+                // 还不足一个元素, 继续等待后面的数据
+                request.filled = filled;
+                this._onPullStream();
+                return;
+            }
+
+            if (remainder) {
+                // 不足一个元素的剩余字节放回内部队列, 留给下次读取
+                const offset = request.view.byteOffset + filled - remainder;
+                this._readBuffer.push(new Uint8Array(request.view.buffer, offset, remainder).slice());
+                this._queueTotalSize += remainder;
+            }
+
+            value = createViewOf(request.view, filled - remainder);
+
+        } else {
+            value = new Uint8Array(view.buffer, view.byteOffset, bytesWritten);
+        }
+
+        this._readRequests.shift();
+        request.callback(null, { done: false, value });
+
+        this._onPullStream();
+    }
+
     /**
      * 设置这个 stream 的状态
      * @param {string} state 
@@ -528,6 +1037,7 @@ export class ReadableStream {
 
             if (state == 'closed') {
                 this._underlyingSource = undefined;
+                this._invalidateBYOBRequest();
 
                 const controller = this._controller;
                 if (controller) {
@@ -538,38 +1048,618 @@ export class ReadableStream {
         }
     }
 
-    _nextChunk() {
+    /**
+     * 字节流的内部队列为空时, 为第一个读请求创建 byobRequest
+     * - BYOB reader 使用读取者提供的缓存区
+     * - 默认 reader 在设置了 `autoAllocateChunkSize` 时自动分配缓存区
+     */
+    _setupBYOBRequest() {
+        const controller = this._controller;
+        if (!(controller instanceof ReadableByteStreamController) || this._readBuffer.length) {
+            return;
+        }
+
+        const request = this._readRequests[0];
+        if (!request) {
+            return;
+        }
+
+        let view = request.view;
+        if (view && request.filled) {
+            // 接着已经写入的字节继续写
+            const filled = request.filled;
+            view = new Uint8Array(view.buffer, view.byteOffset + filled, view.byteLength - filled);
+
+        } else if (!view) {
+            const size = this._underlyingSource?.autoAllocateChunkSize;
+            if (!size) {
+                return;
+            }
+
+            view = new Uint8Array(size);
+        }
+
+        request.target = view;
+
+        // @ts-ignore
+        controller._byobRequest = new ReadableStreamBYOBRequest(this, view);
+    }
+
+    /**
+     * 返回数据块的大小
+     * @param {any} chunk
+     */
+    _sizeOf(chunk) {
+        if (this._type == 'bytes') {
+            return chunk.byteLength;
+        }
+
+        const size = this._queuingStrategy?.size;
+        return size ? Number(size(chunk)) : 1;
+    }
+
+    /**
+     * @param {ReadRequest} request
+     */
+    _nextChunk(request) {
         const readBuffer = this._readBuffer;
         if (!readBuffer.length) {
             return;
         }
 
+        if (request.view) {
+            return this._fillView(request);
+        }
+
         const value = readBuffer.shift();
+        this._queueTotalSize = readBuffer.length ? (this._queueTotalSize - this._sizeOf(value)) : 0;
 
         // 如果有分块可用，则 promise 将使用 { value: theChunk, done: false } 形式的对象来兑现。
         return { done: false, value };
     }
 }
 
+/**
+ * @template T
+ * @typedef Deferred
+ * @property {Promise<T>} promise
+ * @property {(value?: any) => void} resolve
+ * @property {(reason?: any) => void} reject
+ */
+
+/**
+ * @param {boolean} handled 是否忽略没有处理的拒绝
+ * @returns {Deferred<any>}
+ */
+function createDeferred(handled) {
+    /** @type any */
+    const deferred = {};
+    deferred.promise = new Promise((resolve, reject) => {
+        deferred.resolve = resolve;
+        deferred.reject = reject;
+    });
+
+    if (handled) {
+        deferred.promise.catch(() => { });
+    }
+
+    return deferred;
+}
+
+/**
+ * 返回一个已被拒绝并标记为已处理的 promise
+ * @param {any} reason
+ * @returns {Promise<any>}
+ */
+function createRejected(reason) {
+    const deferred = createDeferred(true);
+    deferred.reject(reason);
+    return deferred.promise;
+}
+
+/**
+ * 调用底层源或接收器的方法, 并在它返回的 promise 完成后调用 onFulfilled 或 onRejected
+ * - 同步抛出的异常不会转换为 `Promise.reject()`, 因为在添加处理函数之前被拒绝的 promise
+ *   会被报告为没有处理的拒绝
+ * @param {() => any} callback
+ * @param {(value: any) => void} onFulfilled
+ * @param {(reason: any) => void} onRejected
+ */
+function invokeAndThen(callback, onFulfilled, onRejected) {
+    let result = null;
+    try {
+        result = callback();
+
+    } catch (err) {
+        Promise.resolve().then(() => onRejected(err));
+        return;
+    }
+
+    Promise.resolve(result).then(onFulfilled, onRejected);
+}
+
+/**
+ * @typedef UnderlyingSink
+ * @property {(controller: WritableStreamDefaultController) => any =} start 创建流时调用
+ * @property {(chunk: any, controller: WritableStreamDefaultController) => any =} write 写入一个数据块, 返回 promise 时等待完成后才写入下一个
+ * @property {() => any =} close 所有数据都写入后调用
+ * @property {(reason?: any) => any =} abort 中止这个流时调用
+ */
+
+/**
+ * @typedef WriteRequest
+ * @property {any} chunk
+ * @property {number} size
+ * @property {Deferred<void>} deferred
+ */
+
+export class WritableStreamDefaultController {
+    /** @type {WritableStream=} owner */
+    #ownerStream = undefined;
+
+    /**
+     * @param {WritableStream} stream
+     */
+    constructor(stream) {
+        this.#ownerStream = stream;
+    }
+
+    get [Symbol.toStringTag]() {
+        return 'WritableStreamDefaultController';
+    }
+
+    detachStream() {
+        this.#ownerStream = undefined;
+    }
+
+    /**
+     * 使关联的流出错, 之后的写入都将失败
+     * @param {any} err
+     */
+    error(err) {
+        this.#ownerStream?._error(err);
+    }
+}
+
+/**
+ * @template W
+ */
+export class WritableStreamDefaultWriter {
+    /** @type {WritableStream<W>=} owner */
+    #ownerStream = undefined;
+
+    /**
+     * @param {WritableStream<W>} stream
+     */
+    constructor(stream) {
+        this.#ownerStream = stream;
+    }
+
+    get [Symbol.toStringTag]() {
+        return 'WritableStreamDefaultWriter';
+    }
+
+    /** 在流关闭时兑现, 出错时拒绝 */
+    get closed() {
+        const ownerStream = this.#ownerStream;
+        if (!ownerStream) {
+            return createRejected(new TypeError('lock is released'));
+        }
+
+        return ownerStream._closed.promise;
+    }
+
+    /** 填满内部队列还需要的大小 */
+    get desiredSize() {
+        const ownerStream = this.#ownerStream;
+        if (!ownerStream) {
+            throw new TypeError('lock is released');
+        }
+
+        return ownerStream._getDesiredSize();
+    }
+
+    /** 内部队列低于高水位线时兑现, 用于实现背压 */
+    get ready() {
+        const ownerStream = this.#ownerStream;
+        if (!ownerStream) {
+            return createRejected(new TypeError('lock is released'));
+        }
+
+        return ownerStream._ready.promise;
+    }
+
+    /**
+     * 中止这个流, 还未写入的数据将被丢弃
+     * @param {any=} reason
+     */
+    async abort(reason) {
+        const ownerStream = this.#ownerStream;
+        if (!ownerStream) {
+            throw new TypeError('lock is released');
+        }
+
+        return ownerStream._abort(reason);
+    }
+
+    /**
+     * 在所有数据都写入后关闭这个流
+     */
+    async close() {
+        const ownerStream = this.#ownerStream;
+        if (!ownerStream) {
+            throw new TypeError('lock is released');
+        }
+
+        return ownerStream._close();
+    }
+
+    releaseLock() {
+        const ownerStream = this.#ownerStream;
+        if (ownerStream) {
+            this.#ownerStream = undefined;
+            ownerStream._writer = null;
+        }
+    }
+
+    /**
+     * 写入一个数据块
+     * @param {W} chunk
+     * @returns {Promise<void>} 在这个数据块被底层接收器写入后兑现
+     */
+    write(chunk) {
+        const ownerStream = this.#ownerStream;
+        if (!ownerStream) {
+            return createRejected(new TypeError('lock is released'));
+        }
+
+        return ownerStream._write(chunk);
+    }
+}
+
+/**
+ * WritableStream
+ * @template W
+ */
 export class WritableStream {
-    constructor() {
-        this._locked = false;
+    /**
+     * @param {UnderlyingSink=} underlyingSink
+     * @param {QueuingStrategy=} queuingStrategy
+     */
+    constructor(underlyingSink, queuingStrategy) {
+        /** @type boolean 内部队列是否已满 */
+        this._backpressure = false;
+
+        /** @type Deferred<void> | undefined */
+        this._closeRequest = undefined;
+
+        /** @type Deferred<void> */
+        this._closed = createDeferred(true);
+
+        /** @type WritableStreamDefaultController */
+        this._controller = new WritableStreamDefaultController(this);
+
+        /** @type number 内部队列的高水位线 */
+        this._highWaterMark = validateHighWaterMark(queuingStrategy?.highWaterMark, 1);
+
+        /** @type boolean 是否正在调用 close */
+        this._inFlightClose = false;
+
+        /** @type WriteRequest | undefined 正在写入的数据块 */
+        this._inFlightWrite = undefined;
+
+        /** @type WriteRequest[] */
+        this._queue = [];
+
+        /** @type number 内部队列中所有数据块的总大小 (包括正在写入的数据块) */
+        this._queueTotalSize = 0;
+
+        /** @type QueuingStrategy | undefined */
+        this._queuingStrategy = queuingStrategy;
+
+        /** @type Deferred<void> */
+        this._ready = createDeferred(true);
+        this._ready.resolve();
+
+        /** @type boolean */
+        this._started = false;
+
+        /** @type string `writable` | `closing` | `closed` | `errored` */
+        this._state = 'writable';
+
+        /** @type any */
+        this._storedError = undefined;
+
+        /** @type UnderlyingSink | undefined */
+        this._underlyingSink = underlyingSink;
+
+        /** @type WritableStreamDefaultWriter<W> | null */
+        this._writer = null;
+
+        this._updateBackpressure();
+
+        // start
+        invokeAndThen(() => underlyingSink?.start?.(this._controller), () => {
+            this._started = true;
+            this._advanceQueue();
+
+        }, (err) => {
+            this._started = true;
+            this._error(err);
+        });
     }
 
     get [Symbol.toStringTag]() {
         return 'WritableStream';
     }
 
-    async abort() {
+    get locked() {
+        return this._writer != null;
+    }
+
+    get state() {
+        return this._state;
+    }
+
+    /**
+     * 中止这个流
+     * @param {any=} reason
+     */
+    async abort(reason) {
+        if (this.locked) {
+            throw new TypeError('Cannot abort a stream that already has a writer');
+        }
 
+        return this._abort(reason);
     }
 
+    /**
+     * 关闭这个流
+     */
     async close() {
+        if (this.locked) {
+            throw new TypeError('Cannot close a stream that already has a writer');
+        }
+
+        return this._close();
+    }
+
+    /**
+     * 返回一个 writer
+     * - 将锁定这个 stream
+     * @returns {WritableStreamDefaultWriter<W>}
+     */
+    getWriter() {
+        if (this.locked) {
+            throw new TypeError('The stream is locked');
+        }
+
+        const writer = new WritableStreamDefaultWriter(this);
+        this._writer = writer;
+        return writer;
+    }
+
+    /**
+     * @param {any=} reason
+     */
+    async _abort(reason) {
+        const state = this._state;
+        if (state == 'closed' || state == 'errored') {
+            return;
+        }
+
+        const abort = this._underlyingSink?.abort;
+        const sink = this._underlyingSink;
+        this._error(reason);
+
+        if (abort) {
+            await abort.call(sink, reason);
+        }
+    }
+
+    /**
+     * 写入队列中的下一个数据块
+     */
+    _advanceQueue() {
+        const state = this._state;
+        if (!this._started || this._inFlightWrite || this._inFlightClose) {
+            return;
+
+        } else if (state != 'writable' && state != 'closing') {
+            return;
+        }
+
+        const request = this._queue.shift();
+        if (!request) {
+            if (state == 'closing') {
+                this._finishClose();
+            }
+
+            return;
+        }
+
+        this._inFlightWrite = request;
+
+        const sink = this._underlyingSink;
+        invokeAndThen(() => sink?.write?.(request.chunk, this._controller), () => {
+            this._inFlightWrite = undefined;
+            request.deferred.resolve();
+
+            const state = this._state;
+            if (state == 'writable' || state == 'closing') {
+                this._queueTotalSize = this._queue.length ? (this._queueTotalSize - request.size) : 0;
+                this._updateBackpressure();
+                this._advanceQueue();
+            }
+
+        }, (err) => {
+            this._inFlightWrite = undefined;
+            request.deferred.reject(err);
+            this._error(err);
+        });
+    }
+
+    _close() {
+        const state = this._state;
+        if (state == 'errored') {
+            return createRejected(this._storedError);
+
+        } else if (state != 'writable') {
+            return createRejected(new TypeError('The stream is closing or closed'));
+        }
+
+        this._state = 'closing';
+        this._closeRequest = createDeferred(false);
+
+        // 关闭后不再有背压
+        if (this._backpressure) {
+            this._backpressure = false;
+            this._ready.resolve();
+        }
+
+        const promise = this._closeRequest.promise;
+        this._advanceQueue();
+        return promise;
+    }
+
+    /**
+     * 使这个流出错
+     * @param {any} err
+     */
+    _error(err) {
+        const state = this._state;
+        if (state != 'writable' && state != 'closing') {
+            return;
+        }
+
+        this._state = 'errored';
+        this._storedError = err;
+        this._underlyingSink = undefined;
+        this._controller.detachStream();
+
+        // 丢弃还未写入的数据
+        const queue = this._queue;
+        this._queue = [];
+        this._queueTotalSize = 0;
+        for (const request of queue) {
+            request.deferred.reject(err);
+        }
+
+        const closeRequest = this._closeRequest;
+        if (closeRequest) {
+            this._closeRequest = undefined;
+            closeRequest.reject(err);
+        }
 
+        this._closed.reject(err);
+
+        if (!this._backpressure) {
+            this._ready = createDeferred(true);
+        }
+
+        this._backpressure = false;
+        this._ready.reject(err);
     }
 
-    async write() {
+    /**
+     * 所有数据都已写入, 关闭底层接收器
+     */
+    _finishClose() {
+        const sink = this._underlyingSink;
+        this._inFlightClose = true;
+
+        invokeAndThen(() => sink?.close?.(), () => {
+            this._inFlightClose = false;
+            if (this._state != 'closing') {
+                return;
+            }
+
+            this._state = 'closed';
+            this._underlyingSink = undefined;
+            this._controller.detachStream();
+
+            const closeRequest = this._closeRequest;
+            this._closeRequest = undefined;
+            closeRequest?.resolve();
+            this._closed.resolve();
 
+        }, (err) => {
+            this._inFlightClose = false;
+            this._error(err);
+        });
+    }
+
+    /**
+     * 返回填满内部队列还需要的大小
+     * @returns {number|null}
+     */
+    _getDesiredSize() {
+        const state = this._state;
+        if (state == 'errored') {
+            return null;
+
+        } else if (state != 'writable') {
+            return 0;
+        }
+
+        return this._highWaterMark - this._queueTotalSize;
+    }
+
+    /**
+     * 根据内部队列的大小更新 `ready`
+     */
+    _updateBackpressure() {
+        if (this._state != 'writable') {
+            return;
+        }
+
+        const backpressure = (this._getDesiredSize() || 0) <= 0;
+        if (backpressure == this._backpressure) {
+            return;
+        }
+
+        this._backpressure = backpressure;
+        if (backpressure) {
+            this._ready = createDeferred(true);
+
+        } else {
+            this._ready.resolve();
+        }
+    }
+
+    /**
+     * @param {W} chunk
+     * @returns {Promise<void>}
+     */
+    _write(chunk) {
+        const state = this._state;
+        if (state == 'errored') {
+            return createRejected(this._storedError);
+
+        } else if (state != 'writable') {
+            return createRejected(new TypeError('The stream is closing or closed'));
+        }
+
+        let size = 1;
+        const sizeOf = this._queuingStrategy?.size;
+        if (sizeOf) {
+            try {
+                size = Number(sizeOf(chunk));
+
+            } catch (err) {
+                this._error(err);
+                return createRejected(err);
+            }
+        }
+
+        /** @type Deferred<void> */
+        const deferred = createDeferred(false);
+        this._queue.push({ chunk, size, deferred });
+        this._queueTotalSize += size;
+
+        this._updateBackpressure();
+        this._advanceQueue();
+        return deferred.promise;
     }
 }
 
@@ -597,6 +1687,12 @@ export function createReadableStream(underlyingSource, queuingStrategy) {
     return new ReadableStream(underlyingSource, queuingStrategy);
 }
 
-export function createWritableStream() {
-    return new WritableStream();
+/**
+ *
+ * @param {*} underlyingSink
+ * @param {*} queuingStrategy
+ * @returns
+ */
+export function createWritableStream(underlyingSink, queuingStrategy) {
+    return new WritableStream(underlyingSink, queuingStrategy);
 }
@@ -504,7 +504,9 @@ export class TLSSocket extends EventTarget {
             }
 
             // console.log(TAG, 'event:', 'onmessage', message?.byteLength, self.bytesRead);
-            self.dispatchEvent(new MessageEvent('message', { data: message }));
+            if (self.hasEventListener('message')) {
+                self.dispatchEvent(new MessageEvent('message', { data: message }));
+            }
         };
 
         handle.onconnect = function () {
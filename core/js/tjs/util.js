@@ -10,7 +10,8 @@ export const zlib = native.zlib;
 
 const FORMATS = {
     hex: util.CODE_HEX,
-    base64: util.CODE_BASE64
+    base64: util.CODE_BASE64,
+    base64url: util.CODE_BASE64URL
 };
 
 /**
@@ -182,7 +183,7 @@ export function encodeMessage(message, options) {
 /**
  * to string
  * @param {ArrayBuffer|Uint8Array} data 
- * @param {string} format `hex`,`base64`
+ * @param {string} format `hex`,`base64`,`base64url`
  * @returns {string}
  */
 export function encode(data, format) {
@@ -201,10 +202,27 @@ export function decode(data, format) {
     return util.decode(data, type);
 }
 
+/**
+ * 解析 JSON 数据
+ * 
+ * 当 `data` 为二进制数据时直接从 UTF-8 字节解析，不需要先解码为字符串
+ * @param {string|ArrayBuffer|ArrayBufferView} data JSON 文本或 UTF-8 编码的数据
+ * @param {{ reviver?: (this: any, key: string, value: any) => any }} [options]
+ * @returns {any}
+ */
+export function parseJSON(data, options) {
+    const reviver = options?.reviver;
+    if (typeof data == 'string') {
+        return JSON.parse(data, reviver);
+    }
+
+    return reviver ? utf8.parseJSON(data, reviver) : utf8.parseJSON(data);
+}
+
 /**
  * to buffer
  * @param {string} data 
- * @param {string} format `hex`,`base64`
+ * @param {string} format `hex`,`base64`,`base64url`
  * @returns {Uint8Array}
  */
 export function toBuffer(data, format) {
@@ -0,0 +1,17 @@
+// @ts-check
+// state[0]: ping 计数, state[1]: pong 计数, state[2]: 工作线程写入的标记
+self.onmessage = (/** @type any */ event) => {
+    const { buffer, rounds } = event.data;
+    const state = new Int32Array(buffer);
+
+    Atomics.store(state, 2, 42);
+    self.postMessage('ready');
+
+    for (let i = 1; i <= rounds; i++) {
+        Atomics.wait(state, 0, i - 1);
+        Atomics.store(state, 1, i);
+        Atomics.notify(state, 1);
+    }
+
+    self.postMessage({ buffer, done: true });
+};
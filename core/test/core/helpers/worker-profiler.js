@@ -0,0 +1,16 @@
+function workerBusy(duration) {
+    const start = performance.now();
+    let count = 0;
+    while (performance.now() - start < duration) {
+        count++;
+    }
+
+    return count;
+}
+
+performance.startProfiling({ interval: 500 });
+workerBusy(100);
+
+const profile = performance.stopProfiling();
+const found = profile.nodes.some(node => node.callFrame.functionName == 'workerBusy');
+self.postMessage({ samples: profile.samples.length, found });
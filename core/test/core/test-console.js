@@ -19,3 +19,29 @@ test('console', async () => {
 
     assert.ok(console.colors);
 });
+
+test('console.fileLine', async () => {
+    const onPrintLog = console.onPrintLog;
+
+    /** @type string[] */
+    const lines = [];
+    console.onPrintLog = (/** @type string */ level, /** @type string */ line) => {
+        lines.push(line);
+        return true;
+    };
+
+    let expected = '';
+    try {
+        console.info('file line'); expected = (new Error().stack || '').split('\n')[0].trim();
+        console.error('file line');
+
+    } finally {
+        console.onPrintLog = onPrintLog;
+    }
+
+    // 报告的是调用 console 方法的位置
+    assert.equal(lines.length, 2);
+    assert.equal(lines[0], expected);
+    assert.ok(/test-console\.js:\d+\)$/.test(lines[1]));
+    assert.notEqual(lines[1], lines[0]);
+});
@@ -4,6 +4,7 @@
 import * as assert from '@tjs/assert';
 import { test } from '@tjs/test';
 
+import * as encoding from '@tjs/encoding';
 import * as util from '@tjs/util';
 
 const text = 'test123456';
@@ -42,3 +43,73 @@ test('string.length', () => {
     // @ts-ignore
     assert.equal(console.width(text), 22);
 });
+
+test('textDecoder - invalid', () => {
+    const textDecoder = new TextDecoder();
+
+    // 无效序列的最长有效前缀替换为一个 U+FFFD
+    assert.equal(textDecoder.decode(new Uint8Array([0x61, 0xff, 0x62])), 'a�b');
+    assert.equal(textDecoder.decode(new Uint8Array([0xe6, 0x88, 0x61])), '�a');
+    assert.equal(textDecoder.decode(new Uint8Array([0xed, 0xa0, 0x80])), '���');
+    assert.equal(textDecoder.decode(new Uint8Array([0xc3, 0xa9])), 'é');
+    assert.equal(textDecoder.decode(new Uint8Array([0xef, 0xbb, 0xbf, 0x61])), 'a');
+
+    const fatalDecoder = new TextDecoder('utf-8', { fatal: true });
+    assert.throws(() => fatalDecoder.decode(new Uint8Array([0x61, 0xc3])));
+    assert.equal(fatalDecoder.decode(new TextEncoder().encode('我的')), '我的');
+});
+
+test('textDecoder - stream', () => {
+    const data = new TextEncoder().encode('abc我的太阳𠮷😁'.repeat(10));
+    const textDecoder = new TextDecoder();
+
+    // 在任意位置分割, 不完整的字符留到下一次解码
+    for (const size of [1, 2, 3, 5, 7]) {
+        let output = '';
+        for (let i = 0; i < data.length; i += size) {
+            output += textDecoder.decode(data.subarray(i, i + size), { stream: true });
+        }
+
+        output += textDecoder.decode();
+        assert.equal(output, 'abc我的太阳𠮷😁'.repeat(10));
+    }
+
+    // 结束时不完整的字符替换为 U+FFFD
+    assert.equal(textDecoder.decode(new Uint8Array([0x61, 0xe6, 0x88]), { stream: true }), 'a');
+    assert.equal(textDecoder.decode(), '�');
+});
+
+test('textEncoder.encodeInto', () => {
+    const textEncoder = new TextEncoder();
+    const buffer = new Uint8Array(8);
+
+    assert.deepEqual(textEncoder.encodeInto('abc', buffer), { read: 3, written: 3 });
+
+    // 不会写入不完整的字符
+    assert.deepEqual(textEncoder.encodeInto('我的太阳', buffer), { read: 2, written: 6 });
+    assert.equal(new TextDecoder().decode(buffer.subarray(0, 6)), '我的');
+
+    assert.deepEqual(textEncoder.encodeInto('a😁b', buffer.subarray(2)), { read: 4, written: 6 });
+
+    // 单独的代理项编码为 U+FFFD
+    assert.deepEqual(Array.from(textEncoder.encode('\uD800')), [0xef, 0xbf, 0xbd]);
+    assert.deepEqual(Array.from(textEncoder.encode('é')), [0xc3, 0xa9]);
+});
+
+test('encoding.BinaryEncoder', () => {
+    const data = new Uint8Array(100).map((value, index) => index * 13);
+
+    for (const format of ['base64', 'base64url', 'hex']) {
+        const expected = encoding.encode(data, format);
+        for (const size of [1, 2, 5, 64]) {
+            const encoder = new encoding.BinaryEncoder(format);
+            let output = '';
+            for (let i = 0; i < data.length; i += size) {
+                output += encoder.encode(data.subarray(i, i + size), { stream: true });
+            }
+
+            output += encoder.encode();
+            assert.equal(output, expected, format + ':' + size);
+        }
+    }
+});
@@ -15,3 +15,42 @@ test('MessageEvent', async () => {
     assert.equal(event.type, 'test');
     assert.equal(event.data, 'data');
 });
+
+test('EventTarget - dispatch', async () => {
+    class Target extends EventTarget {}
+    events.defineEventAttribute(Target.prototype, 'message');
+
+    const target = new Target();
+    assert.equal(target.hasEventListener('message'), false);
+    assert.equal(target.onmessage, null);
+    assert.ok(target.dispatchEvent(new Event('message')));
+
+    // 单个 `onX` 监听函数
+    const received = [];
+    const onmessage = (event) => received.push('attribute:' + event.data);
+    target.onmessage = onmessage;
+    assert.equal(target.onmessage, onmessage);
+    assert.ok(target.hasEventListener('message'));
+
+    target.dispatchEvent(new MessageEvent('message', { data: 1 }));
+    assert.deepEqual(received, ['attribute:1']);
+
+    // 多个监听器, 以及 once
+    target.addEventListener('message', (event) => received.push('once:' + event.data), { once: true });
+    target.dispatchEvent(new MessageEvent('message', { data: 2 }));
+    target.dispatchEvent(new MessageEvent('message', { data: 3 }));
+    assert.deepEqual(received, ['attribute:1', 'attribute:2', 'once:2', 'attribute:3']);
+
+    // preventDefault
+    target.onmessage = (event) => event.preventDefault();
+    assert.equal(target.dispatchEvent(new Event('message', { cancelable: true })), false);
+
+    target.onmessage = null;
+    assert.equal(target.onmessage, null);
+    assert.equal(target.hasEventListener('message'), false);
+
+    target.onmessage = onmessage;
+    target.removeAllEventListeners();
+    assert.equal(target.onmessage, null);
+    assert.equal(target.hasEventListener('message'), false);
+});
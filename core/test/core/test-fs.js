@@ -44,6 +44,47 @@ async function testAppendFile() {
     assert.equal(data, 'write\n12345\n67890\n');
 }
 
+async function testWriteFile() {
+    const dirname = await fs.mkdtemp('/tmp/test_write_XXXXXX');
+    const filename = join(dirname, 'state.json');
+
+    try {
+        // 原子写入, 保留原文件的权限, 不留下临时文件
+        await fs.writeFile(filename, 'old', { mode: 0o600 });
+        await fs.writeFile(filename, new TextEncoder().encode('new'), { atomic: true, fsync: true });
+        assert.equal(await fs.readFile(filename, 'utf-8'), 'new');
+        assert.equal((await fs.stat(filename)).mode & 0o777, 0o600);
+
+        // 合并目录同步
+        const writes = [];
+        for (let i = 0; i < 8; i++) {
+            writes.push(fs.writeFile(join(dirname, `file-${i}`), String(i), { atomic: true, fsync: 'group' }));
+        }
+
+        await Promise.all(writes);
+        assert.equal(await fs.readFile(join(dirname, 'file-7'), 'utf-8'), '7');
+
+        const names = (await fs.readdir(dirname)).map((entry) => entry.name);
+        assert.equal(names.length, 9);
+        assert.ok(!names.some((name) => name.endsWith('.tmp')));
+
+        // 追加
+        await fs.appendFile(filename, new Uint8Array([0x21]).buffer, { fsync: true });
+        assert.equal(await fs.readFile(filename, 'utf-8'), 'new!');
+
+        // 失败时原文件保持不变
+        const errors = [];
+        await fs.writeFile(join(dirname, 'none/file'), 'data', { atomic: true }).catch((err) => errors.push(err));
+        await fs.writeFile(filename, 'data', { flag: 'wx' }).catch((err) => errors.push(err));
+        assert.equal(errors.length, 2);
+        assert.equal(errors[0].syscall, 'open');
+        assert.equal(await fs.readFile(filename, 'utf-8'), 'new!');
+
+    } finally {
+        await fs.rm(dirname, { recursive: true });
+    }
+}
+
 async function testHashFile() {
     const filename = join(__dirname, 'helpers/worker.js');
 
@@ -137,6 +178,232 @@ async function testOpendir() {
     assert.ok(dirs.length > 0);
 }
 
+async function testWalk() {
+    const root = await fs.mkdtemp('/tmp/test_walk_XXXXXX');
+    const copy = root + '_copy';
+
+    try {
+        // root/{0..9}, root/a/{0..9}, root/a/b/{0..9}, root/skip/file
+        let dirname = root;
+        for (const name of ['a', 'b']) {
+            for (let i = 0; i < 10; i++) {
+                await fs.writeFile(join(dirname, String(i)), String(i));
+            }
+
+            dirname = join(dirname, name);
+            await fs.mkdir(dirname);
+        }
+
+        await fs.mkdir(join(root, 'skip'));
+        await fs.writeFile(join(root, 'skip/file'), 'file');
+
+        // Dir.read(n)
+        const dir = await fs.opendir(root);
+        const entries = await dir.read(4);
+        assert.equal(entries.length, 4);
+        assert.ok(entries[0].name && entries[0].type);
+        assert.equal((await dir.read(100)).length, 8);
+        assert.equal((await dir.read(100)).length, 0);
+        await dir.close();
+
+        // walk
+        const paths = [];
+        let batches = 0;
+        const filter = (entry) => entry.name != 'skip';
+        for await (const entries of fs.walk(root, { batchSize: 8, stat: true, filter })) {
+            batches++;
+            for (const entry of entries) {
+                assert.ok(entry.stat);
+                paths.push(entry.path.slice(root.length + 1));
+            }
+        }
+
+        assert.ok(batches > 1);
+        assert.equal(paths.length, 22);
+        assert.ok(paths.includes('a/b'));
+        assert.ok(paths.includes('a/9'));
+        assert.ok(!paths.some((path) => path.startsWith('skip')));
+        assert.ok(paths.indexOf('a') < paths.indexOf('a/0'));
+
+        // maxDepth
+        let count = 0;
+        for await (const entries of fs.walk(root, { maxDepth: 1 })) {
+            count += entries.length;
+        }
+
+        assert.equal(count, 12);
+
+        // cp -r, rm -r
+        await fs.cp(root, copy, { recursive: true });
+        assert.equal(await fs.readTextFile(join(copy, 'a/9')), '9');
+        assert.equal(await fs.readTextFile(join(copy, 'skip/file')), 'file');
+
+        await fs.rm(copy, { recursive: true });
+        assert.equal(await fs.exists(copy), false);
+
+        // 源目录以 '/' 结尾
+        await fs.cp(root + '/', copy, { recursive: true });
+        assert.equal(await fs.readTextFile(join(copy, 'a/9')), '9');
+        assert.equal(await fs.readTextFile(join(copy, 'skip/file')), 'file');
+        await fs.rm(copy, { recursive: true });
+
+    } finally {
+        await fs.rm(root, { recursive: true, force: true });
+        await fs.rm(copy, { recursive: true, force: true });
+    }
+
+    assert.equal(await fs.exists(root), false);
+}
+
+async function testBuffers() {
+    const filename = '/tmp/test_buffers_wotjs';
+    const encoder = new TextEncoder();
+    const decoder = new TextDecoder();
+
+    const file = await fs.open(filename, 'w+');
+    try {
+        assert.equal(await file.writev([encoder.encode('hello '), encoder.encode('world')], 0), 11);
+        assert.equal(await file.writeFrom(encoder.encode('!'), 11), 1);
+
+        const head = new Uint8Array(5);
+        const tail = new Uint8Array(16);
+        assert.equal(await file.readv([head, tail], 0), 12);
+        assert.equal(decoder.decode(head), 'hello');
+        assert.equal(decoder.decode(tail.subarray(0, 7)), ' world!');
+
+        const buffer = new Uint8Array(10);
+        assert.equal(await file.readInto(buffer.subarray(2, 7), 6), 5);
+        assert.equal(decoder.decode(buffer.subarray(2, 7)), 'world');
+
+        assert.throws(() => file.readv([]));
+
+    } finally {
+        await file.close();
+    }
+
+    // 循环使用缓存区的文件流
+    const stream = await fs.readableStream(filename, { chunkSize: 4, recycle: true });
+    const reader = stream.getReader();
+    let text = '';
+    for (;;) {
+        const result = await reader.read();
+        if (result.done) {
+            break;
+        }
+
+        text += decoder.decode(result.value);
+    }
+
+    assert.equal(text, 'hello world!');
+    await fs.unlink(filename);
+}
+
+async function testMmap() {
+    const filename = '/tmp/test_mmap_wotjs';
+    const data = new Uint8Array(10000);
+    for (let i = 0; i < data.length; i++) {
+        data[i] = i & 0xff;
+    }
+
+    await fs.writeFile(filename, data);
+
+    try {
+        const buffer = fs.mmap(filename, { advice: 'sequential' });
+        assert.equal(buffer.byteLength, 10000);
+        assert.equal(new Uint8Array(buffer)[9999], 9999 & 0xff);
+        fs.madvise(buffer, 'random');
+
+        // 未按页对齐的偏移位置
+        const part = new Uint8Array(fs.mmap(filename, { offset: 5000, length: 100 }));
+        assert.equal(part.length, 100);
+        assert.equal(part[0], 5000 & 0xff);
+
+        // 只读映射的修改不会写回文件, 也不会被同一区域的其他只读映射看到
+        const other = new Uint8Array(fs.mmap(filename));
+        new Uint8Array(buffer)[0] = 0xaa;
+        assert.equal(other[0], 0);
+        const text = await fs.readFile(filename);
+        assert.equal(text[0], 0);
+
+        // 只接受 mmap() 返回的内存, 不会修改普通的 ArrayBuffer
+        const heap = new Uint8Array(8192).fill(1);
+        assert.throws(() => fs.madvise(heap, 'dontneed'));
+        assert.throws(() => fs.madvise(new ArrayBuffer(16), 'dontneed'));
+        assert.equal(heap[4096], 1);
+
+        // 视图也可以, 范围限制在映射内
+        fs.madvise(part.subarray(10, 20), 'willneed');
+
+        // 对同一区域的映射共用同一块内存, 可写映射会写回文件
+        const shared1 = new Uint8Array(fs.mmap(filename, { readonly: false }));
+        const shared2 = new Uint8Array(fs.mmap(filename, { readonly: false }));
+        shared1[1] = 0xbb;
+        assert.equal(shared2[1], 0xbb);
+        assert.equal((await fs.readFile(filename))[1], 0xbb);
+
+        assert.equal(fs.mmap(filename, { offset: 10000 }).byteLength, 0);
+        assert.throws(() => fs.mmap(filename, { offset: 20000 }));
+        assert.throws(() => fs.mmap('/tmp/test_mmap_not_exists'));
+
+    } finally {
+        await fs.unlink(filename);
+    }
+}
+
+async function testWatch() {
+    const root = await fs.mkdtemp('/tmp/test_watch_XXXXXX');
+
+    /** @type {(events: any[]) => void} */
+    let onchange = () => {};
+    const nextEvents = () => new Promise((resolve) => { onchange = resolve; });
+    const watcher = fs.watch(root, { recursive: true, delay: 100 }, (events) => onchange(events));
+
+    try {
+        // 连续的修改被合并成一个 create 事件, 创建后又删除的文件不报告
+        let promise = nextEvents();
+        await fs.writeFile(join(root, 'a.txt'), 'a');
+        await fs.appendFile(join(root, 'a.txt'), 'b');
+        await fs.writeFile(join(root, 'b.txt'), 'b');
+        await fs.unlink(join(root, 'b.txt'));
+
+        let events = await promise;
+        assert.deepEqual(events.map((event) => event.type + ':' + event.path), ['create:' + join(root, 'a.txt')]);
+
+        // 重命名
+        promise = nextEvents();
+        await fs.rename(join(root, 'a.txt'), join(root, 'c.txt'));
+        events = await promise;
+        assert.equal(events.length, 1);
+        assert.equal(events[0].type, 'rename');
+        assert.equal(events[0].oldPath, join(root, 'a.txt'));
+        assert.equal(events[0].path, join(root, 'c.txt'));
+
+        // 新创建的子目录也会被监视
+        promise = nextEvents();
+        await fs.mkdir(join(root, 'sub'));
+        events = await promise;
+        assert.equal(events[0].type, 'create');
+        assert.equal(events[0].directory, true);
+
+        promise = nextEvents();
+        await fs.writeFile(join(root, 'sub/d.txt'), 'd');
+        events = await promise;
+        assert.equal(events[0].path, join(root, 'sub/d.txt'));
+
+        // utimes
+        promise = nextEvents();
+        await fs.utimes(join(root, 'c.txt'), 1000, new Date(2000 * 1000));
+        events = await promise;
+        assert.equal(events[0].type, 'attrib');
+        const stat = await fs.stat(join(root, 'c.txt'));
+        assert.equal(Math.round(stat.mtime), 2000);
+
+    } finally {
+        watcher.close();
+        await fs.rm(root, { recursive: true });
+    }
+}
+
 async function testStatFs() {
     const filename = '/usr/local/bin/tjs';
     const realpath = await fs.realpath(filename);
@@ -170,11 +437,16 @@ async function testOpen() {
 }
 
 test('fs.access', testAccess);
+test('fs.buffers', testBuffers);
 test('fs.appendFile', testAppendFile);
 test('fs.filesum', testHashFile);
 test('fs.mkdir', testMkdir);
 test('fs.mkstemp', testMkstemp);
+test('fs.mmap', testMmap);
 test('fs.open', testOpen);
 test('fs.opendir', testOpendir);
 test('fs.stat', testStat);
 test('fs.statfs', testStatFs);
+test('fs.walk', testWalk);
+test('fs.writeFile', testWriteFile);
+test('fs.watch', testWatch);
@@ -0,0 +1,142 @@
+// @ts-check
+/// <reference path ="../../types/index.d.ts" />
+
+import * as assert from '@tjs/assert';
+import { test } from '@tjs/test';
+
+import * as json from '@tjs/json';
+import * as streams from '@tjs/streams';
+
+const textDecoder = new TextDecoder();
+const textEncoder = new TextEncoder();
+
+/**
+ * @param {any} value
+ * @param {json.StringifyOptions} [options]
+ */
+function stringify(value, options) {
+    let text = '';
+    for (const chunk of json.stringifyChunks(value, options)) {
+        text += textDecoder.decode(chunk, { stream: true });
+    }
+
+    return text + textDecoder.decode();
+}
+
+test('json.stringifyChunks', () => {
+    const values = [
+        0, -1.5, NaN, null, true, 'text', '中文 "\\\n\u0001 😁 \ud800', undefined,
+        [], {}, [1, undefined, () => 1, null], { a: undefined, b: [{}], c: () => 1, 'k"ey': 'v' },
+        { date: new Date(0), number: new Number(1), string: new String('s') },
+        { value: { toJSON(key) { return 'key:' + key; } } }
+    ];
+
+    for (const value of values) {
+        assert.equal(stringify(value), JSON.stringify(value) ?? '');
+        assert.equal(stringify(value, { space: 2 }), JSON.stringify(value, null, 2) ?? '');
+        assert.equal(stringify(value, { space: '\t' }), JSON.stringify(value, null, '\t') ?? '');
+    }
+
+    // 分块的大小
+    const records = [];
+    for (let i = 0; i < 1000; i++) {
+        records.push({ id: i, name: '设备-' + i, values: [i / 3, i], text: 'x'.repeat(i % 100) });
+    }
+
+    records.push({ text: '长'.repeat(20000) });
+
+    let text = '';
+    for (const chunk of json.stringifyChunks(records, { chunkSize: 1024 })) {
+        assert.ok(chunk.byteLength < 1024 * 2, 'chunk size');
+        text += textDecoder.decode(chunk, { stream: true });
+    }
+
+    assert.equal(text, JSON.stringify(records));
+
+    // 错误
+    const object = { list: [] };
+    object.list.push(object);
+    assert.throws(() => stringify(object), TypeError);
+    assert.throws(() => stringify({ value: 1n }), TypeError);
+});
+
+test('json.stringifyStream', async () => {
+    const value = { list: new Array(100).fill('test') };
+    const stream = json.stringifyStream(value, { chunkSize: 64 });
+    const reader = stream.getReader();
+
+    let text = '';
+    let count = 0;
+    while (true) {
+        const result = await reader.read();
+        if (result.done) {
+            break;
+        }
+
+        text += textDecoder.decode(result.value);
+        count++;
+    }
+
+    assert.ok(count > 1);
+    assert.equal(text, JSON.stringify(value));
+});
+
+test('json.JSONParser', () => {
+    const records = [1, 'a],"b', { a: [1, { b: '}' }] }, [], null, true, -2.5e3];
+    const data = textEncoder.encode('﻿ ' + JSON.stringify(records, null, 2));
+
+    // 每次写入一个字节
+    let parser = new json.JSONParser();
+    let output = [];
+    for (let i = 0; i < data.byteLength; i++) {
+        output.push(...parser.write(data.subarray(i, i + 1)));
+    }
+
+    output.push(...parser.end());
+    assert.deepEqual(output, records);
+
+    // 根值不是数组
+    parser = new json.JSONParser();
+    assert.deepEqual(parser.write(textEncoder.encode('{"a":')), []);
+    assert.deepEqual(parser.write(textEncoder.encode('1}')), []);
+    assert.deepEqual(parser.end(), [{ a: 1 }]);
+
+    // 无效的数据
+    for (const text of ['[1,]', '[1 2]', '[1', '', '[tru]', '[1] 2']) {
+        parser = new json.JSONParser();
+        assert.throws(() => {
+            parser.write(textEncoder.encode(text));
+            parser.end();
+        }, SyntaxError, text);
+    }
+
+    parser = new json.JSONParser({ maxLength: 8 });
+    assert.throws(() => parser.write(textEncoder.encode('["0123456789"]')), RangeError);
+});
+
+test('json.parseStream', async () => {
+    const records = [];
+    for (let i = 0; i < 100; i++) {
+        records.push({ id: i, name: '设备-' + i });
+    }
+
+    const chunks = json.stringifyChunks(records, { chunkSize: 100 });
+    const stream = streams.createReadableStream({
+        async pull(controller) {
+            const result = chunks.next();
+            if (result.done) {
+                controller.close();
+
+            } else {
+                controller.enqueue(result.value);
+            }
+        }
+    });
+
+    const output = [];
+    for await (const record of json.parseStream(stream)) {
+        output.push(record);
+    }
+
+    assert.deepEqual(output, records);
+});
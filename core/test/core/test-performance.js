@@ -0,0 +1,178 @@
+// @ts-check
+/// <reference path ="../../types/index.d.ts" />
+
+import * as assert from '@tjs/assert';
+import { test } from '@tjs/test';
+
+import * as fs from '@tjs/fs';
+import { dirname, join } from '@tjs/path';
+
+function fib(n) {
+    return n < 2 ? n : fib(n - 1) + fib(n - 2);
+}
+
+function busy(duration) {
+    const start = performance.now();
+    let count = 0;
+    while (performance.now() - start < duration) {
+        count += fib(10);
+    }
+
+    return count;
+}
+
+test('performance - mark/measure', () => {
+    performance.mark('start');
+    performance.mark('end');
+    performance.measure('test', 'start', 'end');
+
+    const entries = performance.getEntriesByName('test');
+    assert.equal(entries.length, 1);
+    assert.equal(entries[0].entryType, 'measure');
+
+    performance.clearMarks();
+    performance.clearMeasures();
+    assert.equal(performance.getEntriesByType('mark').length, 0);
+});
+
+test('performance - profiling', () => {
+    assert.equal(performance.isProfiling, false);
+    assert.equal(performance.stopProfiling(), undefined);
+
+    performance.startProfiling({ interval: 500 });
+    assert.equal(performance.isProfiling, true);
+    assert.throws(() => performance.startProfiling());
+
+    busy(100);
+
+    const profile = performance.stopProfiling();
+    assert.equal(performance.isProfiling, false);
+    assert.ok(profile.samples.length > 0);
+    assert.equal(profile.samples.length, profile.timeDeltas.length);
+    assert.ok(profile.endTime >= profile.startTime);
+
+    // 调用树
+    const root = profile.nodes[0];
+    assert.equal(root.id, 1);
+    assert.equal(root.callFrame.functionName, '(root)');
+
+    const node = profile.nodes.find(node => node.callFrame.functionName == 'busy');
+    assert.ok(node, 'busy');
+    assert.ok(node.callFrame.url.endsWith('test-performance.js'));
+    assert.equal(node.callFrame.lineNumber, 13); // 从 0 开始
+
+    const hitCount = profile.nodes.reduce((total, node) => total + node.hitCount, 0);
+    assert.equal(hitCount, profile.samples.length);
+
+    // 环形缓存区
+    performance.startProfiling({ interval: 100, maxSamples: 10 });
+    busy(50);
+    assert.ok(performance.stopProfiling().samples.length <= 10);
+
+    // 折叠的调用栈
+    performance.startProfiling({ interval: 500 });
+    busy(50);
+
+    const text = performance.stopProfiling({ format: 'collapsed' });
+    const lines = text.split('\n');
+    assert.ok(lines.length > 0);
+    for (const line of lines) {
+        assert.ok(/^\(root\)(;[^;]+)* \d+$/.test(line), line);
+    }
+
+    assert.ok(lines.some(line => line.includes(';busy (')));
+});
+
+test('performance - profiling - worker', async () => {
+    // @ts-ignore
+    const __filename = import.meta.url.slice(7); // strip "file://"
+    const filename = join(dirname(__filename), 'helpers', 'worker-profiler.js');
+    const worker = new Worker(filename);
+
+    const data = await new Promise((resolve, reject) => {
+        const timer = setTimeout(() => reject(new Error('worker timeout')), 5000);
+
+        worker.onmessage = event => {
+            clearTimeout(timer);
+            resolve(event.data);
+        };
+    });
+
+    worker.terminate();
+    assert.ok(data.samples > 0);
+    assert.ok(data.found, 'worker function');
+});
+
+class HeapItem {
+    constructor(index) {
+        this.data = { index };
+    }
+}
+
+test('performance - memory', () => {
+    /** @type HeapItem[] */
+    const items = [];
+    for (let i = 0; i < 100; i++) {
+        items.push(new HeapItem(i));
+    }
+
+    const memory = performance.memory;
+    assert.ok(memory.usedJSHeapSize > 0);
+    assert.ok(memory.totalJSHeapSize > 0);
+    assert.ok(memory.jsHeapSizeLimit > 0);
+    assert.ok(memory.objectCount >= items.length);
+
+    // HeapItem 的实例的类为 Object
+    const object = memory.classes.find(item => item.name == 'Object');
+    assert.ok(object && object.count >= items.length && object.size > 0);
+
+    // 原生对象
+    const timers = memory.native.timer.count;
+    const timer = setTimeout(() => { }, 1000);
+    assert.equal(performance.memory.native.timer.count, timers + 1);
+    assert.ok(performance.memory.native.timer.size > 0);
+    clearTimeout(timer);
+
+    for (const name of ['stream', 'tls', 'udp', 'write', 'dbuffer']) {
+        assert.ok(memory.native[name].count >= 0, name);
+    }
+});
+
+test('performance - heapSnapshot', async () => {
+    /** @type HeapItem[] */
+    const items = [];
+    for (let i = 0; i < 100; i++) {
+        items.push(new HeapItem(i));
+    }
+
+    const filename = '/tmp/tjs-test.heapsnapshot';
+    assert.equal(await performance.heapSnapshot(filename), filename);
+
+    const snapshot = JSON.parse(await fs.readFile(filename, 'utf-8'));
+    await fs.unlink(filename);
+
+    const fields = snapshot.snapshot.meta.node_fields.length;
+    const { nodes, edges, strings } = snapshot;
+    assert.equal(nodes.length, snapshot.snapshot.node_count * fields);
+    assert.equal(edges.length, snapshot.snapshot.edge_count * 3);
+
+    // 按构造函数的名称统计对象
+    let count = 0;
+    let edgeCount = 0;
+    for (let i = 0; i < nodes.length; i += fields) {
+        if (strings[nodes[i + 1]] == 'HeapItem') {
+            count++;
+        }
+
+        edgeCount += nodes[i + 4];
+    }
+
+    assert.ok(count >= items.length);
+    assert.equal(edgeCount, snapshot.snapshot.edge_count);
+    assert.equal(strings[nodes[1]], '(GC roots)');
+
+    // 属性引用: [type, name_or_index, to_node], 2 为 property
+    const name = strings.indexOf('data');
+    assert.ok(name > 0);
+    assert.ok(edges.some((value, i) => i % 3 == 1 && value == name && edges[i - 1] == 2));
+});
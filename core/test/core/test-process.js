@@ -49,3 +49,9 @@ function testEnv() {
 
 test('process', testProcess);
 test('process.env', testEnv);
+
+test('process.exec', async () => {
+    const result = await process.exec('echo hello world', { lines: true });
+    assert.equal(result.code, 0);
+    assert.deepEqual(result.stdout, ['hello world']);
+});
@@ -535,3 +535,299 @@ test('readable-stream-error', async () => {
         window.removeEventListener('unhandledrejection', onUnhandledRejection);
     }
 });
+
+/**
+ * 测试字节流和 BYOB 模式
+ */
+test('readable-stream-bytes', async () => {
+    // 1. 从内部队列中复制数据到调用者的缓存区
+    /** @type any */
+    const readable = new streams.ReadableStream({
+        type: 'bytes',
+        start: (controller) => {
+            controller.enqueue(new Uint8Array([1, 2, 3, 4, 5, 6]));
+            controller.enqueue(new Uint8Array([7, 8, 9, 10]));
+            controller.close();
+        }
+    });
+
+    assert.throws(() => new streams.ReadableStream({ start() { } }).getReader({ mode: 'byob' }), TypeError);
+
+    const reader = readable.getReader({ mode: 'byob' });
+    const buffer = new Uint8Array(8);
+    let data = await reader.read(buffer.subarray(0, 4));
+    assert.equal(data.done, false);
+    assert.equal(data.value.buffer, buffer.buffer);
+    assert.deepEqual(Array.from(data.value), [1, 2, 3, 4]);
+
+    // 跨越两个数据块
+    data = await reader.read(buffer);
+    assert.deepEqual(Array.from(data.value), [5, 6, 7, 8, 9, 10]);
+
+    data = await reader.read(buffer);
+    assert.equal(data.done, true);
+    assert.equal(data.value.byteLength, 0);
+
+    // 2. 数据源通过 byobRequest 直接写入调用者的缓存区
+    let count = 0;
+    /** @type any */
+    const source = new streams.ReadableStream({
+        type: 'bytes',
+        pull: (controller) => {
+            const request = controller.byobRequest;
+            if (count++ >= 2) {
+                controller.close();
+                return;
+            }
+
+            const view = request.view;
+            new Uint8Array(view.buffer, view.byteOffset, view.byteLength).fill(count);
+            request.respond(view.byteLength);
+        }
+    });
+
+    const byobReader = source.getReader({ mode: 'byob' });
+    const view = new Uint16Array(2);
+    data = await byobReader.read(view);
+    assert.equal(data.value.buffer, view.buffer);
+    assert.ok(data.value instanceof Uint16Array);
+    assert.deepEqual(Array.from(data.value), [0x0101, 0x0101]);
+
+    data = await byobReader.read(view);
+    assert.deepEqual(Array.from(data.value), [0x0202, 0x0202]);
+
+    data = await byobReader.read(view);
+    assert.equal(data.done, true);
+});
+
+/**
+ * 测试 BYOB 模式下数据不是元素大小的整数倍
+ */
+test('readable-stream-bytes-partial', async () => {
+    // 1. 不足一个元素的剩余字节留给下次读取
+    /** @type any */
+    const readable = new streams.ReadableStream({
+        type: 'bytes',
+        start: (controller) => {
+            controller.enqueue(new Uint8Array([1, 2, 3]));
+            controller.enqueue(new Uint8Array([4]));
+            controller.enqueue(new Uint8Array([5]));
+            controller.close();
+        }
+    });
+
+    const reader = readable.getReader({ mode: 'byob' });
+    let data = await reader.read(new Uint16Array(4));
+    assert.deepEqual(Array.from(data.value), [0x0201, 0x0403]);
+
+    // 流已关闭, 剩余的 1 个字节不足一个元素
+    try {
+        await reader.read(new Uint16Array(4));
+        assert.fail('read');
+
+    } catch (e) {
+        assert.ok(e instanceof TypeError);
+    }
+
+    // 2. 数据源通过 byobRequest 写入的字节数不是元素大小的整数倍
+    const chunks = [[1, 2, 3], [4], [5], [6]];
+    /** @type any */
+    const source = new streams.ReadableStream({
+        type: 'bytes',
+        pull: (controller) => {
+            const request = controller.byobRequest;
+            const chunk = chunks.shift();
+            if (!chunk) {
+                controller.close();
+                return;
+            }
+
+            new Uint8Array(request.view.buffer, request.view.byteOffset).set(chunk);
+            request.respond(chunk.length);
+        }
+    });
+
+    const byobReader = source.getReader({ mode: 'byob' });
+    data = await byobReader.read(new Uint16Array(2));
+    assert.deepEqual(Array.from(data.value), [0x0201]);
+
+    data = await byobReader.read(new Uint16Array(2));
+    assert.deepEqual(Array.from(data.value), [0x0403]);
+
+    data = await byobReader.read(new Uint16Array(2));
+    assert.deepEqual(Array.from(data.value), [0x0605]);
+
+    data = await byobReader.read(new Uint16Array(2));
+    assert.equal(data.done, true);
+});
+
+/**
+ * 测试高水位线
+ */
+test('readable-stream-high-water-mark', async () => {
+    let pullCount = 0;
+
+    /** @type any */
+    let readController = null;
+
+    /** @type any */
+    const readable = new streams.ReadableStream({
+        type: 'bytes',
+        start: (controller) => {
+            readController = controller;
+        },
+        pull: () => {
+            pullCount++;
+        }
+    }, { highWaterMark: 8 });
+
+    assert.equal(readController.desiredSize, 8);
+    readController.enqueue(new Uint8Array(4));
+    assert.equal(readController.desiredSize, 4);
+    readController.enqueue(new Uint8Array(6));
+    assert.equal(readController.desiredSize, -2);
+    assert.equal(pullCount, 0);
+
+    // 读取后低于高水位线时调用 pull
+    const reader = readable.getReader();
+    const data = await reader.read();
+    assert.equal(data.value.byteLength, 4);
+    assert.equal(readController.desiredSize, 2);
+    assert.equal(pullCount, 1);
+
+    readController.close();
+    assert.equal(readController.desiredSize, 0);
+});
+
+/**
+ * 测试 WritableStream 和 pipeTo 的背压
+ */
+test('writable-stream-pipe', async () => {
+    const total = 20;
+    let produced = 0;
+    let maxPending = 0;
+
+    /** @type number[] */
+    const written = [];
+    let isClosed = false;
+
+    const readable = new streams.ReadableStream({
+        pull: (controller) => {
+            controller.enqueue(produced++);
+            if (produced >= total) {
+                controller.close();
+            }
+        }
+    });
+
+    const writable = new streams.WritableStream({
+        write: async (chunk) => {
+            maxPending = Math.max(maxPending, produced - written.length);
+            await util.sleep(1);
+            written.push(chunk);
+        },
+        close: () => {
+            isClosed = true;
+        }
+    }, { highWaterMark: 2 });
+
+    await readable.pipeTo(writable);
+    assert.deepEqual(written, Array.from({ length: total }, (_, i) => i));
+    assert.ok(isClosed);
+
+    // 数据源最多领先写入 highWaterMark + 读取缓存的数据块
+    assert.ok(maxPending <= 4, 'maxPending: ' + maxPending);
+
+    // 背压和中止
+    const slow = new streams.WritableStream({
+        write: () => util.sleep(10)
+    });
+
+    const writer = slow.getWriter();
+    assert.equal(writer.desiredSize, 1);
+    await writer.write(0);
+
+    // 正在写入的数据块不受中止影响
+    const write1 = writer.write(1);
+    const write2 = writer.write(2);
+    assert.equal(writer.desiredSize, -1);
+
+    const error = new Error('abort');
+    await writer.abort(error);
+    await write1;
+    assert.equal(await write2.catch(err => err), error);
+    assert.equal(await writer.closed.catch(err => err), error);
+    assert.equal(await writer.write(3).catch(err => err), error);
+});
+
+/**
+ * 测试 WritableStream 出错时不会输出 "Unhandled promise rejection"
+ */
+test('writable-stream-unhandled-rejection', async () => {
+    /** @type any[] */
+    const rejections = [];
+
+    /** @param {any} event */
+    function onUnhandledRejection(event) {
+        rejections.push(event.reason);
+        event.preventDefault();
+    }
+
+    window.addEventListener('unhandledrejection', onUnhandledRejection);
+
+    try {
+        // 接收器同步抛出异常, 调用者处理了所有返回的 promise
+        const error = new Error('write-error');
+        const writable = new streams.WritableStream({
+            write: () => {
+                throw error;
+            }
+        });
+
+        const writer = writable.getWriter();
+        assert.equal(await writer.write(1).catch(err => err), error);
+        assert.equal(await writer.close().catch(err => err), error);
+        assert.equal(await writer.write(2).catch(err => err), error);
+
+        // 没有使用的 closed 和 ready
+        const failed = new streams.WritableStream({
+            start: () => {
+                throw new Error('start-error');
+            },
+            close: () => {
+                throw new Error('close-error');
+            }
+        });
+
+        await util.sleep(1);
+        assert.equal(failed.state, 'errored');
+
+        const unused = new streams.WritableStream({
+            close: () => {
+                throw new Error('close-error');
+            }
+        });
+
+        await unused.close().catch(() => { });
+        assert.equal(unused.state, 'errored');
+
+        // 释放锁之后的 closed 和 ready
+        const released = new streams.WritableStream({}).getWriter();
+        released.releaseLock();
+        assert.equal((await released.closed.catch(err => err)).name, 'TypeError');
+        assert.equal((await released.ready.catch(err => err)).name, 'TypeError');
+
+        // 中止信号在 pipeTo 之前已被触发
+        const controller = new AbortController();
+        controller.abort();
+        const readable = new streams.ReadableStream({});
+        const result = await readable.pipeTo(new streams.WritableStream({}), { signal: controller.signal }).catch(err => err);
+        assert.equal(result.name, 'AbortError');
+
+        await util.sleep(10);
+        assert.deepEqual(rejections, []);
+
+    } finally {
+        window.removeEventListener('unhandledrejection', onUnhandledRejection);
+    }
+});
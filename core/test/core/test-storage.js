@@ -2,6 +2,7 @@
 /// <reference path ="../../types/index.d.ts" />
 
 import * as assert from '@tjs/assert';
+import * as fs from '@tjs/fs';
 import * as storage from '@tjs/storage';
 import { test } from '@tjs/test';
 
@@ -56,3 +57,58 @@ test('localStorage', async () => {
     assert.equal(localStorage.length, 0);
     assert.equal(localStorage.key(0), null);
 });
+
+test('FileStorage', async () => {
+    const filename = `/tmp/tjs-test-storage-${process.pid}.db`;
+    await fs.rm(filename, { force: true });
+
+    const largeValue = 'x'.repeat(1024);
+    let profile = new storage.FileStorage(filename);
+    await profile.open();
+    profile.setItem('a', 1);
+    profile.setItem('b', { b: 2 });
+    profile.setItem('large', largeValue);
+    profile.removeItem('a');
+    await profile.close();
+
+    // 重新打开, 大的值只在读取时加载
+    profile = new storage.FileStorage(filename);
+    await profile.open();
+    assert.equal(profile.length, 2);
+    assert.equal(profile.getItem('a'), null);
+    assert.deepEqual(profile.getItem('b'), { b: 2 });
+    assert.equal(typeof profile.values.get('large'), 'object');
+    assert.equal(profile.getItem('large'), largeValue);
+
+    // 无效数据过多时自动压缩
+    for (let i = 0; i < 200; i++) {
+        profile.setItem('large', largeValue + i);
+        await profile.flush();
+    }
+
+    assert.ok(profile.size < 200 * 1024);
+    assert.equal(profile.getItem('large'), largeValue + 199);
+    await profile.close();
+
+    // 不完整的记录会被丢弃
+    const file = await fs.open(filename, 'a');
+    await file.write('#12345678,100\nc=');
+    await file.close();
+
+    profile = new storage.FileStorage(filename);
+    await profile.open();
+    assert.equal(profile.length, 2);
+    assert.equal(profile.getItem('large'), largeValue + 199);
+    assert.deepEqual(profile.getItem('b'), { b: 2 });
+    await profile.close();
+
+    // 兼容旧格式
+    await fs.writeFile(filename, '$5,d=100\n$7,e="abc"\n');
+    profile = new storage.FileStorage(filename);
+    await profile.open();
+    assert.equal(profile.getItem('d'), 100);
+    assert.equal(profile.getItem('e'), 'abc');
+    await profile.close();
+
+    await fs.rm(filename, { force: true });
+});
@@ -77,6 +77,62 @@ test('util.encode.base64', () => {
     assert.equal(output, text);
 });
 
+test('util.encode.base64url', () => {
+    const vectors = ['', 'f', 'fo', 'foo', 'foob', 'fooba', 'foobar'];
+    const base64 = ['', 'Zg==', 'Zm8=', 'Zm9v', 'Zm9vYg==', 'Zm9vYmE=', 'Zm9vYmFy'];
+    vectors.forEach((value, index) => {
+        const data = util.toBuffer(value);
+        assert.equal(util.encode(data, 'base64'), base64[index]);
+        assert.equal(util.encode(data, 'base64url'), base64[index].replace(/=/g, ''));
+        assert.equal(util.toString(util.decode(base64[index], 'base64')), value);
+        assert.equal(util.toString(util.decode(base64[index].replace(/=/g, ''), 'base64url')), value);
+    });
+
+    const data = new Uint8Array([0xfb, 0xff, 0xbf]);
+    assert.equal(util.encode(data, 'base64'), '+/+/');
+    assert.equal(util.encode(data, 'base64url'), '-_-_');
+    assert.deepEqual(Array.from(util.decode('-_-_', 'base64')), [0xfb, 0xff, 0xbf]);
+});
+
+test('util.decode.whitespace', () => {
+    assert.equal(util.toString(util.decode(' Zm9v\r\nYmFy\n', 'base64')), 'foobar');
+    assert.equal(util.toString(util.decode('Zm9v YmE=\n', 'base64')), 'fooba');
+    assert.deepEqual(Array.from(util.decode('DE ad\nBe ef', 'hex')), [0xde, 0xad, 0xbe, 0xef]);
+
+    // 无效的字符
+    for (const value of ['Zm9v!', 'Z', 'Zg==Zg==', 'Zm9v=', 'Zm9vé']) {
+        assert.throws(() => util.decode(value, 'base64'), TypeError, value);
+    }
+
+    for (const value of ['abc', 'zz', 'a b']) {
+        assert.throws(() => util.decode(value, 'hex'), TypeError, value);
+    }
+});
+
+test('util.parseJSON', () => {
+    const encoder = new TextEncoder();
+    const value = { name: '温度', values: [1, 2.5, null, true], nested: { text: 'a"b\\c' } };
+    const data = encoder.encode(JSON.stringify(value));
+
+    assert.deepEqual(util.parseJSON(data), value);
+    assert.deepEqual(util.parseJSON(data.buffer), value);
+    assert.deepEqual(util.parseJSON(encoder.encode('[1][2]').subarray(3)), [2]);
+    assert.deepEqual(util.parseJSON(JSON.stringify(value)), value);
+
+    // BOM
+    assert.deepEqual(util.parseJSON(new Uint8Array([0xef, 0xbb, 0xbf, 0x5b, 0x31, 0x5d])), [1]);
+
+    // reviver
+    const reviver = (key, value) => (typeof value == 'number') ? value * 2 : value;
+    assert.deepEqual(util.parseJSON(encoder.encode('{"a":1,"b":[2]}'), { reviver }), { a: 2, b: [4] });
+
+    // 无效的 UTF-8 字节序列被替换为 U+FFFD
+    assert.equal(util.parseJSON(new Uint8Array([0x22, 0x61, 0xff, 0x62, 0x22])), 'a\ufffdb');
+
+    assert.throws(() => util.parseJSON(encoder.encode('{"a":')), SyntaxError);
+    assert.throws(() => util.parseJSON(new Uint8Array(0)), SyntaxError);
+});
+
 test('util.types', async () => {
     // isArray
     assert.ok(!util.types.isArray(null));
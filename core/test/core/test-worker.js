@@ -38,3 +38,74 @@ test('worker', async () => {
 
     await promise;
 });
+
+test('worker - SharedArrayBuffer', async () => {
+    // @ts-ignore
+    const __filename = import.meta.url.slice(7); // strip "file://"
+    const filename = join(dirname(__filename), 'helpers', 'worker-atomics.js');
+    const worker = new Worker(filename);
+
+    const rounds = 100;
+    const buffer = new SharedArrayBuffer(16);
+    const state = new Int32Array(buffer);
+
+    /** @type any[] */
+    const messages = [];
+    worker.onmessage = event => messages.push(event.data);
+    worker.postMessage({ buffer, rounds });
+
+    // 主线程不能阻塞
+    assert.throws(() => Atomics.wait(state, 0, 0, 1), TypeError);
+
+    // 工作线程直接修改共享的内存
+    const start = Date.now();
+    while (messages.length < 1 && Date.now() - start < 1000) {
+        await new Promise(resolve => setTimeout(resolve, 1));
+    }
+
+    assert.equal(messages[0], 'ready');
+    assert.equal(state[2], 42);
+
+    // ping-pong: 工作线程使用 Atomics.wait, 主线程使用 Atomics.waitAsync
+    for (let i = 1; i <= rounds; i++) {
+        Atomics.store(state, 0, i);
+        Atomics.notify(state, 0);
+
+        const result = Atomics.waitAsync(state, 1, i - 1, 1000);
+        if (result.async) {
+            assert.equal(await result.value, 'ok');
+        }
+
+        assert.equal(Atomics.load(state, 1), i);
+    }
+
+    // 传回来的仍然是同一块内存
+    while (messages.length < 2 && Date.now() - start < 2000) {
+        await new Promise(resolve => setTimeout(resolve, 1));
+    }
+
+    const view = new Int32Array(messages[1].buffer);
+    view[3] = 7;
+    assert.equal(state[3], 7);
+
+    worker.terminate();
+});
+
+test('worker - Atomics.waitAsync', async () => {
+    const state = new Int32Array(new SharedArrayBuffer(8));
+
+    assert.deepEqual(Atomics.waitAsync(state, 0, 1), { async: false, value: 'not-equal' });
+    assert.deepEqual(Atomics.waitAsync(state, 0, 0, 0), { async: false, value: 'timed-out' });
+
+    let result = Atomics.waitAsync(state, 0, 0, 10);
+    assert.ok(result.async);
+    assert.equal(await result.value, 'timed-out');
+
+    // 当前线程调用 notify 也可以唤醒
+    result = Atomics.waitAsync(state, 1, 0);
+    assert.equal(Atomics.notify(state, 1), 1);
+    assert.equal(await result.value, 'ok');
+
+    // 不是 SharedArrayBuffer
+    assert.throws(() => Atomics.waitAsync(new Int32Array(2), 0, 0), TypeError);
+});
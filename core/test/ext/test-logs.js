@@ -1,6 +1,7 @@
 // @ts-check
 /// <reference path ="../../types/index.d.ts" />
 import * as assert from '@tjs/assert';
+import * as fs from '@tjs/fs';
 import * as logs from '@tjs/logs';
 
 import { test } from '@tjs/test';
@@ -18,3 +19,56 @@ test('os.syslog', () => {
     logs.syslog.log(6, 'test syslog info'); // LOG_INFO
     logs.syslog.log(7, 'test syslog debug'); // LOG_DEBUG
 });
+
+test('logs.logger', async () => {
+    const filename = `/tmp/tjs-test-logs-${process.pid}.log`;
+    const logger = logs.logger;
+
+    try {
+        logger.open({ level: 6, sinks: logger.SINK_FILE, capacity: 4, filename });
+        const stats = logger.stats();
+        assert.ok(stats.started);
+        assert.equal(stats.capacity, 4);
+
+        // 被过滤的日志不会写入缓冲区
+        assert.equal(logger.accept(7), false);
+        assert.equal(logger.write(7, 'debug message'), false);
+        assert.equal(logger.stats().filtered, stats.filtered + 2);
+
+        assert.ok(logger.write(3, 'error message'));
+        assert.ok(logger.write(6, 'info message'));
+        logger.flush();
+
+        const text = await fs.readFile(filename, 'utf-8');
+        assert.ok(text.includes(' E error message\n'));
+        assert.ok(text.includes(' I info message\n'));
+        assert.ok(!text.includes('debug message'));
+
+        // 缓冲区满时丢弃日志
+        let dropped = 0;
+        for (let i = 0; i < 1000; i++) {
+            if (!logger.write(6, 'message ' + i)) {
+                dropped++;
+            }
+        }
+
+        logger.flush();
+        const result = logger.stats();
+        assert.equal(result.pending, 0);
+        assert.equal(result.dropped, stats.dropped + dropped);
+        assert.equal(result.written, stats.written + 1002 - dropped);
+
+        // 更改缓冲区大小时日志文件保持打开
+        logger.open({ level: 6, sinks: logger.SINK_FILE, capacity: 8 });
+        assert.equal(logger.stats().capacity, 8);
+        assert.ok(logger.write(6, 'after resize'));
+        logger.flush();
+
+        const resized = await fs.readFile(filename, 'utf-8');
+        assert.ok(resized.includes(' I after resize\n'));
+
+    } finally {
+        logger.close();
+        await fs.rm(filename, { force: true });
+    }
+});
@@ -70,3 +70,57 @@ test('http - download', async () => {
         server?.close();
     }
 });
+
+/**
+ * 测试读取得比较慢时的应答消息体
+ */
+test('http - download backpressure', async () => {
+    const chunk = new Uint8Array(16 * 1024);
+    const count = 64;
+
+    const options = { port: 38089 };
+    const server = http.createServer(options, async (req, res) => {
+        res.headers.set('Content-Length', String(chunk.length * count));
+        await res.writeHead();
+
+        for (let i = 0; i < count; i++) {
+            chunk.fill(i);
+            await res.write(chunk);
+        }
+
+        await res.end();
+    });
+
+    await server.start();
+
+    try {
+        for (let i = 0; i < 2; i++) {
+            const response = await fetch('http://localhost:38089/file');
+            assert.equal(response.status, 200);
+
+            /** @type any */
+            const body = response.body;
+            const reader = body.getReader({ mode: 'byob' });
+            const buffer = new Uint8Array(chunk.length);
+
+            let total = 0;
+            while (true) {
+                const result = await reader.read(buffer);
+                if (result.done) {
+                    break;
+                }
+
+                assert.equal(result.value[0], Math.floor(total / chunk.length));
+                total += result.value.length;
+                if (total % (256 * 1024) == 0) {
+                    await util.sleep(10);
+                }
+            }
+
+            assert.equal(total, chunk.length * count);
+        }
+
+    } finally {
+        server.close();
+    }
+});
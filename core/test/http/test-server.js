@@ -5,6 +5,8 @@ import * as assert from '@tjs/assert';
 import { test } from '@tjs/test';
 
 import * as http from '@tjs/http';
+import * as json from '@tjs/json';
+import * as net from '@tjs/net';
 
 /**
  * 测试 HTTP 服务器
@@ -51,3 +53,219 @@ test('http - server', async () => {
     // close the HTTP server
     server.close();
 });
+
+/**
+ * 测试原生 HTTP 服务器
+ */
+test('http - server - native', async () => {
+    const options = { port: 28089, native: true };
+    const server = http.createServer(options, async (req, res) => {
+        const result = {};
+        result.method = req.method;
+        result.args = req.query;
+        result.headers = {};
+        req.headers.forEach((value, key) => {
+            result.headers[key.toLowerCase()] = value;
+        });
+
+        if (req.method == 'POST') {
+            result.body = await req.text();
+        }
+
+        await res.send(result);
+    });
+
+    await server.start();
+
+    // GET
+    const url = 'http://localhost:28089/get?foo=100&bar=test';
+    let response = await fetch(url, { headers: { 'X-Test': 'http:get' } });
+    assert.equal(response.status, 200);
+
+    let data = await response.json();
+    assert.equal(data.method, 'GET');
+    assert.equal(data.args.foo, '100');
+    assert.equal(data.args.bar, 'test');
+    assert.equal(data.headers['x-test'], 'http:get');
+
+    // POST
+    response = await fetch('http://localhost:28089/post', { method: 'POST', body: 'hello' });
+    assert.equal(response.status, 200);
+
+    data = await response.json();
+    assert.equal(data.method, 'POST');
+    assert.equal(data.body, 'hello');
+
+    server.close();
+});
+
+/**
+ * 测试原生 HTTP 服务器: 转交给 JS 的请求体不再计入 native.dbuffer
+ */
+test('http - server - native - dbuffer', async () => {
+    const options = { port: 28091, native: true };
+    const server = http.createServer(options, async (req, res) => {
+        await res.send(await req.text());
+    });
+
+    await server.start();
+
+    const post = async () => {
+        const init = { method: 'POST', headers: { Connection: 'close' }, body: 'x'.repeat(4096) };
+        const response = await fetch('http://localhost:28091/post', init);
+        assert.equal((await response.text()).length, 4096);
+    };
+
+    try {
+        await post();
+        const { count, size } = performance.memory.native.dbuffer;
+
+        for (let i = 0; i < 10; i++) {
+            await post();
+        }
+
+        const usage = performance.memory.native.dbuffer;
+        assert.equal(usage.count, count);
+        assert.equal(usage.size, size);
+
+    } finally {
+        server.close();
+    }
+});
+
+/**
+ * 测试原生 HTTP 服务器: 拒绝可以拆分应答的消息头和状态描述
+ */
+test('http - server - native - invalid headers', async () => {
+    const options = { port: 28092, native: true };
+    const server = http.createServer(options, async (req, res) => {
+        if (req.path == '/value') {
+            res.headers.set('X-Test', 'a\r\nSet-Cookie: test=1');
+
+        } else if (req.path == '/name') {
+            res.headers.map['X-Test: a\r\nSet-Cookie'] = 'test=1';
+
+        } else if (req.path == '/status') {
+            res.setStatus(200, 'OK\r\nSet-Cookie: test=1');
+        }
+
+        await res.send('test');
+    });
+
+    await server.start();
+
+    try {
+        for (const path of ['/value', '/name', '/status']) {
+            const response = await fetch('http://localhost:28092' + path);
+            assert.equal(response.status, 500, path);
+            assert.equal(response.headers.get('Set-Cookie'), null, path);
+            await response.text();
+        }
+
+        const response = await fetch('http://localhost:28092/');
+        assert.equal(response.status, 200);
+        assert.equal(await response.text(), 'test');
+
+    } finally {
+        server.close();
+    }
+});
+
+/**
+ * 测试原生 HTTP 服务器 pipelining: 应答必须按请求的顺序返回
+ */
+test('http - server - native - pipelining', async () => {
+    const options = { port: 28090, native: true };
+    const server = http.createServer(options, async (req, res) => {
+        const index = Number(req.query.index);
+
+        // 让前面的请求晚一些应答
+        await new Promise((resolve) => setTimeout(resolve, (3 - index) * 10));
+        await res.send('response:' + index);
+    });
+
+    await server.start();
+
+    const text = await new Promise((resolve, reject) => {
+        const client = new net.Socket();
+        const textDecoder = new TextDecoder();
+        let text = '';
+
+        client.onopen = async function () {
+            let message = '';
+            for (let i = 0; i < 3; i++) {
+                message += `GET /?index=${i} HTTP/1.1\r\nHost: localhost\r\n`;
+                message += (i == 2) ? 'Connection: close\r\n\r\n' : '\r\n';
+            }
+
+            await client.write(message);
+        };
+
+        client.onerror = reject;
+
+        client.onmessage = function (event) {
+            if (event.data) {
+                text += textDecoder.decode(event.data);
+
+            } else {
+                client.close();
+                resolve(text);
+            }
+        };
+
+        client.connect(28090, 'localhost');
+    });
+
+    const first = text.indexOf('response:0');
+    const second = text.indexOf('response:1');
+    const third = text.indexOf('response:2');
+    assert.ok(first > 0);
+    assert.ok(second > first);
+    assert.ok(third > second);
+    assert.ok(text.includes('Connection: close'));
+
+    server.close();
+});
+
+/**
+ * 测试增量发送和接收 JSON 数据
+ */
+test('http - server - json', async () => {
+    const records = [];
+    for (let i = 0; i < 2000; i++) {
+        records.push({ id: i, name: '设备-' + i });
+    }
+
+    for (const native of [false, true]) {
+        const options = { port: 28096, native };
+        const server = http.createServer(options, async (req, res) => {
+            if (req.method == 'POST') {
+                const body = await req.json();
+                await res.send({ count: body?.length });
+
+            } else {
+                await res.json(records, { chunkSize: 1024 });
+            }
+        });
+
+        await server.start();
+
+        // 边接收边解析
+        const response = await fetch('http://localhost:28096/records');
+        assert.equal(response.headers.get('Content-Type'), 'application/json');
+
+        const output = [];
+        for await (const record of response.jsonRecords()) {
+            output.push(record);
+        }
+
+        assert.deepEqual(output, records);
+
+        // 以分块传输编码上传
+        const body = json.stringifyStream(records, { chunkSize: 1024 });
+        const result = await fetch('http://localhost:28096/upload', { method: 'POST', body });
+        assert.deepEqual(await result.json(), { count: records.length });
+
+        server.close();
+    }
+});
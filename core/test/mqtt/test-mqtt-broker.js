@@ -0,0 +1,268 @@
+// @ts-check
+/// <reference path ="../../types/index.d.ts" />
+import * as fs from '@tjs/fs';
+import * as native from '@tjs/native';
+import { MQTTClient, createBroker } from '@tjs/mqtt';
+
+import * as assert from '@tjs/assert';
+import { test } from '@tjs/test';
+
+const mqtt = native.mqtt;
+
+const textDecoder = new TextDecoder();
+const textEncoder = new TextEncoder();
+
+/**
+ * @param {number} ms
+ */
+function sleep(ms) {
+    return new Promise(resolve => setTimeout(resolve, ms));
+}
+
+/**
+ * @param {() => boolean} condition
+ */
+async function waitFor(condition) {
+    for (let i = 0; i < 200 && !condition(); i++) {
+        await sleep(10);
+    }
+
+    assert.ok(condition(), 'timeout');
+}
+
+/**
+ * @param {number} type
+ * @param {number[]} body
+ */
+function encodePacket(type, body) {
+    return new Uint8Array([type, body.length, ...body]);
+}
+
+/**
+ * @param {string} text
+ */
+function encodeString(text) {
+    const data = textEncoder.encode(text);
+    return [data.length >> 8, data.length & 0xff, ...data];
+}
+
+/**
+ * 可以指定 QoS 的 SUBSCRIBE 消息
+ * @param {number} pid
+ * @param {string} filter
+ * @param {number} qos
+ */
+function encodeSubscribe(pid, filter, qos) {
+    return encodePacket(0x82, [pid >> 8, pid & 0xff, ...encodeString(filter), qos]);
+}
+
+/**
+ * 直接使用 Socket 的简单客户端, 用于检查服务器发送的原始消息
+ * @param {any} address
+ * @param {Uint8Array|ArrayBuffer} connect
+ */
+async function connectRaw(address, connect) {
+    const socket = (typeof address == 'string') ? new native.Pipe() : new native.TCP();
+    await socket.connect(address);
+
+    /** @type any[] */
+    const messages = [];
+    const state = { closed: false };
+    const parser = new mqtt.Parser();
+    parser.onmessage = (message) => messages.push(message);
+    socket.onmessage = (data) => {
+        if (data) {
+            parser.execute(data);
+
+        } else {
+            state.closed = true;
+        }
+    };
+
+    await socket.write(connect);
+
+    /** @param {number} type */
+    async function next(type) {
+        await waitFor(() => messages.some(message => message.type == type));
+        const index = messages.findIndex(message => message.type == type);
+        return messages.splice(index, 1)[0];
+    }
+
+    const connack = await next(mqtt.CONNACK);
+    assert.equal(connack.returnCode, 0);
+    return { socket, messages, next, state };
+}
+
+test('mqtt.MQTTBroker - routing, qos & retained', async () => {
+    const broker = createBroker();
+    broker.listen({ host: '127.0.0.1', port: 0 });
+
+    /** @type any */
+    const address = broker.address();
+    assert.ok(address.port > 0);
+
+    // 保留消息
+    assert.equal(broker.publish('config/a', 'A', { retained: 1 }), 0);
+    assert.equal(broker.stats()?.retained, 1);
+
+    // A: QoS 1 订阅
+    const a = await connectRaw(address, mqtt.encodeConnect({ clientId: 'a', keepalive: 0 }));
+    await a.socket.write(encodeSubscribe(1, 'sensor/+/temp', 1));
+    assert.equal((await a.next(mqtt.SUBACK)).qos, 1);
+
+    // 无效的主题过滤器
+    await a.socket.write(encodeSubscribe(2, 'sensor/a#', 0));
+    assert.equal((await a.next(mqtt.SUBACK)).qos & 0xff, 0x80);
+
+    // B: 重叠的订阅只收到一次, 订阅后收到保留消息
+    const b = await connectRaw(address, mqtt.encodeConnect({ clientId: 'b', keepalive: 0 }));
+    await b.socket.write(encodeSubscribe(1, 'sensor/#', 0));
+    await b.socket.write(encodeSubscribe(2, '#', 0));
+    await b.next(mqtt.SUBACK);
+    await b.next(mqtt.SUBACK);
+
+    const retained = await b.next(mqtt.PUBLISH);
+    assert.equal(retained.topic, 'config/a');
+    assert.equal(retained.retained, 1);
+    assert.equal(textDecoder.decode(retained.payload), 'A');
+
+    // C: 通过 MQTTClient 发布 QoS 1 消息
+    const c = new MQTTClient();
+    c.open(`mqtt://127.0.0.1:${address.port}`, { keepalive: 0 });
+    await c.ready;
+    await c.publish('sensor/1/temp', '25', { qos: 1 });
+
+    const message1 = await a.next(mqtt.PUBLISH);
+    assert.equal(message1.topic, 'sensor/1/temp');
+    assert.equal(message1.qos, 1);
+    assert.equal(message1.retained, 0);
+    assert.ok(message1.packetId > 0);
+    assert.equal(textDecoder.decode(message1.payload), '25');
+    await a.socket.write(encodePacket(0x40, [message1.packetId >> 8, message1.packetId & 0xff]));
+
+    const message2 = await b.next(mqtt.PUBLISH);
+    assert.equal(message2.qos, 0);
+    assert.equal(textDecoder.decode(message2.payload), '25');
+    await sleep(50);
+    assert.equal(b.messages.length, 0);
+
+    // 通配符不匹配 `$` 开头的主题
+    assert.equal(broker.publish('$SYS/load', '1'), 0);
+    assert.equal(broker.publish('sensor/2/temp', new Uint8Array([1, 2])), 2);
+    assert.throws(() => broker.publish('sensor/+', '1'), TypeError);
+
+    // 取消订阅
+    await a.socket.write(encodePacket(0xa2, [0, 3, ...encodeString('sensor/+/temp')]));
+    await a.next(mqtt.UNSUBACK);
+    assert.equal(broker.publish('sensor/3/temp', '1'), 1);
+
+    // 删除保留消息
+    broker.publish('config/a', '', { retained: 1 });
+    assert.equal(broker.stats()?.retained, 0);
+
+    // 遗嘱消息: 没有发送 DISCONNECT 就断开时发布
+    const connect = encodePacket(0x10, [
+        ...encodeString('MQTT'), 4, 0x06, 0, 0,
+        ...encodeString('d'), ...encodeString('status/d'), ...encodeString('offline')
+    ]);
+    const d = await connectRaw(address, connect);
+    b.messages.length = 0;
+    d.socket.close();
+
+    const will = await b.next(mqtt.PUBLISH);
+    assert.equal(will.topic, 'status/d');
+    assert.equal(textDecoder.decode(will.payload), 'offline');
+
+    const stats = broker.stats();
+    assert.equal(stats?.connections, 3);
+    assert.equal(stats?.subscriptions, 2);
+    assert.ok((stats?.messagesReceived || 0) >= 1);
+
+    await c.close();
+    a.socket.close();
+    b.socket.close();
+    broker.close();
+});
+
+test('mqtt.MQTTBroker - malformed packets', async () => {
+    const broker = createBroker();
+    broker.listen({ host: '127.0.0.1', port: 0 });
+
+    /** @type any */
+    const address = broker.address();
+
+    const packets = [
+        [0x30, 0x03, 0x00, 0x05, 0x61], // PUBLISH: 主题长度超出报文
+        [0x30, 0x01, 0x00], // PUBLISH: 主题长度不完整
+        [0x32, 0x03, 0x00, 0x01, 0x61], // PUBLISH QoS 1: 缺少报文标识符
+        [0x82, 0x01, 0x00], // SUBSCRIBE: 缺少报文标识符
+        [0x82, 0x05, 0x00, 0x01, 0x00, 0x05, 0x61], // SUBSCRIBE: 主题过滤器长度超出报文
+        [0x82, 0x05, 0x00, 0x01, 0x00, 0x01, 0x61], // SUBSCRIBE: 缺少 QoS
+        [0xa2, 0x04, 0x00, 0x01, 0x00, 0x05] // UNSUBSCRIBE: 主题过滤器长度超出报文
+    ];
+
+    for (const packet of packets) {
+        const client = await connectRaw(address, mqtt.encodeConnect({ clientId: 'bad', keepalive: 0 }));
+        await client.socket.write(new Uint8Array(packet));
+
+        // 服务器关闭这个连接, 并且可以继续服务其他客户端
+        await waitFor(() => client.state.closed);
+        client.socket.close();
+    }
+
+    const client = await connectRaw(address, mqtt.encodeConnect({ clientId: 'good', keepalive: 0 }));
+    await client.socket.write(encodeSubscribe(1, 'a', 0));
+    await client.next(mqtt.SUBACK);
+    assert.equal(broker.publish('a', '1'), 1);
+    assert.equal((await client.next(mqtt.PUBLISH)).topic, 'a');
+
+    client.socket.close();
+    broker.close();
+});
+
+test('mqtt.MQTTBroker - unix socket', async () => {
+    const path = `/tmp/test_mqtt_broker_${process.pid}.sock`;
+    await fs.unlink(path).catch(() => { });
+
+    const broker = createBroker();
+    broker.listen({ path });
+    broker.listen({ host: '127.0.0.1', port: 0 });
+
+    const addresses = broker.addresses();
+    assert.equal(addresses.length, 2);
+    assert.equal(addresses[0], path);
+
+    /** @type any */
+    const address = addresses[1];
+
+    /** @type string[] */
+    const received = [];
+    const subscriber = new MQTTClient();
+    subscriber.onmessage = (/** @type any */ event) => {
+        received.push(textDecoder.decode(event.data.payload));
+    };
+
+    subscriber.open(undefined, { path, keepalive: 0 });
+    await subscriber.ready;
+    await subscriber.subscribe('test/#');
+
+    const publisher = new MQTTClient();
+    publisher.open(`mqtt://127.0.0.1:${address.port}`, { keepalive: 0 });
+    await publisher.ready;
+
+    for (let i = 0; i < 10; i++) {
+        publisher.publish('test/' + i, 'tcp:' + i);
+    }
+
+    broker.publish('test/local', 'local');
+    await waitFor(() => received.length == 11);
+    assert.ok(received.includes('local'));
+
+    // 同一个发布者的消息保持顺序
+    const messages = received.filter(text => text.startsWith('tcp:'));
+    assert.deepEqual(messages, Array.from({ length: 10 }, (_, i) => 'tcp:' + i));
+
+    await subscriber.close();
+    await publisher.close();
+    broker.close();
+});
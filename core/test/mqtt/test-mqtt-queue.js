@@ -0,0 +1,190 @@
+// @ts-check
+/// <reference path ="../../types/index.d.ts" />
+import * as fs from '@tjs/fs';
+import * as mqtt from '@tjs/mqtt';
+
+import * as assert from '@tjs/assert';
+import { test } from '@tjs/test';
+
+/**
+ * @param {string} dirname
+ */
+async function listSegments(dirname) {
+    const entries = await fs.readdir(dirname);
+    return entries.map(entry => entry.name).filter(name => name.endsWith('.seg')).sort();
+}
+
+test('mqtt.MQTTStore', async () => {
+    const store = new mqtt.MQTTStore({ limit: 2 });
+    store.put({ topic: 'a' });
+    store.put({ topic: 'b' });
+    store.put({ topic: 'c' });
+    assert.throws(() => store.put({ topic: 'd' }));
+
+    const messages = await store.read(2);
+    assert.deepEqual(messages.map(message => message.topic), ['a', 'b']);
+    assert.equal(store.size(), 3);
+
+    await store.commit();
+    assert.equal(store.size(), 1);
+
+    await store.close();
+    assert.equal(store.size(), 0);
+});
+
+test('mqtt.MQTTDiskStore - read & commit', async () => {
+    const dirname = await fs.mkdtemp('/tmp/test_mqtt_queue_XXXXXX');
+    const options = { path: dirname, segmentSize: 1024 };
+
+    let store = new mqtt.MQTTDiskStore(options);
+    await store.open();
+
+    for (let i = 0; i < 100; i++) {
+        store.put({ topic: 'test/' + i, payload: 'message:' + i, qos: 1 });
+    }
+
+    store.put({ topic: 'test/binary', payload: new Uint8Array([1, 2, 3]), retained: 1 });
+    assert.equal(store.size(), 101);
+
+    await store.flush();
+    assert.ok((await listSegments(dirname)).length > 1, 'segments');
+
+    // 读取但不确认
+    let messages = await store.read(10);
+    assert.equal(messages.length, 10);
+    assert.equal(messages[0].topic, 'test/0');
+    assert.equal(messages[0].payload, 'message:0');
+    assert.equal(messages[0].qos, 1);
+
+    messages = await store.read(10);
+    assert.equal(messages[0].topic, 'test/0');
+
+    await store.commit();
+    assert.equal(store.size(), 91);
+    await store.close();
+
+    // 重新打开后从确认的位置继续
+    store = new mqtt.MQTTDiskStore(options);
+    await store.open();
+    assert.equal(store.size(), 91);
+
+    messages = await store.read(1000);
+    assert.equal(messages.length, 91);
+    assert.equal(messages[0].topic, 'test/10');
+
+    const last = messages[messages.length - 1];
+    assert.equal(last.topic, 'test/binary');
+    assert.equal(last.retained, 1);
+    assert.ok(last.payload instanceof ArrayBuffer);
+    assert.deepEqual(Array.from(new Uint8Array(last.payload)), [1, 2, 3]);
+
+    await store.commit();
+    assert.equal(store.size(), 0);
+    assert.equal((await listSegments(dirname)).length, 1);
+
+    await store.close();
+    await fs.rm(dirname, { recursive: true });
+});
+
+test('mqtt.MQTTDiskStore - recovery', async () => {
+    const dirname = await fs.mkdtemp('/tmp/test_mqtt_queue_XXXXXX');
+    const options = { path: dirname };
+
+    let store = new mqtt.MQTTDiskStore(options);
+    for (let i = 0; i < 10; i++) {
+        store.put({ topic: 'test', payload: 'message:' + i });
+    }
+
+    await store.close();
+
+    // 模拟写入到一半时断电
+    const [name] = await listSegments(dirname);
+    const filename = dirname + '/' + name;
+    const data = await fs.readFile(filename);
+    assert.ok(data);
+    await fs.writeFile(filename, data.subarray(0, data.byteLength - 5));
+
+    store = new mqtt.MQTTDiskStore(options);
+    await store.open();
+    assert.equal(store.size(), 9);
+
+    // 损坏的记录
+    const corrupted = new Uint8Array(data);
+    corrupted[corrupted.byteLength - 1] ^= 0xff;
+    await store.close();
+    await fs.writeFile(filename, corrupted);
+
+    store = new mqtt.MQTTDiskStore(options);
+    await store.open();
+    assert.equal(store.size(), 9);
+
+    // 修复后可以继续写入
+    store.put({ topic: 'test', payload: 'message:10' });
+    const messages = await store.read(100);
+    assert.equal(messages.length, 10);
+    assert.equal(messages[8].payload, 'message:8');
+    assert.equal(messages[9].payload, 'message:10');
+
+    await store.close();
+    await fs.rm(dirname, { recursive: true });
+});
+
+test('mqtt.MQTTDiskStore - maxBytes', async () => {
+    const dirname = await fs.mkdtemp('/tmp/test_mqtt_queue_XXXXXX');
+    const store = new mqtt.MQTTDiskStore({ path: dirname, segmentSize: 1024, maxBytes: 4096 });
+
+    const payload = 'x'.repeat(100);
+    for (let i = 0; i < 200; i++) {
+        store.put({ topic: 'test', payload: i + ':' + payload });
+
+        if (i % 10 == 9) {
+            await store.flush();
+        }
+    }
+
+    await store.flush();
+    assert.ok(store.byteLength <= 4096 + 1024, 'byteLength');
+    assert.ok(store.dropped > 0, 'dropped');
+    assert.equal(store.size() + store.dropped, 200);
+
+    // 最早的消息被丢弃
+    const messages = await store.read(1);
+    assert.equal(messages[0].payload, store.dropped + ':' + payload);
+
+    await store.close();
+    await fs.rm(dirname, { recursive: true });
+});
+
+test('mqtt.MQTTDiskStore - throughput', async () => {
+    const dirname = await fs.mkdtemp('/tmp/test_mqtt_queue_XXXXXX');
+    const store = new mqtt.MQTTDiskStore({ path: dirname });
+    await store.open();
+
+    const payload = JSON.stringify({ temperature: 25.5, humidity: 60, time: Date.now() });
+    const count = 20000;
+    const startTime = Date.now();
+    for (let i = 0; i < count; i++) {
+        store.put({ topic: 'device/data', payload, qos: 1 });
+    }
+
+    await store.flush();
+    const span = Math.max(1, Date.now() - startTime);
+    const rate = Math.round(count * 1000 / span);
+    assert.ok(rate > 5000, 'rate');
+
+    let total = 0;
+    while (true) {
+        const messages = await store.read(1000);
+        if (messages.length == 0) {
+            break;
+        }
+
+        total += messages.length;
+        await store.commit();
+    }
+
+    assert.equal(total, count);
+
+    await store.close();
+    await fs.rm(dirname, { recursive: true });
+});
@@ -0,0 +1,169 @@
+// @ts-check
+/// <reference path ="../../types/index.d.ts" />
+import * as native from '@tjs/native';
+import * as net from '@tjs/net';
+import { MQTTClient } from '@tjs/mqtt';
+
+import * as assert from '@tjs/assert';
+import { test } from '@tjs/test';
+
+const mqtt = native.mqtt;
+
+test('mqtt.Writer', () => {
+    const writer = new mqtt.Writer();
+    assert.equal(writer.flush(), undefined);
+
+    // 和 encodePublish 的编码结果相同
+    const payload = JSON.stringify({ value: 1 });
+    const length1 = writer.publish('test/1', payload, 0, 1, 0, 10);
+    const length2 = writer.publish('test/2', new Uint8Array([1, 2, 3]), 0, 0, 1, 0);
+    const ping = mqtt.encodePing();
+    writer.write(ping);
+
+    assert.equal(writer.count(), 3);
+    assert.equal(writer.size(), length1 + length2 + ping.byteLength);
+
+    const data = writer.flush();
+    assert.ok(data);
+    assert.equal(writer.size(), 0);
+    assert.equal(writer.count(), 0);
+
+    const expected = [
+        mqtt.encodePublish('test/1', payload, 0, 1, 0, 10),
+        mqtt.encodePublish('test/2', new Uint8Array([1, 2, 3]), 0, 0, 1, 0),
+        ping
+    ];
+
+    let offset = 0;
+    const bytes = new Uint8Array(data);
+    for (const packet of expected) {
+        assert.deepEqual(Array.from(bytes.subarray(offset, offset + packet.byteLength)), Array.from(new Uint8Array(packet)));
+        offset += packet.byteLength;
+    }
+
+    assert.equal(offset, bytes.byteLength);
+
+    // 解析合并后的数据
+    const parser = new mqtt.Parser();
+    const messages = [];
+    parser.onmessage = (message) => messages.push(message);
+    parser.execute(data);
+    assert.deepEqual(messages.map(message => message.type), [mqtt.PUBLISH, mqtt.PUBLISH, mqtt.PINGREQ]);
+
+    writer.publish('test', 'data', 0, 0, 0, 0);
+    writer.reset();
+    assert.equal(writer.flush(), undefined);
+});
+
+test('mqtt.PacketIds', () => {
+    const ids = new mqtt.PacketIds();
+    assert.equal(ids.alloc(), 1);
+    assert.equal(ids.alloc(), 2);
+    assert.equal(ids.alloc(), 3);
+    assert.equal(ids.size(), 3);
+
+    assert.ok(ids.release(2));
+    assert.ok(!ids.release(2));
+    assert.ok(!ids.has(2));
+    assert.ok(ids.has(1));
+
+    // 分配完一轮后跳过还在使用中的 ID
+    for (let i = 4; i <= 65535; i++) {
+        assert.equal(ids.alloc(), i);
+    }
+
+    assert.equal(ids.alloc(), 2);
+    assert.equal(ids.alloc(), 0);
+    assert.equal(ids.size(), 65535);
+
+    ids.release(100);
+    assert.equal(ids.alloc(), 100);
+
+    ids.reset();
+    assert.equal(ids.size(), 0);
+});
+
+test('mqtt.MQTTClient - cork & maxInflight', async () => {
+    const PORT = 28185;
+    const result = { chunks: 0, publishes: 0, unacked: 0, maxUnacked: 0 };
+
+    /** @type Set<net.Socket> */
+    const connections = new Set();
+    const server = net.createServer((/** @type any */ event) => {
+        /** @type net.Socket */
+        const connection = event.connection;
+        connections.add(connection);
+
+        const parser = new mqtt.Parser();
+        parser.onmessage = (message) => {
+            if (message.type == mqtt.CONNECT) {
+                connection.write(new Uint8Array([0x20, 0x02, 0x00, 0x00]));
+
+            } else if (message.type == mqtt.PUBLISH) {
+                result.publishes++;
+                if (message.qos > 0) {
+                    // 延迟应答, 检查同时等待确认的消息数
+                    result.unacked++;
+                    result.maxUnacked = Math.max(result.maxUnacked, result.unacked);
+
+                    // @ts-ignore
+                    const pid = message.packetId;
+                    setTimeout(() => {
+                        result.unacked--;
+                        connection.write(new Uint8Array([0x40, 0x02, pid >> 8, pid & 0xff]));
+                    }, 5);
+                }
+            }
+        };
+
+        connection.onmessage = (/** @type any */ event) => {
+            if (event.data) {
+                result.chunks++;
+                parser.execute(event.data);
+
+            } else {
+                connections.delete(connection);
+                connection.close();
+            }
+        };
+    });
+
+    server.listen({ address: '127.0.0.1', port: PORT });
+
+    const client = new MQTTClient();
+    client.open(`mqtt://127.0.0.1:${PORT}`, { keepalive: 0, maxInflight: 4 });
+    await client.ready;
+
+    // 合并写入
+    result.chunks = 0;
+    client.cork();
+    const promises = [];
+    for (let i = 0; i < 100; i++) {
+        promises.push(client.publish('test', 'message:' + i));
+    }
+
+    await client.uncork();
+    await Promise.all(promises);
+    while (result.publishes < 100) {
+        await new Promise(resolve => setTimeout(resolve, 10));
+    }
+
+    assert.ok(result.chunks < 10, 'chunks');
+
+    // 发送窗口
+    promises.length = 0;
+    for (let i = 0; i < 20; i++) {
+        promises.push(client.publish('test', 'message:' + i, { qos: 1 }));
+    }
+
+    await Promise.all(promises);
+    assert.equal(result.publishes, 120);
+    assert.ok(result.maxUnacked <= 4, 'maxUnacked');
+
+    await client.close();
+    for (const connection of connections) {
+        connection.close();
+    }
+
+    server.close();
+});
@@ -0,0 +1,199 @@
+// @ts-check
+/// <reference path ="../../types/index.d.ts" />
+import * as native from '@tjs/native';
+import * as net from '@tjs/net';
+import { MQTTClient } from '@tjs/mqtt';
+
+import * as assert from '@tjs/assert';
+import { test } from '@tjs/test';
+
+const mqtt = native.mqtt;
+
+const textDecoder = new TextDecoder();
+
+/**
+ * @param {() => boolean} condition
+ */
+async function waitFor(condition) {
+    for (let i = 0; i < 200 && !condition(); i++) {
+        await new Promise(resolve => setTimeout(resolve, 10));
+    }
+
+    assert.ok(condition(), 'timeout');
+}
+
+/**
+ * @param {ArrayBuffer|Uint8Array} data
+ */
+function parse(data) {
+    /** @type any[] */
+    const messages = [];
+    const parser = new mqtt.Parser({ protocolVersion: 5 });
+    parser.onmessage = (message) => messages.push(message);
+    parser.execute(data);
+    return messages;
+}
+
+test('mqtt.Parser - MQTT 5', () => {
+    // 属性
+    const properties = {
+        topicAlias: 3,
+        messageExpiryInterval: 60,
+        contentType: 'application/json',
+        correlationData: new Uint8Array([1, 2]),
+        userProperties: { a: '1', b: '2' }
+    };
+
+    const data = mqtt.encodePublish('test/1', 'hello', 0, 1, 1, 10, properties);
+    const [message] = parse(data);
+    assert.equal(message.type, mqtt.PUBLISH);
+    assert.equal(message.topic, 'test/1');
+    assert.equal(message.qos, 1);
+    assert.equal(message.retained, 1);
+    assert.equal(message.packetId, 10);
+    assert.equal(textDecoder.decode(message.payload), 'hello');
+    assert.equal(message.properties.topicAlias, 3);
+    assert.equal(message.properties.messageExpiryInterval, 60);
+    assert.equal(message.properties.contentType, 'application/json');
+    assert.deepEqual(Array.from(new Uint8Array(message.properties.correlationData)), [1, 2]);
+    assert.deepEqual(message.properties.userProperties, { a: '1', b: '2' });
+
+    // 使用主题别名时只发送 2 字节的别名
+    const alias = mqtt.encodePublish('', 'hello', 0, 0, 0, 0, { topicAlias: 3 });
+    assert.deepEqual(Array.from(new Uint8Array(alias)), [0x30, 11, 0, 0, 3, 0x23, 0, 3, ...new TextEncoder().encode('hello')]);
+
+    const [aliasMessage] = parse(alias);
+    assert.equal(aliasMessage.topic, '');
+    assert.equal(aliasMessage.properties.topicAlias, 3);
+
+    // 和 Writer 的编码结果相同
+    const writer = new mqtt.Writer();
+    writer.publish('test/1', 'hello', 0, 1, 1, 10, properties);
+    assert.deepEqual(Array.from(new Uint8Array(writer.flush() || [])), Array.from(new Uint8Array(data)));
+
+    // 没有属性的消息
+    const [empty] = parse(mqtt.encodePublish('test/2', '', 0, 0, 0, 0, {}));
+    assert.equal(empty.topic, 'test/2');
+    assert.equal(empty.properties, undefined);
+
+    assert.throws(() => mqtt.encodePublish('test', '', 0, 0, 0, 0, { unknown: 1 }), TypeError);
+
+    // CONNECT
+    const connect = new Uint8Array(mqtt.encodeConnect({ clientId: 'c', keepalive: 30, protocolVersion: 5, properties: { sessionExpiryInterval: 60 } }));
+    assert.deepEqual(Array.from(connect.subarray(2, 10)), [0, 4, 0x4d, 0x51, 0x54, 0x54, 5, 0x02]);
+    assert.deepEqual(Array.from(connect.subarray(12)), [5, 0x11, 0, 0, 0, 60, 0, 1, 0x63]);
+
+    // CONNACK, PUBACK, SUBACK, DISCONNECT
+    const messages = parse(new Uint8Array([
+        0x20, 0x09, 0x01, 0x00, 0x06, 0x22, 0x00, 0x0a, 0x21, 0x00, 0x04,
+        0x40, 0x02, 0x00, 0x01,
+        0x40, 0x03, 0x00, 0x02, 0x87,
+        0x90, 0x05, 0x00, 0x03, 0x00, 0x01, 0x80,
+        0xe0, 0x01, 0x8e
+    ]));
+
+    assert.deepEqual(messages.map(message => message.type), [mqtt.CONNACK, mqtt.PUBACK, mqtt.PUBACK, mqtt.SUBACK, mqtt.DISCONNECT]);
+    assert.equal(messages[0].sessionPresent, 1);
+    assert.equal(messages[0].returnCode, 0);
+    assert.deepEqual(messages[0].properties, { topicAliasMaximum: 10, receiveMaximum: 4 });
+    assert.equal(messages[1].reasonCode, 0);
+    assert.equal(messages[2].packetId, 2);
+    assert.equal(messages[2].reasonCode, 0x87);
+    assert.deepEqual(messages[3].reasonCodes, [1, 0x80]);
+    assert.equal(messages[3].qos, 1);
+    assert.equal(messages[4].reasonCode, 0x8e);
+
+    const [disconnect] = parse(mqtt.encodeDisconnect(0x04, { reasonString: 'bye' }));
+    assert.equal(disconnect.reasonCode, 0x04);
+    assert.equal(disconnect.properties.reasonString, 'bye');
+});
+
+test('mqtt.MQTTClient - MQTT 5 topic alias', async () => {
+    const PORT = 28186;
+
+    /** @type any[] */
+    const publishes = [];
+    let protocolVersion = 0;
+
+    /** @type Set<net.Socket> */
+    const connections = new Set();
+    const server = net.createServer((/** @type any */ event) => {
+        /** @type net.Socket */
+        const connection = event.connection;
+        connections.add(connection);
+
+        const parser = new mqtt.Parser({ protocolVersion: 5 });
+        parser.onmessage = (/** @type any */ message) => {
+            if (message.type == mqtt.PUBLISH) {
+                publishes.push(message);
+                if (message.qos > 0) {
+                    // 拒绝 QoS 1 消息: 0x87 Not authorized
+                    const pid = message.packetId;
+                    connection.write(new Uint8Array([0x40, 0x03, pid >> 8, pid & 0xff, 0x87]));
+                }
+            }
+        };
+
+        connection.onmessage = (/** @type any */ event) => {
+            const data = event.data;
+            if (!data) {
+                connections.delete(connection);
+                connection.close();
+                return;
+            }
+
+            const bytes = new Uint8Array(data);
+            if (bytes[0] == 0x10) {
+                protocolVersion = bytes[8];
+
+                // CONNACK: topicAliasMaximum = 2
+                connection.write(new Uint8Array([0x20, 0x06, 0x00, 0x00, 0x03, 0x22, 0x00, 0x02]));
+                return;
+            }
+
+            parser.execute(data);
+        };
+    });
+
+    server.listen({ address: '127.0.0.1', port: PORT });
+
+    const client = new MQTTClient();
+    client.open(`mqtt://127.0.0.1:${PORT}`, { keepalive: 0, protocolVersion: 5, topicAliasMaximum: 4 });
+    await client.ready;
+    assert.equal(protocolVersion, 5);
+
+    // 别名用完后新的主题不再分配别名
+    const topics = ['device/a/data', 'device/a/data', 'device/b/data', 'device/a/data', 'device/c/data', 'device/b/data'];
+    for (const topic of topics) {
+        await client.publish(topic, 'value');
+    }
+
+    await waitFor(() => publishes.length == topics.length);
+    assert.deepEqual(publishes.map(message => message.topic), ['device/a/data', '', 'device/b/data', '', 'device/c/data', '']);
+    assert.deepEqual(publishes.map(message => message.properties?.topicAlias), [1, 1, 2, 1, undefined, 2]);
+    assert.equal(publishes[0].length - publishes[1].length, 'device/a/data'.length);
+
+    // 原因码大于等于 0x80 时发布失败
+    const error = await client.publish('device/a/data', 'value', { qos: 1 }).catch(error => error);
+    assert.ok(error instanceof Error);
+    assert.equal(error.code, 0x87);
+
+    // 收到的主题别名
+    /** @type string[] */
+    const received = [];
+    client.onmessage = (/** @type any */ event) => received.push(event.data.topic);
+    for (const connection of connections) {
+        connection.write(mqtt.encodePublish('cmd/reboot', '1', 0, 0, 0, 0, { topicAlias: 1 }));
+        connection.write(mqtt.encodePublish('', '2', 0, 0, 0, 0, { topicAlias: 1 }));
+    }
+
+    await waitFor(() => received.length == 2);
+    assert.deepEqual(received, ['cmd/reboot', 'cmd/reboot']);
+
+    await client.close();
+    for (const connection of connections) {
+        connection.close();
+    }
+
+    server.close();
+});
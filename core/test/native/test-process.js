@@ -82,3 +82,68 @@ test('native.process: tjs -e environ', async () => {
     const status = await proc.wait();
     logStatus(status);
 });
+
+test('native.exec: output & lines', async () => {
+    const script = 'echo hello; echo error >&2; printf "a\\r\\nb\\nc"; exit 3';
+    let result = await native.exec(['sh', '-c', script]);
+    assert.equal(result.code, 3);
+    assert.equal(result.signal, 0);
+    assert.equal(result.stdout, 'hello\na\r\nb\nc');
+    assert.equal(result.stderr, 'error\n');
+
+    result = await native.exec(['sh', '-c', script], { lines: true });
+    assert.deepEqual(result.stdout, ['hello', 'a', 'b', 'c']);
+    assert.deepEqual(result.stderr, ['error']);
+
+    result = await native.exec([exepath, '-e', 'console.log(process.getenv("FOO"))'], { env: { FOO: 'BAR' }, lines: true });
+    assert.equal(result.stdout[0], 'BAR');
+
+    // 不存在的命令
+    assert.throws(() => native.exec(['/nonexistent/command']), /no such file/);
+});
+
+test('native.exec: stdio', async () => {
+    const script = 'echo hello; echo error >&2';
+    let result = await native.exec(['sh', '-c', script], { stderr: 'ignore' });
+    assert.equal(result.stdout, 'hello\n');
+    assert.equal(result.stderr, undefined);
+
+    result = await native.exec(['sh', '-c', script], { stdout: 'ignore', stderr: 'pipe' });
+    assert.equal(result.code, 0);
+    assert.equal(result.stdout, undefined);
+    assert.equal(result.stderr, 'error\n');
+
+    // 不能向子进程写入, 所以 stdin 不支持 pipe
+    assert.throws(() => native.exec(['cat'], { stdin: 'pipe' }), TypeError);
+    assert.throws(() => native.exec(['cat'], { stdout: 'test' }), TypeError);
+});
+
+test('native.exec: maxBuffer & timeout', async () => {
+    // 输出超过 maxBuffer 时结束进程
+    let result = await native.exec(['sh', '-c', 'yes'], { maxBuffer: 10000 });
+    assert.equal(result.stdout.length, 10000);
+    assert.equal(result.truncated, true);
+
+    // 超时后发送 SIGTERM
+    let start = Date.now();
+    result = await native.exec(['sleep', '5'], { timeout: 100 });
+    assert.equal(result.timedOut, true);
+    assert.equal(result.signal, native.signals.SIGTERM);
+    assert.ok(Date.now() - start < 1000);
+
+    // 忽略 SIGTERM 时再发送 SIGKILL
+    start = Date.now();
+    result = await native.exec(['sh', '-c', 'trap "" TERM; echo ready; sleep 5'], { timeout: 100, killTimeout: 100 });
+    assert.equal(result.timedOut, true);
+    assert.equal(result.signal, native.signals.SIGKILL);
+    assert.equal(result.stdout, 'ready\n');
+    assert.ok(Date.now() - start < 1000);
+
+    // 进程在超时前退出, 但它的子进程还占用着输出管道
+    start = Date.now();
+    result = await native.exec(['sh', '-c', 'echo done; sleep 5 &'], { timeout: 2000 });
+    assert.equal(result.code, 0);
+    assert.equal(result.timedOut, undefined);
+    assert.equal(result.stdout, 'done\n');
+    assert.ok(Date.now() - start < 1000);
+});
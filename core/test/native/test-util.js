@@ -42,3 +42,27 @@ test('native.utf8', () => {
     const output = utf8.decode(data);
     assert.equal(output, text);
 });
+
+test('native.utf8 - non-ascii', () => {
+    /** @param {string} text */
+    const utf8Length = (text) => {
+        let length = 0;
+        for (const ch of text) {
+            const code = ch.codePointAt(0) || 0;
+            length += code < 0x80 ? 1 : code < 0x800 ? 2 : code < 0x10000 ? 3 : 4;
+        }
+
+        return length;
+    };
+
+    // 覆盖 SIMD 分块和尾部的各种长度
+    for (const part of ['é', '中', 'aé中', 'a中é😀']) {
+        for (let count = 1; count < 80; count += 7) {
+            const text = 'test'.repeat(count % 5) + part.repeat(count);
+            const data = utf8.encode(text);
+            assert.equal(data.length, utf8Length(text), part + count);
+            assert.equal(data.buffer.byteLength, data.length);
+            assert.equal(utf8.decode(data), text);
+        }
+    }
+});
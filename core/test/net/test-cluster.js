@@ -0,0 +1,122 @@
+// @ts-check
+/// <reference path ="../../types/index.d.ts" />
+import * as assert from '@tjs/assert';
+import * as cluster from '@tjs/cluster';
+import * as http from '@tjs/http';
+import * as native from '@tjs/native';
+import { test } from '@tjs/test';
+
+const PORT = 28310;
+
+/**
+ * 工作进程: 在共享的端口上提供 HTTP 服务, 应答自己的进程 ID
+ */
+async function runWorker() {
+    if (process.argv.includes('--shared')) {
+        cluster.settings.schedulingPolicy = cluster.SCHED_SHARED;
+    }
+
+    const handle = await cluster.bind({ address: '127.0.0.1', port: PORT });
+    const options = { handle, native: true };
+    const server = http.createServer(options, async (req, res) => {
+        await res.send(String(process.pid));
+    });
+
+    await server.start();
+    cluster.send({ type: 'ready', workerId: cluster.workerId });
+
+    // 保存引用以免被回收
+    globalThis.server = server;
+}
+
+/**
+ * @param {string[]} args
+ */
+async function testCluster(args) {
+    const filename = import.meta.url.slice(7); // strip "file://"
+    const count = 2;
+
+    /** @type {Promise<any>[]} */
+    const ready = [];
+    for (let i = 0; i < count; i++) {
+        const worker = cluster.fork({ args: [filename, ...args] });
+        ready.push(new Promise((resolve) => {
+            worker.onmessage = (event) => resolve(event.data);
+        }));
+    }
+
+    try {
+        const messages = await Promise.all(ready);
+        assert.equal(messages.length, count);
+        assert.equal(messages[0].type, 'ready');
+
+        // 每个请求都使用新的连接
+        const pids = new Set();
+        const headers = { Connection: 'close' };
+        for (let i = 0; i < 50 && pids.size < count; i++) {
+            const response = await fetch(`http://127.0.0.1:${PORT}/`, { headers });
+            assert.equal(response.status, 200);
+            pids.add(await response.text());
+        }
+
+        if (args.includes('--shared')) {
+            // 共享同一个侦听句柄时由先调用 accept 的进程接受连接
+            assert.ok(pids.size >= 1);
+
+        } else {
+            // SO_REUSEPORT: 内核把连接分配给所有工作进程
+            assert.equal(pids.size, count);
+        }
+
+    } finally {
+        for (const worker of cluster.workers.values()) {
+            worker.kill();
+            await worker.exited;
+        }
+    }
+
+    assert.equal(cluster.workers.size, 0);
+}
+
+if (cluster.isWorker) {
+    runWorker();
+
+} else {
+    test('cluster - reuseport', async () => {
+        const address = { address: '127.0.0.1', port: PORT + 1 };
+
+        // 两个句柄绑定同一个端口, 都可以接受连接
+        const counts = [0, 0];
+        const handles = [new native.TCP(), new native.TCP()];
+        handles.forEach((handle, index) => {
+            handle.onconnection = () => {
+                counts[index]++;
+                handle.accept().close();
+            };
+
+            handle.bind(address, native.TCP.REUSEPORT);
+            handle.listen(16);
+        });
+
+        const total = 32;
+        for (let i = 0; i < total; i++) {
+            const client = new native.TCP();
+            await client.connect(address);
+            client.close();
+        }
+
+        for (let i = 0; i < 100 && counts[0] + counts[1] < total; i++) {
+            await new Promise((resolve) => setTimeout(resolve, 10));
+        }
+
+        handles.forEach((handle) => handle.close());
+        assert.equal(counts[0] + counts[1], total);
+        assert.ok(counts[0] > 0 && counts[1] > 0, `connections: ${counts}`);
+
+        await testCluster([]);
+    });
+
+    test('cluster - shared handle', async () => {
+        await testCluster(['--shared']);
+    });
+}
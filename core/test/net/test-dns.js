@@ -5,6 +5,9 @@ import * as assert from '@tjs/assert';
 import { test } from '@tjs/test';
 
 import * as dns from '@tjs/dns';
+import * as fs from '@tjs/fs';
+import * as native from '@tjs/native';
+import * as net from '@tjs/net';
 
 test('dns.lookup - baidu', async () => {
     const result = await dns.lookup('www.baidu.com', { family: 4, all: true });
@@ -41,3 +44,244 @@ test('dns.lookup - ip', async () => {
     assert.equal(address.address, '192.168.31.1');
 
 });
+
+// ////////////////////////////////////////////////////////////
+// 本地 DNS 服务器
+
+/**
+ * @param {number} ms
+ */
+function sleep(ms) {
+    return new Promise(resolve => setTimeout(resolve, ms));
+}
+
+/**
+ * @param {string} name
+ */
+function encodeName(name) {
+    const data = [];
+    for (const label of name.split('.')) {
+        const bytes = new TextEncoder().encode(label);
+        data.push(bytes.length, ...bytes);
+    }
+
+    data.push(0);
+    return data;
+}
+
+/**
+ * @param {number} value
+ */
+function encode16(value) {
+    return [value >> 8, value & 0xff];
+}
+
+/**
+ * @param {number} value
+ */
+function encode32(value) {
+    return [value >>> 24, (value >> 16) & 0xff, (value >> 8) & 0xff, value & 0xff];
+}
+
+/**
+ * 用于测试的 DNS 服务器, records 为 `{ 'name/type': { ttl, data: number[][] } }`
+ * 不存在的域名返回 NXDOMAIN 和 SOA 记录
+ * @param {{ [key: string]: { ttl: number, data: number[][] } }} records
+ * @param {{ silent?: boolean }} [options] silent 为 true 时不应答
+ */
+async function createDNSServer(records, options) {
+    const socket = net.createSocket('udp4');
+    socket.bind({ address: '127.0.0.1', port: 0 });
+
+    /** @type string[] */
+    const queries = [];
+
+    socket.onmessage = (/** @type any */ event) => {
+        const message = new Uint8Array(event.data);
+
+        // 问题部分
+        let offset = 12;
+        const labels = [];
+        while (message[offset]) {
+            const length = message[offset];
+            labels.push(new TextDecoder().decode(message.subarray(offset + 1, offset + 1 + length)));
+            offset += length + 1;
+        }
+
+        const type = (message[offset + 1] << 8) | message[offset + 2];
+        const question = Array.from(message.subarray(12, offset + 5));
+        const key = labels.join('.') + '/' + type;
+        queries.push(key);
+        if (options?.silent) {
+            return;
+        }
+
+        const record = records[key];
+        const found = record || Object.keys(records).some(name => name.startsWith(labels.join('.') + '/'));
+        const answers = [];
+        for (const data of record?.data || []) {
+            answers.push(0xc0, 12, ...encode16(type), 0, 1, ...encode32(record.ttl), ...encode16(data.length), ...data);
+        }
+
+        // NXDOMAIN: SOA 的 TTL 为 10, MINIMUM 为 2
+        const authority = [];
+        if (!found) {
+            const soa = [...encodeName('ns.test'), ...encodeName('admin.test'), ...encode32(1), ...encode32(60), ...encode32(60), ...encode32(60), ...encode32(2)];
+            authority.push(...encodeName('test'), 0, 6, 0, 1, ...encode32(10), ...encode16(soa.length), ...soa);
+        }
+
+        const response = [
+            message[0], message[1], 0x81, found ? 0x80 : 0x83,
+            0, 1, ...encode16(record?.data.length || 0), 0, found ? 0 : 1, 0, 0,
+            ...question, ...answers, ...authority
+        ];
+
+        socket.send(new Uint8Array(response), event.address);
+    };
+
+    await sleep(10);
+    const address = socket.address();
+    return { socket, queries, server: `127.0.0.1:${address.port}` };
+}
+
+const records = {
+    'a.test/1': { ttl: 300, data: [[10, 0, 0, 1], [10, 0, 0, 2]] },
+    'a.test/28': { ttl: 200, data: [[0xfd, 0, ...new Array(13).fill(0), 1]] },
+    'short.test/1': { ttl: 1, data: [[10, 0, 0, 3]] },
+    '_mqtt._tcp.a.test/33': { ttl: 60, data: [[...encode16(10), ...encode16(5), ...encode16(1883), ...encodeName('broker.a.test')]] }
+};
+
+test('dns.Resolver - A, AAAA & SRV', async () => {
+    const { socket, queries, server } = await createDNSServer(records);
+    const resolver = new native.dns.Resolver({ servers: [server], hosts: '' });
+    assert.equal(resolver.servers()[0].address, '127.0.0.1');
+
+    const Resolver = native.dns.Resolver;
+    const result = await resolver.query('a.test', Resolver.A);
+    assert.equal(result.rcode, 0);
+    assert.equal(result.ttl, 300);
+    assert.deepEqual(result.answers.map(answer => answer.address), ['10.0.0.1', '10.0.0.2']);
+
+    const result6 = await resolver.query('a.test.', Resolver.AAAA);
+    assert.equal(result6.answers[0].address, 'fd00::1');
+    assert.equal(result6.answers[0].type, Resolver.AAAA);
+
+    const srv = await resolver.query('_mqtt._tcp.a.test', Resolver.SRV);
+    assert.deepEqual(srv.answers[0], { priority: 10, weight: 5, port: 1883, name: 'broker.a.test', type: Resolver.SRV, ttl: 60 });
+
+    // NXDOMAIN 的 TTL 为 min(SOA TTL, MINIMUM)
+    const missing = await resolver.query('missing.test', Resolver.A);
+    assert.equal(missing.rcode, 3);
+    assert.equal(missing.ttl, 2);
+    assert.equal(missing.answers.length, 0);
+
+    // 合并相同的并发查询
+    queries.length = 0;
+    const results = await Promise.all([
+        resolver.query('a.test', Resolver.A),
+        resolver.query('A.TEST', Resolver.A),
+        resolver.query('a.test', Resolver.A),
+        resolver.query('a.test', Resolver.AAAA)
+    ]);
+
+    assert.equal(results[1].answers[1].address, '10.0.0.2');
+    assert.deepEqual(queries, ['a.test/1', 'a.test/28']);
+
+    resolver.close();
+    socket.close();
+});
+
+test('dns.Resolver - hosts, timeout & retry', async () => {
+    const { socket, queries, server } = await createDNSServer(records);
+    const silent = await createDNSServer(records, { silent: true });
+
+    const hosts = `/tmp/test_dns_hosts_${process.pid}`;
+    await fs.writeFile(hosts, '# hosts\n127.0.0.1 localhost\n10.1.1.1  myhost.test  alias.test # comment\n::1 localhost\n');
+
+    // 第一个服务器不应答时使用下一个服务器
+    const resolver = new native.dns.Resolver({ servers: [silent.server, server], timeout: 100, attempts: 1, hosts });
+    const Resolver = native.dns.Resolver;
+
+    const result = await resolver.query('a.test', Resolver.A);
+    assert.equal(result.answers[0].address, '10.0.0.1');
+    assert.deepEqual(silent.queries, ['a.test/1']);
+    assert.deepEqual(queries, ['a.test/1']);
+
+    // hosts 文件
+    const alias = await resolver.query('ALIAS.test', Resolver.A);
+    assert.equal(alias.answers[0].address, '10.1.1.1');
+    const localhost = await resolver.query('localhost', Resolver.AAAA);
+    assert.equal(localhost.answers[0].address, '::1');
+    assert.equal(queries.length, 1);
+
+    // 所有服务器都超时
+    const timeout = new native.dns.Resolver({ servers: [silent.server], timeout: 50, attempts: 2, hosts: '' });
+    const start = Date.now();
+    const error = await timeout.query('b.test').catch(error => error);
+    assert.equal(error.errno, native.errors.UV_ETIMEDOUT);
+    assert.ok(Date.now() - start >= 90);
+    assert.equal(silent.queries.filter(query => query == 'b.test/1').length, 2);
+
+    // 关闭时取消正在进行的查询
+    const promise = timeout.query('c.test').catch(error => error);
+    timeout.close();
+    const cancelled = await promise;
+    assert.equal(cancelled.errno, native.errors.UV_ECANCELED);
+
+    resolver.close();
+    socket.close();
+    silent.socket.close();
+    await fs.unlink(hosts);
+});
+
+test('dns.lookup - cache', async () => {
+    const { socket, queries, server } = await createDNSServer(records);
+    dns.configure({ resolver: { servers: [server], hosts: '' } });
+
+    try {
+        // 合并并发的查询
+        const results = await Promise.all([dns.lookup('a.test', 4), dns.lookup('a.test', 4)]);
+        assert.deepEqual(results[0], { address: '10.0.0.1', family: 4 });
+        assert.ok(results[0] !== results[1]);
+
+        // 缓存
+        const all = await dns.lookup('a.test', { all: true });
+        assert.deepEqual(all.map(address => address.address), ['10.0.0.1', '10.0.0.2', 'fd00::1']);
+        assert.deepEqual(queries, ['a.test/1', 'a.test/28']);
+
+        // TTL 过期后重新查询
+        assert.equal((await dns.lookup('short.test', 4)).address, '10.0.0.3');
+        await dns.lookup('short.test', 4);
+        assert.equal(queries.filter(query => query == 'short.test/1').length, 1);
+        await sleep(1100);
+        await dns.lookup('short.test', 4);
+        assert.equal(queries.filter(query => query == 'short.test/1').length, 2);
+
+        // 缓存域名不存在的结果
+        for (let i = 0; i < 2; i++) {
+            const error = await dns.lookup('missing.test', 4).catch(error => error);
+            assert.equal(error.errno, native.errors.UV_EAI_NONAME);
+            assert.equal(error.hostname, 'missing.test');
+        }
+
+        assert.equal(queries.filter(query => query == 'missing.test/1').length, 1);
+
+        assert.deepEqual(await dns.resolve4('a.test'), ['10.0.0.1', '10.0.0.2']);
+        assert.deepEqual(await dns.resolve6('a.test', { ttl: true }), [{ address: 'fd00::1', ttl: 200 }]);
+        assert.deepEqual(await dns.resolveSrv('_mqtt._tcp.a.test'), [{ priority: 10, weight: 5, port: 1883, name: 'broker.a.test' }]);
+
+        // 清除缓存
+        const count = queries.length;
+        dns.clearCache();
+        await dns.lookup('a.test', 4);
+        assert.equal(queries.length, count + 1);
+
+    } finally {
+        dns.configure({ resolver: false });
+        socket.close();
+    }
+
+    // getaddrinfo 的结果也会被缓存
+    const address = await dns.lookup('localhost', 4);
+    assert.equal(address.address, '127.0.0.1');
+});
@@ -106,3 +106,63 @@ test('net.pipe - server:client', async () => {
 
     await promise;
 });
+
+test('net.pipe - readable backpressure', async () => {
+    const path = '/tmp/test-pipe-backpressure';
+    await fs.unlink(path).catch(() => { });
+
+    const total = 1024 * 1024;
+    const chunk = new Uint8Array(16 * 1024);
+
+    /** @type Set<net.Socket> */
+    const connections = new Set();
+    const server = net.createServer();
+    server.listen(path);
+    server.onconnection = async function (/** @type any */ event) {
+        /** @type net.Socket */
+        const connection = event.connection;
+        connections.add(connection);
+
+        const writer = connection.writable.getWriter();
+        for (let i = 0; i < total / chunk.length; i++) {
+            chunk.fill(i & 0xff);
+            await writer.write(chunk);
+        }
+
+        await writer.close();
+    };
+
+    const client = net.connect(path);
+    await client.connected;
+
+    // 读取得比较慢, 已收到但未读取的数据不应该超过高水位线太多
+    const reader = client.readable.getReader({ mode: 'byob' });
+    const buffer = new Uint8Array(8 * 1024);
+    let received = 0;
+    let maxBuffered = 0;
+    for (;;) {
+        const result = await reader.read(buffer);
+        if (result.done) {
+            break;
+        }
+
+        const value = result.value;
+        assert.equal(value[0], (received / chunk.length) & 0xff);
+        received += value.byteLength;
+        maxBuffered = Math.max(maxBuffered, client.bytesRead - received);
+
+        if (received % (128 * 1024) == 0) {
+            await new Promise(resolve => setTimeout(resolve, 10));
+        }
+    }
+
+    assert.equal(received, total);
+    assert.ok(maxBuffered <= 256 * 1024, 'maxBuffered: ' + maxBuffered);
+
+    client.close();
+    for (const connection of connections) {
+        connection.close();
+    }
+
+    server.close();
+});
@@ -46,6 +46,8 @@ typedef struct TJSRuntimeOptions {
     size_t stack_size;
     size_t memory_limit;
     int exit_code;
+    bool cpu_profile;
+    uint32_t cpu_profile_interval;
 } TJSRuntimeOptions;
 
 ///////////////////////////////////////////////////////
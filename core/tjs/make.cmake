@@ -38,19 +38,27 @@ endif ()
 set(SOURCES
     ${CORE_DIR}/src/bootstrap.c
     ${CORE_DIR}/src/cli.c
+    ${CORE_DIR}/src/codec.c
     ${CORE_DIR}/src/dns.c
+    ${CORE_DIR}/src/dns_resolver.c
     ${CORE_DIR}/src/error.c
     ${CORE_DIR}/src/fs.c
     ${CORE_DIR}/src/gzip.c
     ${CORE_DIR}/src/hal.c
+    ${CORE_DIR}/src/heap.c
     ${CORE_DIR}/src/http.c
+    ${CORE_DIR}/src/http_server.c
     ${CORE_DIR}/src/internal_modules.c
+    ${CORE_DIR}/src/json.c
+    ${CORE_DIR}/src/logger.c
     ${CORE_DIR}/src/miniz.c
     ${CORE_DIR}/src/misc.c
     ${CORE_DIR}/src/modules.c
     ${CORE_DIR}/src/mqtt.c
+    ${CORE_DIR}/src/mqtt_broker.c
     ${CORE_DIR}/src/os.c
     ${CORE_DIR}/src/process.c
+    ${CORE_DIR}/src/profiler.c
     ${CORE_DIR}/src/signals.c
     ${CORE_DIR}/src/std.c
     ${CORE_DIR}/src/streams_pipe.c
@@ -60,6 +68,7 @@ set(SOURCES
     ${CORE_DIR}/src/timers.c
     ${CORE_DIR}/src/uart.c
     ${CORE_DIR}/src/udp.c
+    ${CORE_DIR}/src/utf8.c
     ${CORE_DIR}/src/util.c
     ${CORE_DIR}/src/utils.c
     ${CORE_DIR}/src/version.c
@@ -134,6 +143,13 @@ if (BUILD_REDIS_JS)
     target_compile_definitions(tjs_core PRIVATE BUILD_REDIS_JS)
 endif ()
 
+# mdns.js
+if (BUILD_MDNS)
+    message(STATUS "Build mdns module.")
+    target_link_libraries(tjs mdnsjs)
+    target_compile_definitions(tjs_core PRIVATE BUILD_MDNS)
+endif ()
+
 if (BUILD_GPIO)
     add_definitions(-DCONFIG_USE_GPIO)
     target_link_libraries(tjs gpio)
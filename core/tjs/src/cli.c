@@ -111,6 +111,8 @@ static void tjs_cli_print_help(void)
            "  -v, --version             print tjs version\n"
            "  -h, --help                list options\n"
            "      --dump                dump the memory usage stats\n"
+           "      --cpu-prof            write a CPU profile (.cpuprofile) to the current directory on exit\n"
+           "      --cpu-prof-interval n sampling interval of the CPU profiler in microseconds\n"
            "      --unhandled-rejection abort when a rejected promise is not caught\n"
            "      --memory-limit n      limit the memory usage to 'n' bytes\n"
            "      --stack-size n        limit the stack size to 'n' bytes\n"
@@ -247,6 +249,24 @@ static int tjs_cli_parse_options(int argc, char** argv, tjs_cli_flags_t* options
                 tjs_runtime_options->dump_memory = true;
                 break;
 
+            } else if (option_is(&option, 0, "cpu-prof")) {
+                tjs_runtime_options->cpu_profile = true;
+                break;
+
+            } else if (option_is(&option, 0, "cpu-prof-interval")) {
+                char* value = option_get_value(&option);
+                if (!value) {
+                    tjs_cli_print_bad_option(1, &option);
+                    tjs_runtime_options->exit_code = EXIT_CODE_INVALID_ARG;
+                    goto exit;
+                }
+
+                long n = strtol(value, NULL, 10);
+                if (n > 0) {
+                    tjs_runtime_options->cpu_profile_interval = (uint32_t)n;
+                    break;
+                }
+
             } else {
                 tjs_cli_print_bad_option(2, &option);
                 tjs_runtime_options->exit_code = EXIT_CODE_INVALID_ARG;
@@ -717,6 +737,11 @@ int tjs_cli(int argc, char** argv)
     TJSRuntime* tjs_runtime = TJS_NewRuntime(&tjs_runtime_options);
     JSContext* js_context = TJS_GetContext(tjs_runtime);
 
+    // CPU profile
+    if (tjs_runtime_options.cpu_profile && !tjs_cli_flags.empty_run) {
+        tjs_profiler_start(tjs_runtime, tjs_runtime_options.cpu_profile_interval, 0);
+    }
+
     if (tjs_cli_flags.empty_run) {
         goto exit;
 
@@ -765,6 +790,8 @@ int tjs_cli(int argc, char** argv)
 
     tjs_cli_eval_string(js_context, "process?.onExit();", "<exit>");
 
+    tjs_profiler_write_file(tjs_runtime);
+
     // dump memory
     if (tjs_runtime->options.dump_memory) {
         JSMemoryUsage stats;
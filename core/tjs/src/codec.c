@@ -0,0 +1,442 @@
+/* Base64 和十六进制编码和解码 */
+#include "private.h"
+#include "tjs-utils.h"
+
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TJS_CODEC_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define TJS_CODEC_NEON 1
+#include <arm_neon.h>
+#endif
+
+/** 解码表中的特殊值: 填充字符 '=' */
+#define TJS_CODEC_PAD 0x40
+
+/** 解码表中的特殊值: 空白字符, 解码时忽略 */
+#define TJS_CODEC_SPACE 0x80
+
+/** 解码表中的特殊值: 无效的字符 */
+#define TJS_CODEC_INVALID 0xFF
+
+static const char tjs__base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char tjs__base64url_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+static const char tjs__hex_chars[] = "0123456789abcdef";
+
+/** Base64 解码表, 同时支持标准和 URL 安全的字符集 */
+static const uint8_t tjs__base64_values[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0x3E, 0xFF, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+/** 十六进制解码表, 不区分大小写 */
+static const uint8_t tjs__hex_values[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+///////////////////////////////////////////////////////////////
+// encode
+
+/** 编码后的 Base64 字符数, URL 安全的格式不使用填充字符 */
+static size_t tjs__base64_encoded_length(size_t length, bool pad)
+{
+    if (pad) {
+        return (length + 2) / 3 * 4;
+    }
+
+    return length / 3 * 4 + (length % 3 == 0 ? 0 : length % 3 + 1);
+}
+
+/**
+ * Base64 编码
+ * @param dst 大小为 tjs__base64_encoded_length()
+ * @param chars 字符集
+ */
+static void tjs__base64_encode(char* dst, const uint8_t* src, size_t length, const char* chars, bool pad)
+{
+    size_t i = 0;
+    for (; i + 3 <= length; i += 3) {
+        uint32_t value = ((uint32_t)src[i] << 16) | ((uint32_t)src[i + 1] << 8) | src[i + 2];
+        dst[0] = chars[value >> 18];
+        dst[1] = chars[(value >> 12) & 0x3F];
+        dst[2] = chars[(value >> 6) & 0x3F];
+        dst[3] = chars[value & 0x3F];
+        dst += 4;
+    }
+
+    size_t rest = length - i;
+    if (rest == 0) {
+        return;
+    }
+
+    uint32_t value = (uint32_t)src[i] << 16;
+    if (rest == 2) {
+        value |= (uint32_t)src[i + 1] << 8;
+    }
+
+    dst[0] = chars[value >> 18];
+    dst[1] = chars[(value >> 12) & 0x3F];
+    if (rest == 2) {
+        dst[2] = chars[(value >> 6) & 0x3F];
+    }
+
+    if (pad) {
+        if (rest == 1) {
+            dst[2] = '=';
+        }
+
+        dst[3] = '=';
+    }
+}
+
+/**
+ * 十六进制编码 (小写)
+ * - 每次处理 16 个字节 (SSE2/NEON), 剩余的逐个字节查表
+ * @param dst 大小为 length * 2
+ */
+static void tjs__hex_encode(char* dst, const uint8_t* src, size_t length)
+{
+    size_t i = 0;
+
+#if defined(TJS_CODEC_SSE2)
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i alpha = _mm_set1_epi8('a' - '0' - 10);
+    for (; i + 16 <= length; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i high = _mm_and_si128(_mm_srli_epi16(chunk, 4), mask);
+        __m128i low = _mm_and_si128(chunk, mask);
+
+        __m128i first = _mm_unpacklo_epi8(high, low);
+        __m128i second = _mm_unpackhi_epi8(high, low);
+        first = _mm_add_epi8(_mm_add_epi8(first, zero), _mm_and_si128(_mm_cmpgt_epi8(first, nine), alpha));
+        second = _mm_add_epi8(_mm_add_epi8(second, zero), _mm_and_si128(_mm_cmpgt_epi8(second, nine), alpha));
+
+        _mm_storeu_si128((__m128i*)(dst + i * 2), first);
+        _mm_storeu_si128((__m128i*)(dst + i * 2 + 16), second);
+    }
+
+#elif defined(TJS_CODEC_NEON)
+    const uint8x16_t table = vld1q_u8((const uint8_t*)tjs__hex_chars);
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t chunk = vld1q_u8(src + i);
+        uint8x16x2_t digits;
+        digits.val[0] = vqtbl1q_u8(table, vshrq_n_u8(chunk, 4));
+        digits.val[1] = vqtbl1q_u8(table, vandq_u8(chunk, vdupq_n_u8(0x0F)));
+        vst2q_u8((uint8_t*)(dst + i * 2), digits);
+    }
+#endif
+
+    for (; i < length; i++) {
+        dst[i * 2] = tjs__hex_chars[src[i] >> 4];
+        dst[i * 2 + 1] = tjs__hex_chars[src[i] & 0x0F];
+    }
+}
+
+///////////////////////////////////////////////////////////////
+// decode
+
+/**
+ * 解码后的最大字节数, 包含空白字符时实际的长度会更小
+ * - 末尾的填充字符不计算在内
+ */
+static size_t tjs__base64_decoded_length(const uint8_t* src, size_t length)
+{
+    size_t size = length / 4 * 3 + (length % 4 == 3 ? 2 : length % 4 == 2 ? 1 : 0);
+    if (length % 4 == 0) {
+        for (size_t i = length; i > 0 && length - i < 2 && src[i - 1] == '='; i--) {
+            size--;
+        }
+    }
+
+    return size;
+}
+
+/**
+ * Base64 解码
+ * - 每次解码 4 个字符, 遇到空白字符和填充字符时逐个字符处理
+ * - 填充字符是可选的, 但是填充字符后面只能是空白字符或填充字符
+ * @param dst 大小为 tjs__base64_decoded_length()
+ * @param perror 无效字符的位置
+ * @return 解码后的字节数, 出错时返回 -1
+ */
+static ssize_t tjs__base64_decode(uint8_t* dst, const uint8_t* src, size_t length, size_t* perror)
+{
+    const uint8_t* values = tjs__base64_values;
+    size_t written = 0;
+    size_t i = 0;
+    uint32_t bits = 0;
+    int count = 0;
+
+    while (i < length) {
+        if (count == 0) {
+            for (; i + 4 <= length; i += 4) {
+                uint32_t a = values[src[i]];
+                uint32_t b = values[src[i + 1]];
+                uint32_t c = values[src[i + 2]];
+                uint32_t d = values[src[i + 3]];
+                if ((a | b | c | d) >= 64) {
+                    break;
+                }
+
+                uint32_t value = (a << 18) | (b << 12) | (c << 6) | d;
+                dst[written] = (uint8_t)(value >> 16);
+                dst[written + 1] = (uint8_t)(value >> 8);
+                dst[written + 2] = (uint8_t)value;
+                written += 3;
+            }
+
+            if (i >= length) {
+                break;
+            }
+        }
+
+        uint8_t value = values[src[i]];
+        if (value < 64) {
+            bits = (bits << 6) | value;
+            if (++count == 4) {
+                dst[written] = (uint8_t)(bits >> 16);
+                dst[written + 1] = (uint8_t)(bits >> 8);
+                dst[written + 2] = (uint8_t)bits;
+                written += 3;
+                bits = 0;
+                count = 0;
+            }
+
+        } else if (value == TJS_CODEC_PAD) {
+            break;
+
+        } else if (value != TJS_CODEC_SPACE) {
+            *perror = i;
+            return -1;
+        }
+
+        i++;
+    }
+
+    // 填充字符后面只能是空白字符或填充字符
+    for (size_t end = i; i < length; i++) {
+        uint8_t value = values[src[i]];
+        if (value != TJS_CODEC_PAD && value != TJS_CODEC_SPACE) {
+            *perror = i;
+            return -1;
+
+        } else if (value == TJS_CODEC_PAD && count < 2) {
+            *perror = end;
+            return -1;
+        }
+    }
+
+    if (count == 1) {
+        *perror = length;
+        return -1;
+
+    } else if (count == 2) {
+        dst[written++] = (uint8_t)(bits >> 4);
+
+    } else if (count == 3) {
+        dst[written++] = (uint8_t)(bits >> 10);
+        dst[written++] = (uint8_t)(bits >> 2);
+    }
+
+    return written;
+}
+
+/**
+ * 十六进制解码, 不区分大小写, 忽略字节之间的空白字符
+ * @param dst 大小为 length / 2
+ * @param perror 无效字符的位置
+ * @return 解码后的字节数, 出错时返回 -1
+ */
+static ssize_t tjs__hex_decode(uint8_t* dst, const uint8_t* src, size_t length, size_t* perror)
+{
+    const uint8_t* values = tjs__hex_values;
+    size_t written = 0;
+    size_t i = 0;
+
+    while (i < length) {
+        uint8_t high = values[src[i]];
+        if (high == TJS_CODEC_SPACE) {
+            i++;
+            continue;
+        }
+
+        uint8_t low = i + 1 < length ? values[src[i + 1]] : TJS_CODEC_INVALID;
+        if (high >= 16 || low >= 16) {
+            *perror = high >= 16 ? i : i + 1;
+            return -1;
+        }
+
+        dst[written++] = (uint8_t)((high << 4) | low);
+        i += 2;
+    }
+
+    return written;
+}
+
+///////////////////////////////////////////////////////////////
+// module
+
+/**
+ * 编码为字符串: (data, type?)
+ * - 直接写入新建的 8 位字符串中, 不需要中间缓存区
+ */
+JSValue tjs_codec_encode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    tjs_buffer_t buffer = TJS_GetArrayBuffer(ctx, argv[0]);
+    if (JS_IsException(buffer.error)) {
+        return buffer.error;
+    }
+
+    int32_t type = argc > 1 ? TJS_ToInt32(ctx, argv[1], -1) : CODE_HEX;
+
+    size_t length = 0;
+    if (type == CODE_HEX) {
+        length = buffer.length * 2;
+
+    } else if (type == CODE_BASE64 || type == CODE_BASE64URL) {
+        length = tjs__base64_encoded_length(buffer.length, type == CODE_BASE64);
+
+    } else {
+        return JS_NewStringLen(ctx, (const char*)buffer.data, buffer.length);
+    }
+
+    void* chars = NULL;
+    JSValue result = JS_NewStringBuffer(ctx, length, false, &chars);
+    if (JS_IsException(result) || length == 0) {
+        return result;
+    }
+
+    if (type == CODE_HEX) {
+        tjs__hex_encode(chars, buffer.data, buffer.length);
+
+    } else if (type == CODE_BASE64) {
+        tjs__base64_encode(chars, buffer.data, buffer.length, tjs__base64_chars, true);
+
+    } else {
+        tjs__base64_encode(chars, buffer.data, buffer.length, tjs__base64url_chars, false);
+    }
+
+    return result;
+}
+
+/**
+ * 解码为 Uint8Array: (data, type?)
+ * - 直接读取字符串的字符, 也可以是包含 ASCII 字符的 BufferSource
+ * - 包含无效的字符时抛出 TypeError
+ */
+JSValue tjs_codec_decode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    int32_t type = argc > 1 ? TJS_ToInt32(ctx, argv[1], -1) : CODE_HEX;
+    if (type != CODE_HEX && type != CODE_BASE64 && type != CODE_BASE64URL) {
+        return tjs_utf8_encode(ctx, this_val, 1, argv);
+    }
+
+    JSValue string = JS_UNDEFINED;
+    const uint8_t* src = NULL;
+    uint8_t* narrow = NULL;
+    size_t length = 0;
+
+    if (JS_IsString(argv[0]) || !(JS_IsArrayBuffer(argv[0]) || JS_IsTypedArray(argv[0]))) {
+        string = JS_ToString(ctx, argv[0]);
+        if (JS_IsException(string)) {
+            return string;
+        }
+
+        JS_BOOL is_wide = FALSE;
+        const void* chars = JS_GetStringBuffer(string, &length, &is_wide);
+        src = chars;
+
+        if (is_wide) {
+            // 大于 0xFF 的字符都是无效的字符
+            narrow = js_malloc(ctx, length > 0 ? length : 1);
+            if (!narrow) {
+                JS_FreeValue(ctx, string);
+                return JS_EXCEPTION;
+            }
+
+            const uint16_t* units = chars;
+            for (size_t i = 0; i < length; i++) {
+                narrow[i] = units[i] > 0xFF ? TJS_CODEC_INVALID : (uint8_t)units[i];
+            }
+
+            src = narrow;
+        }
+
+    } else {
+        tjs_buffer_t buffer = TJS_GetArrayBuffer(ctx, argv[0]);
+        if (JS_IsException(buffer.error)) {
+            return buffer.error;
+        }
+
+        src = buffer.data;
+        length = buffer.length;
+    }
+
+    size_t capacity = type == CODE_HEX ? length / 2 : tjs__base64_decoded_length(src, length);
+    uint8_t* data = js_malloc(ctx, capacity > 0 ? capacity : 1);
+
+    ssize_t size = -1;
+    size_t error = 0;
+    if (data) {
+        if (type == CODE_HEX) {
+            size = tjs__hex_decode(data, src, length, &error);
+
+        } else {
+            size = tjs__base64_decode(data, src, length, &error);
+        }
+    }
+
+    js_free(ctx, narrow);
+    JS_FreeValue(ctx, string);
+
+    if (!data) {
+        return JS_EXCEPTION;
+
+    } else if (size < 0) {
+        js_free(ctx, data);
+        return JS_ThrowTypeError(ctx, "The input is not valid %s (at offset %zu)", type == CODE_HEX ? "hex" : "base64", error);
+    }
+
+    // 包含空白字符时缩小缓存区
+    if ((size_t)size < capacity) {
+        uint8_t* shrunk = js_realloc(ctx, data, size > 0 ? size : 1);
+        if (shrunk) {
+            data = shrunk;
+        }
+    }
+
+    return TJS_NewUint8Array(ctx, data, size);
+}
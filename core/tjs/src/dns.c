@@ -27,6 +27,8 @@
 
 #include <string.h>
 
+extern void tjs_mod_dns_resolver_init(JSContext* ctx, JSValue dns);
+
 typedef struct tjs_dns_getaddrinfo_req_s {
     JSContext* ctx;
     uv_getaddrinfo_t req;
@@ -180,6 +182,7 @@ void tjs_mod_dns_init(JSContext* ctx, JSModuleDef* m)
 {
     JSValue obj = JS_NewObject(ctx);
     JS_SetPropertyFunctionList(ctx, obj, tjs_dns_funcs, countof(tjs_dns_funcs));
+    tjs_mod_dns_resolver_init(ctx, obj);
     JS_SetModuleExport(ctx, m, "dns", obj);
 }
 
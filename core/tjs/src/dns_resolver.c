@@ -0,0 +1,1146 @@
+/* DNS stub resolver */
+#include "private.h"
+#include "tjs-utils.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+/** 最多使用的 DNS 服务器个数, 同 glibc 的 MAXNS */
+#define DNS_MAX_SERVERS 3
+
+/** 默认每次查询的超时时间 (毫秒), 同 resolv.conf 的 `options timeout:5` */
+#define DNS_DEFAULT_TIMEOUT 5000
+
+/** 默认每个服务器的尝试次数, 同 resolv.conf 的 `options attempts:2` */
+#define DNS_DEFAULT_ATTEMPTS 2
+
+/** 查询消息的最大长度 */
+#define DNS_MAX_QUERY_SIZE 512
+
+/** 接收缓存区大小 */
+#define DNS_RECV_BUFFER_SIZE 4096
+
+/** 域名的最大长度 */
+#define DNS_MAX_NAME 255
+
+/** 解压缩域名时最多跳转的次数, 防止恶意构造的消息导致死循环 */
+#define DNS_MAX_JUMPS 32
+
+/** hosts 文件中的记录的 TTL (秒) */
+#define DNS_HOSTS_TTL 60
+
+#define DNS_TYPE_A 1
+#define DNS_TYPE_SOA 6
+#define DNS_TYPE_AAAA 28
+#define DNS_TYPE_SRV 33
+
+#define DNS_CLASS_IN 1
+
+#define DNS_RCODE_SERVFAIL 2
+#define DNS_RCODE_REFUSED 5
+
+#define DNS_FLAG_QR 0x8000
+#define DNS_FLAG_TC 0x0200
+#define DNS_FLAG_RD 0x0100
+
+typedef struct dns_resolver_s dns_resolver_t;
+
+/** hosts 文件中的一条记录 */
+typedef struct dns_host_s {
+    struct dns_host_s* next;
+    int family;
+    uint8_t address[16];
+    char name[];
+} dns_host_t;
+
+/** 一个正在进行的查询, 相同的并发查询 (域名和类型都相同) 共用同一个查询 */
+typedef struct dns_query_s {
+    struct list_head link;
+    dns_resolver_t* resolver;
+    uint16_t id;
+    uint16_t type;
+
+    /** 已经发送的次数, 每次重试都换下一个服务器 */
+    uint32_t tries;
+
+    /** 本次发送的超时时间 */
+    uint64_t deadline;
+
+    /** 等待这个查询结果的 Promise */
+    TJSPromise* waiters;
+    uint32_t waiter_count;
+    uint32_t waiter_capacity;
+
+    uint32_t packet_size;
+    uint8_t packet[DNS_MAX_QUERY_SIZE];
+    char name[DNS_MAX_NAME + 1];
+} dns_query_t;
+
+struct dns_resolver_s {
+    JSContext* ctx;
+    uv_udp_t udp4;
+    uv_udp_t udp6;
+    uv_timer_t timer;
+
+    struct sockaddr_storage servers[DNS_MAX_SERVERS];
+    uint32_t server_count;
+    uint32_t timeout;
+    uint32_t attempts;
+
+    dns_host_t* hosts;
+    struct list_head queries;
+
+    /** 还没有关闭的句柄个数 */
+    uint32_t handle_count;
+
+    int udp4_started;
+    int udp6_started;
+    int closing;
+    int finalized;
+
+    uint8_t buffer[DNS_RECV_BUFFER_SIZE];
+};
+
+static JSClassID dns_resolver_class_id;
+
+static uint16_t dns_read16(const uint8_t* data)
+{
+    return (uint16_t)((data[0] << 8) | data[1]);
+}
+
+static uint32_t dns_read32(const uint8_t* data)
+{
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+}
+
+static void dns_write16(uint8_t* data, uint16_t value)
+{
+    data[0] = value >> 8;
+    data[1] = value & 0xff;
+}
+
+/** 去掉域名末尾的 `.`, 返回域名的长度 */
+static size_t dns_name_length(const char* name)
+{
+    size_t length = strlen(name);
+    if (length > 0 && name[length - 1] == '.') {
+        length--;
+    }
+
+    return length;
+}
+
+static int dns_name_equal(const char* a, const char* b)
+{
+    size_t length = dns_name_length(a);
+    return length == dns_name_length(b) && strncasecmp(a, b, length) == 0;
+}
+
+static int dns_address_equal(const struct sockaddr_storage* a, const struct sockaddr* b)
+{
+    if (a->ss_family != b->sa_family) {
+        return 0;
+
+    } else if (b->sa_family == AF_INET) {
+        const struct sockaddr_in* a4 = (const struct sockaddr_in*)a;
+        const struct sockaddr_in* b4 = (const struct sockaddr_in*)b;
+        return a4->sin_port == b4->sin_port && a4->sin_addr.s_addr == b4->sin_addr.s_addr;
+
+    } else if (b->sa_family == AF_INET6) {
+        const struct sockaddr_in6* a6 = (const struct sockaddr_in6*)a;
+        const struct sockaddr_in6* b6 = (const struct sockaddr_in6*)b;
+        return a6->sin6_port == b6->sin6_port && memcmp(&a6->sin6_addr, &b6->sin6_addr, 16) == 0;
+    }
+
+    return 0;
+}
+
+/**
+ * 解析服务器地址, 如 `8.8.8.8`, `127.0.0.1:5353`, `::1` 或 `[::1]:5353`
+ * @return 成功返回 0
+ */
+static int dns_parse_server(const char* text, struct sockaddr_storage* addr)
+{
+    char host[64];
+    int port = 53;
+
+    const char* end = NULL;
+    const char* colon = strchr(text, ':');
+    if (text[0] == '[') {
+        text++;
+        end = strchr(text, ']');
+        if (end == NULL) {
+            return UV_EINVAL;
+
+        } else if (end[1] == ':') {
+            port = atoi(end + 2);
+        }
+
+    } else if (colon && strchr(colon + 1, ':') == NULL) {
+        // IPv4 地址和端口
+        end = colon;
+        port = atoi(colon + 1);
+
+    } else {
+        end = text + strlen(text);
+    }
+
+    size_t length = end - text;
+    if (length == 0 || length >= sizeof(host) || port <= 0 || port > 65535) {
+        return UV_EINVAL;
+    }
+
+    memcpy(host, text, length);
+    host[length] = '\0';
+
+    memset(addr, 0, sizeof(*addr));
+    if (uv_ip4_addr(host, port, (struct sockaddr_in*)addr) == 0) {
+        return 0;
+    }
+
+    return uv_ip6_addr(host, port, (struct sockaddr_in6*)addr);
+}
+
+static void dns_resolver_add_server(dns_resolver_t* resolver, const char* text)
+{
+    if (resolver->server_count >= DNS_MAX_SERVERS) {
+        return;
+    }
+
+    struct sockaddr_storage* addr = &resolver->servers[resolver->server_count];
+    if (dns_parse_server(text, addr) == 0) {
+        resolver->server_count++;
+    }
+}
+
+/** 读取 resolv.conf 中的 `nameserver` 和 `options timeout:n attempts:n` */
+static void dns_resolver_load_config(dns_resolver_t* resolver, const char* filename, int load_servers)
+{
+    FILE* file = fopen(filename, "r");
+    if (file == NULL) {
+        return;
+    }
+
+    char line[512];
+    while (fgets(line, sizeof(line), file)) {
+        char* saveptr = NULL;
+        char* key = strtok_r(line, " \t\r\n", &saveptr);
+        if (key == NULL || key[0] == '#' || key[0] == ';') {
+            continue;
+
+        } else if (strcmp(key, "nameserver") == 0) {
+            char* value = strtok_r(NULL, " \t\r\n", &saveptr);
+            if (value && load_servers) {
+                dns_resolver_add_server(resolver, value);
+            }
+
+        } else if (strcmp(key, "options") == 0) {
+            char* value;
+            while ((value = strtok_r(NULL, " \t\r\n", &saveptr))) {
+                if (strncmp(value, "timeout:", 8) == 0) {
+                    int timeout = atoi(value + 8);
+                    if (timeout > 0) {
+                        resolver->timeout = timeout * 1000;
+                    }
+
+                } else if (strncmp(value, "attempts:", 9) == 0) {
+                    int attempts = atoi(value + 9);
+                    if (attempts > 0) {
+                        resolver->attempts = attempts;
+                    }
+                }
+            }
+        }
+    }
+
+    fclose(file);
+}
+
+static void dns_resolver_load_hosts(dns_resolver_t* resolver, const char* filename)
+{
+    FILE* file = fopen(filename, "r");
+    if (file == NULL) {
+        return;
+    }
+
+    dns_host_t** tail = &resolver->hosts;
+    while (*tail) {
+        tail = &(*tail)->next;
+    }
+
+    char line[1024];
+    while (fgets(line, sizeof(line), file)) {
+        char* comment = strchr(line, '#');
+        if (comment) {
+            *comment = '\0';
+        }
+
+        char* saveptr = NULL;
+        char* address = strtok_r(line, " \t\r\n", &saveptr);
+        if (address == NULL) {
+            continue;
+        }
+
+        uint8_t data[16];
+        int family = AF_INET;
+        if (uv_inet_pton(AF_INET, address, data) != 0) {
+            family = AF_INET6;
+            if (uv_inet_pton(AF_INET6, address, data) != 0) {
+                continue;
+            }
+        }
+
+        char* name;
+        while ((name = strtok_r(NULL, " \t\r\n", &saveptr))) {
+            size_t length = strlen(name);
+            dns_host_t* host = malloc(sizeof(*host) + length + 1);
+            if (host == NULL) {
+                break;
+            }
+
+            host->next = NULL;
+            host->family = family;
+            memcpy(host->address, data, sizeof(data));
+            memcpy(host->name, name, length + 1);
+
+            *tail = host;
+            tail = &host->next;
+        }
+    }
+
+    fclose(file);
+}
+
+static void dns_resolver_free_hosts(dns_resolver_t* resolver)
+{
+    dns_host_t* host = resolver->hosts;
+    while (host) {
+        dns_host_t* next = host->next;
+        free(host);
+        host = next;
+    }
+
+    resolver->hosts = NULL;
+}
+
+/**
+ * 读取 offset 处的域名 (可能是压缩的)
+ * @param name 为 NULL 时只跳过这个域名
+ * @return 返回域名之后的位置, 出错时返回 -1
+ */
+static int dns_read_name(const uint8_t* message, size_t size, size_t offset, char* name, size_t name_size)
+{
+    size_t next = 0;
+    size_t length = 0;
+    int jumps = 0;
+
+    for (;;) {
+        if (offset >= size) {
+            return -1;
+        }
+
+        uint8_t label = message[offset];
+        if ((label & 0xc0) == 0xc0) {
+            // 压缩指针
+            if (offset + 1 >= size || ++jumps > DNS_MAX_JUMPS) {
+                return -1;
+            }
+
+            if (next == 0) {
+                next = offset + 2;
+            }
+
+            offset = ((label & 0x3f) << 8) | message[offset + 1];
+            continue;
+
+        } else if (label & 0xc0) {
+            return -1;
+        }
+
+        offset++;
+        if (label == 0) {
+            break;
+
+        } else if (offset + label > size) {
+            return -1;
+        }
+
+        if (name) {
+            if (length + label + 2 > name_size) {
+                return -1;
+            }
+
+            if (length > 0) {
+                name[length++] = '.';
+            }
+
+            memcpy(name + length, message + offset, label);
+            length += label;
+        }
+
+        offset += label;
+    }
+
+    if (name) {
+        name[length] = '\0';
+    }
+
+    return (int)(next ? next : offset);
+}
+
+/**
+ * 编码查询消息
+ * @return 成功返回 0
+ */
+static int dns_query_encode(dns_query_t* query)
+{
+    uint8_t* packet = query->packet;
+    memset(packet, 0, 12);
+    dns_write16(packet, query->id);
+    dns_write16(packet + 2, DNS_FLAG_RD);
+    dns_write16(packet + 4, 1);
+
+    size_t offset = 12;
+    const char* label = query->name;
+    const char* end = label + dns_name_length(query->name);
+    while (label < end) {
+        const char* dot = memchr(label, '.', end - label);
+        size_t length = (dot ? dot : end) - label;
+        if (length == 0 || length > 63 || offset + length + 1 > DNS_MAX_QUERY_SIZE - 5) {
+            return UV_EINVAL;
+        }
+
+        packet[offset++] = (uint8_t)length;
+        memcpy(packet + offset, label, length);
+        offset += length;
+        label += length + 1;
+    }
+
+    packet[offset++] = 0;
+    dns_write16(packet + offset, query->type);
+    dns_write16(packet + offset + 2, DNS_CLASS_IN);
+    query->packet_size = offset + 4;
+    return 0;
+}
+
+static JSValue dns_new_address(JSContext* ctx, int family, const uint8_t* data)
+{
+    char address[INET6_ADDRSTRLEN] = { 0 };
+    uv_inet_ntop(family, data, address, sizeof(address));
+    return JS_NewString(ctx, address);
+}
+
+static JSValue dns_new_result(JSContext* ctx, int rcode, uint32_t ttl, JSValue answers)
+{
+    JSValue result = JS_NewObject(ctx);
+    JS_DefinePropertyValueStr(ctx, result, "rcode", JS_NewInt32(ctx, rcode), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, result, "ttl", JS_NewUint32(ctx, ttl), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, result, "answers", answers, JS_PROP_C_W_E);
+    return result;
+}
+
+/**
+ * 解析应答消息
+ * 结果为 `{ rcode, ttl, truncated, answers: [{ type, ttl, address } 或 { type, ttl, priority, weight, port, name }] }`,
+ * 没有应答记录时, ttl 为 SOA 记录中的否定应答缓存时间
+ * @return 消息格式错误时返回 JS_UNDEFINED
+ */
+static JSValue dns_decode_response(JSContext* ctx, dns_query_t* query, const uint8_t* message, size_t size)
+{
+    char name[DNS_MAX_NAME + 1];
+    uint16_t flags = dns_read16(message + 2);
+    uint16_t question_count = dns_read16(message + 4);
+    uint16_t answer_count = dns_read16(message + 6);
+    uint16_t authority_count = dns_read16(message + 8);
+
+    // 问题部分必须和查询的相同
+    int offset = 12;
+    if (question_count != 1) {
+        return JS_UNDEFINED;
+    }
+
+    offset = dns_read_name(message, size, offset, name, sizeof(name));
+    if (offset < 0 || offset + 4 > (int)size) {
+        return JS_UNDEFINED;
+
+    } else if (dns_read16(message + offset) != query->type || !dns_name_equal(name, query->name)) {
+        return JS_UNDEFINED;
+    }
+
+    offset += 4;
+
+    JSValue answers = JS_NewArray(ctx);
+    uint32_t count = 0;
+    uint32_t ttl = UINT32_MAX;
+    uint32_t negative_ttl = 0;
+
+    for (uint32_t i = 0; i < (uint32_t)answer_count + authority_count; i++) {
+        offset = dns_read_name(message, size, offset, NULL, 0);
+        if (offset < 0 || offset + 10 > (int)size) {
+            JS_FreeValue(ctx, answers);
+            return JS_UNDEFINED;
+        }
+
+        uint16_t type = dns_read16(message + offset);
+        uint16_t klass = dns_read16(message + offset + 2);
+        uint32_t record_ttl = dns_read32(message + offset + 4) & 0x7fffffff;
+        uint16_t length = dns_read16(message + offset + 8);
+        const uint8_t* data = message + offset + 10;
+        offset += 10 + length;
+        if (offset > (int)size) {
+            JS_FreeValue(ctx, answers);
+            return JS_UNDEFINED;
+
+        } else if (klass != DNS_CLASS_IN) {
+            continue;
+        }
+
+        if (i >= answer_count) {
+            // 权威部分: SOA 记录的 MINIMUM 字段决定否定应答的缓存时间 (RFC 2308)
+            if (type == DNS_TYPE_SOA && length >= 22) {
+                uint32_t minimum = dns_read32(data + length - 4);
+                negative_ttl = record_ttl < minimum ? record_ttl : minimum;
+            }
+
+            continue;
+        }
+
+        // CNAME 等其他记录也计入 TTL, 整条解析链都有效时结果才有效
+        if (record_ttl < ttl) {
+            ttl = record_ttl;
+        }
+
+        if (type != query->type) {
+            continue;
+        }
+
+        JSValue item = JS_UNDEFINED;
+        if (type == DNS_TYPE_A && length == 4) {
+            item = JS_NewObject(ctx);
+            JS_DefinePropertyValueStr(ctx, item, "address", dns_new_address(ctx, AF_INET, data), JS_PROP_C_W_E);
+
+        } else if (type == DNS_TYPE_AAAA && length == 16) {
+            item = JS_NewObject(ctx);
+            JS_DefinePropertyValueStr(ctx, item, "address", dns_new_address(ctx, AF_INET6, data), JS_PROP_C_W_E);
+
+        } else if (type == DNS_TYPE_SRV && length > 6) {
+            size_t target = data - message + 6;
+            if (dns_read_name(message, size, target, name, sizeof(name)) < 0) {
+                continue;
+            }
+
+            item = JS_NewObject(ctx);
+            JS_DefinePropertyValueStr(ctx, item, "priority", JS_NewInt32(ctx, dns_read16(data)), JS_PROP_C_W_E);
+            JS_DefinePropertyValueStr(ctx, item, "weight", JS_NewInt32(ctx, dns_read16(data + 2)), JS_PROP_C_W_E);
+            JS_DefinePropertyValueStr(ctx, item, "port", JS_NewInt32(ctx, dns_read16(data + 4)), JS_PROP_C_W_E);
+            JS_DefinePropertyValueStr(ctx, item, "name", JS_NewString(ctx, name), JS_PROP_C_W_E);
+
+        } else {
+            continue;
+        }
+
+        JS_DefinePropertyValueStr(ctx, item, "type", JS_NewInt32(ctx, type), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, item, "ttl", JS_NewUint32(ctx, record_ttl), JS_PROP_C_W_E);
+        JS_DefinePropertyValueUint32(ctx, answers, count++, item, JS_PROP_C_W_E);
+    }
+
+    if (count == 0) {
+        ttl = negative_ttl;
+    }
+
+    JSValue result = dns_new_result(ctx, flags & 0x0f, ttl, answers);
+    if (flags & DNS_FLAG_TC) {
+        JS_DefinePropertyValueStr(ctx, result, "truncated", JS_TRUE, JS_PROP_C_W_E);
+    }
+
+    return result;
+}
+
+/** 在 hosts 文件中查找 A 或 AAAA 记录, 没有找到时返回 JS_UNDEFINED */
+static JSValue dns_resolver_lookup_hosts(dns_resolver_t* resolver, const char* name, int type)
+{
+    JSContext* ctx = resolver->ctx;
+    int family = (type == DNS_TYPE_A) ? AF_INET : (type == DNS_TYPE_AAAA) ? AF_INET6 : 0;
+    if (family == 0) {
+        return JS_UNDEFINED;
+    }
+
+    JSValue answers = JS_UNDEFINED;
+    uint32_t count = 0;
+    for (dns_host_t* host = resolver->hosts; host; host = host->next) {
+        if (host->family != family || !dns_name_equal(host->name, name)) {
+            continue;
+        }
+
+        if (count == 0) {
+            answers = JS_NewArray(ctx);
+        }
+
+        JSValue item = JS_NewObject(ctx);
+        JS_DefinePropertyValueStr(ctx, item, "address", dns_new_address(ctx, family, host->address), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, item, "type", JS_NewInt32(ctx, type), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, item, "ttl", JS_NewUint32(ctx, DNS_HOSTS_TTL), JS_PROP_C_W_E);
+        JS_DefinePropertyValueUint32(ctx, answers, count++, item, JS_PROP_C_W_E);
+    }
+
+    if (count == 0) {
+        return JS_UNDEFINED;
+    }
+
+    return dns_new_result(ctx, 0, DNS_HOSTS_TTL, answers);
+}
+
+static void dns_query_settle(dns_query_t* query, bool is_reject, JSValue arg)
+{
+    JSContext* ctx = query->resolver->ctx;
+    list_del(&query->link);
+
+    for (uint32_t i = 0; i < query->waiter_count; i++) {
+        JSValue value = JS_DupValue(ctx, arg);
+        TJS_SettlePromise(ctx, &query->waiters[i], is_reject, 1, (JSValueConst*)&value);
+    }
+
+    JS_FreeValue(ctx, arg);
+    free(query->waiters);
+    free(query);
+}
+
+static void dns_query_free_rt(JSRuntime* runtime, dns_query_t* query)
+{
+    list_del(&query->link);
+
+    for (uint32_t i = 0; i < query->waiter_count; i++) {
+        TJS_FreePromiseRT(runtime, &query->waiters[i]);
+    }
+
+    free(query->waiters);
+    free(query);
+}
+
+static void dns_resolver_alloc_callback(uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf)
+{
+    dns_resolver_t* resolver = handle->data;
+    buf->base = (char*)resolver->buffer;
+    buf->len = sizeof(resolver->buffer);
+}
+
+static void dns_query_send(dns_query_t* query);
+static void dns_resolver_update_timer(dns_resolver_t* resolver);
+
+static void dns_resolver_recv_callback(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf, const struct sockaddr* addr, unsigned flags)
+{
+    dns_resolver_t* resolver = handle->data;
+    CHECK_NOT_NULL(resolver);
+
+    if (nread < 12 || addr == NULL || resolver->closing) {
+        return;
+    }
+
+    const uint8_t* message = (const uint8_t*)buf->base;
+    uint16_t id = dns_read16(message);
+    if ((dns_read16(message + 2) & DNS_FLAG_QR) == 0) {
+        return;
+    }
+
+    struct list_head* el;
+    list_for_each(el, &resolver->queries)
+    {
+        dns_query_t* query = list_entry(el, dns_query_t, link);
+        if (query->id != id || query->tries == 0) {
+            continue;
+        }
+
+        // 只接受当前查询的服务器的应答
+        uint32_t index = (query->tries - 1) % resolver->server_count;
+        if (!dns_address_equal(&resolver->servers[index], addr)) {
+            continue;
+        }
+
+        JSValue result = dns_decode_response(resolver->ctx, query, message, nread);
+        if (JS_IsUndefined(result)) {
+            return;
+        }
+
+        int rcode = dns_read16(message + 2) & 0x0f;
+        if ((rcode == DNS_RCODE_SERVFAIL || rcode == DNS_RCODE_REFUSED) && query->tries < resolver->server_count * resolver->attempts) {
+            // 服务器出错时尝试下一个服务器
+            JS_FreeValue(resolver->ctx, result);
+            dns_query_send(query);
+            dns_resolver_update_timer(resolver);
+            return;
+        }
+
+        dns_query_settle(query, false, result);
+        return;
+    }
+}
+
+/** 按需绑定并开始接收, 两种协议分别使用一个套接字 */
+static uv_udp_t* dns_resolver_get_udp(dns_resolver_t* resolver, int family)
+{
+    struct sockaddr_storage ss;
+    uv_udp_t* udp = (family == AF_INET6) ? &resolver->udp6 : &resolver->udp4;
+    int* started = (family == AF_INET6) ? &resolver->udp6_started : &resolver->udp4_started;
+    if (*started) {
+        return udp;
+    }
+
+    if (family == AF_INET6) {
+        uv_ip6_addr("::", 0, (struct sockaddr_in6*)&ss);
+    } else {
+        uv_ip4_addr("0.0.0.0", 0, (struct sockaddr_in*)&ss);
+    }
+
+    if (uv_udp_bind(udp, (struct sockaddr*)&ss, 0) != 0) {
+        return NULL;
+
+    } else if (uv_udp_recv_start(udp, dns_resolver_alloc_callback, dns_resolver_recv_callback) != 0) {
+        return NULL;
+    }
+
+    *started = 1;
+    return udp;
+}
+
+static void dns_resolver_timer_callback(uv_timer_t* handle);
+
+static void dns_resolver_update_timer(dns_resolver_t* resolver)
+{
+    if (list_empty(&resolver->queries)) {
+        uv_timer_stop(&resolver->timer);
+        return;
+    }
+
+    uint64_t deadline = UINT64_MAX;
+    struct list_head* el;
+    list_for_each(el, &resolver->queries)
+    {
+        dns_query_t* query = list_entry(el, dns_query_t, link);
+        if (query->deadline < deadline) {
+            deadline = query->deadline;
+        }
+    }
+
+    uint64_t now = uv_now(TJS_GetLoop(resolver->ctx));
+    uv_timer_start(&resolver->timer, dns_resolver_timer_callback, deadline > now ? deadline - now : 0, 0);
+}
+
+/** 发送查询消息, 每次发送都换下一个服务器 */
+static void dns_query_send(dns_query_t* query)
+{
+    dns_resolver_t* resolver = query->resolver;
+    uv_loop_t* loop = TJS_GetLoop(resolver->ctx);
+
+    uint32_t index = query->tries % resolver->server_count;
+    query->tries++;
+    query->deadline = uv_now(loop) + resolver->timeout;
+
+    struct sockaddr* addr = (struct sockaddr*)&resolver->servers[index];
+    uv_udp_t* udp = dns_resolver_get_udp(resolver, addr->sa_family);
+
+    uv_buf_t buf = uv_buf_init((char*)query->packet, query->packet_size);
+    if (udp == NULL || uv_udp_try_send(udp, &buf, 1, addr) < 0) {
+        // 发送失败时马上重试下一个服务器
+        query->deadline = uv_now(loop);
+    }
+}
+
+static void dns_resolver_timer_callback(uv_timer_t* handle)
+{
+    dns_resolver_t* resolver = handle->data;
+    CHECK_NOT_NULL(resolver);
+
+    uint64_t now = uv_now(handle->loop);
+    uint32_t max_tries = resolver->server_count * resolver->attempts;
+
+    struct list_head *el, *el1;
+    list_for_each_safe(el, el1, &resolver->queries)
+    {
+        dns_query_t* query = list_entry(el, dns_query_t, link);
+        if (query->deadline > now) {
+            continue;
+
+        } else if (query->tries < max_tries) {
+            dns_query_send(query);
+
+        } else {
+            dns_query_settle(query, true, tjs_new_uv_error(resolver->ctx, UV_ETIMEDOUT));
+        }
+    }
+
+    dns_resolver_update_timer(resolver);
+}
+
+static dns_query_t* dns_resolver_find_query(dns_resolver_t* resolver, const char* name, int type)
+{
+    struct list_head* el;
+    list_for_each(el, &resolver->queries)
+    {
+        dns_query_t* query = list_entry(el, dns_query_t, link);
+        if (query->type == type && dns_name_equal(query->name, name)) {
+            return query;
+        }
+    }
+
+    return NULL;
+}
+
+/** 生成一个和其他正在进行的查询都不相同的随机 ID */
+static uint16_t dns_resolver_new_id(dns_resolver_t* resolver)
+{
+    for (;;) {
+        uint16_t id = 0;
+        uv_random(NULL, NULL, &id, sizeof(id), 0, NULL);
+
+        int used = 0;
+        struct list_head* el;
+        list_for_each(el, &resolver->queries)
+        {
+            dns_query_t* query = list_entry(el, dns_query_t, link);
+            if (query->id == id) {
+                used = 1;
+                break;
+            }
+        }
+
+        if (!used) {
+            return id;
+        }
+    }
+}
+
+static void dns_resolver_maybe_free(dns_resolver_t* resolver)
+{
+    if (resolver->finalized && resolver->handle_count == 0) {
+        dns_resolver_free_hosts(resolver);
+        free(resolver);
+    }
+}
+
+static void dns_resolver_close_callback(uv_handle_t* handle)
+{
+    dns_resolver_t* resolver = handle->data;
+    CHECK_NOT_NULL(resolver);
+
+    resolver->handle_count--;
+    dns_resolver_maybe_free(resolver);
+}
+
+static void dns_resolver_close(dns_resolver_t* resolver)
+{
+    if (resolver->closing) {
+        return;
+    }
+
+    resolver->closing = 1;
+    uv_close((uv_handle_t*)&resolver->udp4, dns_resolver_close_callback);
+    uv_close((uv_handle_t*)&resolver->udp6, dns_resolver_close_callback);
+    uv_close((uv_handle_t*)&resolver->timer, dns_resolver_close_callback);
+}
+
+static void dns_resolver_finalizer(JSRuntime* runtime, JSValue val)
+{
+    dns_resolver_t* resolver = JS_GetOpaque(val, dns_resolver_class_id);
+    if (resolver == NULL) {
+        return;
+    }
+
+    struct list_head *el, *el1;
+    list_for_each_safe(el, el1, &resolver->queries)
+    {
+        dns_query_t* query = list_entry(el, dns_query_t, link);
+        dns_query_free_rt(runtime, query);
+    }
+
+    resolver->finalized = 1;
+    dns_resolver_close(resolver);
+    dns_resolver_maybe_free(resolver);
+}
+
+static void dns_resolver_mark(JSRuntime* runtime, JSValueConst val, JS_MarkFunc* mark_func)
+{
+    dns_resolver_t* resolver = JS_GetOpaque(val, dns_resolver_class_id);
+    if (resolver == NULL) {
+        return;
+    }
+
+    struct list_head* el;
+    list_for_each(el, &resolver->queries)
+    {
+        dns_query_t* query = list_entry(el, dns_query_t, link);
+        for (uint32_t i = 0; i < query->waiter_count; i++) {
+            TJS_MarkPromise(runtime, &query->waiters[i], mark_func);
+        }
+    }
+}
+
+static JSClassDef dns_resolver_class = {
+    "Resolver",
+    .finalizer = dns_resolver_finalizer,
+    .gc_mark = dns_resolver_mark,
+};
+
+static dns_resolver_t* dns_resolver_get(JSContext* ctx, JSValueConst obj)
+{
+    return JS_GetOpaque2(ctx, obj, dns_resolver_class_id);
+}
+
+/**
+ * `new Resolver({ servers, timeout, attempts, resolvConf, hosts })`
+ * @param servers 服务器地址列表, 如 `['127.0.0.1:5353', '[::1]:53']`, 默认读取 resolvConf 中的 `nameserver`
+ * @param timeout 每次查询的超时时间 (毫秒)
+ * @param attempts 每个服务器的尝试次数
+ * @param resolvConf resolv.conf 文件路径, 默认为 `/etc/resolv.conf`
+ * @param hosts hosts 文件路径, 默认为 `/etc/hosts`, 为空字符串时不使用 hosts 文件
+ */
+static JSValue dns_resolver_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst* argv)
+{
+    JSValueConst options = argc > 0 ? argv[0] : JS_UNDEFINED;
+    if (!JS_IsUndefined(options) && !JS_IsObject(options)) {
+        return JS_ThrowTypeError(ctx, "options must be an object");
+    }
+
+    JSValue obj = JS_NewObjectClass(ctx, dns_resolver_class_id);
+    if (JS_IsException(obj)) {
+        return obj;
+    }
+
+    dns_resolver_t* resolver = calloc(1, sizeof(*resolver));
+    if (!resolver) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+
+    resolver->ctx = ctx;
+    resolver->timeout = DNS_DEFAULT_TIMEOUT;
+    resolver->attempts = DNS_DEFAULT_ATTEMPTS;
+    init_list_head(&resolver->queries);
+
+    uv_loop_t* loop = TJS_GetLoop(ctx);
+    CHECK_EQ(uv_udp_init(loop, &resolver->udp4), 0);
+    CHECK_EQ(uv_udp_init(loop, &resolver->udp6), 0);
+    CHECK_EQ(uv_timer_init(loop, &resolver->timer), 0);
+    resolver->udp4.data = resolver;
+    resolver->udp6.data = resolver;
+    resolver->timer.data = resolver;
+    resolver->handle_count = 3;
+
+    // 只有定时器 (有正在进行的查询时) 才保持事件循环运行
+    uv_unref((uv_handle_t*)&resolver->udp4);
+    uv_unref((uv_handle_t*)&resolver->udp6);
+
+    JS_SetOpaque(obj, resolver);
+
+    JSValue servers = JS_IsObject(options) ? JS_GetPropertyStr(ctx, options, "servers") : JS_UNDEFINED;
+    JSValue resolv_conf = JS_IsObject(options) ? JS_GetPropertyStr(ctx, options, "resolvConf") : JS_UNDEFINED;
+    JSValue hosts = JS_IsObject(options) ? JS_GetPropertyStr(ctx, options, "hosts") : JS_UNDEFINED;
+
+    const char* filename = JS_IsString(resolv_conf) ? JS_ToCString(ctx, resolv_conf) : NULL;
+    dns_resolver_load_config(resolver, filename ? filename : "/etc/resolv.conf", !JS_IsArray(ctx, servers));
+    JS_FreeCString(ctx, filename);
+
+    if (JS_IsArray(ctx, servers)) {
+        uint32_t length = TJS_GetPropertyUint32(ctx, servers, "length", 0);
+        for (uint32_t i = 0; i < length; i++) {
+            JSValue value = JS_GetPropertyUint32(ctx, servers, i);
+            const char* server = JS_ToCString(ctx, value);
+            JS_FreeValue(ctx, value);
+            if (server == NULL) {
+                continue;
+            }
+
+            struct sockaddr_storage addr;
+            int ret = dns_parse_server(server, &addr);
+            JS_FreeCString(ctx, server);
+            if (ret != 0) {
+                JS_FreeValue(ctx, servers);
+                JS_FreeValue(ctx, resolv_conf);
+                JS_FreeValue(ctx, hosts);
+                JS_FreeValue(ctx, obj);
+                return JS_ThrowTypeError(ctx, "invalid DNS server address");
+            }
+
+            if (resolver->server_count < DNS_MAX_SERVERS) {
+                resolver->servers[resolver->server_count++] = addr;
+            }
+        }
+    }
+
+    if (resolver->server_count == 0) {
+        dns_resolver_add_server(resolver, "127.0.0.1");
+    }
+
+    filename = JS_IsString(hosts) ? JS_ToCString(ctx, hosts) : NULL;
+    if (filename == NULL) {
+        dns_resolver_load_hosts(resolver, "/etc/hosts");
+
+    } else if (filename[0]) {
+        dns_resolver_load_hosts(resolver, filename);
+    }
+
+    JS_FreeCString(ctx, filename);
+
+    if (JS_IsObject(options)) {
+        resolver->timeout = TJS_GetPropertyUint32(ctx, options, "timeout", resolver->timeout);
+        resolver->attempts = TJS_GetPropertyUint32(ctx, options, "attempts", resolver->attempts);
+    }
+
+    if (resolver->timeout == 0) {
+        resolver->timeout = DNS_DEFAULT_TIMEOUT;
+    }
+
+    if (resolver->attempts == 0) {
+        resolver->attempts = 1;
+    }
+
+    JS_FreeValue(ctx, servers);
+    JS_FreeValue(ctx, resolv_conf);
+    JS_FreeValue(ctx, hosts);
+    return obj;
+}
+
+/**
+ * 查询指定域名的记录, 同时进行的相同查询只发送一次
+ * `query(name, type)`
+ * @param type 记录类型, 如 `Resolver.A`, `Resolver.AAAA`, `Resolver.SRV`
+ * @return Promise<{ rcode, ttl, truncated, answers }>
+ */
+static JSValue dns_resolver_query(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    dns_resolver_t* resolver = dns_resolver_get(ctx, this_val);
+    if (!resolver) {
+        return JS_EXCEPTION;
+
+    } else if (resolver->closing) {
+        return tjs_throw_uv_error(ctx, UV_EINVAL);
+    }
+
+    int type = TJS_ToInt32(ctx, argc > 1 ? argv[1] : JS_UNDEFINED, DNS_TYPE_A);
+    if (type != DNS_TYPE_A && type != DNS_TYPE_AAAA && type != DNS_TYPE_SRV) {
+        return JS_ThrowRangeError(ctx, "unsupported record type: %d", type);
+    }
+
+    const char* name = JS_ToCString(ctx, argv[0]);
+    if (!name) {
+        return JS_EXCEPTION;
+    }
+
+    size_t length = dns_name_length(name);
+    if (length == 0 || length > DNS_MAX_NAME - 1) {
+        JS_FreeCString(ctx, name);
+        return JS_ThrowTypeError(ctx, "invalid domain name");
+    }
+
+    // hosts 文件
+    JSValue result = dns_resolver_lookup_hosts(resolver, name, type);
+    if (!JS_IsUndefined(result)) {
+        JS_FreeCString(ctx, name);
+        return TJS_NewResolvedPromise(ctx, 1, &result);
+    }
+
+    // 合并相同的查询
+    dns_query_t* query = dns_resolver_find_query(resolver, name, type);
+    if (query == NULL) {
+        query = calloc(1, sizeof(*query));
+        if (query == NULL) {
+            JS_FreeCString(ctx, name);
+            return JS_ThrowOutOfMemory(ctx);
+        }
+
+        query->resolver = resolver;
+        query->type = type;
+        memcpy(query->name, name, length);
+        query->name[length] = '\0';
+        query->id = dns_resolver_new_id(resolver);
+
+        if (dns_query_encode(query) != 0) {
+            free(query);
+            JS_FreeCString(ctx, name);
+            return JS_ThrowTypeError(ctx, "invalid domain name");
+        }
+
+        list_add_tail(&query->link, &resolver->queries);
+        dns_query_send(query);
+        dns_resolver_update_timer(resolver);
+    }
+
+    JS_FreeCString(ctx, name);
+
+    if (query->waiter_count >= query->waiter_capacity) {
+        uint32_t capacity = query->waiter_capacity ? query->waiter_capacity * 2 : 2;
+        TJSPromise* waiters = realloc(query->waiters, capacity * sizeof(*waiters));
+        if (waiters == NULL) {
+            return JS_ThrowOutOfMemory(ctx);
+        }
+
+        query->waiters = waiters;
+        query->waiter_capacity = capacity;
+    }
+
+    return TJS_InitPromise(ctx, &query->waiters[query->waiter_count++]);
+}
+
+/** 返回使用的服务器地址列表 */
+static JSValue dns_resolver_servers(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    dns_resolver_t* resolver = dns_resolver_get(ctx, this_val);
+    if (!resolver) {
+        return JS_EXCEPTION;
+    }
+
+    JSValue servers = JS_NewArray(ctx);
+    for (uint32_t i = 0; i < resolver->server_count; i++) {
+        JSValue address = TJS_NewSocketAddress(ctx, (struct sockaddr*)&resolver->servers[i]);
+        JS_DefinePropertyValueUint32(ctx, servers, i, address, JS_PROP_C_W_E);
+    }
+
+    return servers;
+}
+
+/** 取消所有正在进行的查询并关闭 */
+static JSValue dns_resolver_close_method(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    dns_resolver_t* resolver = dns_resolver_get(ctx, this_val);
+    if (!resolver) {
+        return JS_EXCEPTION;
+    }
+
+    struct list_head *el, *el1;
+    list_for_each_safe(el, el1, &resolver->queries)
+    {
+        dns_query_t* query = list_entry(el, dns_query_t, link);
+        dns_query_settle(query, true, tjs_new_uv_error(ctx, UV_ECANCELED));
+    }
+
+    dns_resolver_close(resolver);
+    return JS_UNDEFINED;
+}
+
+static const JSCFunctionListEntry dns_resolver_proto_funcs[] = {
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Resolver", JS_PROP_CONFIGURABLE),
+    TJS_CFUNC_DEF("close", 0, dns_resolver_close_method),
+    TJS_CFUNC_DEF("query", 2, dns_resolver_query),
+    TJS_CFUNC_DEF("servers", 0, dns_resolver_servers),
+};
+
+static const JSCFunctionListEntry dns_resolver_class_funcs[] = {
+    JS_PROP_INT32_DEF("A", DNS_TYPE_A, JS_PROP_ENUMERABLE),
+    JS_PROP_INT32_DEF("AAAA", DNS_TYPE_AAAA, JS_PROP_ENUMERABLE),
+    JS_PROP_INT32_DEF("SRV", DNS_TYPE_SRV, JS_PROP_ENUMERABLE),
+};
+
+void tjs_mod_dns_resolver_init(JSContext* ctx, JSValue dns)
+{
+    JSRuntime* runtime = JS_GetRuntime(ctx);
+
+    JS_NewClassID(&dns_resolver_class_id);
+    JS_NewClass(runtime, dns_resolver_class_id, &dns_resolver_class);
+    JSValue proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, dns_resolver_proto_funcs, countof(dns_resolver_proto_funcs));
+    JS_SetClassProto(ctx, dns_resolver_class_id, proto);
+
+    JSValue resolverClass = JS_NewCFunction2(ctx, dns_resolver_constructor, "Resolver", 1, JS_CFUNC_constructor, 0);
+    JS_SetPropertyFunctionList(ctx, resolverClass, dns_resolver_class_funcs, countof(dns_resolver_class_funcs));
+    JS_DefinePropertyValueStr(ctx, dns, "Resolver", resolverClass, JS_PROP_C_W_E);
+}
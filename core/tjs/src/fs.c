@@ -28,14 +28,33 @@
 #include "digest/md5.h"
 #include "digest/sha1.h"
 
+#include <math.h>
+
 #if defined(__linux__) || defined(__linux)
 #include <sys/file.h>
+#include <sys/inotify.h>
+#endif
+
+#if !defined(_WIN32)
+#include <dirent.h>
+#include <sys/mman.h>
+#include <unistd.h>
 #endif
 
 #ifndef F_OK
 #define F_OK 0
 #endif
 
+/** Dir.read() 默认一次读取的目录项数 */
+#define kDefaultDirentCount 64
+#define kMaxDirentCount 1024
+
+/** readv/writev 最多可以使用的缓存区数 */
+#define kMaxBufferCount 1024
+
+/** Walker.read() 默认一次返回的目录项数 */
+#define kDefaultWalkBatchSize 256
+
 static JSClassID tjs_file_class_id;
 
 typedef struct tjs_file_s {
@@ -70,6 +89,9 @@ typedef struct tjs_dir_s {
     JSValue path;
     uv_dir_t* dir;
     uv_dirent_t dirent;
+    uv_dirent_t* dirents; // read(count) 使用的缓存区
+    uint32_t capacity;
+    bool batch; // 当前的请求是否是 read(count)
     bool done;
 } TJSDir;
 
@@ -87,6 +109,7 @@ static void tjs_dir_finalizer(JSRuntime* rt, JSValue val)
     }
 
     JS_FreeValueRT(rt, dir->path);
+    js_free_rt(rt, dir->dirents);
     js_free_rt(rt, dir);
 }
 
@@ -119,6 +142,14 @@ typedef struct tjs_fs_write_req_s {
     char data[];
 } TJSFsWriteReq;
 
+/** 直接读写调用者提供的缓存区, 不分配也不复制数据 */
+typedef struct tjs_fs_buffer_req_s {
+    TJSFsReq base;
+    JSValue buffers; // 在请求完成之前保持对缓存区的引用
+    uv_buf_t* bufs;
+    uv_buf_t buf;
+} TJSFsBufferReq;
+
 typedef struct tjs_fs_readfile_req_s {
     uv_work_t req;
     JSContext* ctx;
@@ -129,6 +160,21 @@ typedef struct tjs_fs_readfile_req_s {
     char* filename;
 } TJSFsReadFileReq;
 
+typedef struct tjs_fs_writefile_req_s {
+    uv_work_t req;
+    JSContext* ctx;
+    TJSPromise result;
+    JSValue data; // 写入期间保持对数据的引用
+    const char* string; // 字符串数据, 需要 JS_FreeCString
+    const uint8_t* buffer;
+    size_t length;
+    char* filename;
+    int flags;
+    int mode;
+    int ret;
+    const char* syscall;
+} TJSFsWriteFileReq;
+
 static JSValue js__statfs2obj(JSContext* ctx, uv_statfs_t* st, BOOL isBigint)
 {
     JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
@@ -290,6 +336,9 @@ static JSValue tjs_new_dir(JSContext* ctx, uv_dir_t* uv_dir, const char* path)
     dir->path = JS_NewString(ctx, path);
     dir->ctx = ctx;
     dir->dir = uv_dir;
+    dir->dirents = NULL;
+    dir->capacity = 0;
+    dir->batch = false;
     dir->done = false;
 
     JS_SetOpaque(obj, dir);
@@ -453,6 +502,7 @@ static void uv__fs_req_cb(uv_fs_t* req)
     case UV_FS_RMDIR:
     case UV_FS_SYMLINK:
     case UV_FS_UNLINK:
+    case UV_FS_UTIME:
         arg = JS_UNDEFINED;
         break;
 
@@ -480,6 +530,20 @@ static void uv__fs_req_cb(uv_fs_t* req)
     case UV_FS_READDIR: {
         TJSDir* dir = tjs_dir_get(ctx, request->obj);
         dir->done = request->req.result == 0;
+        if (dir->batch) {
+            // read(count): 一次返回多个目录项
+            arg = JS_NewArray(ctx);
+            for (uint32_t i = 0; i < request->req.result; i++) {
+                uv_dirent_t* dirent = &dir->dirents[i];
+                JSValue item = JS_NewObjectProto(ctx, JS_NULL);
+                JS_DefinePropertyValueStr(ctx, item, "name", JS_NewString(ctx, dirent->name), JS_PROP_C_W_E);
+                JS_DefinePropertyValueStr(ctx, item, "type", JS_NewInt32(ctx, dirent->type), JS_PROP_C_W_E);
+                JS_DefinePropertyValueUint32(ctx, arg, i, item, JS_PROP_C_W_E);
+            }
+
+            break;
+        }
+
         arg = JS_NewObjectProto(ctx, JS_NULL);
         JS_DefinePropertyValueStr(ctx, arg, "done", JS_NewBool(ctx, dir->done), JS_PROP_C_W_E);
         if (request->req.result != 0) {
@@ -551,6 +615,45 @@ static JSValue tjs_file_read(JSContext* ctx, JSValueConst this_val, int argc, JS
     return request->result.p;
 }
 
+/** 同步读取, 用于需要立即返回结果的场合 (如 Storage.getItem) */
+static JSValue tjs_file_read_sync(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSFile* file = tjs_file_get(ctx, this_val);
+    if (!file) {
+        return JS_EXCEPTION;
+    }
+
+    /* arg 1: length to read */
+    uint64_t len = kDefaultReadSize;
+    if (!JS_IsUndefined(argv[0]) && JS_ToIndex(ctx, &len, argv[0])) {
+        return JS_EXCEPTION;
+    }
+
+    /* arg 2: position (on the file) */
+    int64_t pos = -1;
+    if (argc > 1) {
+        if (!JS_IsUndefined(argv[1]) && JS_ToInt64(ctx, &pos, argv[1])) {
+            return JS_EXCEPTION;
+        }
+    }
+
+    char* buf = js_malloc(ctx, len > 0 ? len : 1);
+    if (!buf) {
+        return JS_EXCEPTION;
+    }
+
+    uv_fs_t req;
+    uv_buf_t b = uv_buf_init(buf, len);
+    int ret = uv_fs_read(NULL, &req, file->fd, &b, 1, pos, NULL);
+    uv_fs_req_cleanup(&req);
+    if (ret < 0) {
+        js_free(ctx, buf);
+        return tjs_throw_uv_error(ctx, ret);
+    }
+
+    return TJS_NewArrayBuffer(ctx, (uint8_t*)buf, ret);
+}
+
 static JSValue tjs_file_write(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
     TJSFile* file = tjs_file_get(ctx, this_val);
@@ -603,6 +706,147 @@ static JSValue tjs_file_write(JSContext* ctx, JSValueConst this_val, int argc, J
     return request->result.p;
 }
 
+static void uv__fs_buffer_req_cb(uv_fs_t* req)
+{
+    TJSFsBufferReq* request = req->data;
+    if (!request) {
+        return;
+    }
+
+    JSContext* ctx = request->base.ctx;
+    JSValue arg;
+
+    bool is_reject = req->result < 0;
+    if (is_reject) {
+        arg = tjs_new_file_error(ctx, &request->base);
+
+    } else {
+        arg = JS_NewInt64(ctx, req->result);
+    }
+
+    TJS_SettlePromise(ctx, &request->base.result, is_reject, 1, (JSValueConst*)&arg);
+    JS_FreeValue(ctx, request->base.obj);
+    JS_FreeValue(ctx, request->buffers);
+
+    uv_fs_req_cleanup(req);
+    if (request->bufs != &request->buf) {
+        js_free(ctx, request->bufs);
+    }
+
+    js_free(ctx, request);
+}
+
+static int tjs_fs_to_buf(JSContext* ctx, JSValueConst value, uv_buf_t* buf)
+{
+    tjs_buffer_t buffer = TJS_GetArrayBuffer(ctx, value);
+    if (JS_IsException(buffer.error)) {
+        return -1;
+
+    } else if (!buffer.data && buffer.length > 0) {
+        JS_ThrowTypeError(ctx, "The '%s' argument must be an ArrayBuffer or a TypedArray", "buffer");
+        return -1;
+    }
+
+    *buf = uv_buf_init((char*)buffer.data, buffer.length);
+    return 0;
+}
+
+/**
+ * 使用调用者提供的缓存区读写文件
+ * - magic & 1: 写文件, 否则读文件
+ * - magic & 2: 参数为缓存区数组 (readv/writev)
+ * - 返回实际读写的字节数
+ */
+static JSValue tjs_file_rw_buffers(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic)
+{
+    TJSFile* file = tjs_file_get(ctx, this_val);
+    if (!file) {
+        return JS_EXCEPTION;
+    }
+
+    bool is_write = magic & 1;
+    bool is_vector = magic & 2;
+
+    /* arg 2: position (on the file) */
+    int64_t pos = -1;
+    if (argc > 1 && !JS_IsUndefined(argv[1]) && JS_ToInt64(ctx, &pos, argv[1])) {
+        return JS_EXCEPTION;
+    }
+
+    TJSFsBufferReq* buffer_request = js_mallocz(ctx, sizeof(*buffer_request));
+    if (!buffer_request) {
+        return JS_EXCEPTION;
+    }
+
+    uint32_t count = 1;
+    buffer_request->bufs = &buffer_request->buf;
+    buffer_request->buffers = JS_UNDEFINED;
+
+    if (!is_vector) {
+        if (tjs_fs_to_buf(ctx, argv[0], &buffer_request->buf) < 0) {
+            goto fail;
+        }
+
+        buffer_request->buffers = JS_DupValue(ctx, argv[0]);
+
+    } else {
+        if (!JS_IsArray(ctx, argv[0])) {
+            JS_ThrowTypeError(ctx, "The '%s' argument must be an array", "buffers");
+            goto fail;
+        }
+
+        count = TJS_GetPropertyUint32(ctx, argv[0], "length", 0);
+        if (count <= 0 || count > kMaxBufferCount) {
+            JS_ThrowRangeError(ctx, "The number of buffers must be between 1 and %d", kMaxBufferCount);
+            goto fail;
+        }
+
+        if (count > 1) {
+            buffer_request->bufs = js_malloc(ctx, count * sizeof(uv_buf_t));
+            if (!buffer_request->bufs) {
+                goto fail;
+            }
+        }
+
+        // 复制一份数组, 以免调用者修改原数组后缓存区被回收
+        buffer_request->buffers = JS_NewArray(ctx);
+        for (uint32_t i = 0; i < count; i++) {
+            JSValue value = JS_GetPropertyUint32(ctx, argv[0], i);
+            int ret = tjs_fs_to_buf(ctx, value, &buffer_request->bufs[i]);
+            JS_DefinePropertyValueUint32(ctx, buffer_request->buffers, i, value, JS_PROP_C_W_E);
+            if (ret < 0) {
+                goto fail;
+            }
+        }
+    }
+
+    TJSFsReq* request = &buffer_request->base;
+    uv_loop_t* loop = TJS_GetLoop(ctx);
+    int ret;
+    if (is_write) {
+        ret = uv_fs_write(loop, &request->req, file->fd, buffer_request->bufs, count, pos, uv__fs_buffer_req_cb);
+
+    } else {
+        ret = uv_fs_read(loop, &request->req, file->fd, buffer_request->bufs, count, pos, uv__fs_buffer_req_cb);
+    }
+
+    if (ret != 0) {
+        tjs_throw_uv_error(ctx, ret);
+        goto fail;
+    }
+
+    return tjs_fs_req_init(ctx, request, this_val);
+
+fail:
+    JS_FreeValue(ctx, buffer_request->buffers);
+    if (buffer_request->bufs != &buffer_request->buf) {
+        js_free(ctx, buffer_request->bufs);
+    }
+
+    js_free(ctx, buffer_request);
+    return JS_EXCEPTION;
+}
+
 static JSValue tjs_file_close(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
     TJSFile* file = tjs_file_get(ctx, this_val);
@@ -763,6 +1007,51 @@ static JSValue tjs_dir_next(JSContext* ctx, JSValueConst this_val, int argc, JSV
 
     d->dir->dirents = &d->dirent;
     d->dir->nentries = 1;
+    d->batch = false;
+
+    int ret = uv_fs_readdir(TJS_GetLoop(ctx), &request->req, d->dir, uv__fs_req_cb);
+    return tjs_fs_req_init2(ctx, request, this_val, ret);
+}
+
+/** 一次读取多个目录项, 读取完成后返回空数组 */
+static JSValue tjs_dir_read(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSDir* d = tjs_dir_get(ctx, this_val);
+    if (!d) {
+        return JS_EXCEPTION;
+    }
+
+    if (d->done || !d->dir) {
+        JSValue result = JS_NewArray(ctx);
+        return TJS_NewResolvedPromise(ctx, 1, &result);
+    }
+
+    uint32_t count = TJS_ToUint32(ctx, argv[0], kDefaultDirentCount);
+    if (count <= 0) {
+        count = 1;
+
+    } else if (count > kMaxDirentCount) {
+        count = kMaxDirentCount;
+    }
+
+    if (count > d->capacity) {
+        uv_dirent_t* dirents = js_realloc(ctx, d->dirents, count * sizeof(uv_dirent_t));
+        if (!dirents) {
+            return JS_EXCEPTION;
+        }
+
+        d->dirents = dirents;
+        d->capacity = count;
+    }
+
+    TJSFsReq* request = tjs_fs_new_request(ctx);
+    if (!request) {
+        return JS_EXCEPTION;
+    }
+
+    d->dir->dirents = d->dirents;
+    d->dir->nentries = count;
+    d->batch = true;
 
     int ret = uv_fs_readdir(TJS_GetLoop(ctx), &request->req, d->dir, uv__fs_req_cb);
     return tjs_fs_req_init2(ctx, request, this_val, ret);
@@ -1037,6 +1326,44 @@ static JSValue tjs_fs_unlink(JSContext* ctx, JSValueConst this_val, int argc, JS
     return tjs_fs_req_init2(ctx, request, JS_UNDEFINED, ret);
 }
 
+/**
+ * 修改文件的访问和修改时间
+ * @param path 文件名
+ * @param atime 访问时间, 单位为秒
+ * @param mtime 修改时间, 单位为秒
+ */
+static JSValue tjs_fs_utimes(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    if (!JS_IsString(argv[0])) {
+        return JS_ThrowTypeError(ctx, "The '%s' argument must be of type string", "path");
+
+    } else if (!JS_IsNumber(argv[1]) || !JS_IsNumber(argv[2])) {
+        return JS_ThrowTypeError(ctx, "The '%s' argument must be of type number", "atime and mtime");
+    }
+
+    double atime = 0;
+    double mtime = 0;
+    JS_ToFloat64(ctx, &atime, argv[1]);
+    JS_ToFloat64(ctx, &mtime, argv[2]);
+
+    const char* path = JS_ToCString(ctx, argv[0]);
+    if (!path) {
+        return JS_EXCEPTION;
+    }
+
+    TJSFsReq* request = tjs_fs_new_request(ctx);
+    if (!request) {
+        JS_FreeCString(ctx, path);
+        return JS_EXCEPTION;
+    }
+
+    request->path = js_strdup(ctx, path);
+    request->syscall = "utime";
+    int ret = uv_fs_utime(TJS_GetLoop(ctx), &request->req, path, atime, mtime, uv__fs_req_cb);
+    JS_FreeCString(ctx, path);
+    return tjs_fs_req_init2(ctx, request, JS_UNDEFINED, ret);
+}
+
 static JSValue tjs_fs_rename(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
     if (!JS_IsString(argv[0])) {
@@ -1341,100 +1668,2013 @@ static JSValue tjs_fs_opendir(JSContext* ctx, JSValueConst this_val, int argc, J
 }
 
 // ////////////////////////////////////////////////////////////
-// readfile
+// walk
 
-static void tjs__readfile_free(JSRuntime* rt, void* opaque, void* ptr)
-{
-    TJSFsReadFileReq* request = opaque;
-    CHECK_NOT_NULL(request);
+static JSClassID tjs_walker_class_id;
 
-    dbuf_free(&request->dbuf);
-    js_free_rt(rt, request->filename);
-    js_free_rt(rt, request);
-}
+typedef struct tjs_walk_dir_s {
+    char* path;
+    int depth;
+} TJSWalkDir;
 
-static void tjs__readfile_work(uv_work_t* req)
-{
-    TJSFsReadFileReq* request = req->data;
-    CHECK_NOT_NULL(request);
+typedef struct tjs_walk_entry_s {
+    char* path;
+    uint32_t name; // 文件名在 path 中的偏移位置
+    int type;
+    int depth;
+    bool has_stat;
+    uv_stat_t stat;
+} TJSWalkEntry;
+
+/**
+ * 目录树遍历器
+ * - 遍历在线程池中进行, 每次 read() 返回一批目录项
+ * - 在同一批中发现的子目录要在下一次 read() 时才会进入, 以便调用者可以跳过它们
+ * - 后台线程访问的内存都使用 malloc 分配
+ */
+typedef struct tjs_walker_s {
+    JSContext* ctx;
+    JSValue obj;
+    uv_work_t req;
+    TJSPromise result;
 
-    request->ret = tjs_load_file(request->ctx, &request->dbuf, request->filename);
-}
+    /* options */
+    bool stat;
+    int max_depth; // < 0 表示不限制
+    uint32_t batch_size;
 
-static void tjs__readfile_after_work(uv_work_t* req, int status)
-{
-    TJSFsReadFileReq* request = req->data;
-    CHECK_NOT_NULL(request);
+    /* 等待遍历的目录队列 */
+    TJSWalkDir* dirs;
+    uint32_t dirs_head;
+    uint32_t dirs_count;
+    uint32_t dirs_capacity;
 
-    JSContext* ctx = request->ctx;
-    JSValue arg;
-    bool is_reject = false;
+    /* 当前正在读取的目录 */
+    uv_dir_t* dir;
+    TJSWalkDir current;
+    uv_dirent_t* dirents;
 
-    if (status != 0) {
-        arg = tjs_new_uv_error(ctx, status);
-        is_reject = true;
+    /* 本批次的结果 */
+    TJSWalkEntry* entries;
+    uint32_t entry_count;
+    int error;
+    char* error_path;
 
-    } else if (request->ret < 0) {
-        arg = tjs_new_uv_error(ctx, request->ret);
-        is_reject = true;
+    bool busy;
+    bool closed;
+} TJSWalker;
 
-    } else {
-        arg = JS_NewArrayBuffer(ctx, request->dbuf.buf, request->dbuf.size, tjs__readfile_free, (void*)request, false);
+static void tjs__walker_close_dir(TJSWalker* walker)
+{
+    if (walker->dir) {
+        uv_fs_t req;
+        uv_fs_closedir(NULL, &req, walker->dir, NULL);
+        uv_fs_req_cleanup(&req);
+        walker->dir = NULL;
     }
 
-    TJS_SettlePromise(ctx, &request->result, is_reject, 1, (JSValueConst*)&arg);
+    free(walker->current.path);
+    walker->current.path = NULL;
+}
 
-    if (is_reject) {
-        tjs__readfile_free(JS_GetRuntime(ctx), (void*)request, NULL);
+static void tjs__walker_reset(TJSWalker* walker)
+{
+    tjs__walker_close_dir(walker);
+
+    for (uint32_t i = walker->dirs_head; i < walker->dirs_count; i++) {
+        free(walker->dirs[i].path);
     }
+
+    walker->dirs_head = 0;
+    walker->dirs_count = 0;
+    walker->closed = true;
 }
 
-static JSValue tjs_fs_readfile(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic)
+static void tjs__walker_free_entries(TJSWalker* walker)
 {
-    if (!JS_IsString(argv[0])) {
-        return JS_ThrowTypeError(ctx, "The '%s' argument must be of type string", "path");
+    for (uint32_t i = 0; i < walker->entry_count; i++) {
+        free(walker->entries[i].path);
     }
 
-    const char* filename = JS_ToCString(ctx, argv[0]);
-    if (!filename) {
-        return JS_EXCEPTION;
-    }
+    walker->entry_count = 0;
 
-    TJSFsReadFileReq* request = js_malloc(ctx, sizeof(*request));
-    if (!request) {
-        JS_FreeCString(ctx, filename);
-        return JS_EXCEPTION;
+    free(walker->error_path);
+    walker->error_path = NULL;
+    walker->error = 0;
+}
+
+static void tjs_walker_finalizer(JSRuntime* rt, JSValue val)
+{
+    TJSWalker* walker = JS_GetOpaque(val, tjs_walker_class_id);
+    if (walker == NULL) {
+        return;
     }
 
-    memset(request, 0, sizeof(*request));
+    tjs__walker_reset(walker);
+    tjs__walker_free_entries(walker);
+    TJS_FreePromiseRT(rt, &walker->result);
 
-    dbuf_init(&request->dbuf);
-    request->ctx = ctx;
-    request->ret = -1;
-    request->magic = magic;
-    request->filename = js_strdup(ctx, filename);
-    request->req.data = request;
-    JS_FreeCString(ctx, filename);
+    free(walker->dirs);
+    free(walker->dirents);
+    free(walker->entries);
+    js_free_rt(rt, walker);
+}
 
-    int ret = uv_queue_work(TJS_GetLoop(ctx), &request->req, tjs__readfile_work, tjs__readfile_after_work);
-    if (ret != 0) {
-        js_free(ctx, request->filename);
-        js_free(ctx, request);
-        return tjs_throw_uv_error(ctx, ret);
+static JSClassDef tjs_walker_class = { "Walker", .finalizer = tjs_walker_finalizer };
+
+static int tjs__walker_push_dir(TJSWalker* walker, char* path, int depth)
+{
+    if (walker->dirs_count >= walker->dirs_capacity) {
+        uint32_t capacity = walker->dirs_capacity ? walker->dirs_capacity * 2 : 64;
+        TJSWalkDir* dirs = realloc(walker->dirs, capacity * sizeof(TJSWalkDir));
+        if (!dirs) {
+            return UV_ENOMEM;
+        }
+
+        walker->dirs = dirs;
+        walker->dirs_capacity = capacity;
     }
 
-    return TJS_InitPromise(ctx, &request->result);
+    TJSWalkDir* dir = &walker->dirs[walker->dirs_count++];
+    dir->path = path;
+    dir->depth = depth;
+    return 0;
 }
 
-static const JSCFunctionListEntry tjs_file_proto_funcs[] = {
-    TJS_CFUNC_DEF("close", 0, tjs_file_close),
-    TJS_CFUNC_DEF("fileno", 0, tjs_file_fileno),
+static int tjs__walker_add_entry(TJSWalker* walker, uv_dirent_t* dirent)
+{
+    size_t parent_length = strlen(walker->current.path);
+    size_t name_length = strlen(dirent->name);
+    char* path = malloc(parent_length + name_length + 2);
+    if (!path) {
+        return UV_ENOMEM;
+    }
+
+    memcpy(path, walker->current.path, parent_length);
+    if (parent_length == 0 || path[parent_length - 1] != TJS__PATHSEP) {
+        path[parent_length++] = TJS__PATHSEP;
+    }
+
+    memcpy(path + parent_length, dirent->name, name_length + 1);
+
+    TJSWalkEntry* entry = &walker->entries[walker->entry_count++];
+    entry->path = path;
+    entry->name = parent_length;
+    entry->type = dirent->type;
+    entry->depth = walker->current.depth + 1;
+    entry->has_stat = false;
+
+    // 有些文件系统不返回文件类型
+    if (walker->stat || entry->type == UV_DIRENT_UNKNOWN) {
+        uv_fs_t req;
+        if (uv_fs_lstat(NULL, &req, path, NULL) == 0) {
+            entry->stat = req.statbuf;
+            entry->has_stat = walker->stat;
+
+            uint64_t mode = req.statbuf.st_mode & S_IFMT;
+            if (mode == S_IFREG) {
+                entry->type = UV_DIRENT_FILE;
+
+            } else if (mode == S_IFDIR) {
+                entry->type = UV_DIRENT_DIR;
+
+            } else if (mode == S_IFLNK) {
+                entry->type = UV_DIRENT_LINK;
+            }
+        }
+
+        uv_fs_req_cleanup(&req);
+    }
+
+    if (entry->type == UV_DIRENT_DIR && (walker->max_depth < 0 || entry->depth < walker->max_depth)) {
+        char* dirname = strdup(path);
+        if (!dirname) {
+            return UV_ENOMEM;
+        }
+
+        int ret = tjs__walker_push_dir(walker, dirname, entry->depth);
+        if (ret < 0) {
+            free(dirname);
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
+static void tjs__walk_work(uv_work_t* req)
+{
+    TJSWalker* walker = req->data;
+    CHECK_NOT_NULL(walker);
+
+    // 本批次中发现的子目录留到下一批次
+    uint32_t limit = walker->dirs_count;
+    uv_fs_t fs_req;
+
+    while (walker->entry_count < walker->batch_size) {
+        if (!walker->dir) {
+            if (walker->dirs_head >= limit) {
+                break;
+            }
+
+            TJSWalkDir next = walker->dirs[walker->dirs_head++];
+            if (!next.path) {
+                continue; // 已被跳过
+            }
+
+            int ret = uv_fs_opendir(NULL, &fs_req, next.path, NULL);
+            if (ret < 0) {
+                uv_fs_req_cleanup(&fs_req);
+                walker->error = ret;
+                walker->error_path = next.path;
+                break;
+            }
+
+            walker->dir = fs_req.ptr;
+            walker->current = next;
+            uv_fs_req_cleanup(&fs_req);
+        }
+
+        walker->dir->dirents = walker->dirents;
+        walker->dir->nentries = walker->batch_size - walker->entry_count;
+
+        int count = uv_fs_readdir(NULL, &fs_req, walker->dir, NULL);
+        if (count < 0) {
+            uv_fs_req_cleanup(&fs_req);
+            walker->error = count;
+            walker->error_path = strdup(walker->current.path);
+            tjs__walker_close_dir(walker);
+            break;
+
+        } else if (count == 0) {
+            uv_fs_req_cleanup(&fs_req);
+            tjs__walker_close_dir(walker);
+            continue;
+        }
+
+        int ret = 0;
+        for (int i = 0; i < count && ret == 0; i++) {
+            ret = tjs__walker_add_entry(walker, &walker->dirents[i]);
+        }
+
+        uv_fs_req_cleanup(&fs_req);
+        if (ret < 0) {
+            walker->error = ret;
+            break;
+        }
+    }
+}
+
+static void tjs__walk_after_work(uv_work_t* req, int status)
+{
+    TJSWalker* walker = req->data;
+    CHECK_NOT_NULL(walker);
+
+    JSContext* ctx = walker->ctx;
+    JSValue arg;
+    bool is_reject = false;
+
+    walker->busy = false;
+    if (walker->closed) {
+        tjs__walker_reset(walker);
+    }
+
+    if (status != 0 || walker->error != 0) {
+        int error = status != 0 ? status : walker->error;
+        arg = tjs_new_uv_error(ctx, error);
+        if (walker->error_path) {
+            char message[PATH_MAX + 64];
+            snprintf(message, sizeof(message), "%s, opendir '%s'", uv_strerror(error), walker->error_path);
+            JS_DefinePropertyValueStr(ctx, arg, "message", JS_NewString(ctx, message), JS_PROP_C_W_E);
+            JS_DefinePropertyValueStr(ctx, arg, "path", JS_NewString(ctx, walker->error_path), JS_PROP_C_W_E);
+            JS_DefinePropertyValueStr(ctx, arg, "syscall", JS_NewString(ctx, "opendir"), JS_PROP_C_W_E);
+        }
+
+        is_reject = true;
+
+    } else {
+        arg = JS_NewArray(ctx);
+        for (uint32_t i = 0; i < walker->entry_count; i++) {
+            TJSWalkEntry* entry = &walker->entries[i];
+            JSValue item = JS_NewObjectProto(ctx, JS_NULL);
+            JS_DefinePropertyValueStr(ctx, item, "name", JS_NewString(ctx, entry->path + entry->name), JS_PROP_C_W_E);
+            JS_DefinePropertyValueStr(ctx, item, "path", JS_NewString(ctx, entry->path), JS_PROP_C_W_E);
+            JS_DefinePropertyValueStr(ctx, item, "type", JS_NewInt32(ctx, entry->type), JS_PROP_C_W_E);
+            JS_DefinePropertyValueStr(ctx, item, "depth", JS_NewInt32(ctx, entry->depth), JS_PROP_C_W_E);
+            if (entry->has_stat) {
+                JS_DefinePropertyValueStr(ctx, item, "stat", js__stat2obj(ctx, &entry->stat, false), JS_PROP_C_W_E);
+            }
+
+            JS_DefinePropertyValueUint32(ctx, arg, i, item, JS_PROP_C_W_E);
+        }
+    }
+
+    tjs__walker_free_entries(walker);
+
+    JSValue obj = walker->obj;
+    walker->obj = JS_UNDEFINED;
+    TJS_SettlePromise(ctx, &walker->result, is_reject, 1, (JSValueConst*)&arg);
+    TJS_ClearPromise(ctx, &walker->result);
+    JS_FreeValue(ctx, obj);
+}
+
+static TJSWalker* tjs_walker_get(JSContext* ctx, JSValueConst obj)
+{
+    return JS_GetOpaque2(ctx, obj, tjs_walker_class_id);
+}
+
+/**
+ * 读取下一批目录项, 遍历完成后返回空数组
+ * @param skip 不需要进入的子目录 (上一批返回的目录项的 path)
+ */
+static JSValue tjs_walker_read(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSWalker* walker = tjs_walker_get(ctx, this_val);
+    if (!walker) {
+        return JS_EXCEPTION;
+    }
+
+    if (walker->busy) {
+        return JS_ThrowTypeError(ctx, "Walker is busy");
+    }
+
+    // 跳过指定的子目录
+    if (argc > 0 && JS_IsArray(ctx, argv[0])) {
+        uint32_t length = TJS_GetPropertyUint32(ctx, argv[0], "length", 0);
+        for (uint32_t i = 0; i < length; i++) {
+            JSValue value = JS_GetPropertyUint32(ctx, argv[0], i);
+            const char* path = JS_ToCString(ctx, value);
+            JS_FreeValue(ctx, value);
+            if (!path) {
+                return JS_EXCEPTION;
+            }
+
+            for (uint32_t j = walker->dirs_count; j > walker->dirs_head; j--) {
+                TJSWalkDir* dir = &walker->dirs[j - 1];
+                if (dir->path && strcmp(dir->path, path) == 0) {
+                    free(dir->path);
+                    dir->path = NULL;
+                    break;
+                }
+            }
+
+            JS_FreeCString(ctx, path);
+        }
+    }
+
+    if (walker->closed || (!walker->dir && walker->dirs_head >= walker->dirs_count)) {
+        JSValue result = JS_NewArray(ctx);
+        return TJS_NewResolvedPromise(ctx, 1, &result);
+    }
+
+    // 回收队列头部已处理的空间
+    if (walker->dirs_head > 0 && walker->dirs_head * 2 >= walker->dirs_count) {
+        walker->dirs_count -= walker->dirs_head;
+        memmove(walker->dirs, walker->dirs + walker->dirs_head, walker->dirs_count * sizeof(TJSWalkDir));
+        walker->dirs_head = 0;
+    }
+
+    int ret = uv_queue_work(TJS_GetLoop(ctx), &walker->req, tjs__walk_work, tjs__walk_after_work);
+    if (ret != 0) {
+        return tjs_throw_uv_error(ctx, ret);
+    }
+
+    walker->busy = true;
+    walker->obj = JS_DupValue(ctx, this_val);
+    return TJS_InitPromise(ctx, &walker->result);
+}
+
+static JSValue tjs_walker_close(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSWalker* walker = tjs_walker_get(ctx, this_val);
+    if (!walker) {
+        return JS_EXCEPTION;
+    }
+
+    // 后台线程正在使用时, 在完成后再释放
+    walker->closed = true;
+    if (!walker->busy) {
+        tjs__walker_reset(walker);
+    }
+
+    return JS_UNDEFINED;
+}
+
+/**
+ * 创建一个目录树遍历器
+ * @param root 根目录
+ * @param options `{ stat, maxDepth, batchSize }`
+ */
+static JSValue tjs_fs_walk(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    if (!JS_IsString(argv[0])) {
+        return JS_ThrowTypeError(ctx, "The '%s' argument must be of type string", "root");
+    }
+
+    JSValueConst options = argc > 1 ? argv[1] : JS_UNDEFINED;
+    int max_depth = -1;
+    bool stat = false;
+    uint32_t batch_size = kDefaultWalkBatchSize;
+
+    if (JS_IsObject(options)) {
+        JSValue value = JS_GetPropertyStr(ctx, options, "maxDepth");
+        double depth;
+        if (JS_IsNumber(value) && JS_ToFloat64(ctx, &depth, value) == 0 && isfinite(depth) && depth >= 0) {
+            max_depth = depth;
+        }
+
+        JS_FreeValue(ctx, value);
+
+        value = JS_GetPropertyStr(ctx, options, "stat");
+        stat = JS_ToBool(ctx, value);
+        JS_FreeValue(ctx, value);
+
+        batch_size = TJS_GetPropertyUint32(ctx, options, "batchSize", kDefaultWalkBatchSize);
+        if (batch_size <= 0) {
+            batch_size = kDefaultWalkBatchSize;
+
+        } else if (batch_size > kMaxDirentCount * 4) {
+            batch_size = kMaxDirentCount * 4;
+        }
+    }
+
+    const char* root = JS_ToCString(ctx, argv[0]);
+    if (!root) {
+        return JS_EXCEPTION;
+    }
+
+    JSValue obj = JS_NewObjectClass(ctx, tjs_walker_class_id);
+    if (JS_IsException(obj)) {
+        JS_FreeCString(ctx, root);
+        return obj;
+    }
+
+    TJSWalker* walker = js_mallocz(ctx, sizeof(*walker));
+    if (!walker) {
+        JS_FreeCString(ctx, root);
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+
+    walker->ctx = ctx;
+    walker->obj = JS_UNDEFINED;
+    TJS_ClearPromise(ctx, &walker->result);
+    walker->req.data = walker;
+    walker->stat = stat;
+    walker->max_depth = max_depth;
+    walker->batch_size = batch_size;
+    walker->dirents = malloc(batch_size * sizeof(uv_dirent_t));
+    walker->entries = malloc(batch_size * sizeof(TJSWalkEntry));
+    JS_SetOpaque(obj, walker);
+
+    char* path = strdup(root);
+    JS_FreeCString(ctx, root);
+
+    if (!walker->dirents || !walker->entries || !path || tjs__walker_push_dir(walker, path, 0) < 0) {
+        free(path);
+        JS_FreeValue(ctx, obj);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    if (max_depth == 0) {
+        walker->closed = true;
+    }
+
+    return obj;
+}
+
+static const JSCFunctionListEntry tjs_walker_proto_funcs[] = {
+    TJS_CFUNC_DEF("close", 0, tjs_walker_close),
+    TJS_CFUNC_DEF("read", 1, tjs_walker_read),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Walker", JS_PROP_CONFIGURABLE),
+};
+
+// ////////////////////////////////////////////////////////////
+// mmap
+
+#if !defined(_WIN32)
+
+/**
+ * 内存映射
+ * - 同一个进程内 (包括各个 Worker) 对同一文件同一区域的可写映射共用同一块内存
+ * - 只读映射不共用, 每个 ArrayBuffer 写入时只修改自己的副本 (写时复制)
+ * - 由 ArrayBuffer 的释放回调减少引用计数, 计数为 0 时解除映射
+ * - 所有映射都在 tjs_mappings 中, madvise 只接受其中的内存
+ */
+typedef struct tjs_mapping_s {
+    struct tjs_mapping_s* next;
+    uint64_t dev;
+    uint64_t ino;
+    int64_t offset;
+    size_t length;
+    bool writable;
+    uint8_t* base; // 按页对齐的映射地址
+    size_t map_length;
+    uint32_t refs;
+} TJSMapping;
+
+static struct {
+    uv_once_t once;
+    uv_mutex_t mutex;
+    TJSMapping* head;
+} tjs_mappings = { UV_ONCE_INIT };
+
+static void tjs__mappings_init(void)
+{
+    uv_mutex_init(&tjs_mappings.mutex);
+}
+
+static void tjs__mapping_free(JSRuntime* rt, void* opaque, void* ptr)
+{
+    TJSMapping* mapping = opaque;
+    CHECK_NOT_NULL(mapping);
+
+    uv_mutex_lock(&tjs_mappings.mutex);
+    if (--mapping->refs > 0) {
+        uv_mutex_unlock(&tjs_mappings.mutex);
+        return;
+    }
+
+    TJSMapping** link = &tjs_mappings.head;
+    while (*link && *link != mapping) {
+        link = &(*link)->next;
+    }
+
+    if (*link) {
+        *link = mapping->next;
+    }
+
+    uv_mutex_unlock(&tjs_mappings.mutex);
+
+    munmap(mapping->base, mapping->map_length);
+    free(mapping);
+}
+
+static JSValue tjs__mapping_new_buffer(JSContext* ctx, TJSMapping* mapping)
+{
+    uint8_t* data = mapping->base + (mapping->map_length - mapping->length);
+    JSValue buffer = JS_NewArrayBuffer(ctx, data, mapping->length, tjs__mapping_free, mapping, FALSE);
+    if (JS_IsException(buffer)) {
+        tjs__mapping_free(JS_GetRuntime(ctx), mapping, data);
+    }
+
+    return buffer;
+}
+
+static int tjs__mapping_advise(uint8_t* data, size_t length, int advice)
+{
+    // madvise 要求起始地址按页对齐, 映射的起始地址本身是按页对齐的
+    size_t page_size = sysconf(_SC_PAGESIZE);
+    uintptr_t start = (uintptr_t)data & ~(page_size - 1);
+    size_t size = length + ((uintptr_t)data - start);
+    if (size == 0) {
+        return 0;
+    }
+
+    return madvise((void*)start, size, advice) == 0 ? 0 : uv_translate_sys_error(errno);
+}
+
+/**
+ * 将文件映射到内存, 返回一个 ArrayBuffer
+ * @param path 文件名
+ * @param options `{ offset, length, readonly, advice }`
+ */
+static JSValue tjs_fs_mmap(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    if (!JS_IsString(argv[0])) {
+        return JS_ThrowTypeError(ctx, "The '%s' argument must be of type string", "path");
+    }
+
+    JSValueConst options = argc > 1 ? argv[1] : JS_UNDEFINED;
+    int64_t offset = 0;
+    int64_t length = -1;
+    bool readonly = true;
+    int advice = -1;
+
+    if (JS_IsObject(options)) {
+        JSValue value = JS_GetPropertyStr(ctx, options, "offset");
+        offset = TJS_ToInt64(ctx, value, 0);
+        JS_FreeValue(ctx, value);
+
+        value = JS_GetPropertyStr(ctx, options, "length");
+        length = TJS_ToInt64(ctx, value, -1);
+        JS_FreeValue(ctx, value);
+
+        value = JS_GetPropertyStr(ctx, options, "readonly");
+        if (!JS_IsUndefined(value)) {
+            readonly = JS_ToBool(ctx, value);
+        }
+
+        JS_FreeValue(ctx, value);
+
+        advice = TJS_GetPropertyInt32(ctx, options, "advice", -1);
+    }
+
+    if (offset < 0) {
+        return JS_ThrowRangeError(ctx, "The '%s' argument is out of range", "offset");
+    }
+
+    const char* path = JS_ToCString(ctx, argv[0]);
+    if (!path) {
+        return JS_EXCEPTION;
+    }
+
+    uv_fs_t req;
+    uv_file fd = uv_fs_open(NULL, &req, path, readonly ? O_RDONLY : O_RDWR, 0, NULL);
+    uv_fs_req_cleanup(&req);
+    JS_FreeCString(ctx, path);
+    if (fd < 0) {
+        return tjs_throw_uv_error(ctx, fd);
+    }
+
+    int ret = uv_fs_fstat(NULL, &req, fd, NULL);
+    uv_stat_t st = req.statbuf;
+    uv_fs_req_cleanup(&req);
+    if (ret < 0) {
+        goto error;
+    }
+
+    if (offset > st.st_size) {
+        uv_fs_close(NULL, &req, fd, NULL);
+        uv_fs_req_cleanup(&req);
+        return JS_ThrowRangeError(ctx, "The '%s' argument is out of range", "offset");
+    }
+
+    if (length < 0 || offset + length > st.st_size) {
+        length = st.st_size - offset;
+    }
+
+    if (length == 0) {
+        uv_fs_close(NULL, &req, fd, NULL);
+        uv_fs_req_cleanup(&req);
+        return JS_NewArrayBufferCopy(ctx, NULL, 0);
+    }
+
+    uv_once(&tjs_mappings.once, tjs__mappings_init);
+    uv_mutex_lock(&tjs_mappings.mutex);
+
+    // 查找已有的可写映射, 只读映射不共用, 以免一个持有者写入的内容被其他持有者看到
+    TJSMapping* mapping = readonly ? NULL : tjs_mappings.head;
+    while (mapping) {
+        if (mapping->dev == st.st_dev && mapping->ino == st.st_ino && mapping->offset == offset
+            && mapping->length == (size_t)length && mapping->writable) {
+            mapping->refs++;
+            break;
+        }
+
+        mapping = mapping->next;
+    }
+
+    if (!mapping) {
+        // 映射的偏移位置必须按页对齐
+        size_t page_size = sysconf(_SC_PAGESIZE);
+        int64_t aligned = offset & ~((int64_t)page_size - 1);
+        size_t map_length = length + (offset - aligned);
+
+        // 只读映射使用写时复制, 以免 JS 写入 ArrayBuffer 时进程崩溃 (QuickJS 没有只读的 ArrayBuffer),
+        // 修改只对这个 ArrayBuffer 可见, 不会写回文件
+        int flags = readonly ? MAP_PRIVATE : MAP_SHARED;
+        void* base = mmap(NULL, map_length, PROT_READ | PROT_WRITE, flags, fd, aligned);
+        if (base == MAP_FAILED) {
+            ret = uv_translate_sys_error(errno);
+            uv_mutex_unlock(&tjs_mappings.mutex);
+            goto error;
+        }
+
+        mapping = calloc(1, sizeof(*mapping));
+        if (!mapping) {
+            munmap(base, map_length);
+            uv_mutex_unlock(&tjs_mappings.mutex);
+            ret = UV_ENOMEM;
+            goto error;
+        }
+
+        mapping->dev = st.st_dev;
+        mapping->ino = st.st_ino;
+        mapping->offset = offset;
+        mapping->length = length;
+        mapping->writable = !readonly;
+        mapping->base = base;
+        mapping->map_length = map_length;
+        mapping->refs = 1;
+        mapping->next = tjs_mappings.head;
+        tjs_mappings.head = mapping;
+    }
+
+    uv_mutex_unlock(&tjs_mappings.mutex);
+
+    if (advice >= 0) {
+        tjs__mapping_advise(mapping->base, mapping->map_length, advice);
+    }
+
+    // 映射建立之后就不再需要文件描述符了
+    uv_fs_close(NULL, &req, fd, NULL);
+    uv_fs_req_cleanup(&req);
+
+    return tjs__mapping_new_buffer(ctx, mapping);
+
+error:
+    uv_fs_close(NULL, &req, fd, NULL);
+    uv_fs_req_cleanup(&req);
+    return tjs_throw_uv_error(ctx, ret);
+}
+
+/**
+ * 给内核提供访问方式的建议
+ * @param buffer mmap() 返回的 ArrayBuffer 或它的视图
+ * @param advice `MADV_*`
+ */
+static JSValue tjs_fs_madvise(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    tjs_buffer_t buffer = TJS_GetArrayBuffer(ctx, argv[0]);
+    if (JS_IsException(buffer.error)) {
+        return buffer.error;
+    }
+
+    int advice = TJS_ToInt32(ctx, argv[1], MADV_NORMAL);
+    if (buffer.length == 0) {
+        return JS_UNDEFINED;
+    }
+
+    // 只接受 mmap() 返回的内存, 否则 MADV_DONTNEED 等会清除堆中其他对象的数据
+    uv_once(&tjs_mappings.once, tjs__mappings_init);
+    uv_mutex_lock(&tjs_mappings.mutex);
+
+    int ret = UV_EINVAL;
+    for (TJSMapping* mapping = tjs_mappings.head; mapping; mapping = mapping->next) {
+        uint8_t* start = mapping->base + (mapping->map_length - mapping->length);
+        uint8_t* end = mapping->base + mapping->map_length;
+        if (buffer.data >= start && buffer.data < end) {
+            size_t length = buffer.length;
+            if (length > (size_t)(end - buffer.data)) {
+                length = end - buffer.data;
+            }
+
+            ret = tjs__mapping_advise(buffer.data, length, advice);
+            break;
+        }
+    }
+
+    uv_mutex_unlock(&tjs_mappings.mutex);
+    if (ret < 0) {
+        return tjs_throw_uv_error(ctx, ret);
+    }
+
+    return JS_UNDEFINED;
+}
+
+#else
+
+static JSValue tjs_fs_mmap(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    return tjs_throw_uv_error(ctx, UV_ENOSYS);
+}
+
+static JSValue tjs_fs_madvise(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    return tjs_throw_uv_error(ctx, UV_ENOSYS);
+}
+
+#endif
+
+// ////////////////////////////////////////////////////////////
+// watch
+
+enum {
+    TJS_WATCH_NONE = 0,
+    TJS_WATCH_CREATE,
+    TJS_WATCH_MODIFY,
+    TJS_WATCH_ATTRIB,
+    TJS_WATCH_DELETE,
+    TJS_WATCH_RENAME,
+    TJS_WATCH_OVERFLOW
+};
+
+/** 合并事件时向前查找的事件数 */
+#define kWatchCoalesceWindow 32
+
+/** 最多缓存的事件数, 超过后只报告一个 overflow 事件 */
+#define kWatchMaxEvents 8192
+
+static const char* tjs_watch_event_types[] = { "none", "create", "modify", "attrib", "delete", "rename", "overflow" };
+
+static JSClassID tjs_watcher_class_id;
+
+typedef struct tjs_watch_event_s {
+    int type;
+    bool directory;
+    uint32_t cookie; // 等待配对的 IN_MOVED_FROM
+    char* path;
+    char* old_path;
+} TJSWatchEvent;
+
+typedef struct tjs_watch_dir_s {
+    int wd;
+    char* path;
+} TJSWatchDir;
+
+/**
+ * 文件系统监视器
+ * - Linux 下直接使用 inotify, 支持递归监视目录, 以及根据 cookie 配对重命名事件
+ * - 其他平台使用 uv_fs_event_t
+ * - 事件先缓存起来, 在 delay 毫秒后合并成一批回调
+ */
+typedef struct tjs_watcher_s {
+    JSContext* ctx;
+    JSValue func;
+    char* root;
+    bool recursive;
+    uint32_t delay;
+    uv_timer_t timer;
+
+#if defined(__linux__)
+    int fd;
+    uv_poll_t poll;
+    TJSWatchDir* dirs; // 按 wd 排序
+    uint32_t dir_count;
+    uint32_t dir_capacity;
+#else
+    uv_fs_event_t event;
+#endif
+
+    TJSWatchEvent* events;
+    uint32_t event_count;
+    uint32_t event_capacity;
+    bool overflow;
+
+    int handles; // 还没有关闭的句柄数
+    bool closed;
+    bool finalized;
+} TJSWatcher;
+
+static char* tjs__watch_join(const char* dirname, const char* name)
+{
+    size_t length = strlen(dirname);
+    size_t name_length = strlen(name);
+    char* path = malloc(length + name_length + 2);
+    if (!path) {
+        return NULL;
+    }
+
+    memcpy(path, dirname, length);
+    if (length > 0 && path[length - 1] != TJS__PATHSEP) {
+        path[length++] = TJS__PATHSEP;
+    }
+
+    memcpy(path + length, name, name_length + 1);
+    return path;
+}
+
+static void tjs__watch_free_events(TJSWatcher* watcher)
+{
+    for (uint32_t i = 0; i < watcher->event_count; i++) {
+        free(watcher->events[i].path);
+        free(watcher->events[i].old_path);
+    }
+
+    watcher->event_count = 0;
+    watcher->overflow = false;
+}
+
+static void tjs__watcher_free(TJSWatcher* watcher)
+{
+    tjs__watch_free_events(watcher);
+    free(watcher->events);
+
+#if defined(__linux__)
+    for (uint32_t i = 0; i < watcher->dir_count; i++) {
+        free(watcher->dirs[i].path);
+    }
+
+    free(watcher->dirs);
+#endif
+
+    free(watcher->root);
+    free(watcher);
+}
+
+static void tjs__watcher_on_close(uv_handle_t* handle)
+{
+    TJSWatcher* watcher = handle->data;
+    CHECK_NOT_NULL(watcher);
+
+    if (--watcher->handles == 0 && watcher->finalized) {
+        tjs__watcher_free(watcher);
+    }
+}
+
+static void tjs__watcher_close(TJSWatcher* watcher)
+{
+    if (watcher->closed) {
+        return;
+    }
+
+    watcher->closed = true;
+    uv_close((uv_handle_t*)&watcher->timer, tjs__watcher_on_close);
+
+#if defined(__linux__)
+    uv_close((uv_handle_t*)&watcher->poll, tjs__watcher_on_close);
+    close(watcher->fd);
+    watcher->fd = -1;
+#else
+    uv_close((uv_handle_t*)&watcher->event, tjs__watcher_on_close);
+#endif
+}
+
+static void tjs_watcher_finalizer(JSRuntime* rt, JSValue val)
+{
+    TJSWatcher* watcher = JS_GetOpaque(val, tjs_watcher_class_id);
+    if (watcher == NULL) {
+        return;
+    }
+
+    JS_FreeValueRT(rt, watcher->func);
+    watcher->func = JS_UNDEFINED;
+    watcher->finalized = true;
+
+    tjs__watcher_close(watcher);
+    if (watcher->handles == 0) {
+        tjs__watcher_free(watcher);
+    }
+}
+
+static void tjs_watcher_mark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func)
+{
+    TJSWatcher* watcher = JS_GetOpaque(val, tjs_watcher_class_id);
+    if (watcher) {
+        JS_MarkValue(rt, watcher->func, mark_func);
+    }
+}
+
+static JSClassDef tjs_watcher_class = {
+    "Watcher",
+    .finalizer = tjs_watcher_finalizer,
+    .gc_mark = tjs_watcher_mark,
+};
+
+#if defined(__linux__)
+static void tjs__watcher_remove_tree(TJSWatcher* watcher, const char* path);
+#endif
+
+/** 把缓存的事件作为一批回调给 JS */
+static void tjs__watcher_on_timer(uv_timer_t* handle)
+{
+    TJSWatcher* watcher = handle->data;
+    CHECK_NOT_NULL(watcher);
+
+    JSContext* ctx = watcher->ctx;
+    JSValue events = JS_NewArray(ctx);
+    uint32_t index = 0;
+
+    if (watcher->overflow) {
+        JSValue item = JS_NewObjectProto(ctx, JS_NULL);
+        JS_DefinePropertyValueStr(ctx, item, "type", JS_NewString(ctx, "overflow"), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, item, "path", JS_NewString(ctx, watcher->root), JS_PROP_C_W_E);
+        JS_DefinePropertyValueUint32(ctx, events, index++, item, JS_PROP_C_W_E);
+    }
+
+    for (uint32_t i = 0; i < watcher->event_count; i++) {
+        TJSWatchEvent* event = &watcher->events[i];
+        int type = event->type;
+        const char* path = event->path;
+
+        if (type == TJS_WATCH_NONE) {
+            continue;
+
+        } else if (type == TJS_WATCH_RENAME && !path) {
+            // 移出了监视范围
+            type = TJS_WATCH_DELETE;
+            path = event->old_path;
+
+#if defined(__linux__)
+            if (event->directory && !watcher->closed) {
+                tjs__watcher_remove_tree(watcher, path);
+            }
+#endif
+        }
+
+        JSValue item = JS_NewObjectProto(ctx, JS_NULL);
+        JS_DefinePropertyValueStr(ctx, item, "type", JS_NewString(ctx, tjs_watch_event_types[type]), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, item, "path", JS_NewString(ctx, path), JS_PROP_C_W_E);
+        if (type == TJS_WATCH_RENAME && event->old_path) {
+            JS_DefinePropertyValueStr(ctx, item, "oldPath", JS_NewString(ctx, event->old_path), JS_PROP_C_W_E);
+        }
+
+        JS_DefinePropertyValueStr(ctx, item, "directory", JS_NewBool(ctx, event->directory), JS_PROP_C_W_E);
+        JS_DefinePropertyValueUint32(ctx, events, index++, item, JS_PROP_C_W_E);
+    }
+
+    tjs__watch_free_events(watcher);
+
+    if (index == 0) {
+        JS_FreeValue(ctx, events);
+        return;
+    }
+
+    JSValue func = JS_DupValue(ctx, watcher->func);
+    JSValue ret = JS_Call(ctx, func, JS_UNDEFINED, 1, (JSValueConst*)&events);
+    if (JS_IsException(ret)) {
+        TJS_DumpError(ctx);
+    }
+
+    JS_FreeValue(ctx, ret);
+    JS_FreeValue(ctx, func);
+    JS_FreeValue(ctx, events);
+}
+
+/**
+ * 添加一个事件, 并与最近的同一路径的事件合并
+ * - 连续的修改只保留一个, 创建后的修改仍然是创建
+ * - 创建后又删除的文件不报告
+ */
+static void tjs__watcher_add_event(TJSWatcher* watcher, int type, char* path, char* old_path, uint32_t cookie, bool directory)
+{
+    if (!uv_is_active((uv_handle_t*)&watcher->timer)) {
+        uv_timer_start(&watcher->timer, tjs__watcher_on_timer, watcher->delay, 0);
+    }
+
+    uint32_t start = watcher->event_count > kWatchCoalesceWindow ? watcher->event_count - kWatchCoalesceWindow : 0;
+    for (uint32_t i = watcher->event_count; path && i > start; i--) {
+        TJSWatchEvent* event = &watcher->events[i - 1];
+        if (!event->path || strcmp(event->path, path) != 0) {
+            continue;
+        }
+
+        if (type == TJS_WATCH_MODIFY || type == TJS_WATCH_ATTRIB) {
+            if (event->type == TJS_WATCH_ATTRIB) {
+                event->type = type;
+                goto merged;
+
+            } else if (event->type == TJS_WATCH_CREATE || event->type == TJS_WATCH_MODIFY) {
+                goto merged;
+            }
+
+        } else if (type == TJS_WATCH_DELETE) {
+            if (event->type == TJS_WATCH_CREATE) {
+                event->type = TJS_WATCH_NONE;
+                goto merged;
+
+            } else if (event->type == TJS_WATCH_MODIFY || event->type == TJS_WATCH_ATTRIB) {
+                event->type = TJS_WATCH_DELETE;
+                goto merged;
+            }
+        }
+
+        break;
+    }
+
+    if (watcher->event_count >= kWatchMaxEvents) {
+        watcher->overflow = true;
+        goto merged;
+    }
+
+    if (watcher->event_count >= watcher->event_capacity) {
+        uint32_t capacity = watcher->event_capacity ? watcher->event_capacity * 2 : 16;
+        TJSWatchEvent* events = realloc(watcher->events, capacity * sizeof(TJSWatchEvent));
+        if (!events) {
+            watcher->overflow = true;
+            goto merged;
+        }
+
+        watcher->events = events;
+        watcher->event_capacity = capacity;
+    }
+
+    TJSWatchEvent* event = &watcher->events[watcher->event_count++];
+    event->type = type;
+    event->directory = directory;
+    event->cookie = cookie;
+    event->path = path;
+    event->old_path = old_path;
+    return;
+
+merged:
+    free(path);
+    free(old_path);
+}
+
+#if defined(__linux__)
+
+#define TJS_WATCH_MASK (IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF)
+
+static TJSWatchDir* tjs__watcher_find_dir(TJSWatcher* watcher, int wd)
+{
+    uint32_t low = 0;
+    uint32_t high = watcher->dir_count;
+    while (low < high) {
+        uint32_t middle = (low + high) / 2;
+        TJSWatchDir* dir = &watcher->dirs[middle];
+        if (dir->wd == wd) {
+            return dir;
+
+        } else if (dir->wd < wd) {
+            low = middle + 1;
+
+        } else {
+            high = middle;
+        }
+    }
+
+    return NULL;
+}
+
+static int tjs__watcher_add_dir(TJSWatcher* watcher, const char* path, bool is_root)
+{
+    uint32_t mask = TJS_WATCH_MASK | (is_root ? 0 : IN_ONLYDIR);
+    int wd = inotify_add_watch(watcher->fd, path, mask);
+    if (wd < 0) {
+        return uv_translate_sys_error(errno);
+    }
+
+    TJSWatchDir* dir = tjs__watcher_find_dir(watcher, wd);
+    if (dir) {
+        free(dir->path);
+        dir->path = strdup(path);
+        return 0;
+    }
+
+    if (watcher->dir_count >= watcher->dir_capacity) {
+        uint32_t capacity = watcher->dir_capacity ? watcher->dir_capacity * 2 : 16;
+        TJSWatchDir* dirs = realloc(watcher->dirs, capacity * sizeof(TJSWatchDir));
+        if (!dirs) {
+            inotify_rm_watch(watcher->fd, wd);
+            return UV_ENOMEM;
+        }
+
+        watcher->dirs = dirs;
+        watcher->dir_capacity = capacity;
+    }
+
+    // inotify 分配的 wd 通常是递增的, 否则插入到合适的位置
+    uint32_t index = watcher->dir_count;
+    while (index > 0 && watcher->dirs[index - 1].wd > wd) {
+        index--;
+    }
+
+    memmove(&watcher->dirs[index + 1], &watcher->dirs[index], (watcher->dir_count - index) * sizeof(TJSWatchDir));
+    watcher->dirs[index].wd = wd;
+    watcher->dirs[index].path = strdup(path);
+    watcher->dir_count++;
+    return 0;
+}
+
+static void tjs__watcher_remove_dir(TJSWatcher* watcher, int wd)
+{
+    TJSWatchDir* dir = tjs__watcher_find_dir(watcher, wd);
+    if (!dir) {
+        return;
+    }
+
+    free(dir->path);
+    uint32_t index = dir - watcher->dirs;
+    memmove(dir, dir + 1, (watcher->dir_count - index - 1) * sizeof(TJSWatchDir));
+    watcher->dir_count--;
+}
+
+/**
+ * 递归监视指定目录下的所有子目录
+ * @param emit 是否为已存在的文件生成 create 事件 (监视建立之前创建的文件)
+ */
+static void tjs__watcher_add_tree(TJSWatcher* watcher, const char* path, bool emit)
+{
+    if (tjs__watcher_add_dir(watcher, path, false) < 0) {
+        return;
+    }
+
+    DIR* dir = opendir(path);
+    if (!dir) {
+        return;
+    }
+
+    struct dirent* dirent;
+    while ((dirent = readdir(dir)) != NULL) {
+        const char* name = dirent->d_name;
+        if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
+            continue;
+        }
+
+        char* subpath = tjs__watch_join(path, name);
+        if (!subpath) {
+            break;
+        }
+
+        bool is_dir = dirent->d_type == DT_DIR;
+        if (dirent->d_type == DT_UNKNOWN) {
+            struct stat st;
+            is_dir = lstat(subpath, &st) == 0 && S_ISDIR(st.st_mode);
+        }
+
+        if (is_dir) {
+            tjs__watcher_add_tree(watcher, subpath, emit);
+        }
+
+        if (emit) {
+            tjs__watcher_add_event(watcher, TJS_WATCH_CREATE, subpath, NULL, 0, is_dir);
+
+        } else {
+            free(subpath);
+        }
+    }
+
+    closedir(dir);
+}
+
+static bool tjs__watch_has_prefix(const char* path, const char* prefix, size_t length)
+{
+    return strncmp(path, prefix, length) == 0 && (path[length] == '\0' || path[length] == TJS__PATHSEP);
+}
+
+/** 目录被移出监视范围后, 不再监视它的所有子目录 */
+static void tjs__watcher_remove_tree(TJSWatcher* watcher, const char* path)
+{
+    size_t length = strlen(path);
+    for (uint32_t i = 0; i < watcher->dir_count; i++) {
+        if (tjs__watch_has_prefix(watcher->dirs[i].path, path, length)) {
+            // 随后会收到 IN_IGNORED 事件
+            inotify_rm_watch(watcher->fd, watcher->dirs[i].wd);
+        }
+    }
+}
+
+/** 目录被重命名后, 更新它的所有子目录的路径 */
+static void tjs__watcher_rename_dirs(TJSWatcher* watcher, const char* old_path, const char* new_path)
+{
+    size_t old_length = strlen(old_path);
+    for (uint32_t i = 0; i < watcher->dir_count; i++) {
+        char* path = watcher->dirs[i].path;
+        if (!tjs__watch_has_prefix(path, old_path, old_length)) {
+            continue;
+        }
+
+        char* updated = malloc(strlen(new_path) + strlen(path + old_length) + 1);
+        if (updated) {
+            strcpy(updated, new_path);
+            strcat(updated, path + old_length);
+            free(path);
+            watcher->dirs[i].path = updated;
+        }
+    }
+}
+
+static void tjs__watcher_on_inotify(TJSWatcher* watcher, const struct inotify_event* ev)
+{
+    if (ev->mask & IN_Q_OVERFLOW) {
+        watcher->overflow = true;
+        if (!uv_is_active((uv_handle_t*)&watcher->timer)) {
+            uv_timer_start(&watcher->timer, tjs__watcher_on_timer, watcher->delay, 0);
+        }
+
+        return;
+    }
+
+    if (ev->mask & IN_IGNORED) {
+        tjs__watcher_remove_dir(watcher, ev->wd);
+        return;
+    }
+
+    TJSWatchDir* dir = tjs__watcher_find_dir(watcher, ev->wd);
+    if (!dir) {
+        return;
+    }
+
+    // 子目录自身的删除和移动事件已经由父目录报告
+    bool is_root = strcmp(dir->path, watcher->root) == 0;
+    if ((ev->mask & (IN_DELETE_SELF | IN_MOVE_SELF)) && !is_root) {
+        return;
+    }
+
+    char* path = ev->len > 0 && ev->name[0] ? tjs__watch_join(dir->path, ev->name) : strdup(dir->path);
+    if (!path) {
+        return;
+    }
+
+    bool directory = (ev->mask & IN_ISDIR) != 0;
+    uint32_t mask = ev->mask;
+
+    if (mask & IN_CREATE) {
+        if (directory && watcher->recursive) {
+            tjs__watcher_add_event(watcher, TJS_WATCH_CREATE, strdup(path), NULL, 0, true);
+            tjs__watcher_add_tree(watcher, path, true);
+            free(path);
+            return;
+        }
+
+        tjs__watcher_add_event(watcher, TJS_WATCH_CREATE, path, NULL, 0, directory);
+
+    } else if (mask & (IN_MODIFY | IN_CLOSE_WRITE)) {
+        tjs__watcher_add_event(watcher, TJS_WATCH_MODIFY, path, NULL, 0, directory);
+
+    } else if (mask & IN_ATTRIB) {
+        tjs__watcher_add_event(watcher, TJS_WATCH_ATTRIB, path, NULL, 0, directory);
+
+    } else if (mask & (IN_DELETE | IN_DELETE_SELF | IN_MOVE_SELF)) {
+        tjs__watcher_add_event(watcher, TJS_WATCH_DELETE, path, NULL, 0, directory);
+
+    } else if (mask & IN_MOVED_FROM) {
+        // 等待对应的 IN_MOVED_TO
+        tjs__watcher_add_event(watcher, TJS_WATCH_RENAME, NULL, path, ev->cookie, directory);
+
+    } else if (mask & IN_MOVED_TO) {
+        TJSWatchEvent* pending = NULL;
+        for (uint32_t i = watcher->event_count; i > 0; i--) {
+            TJSWatchEvent* event = &watcher->events[i - 1];
+            if (event->type == TJS_WATCH_RENAME && !event->path && event->cookie == ev->cookie) {
+                pending = event;
+                break;
+            }
+        }
+
+        if (directory && watcher->recursive) {
+            if (pending) {
+                tjs__watcher_rename_dirs(watcher, pending->old_path, path);
+
+            } else {
+                tjs__watcher_add_tree(watcher, path, false);
+            }
+        }
+
+        if (pending) {
+            pending->path = path;
+
+        } else {
+            // 从监视范围之外移入
+            tjs__watcher_add_event(watcher, TJS_WATCH_CREATE, path, NULL, 0, directory);
+        }
+
+    } else {
+        free(path);
+    }
+}
+
+static void tjs__watcher_on_poll(uv_poll_t* handle, int status, int events)
+{
+    TJSWatcher* watcher = handle->data;
+    CHECK_NOT_NULL(watcher);
+
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    for (;;) {
+        ssize_t length = read(watcher->fd, buffer, sizeof(buffer));
+        if (length <= 0) {
+            break;
+        }
+
+        for (char* ptr = buffer; ptr < buffer + length;) {
+            const struct inotify_event* ev = (const struct inotify_event*)ptr;
+            tjs__watcher_on_inotify(watcher, ev);
+            ptr += sizeof(struct inotify_event) + ev->len;
+        }
+    }
+}
+
+static int tjs__watcher_start(TJSWatcher* watcher, uv_loop_t* loop)
+{
+    watcher->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (watcher->fd < 0) {
+        return uv_translate_sys_error(errno);
+    }
+
+    int ret = tjs__watcher_add_dir(watcher, watcher->root, true);
+    if (ret < 0) {
+        close(watcher->fd);
+        return ret;
+    }
+
+    struct stat st;
+    if (watcher->recursive && stat(watcher->root, &st) == 0 && S_ISDIR(st.st_mode)) {
+        tjs__watcher_add_tree(watcher, watcher->root, false);
+    }
+
+    ret = uv_poll_init(loop, &watcher->poll, watcher->fd);
+    if (ret < 0) {
+        close(watcher->fd);
+        return ret;
+    }
+
+    watcher->poll.data = watcher;
+    watcher->handles++;
+    return uv_poll_start(&watcher->poll, UV_READABLE, tjs__watcher_on_poll);
+}
+
+#else
+
+static void tjs__watcher_on_event(uv_fs_event_t* handle, const char* filename, int events, int status)
+{
+    TJSWatcher* watcher = handle->data;
+    CHECK_NOT_NULL(watcher);
+
+    if (status < 0) {
+        return;
+    }
+
+    char* path = filename ? tjs__watch_join(watcher->root, filename) : strdup(watcher->root);
+    if (!path) {
+        return;
+    }
+
+    // uv_fs_event_t 无法区分创建, 删除和重命名
+    int type = (events & UV_RENAME) ? TJS_WATCH_RENAME : TJS_WATCH_MODIFY;
+    tjs__watcher_add_event(watcher, type, path, NULL, 0, false);
+}
+
+static int tjs__watcher_start(TJSWatcher* watcher, uv_loop_t* loop)
+{
+    int ret = uv_fs_event_init(loop, &watcher->event);
+    if (ret < 0) {
+        return ret;
+    }
+
+    watcher->event.data = watcher;
+    watcher->handles++;
+
+    unsigned int flags = watcher->recursive ? UV_FS_EVENT_RECURSIVE : 0;
+    return uv_fs_event_start(&watcher->event, tjs__watcher_on_event, watcher->root, flags);
+}
+
+#endif
+
+static TJSWatcher* tjs_watcher_get(JSContext* ctx, JSValueConst obj)
+{
+    return JS_GetOpaque2(ctx, obj, tjs_watcher_class_id);
+}
+
+static JSValue tjs_watcher_close(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSWatcher* watcher = tjs_watcher_get(ctx, this_val);
+    if (!watcher) {
+        return JS_EXCEPTION;
+    }
+
+    tjs__watcher_close(watcher);
+    return JS_UNDEFINED;
+}
+
+static JSValue tjs_watcher_path_get(JSContext* ctx, JSValueConst this_val)
+{
+    TJSWatcher* watcher = tjs_watcher_get(ctx, this_val);
+    if (!watcher) {
+        return JS_EXCEPTION;
+    }
+
+    return JS_NewString(ctx, watcher->root);
+}
+
+/**
+ * 监视文件或目录的变化
+ * @param path 文件或目录名
+ * @param options `{ recursive, delay }`
+ * @param callback 回调函数, 参数为一批事件
+ */
+static JSValue tjs_fs_watch(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    if (!JS_IsString(argv[0])) {
+        return JS_ThrowTypeError(ctx, "The '%s' argument must be of type string", "path");
+    }
+
+    if (!JS_IsFunction(ctx, argv[2])) {
+        return JS_ThrowTypeError(ctx, "not a function");
+    }
+
+    bool recursive = false;
+    uint32_t delay = 50;
+    if (JS_IsObject(argv[1])) {
+        JSValue value = JS_GetPropertyStr(ctx, argv[1], "recursive");
+        recursive = JS_ToBool(ctx, value);
+        JS_FreeValue(ctx, value);
+
+        delay = TJS_GetPropertyUint32(ctx, argv[1], "delay", delay);
+    }
+
+    JSValue obj = JS_NewObjectClass(ctx, tjs_watcher_class_id);
+    if (JS_IsException(obj)) {
+        return obj;
+    }
+
+    TJSWatcher* watcher = calloc(1, sizeof(*watcher));
+    if (!watcher) {
+        JS_FreeValue(ctx, obj);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    const char* root = JS_ToCString(ctx, argv[0]);
+    if (!root) {
+        free(watcher);
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+
+    // 去掉末尾的路径分隔符
+    size_t length = strlen(root);
+    while (length > 1 && root[length - 1] == TJS__PATHSEP) {
+        length--;
+    }
+
+    watcher->ctx = ctx;
+    watcher->func = JS_UNDEFINED;
+    watcher->root = strndup(root, length);
+    watcher->recursive = recursive;
+    watcher->delay = delay;
+    JS_FreeCString(ctx, root);
+
+    uv_loop_t* loop = TJS_GetLoop(ctx);
+    uv_timer_init(loop, &watcher->timer);
+    watcher->timer.data = watcher;
+    watcher->handles = 1;
+
+    int ret = tjs__watcher_start(watcher, loop);
+
+    // 后续都由 finalizer 释放
+    watcher->func = JS_DupValue(ctx, argv[2]);
+    JS_SetOpaque(obj, watcher);
+
+    if (ret < 0) {
+        JS_FreeValue(ctx, obj);
+        return tjs_throw_uv_error(ctx, ret);
+    }
+
+    return obj;
+}
+
+// ////////////////////////////////////////////////////////////
+// readfile
+
+static void tjs__readfile_free(JSRuntime* rt, void* opaque, void* ptr)
+{
+    TJSFsReadFileReq* request = opaque;
+    CHECK_NOT_NULL(request);
+
+    dbuf_free(&request->dbuf);
+    js_free_rt(rt, request->filename);
+    js_free_rt(rt, request);
+}
+
+static void tjs__readfile_work(uv_work_t* req)
+{
+    TJSFsReadFileReq* request = req->data;
+    CHECK_NOT_NULL(request);
+
+    request->ret = tjs_load_file(request->ctx, &request->dbuf, request->filename);
+}
+
+static void tjs__readfile_after_work(uv_work_t* req, int status)
+{
+    TJSFsReadFileReq* request = req->data;
+    CHECK_NOT_NULL(request);
+
+    JSContext* ctx = request->ctx;
+    JSValue arg;
+    bool is_reject = false;
+
+    if (status != 0) {
+        arg = tjs_new_uv_error(ctx, status);
+        is_reject = true;
+
+    } else if (request->ret < 0) {
+        arg = tjs_new_uv_error(ctx, request->ret);
+        is_reject = true;
+
+    } else {
+        arg = JS_NewArrayBuffer(ctx, request->dbuf.buf, request->dbuf.size, tjs__readfile_free, (void*)request, false);
+    }
+
+    TJS_SettlePromise(ctx, &request->result, is_reject, 1, (JSValueConst*)&arg);
+
+    if (is_reject) {
+        tjs__readfile_free(JS_GetRuntime(ctx), (void*)request, NULL);
+    }
+}
+
+static JSValue tjs_fs_readfile(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic)
+{
+    if (!JS_IsString(argv[0])) {
+        return JS_ThrowTypeError(ctx, "The '%s' argument must be of type string", "path");
+    }
+
+    const char* filename = JS_ToCString(ctx, argv[0]);
+    if (!filename) {
+        return JS_EXCEPTION;
+    }
+
+    TJSFsReadFileReq* request = js_malloc(ctx, sizeof(*request));
+    if (!request) {
+        JS_FreeCString(ctx, filename);
+        return JS_EXCEPTION;
+    }
+
+    memset(request, 0, sizeof(*request));
+
+    dbuf_init(&request->dbuf);
+    request->ctx = ctx;
+    request->ret = -1;
+    request->magic = magic;
+    request->filename = js_strdup(ctx, filename);
+    request->req.data = request;
+    JS_FreeCString(ctx, filename);
+
+    int ret = uv_queue_work(TJS_GetLoop(ctx), &request->req, tjs__readfile_work, tjs__readfile_after_work);
+    if (ret != 0) {
+        js_free(ctx, request->filename);
+        js_free(ctx, request);
+        return tjs_throw_uv_error(ctx, ret);
+    }
+
+    return TJS_InitPromise(ctx, &request->result);
+}
+
+// ////////////////////////////////////////////////////////////
+// writefile
+
+enum {
+    TJS_WRITEFILE_APPEND = 1,
+    TJS_WRITEFILE_ATOMIC = 2,
+    TJS_WRITEFILE_FSYNC = 4,
+    TJS_WRITEFILE_FSYNC_GROUP = 8
+};
+
+typedef struct tjs_sync_entry_s {
+    struct tjs_sync_entry_s* next;
+    const char* dirname;
+    int result;
+    bool done;
+} TJSSyncEntry;
+
+/**
+ * 目录同步组
+ * - 同一时间有多个原子写入等待同步所在的目录时, 由其中一个线程为所有等待者同步,
+ *   每个目录只同步一次, 其他线程等待它完成
+ */
+static struct {
+    uv_once_t once;
+    uv_mutex_t mutex;
+    uv_cond_t cond;
+    TJSSyncEntry* pending;
+    bool syncing;
+    uint32_t counter; // 用于生成临时文件名
+} tjs_sync_group = { UV_ONCE_INIT };
+
+static void tjs__sync_group_init(void)
+{
+    CHECK_EQ(uv_mutex_init(&tjs_sync_group.mutex), 0);
+    CHECK_EQ(uv_cond_init(&tjs_sync_group.cond), 0);
+}
+
+/** 同步目录, 以便其中的文件的创建和重命名可以持久保存 */
+static int tjs__sync_dir(const char* dirname)
+{
+#if defined(_WIN32)
+    return 0;
+#else
+    uv_fs_t req;
+    int fd = uv_fs_open(NULL, &req, dirname, UV_FS_O_RDONLY, 0, NULL);
+    uv_fs_req_cleanup(&req);
+    if (fd < 0) {
+        return fd;
+    }
+
+    int ret = uv_fs_fsync(NULL, &req, fd, NULL);
+    uv_fs_req_cleanup(&req);
+
+    uv_fs_close(NULL, &req, fd, NULL);
+    uv_fs_req_cleanup(&req);
+    return ret;
+#endif
+}
+
+/** 加入目录同步组, 在目录被同步后返回 */
+static int tjs__sync_group_join(const char* dirname)
+{
+    uv_once(&tjs_sync_group.once, tjs__sync_group_init);
+
+    TJSSyncEntry entry = { NULL, dirname, 0, false };
+
+    uv_mutex_lock(&tjs_sync_group.mutex);
+    entry.next = tjs_sync_group.pending;
+    tjs_sync_group.pending = &entry;
+
+    while (!entry.done) {
+        if (tjs_sync_group.syncing) {
+            uv_cond_wait(&tjs_sync_group.cond, &tjs_sync_group.mutex);
+            continue;
+        }
+
+        // 成为这一批的同步者
+        TJSSyncEntry* batch = tjs_sync_group.pending;
+        tjs_sync_group.pending = NULL;
+        tjs_sync_group.syncing = true;
+
+        while (batch) {
+            // 等待者在 done 被设置之前不会返回, 所以 current 在此之前一直有效
+            const char* current = batch->dirname;
+            uv_mutex_unlock(&tjs_sync_group.mutex);
+            int ret = tjs__sync_dir(current);
+            uv_mutex_lock(&tjs_sync_group.mutex);
+
+            // 在锁内设置结果并从这一批中移除, 之后不再访问这些条目
+            TJSSyncEntry** link = &batch;
+            while (*link) {
+                TJSSyncEntry* other = *link;
+                if (strcmp(other->dirname, current) == 0) {
+                    *link = other->next;
+                    other->result = ret;
+                    other->done = true;
+
+                } else {
+                    link = &other->next;
+                }
+            }
+
+            uv_cond_broadcast(&tjs_sync_group.cond);
+        }
+
+        tjs_sync_group.syncing = false;
+        uv_cond_broadcast(&tjs_sync_group.cond);
+    }
+
+    uv_mutex_unlock(&tjs_sync_group.mutex);
+    return entry.result;
+}
+
+static int tjs__writefile_write(uv_file fd, const uint8_t* data, size_t length)
+{
+    uv_fs_t req;
+    while (length > 0) {
+        uv_buf_t buf = uv_buf_init((char*)data, length > INT32_MAX ? INT32_MAX : (unsigned int)length);
+        int ret = uv_fs_write(NULL, &req, fd, &buf, 1, -1, NULL);
+        uv_fs_req_cleanup(&req);
+        if (ret < 0) {
+            return ret;
+        }
+
+        data += ret;
+        length -= ret;
+    }
+
+    return 0;
+}
+
+/**
+ * 在一个工作项中完成打开, 写入, 同步和关闭
+ * - 原子写入先写到同一目录下的临时文件, 然后重命名为目标文件, 失败时删除临时文件
+ */
+static void tjs__writefile_work(uv_work_t* req)
+{
+    TJSFsWriteFileReq* request = req->data;
+    CHECK_NOT_NULL(request);
+
+    const char* filename = request->filename;
+    int flags = request->flags;
+    bool is_atomic = flags & TJS_WRITEFILE_ATOMIC;
+    bool is_fsync = flags & (TJS_WRITEFILE_FSYNC | TJS_WRITEFILE_FSYNC_GROUP);
+    int mode = request->mode;
+    int open_flags = UV_FS_O_WRONLY | UV_FS_O_CREAT;
+    char tmpname[PATH_MAX];
+    const char* path = filename;
+    uv_fs_t fs_req;
+    int ret;
+
+    if (is_atomic) {
+        // 保留原文件的权限
+        if (mode < 0) {
+            if (uv_fs_stat(NULL, &fs_req, filename, NULL) == 0) {
+                mode = fs_req.statbuf.st_mode & 07777;
+            }
+
+            uv_fs_req_cleanup(&fs_req);
+        }
+
+        uv_once(&tjs_sync_group.once, tjs__sync_group_init);
+        uv_mutex_lock(&tjs_sync_group.mutex);
+        uint32_t counter = ++tjs_sync_group.counter;
+        uv_mutex_unlock(&tjs_sync_group.mutex);
+
+        ret = snprintf(tmpname, sizeof(tmpname), "%s.%d.%u.tmp", filename, (int)uv_os_getpid(), counter);
+        if (ret < 0 || ret >= (int)sizeof(tmpname)) {
+            request->syscall = "open";
+            request->ret = UV_ENAMETOOLONG;
+            return;
+        }
+
+        path = tmpname;
+        open_flags |= UV_FS_O_EXCL;
+
+    } else {
+        open_flags |= (flags & TJS_WRITEFILE_APPEND) ? UV_FS_O_APPEND : UV_FS_O_TRUNC;
+    }
+
+    uv_file fd = uv_fs_open(NULL, &fs_req, path, open_flags, mode < 0 ? 0666 : mode, NULL);
+    uv_fs_req_cleanup(&fs_req);
+    if (fd < 0) {
+        request->syscall = "open";
+        request->ret = fd;
+        return;
+    }
+
+    ret = tjs__writefile_write(fd, request->buffer, request->length);
+    if (ret < 0) {
+        request->syscall = "write";
+
+    } else if (is_fsync) {
+        ret = uv_fs_fdatasync(NULL, &fs_req, fd, NULL);
+        uv_fs_req_cleanup(&fs_req);
+        request->syscall = "fsync";
+    }
+
+    int close_ret = uv_fs_close(NULL, &fs_req, fd, NULL);
+    uv_fs_req_cleanup(&fs_req);
+    if (ret == 0 && close_ret < 0) {
+        ret = close_ret;
+        request->syscall = "close";
+    }
+
+    if (ret == 0 && is_atomic) {
+        ret = uv_fs_rename(NULL, &fs_req, tmpname, filename, NULL);
+        uv_fs_req_cleanup(&fs_req);
+        request->syscall = "rename";
+    }
+
+    if (ret < 0) {
+        if (is_atomic) {
+            uv_fs_unlink(NULL, &fs_req, tmpname, NULL);
+            uv_fs_req_cleanup(&fs_req);
+        }
+
+        request->ret = ret;
+        return;
+    }
+
+    // 重命名需要同步所在的目录才能持久保存
+    if (is_atomic && is_fsync) {
+        char dirname[PATH_MAX];
+        const char* sep = strrchr(filename, TJS__PATHSEP);
+        if (sep == NULL) {
+            strcpy(dirname, ".");
+
+        } else if (sep == filename) {
+            strcpy(dirname, "/");
+
+        } else {
+            snprintf(dirname, sizeof(dirname), "%.*s", (int)(sep - filename), filename);
+        }
+
+        request->syscall = "fsync";
+        if (flags & TJS_WRITEFILE_FSYNC_GROUP) {
+            ret = tjs__sync_group_join(dirname);
+
+        } else {
+            ret = tjs__sync_dir(dirname);
+        }
+    }
+
+    request->ret = ret;
+}
+
+static void tjs__writefile_after_work(uv_work_t* req, int status)
+{
+    TJSFsWriteFileReq* request = req->data;
+    CHECK_NOT_NULL(request);
+
+    JSContext* ctx = request->ctx;
+    JSValue arg = JS_UNDEFINED;
+    bool is_reject = false;
+
+    if (status != 0 || request->ret < 0) {
+        int error = status != 0 ? status : request->ret;
+        arg = tjs_new_uv_error(ctx, error);
+        if (request->syscall) {
+            char message[PATH_MAX + 64];
+            snprintf(message, sizeof(message), "%s, %s '%s'", uv_strerror(error), request->syscall, request->filename);
+            JS_DefinePropertyValueStr(ctx, arg, "message", JS_NewString(ctx, message), JS_PROP_C_W_E);
+            JS_DefinePropertyValueStr(ctx, arg, "path", JS_NewString(ctx, request->filename), JS_PROP_C_W_E);
+            JS_DefinePropertyValueStr(ctx, arg, "syscall", JS_NewString(ctx, request->syscall), JS_PROP_C_W_E);
+        }
+
+        is_reject = true;
+    }
+
+    TJS_SettlePromise(ctx, &request->result, is_reject, 1, (JSValueConst*)&arg);
+
+    if (request->string) {
+        JS_FreeCString(ctx, request->string);
+    }
+
+    JS_FreeValue(ctx, request->data);
+    js_free(ctx, request->filename);
+    js_free(ctx, request);
+}
+
+/**
+ * 在线程池中一次完成文件的写入
+ * - magic 为 1 时追加到文件末尾
+ * - 字符串按 UTF-8 编码写入, ArrayBuffer 和 TypedArray 直接写入, 不会复制
+ * @param path 文件名
+ * @param data 要写入的数据
+ * @param options `{ atomic, fsync, mode }`, fsync 为 'group' 时合并目录同步
+ */
+static JSValue tjs_fs_writefile(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic)
+{
+    if (!JS_IsString(argv[0])) {
+        return JS_ThrowTypeError(ctx, "The '%s' argument must be of type string", "path");
+    }
+
+    int flags = magic ? TJS_WRITEFILE_APPEND : 0;
+    int mode = -1;
+    if (JS_IsObject(argv[2])) {
+        JSValue value = JS_GetPropertyStr(ctx, argv[2], "atomic");
+        if (JS_ToBool(ctx, value) && !magic) {
+            flags |= TJS_WRITEFILE_ATOMIC;
+        }
+
+        JS_FreeValue(ctx, value);
+
+        value = JS_GetPropertyStr(ctx, argv[2], "fsync");
+        if (JS_IsString(value)) {
+            const char* fsync = JS_ToCString(ctx, value);
+            if (fsync && strcmp(fsync, "group") == 0) {
+                flags |= TJS_WRITEFILE_FSYNC_GROUP;
+            }
+
+            JS_FreeCString(ctx, fsync);
+
+        } else if (JS_ToBool(ctx, value)) {
+            flags |= TJS_WRITEFILE_FSYNC;
+        }
+
+        JS_FreeValue(ctx, value);
+
+        mode = TJS_GetPropertyInt32(ctx, argv[2], "mode", -1);
+    }
+
+    TJSFsWriteFileReq* request = js_mallocz(ctx, sizeof(*request));
+    if (!request) {
+        return JS_EXCEPTION;
+    }
+
+    request->data = JS_UNDEFINED;
+    if (JS_IsString(argv[1])) {
+        request->string = JS_ToCStringLen(ctx, &request->length, argv[1]);
+        if (!request->string) {
+            js_free(ctx, request);
+            return JS_EXCEPTION;
+        }
+
+        request->buffer = (const uint8_t*)request->string;
+
+    } else {
+        uv_buf_t buf;
+        if (tjs_fs_to_buf(ctx, argv[1], &buf) < 0) {
+            js_free(ctx, request);
+            return JS_EXCEPTION;
+        }
+
+        request->buffer = (const uint8_t*)buf.base;
+        request->length = buf.len;
+        request->data = JS_DupValue(ctx, argv[1]);
+    }
+
+    const char* filename = JS_ToCString(ctx, argv[0]);
+    if (!filename) {
+        goto fail;
+    }
+
+    request->ctx = ctx;
+    request->flags = flags;
+    request->mode = mode;
+    request->filename = js_strdup(ctx, filename);
+    request->req.data = request;
+    JS_FreeCString(ctx, filename);
+
+    int ret = uv_queue_work(TJS_GetLoop(ctx), &request->req, tjs__writefile_work, tjs__writefile_after_work);
+    if (ret != 0) {
+        js_free(ctx, request->filename);
+        tjs_throw_uv_error(ctx, ret);
+        goto fail;
+    }
+
+    return TJS_InitPromise(ctx, &request->result);
+
+fail:
+    if (request->string) {
+        JS_FreeCString(ctx, request->string);
+    }
+
+    JS_FreeValue(ctx, request->data);
+    js_free(ctx, request);
+    return JS_EXCEPTION;
+}
+
+static const JSCFunctionListEntry tjs_file_proto_funcs[] = {
+    TJS_CFUNC_DEF("close", 0, tjs_file_close),
+    TJS_CFUNC_DEF("fileno", 0, tjs_file_fileno),
     TJS_CFUNC_DEF("flock", 1, tjs_file_flock),
     TJS_CFUNC_DEF("read", 2, tjs_file_read),
+    JS_CFUNC_MAGIC_DEF("readInto", 2, tjs_file_rw_buffers, 0),
+    JS_CFUNC_MAGIC_DEF("readv", 2, tjs_file_rw_buffers, 2),
+    TJS_CFUNC_DEF("readSync", 2, tjs_file_read_sync),
     TJS_CFUNC_DEF("stat", 0, tjs_file_stat),
     TJS_CFUNC_DEF("sync", 0, tjs_file_sync),
     TJS_CFUNC_DEF("truncate", 1, tjs_file_truncate),
     TJS_CFUNC_DEF("write", 2, tjs_file_write),
+    JS_CFUNC_MAGIC_DEF("writeFrom", 2, tjs_file_rw_buffers, 1),
+    JS_CFUNC_MAGIC_DEF("writev", 2, tjs_file_rw_buffers, 3),
 
     TJS_CGETSET_DEF("fd", tjs_file_fd_get, NULL),
     TJS_CGETSET_DEF("path", tjs_file_path_get, NULL),
@@ -1445,10 +3685,17 @@ static const JSCFunctionListEntry tjs_dir_proto_funcs[] = {
     TJS_CFUNC_DEF("close", 0, tjs_dir_close),
     TJS_CGETSET_DEF("path", tjs_dir_path_get, NULL),
     TJS_CFUNC_DEF("next", 0, tjs_dir_next),
+    TJS_CFUNC_DEF("read", 1, tjs_dir_read),
     JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Dir", JS_PROP_CONFIGURABLE),
     TJS_CFUNC_DEF("[Symbol.asyncIterator]", 0, tjs_dir_iterator),
 };
 
+static const JSCFunctionListEntry tjs_watcher_proto_funcs[] = {
+    TJS_CFUNC_DEF("close", 0, tjs_watcher_close),
+    TJS_CGETSET_DEF("path", tjs_watcher_path_get, NULL),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Watcher", JS_PROP_CONFIGURABLE),
+};
+
 static const JSCFunctionListEntry tjs_fs_funcs[] = {
     TJS_CONST(UV_DIRENT_UNKNOWN),
     TJS_CONST(UV_DIRENT_FILE),
@@ -1476,6 +3723,13 @@ static const JSCFunctionListEntry tjs_fs_funcs[] = {
 #endif
 #ifdef S_ISUID
     TJS_CONST(S_ISUID),
+#endif
+#if !defined(_WIN32)
+    TJS_CONST(MADV_NORMAL),
+    TJS_CONST(MADV_RANDOM),
+    TJS_CONST(MADV_SEQUENTIAL),
+    TJS_CONST(MADV_WILLNEED),
+    TJS_CONST(MADV_DONTNEED),
 #endif
     TJS_CFUNC_DEF("access", 2, tjs_fs_access),
     TJS_CFUNC_DEF("chmod", 2, tjs_fs_chmod),
@@ -1484,7 +3738,9 @@ static const JSCFunctionListEntry tjs_fs_funcs[] = {
     TJS_CFUNC_DEF("file", 3, tjs_fs_file),
     TJS_CFUNC_DEF("mkdir", 1, tjs_fs_mkdir),
     TJS_CFUNC_DEF("mkdtemp", 1, tjs_fs_mkdtemp),
+    TJS_CFUNC_DEF("madvise", 2, tjs_fs_madvise),
     TJS_CFUNC_DEF("mkstemp", 1, tjs_fs_mkstemp),
+    TJS_CFUNC_DEF("mmap", 2, tjs_fs_mmap),
     TJS_CFUNC_DEF("open", 3, tjs_fs_open),
     TJS_CFUNC_DEF("opendir", 1, tjs_fs_opendir),
     TJS_CFUNC_DEF("readlink", 1, tjs_fs_readlink),
@@ -1494,7 +3750,12 @@ static const JSCFunctionListEntry tjs_fs_funcs[] = {
     TJS_CFUNC_DEF("statfs", 1, tjs_fs_statfs),
     TJS_CFUNC_DEF("symlink", 2, tjs_fs_symlink),
     TJS_CFUNC_DEF("unlink", 1, tjs_fs_unlink),
+    TJS_CFUNC_DEF("utimes", 3, tjs_fs_utimes),
+    TJS_CFUNC_DEF("walk", 2, tjs_fs_walk),
+    TJS_CFUNC_DEF("watch", 3, tjs_fs_watch),
+    JS_CFUNC_MAGIC_DEF("appendFile", 3, tjs_fs_writefile, 1),
     JS_CFUNC_MAGIC_DEF("readFile", 1, tjs_fs_readfile, 0),
+    JS_CFUNC_MAGIC_DEF("writeFile", 3, tjs_fs_writefile, 0),
     JS_CFUNC_MAGIC_DEF("lstat", 1, tjs_fs_stat, 1),
     JS_CFUNC_MAGIC_DEF("stat", 1, tjs_fs_stat, 0)
 };
@@ -1517,6 +3778,20 @@ void tjs_mod_fs_init(JSContext* ctx, JSModuleDef* m)
     JS_SetPropertyFunctionList(ctx, proto, tjs_dir_proto_funcs, countof(tjs_dir_proto_funcs));
     JS_SetClassProto(ctx, tjs_dir_class_id, proto);
 
+    /* Walker object */
+    JS_NewClassID(&tjs_walker_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), tjs_walker_class_id, &tjs_walker_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, tjs_walker_proto_funcs, countof(tjs_walker_proto_funcs));
+    JS_SetClassProto(ctx, tjs_walker_class_id, proto);
+
+    /* Watcher object */
+    JS_NewClassID(&tjs_watcher_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), tjs_watcher_class_id, &tjs_watcher_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, tjs_watcher_proto_funcs, countof(tjs_watcher_proto_funcs));
+    JS_SetClassProto(ctx, tjs_watcher_class_id, proto);
+
     // fs
     obj = JS_NewObject(ctx);
     JS_SetPropertyFunctionList(ctx, obj, tjs_fs_funcs, countof(tjs_fs_funcs));
@@ -0,0 +1,844 @@
+/* 堆内存统计和堆快照 */
+#include "private.h"
+#include "tjs-utils.h"
+
+#include "util/dbuffer.h"
+
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/** Chrome 堆快照的节点类型 */
+enum tjs_heap_node_kind_enum {
+    TJS_HEAP_KIND_HIDDEN = 0,
+    TJS_HEAP_KIND_ARRAY = 1,
+    TJS_HEAP_KIND_OBJECT = 3,
+    TJS_HEAP_KIND_CODE = 4,
+    TJS_HEAP_KIND_CLOSURE = 5,
+    TJS_HEAP_KIND_REGEXP = 6,
+    TJS_HEAP_KIND_SYNTHETIC = 9,
+};
+
+/** Chrome 堆快照的引用类型 */
+enum tjs_heap_edge_kind_enum {
+    TJS_HEAP_EDGE_ELEMENT = 1,
+    TJS_HEAP_EDGE_PROPERTY = 2,
+    TJS_HEAP_EDGE_INTERNAL = 3,
+};
+
+/** 每个节点的字段数 */
+#define TJS_HEAP_NODE_FIELDS 7
+
+/** 字符串表中固定的字符串 */
+enum tjs_heap_string_enum {
+    TJS_HEAP_STRING_EMPTY,
+    TJS_HEAP_STRING_ROOTS,
+    TJS_HEAP_STRING_SHAPE,
+    TJS_HEAP_STRING_VAR_REF,
+    TJS_HEAP_STRING_ASYNC_FUNCTION,
+    TJS_HEAP_STRING_CONTEXT,
+    TJS_HEAP_STRING_BYTECODE,
+    TJS_HEAP_STRING_MAP,
+    TJS_HEAP_STRING_PROTO,
+    TJS_HEAP_STRING_INTERNAL,
+    TJS_HEAP_STRING_COUNT
+};
+
+static const char* tjs_heap_strings[TJS_HEAP_STRING_COUNT] = {
+    "", "(GC roots)", "(shape)", "(closure variable)", "(async function)",
+    "(context)", "(bytecode)", "map", "__proto__", "(internal)"
+};
+
+static const char* tjs_heap_type_names[TJS_HEAP_TYPE_COUNT] = {
+    "stream", "tls", "timer", "udp", "write", "sab"
+};
+
+/* 原生对象的数量和字节数, 工作线程也会修改 */
+static _Atomic int64_t tjs_heap_counts[TJS_HEAP_TYPE_COUNT];
+static _Atomic int64_t tjs_heap_sizes[TJS_HEAP_TYPE_COUNT];
+
+typedef struct tjs_heap_node_s {
+    const void* id;
+    uint64_t size;
+    uint32_t name; /* 字符串索引 */
+    uint32_t first_edge;
+    uint32_t edge_count;
+    uint32_t valid_edges; /* 目标节点存在的引用数 */
+    int ref_count;
+    uint8_t type; /* JSHeapNodeTypeEnum */
+    uint8_t kind; /* tjs_heap_node_kind_enum */
+} tjs_heap_node_t;
+
+typedef struct tjs_heap_edge_s {
+    const void* to;
+    uint32_t name; /* 属性名的字符串索引或者数组下标 */
+    uint8_t kind; /* tjs_heap_edge_kind_enum */
+} tjs_heap_edge_t;
+
+/** 按地址排序, 用于查找引用的目标节点 */
+typedef struct tjs_heap_index_s {
+    const void* id;
+    uint32_t node;
+} tjs_heap_index_t;
+
+typedef struct tjs_heap_snapshot_s {
+    uv_work_t req;
+    JSContext* ctx;
+    TJSPromise result;
+    char* filename;
+    int error;
+    int ret;
+
+    tjs_heap_node_t* nodes;
+    uint32_t node_count;
+    uint32_t node_capacity;
+
+    tjs_heap_edge_t* edges;
+    uint32_t edge_count;
+    uint32_t edge_capacity;
+
+    /* 字符串表, 已经转换为 JSON 字符串并以逗号分隔 */
+    DynBuf strings;
+    uint32_t string_count;
+
+    /* atom -> 字符串索引的散列表, 只在遍历时使用 */
+    uint32_t* atom_keys; /* atom + 1, 0 表示空 */
+    uint32_t* atom_values;
+    uint32_t atom_capacity;
+    uint32_t atom_count;
+
+    /* 各个类的节点类型, 0xff 表示还没有计算 */
+    uint8_t* class_kinds;
+    uint32_t class_capacity;
+} tjs_heap_snapshot_t;
+
+/** 各个类的对象数和字节数 */
+typedef struct tjs_heap_class_s {
+    int64_t count;
+    int64_t size;
+} tjs_heap_class_t;
+
+typedef struct tjs_heap_stats_s {
+    tjs_heap_class_t* classes;
+    uint32_t class_capacity;
+    int error;
+} tjs_heap_stats_t;
+
+void tjs_heap_add(tjs_heap_type_t type, size_t size)
+{
+    atomic_fetch_add_explicit(&tjs_heap_counts[type], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&tjs_heap_sizes[type], (int64_t)size, memory_order_relaxed);
+}
+
+void tjs_heap_remove(tjs_heap_type_t type, size_t size)
+{
+    atomic_fetch_sub_explicit(&tjs_heap_counts[type], 1, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&tjs_heap_sizes[type], (int64_t)size, memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////
+// 统计
+
+static void tjs_heap_stats_node(void* opaque, const JSHeapNodeInfo* node)
+{
+    tjs_heap_stats_t* stats = opaque;
+    if (node->type != JS_HEAP_NODE_OBJECT || stats->error) {
+        return;
+    }
+
+    if (node->class_id >= stats->class_capacity) {
+        uint32_t capacity = node->class_id + 64;
+        tjs_heap_class_t* classes = realloc(stats->classes, capacity * sizeof(*classes));
+        if (classes == NULL) {
+            stats->error = 1;
+            return;
+        }
+
+        memset(classes + stats->class_capacity, 0, (capacity - stats->class_capacity) * sizeof(*classes));
+        stats->classes = classes;
+        stats->class_capacity = capacity;
+    }
+
+    stats->classes[node->class_id].count++;
+    stats->classes[node->class_id].size += node->size;
+}
+
+/** 统计各个类的对象数和字节数, 返回的数组需要调用 free 释放 */
+static int tjs_heap_compute_classes(JSRuntime* rt, tjs_heap_stats_t* stats)
+{
+    memset(stats, 0, sizeof(*stats));
+
+    JSHeapVisitor visitor = { 0 };
+    visitor.node = tjs_heap_stats_node;
+    visitor.opaque = stats;
+    JS_VisitHeap(rt, &visitor);
+
+    if (stats->error) {
+        free(stats->classes);
+        stats->classes = NULL;
+        return -1;
+    }
+
+    return 0;
+}
+
+static JSValue tjs_heap_new_counter(JSContext* ctx, int64_t count, int64_t size)
+{
+    JSValue counter = JS_NewObject(ctx);
+    JS_SetPropertyStr(ctx, counter, "count", JS_NewInt64(ctx, count));
+    JS_SetPropertyStr(ctx, counter, "size", JS_NewInt64(ctx, size));
+    return counter;
+}
+
+/**
+ * 返回堆内存的使用情况
+ * - JSMemoryUsage 中的各项统计
+ * - classes: 各个类的对象数和字节数
+ * - native: 各类原生对象的数量和字节数
+ */
+static JSValue tjs_heap_get_statistics(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    JSRuntime* rt = JS_GetRuntime(ctx);
+    JSMemoryUsage usage;
+    JS_ComputeMemoryUsage(rt, &usage);
+
+    tjs_heap_stats_t stats;
+    if (tjs_heap_compute_classes(rt, &stats) < 0) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    JSValue result = JS_NewObject(ctx);
+
+#define TJS_SET_USAGE(name, field) JS_SetPropertyStr(ctx, result, name, JS_NewInt64(ctx, usage.field))
+    TJS_SET_USAGE("mallocSize", malloc_size);
+    TJS_SET_USAGE("mallocLimit", malloc_limit);
+    TJS_SET_USAGE("mallocCount", malloc_count);
+    TJS_SET_USAGE("memoryUsedSize", memory_used_size);
+    TJS_SET_USAGE("memoryUsedCount", memory_used_count);
+    TJS_SET_USAGE("atomCount", atom_count);
+    TJS_SET_USAGE("atomSize", atom_size);
+    TJS_SET_USAGE("stringCount", str_count);
+    TJS_SET_USAGE("stringSize", str_size);
+    TJS_SET_USAGE("objectCount", obj_count);
+    TJS_SET_USAGE("objectSize", obj_size);
+    TJS_SET_USAGE("propertyCount", prop_count);
+    TJS_SET_USAGE("propertySize", prop_size);
+    TJS_SET_USAGE("shapeCount", shape_count);
+    TJS_SET_USAGE("shapeSize", shape_size);
+    TJS_SET_USAGE("functionCount", js_func_count);
+    TJS_SET_USAGE("functionSize", js_func_size);
+    TJS_SET_USAGE("functionCodeSize", js_func_code_size);
+    TJS_SET_USAGE("pc2lineCount", js_func_pc2line_count);
+    TJS_SET_USAGE("pc2lineSize", js_func_pc2line_size);
+    TJS_SET_USAGE("cFunctionCount", c_func_count);
+    TJS_SET_USAGE("arrayCount", array_count);
+    TJS_SET_USAGE("fastArrayCount", fast_array_count);
+    TJS_SET_USAGE("fastArrayElements", fast_array_elements);
+    TJS_SET_USAGE("binaryObjectCount", binary_object_count);
+    TJS_SET_USAGE("binaryObjectSize", binary_object_size);
+#undef TJS_SET_USAGE
+
+    // classes
+    JSValue classes = JS_NewArray(ctx);
+    uint32_t index = 0;
+    for (uint32_t class_id = 0; class_id < stats.class_capacity; class_id++) {
+        tjs_heap_class_t* item = &stats.classes[class_id];
+        if (item->count == 0) {
+            continue;
+        }
+
+        JSAtom name = JS_GetClassNameRT(rt, class_id);
+        JSValue value = JS_NewObject(ctx);
+        JS_SetPropertyStr(ctx, value, "id", JS_NewUint32(ctx, class_id));
+        JS_SetPropertyStr(ctx, value, "name", name == JS_ATOM_NULL ? JS_NewString(ctx, "") : JS_AtomToString(ctx, name));
+        JS_SetPropertyStr(ctx, value, "count", JS_NewInt64(ctx, item->count));
+        JS_SetPropertyStr(ctx, value, "size", JS_NewInt64(ctx, item->size));
+        JS_SetPropertyUint32(ctx, classes, index++, value);
+    }
+
+    free(stats.classes);
+    JS_SetPropertyStr(ctx, result, "classes", classes);
+
+    // native
+    JSValue native = JS_NewObject(ctx);
+    for (int type = 0; type < TJS_HEAP_TYPE_COUNT; type++) {
+        int64_t count = atomic_load_explicit(&tjs_heap_counts[type], memory_order_relaxed);
+        int64_t size = atomic_load_explicit(&tjs_heap_sizes[type], memory_order_relaxed);
+        JS_SetPropertyStr(ctx, native, tjs_heap_type_names[type], tjs_heap_new_counter(ctx, count, size));
+    }
+
+    int64_t count, size;
+    dbuffer_get_usage(&count, &size);
+    JS_SetPropertyStr(ctx, native, "dbuffer", tjs_heap_new_counter(ctx, count, size));
+    JS_SetPropertyStr(ctx, result, "native", native);
+
+    return result;
+}
+
+void tjs_heap_print_usage(JSContext* ctx, FILE* file)
+{
+    JSRuntime* rt = JS_GetRuntime(ctx);
+    tjs_heap_stats_t stats;
+    if (tjs_heap_compute_classes(rt, &stats) < 0) {
+        return;
+    }
+
+    fprintf(file, "\nJSObject classes             count       size\n");
+    for (uint32_t class_id = 0; class_id < stats.class_capacity; class_id++) {
+        tjs_heap_class_t* item = &stats.classes[class_id];
+        if (item->count == 0) {
+            continue;
+        }
+
+        char name[64] = "";
+        JSAtom atom = JS_GetClassNameRT(rt, class_id);
+        if (atom != JS_ATOM_NULL) {
+            const char* str = JS_AtomToCString(ctx, atom);
+            if (str) {
+                snprintf(name, sizeof(name), "%s", str);
+                JS_FreeCString(ctx, str);
+            }
+        }
+
+        fprintf(file, "  %3u %-20s %8" PRId64 " %10" PRId64 "\n", class_id, name, item->count, item->size);
+    }
+
+    free(stats.classes);
+
+    fprintf(file, "\nNative objects               count       size\n");
+    for (int type = 0; type < TJS_HEAP_TYPE_COUNT; type++) {
+        int64_t count = atomic_load_explicit(&tjs_heap_counts[type], memory_order_relaxed);
+        int64_t size = atomic_load_explicit(&tjs_heap_sizes[type], memory_order_relaxed);
+        fprintf(file, "  %-24s %8" PRId64 " %10" PRId64 "\n", tjs_heap_type_names[type], count, size);
+    }
+
+    int64_t count, size;
+    dbuffer_get_usage(&count, &size);
+    fprintf(file, "  %-24s %8" PRId64 " %10" PRId64 "\n", "dbuffer", count, size);
+}
+
+///////////////////////////////////////////////////////////////
+// 堆快照
+
+/** 添加一个字符串到字符串表, 返回字符串索引 */
+static uint32_t tjs_heap_add_string(tjs_heap_snapshot_t* snapshot, const char* str)
+{
+    DynBuf* s = &snapshot->strings;
+    if (snapshot->string_count > 0) {
+        dbuf_putc(s, ',');
+    }
+
+    dbuf_putc(s, '"');
+    for (const uint8_t* p = (const uint8_t*)str; *p; p++) {
+        uint8_t c = *p;
+        if (c == '"' || c == '\\') {
+            dbuf_putc(s, '\\');
+            dbuf_putc(s, c);
+
+        } else if (c < 0x20) {
+            dbuf_printf(s, "\\u%04x", c);
+
+        } else {
+            dbuf_putc(s, c);
+        }
+    }
+
+    dbuf_putc(s, '"');
+    if (dbuf_error(s)) {
+        snapshot->error = 1;
+    }
+
+    return snapshot->string_count++;
+}
+
+static int tjs_heap_atom_map_grow(tjs_heap_snapshot_t* snapshot)
+{
+    uint32_t capacity = snapshot->atom_capacity ? snapshot->atom_capacity * 2 : 1024;
+    uint32_t* keys = calloc(capacity, sizeof(*keys));
+    uint32_t* values = calloc(capacity, sizeof(*values));
+    if (keys == NULL || values == NULL) {
+        free(keys);
+        free(values);
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < snapshot->atom_capacity; i++) {
+        uint32_t key = snapshot->atom_keys[i];
+        if (key == 0) {
+            continue;
+        }
+
+        uint32_t j = (key * 2654435761u) & (capacity - 1);
+        while (keys[j] != 0) {
+            j = (j + 1) & (capacity - 1);
+        }
+
+        keys[j] = key;
+        values[j] = snapshot->atom_values[i];
+    }
+
+    free(snapshot->atom_keys);
+    free(snapshot->atom_values);
+    snapshot->atom_keys = keys;
+    snapshot->atom_values = values;
+    snapshot->atom_capacity = capacity;
+    return 0;
+}
+
+/** 返回 atom 对应的字符串索引, 相同的 atom 只添加一次 */
+static uint32_t tjs_heap_atom_string(tjs_heap_snapshot_t* snapshot, JSAtom atom)
+{
+    if (atom == JS_ATOM_NULL) {
+        return TJS_HEAP_STRING_EMPTY;
+    }
+
+    if (snapshot->atom_count * 2 >= snapshot->atom_capacity) {
+        if (tjs_heap_atom_map_grow(snapshot) < 0) {
+            snapshot->error = 1;
+            return TJS_HEAP_STRING_EMPTY;
+        }
+    }
+
+    uint32_t key = atom + 1;
+    uint32_t mask = snapshot->atom_capacity - 1;
+    uint32_t i = (key * 2654435761u) & mask;
+    while (snapshot->atom_keys[i] != 0) {
+        if (snapshot->atom_keys[i] == key) {
+            return snapshot->atom_values[i];
+        }
+
+        i = (i + 1) & mask;
+    }
+
+    // 只转换字符串, 不会分配 GC 对象
+    const char* str = JS_AtomToCString(snapshot->ctx, atom);
+    uint32_t index = tjs_heap_add_string(snapshot, str ? str : "");
+    if (str) {
+        JS_FreeCString(snapshot->ctx, str);
+    }
+
+    snapshot->atom_keys[i] = key;
+    snapshot->atom_values[i] = index;
+    snapshot->atom_count++;
+    return index;
+}
+
+/** 根据类名决定对象在 Chrome 中显示的节点类型 */
+static uint8_t tjs_heap_class_kind(tjs_heap_snapshot_t* snapshot, JSClassID class_id)
+{
+    if (class_id >= snapshot->class_capacity) {
+        uint32_t capacity = class_id + 64;
+        uint8_t* kinds = realloc(snapshot->class_kinds, capacity);
+        if (kinds == NULL) {
+            snapshot->error = 1;
+            return TJS_HEAP_KIND_OBJECT;
+        }
+
+        memset(kinds + snapshot->class_capacity, 0xff, capacity - snapshot->class_capacity);
+        snapshot->class_kinds = kinds;
+        snapshot->class_capacity = capacity;
+    }
+
+    uint8_t kind = snapshot->class_kinds[class_id];
+    if (kind != 0xff) {
+        return kind;
+    }
+
+    kind = TJS_HEAP_KIND_OBJECT;
+    JSAtom atom = JS_GetClassNameRT(JS_GetRuntime(snapshot->ctx), class_id);
+    const char* name = atom != JS_ATOM_NULL ? JS_AtomToCString(snapshot->ctx, atom) : NULL;
+    if (name) {
+        size_t length = strlen(name);
+        if (strcmp(name, "Array") == 0) {
+            kind = TJS_HEAP_KIND_ARRAY;
+
+        } else if (strcmp(name, "RegExp") == 0) {
+            kind = TJS_HEAP_KIND_REGEXP;
+
+        } else if (length >= 8 && strcmp(name + length - 8, "Function") == 0) {
+            kind = TJS_HEAP_KIND_CLOSURE;
+        }
+
+        JS_FreeCString(snapshot->ctx, name);
+    }
+
+    snapshot->class_kinds[class_id] = kind;
+    return kind;
+}
+
+static void tjs_heap_snapshot_node(void* opaque, const JSHeapNodeInfo* info)
+{
+    tjs_heap_snapshot_t* snapshot = opaque;
+    if (snapshot->error) {
+        return;
+    }
+
+    if (snapshot->node_count >= snapshot->node_capacity) {
+        uint32_t capacity = snapshot->node_capacity ? snapshot->node_capacity * 2 : 4096;
+        tjs_heap_node_t* nodes = realloc(snapshot->nodes, capacity * sizeof(*nodes));
+        if (nodes == NULL) {
+            snapshot->error = 1;
+            return;
+        }
+
+        snapshot->nodes = nodes;
+        snapshot->node_capacity = capacity;
+    }
+
+    tjs_heap_node_t* node = &snapshot->nodes[snapshot->node_count++];
+    node->id = info->id;
+    node->size = info->size;
+    node->first_edge = snapshot->edge_count;
+    node->edge_count = 0;
+    node->valid_edges = 0;
+    node->ref_count = info->ref_count;
+    node->type = info->type;
+    node->kind = TJS_HEAP_KIND_HIDDEN;
+
+    switch (info->type) {
+    case JS_HEAP_NODE_OBJECT:
+        node->kind = tjs_heap_class_kind(snapshot, info->class_id);
+        node->name = tjs_heap_atom_string(snapshot, info->name);
+        break;
+
+    case JS_HEAP_NODE_FUNCTION_BYTECODE:
+        node->kind = TJS_HEAP_KIND_CODE;
+        node->name = info->name != JS_ATOM_NULL ? tjs_heap_atom_string(snapshot, info->name) : TJS_HEAP_STRING_BYTECODE;
+        break;
+
+    case JS_HEAP_NODE_SHAPE:
+        node->name = TJS_HEAP_STRING_SHAPE;
+        break;
+
+    case JS_HEAP_NODE_VAR_REF:
+        node->name = TJS_HEAP_STRING_VAR_REF;
+        break;
+
+    case JS_HEAP_NODE_ASYNC_FUNCTION:
+        node->name = TJS_HEAP_STRING_ASYNC_FUNCTION;
+        break;
+
+    default:
+        node->name = TJS_HEAP_STRING_CONTEXT;
+        break;
+    }
+}
+
+static void tjs_heap_snapshot_edge(void* opaque, JSHeapEdgeTypeEnum type, uint32_t name, const void* to)
+{
+    tjs_heap_snapshot_t* snapshot = opaque;
+    if (snapshot->error || snapshot->node_count == 0) {
+        return;
+    }
+
+    if (snapshot->edge_count >= snapshot->edge_capacity) {
+        uint32_t capacity = snapshot->edge_capacity ? snapshot->edge_capacity * 2 : 8192;
+        tjs_heap_edge_t* edges = realloc(snapshot->edges, capacity * sizeof(*edges));
+        if (edges == NULL) {
+            snapshot->error = 1;
+            return;
+        }
+
+        snapshot->edges = edges;
+        snapshot->edge_capacity = capacity;
+    }
+
+    tjs_heap_edge_t* edge = &snapshot->edges[snapshot->edge_count++];
+    edge->to = to;
+    if (type == JS_HEAP_EDGE_PROPERTY) {
+        edge->kind = TJS_HEAP_EDGE_PROPERTY;
+        edge->name = tjs_heap_atom_string(snapshot, name);
+
+    } else if (type == JS_HEAP_EDGE_ELEMENT) {
+        edge->kind = TJS_HEAP_EDGE_ELEMENT;
+        edge->name = name;
+
+    } else {
+        // 名称在写文件时根据两端的节点决定
+        edge->kind = TJS_HEAP_EDGE_INTERNAL;
+        edge->name = TJS_HEAP_STRING_INTERNAL;
+    }
+
+    snapshot->nodes[snapshot->node_count - 1].edge_count++;
+}
+
+static int tjs_heap_index_compare(const void* a, const void* b)
+{
+    const void* x = ((const tjs_heap_index_t*)a)->id;
+    const void* y = ((const tjs_heap_index_t*)b)->id;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+/** 返回目标节点的索引, 不存在时返回 UINT32_MAX */
+static uint32_t tjs_heap_find_node(tjs_heap_index_t* index, uint32_t count, const void* id)
+{
+    tjs_heap_index_t key = { id, 0 };
+    tjs_heap_index_t* item = bsearch(&key, index, count, sizeof(*index), tjs_heap_index_compare);
+    return item ? item->node : UINT32_MAX;
+}
+
+/** 在线程池中执行: 解析引用, 找出根节点并写入文件 */
+static int tjs_heap_snapshot_write(tjs_heap_snapshot_t* snapshot)
+{
+    uint32_t node_count = snapshot->node_count;
+    uint32_t edge_count = snapshot->edge_count;
+
+    tjs_heap_index_t* index = malloc((node_count + 1) * sizeof(*index));
+    uint32_t* targets = malloc((edge_count + 1) * sizeof(*targets));
+    uint32_t* incoming = calloc(node_count + 1, sizeof(*incoming));
+    if (index == NULL || targets == NULL || incoming == NULL) {
+        free(index);
+        free(targets);
+        free(incoming);
+        return UV_ENOMEM;
+    }
+
+    for (uint32_t i = 0; i < node_count; i++) {
+        index[i].id = snapshot->nodes[i].id;
+        index[i].node = i;
+    }
+
+    qsort(index, node_count, sizeof(*index), tjs_heap_index_compare);
+
+    // 解析引用, 没有被其他对象引用完的对象即为根对象 (和 QuickJS 的循环回收相同)
+    for (uint32_t i = 0; i < node_count; i++) {
+        tjs_heap_node_t* node = &snapshot->nodes[i];
+        uint32_t end = node->first_edge + node->edge_count;
+        for (uint32_t e = node->first_edge; e < end; e++) {
+            uint32_t target = tjs_heap_find_node(index, node_count, snapshot->edges[e].to);
+            targets[e] = target;
+            if (target != UINT32_MAX) {
+                node->valid_edges++;
+                incoming[target]++;
+            }
+        }
+
+        // 显示为 __proto__ 和 map 的内部引用
+        for (uint32_t e = node->first_edge; e < end; e++) {
+            tjs_heap_edge_t* edge = &snapshot->edges[e];
+            if (targets[e] == UINT32_MAX || edge->kind != TJS_HEAP_EDGE_INTERNAL) {
+                continue;
+            }
+
+            if (node->type == JS_HEAP_NODE_SHAPE) {
+                edge->name = TJS_HEAP_STRING_PROTO;
+
+            } else if (snapshot->nodes[targets[e]].type == JS_HEAP_NODE_SHAPE) {
+                edge->name = TJS_HEAP_STRING_MAP;
+            }
+        }
+    }
+
+    uint32_t root_count = 0;
+    for (uint32_t i = 0; i < node_count; i++) {
+        if ((uint32_t)snapshot->nodes[i].ref_count > incoming[i]) {
+            root_count++;
+        }
+    }
+
+    free(index);
+
+    int ret = 0;
+    FILE* file = fopen(snapshot->filename, "wb");
+    if (file == NULL) {
+        ret = UV_EIO;
+        goto exit;
+    }
+
+    setvbuf(file, NULL, _IOFBF, 64 * 1024);
+
+    fprintf(file, "{\"snapshot\":{\"meta\":{"
+                  "\"node_fields\":[\"type\",\"name\",\"id\",\"self_size\",\"edge_count\",\"trace_node_id\",\"detachedness\"],"
+                  "\"node_types\":[[\"hidden\",\"array\",\"string\",\"object\",\"code\",\"closure\",\"regexp\",\"number\","
+                  "\"native\",\"synthetic\",\"concatenated string\",\"sliced string\",\"symbol\",\"bigint\"],"
+                  "\"string\",\"number\",\"number\",\"number\",\"number\",\"number\"],"
+                  "\"edge_fields\":[\"type\",\"name_or_index\",\"to_node\"],"
+                  "\"edge_types\":[[\"context\",\"element\",\"property\",\"internal\",\"hidden\",\"shortcut\",\"weak\"],"
+                  "\"string_or_number\",\"node\"],"
+                  "\"trace_function_info_fields\":[\"function_id\",\"name\",\"script_name\",\"script_id\",\"line\",\"column\"],"
+                  "\"trace_node_fields\":[\"id\",\"function_info_index\",\"count\",\"size\",\"children\"],"
+                  "\"sample_fields\":[\"timestamp_us\",\"last_assigned_id\"],"
+                  "\"location_fields\":[\"object_index\",\"script_id\",\"line\",\"column\"]},");
+
+    uint64_t total_edges = root_count;
+    for (uint32_t i = 0; i < node_count; i++) {
+        total_edges += snapshot->nodes[i].valid_edges;
+    }
+
+    fprintf(file, "\"node_count\":%u,\"edge_count\":%" PRIu64 ",\"trace_function_count\":0},\n", node_count + 1, total_edges);
+
+    // 节点, 第一个为 (GC roots), 节点的 ID 由地址生成, 以便比较多个快照
+    fprintf(file, "\"nodes\":[%d,%d,1,0,%u,0,0", TJS_HEAP_KIND_SYNTHETIC, TJS_HEAP_STRING_ROOTS, root_count);
+    for (uint32_t i = 0; i < node_count; i++) {
+        tjs_heap_node_t* node = &snapshot->nodes[i];
+        uint64_t id = ((uintptr_t)node->id >> 2) | 1;
+        fprintf(file, ",\n%u,%u,%" PRIu64 ",%" PRIu64 ",%u,0,0", node->kind, node->name, id, node->size, node->valid_edges);
+    }
+
+    // 引用
+    fprintf(file, "],\n\"edges\":[");
+    const char* separator = "";
+    uint32_t root_index = 0;
+    for (uint32_t i = 0; i < node_count; i++) {
+        if ((uint32_t)snapshot->nodes[i].ref_count > incoming[i]) {
+            fprintf(file, "%s%d,%u,%u", separator, TJS_HEAP_EDGE_ELEMENT, root_index++, (i + 1) * TJS_HEAP_NODE_FIELDS);
+            separator = ",\n";
+        }
+    }
+
+    for (uint32_t i = 0; i < node_count; i++) {
+        tjs_heap_node_t* node = &snapshot->nodes[i];
+        uint32_t end = node->first_edge + node->edge_count;
+        for (uint32_t e = node->first_edge; e < end; e++) {
+            if (targets[e] == UINT32_MAX) {
+                continue;
+            }
+
+            tjs_heap_edge_t* edge = &snapshot->edges[e];
+            fprintf(file, "%s%u,%u,%u", separator, edge->kind, edge->name, (targets[e] + 1) * TJS_HEAP_NODE_FIELDS);
+            separator = ",\n";
+        }
+    }
+
+    fprintf(file, "],\n\"trace_function_infos\":[],\"trace_tree\":[],\"samples\":[],\"locations\":[],\n\"strings\":[");
+    fwrite(snapshot->strings.buf, 1, snapshot->strings.size, file);
+    fprintf(file, "]}\n");
+
+    if (ferror(file)) {
+        ret = UV_EIO;
+    }
+
+    if (fclose(file) != 0) {
+        ret = UV_EIO;
+    }
+
+exit:
+    free(targets);
+    free(incoming);
+    return ret;
+}
+
+static void tjs_heap_snapshot_free(tjs_heap_snapshot_t* snapshot)
+{
+    free(snapshot->nodes);
+    free(snapshot->edges);
+    free(snapshot->atom_keys);
+    free(snapshot->atom_values);
+    free(snapshot->class_kinds);
+    free(snapshot->filename);
+    dbuf_free(&snapshot->strings);
+    free(snapshot);
+}
+
+static void tjs_heap_snapshot_work(uv_work_t* req)
+{
+    tjs_heap_snapshot_t* snapshot = req->data;
+    snapshot->ret = tjs_heap_snapshot_write(snapshot);
+}
+
+static void tjs_heap_snapshot_after_work(uv_work_t* req, int status)
+{
+    tjs_heap_snapshot_t* snapshot = req->data;
+    CHECK_NOT_NULL(snapshot);
+
+    JSContext* ctx = snapshot->ctx;
+    int error = status != 0 ? status : snapshot->ret;
+    JSValue arg;
+    if (error < 0) {
+        arg = tjs_new_uv_error(ctx, error);
+
+    } else {
+        arg = JS_NewString(ctx, snapshot->filename);
+    }
+
+    TJS_SettlePromise(ctx, &snapshot->result, error < 0, 1, (JSValueConst*)&arg);
+    tjs_heap_snapshot_free(snapshot);
+}
+
+/**
+ * 生成堆快照并写入到指定的文件, 返回 Promise<string>
+ * - 在当前线程执行一次 GC 并遍历所有对象, 然后在线程池中写文件
+ * - 没有指定文件名时写入到当前目录下的 Heap.<date>.<time>.<pid>.heapsnapshot
+ */
+static JSValue tjs_heap_write_snapshot(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    char filename[PATH_MAX];
+    if (argc > 0 && !JS_IsUndefined(argv[0])) {
+        const char* name = JS_ToCString(ctx, argv[0]);
+        if (name == NULL) {
+            return JS_EXCEPTION;
+        }
+
+        snprintf(filename, sizeof(filename), "%s", name);
+        JS_FreeCString(ctx, name);
+
+    } else {
+        // Heap.20220101.120000.1234.heapsnapshot
+        time_t now = time(NULL);
+        struct tm* tm = localtime(&now);
+        size_t length = strftime(filename, sizeof(filename), "Heap.%Y%m%d.%H%M%S", tm);
+        snprintf(filename + length, sizeof(filename) - length, ".%d.heapsnapshot", (int)uv_os_getpid());
+    }
+
+    tjs_heap_snapshot_t* snapshot = calloc(1, sizeof(*snapshot));
+    if (snapshot == NULL) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    snapshot->ctx = ctx;
+    snapshot->req.data = snapshot;
+    snapshot->filename = strdup(filename);
+    dbuf_init(&snapshot->strings);
+    for (int i = 0; i < TJS_HEAP_STRING_COUNT; i++) {
+        tjs_heap_add_string(snapshot, tjs_heap_strings[i]);
+    }
+
+    // 先回收循环引用的对象, 快照中只包含存活的对象
+    JSRuntime* rt = JS_GetRuntime(ctx);
+    JS_RunGC(rt);
+
+    JSHeapVisitor visitor = { 0 };
+    visitor.node = tjs_heap_snapshot_node;
+    visitor.edge = tjs_heap_snapshot_edge;
+    visitor.opaque = snapshot;
+    JS_VisitHeap(rt, &visitor);
+
+    // 散列表只在遍历时使用
+    free(snapshot->atom_keys);
+    free(snapshot->atom_values);
+    free(snapshot->class_kinds);
+    snapshot->atom_keys = NULL;
+    snapshot->atom_values = NULL;
+    snapshot->class_kinds = NULL;
+
+    if (snapshot->error || snapshot->filename == NULL) {
+        tjs_heap_snapshot_free(snapshot);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    int ret = uv_queue_work(TJS_GetLoop(ctx), &snapshot->req, tjs_heap_snapshot_work, tjs_heap_snapshot_after_work);
+    if (ret != 0) {
+        tjs_heap_snapshot_free(snapshot);
+        return tjs_throw_uv_error(ctx, ret);
+    }
+
+    return TJS_InitPromise(ctx, &snapshot->result);
+}
+
+static const JSCFunctionListEntry tjs_heap_funcs[] = {
+    TJS_CFUNC_DEF("getStatistics", 0, tjs_heap_get_statistics),
+    TJS_CFUNC_DEF("writeSnapshot", 1, tjs_heap_write_snapshot),
+};
+
+void tjs_mod_heap_init(JSContext* ctx, JSModuleDef* m)
+{
+    TJS_ExportModuleObject(ctx, m, "heap", tjs_heap_funcs);
+}
+
+void tjs_mod_heap_export(JSContext* ctx, JSModuleDef* m)
+{
+    JS_AddModuleExport(ctx, m, "heap");
+}
@@ -37,6 +37,8 @@ typedef struct tjs_http_parser_s {
 } TJSHttpParser;
 
 static JSClassID tjs_http_parser_class_id;
+
+extern void tjs_mod_http_server_init(JSContext* ctx, JSValue http);
 typedef enum http_parser_type tjs_http_parser_type;
 
 static void tjs_http_parser_finalizer(JSRuntime* runtime, JSValue val)
@@ -474,6 +476,7 @@ void tjs_mod_http_init(JSContext* ctx, JSModuleDef* module)
     TJS_SetPropertyValue(ctx, http, "RESPONSE", JS_NewUint32(ctx, HTTP_RESPONSE));
     TJS_SetPropertyValue(ctx, http, "BOTH", JS_NewUint32(ctx, HTTP_BOTH));
     TJS_SetPropertyValue(ctx, http, "Parser", parserClass);
+    tjs_mod_http_server_init(ctx, http);
     JS_SetModuleExport(ctx, module, "http", http);
 }
 
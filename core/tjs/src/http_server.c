@@ -0,0 +1,1436 @@
+/* HTTP server object */
+#include "private.h"
+#include "tjs-utils.h"
+
+#include "streams.h"
+
+#include "http_parser.h"
+#include "util/dbuffer.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+/** 每个请求最多保存的消息头数 */
+#define HTTP_SERVER_HEADER_MAX 64
+
+/** 连接读缓存区大小 */
+#define HTTP_SERVER_READ_SIZE 65536
+
+/** 默认长连接空闲超时时间 (毫秒) */
+#define HTTP_SERVER_KEEP_ALIVE_TIMEOUT 60000
+
+/** 默认最大请求消息体长度 */
+#define HTTP_SERVER_MAX_BODY_SIZE (8 * 1024 * 1024)
+
+/** 默认每个连接最多排队等待应答的请求数 (pipelining) */
+#define HTTP_SERVER_MAX_PIPELINE 32
+
+/** 小于这个长度的应答消息体直接复制到消息头缓存区，合并为一次写操作 */
+#define HTTP_SERVER_INLINE_BODY_SIZE 4096
+
+enum tjs_http_server_event_enum {
+    HTTP_SERVER_EVENT_REQUEST = 0,
+    HTTP_SERVER_EVENT_ERROR,
+    HTTP_SERVER_EVENT_MAX,
+};
+
+enum tjs_http_request_state_enum {
+    HTTP_REQUEST_STATE_PENDING = 0, // 等待 JS 应答
+    HTTP_REQUEST_STATE_READY, // 应答已生成，等待前面的应答发送完成
+    HTTP_REQUEST_STATE_WRITING, // 正在发送
+    HTTP_REQUEST_STATE_DONE, // 已完成或连接已关闭
+};
+
+typedef struct tjs_http_server_s TJSHttpServer;
+typedef struct tjs_http_connection_s TJSHttpConnection;
+
+/** 被固定 (pin) 的应答消息体数据块 */
+typedef struct tjs_http_chunk_s {
+    JSValue value;
+    const char* string;
+    uv_buf_t buf;
+} TJSHttpChunk;
+
+typedef struct tjs_http_request_s {
+    struct list_head link;
+    JSContext* ctx;
+
+    /** 所属的连接，连接关闭或应答发送完成后为 NULL */
+    TJSHttpConnection* connection;
+    uv_write_t req;
+    int state;
+
+    /** 相关的 JS 对象是否还存在 */
+    int has_object;
+    int keep_alive;
+    int is_head;
+
+    /** 状态行和消息头 (以及较小的消息体) */
+    dbuffer_t head;
+    TJSHttpChunk* chunks;
+    uint32_t chunk_count;
+} TJSHttpRequest;
+
+struct tjs_http_connection_s {
+    struct list_head link;
+    TJSHttpServer* server;
+    uv_tcp_t tcp;
+    uv_timer_t timer;
+    http_parser parser;
+
+    /** 当前请求的 URL */
+    dbuffer_t url;
+
+    /** 当前请求的消息头，名称和值都以 '\0' 结尾 */
+    dbuffer_t fields;
+    uint32_t headers[HTTP_SERVER_HEADER_MAX][2];
+    uint32_t header_count;
+    int header_state;
+
+    /** 当前请求的消息体 */
+    dbuffer_t body;
+    int error_status;
+
+    /** 按接收顺序排列的还未发送应答的请求 */
+    struct list_head requests;
+    uint32_t pending_count;
+
+    /** 正在发送中的应答 */
+    struct list_head writes;
+    uint32_t write_count;
+
+    int closing;
+    int close_count;
+    int reading;
+
+    /** 当前应答发送完后关闭连接 */
+    int shutdown;
+};
+
+struct tjs_http_server_s {
+    JSContext* ctx;
+    uv_tcp_t tcp;
+    JSValue events[HTTP_SERVER_EVENT_MAX];
+    struct list_head connections;
+    uint32_t connection_count;
+
+    int closing;
+    int closed;
+    int finalized;
+
+    uint32_t keep_alive_timeout;
+    uint32_t max_body_size;
+    uint32_t max_pipeline;
+
+    uint64_t total_connections;
+    uint64_t total_requests;
+
+    /** 缓存的 Date 消息头, 每秒更新一次 */
+    time_t date_time;
+    char date[64];
+
+    /** 所有连接共用的读缓存区 (事件循环是单线程的) */
+    char read_buffer[HTTP_SERVER_READ_SIZE];
+};
+
+static JSClassID tjs_http_server_class_id;
+static JSClassID tjs_http_request_class_id;
+
+static void tjs_http_connection_close(TJSHttpConnection* connection);
+static void tjs_http_connection_flush(TJSHttpConnection* connection);
+static void tjs_http_server_maybe_free(TJSHttpServer* server);
+
+// ////////////////////////////////////////////////////////////////////////////
+// request
+
+static void tjs_http_request_release_chunks(TJSHttpRequest* request)
+{
+    JSContext* ctx = request->ctx;
+    for (uint32_t i = 0; i < request->chunk_count; i++) {
+        TJSHttpChunk* chunk = &request->chunks[i];
+        if (chunk->string) {
+            JS_FreeCString(ctx, chunk->string);
+        }
+
+        JS_FreeValue(ctx, chunk->value);
+    }
+
+    if (request->chunks) {
+        js_free(ctx, request->chunks);
+        request->chunks = NULL;
+    }
+
+    request->chunk_count = 0;
+}
+
+static void tjs_http_request_maybe_free(TJSHttpRequest* request)
+{
+    if (request->has_object || request->connection) {
+        return;
+    }
+
+    tjs_http_request_release_chunks(request);
+    dbuffer_free(&request->head);
+    free(request);
+}
+
+static void tjs_http_request_write_callback(uv_write_t* req, int status)
+{
+    TJSHttpRequest* request = req->data;
+    CHECK_NOT_NULL(request);
+
+    TJSHttpConnection* connection = request->connection;
+    CHECK_NOT_NULL(connection);
+
+    list_del(&request->link);
+    request->state = HTTP_REQUEST_STATE_DONE;
+    request->connection = NULL;
+    tjs_http_request_release_chunks(request);
+    dbuffer_free(&request->head);
+    tjs_http_request_maybe_free(request);
+
+    connection->write_count--;
+    if (connection->closing) {
+        return;
+
+    } else if (status < 0) {
+        tjs_http_connection_close(connection);
+
+    } else if (connection->shutdown && connection->write_count == 0 && connection->pending_count == 0) {
+        tjs_http_connection_close(connection);
+
+    } else {
+        tjs_http_connection_flush(connection);
+    }
+}
+
+static const char* tjs_http_server_get_date(TJSHttpServer* server)
+{
+    time_t now = time(NULL);
+    if (now != server->date_time) {
+        struct tm tm;
+        gmtime_r(&now, &tm);
+        strftime(server->date, sizeof(server->date), "%a, %d %b %Y %H:%M:%S GMT", &tm);
+        server->date_time = now;
+    }
+
+    return server->date;
+}
+
+/** 是否是 RFC 7230 定义的 token, 即合法的消息头名称 */
+static bool tjs_http_is_token(const char* str, size_t length)
+{
+    if (length == 0) {
+        return false;
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        char ch = str[i];
+        if ((ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z')) {
+            continue;
+
+        } else if (ch == '\0' || strchr("!#$%&'*+-.^_`|~", ch) == NULL) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/** 消息头的值和状态描述不能包含 CR, LF 和 NUL, 以免被用来拆分应答 */
+static bool tjs_http_is_field_value(const char* str, size_t length)
+{
+    for (size_t i = 0; i < length; i++) {
+        char ch = str[i];
+        if (ch == '\r' || ch == '\n' || ch == '\0') {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * 添加一个应答消息头
+ * @returns 消息头的类型: 1 content-length, 2 connection, 3 date, 4 transfer-encoding, 0 其他
+ */
+static int tjs_http_request_put_header(TJSHttpRequest* request, const char* name, size_t name_length, const char* value, size_t value_length)
+{
+    int type = 0;
+    if (name_length == 14 && strncasecmp(name, "content-length", 14) == 0) {
+        type = 1;
+
+    } else if (name_length == 10 && strncasecmp(name, "connection", 10) == 0) {
+        type = 2;
+        if (value_length >= 5 && strncasecmp(value, "close", 5) == 0) {
+            request->keep_alive = 0;
+        }
+
+    } else if (name_length == 4 && strncasecmp(name, "date", 4) == 0) {
+        type = 3;
+
+    } else if (name_length == 17 && strncasecmp(name, "transfer-encoding", 17) == 0) {
+        // 应答消息体总是一次性提供的，不使用 chunked 编码
+        return 4;
+    }
+
+    dbuffer_t* head = &request->head;
+    dbuffer_put(head, (const uint8_t*)name, name_length);
+    dbuffer_put(head, (const uint8_t*)": ", 2);
+    dbuffer_put(head, (const uint8_t*)value, value_length);
+    dbuffer_put(head, (const uint8_t*)"\r\n", 2);
+    return type;
+}
+
+static int tjs_http_request_put_header_value(JSContext* ctx, TJSHttpRequest* request, JSValueConst name, JSValueConst value, int* flags)
+{
+    size_t name_length = 0, value_length = 0;
+    const char* name_str = JS_ToCStringLen(ctx, &name_length, name);
+    if (!name_str) {
+        return -1;
+    }
+
+    const char* value_str = JS_ToCStringLen(ctx, &value_length, value);
+    if (!value_str) {
+        JS_FreeCString(ctx, name_str);
+        return -1;
+    }
+
+    int ret = 0;
+    if (!tjs_http_is_token(name_str, name_length)) {
+        JS_ThrowTypeError(ctx, "Invalid header name: '%s'", name_str);
+        ret = -1;
+
+    } else if (!tjs_http_is_field_value(value_str, value_length)) {
+        JS_ThrowTypeError(ctx, "Invalid value of header '%s'", name_str);
+        ret = -1;
+
+    } else {
+        int type = tjs_http_request_put_header(request, name_str, name_length, value_str, value_length);
+        *flags |= (1 << type);
+    }
+
+    JS_FreeCString(ctx, name_str);
+    JS_FreeCString(ctx, value_str);
+    return ret;
+}
+
+/**
+ * 序列化应答消息头
+ * @param headers `[[name, value], ...]` 或 `{ name: value }`
+ * @returns 出现过的消息头类型的位标记，出错返回 -1
+ */
+static int tjs_http_request_put_headers(JSContext* ctx, TJSHttpRequest* request, JSValueConst headers)
+{
+    int flags = 0;
+    if (JS_IsUndefined(headers) || JS_IsNull(headers)) {
+        return flags;
+    }
+
+    if (JS_IsArray(ctx, headers)) {
+        uint32_t length = TJS_GetPropertyUint32(ctx, headers, "length", 0);
+        for (uint32_t i = 0; i < length; i++) {
+            JSValue item = JS_GetPropertyUint32(ctx, headers, i);
+            JSValue name = JS_GetPropertyUint32(ctx, item, 0);
+            JSValue value = JS_GetPropertyUint32(ctx, item, 1);
+            int ret = tjs_http_request_put_header_value(ctx, request, name, value, &flags);
+            JS_FreeValue(ctx, name);
+            JS_FreeValue(ctx, value);
+            JS_FreeValue(ctx, item);
+
+            if (ret < 0) {
+                return -1;
+            }
+        }
+
+        return flags;
+    }
+
+    JSPropertyEnum* tab = NULL;
+    uint32_t length = 0;
+    if (JS_GetOwnPropertyNames(ctx, &tab, &length, headers, JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY)) {
+        return -1;
+    }
+
+    int ret = 0;
+    for (uint32_t i = 0; i < length; i++) {
+        JSValue name = JS_AtomToString(ctx, tab[i].atom);
+        JSValue value = JS_GetProperty(ctx, headers, tab[i].atom);
+        ret = tjs_http_request_put_header_value(ctx, request, name, value, &flags);
+        JS_FreeValue(ctx, name);
+        JS_FreeValue(ctx, value);
+
+        if (ret < 0) {
+            break;
+        }
+    }
+
+    JS_FreePropEnum(ctx, tab, length);
+    return ret < 0 ? -1 : flags;
+}
+
+static int tjs_http_request_put_chunk(JSContext* ctx, TJSHttpChunk* chunk, JSValueConst value)
+{
+    chunk->value = JS_UNDEFINED;
+    chunk->string = NULL;
+
+    tjs_buffer_t buffer = TJS_ToArrayBuffer(ctx, value);
+    if (JS_IsException(buffer.error) || buffer.data == NULL) {
+        JS_ThrowTypeError(ctx, "The body is not of type '(string or ArrayBuffer or ArrayBufferView)'");
+        return -1;
+    }
+
+    if (buffer.is_string) {
+        chunk->string = (const char*)buffer.data;
+
+    } else {
+        chunk->value = JS_DupValue(ctx, value);
+    }
+
+    chunk->buf = uv_buf_init((char*)buffer.data, buffer.length);
+    return 0;
+}
+
+/**
+ * 固定应答消息体
+ * @param body string | ArrayBuffer | ArrayBufferView 或它们组成的数组
+ * @returns 消息体总长度，出错返回 -1
+ */
+static ssize_t tjs_http_request_put_body(JSContext* ctx, TJSHttpRequest* request, JSValueConst body)
+{
+    if (JS_IsUndefined(body) || JS_IsNull(body)) {
+        return 0;
+    }
+
+    uint32_t count = 1;
+    int is_array = JS_IsArray(ctx, body);
+    if (is_array) {
+        count = TJS_GetPropertyUint32(ctx, body, "length", 0);
+        if (count == 0) {
+            return 0;
+        }
+    }
+
+    request->chunks = js_mallocz(ctx, sizeof(TJSHttpChunk) * count);
+    if (!request->chunks) {
+        return -1;
+    }
+
+    ssize_t total = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        TJSHttpChunk* chunk = &request->chunks[i];
+        int ret;
+        if (is_array) {
+            JSValue item = JS_GetPropertyUint32(ctx, body, i);
+            ret = tjs_http_request_put_chunk(ctx, chunk, item);
+            JS_FreeValue(ctx, item);
+
+        } else {
+            ret = tjs_http_request_put_chunk(ctx, chunk, body);
+        }
+
+        if (ret < 0) {
+            return -1;
+        }
+
+        request->chunk_count++;
+        total += chunk->buf.len;
+    }
+
+    return total;
+}
+
+static void tjs_http_request_put_status(TJSHttpRequest* request, int status, const char* status_text)
+{
+    char line[64];
+    if (status_text == NULL) {
+        status_text = http_status_str(status);
+    }
+
+    int length = snprintf(line, sizeof(line), "HTTP/1.1 %d ", status);
+    dbuffer_put(&request->head, (const uint8_t*)line, length);
+    dbuffer_putstr(&request->head, status_text);
+    dbuffer_put(&request->head, (const uint8_t*)"\r\n", 2);
+}
+
+/**
+ * 添加默认的消息头并结束消息头部分
+ */
+static void tjs_http_request_end_headers(TJSHttpRequest* request, int status, int flags, size_t body_length)
+{
+    char line[64];
+    dbuffer_t* head = &request->head;
+
+    // 1xx, 204 和 304 应答没有消息体
+    int has_body = !(status < 200 || status == 204 || status == 304);
+    if (has_body && !(flags & (1 << 1))) {
+        int length = snprintf(line, sizeof(line), "Content-Length: %zu\r\n", body_length);
+        dbuffer_put(head, (const uint8_t*)line, length);
+    }
+
+    if (!(flags & (1 << 3))) {
+        TJSHttpConnection* connection = request->connection;
+        dbuffer_putstr(head, "Date: ");
+        dbuffer_putstr(head, tjs_http_server_get_date(connection->server));
+        dbuffer_put(head, (const uint8_t*)"\r\n", 2);
+    }
+
+    if (!(flags & (1 << 2))) {
+        if (request->keep_alive) {
+            dbuffer_putstr(head, "Connection: keep-alive\r\n");
+
+        } else {
+            dbuffer_putstr(head, "Connection: close\r\n");
+        }
+    }
+
+    dbuffer_put(head, (const uint8_t*)"\r\n", 2);
+
+    // 合并较小的消息体, 只需要一次写操作
+    if (request->is_head || !has_body) {
+        tjs_http_request_release_chunks(request);
+
+    } else if (body_length <= HTTP_SERVER_INLINE_BODY_SIZE) {
+        for (uint32_t i = 0; i < request->chunk_count; i++) {
+            uv_buf_t* buf = &request->chunks[i].buf;
+            dbuffer_put(head, (const uint8_t*)buf->base, buf->len);
+        }
+
+        tjs_http_request_release_chunks(request);
+    }
+}
+
+/**
+ * 生成一个不带消息体的应答 (用于错误应答)
+ */
+static void tjs_http_request_set_status(TJSHttpRequest* request, int status)
+{
+    request->keep_alive = 0;
+    tjs_http_request_put_status(request, status, NULL);
+    tjs_http_request_end_headers(request, status, 0, 0);
+    request->state = HTTP_REQUEST_STATE_READY;
+}
+
+static void tjs_http_request_finalizer(JSRuntime* runtime, JSValue val)
+{
+    TJSHttpRequest* request = JS_GetOpaque(val, tjs_http_request_class_id);
+    if (request == NULL) {
+        return;
+    }
+
+    request->has_object = 0;
+
+    // JS 已不能再应答这个请求了，返回 500 以免客户端一直等待
+    TJSHttpConnection* connection = request->connection;
+    if (connection && request->state == HTTP_REQUEST_STATE_PENDING) {
+        tjs_http_request_set_status(request, 500);
+        tjs_http_connection_flush(connection);
+
+    } else {
+        tjs_http_request_maybe_free(request);
+    }
+}
+
+static JSClassDef tjs_http_request_class = {
+    "HTTPServerRequest",
+    .finalizer = tjs_http_request_finalizer,
+};
+
+static TJSHttpRequest* tjs_http_request_get(JSContext* ctx, JSValueConst obj)
+{
+    return JS_GetOpaque2(ctx, obj, tjs_http_request_class_id);
+}
+
+/**
+ * 应答这个请求
+ * `respond(status, headers, body, statusText)`
+ * @returns 如果连接已关闭返回 false
+ */
+static JSValue tjs_http_request_respond(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSHttpRequest* request = tjs_http_request_get(ctx, this_val);
+    if (!request) {
+        return JS_EXCEPTION;
+    }
+
+    TJSHttpConnection* connection = request->connection;
+    if (connection == NULL) {
+        return JS_FALSE;
+
+    } else if (request->state != HTTP_REQUEST_STATE_PENDING) {
+        return JS_ThrowTypeError(ctx, "The request has already been responded");
+    }
+
+    int status = 200;
+    if (argc > 0) {
+        status = TJS_ToInt32(ctx, argv[0], 200);
+    }
+
+    if (status < 100 || status > 999) {
+        return JS_ThrowRangeError(ctx, "Invalid status code: %d", status);
+    }
+
+    const char* status_text = NULL;
+    if (argc > 3 && JS_IsString(argv[3])) {
+        size_t status_text_length = 0;
+        status_text = JS_ToCStringLen(ctx, &status_text_length, argv[3]);
+        if (!status_text) {
+            return JS_EXCEPTION;
+
+        } else if (!tjs_http_is_field_value(status_text, status_text_length)) {
+            JS_FreeCString(ctx, status_text);
+            return JS_ThrowTypeError(ctx, "Invalid status text");
+        }
+    }
+
+    tjs_http_request_put_status(request, status, status_text);
+    if (status_text) {
+        JS_FreeCString(ctx, status_text);
+    }
+
+    int flags = tjs_http_request_put_headers(ctx, request, argc > 1 ? argv[1] : JS_UNDEFINED);
+    ssize_t body_length = 0;
+    if (flags >= 0) {
+        body_length = tjs_http_request_put_body(ctx, request, argc > 2 ? argv[2] : JS_UNDEFINED);
+    }
+
+    if (flags < 0 || body_length < 0) {
+        tjs_http_request_release_chunks(request);
+        request->head.size = 0;
+        return JS_EXCEPTION;
+    }
+
+    tjs_http_request_end_headers(request, status, flags, body_length);
+    request->state = HTTP_REQUEST_STATE_READY;
+
+    tjs_http_connection_flush(connection);
+    return JS_TRUE;
+}
+
+static const JSCFunctionListEntry tjs_http_request_proto_funcs[] = {
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "HTTPServerRequest", JS_PROP_CONFIGURABLE),
+    TJS_CFUNC_DEF("respond", 4, tjs_http_request_respond),
+};
+
+// ////////////////////////////////////////////////////////////////////////////
+// connection
+
+static void tjs_http_connection_close_callback(uv_handle_t* handle)
+{
+    TJSHttpConnection* connection = handle->data;
+    CHECK_NOT_NULL(connection);
+
+    connection->close_count--;
+    if (connection->close_count > 0) {
+        return;
+    }
+
+    TJSHttpServer* server = connection->server;
+    dbuffer_free(&connection->url);
+    dbuffer_free(&connection->fields);
+    dbuffer_free(&connection->body);
+    free(connection);
+
+    server->connection_count--;
+    tjs_http_server_maybe_free(server);
+}
+
+/** 断开所有还未应答的请求 */
+static void tjs_http_connection_detach(TJSHttpConnection* connection)
+{
+    struct list_head *el, *el1;
+    list_for_each_safe(el, el1, &connection->requests)
+    {
+        TJSHttpRequest* request = list_entry(el, TJSHttpRequest, link);
+        list_del(&request->link);
+        request->connection = NULL;
+        request->state = HTTP_REQUEST_STATE_DONE;
+        tjs_http_request_maybe_free(request);
+    }
+
+    connection->pending_count = 0;
+
+    // 连接关闭后不会再访问这些数据, 这里提前释放 (运行时销毁时 write 回调晚于 JSContext 的释放)
+    list_for_each(el, &connection->writes)
+    {
+        TJSHttpRequest* request = list_entry(el, TJSHttpRequest, link);
+        tjs_http_request_release_chunks(request);
+        dbuffer_free(&request->head);
+    }
+}
+
+static void tjs_http_connection_close(TJSHttpConnection* connection)
+{
+    if (connection->closing) {
+        return;
+    }
+
+    connection->closing = 1;
+    connection->reading = 0;
+    tjs_http_connection_detach(connection);
+    list_del(&connection->link);
+
+    connection->close_count = 2;
+    uv_close((uv_handle_t*)&connection->tcp, tjs_http_connection_close_callback);
+    uv_close((uv_handle_t*)&connection->timer, tjs_http_connection_close_callback);
+}
+
+static void tjs_http_connection_timer_callback(uv_timer_t* handle)
+{
+    TJSHttpConnection* connection = handle->data;
+    CHECK_NOT_NULL(connection);
+
+    tjs_http_connection_close(connection);
+}
+
+static void tjs_http_connection_read_alloc_callback(uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf)
+{
+    TJSHttpConnection* connection = handle->data;
+    CHECK_NOT_NULL(connection);
+
+    TJSHttpServer* server = connection->server;
+    *buf = uv_buf_init(server->read_buffer, sizeof(server->read_buffer));
+}
+
+static void tjs_http_connection_read_callback(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf);
+
+/** 空闲的连接超时后自动关闭 */
+static void tjs_http_connection_start_timer(TJSHttpConnection* connection)
+{
+    uint32_t timeout = connection->server->keep_alive_timeout;
+    if (timeout > 0) {
+        uv_timer_start(&connection->timer, tjs_http_connection_timer_callback, timeout, 0);
+    }
+}
+
+static void tjs_http_connection_read_start(TJSHttpConnection* connection)
+{
+    if (connection->reading || connection->closing || connection->shutdown) {
+        return;
+    }
+
+    connection->reading = 1;
+    uv_read_start((uv_stream_t*)&connection->tcp, tjs_http_connection_read_alloc_callback, tjs_http_connection_read_callback);
+}
+
+static void tjs_http_connection_read_stop(TJSHttpConnection* connection)
+{
+    if (connection->reading) {
+        connection->reading = 0;
+        uv_read_stop((uv_stream_t*)&connection->tcp);
+    }
+}
+
+/**
+ * 按请求的顺序发送已就绪的应答
+ */
+static void tjs_http_connection_flush(TJSHttpConnection* connection)
+{
+    if (connection->closing) {
+        return;
+    }
+
+    while (!list_empty(&connection->requests)) {
+        TJSHttpRequest* request = list_entry(connection->requests.next, TJSHttpRequest, link);
+        if (request->state != HTTP_REQUEST_STATE_READY) {
+            break;
+        }
+
+        list_del(&request->link);
+        connection->pending_count--;
+
+        uv_buf_t small_bufs[8];
+        uv_buf_t* bufs = small_bufs;
+        uint32_t nbufs = request->chunk_count + 1;
+        if (nbufs > countof(small_bufs)) {
+            bufs = malloc(sizeof(uv_buf_t) * nbufs);
+            CHECK_NOT_NULL(bufs);
+        }
+
+        bufs[0] = uv_buf_init((char*)request->head.buf, request->head.size);
+        for (uint32_t i = 0; i < request->chunk_count; i++) {
+            bufs[i + 1] = request->chunks[i].buf;
+        }
+
+        request->state = HTTP_REQUEST_STATE_WRITING;
+        request->req.data = request;
+        int ret = uv_write(&request->req, (uv_stream_t*)&connection->tcp, bufs, nbufs, tjs_http_request_write_callback);
+        if (bufs != small_bufs) {
+            free(bufs);
+        }
+
+        if (ret != 0) {
+            request->state = HTTP_REQUEST_STATE_DONE;
+            request->connection = NULL;
+            tjs_http_request_maybe_free(request);
+            tjs_http_connection_close(connection);
+            return;
+        }
+
+        list_add_tail(&request->link, &connection->writes);
+        connection->write_count++;
+
+        if (!request->keep_alive) {
+            // 后面的请求都不再处理了
+            connection->shutdown = 1;
+            tjs_http_connection_read_stop(connection);
+            tjs_http_connection_detach(connection);
+            break;
+        }
+    }
+
+    if (connection->shutdown) {
+        if (connection->write_count == 0 && connection->pending_count == 0) {
+            tjs_http_connection_close(connection);
+        }
+
+        return;
+    }
+
+    // pipelining 背压: 排队的请求减少后恢复读取
+    if (connection->pending_count < connection->server->max_pipeline) {
+        tjs_http_connection_read_start(connection);
+    }
+
+    // 空闲时开始计时
+    if (connection->pending_count == 0 && connection->write_count == 0) {
+        tjs_http_connection_start_timer(connection);
+    }
+}
+
+/**
+ * 应答一个错误并在发送后关闭连接
+ */
+static void tjs_http_connection_error(TJSHttpConnection* connection, int status)
+{
+    tjs_http_connection_read_stop(connection);
+
+    TJSHttpRequest* request = calloc(1, sizeof(*request));
+    CHECK_NOT_NULL(request);
+
+    request->ctx = connection->server->ctx;
+    request->connection = connection;
+    dbuffer_init(&request->head);
+    tjs_http_request_set_status(request, status);
+
+    list_add_tail(&request->link, &connection->requests);
+    connection->pending_count++;
+    tjs_http_connection_flush(connection);
+}
+
+static void tjs_http_connection_reset_message(TJSHttpConnection* connection)
+{
+    connection->url.size = 0;
+    connection->fields.size = 0;
+    connection->header_count = 0;
+    connection->header_state = 0;
+    connection->body.size = 0;
+}
+
+static int tjs_http_connection_on_message_begin(http_parser* parser)
+{
+    TJSHttpConnection* connection = parser->data;
+    tjs_http_connection_reset_message(connection);
+    return 0;
+}
+
+static int tjs_http_connection_on_url(http_parser* parser, const char* at, size_t length)
+{
+    TJSHttpConnection* connection = parser->data;
+    dbuffer_put(&connection->url, (const uint8_t*)at, length);
+    return 0;
+}
+
+static int tjs_http_connection_on_header_field(http_parser* parser, const char* at, size_t length)
+{
+    TJSHttpConnection* connection = parser->data;
+    dbuffer_t* fields = &connection->fields;
+
+    if (connection->header_state != 1) {
+        connection->header_state = 1;
+        if (connection->header_count >= HTTP_SERVER_HEADER_MAX) {
+            connection->error_status = 431;
+            return -1;
+        }
+
+        if (connection->header_count > 0) {
+            dbuffer_putc(fields, 0);
+        }
+
+        uint32_t index = connection->header_count++;
+        connection->headers[index][0] = fields->size;
+        connection->headers[index][1] = 0;
+    }
+
+    dbuffer_put(fields, (const uint8_t*)at, length);
+    return 0;
+}
+
+static int tjs_http_connection_on_header_value(http_parser* parser, const char* at, size_t length)
+{
+    TJSHttpConnection* connection = parser->data;
+    dbuffer_t* fields = &connection->fields;
+
+    if (connection->header_state != 2) {
+        connection->header_state = 2;
+        dbuffer_putc(fields, 0);
+        connection->headers[connection->header_count - 1][1] = fields->size;
+    }
+
+    dbuffer_put(fields, (const uint8_t*)at, length);
+    return 0;
+}
+
+static int tjs_http_connection_on_headers_complete(http_parser* parser)
+{
+    TJSHttpConnection* connection = parser->data;
+    dbuffer_putc(&connection->fields, 0);
+    connection->header_state = 3;
+
+    if (parser->upgrade) {
+        connection->error_status = 501;
+        return -1;
+    }
+
+    if (parser->content_length != ULLONG_MAX && parser->content_length > connection->server->max_body_size) {
+        connection->error_status = 413;
+        return -1;
+    }
+
+    return 0;
+}
+
+static int tjs_http_connection_on_body(http_parser* parser, const char* at, size_t length)
+{
+    TJSHttpConnection* connection = parser->data;
+    if (connection->body.size + length > connection->server->max_body_size) {
+        connection->error_status = 413;
+        return -1;
+    }
+
+    dbuffer_put(&connection->body, (const uint8_t*)at, length);
+    return 0;
+}
+
+static void tjs_http_server_free_buffer(JSRuntime* rt, void* opaque, void* ptr)
+{
+    free(ptr);
+}
+
+static JSValue tjs_http_connection_new_request(TJSHttpConnection* connection, TJSHttpRequest* request)
+{
+    JSContext* ctx = connection->server->ctx;
+    http_parser* parser = &connection->parser;
+
+    JSValue obj = JS_NewObjectClass(ctx, tjs_http_request_class_id);
+    if (JS_IsException(obj)) {
+        return obj;
+    }
+
+    // method & url
+    TJS_SetPropertyValue(ctx, obj, "method", JS_NewInt32(ctx, parser->method));
+    TJS_SetPropertyValue(ctx, obj, "url", JS_NewStringLen(ctx, (char*)connection->url.buf, connection->url.size));
+
+    // headers
+    JSValue headers = JS_NewArray(ctx);
+    const char* fields = (const char*)connection->fields.buf;
+    for (uint32_t i = 0; i < connection->header_count; i++) {
+        uint32_t* header = connection->headers[i];
+        JSValue element = JS_NewArray(ctx);
+        TJS_SetElementValue(ctx, element, 0, JS_NewString(ctx, fields + header[0]));
+        TJS_SetElementValue(ctx, element, 1, JS_NewString(ctx, header[1] ? fields + header[1] : ""));
+        TJS_SetElementValue(ctx, headers, i, element);
+    }
+
+    TJS_SetPropertyValue(ctx, obj, "headers", headers);
+
+    // body, 直接转移缓存区的所有权
+    if (connection->body.size > 0) {
+        size_t size = 0;
+        uint8_t* data = dbuffer_detach(&connection->body, &size);
+        JSValue value = JS_NewArrayBuffer(ctx, data, size, tjs_http_server_free_buffer, NULL, false);
+        TJS_SetPropertyValue(ctx, obj, "body", value);
+    }
+
+    TJS_SetPropertyValue(ctx, obj, "httpMajor", JS_NewInt32(ctx, parser->http_major));
+    TJS_SetPropertyValue(ctx, obj, "httpMinor", JS_NewInt32(ctx, parser->http_minor));
+    TJS_SetPropertyValue(ctx, obj, "keepAlive", JS_NewBool(ctx, request->keep_alive));
+
+    JS_SetOpaque(obj, request);
+    request->has_object = 1;
+    return obj;
+}
+
+static int tjs_http_connection_on_message_complete(http_parser* parser)
+{
+    TJSHttpConnection* connection = parser->data;
+    TJSHttpServer* server = connection->server;
+    JSContext* ctx = server->ctx;
+
+    TJSHttpRequest* request = calloc(1, sizeof(*request));
+    CHECK_NOT_NULL(request);
+
+    request->ctx = ctx;
+    request->connection = connection;
+    request->keep_alive = http_should_keep_alive(parser) && !server->closing;
+    request->is_head = (parser->method == HTTP_HEAD);
+    dbuffer_init(&request->head);
+
+    list_add_tail(&request->link, &connection->requests);
+    connection->pending_count++;
+    server->total_requests++;
+
+    JSValue obj = tjs_http_connection_new_request(connection, request);
+    tjs_http_connection_reset_message(connection);
+
+    if (JS_IsException(obj)) {
+        TJS_DumpError(ctx);
+        tjs_http_request_set_status(request, 500);
+        tjs_http_connection_flush(connection);
+
+    } else if (!JS_IsFunction(ctx, server->events[HTTP_SERVER_EVENT_REQUEST])) {
+        JS_FreeValue(ctx, obj);
+
+    } else {
+        TJS_EmitEvent(ctx, server->events[HTTP_SERVER_EVENT_REQUEST], obj);
+    }
+
+    // 连接已关闭或不再接收后续请求
+    if (connection->closing || connection->shutdown) {
+        return -1;
+    }
+
+    if (!request->keep_alive) {
+        // 还未应答的 `Connection: close` 请求之后的请求都忽略
+        return -1;
+    }
+
+    return 0;
+}
+
+static const struct http_parser_settings tjs_http_connection_settings = {
+    tjs_http_connection_on_message_begin,
+    tjs_http_connection_on_url,
+    NULL, /* on_status */
+    tjs_http_connection_on_header_field,
+    tjs_http_connection_on_header_value,
+    tjs_http_connection_on_headers_complete,
+    tjs_http_connection_on_body,
+    tjs_http_connection_on_message_complete,
+    NULL, /* on_chunk_header */
+    NULL, /* on_chunk_complete */
+};
+
+static void tjs_http_connection_read_callback(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf)
+{
+    TJSHttpConnection* connection = handle->data;
+    CHECK_NOT_NULL(connection);
+
+    if (nread < 0) {
+        tjs_http_connection_read_stop(connection);
+
+        // 对方半关闭时仍然发送还未完成的应答
+        if (nread == UV_EOF && (connection->pending_count > 0 || connection->write_count > 0)) {
+            connection->shutdown = 1;
+
+        } else {
+            tjs_http_connection_close(connection);
+        }
+
+        return;
+
+    } else if (nread == 0) {
+        return;
+    }
+
+    uv_timer_stop(&connection->timer);
+
+    http_parser* parser = &connection->parser;
+    size_t nparsed = http_parser_execute(parser, &tjs_http_connection_settings, buf->base, nread);
+    if (connection->closing || connection->shutdown) {
+        return;
+    }
+
+    if (HTTP_PARSER_ERRNO(parser) == HPE_CB_message_complete) {
+        // 收到 `Connection: close` 请求, 等待应答后关闭
+        connection->shutdown = 1;
+        tjs_http_connection_read_stop(connection);
+        return;
+
+    } else if (nparsed != (size_t)nread || HTTP_PARSER_ERRNO(parser) != HPE_OK) {
+        int status = connection->error_status ? connection->error_status : 400;
+        tjs_http_connection_error(connection, status);
+        return;
+    }
+
+    if (connection->pending_count >= connection->server->max_pipeline) {
+        tjs_http_connection_read_stop(connection);
+    }
+}
+
+static void tjs_http_server_on_connection(uv_stream_t* handle, int status)
+{
+    TJSHttpServer* server = handle->data;
+    CHECK_NOT_NULL(server);
+
+    JSContext* ctx = server->ctx;
+    if (status < 0) {
+        TJS_EmitEvent(ctx, server->events[HTTP_SERVER_EVENT_ERROR], tjs_new_uv_error(ctx, status));
+        return;
+    }
+
+    TJSHttpConnection* connection = calloc(1, sizeof(*connection));
+    CHECK_NOT_NULL(connection);
+
+    connection->server = server;
+    uv_loop_t* loop = TJS_GetLoop(ctx);
+    CHECK_EQ(uv_tcp_init(loop, &connection->tcp), 0);
+    CHECK_EQ(uv_timer_init(loop, &connection->timer), 0);
+    connection->tcp.data = connection;
+    connection->timer.data = connection;
+
+    init_list_head(&connection->requests);
+    init_list_head(&connection->writes);
+    list_add_tail(&connection->link, &server->connections);
+    server->connection_count++;
+
+    int ret = uv_accept(handle, (uv_stream_t*)&connection->tcp);
+    if (ret != 0) {
+        tjs_http_connection_close(connection);
+        return;
+    }
+
+    server->total_connections++;
+    uv_tcp_nodelay(&connection->tcp, 1);
+
+    dbuffer_init(&connection->url);
+    dbuffer_init(&connection->fields);
+    dbuffer_init(&connection->body);
+
+    http_parser_init(&connection->parser, HTTP_REQUEST);
+    connection->parser.data = connection;
+
+    tjs_http_connection_read_start(connection);
+    tjs_http_connection_start_timer(connection);
+}
+
+// ////////////////////////////////////////////////////////////////////////////
+// server
+
+static void tjs_http_server_maybe_free(TJSHttpServer* server)
+{
+    if (server->finalized && server->closed && server->connection_count == 0) {
+        free(server);
+    }
+}
+
+static void tjs_http_server_close_callback(uv_handle_t* handle)
+{
+    TJSHttpServer* server = handle->data;
+    CHECK_NOT_NULL(server);
+
+    server->closed = 1;
+    tjs_http_server_maybe_free(server);
+}
+
+/**
+ * 停止侦听
+ * @param force 是否立即关闭所有连接, 否则只关闭空闲的连接
+ */
+static void tjs_http_server_close(TJSHttpServer* server, int force)
+{
+    if (!server->closing) {
+        server->closing = 1;
+        uv_close((uv_handle_t*)&server->tcp, tjs_http_server_close_callback);
+    }
+
+    struct list_head *el, *el1;
+    list_for_each_safe(el, el1, &server->connections)
+    {
+        TJSHttpConnection* connection = list_entry(el, TJSHttpConnection, link);
+        if (force || (connection->pending_count == 0 && connection->write_count == 0)) {
+            tjs_http_connection_close(connection);
+
+        } else {
+            connection->shutdown = 1;
+            tjs_http_connection_read_stop(connection);
+        }
+    }
+}
+
+static void tjs_http_server_finalizer(JSRuntime* runtime, JSValue val)
+{
+    TJSHttpServer* server = JS_GetOpaque(val, tjs_http_server_class_id);
+    if (server == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < HTTP_SERVER_EVENT_MAX; i++) {
+        JS_FreeValueRT(runtime, server->events[i]);
+        server->events[i] = JS_UNDEFINED;
+    }
+
+    server->finalized = 1;
+    tjs_http_server_close(server, 1);
+    tjs_http_server_maybe_free(server);
+}
+
+static void tjs_http_server_mark(JSRuntime* runtime, JSValueConst val, JS_MarkFunc* mark_func)
+{
+    TJSHttpServer* server = JS_GetOpaque(val, tjs_http_server_class_id);
+    if (server) {
+        for (int i = 0; i < HTTP_SERVER_EVENT_MAX; i++) {
+            JS_MarkValue(runtime, server->events[i], mark_func);
+        }
+    }
+}
+
+static JSClassDef tjs_http_server_class = {
+    "HTTPServer",
+    .finalizer = tjs_http_server_finalizer,
+    .gc_mark = tjs_http_server_mark,
+};
+
+static TJSHttpServer* tjs_http_server_get(JSContext* ctx, JSValueConst obj)
+{
+    return JS_GetOpaque2(ctx, obj, tjs_http_server_class_id);
+}
+
+/**
+ * `new Server({ keepAliveTimeout, maxBodySize, maxPipeline })`
+ */
+static JSValue tjs_http_server_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst* argv)
+{
+    JSValue obj = JS_NewObjectClass(ctx, tjs_http_server_class_id);
+    if (JS_IsException(obj)) {
+        return obj;
+    }
+
+    TJSHttpServer* server = calloc(1, sizeof(*server));
+    if (!server) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+
+    int ret = uv_tcp_init(TJS_GetLoop(ctx), &server->tcp);
+    if (ret != 0) {
+        JS_FreeValue(ctx, obj);
+        free(server);
+        return JS_ThrowInternalError(ctx, "couldn't initialize TCP handle");
+    }
+
+    server->ctx = ctx;
+    server->tcp.data = server;
+    server->keep_alive_timeout = HTTP_SERVER_KEEP_ALIVE_TIMEOUT;
+    server->max_body_size = HTTP_SERVER_MAX_BODY_SIZE;
+    server->max_pipeline = HTTP_SERVER_MAX_PIPELINE;
+    init_list_head(&server->connections);
+
+    for (int i = 0; i < HTTP_SERVER_EVENT_MAX; i++) {
+        server->events[i] = JS_UNDEFINED;
+    }
+
+    if (argc > 0 && JS_IsObject(argv[0])) {
+        JSValueConst options = argv[0];
+        server->keep_alive_timeout = TJS_GetPropertyUint32(ctx, options, "keepAliveTimeout", server->keep_alive_timeout);
+        server->max_body_size = TJS_GetPropertyUint32(ctx, options, "maxBodySize", server->max_body_size);
+        server->max_pipeline = TJS_GetPropertyUint32(ctx, options, "maxPipeline", server->max_pipeline);
+        if (server->max_pipeline == 0) {
+            server->max_pipeline = 1;
+        }
+    }
+
+    JS_SetOpaque(obj, server);
+    return obj;
+}
+
+/**
+ * 在已经在侦听的 TCP 句柄上提供服务 (比如由主进程通过 IPC 传递过来的句柄)
+ */
+static int tjs_http_server_open(TJSHttpServer* server, TJSStream* stream)
+{
+    uv_os_fd_t fd;
+    int ret = uv_fileno(&stream->h.handle, &fd);
+    if (ret != 0) {
+        return ret;
+    }
+
+#ifdef _WIN32
+    return UV_ENOTSUP;
+#else
+    // 复制一份, 原来的句柄可以由调用者自己关闭
+    int sock = dup(fd);
+    if (sock < 0) {
+        return uv_translate_sys_error(errno);
+    }
+
+    ret = uv_tcp_open(&server->tcp, sock);
+    if (ret != 0) {
+        close(sock);
+    }
+
+    return ret;
+#endif
+}
+
+/**
+ * 开始侦听
+ * `listen(address, backlog, flags)`
+ * @param address 要绑定的地址, 也可以是一个已绑定的 TCP 句柄
+ * @param flags 同 `TCP.bind()`, 如 `TCP.REUSEPORT`
+ */
+static JSValue tjs_http_server_listen(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSHttpServer* server = tjs_http_server_get(ctx, this_val);
+    if (!server) {
+        return JS_EXCEPTION;
+
+    } else if (server->closing) {
+        return tjs_throw_uv_error(ctx, UV_EINVAL);
+    }
+
+    int backlog = 511;
+    if (argc > 1) {
+        backlog = TJS_ToInt32(ctx, argv[1], backlog);
+    }
+
+    int flags = 0;
+    if (argc > 2) {
+        flags = TJS_ToInt32(ctx, argv[2], 0);
+    }
+
+    int ret;
+    TJSStream* stream = tjs_tcp_try_get(argv[0]);
+    if (stream) {
+        ret = tjs_http_server_open(server, stream);
+
+    } else {
+        struct sockaddr_storage ss;
+        if (TJS_ToSocketAddress(ctx, argv[0], &ss) != 0) {
+            return JS_EXCEPTION;
+        }
+
+        ret = tjs_tcp_bind_ex(&server->tcp, (struct sockaddr*)&ss, flags);
+    }
+
+    if (ret == 0) {
+        ret = uv_listen((uv_stream_t*)&server->tcp, backlog, tjs_http_server_on_connection);
+    }
+
+    if (ret != 0) {
+        return tjs_throw_uv_error(ctx, ret);
+    }
+
+    return JS_UNDEFINED;
+}
+
+static JSValue tjs_http_server_close_method(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSHttpServer* server = tjs_http_server_get(ctx, this_val);
+    if (!server) {
+        return JS_EXCEPTION;
+    }
+
+    int force = 0;
+    if (argc > 0) {
+        force = JS_ToBool(ctx, argv[0]);
+    }
+
+    tjs_http_server_close(server, force);
+    return JS_UNDEFINED;
+}
+
+static JSValue tjs_http_server_address(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSHttpServer* server = tjs_http_server_get(ctx, this_val);
+    if (!server) {
+        return JS_EXCEPTION;
+    }
+
+    struct sockaddr_storage addr;
+    int namelen = sizeof(addr);
+    int ret = uv_tcp_getsockname(&server->tcp, (struct sockaddr*)&addr, &namelen);
+    if (ret != 0) {
+        return tjs_throw_uv_error(ctx, ret);
+    }
+
+    return TJS_NewSocketAddress(ctx, (struct sockaddr*)&addr);
+}
+
+static JSValue tjs_http_server_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSHttpServer* server = tjs_http_server_get(ctx, this_val);
+    if (!server) {
+        return JS_EXCEPTION;
+    }
+
+    JSValue result = JS_NewObject(ctx);
+    TJS_SetPropertyValue(ctx, result, "connections", JS_NewUint32(ctx, server->connection_count));
+    TJS_SetPropertyValue(ctx, result, "totalConnections", JS_NewInt64(ctx, server->total_connections));
+    TJS_SetPropertyValue(ctx, result, "totalRequests", JS_NewInt64(ctx, server->total_requests));
+    return result;
+}
+
+static JSValue tjs_http_server_event_get(JSContext* ctx, JSValueConst this_val, int magic)
+{
+    TJSHttpServer* server = tjs_http_server_get(ctx, this_val);
+    if (!server) {
+        return JS_EXCEPTION;
+    }
+
+    return JS_DupValue(ctx, server->events[magic]);
+}
+
+static JSValue tjs_http_server_event_set(JSContext* ctx, JSValueConst this_val, JSValueConst value, int magic)
+{
+    TJSHttpServer* server = tjs_http_server_get(ctx, this_val);
+    if (!server) {
+        return JS_EXCEPTION;
+    }
+
+    if (JS_IsFunction(ctx, value) || JS_IsUndefined(value) || JS_IsNull(value)) {
+        JS_FreeValue(ctx, server->events[magic]);
+        server->events[magic] = JS_DupValue(ctx, value);
+    }
+
+    return JS_UNDEFINED;
+}
+
+static const JSCFunctionListEntry tjs_http_server_proto_funcs[] = {
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "HTTPServer", JS_PROP_CONFIGURABLE),
+    TJS_CFUNC_DEF("address", 0, tjs_http_server_address),
+    TJS_CFUNC_DEF("close", 1, tjs_http_server_close_method),
+    TJS_CFUNC_DEF("listen", 3, tjs_http_server_listen),
+    TJS_CFUNC_DEF("stats", 0, tjs_http_server_stats),
+    TJS_CGETSET_MAGIC_DEF("onerror", tjs_http_server_event_get, tjs_http_server_event_set, HTTP_SERVER_EVENT_ERROR),
+    TJS_CGETSET_MAGIC_DEF("onrequest", tjs_http_server_event_get, tjs_http_server_event_set, HTTP_SERVER_EVENT_REQUEST),
+};
+
+void tjs_mod_http_server_init(JSContext* ctx, JSValue http)
+{
+    JSRuntime* runtime = JS_GetRuntime(ctx);
+
+    /* request class */
+    JS_NewClassID(&tjs_http_request_class_id);
+    JS_NewClass(runtime, tjs_http_request_class_id, &tjs_http_request_class);
+    JSValue proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, tjs_http_request_proto_funcs, countof(tjs_http_request_proto_funcs));
+    JS_SetClassProto(ctx, tjs_http_request_class_id, proto);
+
+    /* server class */
+    JS_NewClassID(&tjs_http_server_class_id);
+    JS_NewClass(runtime, tjs_http_server_class_id, &tjs_http_server_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, tjs_http_server_proto_funcs, countof(tjs_http_server_proto_funcs));
+    JS_SetClassProto(ctx, tjs_http_server_class_id, proto);
+
+    JSValue serverClass = JS_NewCFunction2(ctx, tjs_http_server_constructor, "HTTPServer", 1, JS_CFUNC_constructor, 0);
+    TJS_SetPropertyValue(ctx, http, "Server", serverClass);
+}
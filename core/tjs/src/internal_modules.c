@@ -9,6 +9,10 @@ JSModuleDef* js_init_module_redis(JSContext* ctx, const char* name);
 JSModuleDef* js_init_module_sqlite3(JSContext* ctx, const char* name);
 #endif
 
+#ifdef BUILD_MDNS
+JSModuleDef* js_init_module_mdns(JSContext* ctx, const char* name);
+#endif
+
 int tjs_init_internal_modules(JSContext* ctx)
 {
 
@@ -20,5 +24,9 @@ int tjs_init_internal_modules(JSContext* ctx)
     js_init_module_sqlite3(ctx, "@tjs/sqlite3");
 #endif
 
+#ifdef BUILD_MDNS
+    js_init_module_mdns(ctx, "@tjs/mdns");
+#endif
+
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,1123 @@
+/* JSON 增量序列化和解析 */
+#include "private.h"
+#include "tjs-utils.h"
+
+#include <inttypes.h>
+#include <math.h>
+#include <string.h>
+
+/** 默认的分块大小 */
+#define TJS_JSON_CHUNK_SIZE (16 * 1024)
+
+/** 最小的分块大小 */
+#define TJS_JSON_CHUNK_MIN 64
+
+/** 最大的缩进字符数, 同 JSON.stringify */
+#define TJS_JSON_INDENT_MAX 10
+
+/** 每次转义的字符串单元数 */
+#define TJS_JSON_STRING_BLOCK 256
+
+///////////////////////////////////////////////////////////////////////////////
+// Writer
+
+enum tjs_json_writer_state_enum {
+    TJS_JSON_WRITER_INIT = 0,
+    TJS_JSON_WRITER_RUNNING,
+    TJS_JSON_WRITER_DONE,
+};
+
+/** 正在序列化的对象或数组 */
+typedef struct tjs_json_frame_s {
+    JSValue value;
+    JSPropertyEnum* props; /* 对象的属性列表 */
+    uint32_t length; /* 数组的长度或对象的属性个数 */
+    uint32_t index; /* 下一个成员的索引 */
+    uint32_t count; /* 已经输出的成员个数 */
+    int is_array;
+} tjs_json_frame_t;
+
+typedef struct tjs_json_writer_s {
+    JSValue value; /* 还未开始序列化的根值 */
+    JSValue string; /* 还未写完的字符串 */
+    size_t string_offset;
+    JSAtom to_json;
+
+    tjs_json_frame_t* stack;
+    int depth;
+    int capacity;
+    int state;
+
+    uint8_t* data;
+    size_t size;
+    size_t allocated;
+    size_t chunk_size;
+
+    char indent[TJS_JSON_INDENT_MAX + 1];
+    int indent_length;
+    int busy; /* 正在执行 read(), toJSON 或 getter 中不能再调用 */
+} tjs_json_writer_t;
+
+static JSClassID tjs_json_writer_class_id;
+
+static void tjs__json_writer_reset(JSRuntime* rt, tjs_json_writer_t* w)
+{
+    for (int i = 0; i < w->depth; i++) {
+        tjs_json_frame_t* frame = &w->stack[i];
+        JS_FreeValueRT(rt, frame->value);
+
+        if (frame->props) {
+            for (uint32_t j = 0; j < frame->length; j++) {
+                JS_FreeAtomRT(rt, frame->props[j].atom);
+            }
+
+            js_free_rt(rt, frame->props);
+        }
+    }
+
+    JS_FreeValueRT(rt, w->value);
+    JS_FreeValueRT(rt, w->string);
+    w->value = JS_UNDEFINED;
+    w->string = JS_UNDEFINED;
+    w->depth = 0;
+    w->state = TJS_JSON_WRITER_DONE;
+
+    js_free_rt(rt, w->data);
+    w->data = NULL;
+    w->size = 0;
+    w->allocated = 0;
+}
+
+static void tjs_json_writer_finalizer(JSRuntime* rt, JSValue val)
+{
+    tjs_json_writer_t* w = JS_GetOpaque(val, tjs_json_writer_class_id);
+    if (w) {
+        tjs__json_writer_reset(rt, w);
+        JS_FreeAtomRT(rt, w->to_json);
+        js_free_rt(rt, w->stack);
+        js_free_rt(rt, w);
+    }
+}
+
+static void tjs_json_writer_mark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func)
+{
+    tjs_json_writer_t* w = JS_GetOpaque(val, tjs_json_writer_class_id);
+    if (w) {
+        JS_MarkValue(rt, w->value, mark_func);
+        JS_MarkValue(rt, w->string, mark_func);
+
+        for (int i = 0; i < w->depth; i++) {
+            JS_MarkValue(rt, w->stack[i].value, mark_func);
+        }
+    }
+}
+
+static JSClassDef tjs_json_writer_class = {
+    "JSONWriter",
+    .finalizer = tjs_json_writer_finalizer,
+    .gc_mark = tjs_json_writer_mark,
+};
+
+static int tjs__json_reserve(JSContext* ctx, tjs_json_writer_t* w, size_t length)
+{
+    if (w->size + length <= w->allocated) {
+        return 0;
+    }
+
+    size_t allocated = w->allocated + w->allocated / 2;
+    if (allocated < w->size + length) {
+        allocated = w->size + length;
+    }
+
+    if (allocated < w->chunk_size + TJS_JSON_CHUNK_MIN) {
+        allocated = w->chunk_size + TJS_JSON_CHUNK_MIN;
+    }
+
+    uint8_t* data = js_realloc(ctx, w->data, allocated);
+    if (!data) {
+        return -1;
+    }
+
+    w->data = data;
+    w->allocated = allocated;
+    return 0;
+}
+
+static int tjs__json_put(JSContext* ctx, tjs_json_writer_t* w, const void* data, size_t length)
+{
+    if (tjs__json_reserve(ctx, w, length)) {
+        return -1;
+    }
+
+    memcpy(w->data + w->size, data, length);
+    w->size += length;
+    return 0;
+}
+
+static inline int tjs__json_putc(JSContext* ctx, tjs_json_writer_t* w, uint8_t c)
+{
+    if (w->size >= w->allocated && tjs__json_reserve(ctx, w, 1)) {
+        return -1;
+    }
+
+    w->data[w->size++] = c;
+    return 0;
+}
+
+/** 换行并缩进 depth 层 */
+static int tjs__json_put_newline(JSContext* ctx, tjs_json_writer_t* w, int depth)
+{
+    if (!w->indent_length) {
+        return 0;
+    }
+
+    if (tjs__json_reserve(ctx, w, 1 + (size_t)depth * w->indent_length)) {
+        return -1;
+    }
+
+    w->data[w->size++] = '\n';
+    for (int i = 0; i < depth; i++) {
+        memcpy(w->data + w->size, w->indent, w->indent_length);
+        w->size += w->indent_length;
+    }
+
+    return 0;
+}
+
+static inline uint8_t* tjs__json_escape_char(uint8_t* p, uint32_t c)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    *p++ = '\\';
+    switch (c) {
+    case '"': *p++ = '"'; break;
+    case '\\': *p++ = '\\'; break;
+    case '\b': *p++ = 'b'; break;
+    case '\f': *p++ = 'f'; break;
+    case '\n': *p++ = 'n'; break;
+    case '\r': *p++ = 'r'; break;
+    case '\t': *p++ = 't'; break;
+    default:
+        *p++ = 'u';
+        *p++ = hex[(c >> 12) & 0x0F];
+        *p++ = hex[(c >> 8) & 0x0F];
+        *p++ = hex[(c >> 4) & 0x0F];
+        *p++ = hex[c & 0x0F];
+        break;
+    }
+
+    return p;
+}
+
+/**
+ * 转义并输出字符串, 结束时输出右引号
+ * - 输出的数据达到 limit 时暂停, 下次从 *poffset 继续
+ * @returns 1 已经写完, 0 暂停, -1 发生错误
+ */
+static int tjs__json_put_string(JSContext* ctx, tjs_json_writer_t* w, JSValueConst string, size_t* poffset, size_t limit)
+{
+    size_t length = 0;
+    JS_BOOL is_wide = FALSE;
+    const void* buffer = JS_GetStringBuffer(string, &length, &is_wide);
+    size_t i = *poffset;
+
+    while (i < length) {
+        size_t end = i + TJS_JSON_STRING_BLOCK;
+        if (end > length) {
+            end = length;
+        }
+
+        // 每个 UTF-16 单元最多输出 6 个字节 (\uXXXX), 代理对输出 4 个字节
+        if (tjs__json_reserve(ctx, w, (end - i) * 6 + 1)) {
+            return -1;
+        }
+
+        uint8_t* p = w->data + w->size;
+        if (!is_wide) {
+            const uint8_t* src = buffer;
+            for (; i < end; i++) {
+                uint32_t c = src[i];
+                if (c >= 0x80) {
+                    *p++ = 0xC0 | (c >> 6);
+                    *p++ = 0x80 | (c & 0x3F);
+
+                } else if (c < 0x20 || c == '"' || c == '\\') {
+                    p = tjs__json_escape_char(p, c);
+
+                } else {
+                    *p++ = c;
+                }
+            }
+
+        } else {
+            const uint16_t* src = buffer;
+            for (; i < end; i++) {
+                uint32_t c = src[i];
+                if (c < 0x80) {
+                    if (c < 0x20 || c == '"' || c == '\\') {
+                        p = tjs__json_escape_char(p, c);
+
+                    } else {
+                        *p++ = c;
+                    }
+
+                } else if (c < 0x800) {
+                    *p++ = 0xC0 | (c >> 6);
+                    *p++ = 0x80 | (c & 0x3F);
+
+                } else if (c < 0xD800 || c > 0xDFFF) {
+                    *p++ = 0xE0 | (c >> 12);
+                    *p++ = 0x80 | ((c >> 6) & 0x3F);
+                    *p++ = 0x80 | (c & 0x3F);
+
+                } else if (c < 0xDC00 && i + 1 < length && src[i + 1] >= 0xDC00 && src[i + 1] <= 0xDFFF) {
+                    // 代理对, 可能跨越块的边界
+                    c = 0x10000 + ((c - 0xD800) << 10) + (src[++i] - 0xDC00);
+                    *p++ = 0xF0 | (c >> 18);
+                    *p++ = 0x80 | ((c >> 12) & 0x3F);
+                    *p++ = 0x80 | ((c >> 6) & 0x3F);
+                    *p++ = 0x80 | (c & 0x3F);
+
+                } else {
+                    // 单独的代理项, 同 JSON.stringify 输出转义序列
+                    p = tjs__json_escape_char(p, c);
+                }
+            }
+        }
+
+        w->size = p - w->data;
+        if (w->size >= limit && i < length) {
+            *poffset = i;
+            return 0;
+        }
+    }
+
+    *poffset = length;
+    return tjs__json_putc(ctx, w, '"') ? -1 : 1;
+}
+
+/** 调用 toJSON 方法, 会释放 value */
+static JSValue tjs__json_to_json(JSContext* ctx, tjs_json_writer_t* w, JSValue value, JSValueConst key)
+{
+    if (!JS_IsObject(value) && !JS_IsBigInt(ctx, value)) {
+        return value;
+    }
+
+    JSValue method = JS_GetProperty(ctx, value, w->to_json);
+    if (JS_IsException(method)) {
+        JS_FreeValue(ctx, value);
+        return method;
+    }
+
+    if (!JS_IsFunction(ctx, method)) {
+        JS_FreeValue(ctx, method);
+        return value;
+    }
+
+    JSValue result = JS_Call(ctx, method, value, 1, &key);
+    JS_FreeValue(ctx, method);
+    JS_FreeValue(ctx, value);
+    return result;
+}
+
+/** 在对象中被忽略, 在数组中输出为 null 的值 */
+static inline int tjs__json_is_skipped(JSContext* ctx, JSValueConst value)
+{
+    return JS_IsUndefined(value) || JS_IsSymbol(value) || JS_IsFunction(ctx, value);
+}
+
+static int tjs__json_push_frame(JSContext* ctx, tjs_json_writer_t* w, JSValue value, int is_array)
+{
+    for (int i = 0; i < w->depth; i++) {
+        if (JS_VALUE_GET_PTR(w->stack[i].value) == JS_VALUE_GET_PTR(value)) {
+            JS_FreeValue(ctx, value);
+            JS_ThrowTypeError(ctx, "circular reference");
+            return -1;
+        }
+    }
+
+    if (w->depth >= w->capacity) {
+        int capacity = w->capacity ? w->capacity * 2 : 16;
+        tjs_json_frame_t* stack = js_realloc(ctx, w->stack, capacity * sizeof(*stack));
+        if (!stack) {
+            JS_FreeValue(ctx, value);
+            return -1;
+        }
+
+        w->stack = stack;
+        w->capacity = capacity;
+    }
+
+    tjs_json_frame_t frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.value = value;
+    frame.is_array = is_array;
+
+    if (is_array) {
+        int64_t length = 0;
+        JSValue ret = JS_GetPropertyStr(ctx, value, "length");
+        int error = JS_IsException(ret) || JS_ToInt64(ctx, &length, ret);
+        JS_FreeValue(ctx, ret);
+        if (error) {
+            JS_FreeValue(ctx, value);
+            return -1;
+        }
+
+        frame.length = (length > 0 && length <= UINT32_MAX) ? (uint32_t)length : 0;
+
+    } else if (JS_GetOwnPropertyNames(ctx, &frame.props, &frame.length, value, JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY)) {
+        JS_FreeValue(ctx, value);
+        return -1;
+    }
+
+    w->stack[w->depth++] = frame;
+    return tjs__json_putc(ctx, w, is_array ? '[' : '{');
+}
+
+static void tjs__json_pop_frame(JSContext* ctx, tjs_json_writer_t* w)
+{
+    tjs_json_frame_t* frame = &w->stack[--w->depth];
+    JS_FreeValue(ctx, frame->value);
+
+    if (frame->props) {
+        for (uint32_t i = 0; i < frame->length; i++) {
+            JS_FreeAtom(ctx, frame->props[i].atom);
+        }
+
+        js_free(ctx, frame->props);
+    }
+}
+
+/** 输出一个值, 对象和数组只输出开始的括号并压栈, 会释放 value */
+static int tjs__json_put_value(JSContext* ctx, tjs_json_writer_t* w, JSValue value)
+{
+    char buf[32];
+    int ret = 0;
+
+    switch (JS_VALUE_GET_NORM_TAG(value)) {
+    case JS_TAG_NULL:
+        return tjs__json_put(ctx, w, "null", 4);
+
+    case JS_TAG_BOOL:
+        return JS_VALUE_GET_BOOL(value) ? tjs__json_put(ctx, w, "true", 4) : tjs__json_put(ctx, w, "false", 5);
+
+    case JS_TAG_INT:
+        ret = snprintf(buf, sizeof(buf), "%d", JS_VALUE_GET_INT(value));
+        return tjs__json_put(ctx, w, buf, ret);
+
+    case JS_TAG_FLOAT64:
+        if (!isfinite(JS_VALUE_GET_FLOAT64(value))) {
+            return tjs__json_put(ctx, w, "null", 4);
+
+        } else {
+            // 同 Number.prototype.toString()
+            size_t length = 0;
+            const char* text = JS_ToCStringLen(ctx, &length, value);
+            if (!text) {
+                return -1;
+            }
+
+            ret = tjs__json_put(ctx, w, text, length);
+            JS_FreeCString(ctx, text);
+            return ret;
+        }
+
+    case JS_TAG_STRING:
+        w->string_offset = 0;
+        if (tjs__json_putc(ctx, w, '"')) {
+            ret = -1;
+
+        } else {
+            ret = tjs__json_put_string(ctx, w, value, &w->string_offset, w->chunk_size);
+            if (ret == 0) {
+                // 长字符串, 下次继续输出
+                w->string = value;
+                return 0;
+            }
+        }
+
+        JS_FreeValue(ctx, value);
+        return ret < 0 ? -1 : 0;
+
+    case JS_TAG_OBJECT:
+        if (!JS_IsPrimitiveObject(value)) {
+            int is_array = JS_IsArray(ctx, value);
+            if (is_array < 0) {
+                JS_FreeValue(ctx, value);
+                return -1;
+            }
+
+            return tjs__json_push_frame(ctx, w, value, is_array);
+        }
+
+        break;
+
+    default:
+        break;
+    }
+
+    // Number/String/Boolean 对象, BigInt (抛出 TypeError) 等由 JSON.stringify 处理
+    JSValue string = JS_JSONStringify(ctx, value, JS_UNDEFINED, JS_UNDEFINED);
+    JS_FreeValue(ctx, value);
+    if (JS_IsException(string)) {
+        return -1;
+    }
+
+    size_t length = 0;
+    const char* text = JS_ToCStringLen(ctx, &length, string);
+    JS_FreeValue(ctx, string);
+    if (!text) {
+        return -1;
+    }
+
+    ret = tjs__json_put(ctx, w, text, length);
+    JS_FreeCString(ctx, text);
+    return ret;
+}
+
+/** 输出下一个成员或者结束当前的对象或数组 */
+static int tjs__json_writer_step(JSContext* ctx, tjs_json_writer_t* w)
+{
+    if (!JS_IsUndefined(w->string)) {
+        int ret = tjs__json_put_string(ctx, w, w->string, &w->string_offset, w->chunk_size);
+        if (ret < 0) {
+            return -1;
+
+        } else if (ret > 0) {
+            JS_FreeValue(ctx, w->string);
+            w->string = JS_UNDEFINED;
+        }
+
+        return 0;
+
+    } else if (w->state == TJS_JSON_WRITER_INIT) {
+        JSValue value = w->value;
+        w->value = JS_UNDEFINED;
+        w->state = TJS_JSON_WRITER_RUNNING;
+
+        JSValue key = JS_NewString(ctx, "");
+        value = tjs__json_to_json(ctx, w, value, key);
+        JS_FreeValue(ctx, key);
+        if (JS_IsException(value)) {
+            return -1;
+
+        } else if (tjs__json_is_skipped(ctx, value)) {
+            // 同 JSON.stringify 返回 undefined, 不输出任何内容
+            JS_FreeValue(ctx, value);
+            return 0;
+        }
+
+        return tjs__json_put_value(ctx, w, value);
+
+    } else if (w->depth == 0) {
+        w->state = TJS_JSON_WRITER_DONE;
+        return 0;
+    }
+
+    tjs_json_frame_t* frame = &w->stack[w->depth - 1];
+    if (frame->index >= frame->length) {
+        int is_array = frame->is_array;
+        if (frame->count && tjs__json_put_newline(ctx, w, w->depth - 1)) {
+            return -1;
+        }
+
+        tjs__json_pop_frame(ctx, w);
+        return tjs__json_putc(ctx, w, is_array ? ']' : '}');
+    }
+
+    uint32_t index = frame->index++;
+    JSValue object = frame->value;
+    JSValue value;
+    JSAtom atom = JS_ATOM_NULL;
+
+    if (frame->is_array) {
+        value = JS_GetPropertyUint32(ctx, object, index);
+
+    } else {
+        atom = frame->props[index].atom;
+        value = JS_GetProperty(ctx, object, atom);
+    }
+
+    if (JS_IsException(value)) {
+        return -1;
+    }
+
+    if (JS_IsObject(value) || JS_IsBigInt(ctx, value)) {
+        JSValue key;
+        if (frame->is_array) {
+            char buf[16];
+            snprintf(buf, sizeof(buf), "%u", index);
+            key = JS_NewString(ctx, buf);
+
+        } else {
+            key = JS_AtomToString(ctx, atom);
+        }
+
+        value = tjs__json_to_json(ctx, w, value, key);
+        JS_FreeValue(ctx, key);
+        if (JS_IsException(value)) {
+            return -1;
+        }
+    }
+
+    if (tjs__json_is_skipped(ctx, value)) {
+        JS_FreeValue(ctx, value);
+        if (!frame->is_array) {
+            return 0;
+        }
+
+        value = JS_NULL;
+    }
+
+    if ((frame->count++ && tjs__json_putc(ctx, w, ',')) || tjs__json_put_newline(ctx, w, w->depth)) {
+        JS_FreeValue(ctx, value);
+        return -1;
+    }
+
+    if (!frame->is_array) {
+        JSValue key = JS_AtomToString(ctx, atom);
+        if (JS_IsException(key)) {
+            JS_FreeValue(ctx, value);
+            return -1;
+        }
+
+        size_t offset = 0;
+        int ret = tjs__json_putc(ctx, w, '"');
+        if (!ret) {
+            ret = tjs__json_put_string(ctx, w, key, &offset, SIZE_MAX) < 0;
+        }
+
+        if (!ret) {
+            ret = w->indent_length ? tjs__json_put(ctx, w, ": ", 2) : tjs__json_putc(ctx, w, ':');
+        }
+
+        JS_FreeValue(ctx, key);
+        if (ret) {
+            JS_FreeValue(ctx, value);
+            return -1;
+        }
+    }
+
+    return tjs__json_put_value(ctx, w, value);
+}
+
+static JSValue tjs_json_writer_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst* argv)
+{
+    JSValue result = JS_NewObjectClass(ctx, tjs_json_writer_class_id);
+    if (JS_IsException(result)) {
+        return result;
+    }
+
+    tjs_json_writer_t* w = js_mallocz(ctx, sizeof(*w));
+    if (!w) {
+        JS_FreeValue(ctx, result);
+        return JS_EXCEPTION;
+    }
+
+    w->value = JS_DupValue(ctx, argv[0]);
+    w->string = JS_UNDEFINED;
+    w->to_json = JS_NewAtom(ctx, "toJSON");
+    w->state = TJS_JSON_WRITER_INIT;
+    JS_SetOpaque(result, w);
+
+    // 缩进
+    JSValueConst space = argc > 1 ? argv[1] : JS_UNDEFINED;
+    if (JS_IsNumber(space)) {
+        int count = TJS_ToInt32(ctx, space, 0);
+        count = count < 0 ? 0 : (count > TJS_JSON_INDENT_MAX ? TJS_JSON_INDENT_MAX : count);
+        memset(w->indent, ' ', count);
+        w->indent_length = count;
+
+    } else if (JS_IsString(space)) {
+        size_t length = 0;
+        const char* text = JS_ToCStringLen(ctx, &length, space);
+        if (!text) {
+            JS_FreeValue(ctx, result);
+            return JS_EXCEPTION;
+        }
+
+        length = length > TJS_JSON_INDENT_MAX ? TJS_JSON_INDENT_MAX : length;
+        memcpy(w->indent, text, length);
+        w->indent_length = length;
+        JS_FreeCString(ctx, text);
+    }
+
+    int64_t chunk_size = argc > 2 ? TJS_ToInt64(ctx, argv[2], 0) : 0;
+    if (chunk_size <= 0) {
+        chunk_size = TJS_JSON_CHUNK_SIZE;
+
+    } else if (chunk_size < TJS_JSON_CHUNK_MIN) {
+        chunk_size = TJS_JSON_CHUNK_MIN;
+    }
+
+    w->chunk_size = chunk_size;
+    return result;
+}
+
+static JSValue tjs_json_writer_close(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    tjs_json_writer_t* w = JS_GetOpaque2(ctx, this_val, tjs_json_writer_class_id);
+    if (!w) {
+        return JS_EXCEPTION;
+
+    } else if (w->busy) {
+        return JS_ThrowTypeError(ctx, "JSONWriter is busy");
+    }
+
+    tjs__json_writer_reset(JS_GetRuntime(ctx), w);
+    return JS_UNDEFINED;
+}
+
+/**
+ * 读取下一个分块
+ * - 每个分块的大小约为 chunkSize 个字节
+ * @returns {Uint8Array|undefined} 已经全部输出时返回 undefined
+ */
+static JSValue tjs_json_writer_read(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    tjs_json_writer_t* w = JS_GetOpaque2(ctx, this_val, tjs_json_writer_class_id);
+    if (!w) {
+        return JS_EXCEPTION;
+
+    } else if (w->busy) {
+        return JS_ThrowTypeError(ctx, "JSONWriter is busy");
+    }
+
+    w->busy = 1;
+    while (w->state != TJS_JSON_WRITER_DONE && w->size < w->chunk_size) {
+        if (tjs__json_writer_step(ctx, w)) {
+            tjs__json_writer_reset(JS_GetRuntime(ctx), w);
+            w->busy = 0;
+            return JS_EXCEPTION;
+        }
+    }
+
+    w->busy = 0;
+
+    if (w->size == 0) {
+        return JS_UNDEFINED;
+    }
+
+    uint8_t* data = w->data;
+    size_t size = w->size;
+    w->data = NULL;
+    w->size = 0;
+    w->allocated = 0;
+
+    return TJS_NewUint8Array(ctx, data, size);
+}
+
+static const JSCFunctionListEntry tjs_json_writer_proto_funcs[] = {
+    TJS_CFUNC_DEF("close", 0, tjs_json_writer_close),
+    TJS_CFUNC_DEF("read", 0, tjs_json_writer_read),
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Parser
+
+enum tjs_json_parser_state_enum {
+    TJS_JSON_PARSER_START = 0, /* 文档开始 */
+    TJS_JSON_PARSER_FIRST, /* '[' 之后, 第一个元素或 ']' */
+    TJS_JSON_PARSER_ELEMENT, /* ',' 之后, 下一个元素 */
+    TJS_JSON_PARSER_RECORD, /* 正在读取元素 */
+    TJS_JSON_PARSER_NEXT, /* 元素之后, ',' 或 ']' */
+    TJS_JSON_PARSER_END, /* ']' 之后 */
+    TJS_JSON_PARSER_VALUE, /* 根值不是数组, 读取整个文档 */
+    TJS_JSON_PARSER_ERROR,
+};
+
+typedef struct tjs_json_parser_s {
+    uint8_t* data; /* 当前记录的内容 */
+    size_t size;
+    size_t allocated;
+    size_t max_length; /* 单个记录的最大长度, 0 表示不限制 */
+    uint64_t position; /* 已经处理的字节数 */
+    int state;
+    int depth; /* 记录中对象和数组的嵌套层数 */
+    int in_string;
+    int escape;
+} tjs_json_parser_t;
+
+static JSClassID tjs_json_parser_class_id;
+
+static void tjs_json_parser_finalizer(JSRuntime* rt, JSValue val)
+{
+    tjs_json_parser_t* p = JS_GetOpaque(val, tjs_json_parser_class_id);
+    if (p) {
+        js_free_rt(rt, p->data);
+        js_free_rt(rt, p);
+    }
+}
+
+static JSClassDef tjs_json_parser_class = {
+    "JSONParser",
+    .finalizer = tjs_json_parser_finalizer,
+};
+
+static inline int tjs__json_is_space(uint8_t c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static void tjs__json_parser_reset(tjs_json_parser_t* p, int state)
+{
+    p->size = 0;
+    p->position = 0;
+    p->state = state;
+    p->depth = 0;
+    p->in_string = 0;
+    p->escape = 0;
+}
+
+static int tjs__json_parser_append(JSContext* ctx, tjs_json_parser_t* p, const uint8_t* data, size_t length)
+{
+    if (p->max_length && p->size + length > p->max_length) {
+        JS_ThrowRangeError(ctx, "JSON record exceeds %zu bytes", p->max_length);
+        return -1;
+    }
+
+    // 多保留一个字节用于结尾的 '\0'
+    if (p->size + length + 1 > p->allocated || !p->data) {
+        size_t allocated = p->allocated + p->allocated / 2;
+        if (allocated < p->size + length + 1) {
+            allocated = p->size + length + 1;
+        }
+
+        uint8_t* buffer = js_realloc(ctx, p->data, allocated);
+        if (!buffer) {
+            return -1;
+        }
+
+        p->data = buffer;
+        p->allocated = allocated;
+    }
+
+    if (length) {
+        memcpy(p->data + p->size, data, length);
+        p->size += length;
+    }
+
+    return 0;
+}
+
+/** 解析当前记录并添加到 records 中 */
+static int tjs__json_parser_emit(JSContext* ctx, tjs_json_parser_t* p, JSValueConst records, uint32_t* pcount)
+{
+    if (tjs__json_parser_append(ctx, p, NULL, 0)) {
+        return -1;
+    }
+
+    p->data[p->size] = '\0';
+    JSValue value = JS_ParseJSON(ctx, (const char*)p->data, p->size, "<input>");
+    p->size = 0;
+    p->depth = 0;
+    if (JS_IsException(value)) {
+        return -1;
+    }
+
+    return JS_SetPropertyUint32(ctx, records, (*pcount)++, value) < 0 ? -1 : 0;
+}
+
+/**
+ * 处理一块数据
+ * - 顶层数组中的每个元素解析完成后添加到 records 中
+ */
+static int tjs__json_parser_execute(JSContext* ctx, tjs_json_parser_t* p, const uint8_t* data, size_t length, JSValueConst records, uint32_t* pcount)
+{
+    size_t i = 0;
+    size_t start = 0; /* 当前记录在 data 中的开始位置 */
+
+    while (i < length) {
+        uint8_t c = data[i];
+
+        switch (p->state) {
+        case TJS_JSON_PARSER_START:
+            if (p->position + i < 3 && (c == 0xEF || c == 0xBB || c == 0xBF)) {
+                // BOM
+                i++;
+
+            } else if (tjs__json_is_space(c)) {
+                i++;
+
+            } else if (c == '[') {
+                p->state = TJS_JSON_PARSER_FIRST;
+                i++;
+
+            } else {
+                p->state = TJS_JSON_PARSER_VALUE;
+                start = i;
+            }
+
+            break;
+
+        case TJS_JSON_PARSER_FIRST:
+        case TJS_JSON_PARSER_ELEMENT:
+            if (tjs__json_is_space(c)) {
+                i++;
+
+            } else if (c == ']' && p->state == TJS_JSON_PARSER_FIRST) {
+                p->state = TJS_JSON_PARSER_END;
+                i++;
+
+            } else if (c == ']' || c == ',') {
+                goto error;
+
+            } else {
+                p->state = TJS_JSON_PARSER_RECORD;
+                start = i;
+            }
+
+            break;
+
+        case TJS_JSON_PARSER_RECORD:
+            if (p->in_string) {
+                // 跳过字符串中的普通字符
+                while (i < length && data[i] != '"' && data[i] != '\\' && !p->escape) {
+                    i++;
+                }
+
+                if (i >= length) {
+                    break;
+                }
+
+                c = data[i++];
+                if (p->escape) {
+                    p->escape = 0;
+
+                } else if (c == '\\') {
+                    p->escape = 1;
+
+                } else if (c == '"') {
+                    p->in_string = 0;
+                    if (p->depth == 0) {
+                        // 字符串记录
+                        if (tjs__json_parser_append(ctx, p, data + start, i - start)
+                            || tjs__json_parser_emit(ctx, p, records, pcount)) {
+                            return -1;
+                        }
+
+                        p->state = TJS_JSON_PARSER_NEXT;
+                    }
+                }
+
+            } else if (c == '"') {
+                p->in_string = 1;
+                i++;
+
+            } else if (c == '{' || c == '[') {
+                p->depth++;
+                i++;
+
+            } else if ((c == '}' || c == ']') && p->depth > 0) {
+                i++;
+                if (--p->depth == 0) {
+                    // 对象或数组记录
+                    if (tjs__json_parser_append(ctx, p, data + start, i - start)
+                        || tjs__json_parser_emit(ctx, p, records, pcount)) {
+                        return -1;
+                    }
+
+                    p->state = TJS_JSON_PARSER_NEXT;
+                }
+
+            } else if (p->depth == 0 && (c == ',' || c == ']' || tjs__json_is_space(c))) {
+                // 数字, true, false, null 等记录, 分隔符由 NEXT 状态处理
+                if (tjs__json_parser_append(ctx, p, data + start, i - start)
+                    || tjs__json_parser_emit(ctx, p, records, pcount)) {
+                    return -1;
+                }
+
+                p->state = TJS_JSON_PARSER_NEXT;
+
+            } else {
+                i++;
+            }
+
+            break;
+
+        case TJS_JSON_PARSER_NEXT:
+            if (tjs__json_is_space(c)) {
+                i++;
+
+            } else if (c == ',') {
+                p->state = TJS_JSON_PARSER_ELEMENT;
+                i++;
+
+            } else if (c == ']') {
+                p->state = TJS_JSON_PARSER_END;
+                i++;
+
+            } else {
+                goto error;
+            }
+
+            break;
+
+        case TJS_JSON_PARSER_END:
+            if (!tjs__json_is_space(c)) {
+                goto error;
+            }
+
+            i++;
+            break;
+
+        case TJS_JSON_PARSER_VALUE:
+            i = length;
+            break;
+
+        default:
+            JS_ThrowSyntaxError(ctx, "JSON parser is in error state");
+            return -1;
+        }
+    }
+
+    // 保存还不完整的记录
+    if (p->state == TJS_JSON_PARSER_RECORD || p->state == TJS_JSON_PARSER_VALUE) {
+        if (tjs__json_parser_append(ctx, p, data + start, length - start)) {
+            return -1;
+        }
+    }
+
+    p->position += length;
+    return 0;
+
+error:
+    JS_ThrowSyntaxError(ctx, "Unexpected token in JSON at position %" PRIu64, p->position + i);
+    return -1;
+}
+
+static JSValue tjs_json_parser_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst* argv)
+{
+    JSValue result = JS_NewObjectClass(ctx, tjs_json_parser_class_id);
+    if (JS_IsException(result)) {
+        return result;
+    }
+
+    tjs_json_parser_t* p = js_mallocz(ctx, sizeof(*p));
+    if (!p) {
+        JS_FreeValue(ctx, result);
+        return JS_EXCEPTION;
+    }
+
+    int64_t max_length = argc > 0 ? TJS_ToInt64(ctx, argv[0], 0) : 0;
+    p->max_length = max_length > 0 ? max_length : 0;
+    tjs__json_parser_reset(p, TJS_JSON_PARSER_START);
+
+    JS_SetOpaque(result, p);
+    return result;
+}
+
+/**
+ * 写入一块数据
+ * @returns {any[]} 这块数据中完成的记录
+ */
+static JSValue tjs_json_parser_write(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    tjs_json_parser_t* p = JS_GetOpaque2(ctx, this_val, tjs_json_parser_class_id);
+    if (!p) {
+        return JS_EXCEPTION;
+    }
+
+    tjs_buffer_t buffer = TJS_GetArrayBuffer(ctx, argv[0]);
+    if (JS_IsException(buffer.error)) {
+        return JS_ThrowTypeError(ctx, "The provided value is not of type '(ArrayBuffer or ArrayBufferView)'");
+    }
+
+    JSValue records = JS_NewArray(ctx);
+    if (JS_IsException(records)) {
+        return records;
+    }
+
+    uint32_t count = 0;
+    if (tjs__json_parser_execute(ctx, p, buffer.data, buffer.length, records, &count)) {
+        p->state = TJS_JSON_PARSER_ERROR;
+        p->size = 0;
+        JS_FreeValue(ctx, records);
+        return JS_EXCEPTION;
+    }
+
+    return records;
+}
+
+/**
+ * 结束解析, 检查文档是否完整, 然后重置解析器
+ * @returns {any[]} 剩余的记录 (根值不是数组时为整个文档的值)
+ */
+static JSValue tjs_json_parser_end(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    tjs_json_parser_t* p = JS_GetOpaque2(ctx, this_val, tjs_json_parser_class_id);
+    if (!p) {
+        return JS_EXCEPTION;
+    }
+
+    int state = p->state;
+    JSValue records = JS_NewArray(ctx);
+    if (JS_IsException(records)) {
+        return records;
+    }
+
+    uint32_t count = 0;
+    int ret = 0;
+    if (state == TJS_JSON_PARSER_VALUE) {
+        ret = tjs__json_parser_emit(ctx, p, records, &count);
+
+    } else if (state == TJS_JSON_PARSER_ERROR) {
+        JS_ThrowSyntaxError(ctx, "JSON parser is in error state");
+        ret = -1;
+
+    } else if (state != TJS_JSON_PARSER_END) {
+        JS_ThrowSyntaxError(ctx, "Unexpected end of JSON input");
+        ret = -1;
+    }
+
+    tjs__json_parser_reset(p, TJS_JSON_PARSER_START);
+    if (ret) {
+        JS_FreeValue(ctx, records);
+        return JS_EXCEPTION;
+    }
+
+    return records;
+}
+
+static const JSCFunctionListEntry tjs_json_parser_proto_funcs[] = {
+    TJS_CFUNC_DEF("end", 0, tjs_json_parser_end),
+    TJS_CFUNC_DEF("write", 1, tjs_json_parser_write),
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// json
+
+void tjs_mod_json_init(JSContext* ctx, JSModuleDef* m)
+{
+    JSRuntime* rt = JS_GetRuntime(ctx);
+    JSValue json = JS_NewObject(ctx);
+    JSValue prototype, constructor;
+
+    /* Writer */
+    JS_NewClassID(&tjs_json_writer_class_id);
+    JS_NewClass(rt, tjs_json_writer_class_id, &tjs_json_writer_class);
+    prototype = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, prototype, tjs_json_writer_proto_funcs, countof(tjs_json_writer_proto_funcs));
+    JS_SetClassProto(ctx, tjs_json_writer_class_id, prototype);
+
+    constructor = JS_NewCFunction2(ctx, tjs_json_writer_constructor, "JSONWriter", 3, JS_CFUNC_constructor, 0);
+    JS_DefinePropertyValueStr(ctx, json, "Writer", constructor, JS_PROP_C_W_E);
+
+    /* Parser */
+    JS_NewClassID(&tjs_json_parser_class_id);
+    JS_NewClass(rt, tjs_json_parser_class_id, &tjs_json_parser_class);
+    prototype = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, prototype, tjs_json_parser_proto_funcs, countof(tjs_json_parser_proto_funcs));
+    JS_SetClassProto(ctx, tjs_json_parser_class_id, prototype);
+
+    constructor = JS_NewCFunction2(ctx, tjs_json_parser_constructor, "JSONParser", 1, JS_CFUNC_constructor, 0);
+    JS_DefinePropertyValueStr(ctx, json, "Parser", constructor, JS_PROP_C_W_E);
+
+    JS_DefinePropertyValueStr(ctx, json, "CHUNK_SIZE", JS_NewInt32(ctx, TJS_JSON_CHUNK_SIZE), JS_PROP_C_W_E);
+    JS_SetModuleExport(ctx, m, "json", json);
+}
+
+void tjs_mod_json_export(JSContext* ctx, JSModuleDef* m)
+{
+    JS_AddModuleExport(ctx, m, "json");
+}
@@ -0,0 +1,651 @@
+/* 异步日志输出 */
+#include "private.h"
+#include "tjs-utils.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#else
+#define STDOUT_FILENO 1
+#define STDERR_FILENO 2
+#endif
+
+#if defined(__linux__) || defined(__linux)
+#include <syslog.h>
+#endif
+
+/** 日志输出目标 */
+#define TJS_LOG_SINK_STDERR 0x01
+#define TJS_LOG_SINK_STDOUT 0x02
+#define TJS_LOG_SINK_FILE 0x04
+#define TJS_LOG_SINK_SYSLOG 0x08
+#define TJS_LOG_SINK_CONSOLE 0x10
+
+/** 默认最多缓存的日志条数 */
+#define TJS_LOG_DEFAULT_CAPACITY 1024
+
+/** 默认最多缓存的日志字节数 */
+#define TJS_LOG_DEFAULT_MAX_BYTES (1024 * 1024)
+
+/** 后台线程每次最多输出的日志条数 */
+#define TJS_LOG_BATCH_SIZE 64
+
+/** 单条日志的最大长度, 超过时会被截断 */
+#define TJS_LOG_MAX_MESSAGE_SIZE (64 * 1024)
+
+typedef struct tjs_log_entry {
+    /** syslog 日志级别 */
+    int level;
+
+    /** 日志产生的时间 (毫秒) */
+    uint64_t time;
+
+    size_t length;
+    char* message;
+
+    /** 打印到控制台的文本, 为 NULL 时使用 message, 和 message 在同一块内存中 */
+    size_t echo_length;
+    char* echo;
+} TJSLogEntry;
+
+/**
+ * 日志环形缓冲区
+ * - 由 JS 线程写入, 由后台线程批量输出到 stderr/stdout/文件/syslog/控制台
+ * - 缓冲区满时丢弃新的日志并计数, 不会阻塞事件循环
+ */
+typedef struct tjs_logger {
+    uv_mutex_t mutex;
+
+    /** 有新的日志或需要退出 */
+    uv_cond_t ready;
+
+    /** 缓冲区中的日志都已输出 */
+    uv_cond_t drained;
+
+    uv_thread_t thread;
+
+    /** 后台线程是否已启动 */
+    int started;
+
+    /** 后台线程是否需要退出 */
+    int stopping;
+
+    /** 后台线程是否正在输出日志 */
+    int busy;
+
+    /** 输出的最大级别, 大于这个级别的日志会被过滤 */
+    int level;
+
+    /** 输出目标, TJS_LOG_SINK_* 的组合 */
+    int sinks;
+
+    /** 日志文件 */
+    uv_file file;
+
+    /** syslog 进程名, openlog 要求在关闭前一直有效 */
+    char* ident;
+
+    TJSLogEntry* entries;
+    uint32_t capacity;
+    uint32_t head;
+    uint32_t count;
+
+    size_t pending_bytes;
+    size_t max_bytes;
+
+    /** 统计信息 */
+    uint64_t written;
+    uint64_t dropped;
+    uint64_t filtered;
+} TJSLogger;
+
+static TJSLogger tjs_logger;
+static uv_once_t tjs_logger_once = UV_ONCE_INIT;
+
+static void tjs_logger_init_once(void)
+{
+    TJSLogger* logger = &tjs_logger;
+    memset(logger, 0, sizeof(*logger));
+
+    uv_mutex_init(&logger->mutex);
+    uv_cond_init(&logger->ready);
+    uv_cond_init(&logger->drained);
+
+    logger->level = 7; // LOG_DEBUG
+    logger->file = -1;
+    logger->capacity = TJS_LOG_DEFAULT_CAPACITY;
+    logger->max_bytes = TJS_LOG_DEFAULT_MAX_BYTES;
+}
+
+static TJSLogger* tjs_logger_get()
+{
+    uv_once(&tjs_logger_once, tjs_logger_init_once);
+    return &tjs_logger;
+}
+
+static uint64_t tjs_logger_now()
+{
+    uv_timeval64_t tv;
+    uv_gettimeofday(&tv);
+    return (uint64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+}
+
+static void tjs_logger_write_fd(uv_file fd, const char* data, size_t length)
+{
+    while (length > 0) {
+        uv_fs_t req;
+        uv_buf_t buf = uv_buf_init((char*)data, length);
+        int ret = uv_fs_write(NULL, &req, fd, &buf, 1, -1, NULL);
+        uv_fs_req_cleanup(&req);
+        if (ret <= 0) {
+            break;
+        }
+
+        data += ret;
+        length -= ret;
+    }
+}
+
+/**
+ * 原样打印到控制台, 和 console 一样 notice 及以上级别打印到 stderr, 其他打印到 stdout
+ * - 连续输出到同一个文件的日志合并后一次写入
+ */
+static void tjs_logger_output_console(TJSLogEntry* batch, uint32_t count)
+{
+    size_t total = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        total += (batch[i].echo ? batch[i].echo_length : batch[i].length) + 1;
+    }
+
+    char* buffer = malloc(total);
+    if (!buffer) {
+        return;
+    }
+
+    size_t length = 0;
+    uv_file current = -1;
+    for (uint32_t i = 0; i < count; i++) {
+        TJSLogEntry* entry = &batch[i];
+        uv_file fd = entry->level <= 5 ? STDERR_FILENO : STDOUT_FILENO;
+        if (fd != current && length > 0) {
+            tjs_logger_write_fd(current, buffer, length);
+            length = 0;
+        }
+
+        current = fd;
+        if (entry->echo) {
+            memcpy(buffer + length, entry->echo, entry->echo_length);
+            length += entry->echo_length;
+
+        } else {
+            memcpy(buffer + length, entry->message, entry->length);
+            length += entry->length;
+        }
+
+        buffer[length++] = '\n';
+    }
+
+    if (length > 0) {
+        tjs_logger_write_fd(current, buffer, length);
+    }
+
+    free(buffer);
+}
+
+/** 在后台线程中输出一批日志 */
+static void tjs_logger_output(TJSLogEntry* batch, uint32_t count, int sinks, uv_file file)
+{
+    static const char levels[] = "FACEWNID";
+
+    if (sinks & (TJS_LOG_SINK_STDERR | TJS_LOG_SINK_STDOUT | TJS_LOG_SINK_FILE)) {
+        // 格式: `2024-01-01 12:00:00.000 I message\n`
+        size_t total = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            total += batch[i].length + 32;
+        }
+
+        char* buffer = malloc(total);
+        size_t length = 0;
+        if (buffer) {
+            for (uint32_t i = 0; i < count; i++) {
+                TJSLogEntry* entry = &batch[i];
+                time_t seconds = (time_t)(entry->time / 1000);
+                struct tm tm;
+#ifdef _WIN32
+                localtime_s(&tm, &seconds);
+#else
+                localtime_r(&seconds, &tm);
+#endif
+                char level = levels[entry->level & 7];
+                length += strftime(buffer + length, 24, "%Y-%m-%d %H:%M:%S", &tm);
+                length += snprintf(buffer + length, 8, ".%03d %c ", (int)(entry->time % 1000), level);
+                memcpy(buffer + length, entry->message, entry->length);
+                length += entry->length;
+                buffer[length++] = '\n';
+            }
+
+            if (sinks & TJS_LOG_SINK_STDERR) {
+                tjs_logger_write_fd(STDERR_FILENO, buffer, length);
+            }
+
+            if (sinks & TJS_LOG_SINK_STDOUT) {
+                tjs_logger_write_fd(STDOUT_FILENO, buffer, length);
+            }
+
+            if ((sinks & TJS_LOG_SINK_FILE) && file >= 0) {
+                tjs_logger_write_fd(file, buffer, length);
+            }
+
+            free(buffer);
+        }
+    }
+
+    if (sinks & TJS_LOG_SINK_CONSOLE) {
+        tjs_logger_output_console(batch, count);
+    }
+
+#if defined(__linux__) || defined(__linux)
+    if (sinks & TJS_LOG_SINK_SYSLOG) {
+        for (uint32_t i = 0; i < count; i++) {
+            syslog(batch[i].level, "%s", batch[i].message);
+        }
+    }
+#endif
+}
+
+static void tjs_logger_thread(void* arg)
+{
+    TJSLogger* logger = arg;
+    TJSLogEntry batch[TJS_LOG_BATCH_SIZE];
+
+    uv_mutex_lock(&logger->mutex);
+    for (;;) {
+        while (logger->count == 0 && !logger->stopping) {
+            uv_cond_wait(&logger->ready, &logger->mutex);
+        }
+
+        if (logger->count == 0) {
+            break;
+        }
+
+        // 取出一批日志, 在锁外输出
+        uint32_t count = logger->count < TJS_LOG_BATCH_SIZE ? logger->count : TJS_LOG_BATCH_SIZE;
+        for (uint32_t i = 0; i < count; i++) {
+            batch[i] = logger->entries[logger->head];
+            logger->head = (logger->head + 1) % logger->capacity;
+            logger->pending_bytes -= batch[i].length + batch[i].echo_length;
+        }
+
+        logger->count -= count;
+        logger->busy = 1;
+
+        int sinks = logger->sinks;
+        uv_file file = logger->file;
+        uv_mutex_unlock(&logger->mutex);
+
+        tjs_logger_output(batch, count, sinks, file);
+        for (uint32_t i = 0; i < count; i++) {
+            free(batch[i].message);
+        }
+
+        uv_mutex_lock(&logger->mutex);
+        logger->busy = 0;
+        logger->written += count;
+        if (logger->count == 0) {
+            uv_cond_broadcast(&logger->drained);
+        }
+    }
+
+    uv_cond_broadcast(&logger->drained);
+    uv_mutex_unlock(&logger->mutex);
+}
+
+/** 等待缓冲区中的日志都输出完成 */
+static void tjs_logger_drain(TJSLogger* logger)
+{
+    uv_mutex_lock(&logger->mutex);
+    while (logger->started && (logger->count > 0 || logger->busy)) {
+        uv_cond_wait(&logger->drained, &logger->mutex);
+    }
+
+    uv_mutex_unlock(&logger->mutex);
+}
+
+/** 输出所有的日志并停止后台线程, 不关闭日志文件 */
+static void tjs_logger_stop_thread(TJSLogger* logger)
+{
+    uv_mutex_lock(&logger->mutex);
+    if (!logger->started) {
+        uv_mutex_unlock(&logger->mutex);
+        return;
+    }
+
+    logger->stopping = 1;
+    uv_cond_signal(&logger->ready);
+    uv_mutex_unlock(&logger->mutex);
+
+    // 后台线程会在退出前输出所有的日志
+    uv_thread_join(&logger->thread);
+
+    uv_mutex_lock(&logger->mutex);
+    logger->started = 0;
+    logger->stopping = 0;
+
+    free(logger->entries);
+    logger->entries = NULL;
+    logger->head = 0;
+    logger->count = 0;
+    logger->pending_bytes = 0;
+    uv_mutex_unlock(&logger->mutex);
+}
+
+static void tjs_logger_stop(TJSLogger* logger)
+{
+    tjs_logger_stop_thread(logger);
+
+    uv_mutex_lock(&logger->mutex);
+    uv_file file = logger->file;
+    logger->file = -1;
+    uv_mutex_unlock(&logger->mutex);
+
+    if (file >= 0) {
+        uv_fs_t req;
+        uv_fs_close(NULL, &req, file, NULL);
+        uv_fs_req_cleanup(&req);
+    }
+}
+
+static void tjs_logger_atexit(void)
+{
+    tjs_logger_stop(&tjs_logger);
+}
+
+/** 检查指定级别的日志是否会被输出, 用于在格式化之前过滤日志 */
+static int tjs_logger_accept_locked(TJSLogger* logger, int level)
+{
+    if (level > logger->level) {
+        logger->filtered++;
+        return 0;
+
+    } else if (logger->count >= logger->capacity || logger->pending_bytes >= logger->max_bytes) {
+        logger->dropped++;
+        return 0;
+    }
+
+    return 1;
+}
+
+static JSValue tjs_logger_accept(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSLogger* logger = tjs_logger_get();
+    int level = TJS_ToInt32(ctx, argv[0], 7);
+
+    uv_mutex_lock(&logger->mutex);
+    int ret = logger->started ? tjs_logger_accept_locked(logger, level) : 0;
+    uv_mutex_unlock(&logger->mutex);
+
+    return JS_NewBool(ctx, ret);
+}
+
+static JSValue tjs_logger_write(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSLogger* logger = tjs_logger_get();
+    int level = TJS_ToInt32(ctx, argv[0], 7);
+
+    size_t length = 0;
+    const char* message = JS_ToCStringLen(ctx, &length, argv[1]);
+    if (!message) {
+        return JS_EXCEPTION;
+    }
+
+    // 可选的控制台文本
+    size_t echo_length = 0;
+    const char* echo = NULL;
+    if (argc > 2 && JS_IsString(argv[2])) {
+        echo = JS_ToCStringLen(ctx, &echo_length, argv[2]);
+        if (!echo) {
+            JS_FreeCString(ctx, message);
+            return JS_EXCEPTION;
+        }
+    }
+
+    if (length > TJS_LOG_MAX_MESSAGE_SIZE) {
+        length = TJS_LOG_MAX_MESSAGE_SIZE;
+    }
+
+    if (echo_length > TJS_LOG_MAX_MESSAGE_SIZE) {
+        echo_length = TJS_LOG_MAX_MESSAGE_SIZE;
+    }
+
+    char* data = malloc(length + 1 + (echo ? echo_length + 1 : 0));
+    if (data) {
+        memcpy(data, message, length);
+        data[length] = '\0';
+
+        if (echo) {
+            memcpy(data + length + 1, echo, echo_length);
+            data[length + 1 + echo_length] = '\0';
+        }
+    }
+
+    JS_FreeCString(ctx, message);
+    if (echo) {
+        JS_FreeCString(ctx, echo);
+    }
+
+    if (!data) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    uv_mutex_lock(&logger->mutex);
+    if (!logger->started || !tjs_logger_accept_locked(logger, level)) {
+        uv_mutex_unlock(&logger->mutex);
+        free(data);
+        return JS_FALSE;
+    }
+
+    uint32_t index = (logger->head + logger->count) % logger->capacity;
+    TJSLogEntry* entry = &logger->entries[index];
+    entry->level = level & 7;
+    entry->time = tjs_logger_now();
+    entry->length = length;
+    entry->message = data;
+    entry->echo_length = echo ? echo_length : 0;
+    entry->echo = echo ? data + length + 1 : NULL;
+
+    logger->count++;
+    logger->pending_bytes += length + entry->echo_length;
+    uv_cond_signal(&logger->ready);
+    uv_mutex_unlock(&logger->mutex);
+
+    return JS_TRUE;
+}
+
+static JSValue tjs_logger_open(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSLogger* logger = tjs_logger_get();
+    JSValueConst options = argc > 0 ? argv[0] : JS_UNDEFINED;
+
+    int level = TJS_GetPropertyInt32(ctx, options, "level", logger->level);
+    int sinks = TJS_GetPropertyInt32(ctx, options, "sinks", TJS_LOG_SINK_STDERR);
+    uint32_t capacity = TJS_GetPropertyUint32(ctx, options, "capacity", TJS_LOG_DEFAULT_CAPACITY);
+    uint32_t max_bytes = TJS_GetPropertyUint32(ctx, options, "maxBytes", TJS_LOG_DEFAULT_MAX_BYTES);
+    if (capacity <= 0) {
+        capacity = TJS_LOG_DEFAULT_CAPACITY;
+    }
+
+    // 日志文件
+    uv_file file = -1;
+    JSValue value = JS_GetPropertyStr(ctx, options, "filename");
+    if (JS_IsString(value)) {
+        const char* filename = JS_ToCString(ctx, value);
+        if (filename) {
+            uv_fs_t req;
+            file = uv_fs_open(NULL, &req, filename, O_WRONLY | O_CREAT | O_APPEND, 0644, NULL);
+            uv_fs_req_cleanup(&req);
+            JS_FreeCString(ctx, filename);
+        }
+
+        if (file < 0) {
+            JS_FreeValue(ctx, value);
+            return tjs_throw_uv_error(ctx, file);
+        }
+    }
+
+    JS_FreeValue(ctx, value);
+
+    // syslog 进程名
+#if defined(__linux__) || defined(__linux)
+    value = JS_GetPropertyStr(ctx, options, "ident");
+    if ((sinks & TJS_LOG_SINK_SYSLOG) && JS_IsString(value)) {
+        const char* ident = JS_ToCString(ctx, value);
+        if (ident) {
+            char* old_ident = logger->ident;
+            logger->ident = strdup(ident);
+            openlog(logger->ident, LOG_CONS | LOG_PID, LOG_DAEMON);
+            free(old_ident);
+            JS_FreeCString(ctx, ident);
+        }
+    }
+
+    JS_FreeValue(ctx, value);
+#endif
+
+    // 更改缓冲区大小需要先停止后台线程, 日志文件保持打开
+    if (logger->started && capacity != logger->capacity) {
+        tjs_logger_stop_thread(logger);
+
+    } else {
+        // 缓冲区中的日志按原来的配置输出
+        tjs_logger_drain(logger);
+    }
+
+    uv_mutex_lock(&logger->mutex);
+    logger->level = level;
+    logger->sinks = sinks;
+    logger->max_bytes = max_bytes;
+
+    uv_file old_file = -1;
+    if (file >= 0 || !(sinks & TJS_LOG_SINK_FILE)) {
+        old_file = logger->file;
+        logger->file = file;
+    }
+
+    int ret = 0;
+    if (!logger->started) {
+        logger->capacity = capacity;
+        logger->entries = calloc(capacity, sizeof(TJSLogEntry));
+        logger->head = 0;
+        logger->count = 0;
+        logger->pending_bytes = 0;
+
+        ret = logger->entries ? uv_thread_create(&logger->thread, tjs_logger_thread, logger) : UV_ENOMEM;
+        if (ret == 0) {
+            static int atexit_registered = 0;
+            if (!atexit_registered) {
+                atexit_registered = 1;
+                atexit(tjs_logger_atexit);
+            }
+
+            logger->started = 1;
+
+        } else {
+            free(logger->entries);
+            logger->entries = NULL;
+        }
+    }
+
+    uv_mutex_unlock(&logger->mutex);
+
+    if (old_file >= 0) {
+        // 后台线程可能还在使用旧的文件
+        tjs_logger_drain(logger);
+
+        uv_fs_t req;
+        uv_fs_close(NULL, &req, old_file, NULL);
+        uv_fs_req_cleanup(&req);
+    }
+
+    if (ret != 0) {
+        return tjs_throw_uv_error(ctx, ret);
+    }
+
+    return JS_UNDEFINED;
+}
+
+static JSValue tjs_logger_close(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    tjs_logger_stop(tjs_logger_get());
+    return JS_UNDEFINED;
+}
+
+static JSValue tjs_logger_flush(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    tjs_logger_drain(tjs_logger_get());
+    return JS_UNDEFINED;
+}
+
+static JSValue tjs_logger_set_level(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSLogger* logger = tjs_logger_get();
+    int level = TJS_ToInt32(ctx, argv[0], 7);
+
+    uv_mutex_lock(&logger->mutex);
+    logger->level = level;
+    uv_mutex_unlock(&logger->mutex);
+
+    return JS_UNDEFINED;
+}
+
+static JSValue tjs_logger_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSLogger* logger = tjs_logger_get();
+
+    uv_mutex_lock(&logger->mutex);
+    uint64_t written = logger->written;
+    uint64_t dropped = logger->dropped;
+    uint64_t filtered = logger->filtered;
+    uint32_t pending = logger->count;
+    uint32_t capacity = logger->capacity;
+    int started = logger->started;
+    uv_mutex_unlock(&logger->mutex);
+
+    JSValue result = JS_NewObject(ctx);
+    JS_DefinePropertyValueStr(ctx, result, "written", JS_NewInt64(ctx, written), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, result, "dropped", JS_NewInt64(ctx, dropped), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, result, "filtered", JS_NewInt64(ctx, filtered), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, result, "pending", JS_NewUint32(ctx, pending), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, result, "capacity", JS_NewUint32(ctx, capacity), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, result, "started", JS_NewBool(ctx, started), JS_PROP_C_W_E);
+    return result;
+}
+
+static const JSCFunctionListEntry tjs_logger_funcs[] = {
+    JS_PROP_INT32_DEF("SINK_STDERR", TJS_LOG_SINK_STDERR, JS_PROP_ENUMERABLE),
+    JS_PROP_INT32_DEF("SINK_STDOUT", TJS_LOG_SINK_STDOUT, JS_PROP_ENUMERABLE),
+    JS_PROP_INT32_DEF("SINK_FILE", TJS_LOG_SINK_FILE, JS_PROP_ENUMERABLE),
+    JS_PROP_INT32_DEF("SINK_SYSLOG", TJS_LOG_SINK_SYSLOG, JS_PROP_ENUMERABLE),
+    JS_PROP_INT32_DEF("SINK_CONSOLE", TJS_LOG_SINK_CONSOLE, JS_PROP_ENUMERABLE),
+    TJS_CFUNC_DEF("accept", 1, tjs_logger_accept),
+    TJS_CFUNC_DEF("close", 0, tjs_logger_close),
+    TJS_CFUNC_DEF("flush", 0, tjs_logger_flush),
+    TJS_CFUNC_DEF("open", 1, tjs_logger_open),
+    TJS_CFUNC_DEF("setLevel", 1, tjs_logger_set_level),
+    TJS_CFUNC_DEF("stats", 0, tjs_logger_stats),
+    TJS_CFUNC_DEF("write", 2, tjs_logger_write),
+};
+
+void tjs_mod_logger_init(JSContext* ctx, JSModuleDef* m)
+{
+    JSValue logger = JS_NewObjectProto(ctx, JS_NULL);
+    JS_SetPropertyFunctionList(ctx, logger, tjs_logger_funcs, countof(tjs_logger_funcs));
+    JS_SetModuleExport(ctx, m, "logger", logger);
+}
+
+void tjs_mod_logger_export(JSContext* ctx, JSModuleDef* m)
+{
+    JS_AddModuleExport(ctx, m, "logger");
+}
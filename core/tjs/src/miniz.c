@@ -296,6 +296,45 @@ static JSValue zip_ungzip(JSContext* ctx, JSValueConst this_val, int argc, JSVal
     return TJS_NewArrayBuffer(ctx, uncompressed_data, size);
 }
 
+static JSValue zip_crc32(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    if (argc < 1) {
+        return JS_UNDEFINED;
+    }
+
+    tjs_buffer_t buffer = TJS_GetArrayBuffer(ctx, argv[0]);
+    if (JS_IsException(buffer.error)) {
+        return buffer.error;
+    }
+
+    uint32_t crc = 0;
+    if (argc > 1 && !JS_IsUndefined(argv[1]) && JS_ToUint32(ctx, &crc, argv[1])) {
+        return JS_EXCEPTION;
+    }
+
+    /* 可选的 offset 和 length 参数, 只计算一部分数据 */
+    uint64_t offset = 0;
+    if (argc > 2 && !JS_IsUndefined(argv[2]) && JS_ToIndex(ctx, &offset, argv[2])) {
+        return JS_EXCEPTION;
+    }
+
+    if (offset > buffer.length) {
+        offset = buffer.length;
+    }
+
+    uint64_t length = buffer.length - offset;
+    if (argc > 3 && !JS_IsUndefined(argv[3]) && JS_ToIndex(ctx, &length, argv[3])) {
+        return JS_EXCEPTION;
+    }
+
+    if (length > buffer.length - offset) {
+        length = buffer.length - offset;
+    }
+
+    mz_ulong result = mz_crc32(crc, buffer.data + offset, length);
+    return JS_NewUint32(ctx, (uint32_t)result);
+}
+
 static JSValue zip_extract(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
     if (argc < 2) {
@@ -366,6 +405,7 @@ static const JSCFunctionListEntry zip_reader_proto_funcs[] = {
 
 static const JSCFunctionListEntry zip_lib_funcs[] = {
     TJS_CFUNC_DEF("compress", 1, zip_compress),
+    TJS_CFUNC_DEF("crc32", 4, zip_crc32),
     TJS_CFUNC_DEF("uncompress", 1, zip_uncompress),
     TJS_CFUNC_DEF("ungzip", 1, zip_ungzip),
     TJS_CFUNC_DEF("extract", 2, zip_extract),
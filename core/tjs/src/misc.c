@@ -98,6 +98,12 @@ static JSValue tjs_exit(JSContext* ctx, JSValueConst this_val, int argc, JSValue
         }
     }
 
+    // --cpu-prof
+    TJSRuntime* qrt = TJS_GetRuntime(ctx);
+    if (qrt && !qrt->is_worker) {
+        tjs_profiler_write_file(qrt);
+    }
+
     exit(status);
     return JS_UNDEFINED;
 }
@@ -1,4 +1,5 @@
 #include "quickjs.h"
+#include "private.h"
 #include "tjs.h"
 #include "util/dbuffer.h"
 
@@ -6,6 +7,8 @@
 
 #include <string.h>
 
+extern void tjs_mod_mqtt_broker_init(JSContext* ctx, JSValue mqtt);
+
 enum _mqtt_parser_event {
     MQTT_PARSER_EVENT_MESSAGE_BEGIN = 0,
     MQTT_PARSER_EVENT_MESSAGE,
@@ -18,8 +21,677 @@ typedef struct _mqtt_parser {
     dbuffer_t buffer;
     size_t buffer_offset;
     size_t value_count;
+    int protocol_version;
 } mqtt_parser_t;
 
+/** 合并写入: 多个消息直接编码到同一个缓存区中, 一次发送 */
+typedef struct _mqtt_writer {
+    dbuffer_t buffer;
+    uint32_t count;
+} mqtt_writer_t;
+
+/** 消息 ID 分配器, 跳过还在使用中的 ID */
+typedef struct _mqtt_packet_ids {
+    uint8_t bits[65536 / 8];
+    uint32_t count;
+    uint16_t last_id;
+} mqtt_packet_ids_t;
+
+///////////////////////////////////////////////////////////////////////////////
+// mqtt 5
+
+/** MQTT 5 协议版本号 */
+#define MQTT5_PROTOCOL_VERSION 5
+
+/** 剩余长度的最大值 */
+#define MQTT5_MAX_REMAINING_LENGTH 268435455
+
+/** AUTH 消息类型, 只在 MQTT 5 中使用 */
+#define MQTT5_AUTH 15
+
+/** MQTT 5 属性值的数据类型 */
+enum _mqtt5_property_type {
+    MQTT5_TYPE_BYTE = 1,
+    MQTT5_TYPE_TWO_BYTE,
+    MQTT5_TYPE_FOUR_BYTE,
+    MQTT5_TYPE_VARINT,
+    MQTT5_TYPE_STRING,
+    MQTT5_TYPE_BINARY,
+    MQTT5_TYPE_STRING_PAIR
+};
+
+typedef struct _mqtt5_property {
+    uint8_t id;
+    uint8_t type;
+    const char* name;
+} mqtt5_property_t;
+
+/** 属性在 JS 中使用的名称, 用户属性 (0x26) 使用一个 `{ name: value }` 对象表示 */
+static const mqtt5_property_t mqtt5_properties[] = {
+    { 0x01, MQTT5_TYPE_BYTE, "payloadFormatIndicator" },
+    { 0x02, MQTT5_TYPE_FOUR_BYTE, "messageExpiryInterval" },
+    { 0x03, MQTT5_TYPE_STRING, "contentType" },
+    { 0x08, MQTT5_TYPE_STRING, "responseTopic" },
+    { 0x09, MQTT5_TYPE_BINARY, "correlationData" },
+    { 0x0B, MQTT5_TYPE_VARINT, "subscriptionIdentifier" },
+    { 0x11, MQTT5_TYPE_FOUR_BYTE, "sessionExpiryInterval" },
+    { 0x12, MQTT5_TYPE_STRING, "assignedClientIdentifier" },
+    { 0x13, MQTT5_TYPE_TWO_BYTE, "serverKeepAlive" },
+    { 0x15, MQTT5_TYPE_STRING, "authenticationMethod" },
+    { 0x16, MQTT5_TYPE_BINARY, "authenticationData" },
+    { 0x17, MQTT5_TYPE_BYTE, "requestProblemInformation" },
+    { 0x18, MQTT5_TYPE_FOUR_BYTE, "willDelayInterval" },
+    { 0x19, MQTT5_TYPE_BYTE, "requestResponseInformation" },
+    { 0x1A, MQTT5_TYPE_STRING, "responseInformation" },
+    { 0x1C, MQTT5_TYPE_STRING, "serverReference" },
+    { 0x1F, MQTT5_TYPE_STRING, "reasonString" },
+    { 0x21, MQTT5_TYPE_TWO_BYTE, "receiveMaximum" },
+    { 0x22, MQTT5_TYPE_TWO_BYTE, "topicAliasMaximum" },
+    { 0x23, MQTT5_TYPE_TWO_BYTE, "topicAlias" },
+    { 0x24, MQTT5_TYPE_BYTE, "maximumQoS" },
+    { 0x25, MQTT5_TYPE_BYTE, "retainAvailable" },
+    { 0x26, MQTT5_TYPE_STRING_PAIR, "userProperties" },
+    { 0x27, MQTT5_TYPE_FOUR_BYTE, "maximumPacketSize" },
+    { 0x28, MQTT5_TYPE_BYTE, "wildcardSubscriptionAvailable" },
+    { 0x29, MQTT5_TYPE_BYTE, "subscriptionIdentifiersAvailable" },
+    { 0x2A, MQTT5_TYPE_BYTE, "sharedSubscriptionAvailable" }
+};
+
+/** 顺序读取消息内容, 越界时设置 error 并返回 0 */
+typedef struct _mqtt5_reader {
+    const uint8_t* data;
+    size_t length;
+    size_t offset;
+    int error;
+} mqtt5_reader_t;
+
+static const mqtt5_property_t* mqtt5_property_find_id(uint8_t id)
+{
+    for (size_t i = 0; i < countof(mqtt5_properties); i++) {
+        if (mqtt5_properties[i].id == id) {
+            return &mqtt5_properties[i];
+        }
+    }
+
+    return NULL;
+}
+
+static const mqtt5_property_t* mqtt5_property_find_name(const char* name)
+{
+    for (size_t i = 0; i < countof(mqtt5_properties); i++) {
+        if (strcmp(mqtt5_properties[i].name, name) == 0) {
+            return &mqtt5_properties[i];
+        }
+    }
+
+    return NULL;
+}
+
+static int mqtt5_varint_size(uint32_t value)
+{
+    return (value < 128) ? 1 : (value < 16384) ? 2 : (value < 2097152) ? 3 : 4;
+}
+
+static int mqtt5_put_u16(dbuffer_t* out, uint32_t value)
+{
+    uint8_t data[2] = { value >> 8, value };
+    return dbuffer_put(out, data, sizeof(data));
+}
+
+static int mqtt5_put_u32(dbuffer_t* out, uint32_t value)
+{
+    uint8_t data[4] = { value >> 24, value >> 16, value >> 8, value };
+    return dbuffer_put(out, data, sizeof(data));
+}
+
+static int mqtt5_put_varint(dbuffer_t* out, uint32_t value)
+{
+    uint8_t data[4];
+    int length = MQTTPacket_encode(data, value);
+    return dbuffer_put(out, data, length);
+}
+
+static int mqtt5_put_string(dbuffer_t* out, const void* data, size_t length)
+{
+    if (length > 0xffff || mqtt5_put_u16(out, length)) {
+        return -1;
+    }
+
+    return length ? dbuffer_put(out, data, length) : 0;
+}
+
+static uint32_t mqtt5_read_byte(mqtt5_reader_t* reader)
+{
+    if (reader->offset + 1 > reader->length) {
+        reader->error = 1;
+        return 0;
+    }
+
+    return reader->data[reader->offset++];
+}
+
+static uint32_t mqtt5_read_u16(mqtt5_reader_t* reader)
+{
+    if (reader->offset + 2 > reader->length) {
+        reader->error = 1;
+        return 0;
+    }
+
+    const uint8_t* data = reader->data + reader->offset;
+    reader->offset += 2;
+    return (data[0] << 8) | data[1];
+}
+
+static uint32_t mqtt5_read_u32(mqtt5_reader_t* reader)
+{
+    if (reader->offset + 4 > reader->length) {
+        reader->error = 1;
+        return 0;
+    }
+
+    const uint8_t* data = reader->data + reader->offset;
+    reader->offset += 4;
+    return ((uint32_t)data[0] << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
+}
+
+static uint32_t mqtt5_read_varint(mqtt5_reader_t* reader)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++) {
+        uint32_t byte = mqtt5_read_byte(reader);
+        value |= (byte & 0x7f) << (7 * i);
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+
+    reader->error = 1;
+    return 0;
+}
+
+static const uint8_t* mqtt5_read_string(mqtt5_reader_t* reader, size_t* length)
+{
+    *length = mqtt5_read_u16(reader);
+    if (reader->error || reader->offset + *length > reader->length) {
+        reader->error = 1;
+        *length = 0;
+        return NULL;
+    }
+
+    const uint8_t* data = reader->data + reader->offset;
+    reader->offset += *length;
+    return data;
+}
+
+static int mqtt5_encode_string_value(JSContext* ctx, dbuffer_t* out, JSValueConst value)
+{
+    size_t length;
+    const char* string = JS_ToCStringLen(ctx, &length, value);
+    if (!string) {
+        return -1;
+    }
+
+    int ret = mqtt5_put_string(out, string, length);
+    JS_FreeCString(ctx, string);
+    if (ret) {
+        JS_ThrowRangeError(ctx, "Invalid MQTT string");
+    }
+
+    return ret;
+}
+
+static int mqtt5_encode_property(JSContext* ctx, dbuffer_t* out, const mqtt5_property_t* property, JSValueConst value)
+{
+    uint32_t number = 0;
+    if (property->type <= MQTT5_TYPE_VARINT && JS_ToUint32(ctx, &number, value)) {
+        return -1;
+    }
+
+    int ret = 0;
+    switch (property->type) {
+    case MQTT5_TYPE_BYTE:
+        ret = dbuffer_putc(out, property->id) || dbuffer_putc(out, number);
+        break;
+
+    case MQTT5_TYPE_TWO_BYTE:
+        ret = dbuffer_putc(out, property->id) || mqtt5_put_u16(out, number);
+        break;
+
+    case MQTT5_TYPE_FOUR_BYTE:
+        ret = dbuffer_putc(out, property->id) || mqtt5_put_u32(out, number);
+        break;
+
+    case MQTT5_TYPE_VARINT:
+        if (number > MQTT5_MAX_REMAINING_LENGTH) {
+            JS_ThrowRangeError(ctx, "Invalid MQTT property: %s", property->name);
+            return -1;
+        }
+
+        ret = dbuffer_putc(out, property->id) || mqtt5_put_varint(out, number);
+        break;
+
+    case MQTT5_TYPE_STRING:
+        if (dbuffer_putc(out, property->id)) {
+            ret = -1;
+            break;
+        }
+
+        return mqtt5_encode_string_value(ctx, out, value);
+
+    case MQTT5_TYPE_BINARY: {
+        tjs_buffer_t data = TJS_ToArrayBuffer(ctx, value);
+        if (JS_IsException(data.error)) {
+            return -1;
+        }
+
+        ret = dbuffer_putc(out, property->id) || mqtt5_put_string(out, data.data, data.length);
+        if (data.is_string) {
+            JS_FreeCString(ctx, (const char*)data.data);
+        }
+
+        break;
+    }
+
+    case MQTT5_TYPE_STRING_PAIR: {
+        JSPropertyEnum* tab = NULL;
+        uint32_t length = 0;
+        if (!JS_IsObject(value) || JS_GetOwnPropertyNames(ctx, &tab, &length, value, JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY)) {
+            JS_ThrowTypeError(ctx, "Invalid MQTT property: %s", property->name);
+            return -1;
+        }
+
+        for (uint32_t i = 0; i < length && ret == 0; i++) {
+            JSValue name = JS_AtomToString(ctx, tab[i].atom);
+            JSValue item = JS_GetProperty(ctx, value, tab[i].atom);
+            if (dbuffer_putc(out, property->id)) {
+                JS_ThrowOutOfMemory(ctx);
+                ret = -1;
+
+            } else if (mqtt5_encode_string_value(ctx, out, name) || mqtt5_encode_string_value(ctx, out, item)) {
+                ret = -1;
+            }
+            JS_FreeValue(ctx, name);
+            JS_FreeValue(ctx, item);
+        }
+
+        JS_FreePropEnum(ctx, tab, length);
+        return ret ? -1 : 0;
+    }
+    }
+
+    if (ret) {
+        JS_ThrowOutOfMemory(ctx);
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * 编码属性列表 (不包括前面的属性长度)
+ * @param properties 属性对象, 值为 undefined 的属性会被忽略
+ * @return 出错时返回 -1 并抛出异常
+ */
+static int mqtt5_encode_properties(JSContext* ctx, dbuffer_t* out, JSValueConst properties)
+{
+    if (!JS_IsObject(properties)) {
+        return 0;
+    }
+
+    JSPropertyEnum* tab = NULL;
+    uint32_t length = 0;
+    if (JS_GetOwnPropertyNames(ctx, &tab, &length, properties, JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY)) {
+        return -1;
+    }
+
+    int ret = 0;
+    for (uint32_t i = 0; i < length && ret == 0; i++) {
+        JSValue value = JS_GetProperty(ctx, properties, tab[i].atom);
+        if (JS_IsException(value)) {
+            ret = -1;
+            break;
+
+        } else if (JS_IsUndefined(value)) {
+            continue;
+        }
+
+        const char* name = JS_AtomToCString(ctx, tab[i].atom);
+        const mqtt5_property_t* property = name ? mqtt5_property_find_name(name) : NULL;
+        if (property) {
+            ret = mqtt5_encode_property(ctx, out, property, value);
+
+        } else {
+            JS_ThrowTypeError(ctx, "Unknown MQTT property: %s", name ? name : "");
+            ret = -1;
+        }
+
+        JS_FreeCString(ctx, name);
+        JS_FreeValue(ctx, value);
+    }
+
+    JS_FreePropEnum(ctx, tab, length);
+    return ret;
+}
+
+/**
+ * 编码属性长度和属性列表
+ */
+static int mqtt5_put_properties(JSContext* ctx, dbuffer_t* out, JSValueConst properties)
+{
+    dbuffer_t buffer;
+    dbuffer_init(&buffer);
+    if (mqtt5_encode_properties(ctx, &buffer, properties)) {
+        dbuffer_free(&buffer);
+        return -1;
+    }
+
+    int ret = mqtt5_put_varint(out, buffer.size) || (buffer.size && dbuffer_put(out, buffer.buf, buffer.size));
+    dbuffer_free(&buffer);
+    if (ret) {
+        JS_ThrowOutOfMemory(ctx);
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * 解码属性列表, 没有属性时不添加 `properties` 字段
+ */
+static void mqtt5_read_properties(JSContext* ctx, mqtt5_reader_t* reader, JSValueConst message)
+{
+    uint32_t length = mqtt5_read_varint(reader);
+    if (reader->error || length == 0) {
+        return;
+
+    } else if (reader->offset + length > reader->length) {
+        reader->error = 1;
+        return;
+    }
+
+    mqtt5_reader_t properties_reader = { reader->data, reader->offset + length, reader->offset, 0 };
+    mqtt5_reader_t* r = &properties_reader;
+    reader->offset += length;
+
+    JSValue properties = JS_NewObject(ctx);
+    JSValue user_properties = JS_UNDEFINED;
+
+    while (r->offset < r->length && !r->error) {
+        const mqtt5_property_t* property = mqtt5_property_find_id(mqtt5_read_byte(r));
+        if (!property) {
+            r->error = 1;
+            break;
+        }
+
+        JSValue value = JS_UNDEFINED;
+        size_t size = 0;
+        const uint8_t* data = NULL;
+
+        switch (property->type) {
+        case MQTT5_TYPE_BYTE:
+            value = JS_NewUint32(ctx, mqtt5_read_byte(r));
+            break;
+
+        case MQTT5_TYPE_TWO_BYTE:
+            value = JS_NewUint32(ctx, mqtt5_read_u16(r));
+            break;
+
+        case MQTT5_TYPE_FOUR_BYTE:
+            value = JS_NewUint32(ctx, mqtt5_read_u32(r));
+            break;
+
+        case MQTT5_TYPE_VARINT:
+            value = JS_NewUint32(ctx, mqtt5_read_varint(r));
+            break;
+
+        case MQTT5_TYPE_STRING:
+            data = mqtt5_read_string(r, &size);
+            value = JS_NewStringLen(ctx, (const char*)data, size);
+            break;
+
+        case MQTT5_TYPE_BINARY:
+            data = mqtt5_read_string(r, &size);
+            value = JS_NewArrayBufferCopy(ctx, data, size);
+            break;
+
+        case MQTT5_TYPE_STRING_PAIR: {
+            size_t name_size = 0;
+            const uint8_t* name = mqtt5_read_string(r, &name_size);
+            data = mqtt5_read_string(r, &size);
+            if (r->error) {
+                break;
+            }
+
+            if (JS_IsUndefined(user_properties)) {
+                user_properties = JS_NewObject(ctx);
+            }
+
+            JSAtom atom = JS_NewAtomLen(ctx, (const char*)name, name_size);
+            JS_DefinePropertyValue(ctx, user_properties, atom, JS_NewStringLen(ctx, (const char*)data, size), JS_PROP_C_W_E);
+            JS_FreeAtom(ctx, atom);
+            continue;
+        }
+        }
+
+        if (r->error) {
+            JS_FreeValue(ctx, value);
+            break;
+        }
+
+        JS_DefinePropertyValueStr(ctx, properties, property->name, value, JS_PROP_C_W_E);
+    }
+
+    if (!JS_IsUndefined(user_properties)) {
+        JS_DefinePropertyValueStr(ctx, properties, "userProperties", user_properties, JS_PROP_C_W_E);
+    }
+
+    reader->error = r->error;
+    JS_DefinePropertyValueStr(ctx, message, "properties", properties, JS_PROP_C_W_E);
+}
+
+/**
+ * 解码 MQTT 5 消息的可变头部和有效载荷
+ * - 和 MQTT 3.1.1 保持相同的字段名, 另外添加 `reasonCode` 和 `properties`
+ * - CONNACK 的 `returnCode` 即为原因码
+ */
+static void mqtt5_decode_message(JSContext* ctx, JSValueConst message, uint8_t flags, const uint8_t* data, size_t length)
+{
+    mqtt5_reader_t reader = { data, length, 0, 0 };
+    mqtt5_reader_t* r = &reader;
+    uint32_t type = flags >> 4;
+
+    if (type == PUBLISH) {
+        int qos = (flags >> 1) & 0x03;
+        size_t topic_length = 0;
+        const uint8_t* topic = mqtt5_read_string(r, &topic_length);
+        uint32_t packet_id = (qos > 0) ? mqtt5_read_u16(r) : 0;
+        if (r->error) {
+            return;
+        }
+
+        JS_DefinePropertyValueStr(ctx, message, "topic", JS_NewStringLen(ctx, (const char*)topic, topic_length), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, message, "dup", JS_NewInt32(ctx, (flags >> 3) & 0x01), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, message, "qos", JS_NewInt32(ctx, qos), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, message, "packetId", JS_NewInt32(ctx, packet_id), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, message, "retained", JS_NewInt32(ctx, flags & 0x01), JS_PROP_C_W_E);
+
+        mqtt5_read_properties(ctx, r, message);
+        if (!r->error && r->offset < r->length) {
+            JS_DefinePropertyValueStr(ctx, message, "payload", JS_NewArrayBufferCopy(ctx, data + r->offset, r->length - r->offset), JS_PROP_C_W_E);
+        }
+
+    } else if (type == CONNACK) {
+        uint32_t session_present = mqtt5_read_byte(r) & 0x01;
+        uint32_t reason_code = mqtt5_read_byte(r);
+        if (r->error) {
+            return;
+        }
+
+        JS_DefinePropertyValueStr(ctx, message, "returnCode", JS_NewInt32(ctx, reason_code), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, message, "reasonCode", JS_NewInt32(ctx, reason_code), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, message, "sessionPresent", JS_NewInt32(ctx, session_present), JS_PROP_C_W_E);
+        mqtt5_read_properties(ctx, r, message);
+
+    } else if (type == PUBACK || type == PUBREC || type == PUBREL || type == PUBCOMP) {
+        uint32_t packet_id = mqtt5_read_u16(r);
+        if (r->error) {
+            return;
+        }
+
+        // 剩余长度为 2 时原因码为 0
+        uint32_t reason_code = (r->length > 2) ? mqtt5_read_byte(r) : 0;
+        JS_DefinePropertyValueStr(ctx, message, "dup", JS_NewInt32(ctx, (flags >> 3) & 0x01), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, message, "packetId", JS_NewInt32(ctx, packet_id), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, message, "reasonCode", JS_NewInt32(ctx, reason_code), JS_PROP_C_W_E);
+        if (r->length > 3) {
+            mqtt5_read_properties(ctx, r, message);
+        }
+
+    } else if (type == SUBACK || type == UNSUBACK) {
+        uint32_t packet_id = mqtt5_read_u16(r);
+        mqtt5_read_properties(ctx, r, message);
+        if (r->error) {
+            return;
+        }
+
+        // 每个主题过滤器一个原因码, SUBACK 的 `qos` 为第一个原因码
+        uint32_t count = r->length - r->offset;
+        JSValue reason_codes = JS_NewArray(ctx);
+        for (uint32_t i = 0; i < count; i++) {
+            JS_SetPropertyUint32(ctx, reason_codes, i, JS_NewInt32(ctx, data[r->offset + i]));
+        }
+
+        JS_DefinePropertyValueStr(ctx, message, "packetId", JS_NewInt32(ctx, packet_id), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, message, "count", JS_NewInt32(ctx, count), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, message, "reasonCodes", reason_codes, JS_PROP_C_W_E);
+        if (type == SUBACK && count > 0) {
+            JS_DefinePropertyValueStr(ctx, message, "qos", JS_NewInt32(ctx, data[r->offset]), JS_PROP_C_W_E);
+        }
+
+    } else if (type == DISCONNECT || type == MQTT5_AUTH) {
+        // 剩余长度为 0 时原因码为 0
+        uint32_t reason_code = (r->length > 0) ? mqtt5_read_byte(r) : 0;
+        JS_DefinePropertyValueStr(ctx, message, "reasonCode", JS_NewInt32(ctx, reason_code), JS_PROP_C_W_E);
+        if (r->length > 1) {
+            mqtt5_read_properties(ctx, r, message);
+        }
+    }
+}
+
+/**
+ * 编码 MQTT 5 PUBLISH 消息并添加到 out 后面
+ * @param properties 属性对象, 使用主题别名时 topic 可以为空字符串
+ */
+static int mqtt5_serialize_publish(JSContext* ctx, dbuffer_t* out, const char* topic, size_t topic_length,
+    const uint8_t* payload, size_t payload_length, int dup, int qos, int retained, int packet_id, JSValueConst properties)
+{
+    dbuffer_t buffer;
+    dbuffer_init(&buffer);
+    if (mqtt5_encode_properties(ctx, &buffer, properties)) {
+        dbuffer_free(&buffer);
+        return -1;
+    }
+
+    size_t remaining_length = 2 + topic_length + (qos > 0 ? 2 : 0)
+        + mqtt5_varint_size(buffer.size) + buffer.size + payload_length;
+    if (topic_length > 0xffff || remaining_length > MQTT5_MAX_REMAINING_LENGTH) {
+        dbuffer_free(&buffer);
+        JS_ThrowRangeError(ctx, "Invalid publish message");
+        return -1;
+    }
+
+    uint8_t header = (PUBLISH << 4) | ((dup & 0x01) << 3) | ((qos & 0x03) << 1) | (retained & 0x01);
+    int ret = dbuffer_realloc(out, out->size + remaining_length + 5)
+        || dbuffer_putc(out, header)
+        || mqtt5_put_varint(out, remaining_length)
+        || mqtt5_put_string(out, topic, topic_length)
+        || (qos > 0 && mqtt5_put_u16(out, packet_id))
+        || mqtt5_put_varint(out, buffer.size)
+        || (buffer.size && dbuffer_put(out, buffer.buf, buffer.size))
+        || (payload_length && dbuffer_put(out, payload, payload_length));
+
+    dbuffer_free(&buffer);
+    if (ret) {
+        JS_ThrowOutOfMemory(ctx);
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * 添加固定头部, 返回完整的消息
+ * @param body 可变头部和有效载荷, 会被释放
+ */
+static JSValue mqtt5_new_packet(JSContext* ctx, uint8_t header, dbuffer_t* body)
+{
+    if (body->size > MQTT5_MAX_REMAINING_LENGTH) {
+        dbuffer_free(body);
+        return JS_ThrowRangeError(ctx, "MQTT packet is too large");
+    }
+
+    uint8_t head[5] = { header };
+    size_t head_length = 1 + MQTTPacket_encode(head + 1, body->size);
+    size_t length = head_length + body->size;
+    uint8_t* buffer = js_malloc(ctx, length);
+    if (!buffer) {
+        dbuffer_free(body);
+        return JS_EXCEPTION;
+    }
+
+    memcpy(buffer, head, head_length);
+    if (body->size) {
+        memcpy(buffer + head_length, body->buf, body->size);
+    }
+
+    dbuffer_free(body);
+    return TJS_NewArrayBuffer(ctx, buffer, length);
+}
+
+/**
+ * 编码 MQTT 5 CONNECT 消息, `options.properties` 为 CONNECT 消息的属性
+ */
+static JSValue mqtt5_encode_connect(JSContext* ctx, JSValueConst options, MQTTPacket_connectData* data)
+{
+    uint8_t flags = (data->cleansession ? 0x02 : 0)
+        | (data->username.cstring ? 0x80 : 0)
+        | (data->password.cstring ? 0x40 : 0);
+
+    const char* client_id = data->clientID.cstring ? data->clientID.cstring : "";
+    const char* username = data->username.cstring;
+    const char* password = data->password.cstring;
+
+    dbuffer_t body;
+    dbuffer_init(&body);
+
+    int ret = mqtt5_put_string(&body, "MQTT", 4)
+        || dbuffer_putc(&body, MQTT5_PROTOCOL_VERSION)
+        || dbuffer_putc(&body, flags)
+        || mqtt5_put_u16(&body, data->keepAliveInterval);
+    if (ret) {
+        dbuffer_free(&body);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    JSValue properties = JS_GetPropertyStr(ctx, options, "properties");
+    ret = mqtt5_put_properties(ctx, &body, properties);
+    JS_FreeValue(ctx, properties);
+    if (ret) {
+        dbuffer_free(&body);
+        return JS_EXCEPTION;
+    }
+
+    ret = mqtt5_put_string(&body, client_id, strlen(client_id))
+        || (username && mqtt5_put_string(&body, username, strlen(username)))
+        || (password && mqtt5_put_string(&body, password, strlen(password)));
+    if (ret) {
+        dbuffer_free(&body);
+        return JS_ThrowRangeError(ctx, "Invalid connect options");
+    }
+
+    return mqtt5_new_packet(ctx, CONNECT << 4, &body);
+}
+
 static JSClassID mqtt_parser_class_id;
 static mqtt_parser_t* mqtt_parser_get(JSContext* ctx, JSValueConst obj);
 static void mqtt_parser_event_emit(mqtt_parser_t* parser, int event, JSValue arg);
@@ -106,6 +778,13 @@ static JSValue mqtt_parser_constructor(JSContext* ctx, JSValueConst new_target,
     parser->buffer_offset = 0;
     parser->value_count = 0;
 
+    // options.protocolVersion: 4 (MQTT 3.1.1) 或 5 (MQTT 5)
+    if (argc > 0 && JS_IsObject(argv[0])) {
+        JSValue value = JS_GetPropertyStr(ctx, argv[0], "protocolVersion");
+        parser->protocol_version = TJS_ToInt32(ctx, value, 4);
+        JS_FreeValue(ctx, value);
+    }
+
     for (int i = 0; i < MQTT_PARSER_EVENT_MAX; i++) {
         parser->events[i] = JS_UNDEFINED;
     }
@@ -134,7 +813,10 @@ static int mqtt_parser_on_message(mqtt_parser_t* parser, uint8_t* packet, int of
     JS_DefinePropertyValueStr(ctx, message, "type", JS_NewInt32(ctx, type), JS_PROP_C_W_E);
     JS_DefinePropertyValueStr(ctx, message, "length", JS_NewInt32(ctx, message_size), JS_PROP_C_W_E);
 
-    if (type == PUBLISH) {
+    if (parser->protocol_version == MQTT5_PROTOCOL_VERSION) {
+        mqtt5_decode_message(ctx, message, packet[0], packet + offset, packet_length);
+
+    } else if (type == PUBLISH) {
         unsigned char dup;
         int qos;
         unsigned char retained;
@@ -443,7 +1125,7 @@ static JSValue mqtt_encode_connect(JSContext* ctx, JSValueConst this_val, int ar
 
     // username
     JSValue usernameString = JS_GetPropertyStr(ctx, options, "username");
-    const char* username = JS_ToCString(ctx, usernameString);
+    const char* username = JS_IsUndefined(usernameString) || JS_IsNull(usernameString) ? NULL : JS_ToCString(ctx, usernameString);
     JS_FreeValue(ctx, usernameString);
     if (username) {
         data.username.cstring = (char*)username;
@@ -451,7 +1133,7 @@ static JSValue mqtt_encode_connect(JSContext* ctx, JSValueConst this_val, int ar
 
     // password
     JSValue passwordString = JS_GetPropertyStr(ctx, options, "password");
-    const char* password = JS_ToCString(ctx, passwordString);
+    const char* password = JS_IsUndefined(passwordString) || JS_IsNull(passwordString) ? NULL : JS_ToCString(ctx, passwordString);
     JS_FreeValue(ctx, passwordString);
     if (password) {
         data.password.cstring = (char*)password;
@@ -487,10 +1169,22 @@ static JSValue mqtt_encode_connect(JSContext* ctx, JSValueConst this_val, int ar
         }
     }
 
+    // protocolVersion
+    JSValue versionValue = JS_GetPropertyStr(ctx, options, "protocolVersion");
+    int protocol_version = TJS_ToInt32(ctx, versionValue, 4);
+    JS_FreeValue(ctx, versionValue);
+
     // encode
-    int buffer_length = 200;
-    uint8_t* buffer = js_malloc(ctx, buffer_length);
-    int len = MQTTSerialize_connect(buffer, buffer_length, &data);
+    JSValue result;
+    if (protocol_version == MQTT5_PROTOCOL_VERSION) {
+        result = mqtt5_encode_connect(ctx, options, &data);
+
+    } else {
+        int buffer_length = 200;
+        uint8_t* buffer = js_malloc(ctx, buffer_length);
+        int len = MQTTSerialize_connect(buffer, buffer_length, &data);
+        result = TJS_NewArrayBuffer(ctx, buffer, len);
+    }
 
     if (username) {
         JS_FreeCString(ctx, username);
@@ -504,7 +1198,7 @@ static JSValue mqtt_encode_connect(JSContext* ctx, JSValueConst this_val, int ar
         JS_FreeCString(ctx, clientId);
     }
 
-    return TJS_NewArrayBuffer(ctx, buffer, len);
+    return result;
 }
 
 static JSValue mqtt_encode_ping(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
@@ -516,9 +1210,29 @@ static JSValue mqtt_encode_ping(JSContext* ctx, JSValueConst this_val, int argc,
     return TJS_NewArrayBuffer(ctx, buffer, len);
 }
 
+/**
+ * encodeDisconnect([reasonCode, properties])
+ * - 指定了原因码时编码为 MQTT 5 消息
+ */
 static JSValue mqtt_encode_disconnect(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
     CHECK_NOT_NULL(ctx);
+    if (argc > 0 && !JS_IsUndefined(argv[0])) {
+        dbuffer_t body;
+        dbuffer_init(&body);
+
+        int reason_code = TJS_ToInt32(ctx, argv[0], 0);
+        if (dbuffer_putc(&body, reason_code)) {
+            return JS_ThrowOutOfMemory(ctx);
+
+        } else if (argc > 1 && mqtt5_put_properties(ctx, &body, argv[1])) {
+            dbuffer_free(&body);
+            return JS_EXCEPTION;
+        }
+
+        return mqtt5_new_packet(ctx, DISCONNECT << 4, &body);
+    }
+
     int buffer_length = 200;
     uint8_t* buffer = js_malloc(ctx, buffer_length);
     int len = MQTTSerialize_disconnect(buffer, buffer_length);
@@ -545,6 +1259,30 @@ static JSValue mqtt_encode_subscribe(JSContext* ctx, JSValueConst this_val, int
     JS_ToInt32(ctx, &packet_id, argv[2]);
 
     JSValue result = JS_UNDEFINED;
+
+    // MQTT 5: encodeSubscribe(topic, dup, packetId, properties, options)
+    if (argc > 3 && JS_IsObject(argv[3])) {
+        int options = (argc > 4) ? TJS_ToInt32(ctx, argv[4], 0) : 0;
+
+        dbuffer_t body;
+        dbuffer_init(&body);
+        if (mqtt5_put_u16(&body, packet_id)) {
+            result = JS_ThrowOutOfMemory(ctx);
+
+        } else if (mqtt5_put_properties(ctx, &body, argv[3])) {
+            result = JS_EXCEPTION;
+
+        } else if (mqtt5_put_string(&body, topic, topic_length) || dbuffer_putc(&body, options)) {
+            result = JS_ThrowRangeError(ctx, "Invalid topic filter");
+
+        } else {
+            result = mqtt5_new_packet(ctx, (SUBSCRIBE << 4) | 0x02, &body);
+        }
+
+        dbuffer_free(&body);
+        goto exit;
+    }
+
     int buffer_length = topic_length + 100;
     uint8_t* buffer = js_malloc(ctx, buffer_length);
 
@@ -588,6 +1326,28 @@ static JSValue mqtt_encode_unsubscribe(JSContext* ctx, JSValueConst this_val, in
     JS_ToInt32(ctx, &packet_id, argv[2]);
 
     JSValue result = JS_UNDEFINED;
+
+    // MQTT 5: encodeUnsubscribe(topic, dup, packetId, properties)
+    if (argc > 3 && JS_IsObject(argv[3])) {
+        dbuffer_t body;
+        dbuffer_init(&body);
+        if (mqtt5_put_u16(&body, packet_id)) {
+            result = JS_ThrowOutOfMemory(ctx);
+
+        } else if (mqtt5_put_properties(ctx, &body, argv[3])) {
+            result = JS_EXCEPTION;
+
+        } else if (mqtt5_put_string(&body, topic, topic_length)) {
+            result = JS_ThrowRangeError(ctx, "Invalid topic filter");
+
+        } else {
+            result = mqtt5_new_packet(ctx, (UNSUBSCRIBE << 4) | 0x02, &body);
+        }
+
+        dbuffer_free(&body);
+        goto exit;
+    }
+
     int buffer_length = topic_length + 100;
     uint8_t* buffer = js_malloc(ctx, buffer_length);
 
@@ -644,6 +1404,22 @@ static JSValue mqtt_encode_publish(JSContext* ctx, JSValueConst this_val, int ar
     JS_ToInt32(ctx, &packet_id, argv[5]);
 
     JSValue result = JS_UNDEFINED;
+
+    // MQTT 5: 第 7 个参数为属性对象
+    if (argc > 6 && JS_IsObject(argv[6])) {
+        dbuffer_t buffer;
+        dbuffer_init(&buffer);
+        if (mqtt5_serialize_publish(ctx, &buffer, topic, topic_length, payload.data, payload.length, dup, qos, retained, packet_id, argv[6])) {
+            result = JS_EXCEPTION;
+
+        } else {
+            result = JS_NewArrayBufferCopy(ctx, buffer.buf, buffer.size);
+        }
+
+        dbuffer_free(&buffer);
+        goto exit;
+    }
+
     int buffer_length = payload.length + topic_length + 256;
     uint8_t* buffer = js_malloc(ctx, buffer_length);
 
@@ -669,10 +1445,357 @@ exit:
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// mqtt writer
+
+static JSClassID mqtt_writer_class_id;
+
+static void mqtt_writer_finalizer(JSRuntime* runtime, JSValue value)
+{
+    mqtt_writer_t* writer = JS_GetOpaque(value, mqtt_writer_class_id);
+    if (writer) {
+        dbuffer_free(&writer->buffer);
+        free(writer);
+    }
+}
+
+static JSClassDef mqtt_writer_class = {
+    "MQTTWriter",
+    .finalizer = mqtt_writer_finalizer,
+};
+
+static mqtt_writer_t* mqtt_writer_get(JSContext* ctx, JSValueConst obj)
+{
+    return JS_GetOpaque2(ctx, obj, mqtt_writer_class_id);
+}
+
+static JSValue mqtt_writer_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst* argv)
+{
+    JSValue result = JS_NewObjectClass(ctx, mqtt_writer_class_id);
+    if (JS_IsException(result)) {
+        return result;
+    }
+
+    mqtt_writer_t* writer = calloc(1, sizeof(*writer));
+    if (!writer) {
+        JS_FreeValue(ctx, result);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    dbuffer_init(&writer->buffer);
+
+    JS_SetOpaque(result, writer);
+    return result;
+}
+
+static JSValue mqtt_writer_count(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_writer_t* writer = mqtt_writer_get(ctx, this_val);
+    if (!writer) {
+        return JS_EXCEPTION;
+    }
+
+    return JS_NewUint32(ctx, writer->count);
+}
+
+/**
+ * 取出所有等待发送的数据, 没有数据时返回 undefined
+ * - 缓存区会保留下来给后面的消息继续使用
+ */
+static JSValue mqtt_writer_flush(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_writer_t* writer = mqtt_writer_get(ctx, this_val);
+    if (!writer) {
+        return JS_EXCEPTION;
+    }
+
+    dbuffer_t* buffer = &writer->buffer;
+    if (buffer->size == 0) {
+        return JS_UNDEFINED;
+    }
+
+    JSValue result = JS_NewArrayBufferCopy(ctx, buffer->buf, buffer->size);
+    buffer->size = 0;
+    writer->count = 0;
+    return result;
+}
+
+/**
+ * 直接编码一个 Publish 消息到缓存区中
+ * publish(topic, payload, dup, qos, retained, packetId[, properties])
+ * - 指定了属性对象时编码为 MQTT 5 消息
+ */
+static JSValue mqtt_writer_publish(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_writer_t* writer = mqtt_writer_get(ctx, this_val);
+    if (!writer) {
+        return JS_EXCEPTION;
+    } else if (argc < 6) {
+        return JS_ThrowTypeError(ctx, "Invalid arguments");
+    }
+
+    // topic
+    size_t topic_length;
+    const char* topic = JS_ToCStringLen(ctx, &topic_length, argv[0]);
+    if (!topic) {
+        return JS_EXCEPTION;
+    }
+
+    // payload
+    tjs_buffer_t payload = TJS_ToArrayBuffer(ctx, argv[1]);
+    if (JS_IsException(payload.error)) {
+        JS_FreeCString(ctx, topic);
+        return payload.error;
+    }
+
+    int dup = TJS_ToInt32(ctx, argv[2], 0);
+    int qos = TJS_ToInt32(ctx, argv[3], 0);
+    int retained = TJS_ToInt32(ctx, argv[4], 0);
+    int packet_id = TJS_ToInt32(ctx, argv[5], 0);
+
+    JSValue result = JS_UNDEFINED;
+    dbuffer_t* buffer = &writer->buffer;
+    if (argc > 6 && JS_IsObject(argv[6])) {
+        size_t size = buffer->size;
+        if (mqtt5_serialize_publish(ctx, buffer, topic, topic_length, payload.data, payload.length, dup, qos, retained, packet_id, argv[6])) {
+            buffer->size = size;
+            result = JS_EXCEPTION;
+            goto exit;
+        }
+
+        writer->count++;
+        result = JS_NewUint32(ctx, buffer->size - size);
+        goto exit;
+    }
+
+    size_t max_length = payload.length + topic_length + 16;
+    if (dbuffer_realloc(buffer, buffer->size + max_length)) {
+        result = JS_ThrowOutOfMemory(ctx);
+        goto exit;
+    }
+
+    MQTTString topic_string = MQTTString_initializer;
+    topic_string.cstring = (char*)topic;
+    int len = MQTTSerialize_publish(buffer->buf + buffer->size, max_length, dup, qos, retained, packet_id, topic_string, payload.data, payload.length);
+    if (len <= 0) {
+        result = JS_ThrowRangeError(ctx, "Invalid publish message");
+        goto exit;
+    }
+
+    buffer->size += len;
+    writer->count++;
+    result = JS_NewUint32(ctx, len);
+
+exit:
+    if (payload.is_string) {
+        JS_FreeCString(ctx, payload.data);
+    }
+
+    JS_FreeCString(ctx, topic);
+    return result;
+}
+
+static JSValue mqtt_writer_reset(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_writer_t* writer = mqtt_writer_get(ctx, this_val);
+    if (!writer) {
+        return JS_EXCEPTION;
+    }
+
+    writer->buffer.size = 0;
+    writer->count = 0;
+    return JS_UNDEFINED;
+}
+
+static JSValue mqtt_writer_size(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_writer_t* writer = mqtt_writer_get(ctx, this_val);
+    if (!writer) {
+        return JS_EXCEPTION;
+    }
+
+    return JS_NewUint32(ctx, writer->buffer.size);
+}
+
+/**
+ * 添加一个已编码的消息
+ */
+static JSValue mqtt_writer_write(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_writer_t* writer = mqtt_writer_get(ctx, this_val);
+    if (!writer) {
+        return JS_EXCEPTION;
+    }
+
+    tjs_buffer_t data = TJS_GetArrayBuffer(ctx, argv[0]);
+    if (JS_IsException(data.error)) {
+        return data.error;
+    }
+
+    int ret = dbuffer_put(&writer->buffer, data.data, data.length);
+    if (data.is_string) {
+        JS_FreeCString(ctx, data.data);
+    }
+
+    if (ret) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    writer->count++;
+    return JS_NewUint32(ctx, data.length);
+}
+
+static const JSCFunctionListEntry mqtt_writer_proto_funcs[] = {
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "MQTTWriter", JS_PROP_CONFIGURABLE),
+    TJS_CFUNC_DEF("count", 0, mqtt_writer_count),
+    TJS_CFUNC_DEF("flush", 0, mqtt_writer_flush),
+    TJS_CFUNC_DEF("publish", 6, mqtt_writer_publish),
+    TJS_CFUNC_DEF("reset", 0, mqtt_writer_reset),
+    TJS_CFUNC_DEF("size", 0, mqtt_writer_size),
+    TJS_CFUNC_DEF("write", 1, mqtt_writer_write)
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// mqtt packet ids
+
+static JSClassID mqtt_packet_ids_class_id;
+
+static void mqtt_packet_ids_finalizer(JSRuntime* runtime, JSValue value)
+{
+    mqtt_packet_ids_t* ids = JS_GetOpaque(value, mqtt_packet_ids_class_id);
+    if (ids) {
+        free(ids);
+    }
+}
+
+static JSClassDef mqtt_packet_ids_class = {
+    "MQTTPacketIds",
+    .finalizer = mqtt_packet_ids_finalizer,
+};
+
+static mqtt_packet_ids_t* mqtt_packet_ids_get(JSContext* ctx, JSValueConst obj)
+{
+    return JS_GetOpaque2(ctx, obj, mqtt_packet_ids_class_id);
+}
+
+static JSValue mqtt_packet_ids_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst* argv)
+{
+    JSValue result = JS_NewObjectClass(ctx, mqtt_packet_ids_class_id);
+    if (JS_IsException(result)) {
+        return result;
+    }
+
+    mqtt_packet_ids_t* ids = calloc(1, sizeof(*ids));
+    if (!ids) {
+        JS_FreeValue(ctx, result);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    JS_SetOpaque(result, ids);
+    return result;
+}
+
+/**
+ * 分配一个没有使用的 ID (1 ~ 65535), 全部都在使用中时返回 0
+ */
+static JSValue mqtt_packet_ids_alloc(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_packet_ids_t* ids = mqtt_packet_ids_get(ctx, this_val);
+    if (!ids) {
+        return JS_EXCEPTION;
+    } else if (ids->count >= 65535) {
+        return JS_NewUint32(ctx, 0);
+    }
+
+    uint16_t id = ids->last_id;
+    for (;;) {
+        id++;
+        if (id == 0) {
+            id = 1;
+        }
+
+        if (!(ids->bits[id >> 3] & (1 << (id & 7)))) {
+            break;
+        }
+    }
+
+    ids->bits[id >> 3] |= (1 << (id & 7));
+    ids->count++;
+    ids->last_id = id;
+    return JS_NewUint32(ctx, id);
+}
+
+static JSValue mqtt_packet_ids_has(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_packet_ids_t* ids = mqtt_packet_ids_get(ctx, this_val);
+    if (!ids) {
+        return JS_EXCEPTION;
+    }
+
+    uint32_t id = TJS_ToUint32(ctx, argv[0], 0);
+    if (id == 0 || id > 65535) {
+        return JS_FALSE;
+    }
+
+    return JS_NewBool(ctx, ids->bits[id >> 3] & (1 << (id & 7)));
+}
+
+/**
+ * 释放指定的 ID, 返回这个 ID 之前是否在使用中
+ */
+static JSValue mqtt_packet_ids_release(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_packet_ids_t* ids = mqtt_packet_ids_get(ctx, this_val);
+    if (!ids) {
+        return JS_EXCEPTION;
+    }
+
+    uint32_t id = TJS_ToUint32(ctx, argv[0], 0);
+    if (id == 0 || id > 65535 || !(ids->bits[id >> 3] & (1 << (id & 7)))) {
+        return JS_FALSE;
+    }
+
+    ids->bits[id >> 3] &= ~(1 << (id & 7));
+    ids->count--;
+    return JS_TRUE;
+}
+
+static JSValue mqtt_packet_ids_reset(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_packet_ids_t* ids = mqtt_packet_ids_get(ctx, this_val);
+    if (!ids) {
+        return JS_EXCEPTION;
+    }
+
+    memset(ids->bits, 0, sizeof(ids->bits));
+    ids->count = 0;
+    return JS_UNDEFINED;
+}
+
+static JSValue mqtt_packet_ids_size(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_packet_ids_t* ids = mqtt_packet_ids_get(ctx, this_val);
+    if (!ids) {
+        return JS_EXCEPTION;
+    }
+
+    return JS_NewUint32(ctx, ids->count);
+}
+
+static const JSCFunctionListEntry mqtt_packet_ids_proto_funcs[] = {
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "MQTTPacketIds", JS_PROP_CONFIGURABLE),
+    TJS_CFUNC_DEF("alloc", 0, mqtt_packet_ids_alloc),
+    TJS_CFUNC_DEF("has", 1, mqtt_packet_ids_has),
+    TJS_CFUNC_DEF("release", 1, mqtt_packet_ids_release),
+    TJS_CFUNC_DEF("reset", 0, mqtt_packet_ids_reset),
+    TJS_CFUNC_DEF("size", 0, mqtt_packet_ids_size)
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // mqtt
 
 static const JSCFunctionListEntry mqtt_module_funcs[] = {
+    JS_PROP_INT32_DEF("AUTH", MQTT5_AUTH, JS_PROP_CONFIGURABLE | JS_PROP_ENUMERABLE),
     TJS_CONST(CONNACK),
     TJS_CONST(CONNECT),
     TJS_CONST(DISCONNECT),
@@ -719,6 +1842,29 @@ void tjs_mod_mqtt_init(JSContext* ctx, JSModuleDef* module)
     JSValue parserClass = JS_NewCFunction2(ctx, mqtt_parser_constructor, "MQTTParser", 1, JS_CFUNC_constructor, 0);
     JS_DefinePropertyValueStr(ctx, mqtt, "Parser", parserClass, JS_PROP_C_W_E);
 
+    /* writer */
+    JS_NewClassID(&mqtt_writer_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), mqtt_writer_class_id, &mqtt_writer_class);
+    prototype = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, prototype, mqtt_writer_proto_funcs, countof(mqtt_writer_proto_funcs));
+    JS_SetClassProto(ctx, mqtt_writer_class_id, prototype);
+
+    JSValue writerClass = JS_NewCFunction2(ctx, mqtt_writer_constructor, "MQTTWriter", 0, JS_CFUNC_constructor, 0);
+    JS_DefinePropertyValueStr(ctx, mqtt, "Writer", writerClass, JS_PROP_C_W_E);
+
+    /* packet ids */
+    JS_NewClassID(&mqtt_packet_ids_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), mqtt_packet_ids_class_id, &mqtt_packet_ids_class);
+    prototype = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, prototype, mqtt_packet_ids_proto_funcs, countof(mqtt_packet_ids_proto_funcs));
+    JS_SetClassProto(ctx, mqtt_packet_ids_class_id, prototype);
+
+    JSValue packetIdsClass = JS_NewCFunction2(ctx, mqtt_packet_ids_constructor, "MQTTPacketIds", 0, JS_CFUNC_constructor, 0);
+    JS_DefinePropertyValueStr(ctx, mqtt, "PacketIds", packetIdsClass, JS_PROP_C_W_E);
+
+    /* broker */
+    tjs_mod_mqtt_broker_init(ctx, mqtt);
+
     JS_SetPropertyFunctionList(ctx, mqtt, mqtt_module_funcs, countof(mqtt_module_funcs));
     JS_SetModuleExport(ctx, module, "mqtt", mqtt);
 }
@@ -0,0 +1,1745 @@
+/* MQTT broker object */
+#include "private.h"
+#include "tjs-utils.h"
+
+#include "streams.h"
+
+#include "MQTTPacket.h"
+#include "util/dbuffer.h"
+
+#include <string.h>
+
+/** 连接读缓存区大小 */
+#define MQTT_BROKER_READ_SIZE 65536
+
+/** 默认最大消息长度 */
+#define MQTT_BROKER_MAX_PACKET_SIZE (1024 * 1024)
+
+/** 默认每个连接最多排队等待发送的字节数, 超过后丢弃发给这个连接的 QoS 0 消息 */
+#define MQTT_BROKER_MAX_QUEUE_SIZE (4 * 1024 * 1024)
+
+/** 默认等待 CONNECT 消息的超时时间 (毫秒) */
+#define MQTT_BROKER_CONNECT_TIMEOUT 10000
+
+/** 每个 SUBSCRIBE/UNSUBSCRIBE 消息最多包含的主题数 */
+#define MQTT_BROKER_MAX_FILTERS 32
+
+/** MQTT 剩余长度字段能表示的最大值 */
+#define MQTT_BROKER_MAX_REMAINING_LENGTH 268435455
+
+enum mqtt_broker_event_enum {
+    MQTT_BROKER_EVENT_ERROR = 0,
+    MQTT_BROKER_EVENT_MAX,
+};
+
+typedef struct mqtt_broker_s mqtt_broker_t;
+typedef struct mqtt_broker_node_s mqtt_broker_node_t;
+typedef struct mqtt_broker_session_s mqtt_broker_session_t;
+
+/**
+ * 编码好的 QoS 0 PUBLISH 消息, 所有订阅者共享同一个缓存区 (引用计数)
+ * QoS 1 的订阅者单独编码消息头, 消息体仍然共享
+ */
+typedef struct mqtt_broker_message_s {
+    uint32_t refs;
+    uint32_t size;
+    uint32_t topic_offset;
+    uint32_t topic_length;
+    uint32_t payload_offset;
+    int qos;
+    uint8_t data[];
+} mqtt_broker_message_t;
+
+typedef struct mqtt_broker_subscription_s {
+    mqtt_broker_session_t* session;
+    int qos;
+} mqtt_broker_subscription_t;
+
+/** 主题树的节点, 每个节点对应主题的一层, 订阅的主题过滤器中的通配符也作为一层 */
+struct mqtt_broker_node_s {
+    mqtt_broker_node_t* parent;
+    mqtt_broker_node_t* children;
+    mqtt_broker_node_t* next;
+
+    mqtt_broker_subscription_t* subscriptions;
+    uint32_t subscription_count;
+    uint32_t subscription_capacity;
+
+    /** 这个主题的保留消息 */
+    mqtt_broker_message_t* retained;
+
+    uint32_t name_length;
+    char name[];
+};
+
+/** 等待发送的一块数据, message 为 NULL 时数据在连接的 pending_data 中 */
+typedef struct mqtt_broker_chunk_s {
+    mqtt_broker_message_t* message;
+    uint32_t offset;
+    uint32_t length;
+} mqtt_broker_chunk_t;
+
+/** 发送请求, 没能立即发送完的数据才需要创建 */
+typedef struct mqtt_broker_write_s {
+    uv_write_t req;
+    dbuffer_t data;
+    uint32_t message_count;
+    mqtt_broker_message_t* messages[];
+} mqtt_broker_write_t;
+
+typedef struct mqtt_broker_listener_s {
+    struct list_head link;
+    mqtt_broker_t* broker;
+    int is_pipe;
+
+    union {
+        uv_handle_t handle;
+        uv_stream_t stream;
+        uv_tcp_t tcp;
+        uv_pipe_t pipe;
+    } h;
+} mqtt_broker_listener_t;
+
+struct mqtt_broker_session_s {
+    struct list_head link;
+    mqtt_broker_t* broker;
+
+    union {
+        uv_handle_t handle;
+        uv_stream_t stream;
+        uv_tcp_t tcp;
+        uv_pipe_t pipe;
+    } h;
+
+    uv_timer_t timer;
+
+    /** 还不完整的消息 */
+    dbuffer_t buffer;
+
+    /** 合并写入: 同一轮事件循环中要发送的数据, 之后通过一次 writev 发送 */
+    struct list_head pending_link;
+    mqtt_broker_chunk_t* chunks;
+    uint32_t chunk_count;
+    uint32_t chunk_capacity;
+    dbuffer_t pending_data;
+    size_t pending_size;
+    int pending;
+
+    char* client_id;
+    uint32_t keep_alive;
+    uint16_t last_packet_id;
+
+    /** 订阅的主题过滤器对应的节点, 连接关闭时取消订阅 */
+    mqtt_broker_node_t** filters;
+    uint32_t filter_count;
+    uint32_t filter_capacity;
+
+    /** 遗嘱消息 */
+    mqtt_broker_message_t* will;
+    int will_retained;
+
+    /** 用于一次转发中去掉重复的订阅 */
+    uint64_t route_stamp;
+    uint32_t route_index;
+
+    int connected;
+    int closing;
+    int close_count;
+};
+
+struct mqtt_broker_s {
+    JSContext* ctx;
+    JSValue events[MQTT_BROKER_EVENT_MAX];
+
+    struct list_head listeners;
+    uint32_t listener_count;
+
+    struct list_head sessions;
+    uint32_t session_count;
+
+    /** 有数据等待发送的连接 */
+    struct list_head pending_sessions;
+    uv_idle_t idle;
+    int idle_closed;
+
+    mqtt_broker_node_t* root;
+    uint64_t route_stamp;
+
+    int closing;
+    int finalized;
+
+    uint32_t connect_timeout;
+    uint32_t max_packet_size;
+    uint32_t max_queue_size;
+
+    uint32_t retained_count;
+    uint32_t subscription_count;
+    uint64_t total_connections;
+    uint64_t messages_received;
+    uint64_t messages_sent;
+    uint64_t messages_dropped;
+
+    /** 所有连接共用的读缓存区 (事件循环是单线程的) */
+    char read_buffer[MQTT_BROKER_READ_SIZE];
+};
+
+/** 一次转发匹配到的订阅者 */
+typedef struct mqtt_broker_route_s {
+    mqtt_broker_subscription_t* items;
+    uint32_t count;
+    uint32_t capacity;
+    mqtt_broker_subscription_t small_items[64];
+} mqtt_broker_route_t;
+
+static JSClassID mqtt_broker_class_id;
+
+static void mqtt_broker_maybe_free(mqtt_broker_t* broker);
+static uint32_t mqtt_broker_publish(mqtt_broker_t* broker, mqtt_broker_message_t* message, int retained);
+static void mqtt_broker_session_close(mqtt_broker_session_t* session, int graceful);
+
+// ////////////////////////////////////////////////////////////////////////////
+// message
+
+static mqtt_broker_message_t* mqtt_broker_message_new(const char* topic, size_t topic_length, const uint8_t* payload, size_t payload_length, int qos)
+{
+    size_t remaining = 2 + topic_length + payload_length;
+    if (topic_length > 65535 || remaining > MQTT_BROKER_MAX_REMAINING_LENGTH) {
+        return NULL;
+    }
+
+    uint8_t header[5];
+    header[0] = PUBLISH << 4;
+    size_t header_size = 1 + MQTTPacket_encode(header + 1, remaining);
+
+    size_t size = header_size + remaining;
+    mqtt_broker_message_t* message = malloc(sizeof(*message) + size);
+    if (message == NULL) {
+        return NULL;
+    }
+
+    message->refs = 1;
+    message->size = size;
+    message->topic_offset = header_size + 2;
+    message->topic_length = topic_length;
+    message->payload_offset = message->topic_offset + topic_length;
+    message->qos = qos;
+
+    uint8_t* data = message->data;
+    memcpy(data, header, header_size);
+    data[header_size] = (uint8_t)(topic_length >> 8);
+    data[header_size + 1] = (uint8_t)(topic_length & 0xff);
+    memcpy(data + message->topic_offset, topic, topic_length);
+    if (payload_length > 0) {
+        memcpy(data + message->payload_offset, payload, payload_length);
+    }
+
+    return message;
+}
+
+static void mqtt_broker_message_release(mqtt_broker_message_t* message)
+{
+    if (message && --message->refs == 0) {
+        free(message);
+    }
+}
+
+static size_t mqtt_broker_message_payload_length(mqtt_broker_message_t* message)
+{
+    return message->size - message->payload_offset;
+}
+
+/**
+ * 为 QoS 1 或保留消息单独编码消息头 (固定头, 主题和消息 ID)
+ * @param header 至少要有 topic_length + 9 个字节
+ */
+static size_t mqtt_broker_message_encode_header(mqtt_broker_message_t* message, uint8_t* header, int qos, int retained, uint16_t packet_id)
+{
+    size_t topic_length = message->topic_length;
+    size_t remaining = 2 + topic_length + (qos > 0 ? 2 : 0) + mqtt_broker_message_payload_length(message);
+
+    header[0] = (PUBLISH << 4) | (qos << 1) | (retained ? 1 : 0);
+    size_t size = 1 + MQTTPacket_encode(header + 1, remaining);
+    header[size++] = (uint8_t)(topic_length >> 8);
+    header[size++] = (uint8_t)(topic_length & 0xff);
+    memcpy(header + size, message->data + message->topic_offset, topic_length);
+    size += topic_length;
+
+    if (qos > 0) {
+        header[size++] = (uint8_t)(packet_id >> 8);
+        header[size++] = (uint8_t)(packet_id & 0xff);
+    }
+
+    return size;
+}
+
+/** 主题名称中不能有通配符 */
+static int mqtt_broker_check_topic(const char* topic, size_t length)
+{
+    if (topic == NULL || length == 0 || length > 65535) {
+        return 0;
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        char ch = topic[i];
+        if (ch == '+' || ch == '#' || ch == '\0') {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/** 通配符必须占据完整的一层, `#` 只能在最后一层 */
+static int mqtt_broker_check_filter(const char* filter, size_t length)
+{
+    if (filter == NULL || length == 0 || length > 65535) {
+        return 0;
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        char ch = filter[i];
+        if (ch == '+' || ch == '#') {
+            if (i > 0 && filter[i - 1] != '/') {
+                return 0;
+
+            } else if (ch == '+' && i + 1 < length && filter[i + 1] != '/') {
+                return 0;
+
+            } else if (ch == '#' && i + 1 != length) {
+                return 0;
+            }
+
+        } else if (ch == '\0') {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+// ////////////////////////////////////////////////////////////////////////////
+// topic tree
+
+static mqtt_broker_node_t* mqtt_broker_node_new(mqtt_broker_node_t* parent, const char* name, size_t name_length)
+{
+    mqtt_broker_node_t* node = calloc(1, sizeof(*node) + name_length + 1);
+    CHECK_NOT_NULL(node);
+
+    node->parent = parent;
+    node->name_length = name_length;
+    memcpy(node->name, name, name_length);
+
+    if (parent) {
+        node->next = parent->children;
+        parent->children = node;
+    }
+
+    return node;
+}
+
+static int mqtt_broker_node_is(mqtt_broker_node_t* node, const char* name, size_t name_length)
+{
+    return node->name_length == name_length && memcmp(node->name, name, name_length) == 0;
+}
+
+/**
+ * 查找主题或主题过滤器对应的节点
+ * @param create 不存在时是否创建
+ */
+static mqtt_broker_node_t* mqtt_broker_node_find(mqtt_broker_t* broker, const char* topic, size_t length, int create)
+{
+    mqtt_broker_node_t* node = broker->root;
+    const char* level = topic;
+    const char* end = topic + length;
+
+    while (node) {
+        const char* separator = memchr(level, '/', end - level);
+        size_t level_length = separator ? (size_t)(separator - level) : (size_t)(end - level);
+
+        mqtt_broker_node_t* child = node->children;
+        while (child && !mqtt_broker_node_is(child, level, level_length)) {
+            child = child->next;
+        }
+
+        if (child == NULL && create) {
+            child = mqtt_broker_node_new(node, level, level_length);
+        }
+
+        node = child;
+        if (separator == NULL) {
+            break;
+        }
+
+        level = separator + 1;
+    }
+
+    return node;
+}
+
+/** 删除不再使用的节点 */
+static void mqtt_broker_node_prune(mqtt_broker_node_t* node)
+{
+    while (node->parent && node->children == NULL && node->subscription_count == 0 && node->retained == NULL) {
+        mqtt_broker_node_t* parent = node->parent;
+        mqtt_broker_node_t** link = &parent->children;
+        while (*link != node) {
+            link = &(*link)->next;
+        }
+
+        *link = node->next;
+        free(node->subscriptions);
+        free(node);
+        node = parent;
+    }
+}
+
+static void mqtt_broker_node_free(mqtt_broker_node_t* node)
+{
+    mqtt_broker_node_t* child = node->children;
+    while (child) {
+        mqtt_broker_node_t* next = child->next;
+        mqtt_broker_node_free(child);
+        child = next;
+    }
+
+    mqtt_broker_message_release(node->retained);
+    free(node->subscriptions);
+    free(node);
+}
+
+static void mqtt_broker_route_add(mqtt_broker_t* broker, mqtt_broker_route_t* route, mqtt_broker_node_t* node)
+{
+    for (uint32_t i = 0; i < node->subscription_count; i++) {
+        mqtt_broker_subscription_t* subscription = &node->subscriptions[i];
+        mqtt_broker_session_t* session = subscription->session;
+
+        // 同一个连接有多个订阅匹配时只发送一次, 使用最大的 QoS
+        if (session->route_stamp == broker->route_stamp) {
+            mqtt_broker_subscription_t* item = &route->items[session->route_index];
+            if (item->qos < subscription->qos) {
+                item->qos = subscription->qos;
+            }
+
+            continue;
+        }
+
+        if (route->count >= route->capacity) {
+            uint32_t capacity = route->capacity * 2;
+            mqtt_broker_subscription_t* items = malloc(sizeof(*items) * capacity);
+            CHECK_NOT_NULL(items);
+
+            memcpy(items, route->items, sizeof(*items) * route->count);
+            if (route->items != route->small_items) {
+                free(route->items);
+            }
+
+            route->items = items;
+            route->capacity = capacity;
+        }
+
+        session->route_stamp = broker->route_stamp;
+        session->route_index = route->count;
+        route->items[route->count++] = *subscription;
+    }
+}
+
+/**
+ * 查找和主题匹配的所有订阅
+ * @param level 主题剩下的部分, 为 NULL 表示已经匹配完所有的层
+ */
+static void mqtt_broker_route_match(mqtt_broker_t* broker, mqtt_broker_route_t* route, mqtt_broker_node_t* node, const char* level, const char* end, int depth)
+{
+    if (level == NULL) {
+        mqtt_broker_route_add(broker, route, node);
+
+        // `a/#` 也匹配 `a`
+        for (mqtt_broker_node_t* child = node->children; child; child = child->next) {
+            if (mqtt_broker_node_is(child, "#", 1)) {
+                mqtt_broker_route_add(broker, route, child);
+            }
+        }
+
+        return;
+    }
+
+    const char* separator = memchr(level, '/', end - level);
+    size_t level_length = separator ? (size_t)(separator - level) : (size_t)(end - level);
+    const char* next = separator ? separator + 1 : NULL;
+
+    // 通配符不匹配以 `$` 开头的主题
+    int is_system = (depth == 0 && level_length > 0 && level[0] == '$');
+
+    for (mqtt_broker_node_t* child = node->children; child; child = child->next) {
+        if (mqtt_broker_node_is(child, "#", 1)) {
+            if (!is_system) {
+                mqtt_broker_route_add(broker, route, child);
+            }
+
+        } else if (mqtt_broker_node_is(child, "+", 1)) {
+            if (!is_system) {
+                mqtt_broker_route_match(broker, route, child, next, end, depth + 1);
+            }
+
+        } else if (mqtt_broker_node_is(child, level, level_length)) {
+            mqtt_broker_route_match(broker, route, child, next, end, depth + 1);
+        }
+    }
+}
+
+// ////////////////////////////////////////////////////////////////////////////
+// session
+
+static void mqtt_broker_write_release(mqtt_broker_write_t* write)
+{
+    for (uint32_t i = 0; i < write->message_count; i++) {
+        mqtt_broker_message_release(write->messages[i]);
+    }
+
+    dbuffer_free(&write->data);
+    free(write);
+}
+
+static void mqtt_broker_write_callback(uv_write_t* req, int status)
+{
+    mqtt_broker_write_t* write = req->data;
+    mqtt_broker_session_t* session = req->handle->data;
+    mqtt_broker_write_release(write);
+
+    if (status < 0 && session && !session->closing) {
+        mqtt_broker_session_close(session, 0);
+    }
+}
+
+static void mqtt_broker_idle_callback(uv_idle_t* handle);
+
+/** 释放所有等待发送的数据 */
+static void mqtt_broker_session_reset_pending(mqtt_broker_session_t* session)
+{
+    for (uint32_t i = 0; i < session->chunk_count; i++) {
+        mqtt_broker_message_release(session->chunks[i].message);
+    }
+
+    session->chunk_count = 0;
+    session->pending_data.size = 0;
+    session->pending_size = 0;
+
+    if (session->pending) {
+        session->pending = 0;
+        list_del(&session->pending_link);
+    }
+}
+
+static void mqtt_broker_session_add_chunk(mqtt_broker_session_t* session, mqtt_broker_message_t* message, size_t offset, size_t length)
+{
+    // 和前一块连续的数据合并
+    if (session->chunk_count > 0) {
+        mqtt_broker_chunk_t* last = &session->chunks[session->chunk_count - 1];
+        if (last->message == message && last->offset + last->length == offset) {
+            last->length += length;
+            session->pending_size += length;
+            return;
+        }
+    }
+
+    if (session->chunk_count >= session->chunk_capacity) {
+        uint32_t capacity = session->chunk_capacity ? session->chunk_capacity * 2 : 16;
+        void* chunks = realloc(session->chunks, sizeof(*session->chunks) * capacity);
+        CHECK_NOT_NULL(chunks);
+
+        session->chunks = chunks;
+        session->chunk_capacity = capacity;
+    }
+
+    if (message) {
+        message->refs++;
+    }
+
+    mqtt_broker_chunk_t* chunk = &session->chunks[session->chunk_count++];
+    chunk->message = message;
+    chunk->offset = offset;
+    chunk->length = length;
+    session->pending_size += length;
+}
+
+/**
+ * 添加要发送的数据, 在这一轮事件循环结束前合并发送
+ * @param header 单独编码的消息头, 会复制一份
+ * @param message 共享的消息, 增加引用计数, 不复制
+ * @param offset 从消息的这个位置开始发送
+ */
+static void mqtt_broker_session_write(mqtt_broker_session_t* session, const uint8_t* header, size_t header_size, mqtt_broker_message_t* message, size_t offset)
+{
+    if (session->closing) {
+        return;
+    }
+
+    if (header_size > 0) {
+        size_t header_offset = session->pending_data.size;
+        if (dbuffer_put(&session->pending_data, header, header_size)) {
+            mqtt_broker_session_close(session, 0);
+            return;
+        }
+
+        mqtt_broker_session_add_chunk(session, NULL, header_offset, header_size);
+    }
+
+    if (message && offset < message->size) {
+        mqtt_broker_session_add_chunk(session, message, offset, message->size - offset);
+    }
+
+    if (!session->pending) {
+        mqtt_broker_t* broker = session->broker;
+        session->pending = 1;
+        list_add_tail(&session->pending_link, &broker->pending_sessions);
+        uv_idle_start(&broker->idle, mqtt_broker_idle_callback);
+    }
+}
+
+/**
+ * 通过一次 writev 发送所有等待发送的数据, 先尝试直接发送, 发送不完的部分才排队
+ */
+static void mqtt_broker_session_flush(mqtt_broker_session_t* session)
+{
+    uint32_t count = session->chunk_count;
+    if (count == 0 || session->closing) {
+        mqtt_broker_session_reset_pending(session);
+        return;
+    }
+
+    uv_buf_t small_bufs[64];
+    uv_buf_t* bufs = small_bufs;
+    if (count > countof(small_bufs)) {
+        bufs = malloc(sizeof(uv_buf_t) * count);
+        CHECK_NOT_NULL(bufs);
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        mqtt_broker_chunk_t* chunk = &session->chunks[i];
+        uint8_t* base = chunk->message ? chunk->message->data : session->pending_data.buf;
+        bufs[i] = uv_buf_init((char*)base + chunk->offset, chunk->length);
+    }
+
+    int ret = uv_try_write(&session->h.stream, bufs, count);
+    if (ret < 0 && ret != UV_EAGAIN && ret != UV_ENOSYS) {
+        mqtt_broker_session_reset_pending(session);
+        mqtt_broker_session_close(session, 0);
+        goto exit;
+    }
+
+    // 跳过已经发送的部分
+    size_t written = ret > 0 ? ret : 0;
+    uint32_t first = 0;
+    while (first < count && written >= bufs[first].len) {
+        written -= bufs[first].len;
+        first++;
+    }
+
+    if (first < count) {
+        bufs[first].base += written;
+        bufs[first].len -= written;
+
+        // 剩下的消息转移到发送请求中
+        mqtt_broker_write_t* write = malloc(sizeof(*write) + sizeof(write->messages[0]) * (count - first));
+        CHECK_NOT_NULL(write);
+
+        write->data = session->pending_data;
+        dbuffer_init(&session->pending_data);
+        write->message_count = 0;
+        for (uint32_t i = first; i < count; i++) {
+            mqtt_broker_chunk_t* chunk = &session->chunks[i];
+            if (chunk->message) {
+                write->messages[write->message_count++] = chunk->message;
+                chunk->message = NULL;
+            }
+        }
+
+        write->req.data = write;
+        ret = uv_write(&write->req, &session->h.stream, bufs + first, count - first, mqtt_broker_write_callback);
+        if (ret != 0) {
+            mqtt_broker_write_release(write);
+            mqtt_broker_session_reset_pending(session);
+            mqtt_broker_session_close(session, 0);
+            goto exit;
+        }
+    }
+
+    mqtt_broker_session_reset_pending(session);
+
+exit:
+    if (bufs != small_bufs) {
+        free(bufs);
+    }
+}
+
+/** 发送所有连接等待发送的数据 */
+static void mqtt_broker_flush(mqtt_broker_t* broker)
+{
+    while (!list_empty(&broker->pending_sessions)) {
+        mqtt_broker_session_t* session = list_entry(broker->pending_sessions.next, mqtt_broker_session_t, pending_link);
+        mqtt_broker_session_flush(session);
+    }
+
+    uv_idle_stop(&broker->idle);
+}
+
+static void mqtt_broker_idle_callback(uv_idle_t* handle)
+{
+    mqtt_broker_t* broker = handle->data;
+    CHECK_NOT_NULL(broker);
+
+    mqtt_broker_flush(broker);
+}
+
+/**
+ * 发送一个 PUBLISH 消息给这个连接
+ * - 实时的 QoS 0 消息直接发送共享的缓存区
+ * - QoS 1 消息和保留消息单独编码消息头, 消息体仍然是共享的
+ */
+static void mqtt_broker_session_send(mqtt_broker_session_t* session, mqtt_broker_message_t* message, int qos, int retained)
+{
+    mqtt_broker_t* broker = session->broker;
+    if (!session->connected || session->closing) {
+        return;
+    }
+
+    if (qos == 0 && !retained) {
+        // 接收太慢的连接
+        if (session->h.stream.write_queue_size + session->pending_size > broker->max_queue_size) {
+            broker->messages_dropped++;
+            return;
+        }
+
+        mqtt_broker_session_write(session, NULL, 0, message, 0);
+        broker->messages_sent++;
+        return;
+    }
+
+    uint16_t packet_id = 0;
+    if (qos > 0) {
+        packet_id = ++session->last_packet_id;
+        if (packet_id == 0) {
+            packet_id = session->last_packet_id = 1;
+        }
+    }
+
+    uint8_t small_header[256];
+    uint8_t* header = small_header;
+    size_t header_capacity = message->topic_length + 9;
+    if (header_capacity > sizeof(small_header)) {
+        header = malloc(header_capacity);
+        CHECK_NOT_NULL(header);
+    }
+
+    size_t header_size = mqtt_broker_message_encode_header(message, header, qos, retained, packet_id);
+    mqtt_broker_session_write(session, header, header_size, message, message->payload_offset);
+    broker->messages_sent++;
+
+    if (header != small_header) {
+        free(header);
+    }
+}
+
+/** 发送和主题过滤器匹配的保留消息 */
+static void mqtt_broker_session_send_retained(mqtt_broker_session_t* session, mqtt_broker_node_t* node, const char* level, const char* end, int depth, int qos)
+{
+    if (level == NULL) {
+        if (node->retained) {
+            int retained_qos = node->retained->qos < qos ? node->retained->qos : qos;
+            mqtt_broker_session_send(session, node->retained, retained_qos, 1);
+        }
+
+        return;
+    }
+
+    const char* separator = memchr(level, '/', end - level);
+    size_t level_length = separator ? (size_t)(separator - level) : (size_t)(end - level);
+    const char* next = separator ? separator + 1 : NULL;
+
+    if (level_length == 1 && level[0] == '#') {
+        // `a/#` 也匹配 `a`
+        mqtt_broker_session_send_retained(session, node, NULL, NULL, depth, qos);
+    }
+
+    for (mqtt_broker_node_t* child = node->children; child; child = child->next) {
+        if (level_length == 1 && (level[0] == '+' || level[0] == '#')) {
+            // 通配符不匹配以 `$` 开头的主题
+            if (depth == 0 && child->name_length > 0 && child->name[0] == '$') {
+                continue;
+            }
+
+            int is_all = (level[0] == '#');
+            mqtt_broker_session_send_retained(session, child, is_all ? level : next, end, depth + 1, qos);
+
+        } else if (mqtt_broker_node_is(child, level, level_length)) {
+            mqtt_broker_session_send_retained(session, child, next, end, depth + 1, qos);
+        }
+    }
+}
+
+static int mqtt_broker_session_subscribe(mqtt_broker_session_t* session, const char* filter, size_t length, int qos)
+{
+    mqtt_broker_t* broker = session->broker;
+    mqtt_broker_node_t* node = mqtt_broker_node_find(broker, filter, length, 1);
+
+    // 重复订阅时只更新 QoS
+    for (uint32_t i = 0; i < node->subscription_count; i++) {
+        if (node->subscriptions[i].session == session) {
+            node->subscriptions[i].qos = qos;
+            return 0;
+        }
+    }
+
+    if (node->subscription_count >= node->subscription_capacity) {
+        uint32_t capacity = node->subscription_capacity ? node->subscription_capacity * 2 : 4;
+        void* subscriptions = realloc(node->subscriptions, sizeof(*node->subscriptions) * capacity);
+        CHECK_NOT_NULL(subscriptions);
+
+        node->subscriptions = subscriptions;
+        node->subscription_capacity = capacity;
+    }
+
+    if (session->filter_count >= session->filter_capacity) {
+        uint32_t capacity = session->filter_capacity ? session->filter_capacity * 2 : 4;
+        void* filters = realloc(session->filters, sizeof(*session->filters) * capacity);
+        CHECK_NOT_NULL(filters);
+
+        session->filters = filters;
+        session->filter_capacity = capacity;
+    }
+
+    mqtt_broker_subscription_t* subscription = &node->subscriptions[node->subscription_count++];
+    subscription->session = session;
+    subscription->qos = qos;
+
+    session->filters[session->filter_count++] = node;
+    broker->subscription_count++;
+    return 0;
+}
+
+static void mqtt_broker_session_unsubscribe(mqtt_broker_session_t* session, mqtt_broker_node_t* node)
+{
+    for (uint32_t i = 0; i < session->filter_count; i++) {
+        if (session->filters[i] == node) {
+            session->filters[i] = session->filters[--session->filter_count];
+            break;
+        }
+    }
+
+    for (uint32_t i = 0; i < node->subscription_count; i++) {
+        if (node->subscriptions[i].session == session) {
+            node->subscriptions[i] = node->subscriptions[--node->subscription_count];
+            session->broker->subscription_count--;
+            break;
+        }
+    }
+
+    mqtt_broker_node_prune(node);
+}
+
+static void mqtt_broker_session_close_callback(uv_handle_t* handle)
+{
+    mqtt_broker_session_t* session = handle->data;
+    CHECK_NOT_NULL(session);
+
+    session->close_count--;
+    if (session->close_count > 0) {
+        return;
+    }
+
+    mqtt_broker_t* broker = session->broker;
+    dbuffer_free(&session->buffer);
+    dbuffer_free(&session->pending_data);
+    free(session->chunks);
+    free(session->client_id);
+    free(session->filters);
+    free(session);
+
+    broker->session_count--;
+    mqtt_broker_maybe_free(broker);
+}
+
+/**
+ * 关闭连接
+ * @param graceful 是否是客户端主动断开 (收到 DISCONNECT), 否则发布遗嘱消息
+ */
+static void mqtt_broker_session_close(mqtt_broker_session_t* session, int graceful)
+{
+    if (session->closing) {
+        return;
+    }
+
+    session->closing = 1;
+    mqtt_broker_t* broker = session->broker;
+
+    while (session->filter_count > 0) {
+        mqtt_broker_session_unsubscribe(session, session->filters[session->filter_count - 1]);
+    }
+
+    mqtt_broker_message_t* will = session->will;
+    session->will = NULL;
+    if (will) {
+        if (!graceful && !broker->closing) {
+            mqtt_broker_publish(broker, will, session->will_retained);
+        }
+
+        mqtt_broker_message_release(will);
+    }
+
+    mqtt_broker_session_reset_pending(session);
+    list_del(&session->link);
+
+    session->close_count = 2;
+    uv_close(&session->h.handle, mqtt_broker_session_close_callback);
+    uv_close((uv_handle_t*)&session->timer, mqtt_broker_session_close_callback);
+}
+
+static void mqtt_broker_session_timer_callback(uv_timer_t* handle)
+{
+    mqtt_broker_session_t* session = handle->data;
+    CHECK_NOT_NULL(session);
+
+    mqtt_broker_session_close(session, 0);
+}
+
+/** 超过 1.5 倍的 keep alive 时间没有收到任何消息时关闭连接 */
+static void mqtt_broker_session_start_timer(mqtt_broker_session_t* session)
+{
+    uint64_t timeout = session->connected ? (uint64_t)session->keep_alive * 1500 : session->broker->connect_timeout;
+    if (timeout > 0) {
+        uv_timer_start(&session->timer, mqtt_broker_session_timer_callback, timeout, 0);
+
+    } else {
+        uv_timer_stop(&session->timer);
+    }
+}
+
+static int mqtt_broker_session_on_connect(mqtt_broker_session_t* session, uint8_t* packet, size_t length)
+{
+    mqtt_broker_t* broker = session->broker;
+    uint8_t connack[4] = { CONNACK << 4, 2, 0, MQTT_CONNECTION_ACCEPTED };
+
+    // 固定头, 协议名, 版本, 标记, keep alive 和客户端 ID
+    if (length < 14) {
+        return -1;
+    }
+
+    MQTTPacket_connectData data = MQTTPacket_connectData_initializer;
+    if (MQTTDeserialize_connect(&data, packet, length) != 1) {
+        connack[3] = MQTT_UNNACCEPTABLE_PROTOCOL;
+        mqtt_broker_session_write(session, connack, sizeof(connack), NULL, 0);
+        return -1;
+    }
+
+    // 只支持 clean session, 但允许客户端请求持久会话 (总是返回 sessionPresent = 0)
+    size_t client_id_length = data.clientID.lenstring.len;
+    if (client_id_length == 0 && !data.cleansession) {
+        connack[3] = MQTT_CLIENTID_REJECTED;
+        mqtt_broker_session_write(session, connack, sizeof(connack), NULL, 0);
+        return -1;
+    }
+
+    session->client_id = malloc(client_id_length + 1);
+    CHECK_NOT_NULL(session->client_id);
+    memcpy(session->client_id, data.clientID.lenstring.data, client_id_length);
+    session->client_id[client_id_length] = '\0';
+
+    if (data.willFlag) {
+        MQTTLenString* topic = &data.will.topicName.lenstring;
+        MQTTLenString* payload = &data.will.message.lenstring;
+        if (data.will.qos > 2 || !mqtt_broker_check_topic(topic->data, topic->len)) {
+            return -1;
+        }
+
+        session->will = mqtt_broker_message_new(topic->data, topic->len, (uint8_t*)payload->data, payload->len, data.will.qos);
+        session->will_retained = data.will.retained;
+    }
+
+    // 相同客户端 ID 的旧连接
+    if (client_id_length > 0) {
+        struct list_head *el, *el1;
+        list_for_each_safe(el, el1, &broker->sessions)
+        {
+            mqtt_broker_session_t* other = list_entry(el, mqtt_broker_session_t, link);
+            if (other != session && other->connected && strcmp(other->client_id, session->client_id) == 0) {
+                mqtt_broker_session_close(other, 0);
+            }
+        }
+    }
+
+    session->keep_alive = data.keepAliveInterval;
+    session->connected = 1;
+    mqtt_broker_session_write(session, connack, sizeof(connack), NULL, 0);
+    return 0;
+}
+
+static int mqtt_broker_session_on_publish(mqtt_broker_session_t* session, uint8_t* packet, size_t length)
+{
+    mqtt_broker_t* broker = session->broker;
+
+    unsigned char dup = 0;
+    unsigned char retained = 0;
+    unsigned short packet_id = 0;
+    int qos = 0;
+    int payload_length = 0;
+    unsigned char* payload = NULL;
+    MQTTString topic = MQTTString_initializer;
+
+    // 主题必须是 lenstring, 解析失败时 data 为 NULL
+    int ret = MQTTDeserialize_publish(&dup, &qos, &retained, &packet_id, &topic, &payload, &payload_length, packet, length);
+    if (ret != 1 || qos > 2 || payload_length < 0 || topic.lenstring.data == NULL) {
+        return -1;
+
+    } else if (!mqtt_broker_check_topic(topic.lenstring.data, topic.lenstring.len)) {
+        return -1;
+    }
+
+    mqtt_broker_message_t* message = mqtt_broker_message_new(topic.lenstring.data, topic.lenstring.len, payload, payload_length, qos);
+    if (message == NULL) {
+        return -1;
+    }
+
+    broker->messages_received++;
+    mqtt_broker_publish(broker, message, retained);
+    mqtt_broker_message_release(message);
+
+    // QoS 2 收到后立即转发, 之后只需完成 PUBREC/PUBREL/PUBCOMP 握手
+    if (qos > 0) {
+        uint8_t ack[4];
+        int type = (qos == 1) ? PUBACK : PUBREC;
+        int size = MQTTSerialize_ack(ack, sizeof(ack), type, 0, packet_id);
+        mqtt_broker_session_write(session, ack, size, NULL, 0);
+    }
+
+    return 0;
+}
+
+static int mqtt_broker_session_on_subscribe(mqtt_broker_session_t* session, uint8_t* packet, size_t length)
+{
+    unsigned char dup = 0;
+    unsigned short packet_id = 0;
+    int count = 0;
+    MQTTString filters[MQTT_BROKER_MAX_FILTERS];
+    int qoss[MQTT_BROKER_MAX_FILTERS];
+
+    // SUBSCRIBE 的固定头的标记必须是 0010
+    if ((packet[0] & 0x0f) != 0x02) {
+        return -1;
+    }
+
+    int ret = MQTTDeserialize_subscribe(&dup, &packet_id, MQTT_BROKER_MAX_FILTERS, &count, filters, qoss, packet, length);
+    if (ret != 1 || count == 0) {
+        return -1;
+    }
+
+    // 最大只支持 QoS 1
+    for (int i = 0; i < count; i++) {
+        MQTTLenString* filter = &filters[i].lenstring;
+        if (qoss[i] > 2) {
+            return -1;
+
+        } else if (!mqtt_broker_check_filter(filter->data, filter->len)) {
+            qoss[i] = 0x80;
+            continue;
+        }
+
+        if (qoss[i] > 1) {
+            qoss[i] = 1;
+        }
+
+        mqtt_broker_session_subscribe(session, filter->data, filter->len, qoss[i]);
+    }
+
+    uint8_t suback[8 + MQTT_BROKER_MAX_FILTERS];
+    int size = MQTTSerialize_suback(suback, sizeof(suback), packet_id, count, qoss);
+    mqtt_broker_session_write(session, suback, size, NULL, 0);
+
+    // 订阅成功后再发送保留消息
+    for (int i = 0; i < count; i++) {
+        if (qoss[i] == 0x80) {
+            continue;
+        }
+
+        MQTTLenString* filter = &filters[i].lenstring;
+        const char* end = filter->data + filter->len;
+        mqtt_broker_session_send_retained(session, session->broker->root, filter->data, end, 0, qoss[i]);
+    }
+
+    return 0;
+}
+
+static int mqtt_broker_session_on_unsubscribe(mqtt_broker_session_t* session, uint8_t* packet, size_t length)
+{
+    unsigned char dup = 0;
+    unsigned short packet_id = 0;
+    int count = 0;
+    MQTTString filters[MQTT_BROKER_MAX_FILTERS];
+
+    if ((packet[0] & 0x0f) != 0x02) {
+        return -1;
+    }
+
+    int ret = MQTTDeserialize_unsubscribe(&dup, &packet_id, MQTT_BROKER_MAX_FILTERS, &count, filters, packet, length);
+    if (ret != 1 || count == 0) {
+        return -1;
+    }
+
+    for (int i = 0; i < count; i++) {
+        MQTTLenString* filter = &filters[i].lenstring;
+        if (filter->data == NULL) {
+            return -1;
+        }
+
+        mqtt_broker_node_t* node = mqtt_broker_node_find(session->broker, filter->data, filter->len, 0);
+        if (node) {
+            mqtt_broker_session_unsubscribe(session, node);
+        }
+    }
+
+    uint8_t unsuback[4];
+    int size = MQTTSerialize_unsuback(unsuback, sizeof(unsuback), packet_id);
+    mqtt_broker_session_write(session, unsuback, size, NULL, 0);
+    return 0;
+}
+
+/**
+ * 处理一个完整的消息
+ * @return 返回非 0 表示要关闭这个连接
+ */
+static int mqtt_broker_session_on_packet(mqtt_broker_session_t* session, uint8_t* packet, size_t length)
+{
+    int type = packet[0] >> 4;
+    if (!session->connected) {
+        // 第一个消息必须是 CONNECT
+        return (type == CONNECT) ? mqtt_broker_session_on_connect(session, packet, length) : -1;
+    }
+
+    switch (type) {
+    case PUBLISH:
+        return mqtt_broker_session_on_publish(session, packet, length);
+
+    case PUBACK:
+    case PUBCOMP:
+        // 只支持 clean session, 发出的 QoS 1 消息不需要重发
+        return 0;
+
+    case PUBREL: {
+        unsigned char packet_type = 0, dup = 0;
+        unsigned short packet_id = 0;
+        if (MQTTDeserialize_ack(&packet_type, &dup, &packet_id, packet, length) != 1) {
+            return -1;
+        }
+
+        uint8_t pubcomp[4];
+        int size = MQTTSerialize_pubcomp(pubcomp, sizeof(pubcomp), packet_id);
+        mqtt_broker_session_write(session, pubcomp, size, NULL, 0);
+        return 0;
+    }
+
+    case SUBSCRIBE:
+        return mqtt_broker_session_on_subscribe(session, packet, length);
+
+    case UNSUBSCRIBE:
+        return mqtt_broker_session_on_unsubscribe(session, packet, length);
+
+    case PINGREQ: {
+        uint8_t pingresp[2] = { PINGRESP << 4, 0 };
+        mqtt_broker_session_write(session, pingresp, sizeof(pingresp), NULL, 0);
+        return 0;
+    }
+
+    case DISCONNECT:
+        // 正常断开时不发布遗嘱消息
+        mqtt_broker_session_close(session, 1);
+        return 0;
+
+    default:
+        return -1;
+    }
+}
+
+/**
+ * 返回完整消息的长度, 0 表示数据还不完整, 小于 0 表示无效的消息
+ */
+static int64_t mqtt_broker_packet_size(const uint8_t* data, size_t length, uint32_t max_size)
+{
+    uint32_t value = 0;
+    uint32_t multiplier = 1;
+
+    for (size_t i = 1; i < 5; i++) {
+        if (i >= length) {
+            return 0;
+        }
+
+        uint8_t byte = data[i];
+        value += (byte & 0x7f) * multiplier;
+        if ((byte & 0x80) == 0) {
+            uint64_t size = i + 1 + (uint64_t)value;
+            if (size > max_size) {
+                return -1;
+            }
+
+            return (length >= size) ? (int64_t)size : 0;
+        }
+
+        multiplier *= 128;
+    }
+
+    return -1;
+}
+
+static void mqtt_broker_session_on_data(mqtt_broker_session_t* session, uint8_t* data, size_t length)
+{
+    dbuffer_t* buffer = &session->buffer;
+    if (buffer->size > 0) {
+        if (dbuffer_put(buffer, data, length)) {
+            mqtt_broker_session_close(session, 0);
+            return;
+        }
+
+        data = buffer->buf;
+        length = buffer->size;
+    }
+
+    size_t offset = 0;
+    while (offset < length) {
+        int64_t size = mqtt_broker_packet_size(data + offset, length - offset, session->broker->max_packet_size);
+        if (size == 0) {
+            break;
+
+        } else if (size < 0 || mqtt_broker_session_on_packet(session, data + offset, size) != 0) {
+            mqtt_broker_session_close(session, 0);
+            return;
+        }
+
+        offset += size;
+        if (session->closing) {
+            return;
+        }
+    }
+
+    // 保存不完整的消息
+    size_t left = length - offset;
+    if (buffer->size > 0) {
+        memmove(buffer->buf, buffer->buf + offset, left);
+        buffer->size = left;
+
+    } else if (left > 0 && dbuffer_put(buffer, data + offset, left)) {
+        mqtt_broker_session_close(session, 0);
+    }
+}
+
+static void mqtt_broker_session_read_alloc_callback(uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf)
+{
+    mqtt_broker_session_t* session = handle->data;
+    CHECK_NOT_NULL(session);
+
+    mqtt_broker_t* broker = session->broker;
+    *buf = uv_buf_init(broker->read_buffer, sizeof(broker->read_buffer));
+}
+
+static void mqtt_broker_session_read_callback(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf)
+{
+    mqtt_broker_session_t* session = handle->data;
+    CHECK_NOT_NULL(session);
+
+    if (nread < 0) {
+        mqtt_broker_session_close(session, 0);
+        return;
+
+    } else if (nread == 0) {
+        return;
+    }
+
+    mqtt_broker_session_on_data(session, (uint8_t*)buf->base, nread);
+    if (!session->closing) {
+        mqtt_broker_session_start_timer(session);
+    }
+
+    // 这次收到的所有消息的转发和应答一起发送
+    mqtt_broker_flush(session->broker);
+}
+
+static void mqtt_broker_on_connection(uv_stream_t* handle, int status)
+{
+    mqtt_broker_listener_t* listener = handle->data;
+    CHECK_NOT_NULL(listener);
+
+    mqtt_broker_t* broker = listener->broker;
+    JSContext* ctx = broker->ctx;
+    if (status < 0) {
+        TJS_EmitEvent(ctx, broker->events[MQTT_BROKER_EVENT_ERROR], tjs_new_uv_error(ctx, status));
+        return;
+    }
+
+    mqtt_broker_session_t* session = calloc(1, sizeof(*session));
+    CHECK_NOT_NULL(session);
+
+    session->broker = broker;
+    uv_loop_t* loop = TJS_GetLoop(ctx);
+    if (listener->is_pipe) {
+        CHECK_EQ(uv_pipe_init(loop, &session->h.pipe, 0), 0);
+
+    } else {
+        CHECK_EQ(uv_tcp_init(loop, &session->h.tcp), 0);
+    }
+
+    CHECK_EQ(uv_timer_init(loop, &session->timer), 0);
+    session->h.handle.data = session;
+    session->timer.data = session;
+    dbuffer_init(&session->buffer);
+    dbuffer_init(&session->pending_data);
+
+    list_add_tail(&session->link, &broker->sessions);
+    broker->session_count++;
+
+    int ret = uv_accept(handle, &session->h.stream);
+    if (ret != 0) {
+        mqtt_broker_session_close(session, 1);
+        return;
+    }
+
+    broker->total_connections++;
+    if (!listener->is_pipe) {
+        uv_tcp_nodelay(&session->h.tcp, 1);
+    }
+
+    uv_read_start(&session->h.stream, mqtt_broker_session_read_alloc_callback, mqtt_broker_session_read_callback);
+    mqtt_broker_session_start_timer(session);
+}
+
+// ////////////////////////////////////////////////////////////////////////////
+// broker
+
+/**
+ * 发布一个消息给所有匹配的订阅者
+ * @return 返回发送的订阅者数量
+ */
+static uint32_t mqtt_broker_publish(mqtt_broker_t* broker, mqtt_broker_message_t* message, int retained)
+{
+    const char* topic = (const char*)message->data + message->topic_offset;
+    const char* end = topic + message->topic_length;
+
+    // 保留消息, 消息体为空表示删除
+    if (retained) {
+        int is_empty = (mqtt_broker_message_payload_length(message) == 0);
+        mqtt_broker_node_t* node = mqtt_broker_node_find(broker, topic, message->topic_length, !is_empty);
+        if (node) {
+            if (node->retained) {
+                mqtt_broker_message_release(node->retained);
+                node->retained = NULL;
+                broker->retained_count--;
+            }
+
+            if (!is_empty) {
+                message->refs++;
+                node->retained = message;
+                broker->retained_count++;
+
+            } else {
+                mqtt_broker_node_prune(node);
+            }
+        }
+    }
+
+    mqtt_broker_route_t route;
+    route.items = route.small_items;
+    route.count = 0;
+    route.capacity = countof(route.small_items);
+
+    broker->route_stamp++;
+    mqtt_broker_route_match(broker, &route, broker->root, topic, end, 0);
+
+    // 先匹配再发送, 发送时关闭的连接会修改主题树
+    for (uint32_t i = 0; i < route.count; i++) {
+        mqtt_broker_subscription_t* item = &route.items[i];
+        int qos = (message->qos < item->qos) ? message->qos : item->qos;
+        mqtt_broker_session_send(item->session, message, qos, 0);
+    }
+
+    if (route.items != route.small_items) {
+        free(route.items);
+    }
+
+    return route.count;
+}
+
+static void mqtt_broker_maybe_free(mqtt_broker_t* broker)
+{
+    if (broker->finalized && broker->idle_closed && broker->listener_count == 0 && broker->session_count == 0) {
+        mqtt_broker_node_free(broker->root);
+        free(broker);
+    }
+}
+
+static void mqtt_broker_idle_close_callback(uv_handle_t* handle)
+{
+    mqtt_broker_t* broker = handle->data;
+    CHECK_NOT_NULL(broker);
+
+    broker->idle_closed = 1;
+    mqtt_broker_maybe_free(broker);
+}
+
+static void mqtt_broker_listener_close_callback(uv_handle_t* handle)
+{
+    mqtt_broker_listener_t* listener = handle->data;
+    CHECK_NOT_NULL(listener);
+
+    mqtt_broker_t* broker = listener->broker;
+    free(listener);
+
+    broker->listener_count--;
+    mqtt_broker_maybe_free(broker);
+}
+
+static void mqtt_broker_listener_close(mqtt_broker_listener_t* listener)
+{
+    list_del(&listener->link);
+    uv_close(&listener->h.handle, mqtt_broker_listener_close_callback);
+}
+
+/** 停止侦听并关闭所有的连接 */
+static void mqtt_broker_close(mqtt_broker_t* broker)
+{
+    if (!broker->closing) {
+        broker->closing = 1;
+        uv_close((uv_handle_t*)&broker->idle, mqtt_broker_idle_close_callback);
+    }
+
+    struct list_head *el, *el1;
+    list_for_each_safe(el, el1, &broker->listeners)
+    {
+        mqtt_broker_listener_t* listener = list_entry(el, mqtt_broker_listener_t, link);
+        mqtt_broker_listener_close(listener);
+    }
+
+    list_for_each_safe(el, el1, &broker->sessions)
+    {
+        mqtt_broker_session_t* session = list_entry(el, mqtt_broker_session_t, link);
+        mqtt_broker_session_close(session, 1);
+    }
+}
+
+static void mqtt_broker_finalizer(JSRuntime* runtime, JSValue val)
+{
+    mqtt_broker_t* broker = JS_GetOpaque(val, mqtt_broker_class_id);
+    if (broker == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < MQTT_BROKER_EVENT_MAX; i++) {
+        JS_FreeValueRT(runtime, broker->events[i]);
+        broker->events[i] = JS_UNDEFINED;
+    }
+
+    broker->finalized = 1;
+    mqtt_broker_close(broker);
+    mqtt_broker_maybe_free(broker);
+}
+
+static void mqtt_broker_mark(JSRuntime* runtime, JSValueConst val, JS_MarkFunc* mark_func)
+{
+    mqtt_broker_t* broker = JS_GetOpaque(val, mqtt_broker_class_id);
+    if (broker) {
+        for (int i = 0; i < MQTT_BROKER_EVENT_MAX; i++) {
+            JS_MarkValue(runtime, broker->events[i], mark_func);
+        }
+    }
+}
+
+static JSClassDef mqtt_broker_class = {
+    "MQTTBroker",
+    .finalizer = mqtt_broker_finalizer,
+    .gc_mark = mqtt_broker_mark,
+};
+
+static mqtt_broker_t* mqtt_broker_get(JSContext* ctx, JSValueConst obj)
+{
+    return JS_GetOpaque2(ctx, obj, mqtt_broker_class_id);
+}
+
+/**
+ * `new Broker({ connectTimeout, maxPacketSize, maxQueueSize })`
+ */
+static JSValue mqtt_broker_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst* argv)
+{
+    JSValue obj = JS_NewObjectClass(ctx, mqtt_broker_class_id);
+    if (JS_IsException(obj)) {
+        return obj;
+    }
+
+    mqtt_broker_t* broker = calloc(1, sizeof(*broker));
+    if (!broker) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+
+    broker->ctx = ctx;
+    broker->root = mqtt_broker_node_new(NULL, "", 0);
+    broker->connect_timeout = MQTT_BROKER_CONNECT_TIMEOUT;
+    broker->max_packet_size = MQTT_BROKER_MAX_PACKET_SIZE;
+    broker->max_queue_size = MQTT_BROKER_MAX_QUEUE_SIZE;
+    init_list_head(&broker->listeners);
+    init_list_head(&broker->sessions);
+    init_list_head(&broker->pending_sessions);
+
+    CHECK_EQ(uv_idle_init(TJS_GetLoop(ctx), &broker->idle), 0);
+    broker->idle.data = broker;
+
+    for (int i = 0; i < MQTT_BROKER_EVENT_MAX; i++) {
+        broker->events[i] = JS_UNDEFINED;
+    }
+
+    if (argc > 0 && JS_IsObject(argv[0])) {
+        JSValueConst options = argv[0];
+        broker->connect_timeout = TJS_GetPropertyUint32(ctx, options, "connectTimeout", broker->connect_timeout);
+        broker->max_packet_size = TJS_GetPropertyUint32(ctx, options, "maxPacketSize", broker->max_packet_size);
+        broker->max_queue_size = TJS_GetPropertyUint32(ctx, options, "maxQueueSize", broker->max_queue_size);
+    }
+
+    JS_SetOpaque(obj, broker);
+    return obj;
+}
+
+/**
+ * 开始侦听, 可以多次调用同时侦听多个地址
+ * `listen(address, backlog, flags)`
+ * @param address 要绑定的 TCP 地址, 或者 Unix 域套接字 (命名管道) 的路径
+ * @param flags 同 `TCP.bind()`, 如 `TCP.REUSEPORT`
+ */
+static JSValue mqtt_broker_listen(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_broker_t* broker = mqtt_broker_get(ctx, this_val);
+    if (!broker) {
+        return JS_EXCEPTION;
+
+    } else if (broker->closing) {
+        return tjs_throw_uv_error(ctx, UV_EINVAL);
+    }
+
+    int backlog = 511;
+    if (argc > 1) {
+        backlog = TJS_ToInt32(ctx, argv[1], backlog);
+    }
+
+    int flags = 0;
+    if (argc > 2) {
+        flags = TJS_ToInt32(ctx, argv[2], 0);
+    }
+
+    struct sockaddr_storage ss;
+    const char* path = NULL;
+    if (JS_IsString(argv[0])) {
+        path = JS_ToCString(ctx, argv[0]);
+        if (!path) {
+            return JS_EXCEPTION;
+        }
+
+    } else if (TJS_ToSocketAddress(ctx, argv[0], &ss) != 0) {
+        return JS_EXCEPTION;
+    }
+
+    mqtt_broker_listener_t* listener = calloc(1, sizeof(*listener));
+    CHECK_NOT_NULL(listener);
+
+    listener->broker = broker;
+    listener->is_pipe = (path != NULL);
+
+    int ret;
+    uv_loop_t* loop = TJS_GetLoop(ctx);
+    if (path) {
+        CHECK_EQ(uv_pipe_init(loop, &listener->h.pipe, 0), 0);
+        ret = uv_pipe_bind(&listener->h.pipe, path);
+        JS_FreeCString(ctx, path);
+
+    } else {
+        CHECK_EQ(uv_tcp_init(loop, &listener->h.tcp), 0);
+        ret = tjs_tcp_bind_ex(&listener->h.tcp, (struct sockaddr*)&ss, flags);
+    }
+
+    listener->h.handle.data = listener;
+    list_add_tail(&listener->link, &broker->listeners);
+    broker->listener_count++;
+
+    if (ret == 0) {
+        ret = uv_listen(&listener->h.stream, backlog, mqtt_broker_on_connection);
+    }
+
+    if (ret != 0) {
+        mqtt_broker_listener_close(listener);
+        return tjs_throw_uv_error(ctx, ret);
+    }
+
+    return JS_UNDEFINED;
+}
+
+static JSValue mqtt_broker_close_method(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_broker_t* broker = mqtt_broker_get(ctx, this_val);
+    if (!broker) {
+        return JS_EXCEPTION;
+    }
+
+    mqtt_broker_close(broker);
+    return JS_UNDEFINED;
+}
+
+/**
+ * 返回所有侦听的地址, TCP 为 SocketAddress, Unix 域套接字为路径
+ */
+static JSValue mqtt_broker_addresses(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_broker_t* broker = mqtt_broker_get(ctx, this_val);
+    if (!broker) {
+        return JS_EXCEPTION;
+    }
+
+    JSValue result = JS_NewArray(ctx);
+    uint32_t index = 0;
+
+    struct list_head* el;
+    list_for_each(el, &broker->listeners)
+    {
+        mqtt_broker_listener_t* listener = list_entry(el, mqtt_broker_listener_t, link);
+        JSValue address = JS_UNDEFINED;
+        if (listener->is_pipe) {
+            char buf[1024];
+            size_t len = sizeof(buf);
+            if (uv_pipe_getsockname(&listener->h.pipe, buf, &len) == 0) {
+                address = JS_NewStringLen(ctx, buf, len);
+            }
+
+        } else {
+            struct sockaddr_storage addr;
+            int namelen = sizeof(addr);
+            if (uv_tcp_getsockname(&listener->h.tcp, (struct sockaddr*)&addr, &namelen) == 0) {
+                address = TJS_NewSocketAddress(ctx, (struct sockaddr*)&addr);
+            }
+        }
+
+        JS_SetPropertyUint32(ctx, result, index++, address);
+    }
+
+    return result;
+}
+
+/**
+ * 在本进程内直接发布消息
+ * `publish(topic, payload, qos, retained)`
+ * @return 返回发送的订阅者数量
+ */
+static JSValue mqtt_broker_publish_method(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_broker_t* broker = mqtt_broker_get(ctx, this_val);
+    if (!broker) {
+        return JS_EXCEPTION;
+    } else if (argc < 2) {
+        return JS_ThrowTypeError(ctx, "Invalid arguments");
+    }
+
+    size_t topic_length;
+    const char* topic = JS_ToCStringLen(ctx, &topic_length, argv[0]);
+    if (!topic) {
+        return JS_EXCEPTION;
+    }
+
+    tjs_buffer_t payload = TJS_ToArrayBuffer(ctx, argv[1]);
+    if (JS_IsException(payload.error)) {
+        JS_FreeCString(ctx, topic);
+        return payload.error;
+    }
+
+    int qos = (argc > 2) ? TJS_ToInt32(ctx, argv[2], 0) : 0;
+    int retained = (argc > 3) ? JS_ToBool(ctx, argv[3]) : 0;
+
+    JSValue result = JS_UNDEFINED;
+    mqtt_broker_message_t* message = NULL;
+    if (!mqtt_broker_check_topic(topic, topic_length) || qos < 0 || qos > 2) {
+        result = JS_ThrowTypeError(ctx, "Invalid topic or qos");
+        goto exit;
+    }
+
+    message = mqtt_broker_message_new(topic, topic_length, payload.data, payload.length, qos);
+    if (message == NULL) {
+        result = JS_ThrowRangeError(ctx, "Invalid publish message");
+        goto exit;
+    }
+
+    result = JS_NewUint32(ctx, mqtt_broker_publish(broker, message, retained));
+    mqtt_broker_message_release(message);
+
+exit:
+    if (payload.is_string) {
+        JS_FreeCString(ctx, (char*)payload.data);
+    }
+
+    JS_FreeCString(ctx, topic);
+    return result;
+}
+
+static JSValue mqtt_broker_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mqtt_broker_t* broker = mqtt_broker_get(ctx, this_val);
+    if (!broker) {
+        return JS_EXCEPTION;
+    }
+
+    JSValue result = JS_NewObject(ctx);
+    TJS_SetPropertyValue(ctx, result, "connections", JS_NewUint32(ctx, broker->session_count));
+    TJS_SetPropertyValue(ctx, result, "subscriptions", JS_NewUint32(ctx, broker->subscription_count));
+    TJS_SetPropertyValue(ctx, result, "retained", JS_NewUint32(ctx, broker->retained_count));
+    TJS_SetPropertyValue(ctx, result, "totalConnections", JS_NewInt64(ctx, broker->total_connections));
+    TJS_SetPropertyValue(ctx, result, "messagesReceived", JS_NewInt64(ctx, broker->messages_received));
+    TJS_SetPropertyValue(ctx, result, "messagesSent", JS_NewInt64(ctx, broker->messages_sent));
+    TJS_SetPropertyValue(ctx, result, "messagesDropped", JS_NewInt64(ctx, broker->messages_dropped));
+    return result;
+}
+
+static JSValue mqtt_broker_event_get(JSContext* ctx, JSValueConst this_val, int magic)
+{
+    mqtt_broker_t* broker = mqtt_broker_get(ctx, this_val);
+    if (!broker) {
+        return JS_EXCEPTION;
+    }
+
+    return JS_DupValue(ctx, broker->events[magic]);
+}
+
+static JSValue mqtt_broker_event_set(JSContext* ctx, JSValueConst this_val, JSValueConst value, int magic)
+{
+    mqtt_broker_t* broker = mqtt_broker_get(ctx, this_val);
+    if (!broker) {
+        return JS_EXCEPTION;
+    }
+
+    if (JS_IsFunction(ctx, value) || JS_IsUndefined(value) || JS_IsNull(value)) {
+        JS_FreeValue(ctx, broker->events[magic]);
+        broker->events[magic] = JS_DupValue(ctx, value);
+    }
+
+    return JS_UNDEFINED;
+}
+
+static const JSCFunctionListEntry mqtt_broker_proto_funcs[] = {
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "MQTTBroker", JS_PROP_CONFIGURABLE),
+    TJS_CFUNC_DEF("addresses", 0, mqtt_broker_addresses),
+    TJS_CFUNC_DEF("close", 0, mqtt_broker_close_method),
+    TJS_CFUNC_DEF("listen", 3, mqtt_broker_listen),
+    TJS_CFUNC_DEF("publish", 4, mqtt_broker_publish_method),
+    TJS_CFUNC_DEF("stats", 0, mqtt_broker_stats),
+    TJS_CGETSET_MAGIC_DEF("onerror", mqtt_broker_event_get, mqtt_broker_event_set, MQTT_BROKER_EVENT_ERROR),
+};
+
+void tjs_mod_mqtt_broker_init(JSContext* ctx, JSValue mqtt)
+{
+    JSRuntime* runtime = JS_GetRuntime(ctx);
+
+    JS_NewClassID(&mqtt_broker_class_id);
+    JS_NewClass(runtime, mqtt_broker_class_id, &mqtt_broker_class);
+    JSValue proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, mqtt_broker_proto_funcs, countof(mqtt_broker_proto_funcs));
+    JS_SetClassProto(ctx, mqtt_broker_class_id, proto);
+
+    JSValue brokerClass = JS_NewCFunction2(ctx, mqtt_broker_constructor, "MQTTBroker", 1, JS_CFUNC_constructor, 0);
+    JS_DefinePropertyValueStr(ctx, mqtt, "Broker", brokerClass, JS_PROP_C_W_E);
+}
@@ -274,42 +274,7 @@ static JSValue tjs_print_memory_usage(JSContext* ctx, JSValueConst this_val, int
     JS_ComputeMemoryUsage(runtime, &stats);
     JS_DumpMemoryUsage(file, &stats, runtime);
 
-#if 0
-    fprintf(file, "memory allocated:   %8ld, size: %ld\r\n", stats.malloc_count, stats.malloc_size);
-    fprintf(file, "memory used:        %8ld, size: %ld\r\n", stats.memory_used_count, stats.memory_used_size);
-    fprintf(file, "atoms:              %8ld, size: %ld\r\n", stats.atom_count, stats.atom_size);
-    fprintf(file, "strings:            %8ld, size: %ld\r\n", stats.str_count, stats.str_size);
-    fprintf(file, "objects:            %8ld, size: %ld\r\n", stats.obj_count, stats.obj_size);
-    fprintf(file, "properties:         %8ld, size: %ld\r\n", stats.prop_count, stats.prop_size);
-    fprintf(file, "shapes:             %8ld, size: %ld\r\n", stats.shape_count, stats.shape_size);
-    fprintf(file, "functions:          %8ld, size: %ld, bytecode: %ld\r\n", stats.js_func_count, stats.js_func_size, stats.js_func_code_size);
-    fprintf(file, "pc2line:            %8ld, size: %ld\r\n", stats.js_func_pc2line_count, stats.js_func_pc2line_size);
-    fprintf(file, "C functions:        %8ld\r\n", stats.c_func_count);
-    fprintf(file, "arrays:             %8ld, fast arrays: %ld, elements: %ld\r\n", stats.array_count, stats.fast_array_count, stats.fast_array_elements);
-    fprintf(file, "binary objects:     %8ld, size: %ld\r\n", stats.binary_object_count, stats.binary_object_size);
-
-    {
-
-        int* object_classes = &stats.object_classes[0];
-        fprintf(file, "\nJSObject classes (%d)\n", stats.class_count);
-        if (object_classes[0]) {
-            fprintf(file, "  %5d  %2.0d %s\n", object_classes[0], 0, "none");
-        }
-
-        int class_id = 0;
-        int JS_CLASS_INIT_COUNT = stats.class_count;
-        for (class_id = 1; class_id < JS_CLASS_INIT_COUNT; class_id++) {
-            if (object_classes[class_id]) {
-                char buf[64];
-                fprintf(file, "  %5d  %d\n", object_classes[class_id], class_id);
-            }
-        }
-
-        if (object_classes[JS_CLASS_INIT_COUNT]) {
-            fprintf(file, "  %5d  %d\n", object_classes[JS_CLASS_INIT_COUNT], 0);
-        }
-    }
-#endif
+    tjs_heap_print_usage(ctx, file);
 
     if (file_handle) {
         fclose(file_handle);
@@ -49,6 +49,9 @@
 #define TJS__PATHSEP '/'
 #endif
 
+typedef struct tjs_profiler_s tjs_profiler_t;
+typedef struct tjs_atomics_wait_s tjs_atomics_wait_t;
+
 struct TJSRuntime {
     TJSRuntimeOptions options;
     JSRuntime *rt;
@@ -71,6 +74,8 @@ struct TJSRuntime {
     struct {
         JSValue u8array_ctor;
     } builtins;
+    tjs_profiler_t *profiler;
+    tjs_atomics_wait_t *atomics_waits;
 };
 
 ///////////////////////////////////////////////////////////////
@@ -82,11 +87,17 @@ JSValue tjs_new_uv_error(JSContext *ctx, int err);
 /** 抛出一个 libuv 错误 */
 JSValue tjs_throw_uv_error(JSContext *ctx, int err);
 
+///////////////////////////////////////////////////////////////
+// socket
+
+/** 设置 SO_REUSEPORT 选项, 不支持时返回 UV_ENOTSUP */
+int tjs_socket_set_reuse_port(uv_os_sock_t sock);
+
 ///////////////////////////////////////////////////////////////
 // pipe
 
 /** 新建一个 Pipe 管道类的实例 */
-JSValue tjs_pipe_new(JSContext *ctx);
+JSValue tjs_pipe_new(JSContext *ctx, int ipc);
 
 /** 返回这个管理关联的 libuv stream 实例 */
 uv_stream_t *tjs_pipe_get_stream(JSContext *ctx, JSValueConst pipe);
@@ -103,6 +114,72 @@ void tjs_execute_pending_jobs(JSContext *ctx);
 /** 读取一个文件的内容 */
 int tjs_load_file(JSContext *ctx, DynBuf *dbuf, const char *filename);
 
+///////////////////////////////////////////////////////////////
+// utf8
+
+/** UTF-8 -> 字符串: (data, offset?, length?, flags?) */
+JSValue tjs_utf8_decode(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+
+/** 字符串 -> UTF-8 Uint8Array: (string) */
+JSValue tjs_utf8_encode(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+
+///////////////////////////////////////////////////////////////
+// codec
+
+/** util.encode() 和 util.decode() 的编码格式 */
+enum tjs_codec_type_enum {
+    CODE_HEX = 10,
+    CODE_BASE64 = 11,
+    CODE_BASE64URL = 12
+};
+
+/** 编码为 hex/base64/base64url 字符串: (data, type?) */
+JSValue tjs_codec_encode(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+
+/** 解码 hex/base64/base64url 字符串为 Uint8Array: (data, type?) */
+JSValue tjs_codec_decode(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+
+///////////////////////////////////////////////////////////////
+// profiler
+
+/** 开始 CPU 采样, interval 为采样间隔 (微秒), 为 0 时使用默认值 */
+int tjs_profiler_start(TJSRuntime *qrt, uint32_t interval, uint32_t max_samples);
+
+/** 停止 CPU 采样, 返回 .cpuprofile 格式的对象, 没有开始时返回 undefined */
+JSValue tjs_profiler_stop(TJSRuntime *qrt);
+
+/** 事件循环即将等待 I/O 时调用 */
+void tjs_profiler_on_prepare(TJSRuntime *qrt);
+
+/** 放弃并释放当前的采样数据 */
+void tjs_profiler_close(TJSRuntime *qrt);
+
+/** 指定了 --cpu-prof 时, 停止采样并写入到当前目录下的 .cpuprofile 文件 */
+int tjs_profiler_write_file(TJSRuntime *qrt);
+
+///////////////////////////////////////////////////////////////
+// heap
+
+/** 原生对象的类型, 用于统计原生内存的使用情况 */
+typedef enum tjs_heap_type_enum {
+    TJS_HEAP_STREAM = 0, /* TCP, Pipe, TTY 流 */
+    TJS_HEAP_TLS, /* TLS 流, 包含 TLS 上下文 */
+    TJS_HEAP_TIMER,
+    TJS_HEAP_UDP,
+    TJS_HEAP_WRITE, /* 等待发送的流数据 */
+    TJS_HEAP_SAB, /* SharedArrayBuffer, 多个线程共享 */
+    TJS_HEAP_TYPE_COUNT
+} tjs_heap_type_t;
+
+/** 记录分配了一个原生对象, 所有线程共用同一组计数器 */
+void tjs_heap_add(tjs_heap_type_t type, size_t size);
+
+/** 记录释放了一个原生对象 */
+void tjs_heap_remove(tjs_heap_type_t type, size_t size);
+
+/** 打印各个类的对象数和原生对象的内存使用情况 */
+void tjs_heap_print_usage(JSContext *ctx, FILE *file);
+
 ///////////////////////////////////////////////////////////////
 // module
 
@@ -159,6 +236,12 @@ int tjs_init_internal_modules(JSContext* ctx);
 /** 创建一个工作线程运行时 */
 TJSRuntime *tjs_new_worker_runtime(void);
 
+/** 设置 SharedArrayBuffer 的分配函数, 只有工作线程可以调用 Atomics.wait */
+void tjs_worker_init_runtime(TJSRuntime *qrt);
+
+/** 取消这个运行时所有未完成的 Atomics.waitAsync */
+void tjs_worker_close_runtime(TJSRuntime *qrt);
+
 /** 返回相关的 loop */
 uv_loop_t *TJS_GetLoopRT(TJSRuntime *runtime);
 
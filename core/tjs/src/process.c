@@ -28,6 +28,15 @@
 #include <string.h>
 #include <unistd.h>
 
+/** `exec()` 默认每个输出最多保存的字节数 */
+#define TJS_EXEC_MAX_BUFFER (1024 * 1024)
+
+/** `exec()` 超时后先发送 killSignal, 再过这么长时间 (毫秒) 还没有结束则发送 SIGKILL */
+#define TJS_EXEC_KILL_TIMEOUT 2000
+
+/** `exec()` 的进程退出后, 最多再等待这么长时间 (毫秒) 读取剩余的输出 */
+#define TJS_EXEC_EXIT_TIMEOUT 100
+
 static JSClassID tjs_process_class_id;
 
 typedef struct tjs_process_s {
@@ -35,7 +44,7 @@ typedef struct tjs_process_s {
     bool closed;
     bool finalized;
     uv_process_t process;
-    JSValue stdio[3];
+    JSValue stdio[4];
 
     struct {
         bool exited;
@@ -71,10 +80,12 @@ static void tjs_process_clear(TJSProcess* process)
     JS_FreeValue(ctx, process->stdio[0]);
     JS_FreeValue(ctx, process->stdio[1]);
     JS_FreeValue(ctx, process->stdio[2]);
+    JS_FreeValue(ctx, process->stdio[3]);
 
     process->stdio[0] = JS_UNDEFINED;
     process->stdio[1] = JS_UNDEFINED;
     process->stdio[2] = JS_UNDEFINED;
+    process->stdio[3] = JS_UNDEFINED;
 }
 
 static void tjs_process_finalizer(JSRuntime* rt, JSValue val)
@@ -103,6 +114,7 @@ static void tjs_process_mark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_
         JS_MarkValue(rt, process->stdio[0], mark_func);
         JS_MarkValue(rt, process->stdio[1], mark_func);
         JS_MarkValue(rt, process->stdio[2], mark_func);
+        JS_MarkValue(rt, process->stdio[3], mark_func);
     }
 }
 
@@ -229,7 +241,7 @@ static int tjs_spawn_free_options(JSContext* ctx, uv_process_options_t* options)
 static int tjs_spawn_get_stdio_options(JSContext* ctx, TJSProcess* process, uv_process_options_t* options, JSValueConst arg1)
 {
     // stdio
-    uv_stdio_container_t* stdio = js_malloc(ctx, sizeof(uv_stdio_container_t) * 3);
+    uv_stdio_container_t* stdio = js_malloc(ctx, sizeof(uv_stdio_container_t) * 4);
 
     stdio[0].flags = UV_INHERIT_FD;
     stdio[0].data.fd = STDIN_FILENO;
@@ -256,7 +268,7 @@ static int tjs_spawn_get_stdio_options(JSContext* ctx, TJSProcess* process, uv_p
             stdio[0].data.fd = STDIN_FILENO;
 
         } else if (strcmp(in, "pipe") == 0) {
-            JSValue obj = tjs_pipe_new(ctx);
+            JSValue obj = tjs_pipe_new(ctx, 0);
             if (JS_IsException(obj)) {
                 JS_FreeValue(ctx, js_stdin);
                 JS_FreeCString(ctx, in);
@@ -286,7 +298,7 @@ static int tjs_spawn_get_stdio_options(JSContext* ctx, TJSProcess* process, uv_p
             stdio[1].data.fd = STDOUT_FILENO;
 
         } else if (strcmp(out, "pipe") == 0) {
-            JSValue obj = tjs_pipe_new(ctx);
+            JSValue obj = tjs_pipe_new(ctx, 0);
             if (JS_IsException(obj)) {
                 JS_FreeValue(ctx, js_stdout);
                 JS_FreeCString(ctx, out);
@@ -316,7 +328,7 @@ static int tjs_spawn_get_stdio_options(JSContext* ctx, TJSProcess* process, uv_p
             stdio[2].data.fd = STDERR_FILENO;
 
         } else if (strcmp(err, "pipe") == 0) {
-            JSValue obj = tjs_pipe_new(ctx);
+            JSValue obj = tjs_pipe_new(ctx, 0);
             if (JS_IsException(obj)) {
                 JS_FreeValue(ctx, js_stderr);
                 JS_FreeCString(ctx, err);
@@ -337,6 +349,19 @@ static int tjs_spawn_get_stdio_options(JSContext* ctx, TJSProcess* process, uv_p
 
     JS_FreeValue(ctx, js_stderr);
 
+    /* ipc: 以 fd 3 创建一个 IPC 管道, 可以用来和子进程交换消息和传递句柄 */
+    if (TJS_GetPropertyUint32(ctx, arg1, "ipc", 0)) {
+        JSValue obj = tjs_pipe_new(ctx, 1);
+        if (JS_IsException(obj)) {
+            goto fail;
+        }
+
+        process->stdio[3] = obj;
+        stdio[3].flags = UV_CREATE_PIPE | UV_READABLE_PIPE | UV_WRITABLE_PIPE;
+        stdio[3].data.stream = tjs_pipe_get_stream(ctx, obj);
+        options->stdio_count = 4;
+    }
+
     return 0;
 
 fail:
@@ -431,6 +456,10 @@ static int tjs_spawn_get_env_options(JSContext* ctx, uv_process_options_t* optio
             size_t len = strlen(key) + strlen(value) + 2; /* KEY=VALUE\0 */
             options->env[i] = js_malloc(ctx, len);
             snprintf(options->env[i], len, "%s=%s", key, value);
+
+            JS_FreeCString(ctx, key);
+            JS_FreeCString(ctx, value);
+            JS_FreeValue(ctx, prop);
         }
 
         JS_FreePropEnum(ctx, ptab, plen);
@@ -498,6 +527,7 @@ static JSValue tjs_spawn(JSContext* ctx, JSValueConst this_val, int argc, JSValu
     process->stdio[0] = JS_UNDEFINED;
     process->stdio[1] = JS_UNDEFINED;
     process->stdio[2] = JS_UNDEFINED;
+    process->stdio[3] = JS_UNDEFINED;
 
     uv_process_options_t options;
     memset(&options, 0, sizeof(options));
@@ -551,6 +581,7 @@ fail:
     JS_FreeValue(ctx, process->stdio[0]);
     JS_FreeValue(ctx, process->stdio[1]);
     JS_FreeValue(ctx, process->stdio[2]);
+    JS_FreeValue(ctx, process->stdio[3]);
     free(process);
 
     result = JS_EXCEPTION;
@@ -561,6 +592,432 @@ cleanup:
     return result;
 }
 
+/** `exec()` 的一个输出 (stdout 或 stderr), 保存到可增长的缓存区中 */
+typedef struct tjs_exec_output_s {
+    uv_pipe_t pipe;
+    char* data;
+    size_t length;
+    size_t capacity;
+    bool closed;
+
+    /** 为 false 时这个输出被忽略或者继承自当前进程, 不收集 */
+    bool piped;
+} TJSExecOutput;
+
+typedef struct tjs_exec_s {
+    JSContext* ctx;
+    uv_process_t process;
+    uv_timer_t timer;
+    TJSExecOutput outputs[2];
+    TJSPromise result;
+
+    size_t max_buffer;
+    uint32_t kill_timeout;
+    int kill_signal;
+    bool lines;
+
+    /** 还没有关闭的句柄个数 */
+    int handle_count;
+
+    bool exited;
+
+    /** 超时后已发送过 killSignal */
+    bool killed;
+    bool settled;
+    bool timed_out;
+    bool truncated;
+    int64_t exit_status;
+    int term_signal;
+} TJSExec;
+
+static void tjs_exec_close_callback(uv_handle_t* handle)
+{
+    TJSExec* exec = handle->data;
+    CHECK_NOT_NULL(exec);
+
+    exec->handle_count--;
+    if (exec->handle_count == 0) {
+        free(exec->outputs[0].data);
+        free(exec->outputs[1].data);
+        free(exec);
+    }
+}
+
+static void tjs_exec_close_handle(TJSExec* exec, uv_handle_t* handle)
+{
+    if (!uv_is_closing(handle)) {
+        uv_close(handle, tjs_exec_close_callback);
+    }
+}
+
+static void tjs_exec_close_output(TJSExec* exec, TJSExecOutput* output)
+{
+    if (!output->closed) {
+        output->closed = true;
+        uv_read_stop((uv_stream_t*)&output->pipe);
+        tjs_exec_close_handle(exec, (uv_handle_t*)&output->pipe);
+    }
+}
+
+/** 向还没有退出的进程发送信号, 返回是否已发送 */
+static bool tjs_exec_kill(TJSExec* exec, int signal_number)
+{
+    return !exec->exited && uv_process_kill(&exec->process, signal_number) == 0;
+}
+
+/** 按行分割输出, 去掉行尾的 `\r`, 最后不完整的一行也作为一行 */
+static JSValue tjs_exec_new_lines(JSContext* ctx, TJSExecOutput* output)
+{
+    JSValue lines = JS_NewArray(ctx);
+    uint32_t count = 0;
+
+    const char* data = output->data;
+    const char* end = data + output->length;
+    while (data < end) {
+        const char* next = memchr(data, '\n', end - data);
+        const char* line_end = next ? next : end;
+        size_t length = line_end - data;
+        if (length > 0 && data[length - 1] == '\r') {
+            length--;
+        }
+
+        JS_DefinePropertyValueUint32(ctx, lines, count++, JS_NewStringLen(ctx, data, length), JS_PROP_C_W_E);
+        data = next ? next + 1 : end;
+    }
+
+    return lines;
+}
+
+static JSValue tjs_exec_new_output(JSContext* ctx, TJSExec* exec, TJSExecOutput* output)
+{
+    if (exec->lines) {
+        return tjs_exec_new_lines(ctx, output);
+    }
+
+    return JS_NewStringLen(ctx, output->data ? output->data : "", output->length);
+}
+
+/** 进程已经退出并且两个输出都已关闭时返回结果 */
+static void tjs_exec_maybe_finish(TJSExec* exec)
+{
+    if (exec->settled || !exec->exited || !exec->outputs[0].closed || !exec->outputs[1].closed) {
+        return;
+    }
+
+    exec->settled = true;
+
+    JSContext* ctx = exec->ctx;
+    JSValue result = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, result, "code", JS_NewInt32(ctx, exec->exit_status), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, result, "signal", JS_NewInt32(ctx, exec->term_signal), JS_PROP_C_W_E);
+    if (exec->outputs[0].piped) {
+        JS_DefinePropertyValueStr(ctx, result, "stdout", tjs_exec_new_output(ctx, exec, &exec->outputs[0]), JS_PROP_C_W_E);
+    }
+
+    if (exec->outputs[1].piped) {
+        JS_DefinePropertyValueStr(ctx, result, "stderr", tjs_exec_new_output(ctx, exec, &exec->outputs[1]), JS_PROP_C_W_E);
+    }
+
+    if (exec->timed_out) {
+        JS_DefinePropertyValueStr(ctx, result, "timedOut", JS_TRUE, JS_PROP_C_W_E);
+    }
+
+    if (exec->truncated) {
+        JS_DefinePropertyValueStr(ctx, result, "truncated", JS_TRUE, JS_PROP_C_W_E);
+    }
+
+    TJS_SettlePromise(ctx, &exec->result, false, 1, (JSValueConst*)&result);
+
+    tjs_exec_close_handle(exec, (uv_handle_t*)&exec->timer);
+    tjs_exec_close_handle(exec, (uv_handle_t*)&exec->process);
+}
+
+/** 进程退出后不再等待输出管道关闭 */
+static void tjs_exec_exit_timer_callback(uv_timer_t* handle)
+{
+    TJSExec* exec = handle->data;
+    CHECK_NOT_NULL(exec);
+
+    tjs_exec_close_output(exec, &exec->outputs[0]);
+    tjs_exec_close_output(exec, &exec->outputs[1]);
+    tjs_exec_maybe_finish(exec);
+}
+
+static void tjs_exec_exit_callback(uv_process_t* handle, int64_t exit_status, int term_signal)
+{
+    TJSExec* exec = handle->data;
+    CHECK_NOT_NULL(exec);
+
+    exec->exited = true;
+    exec->exit_status = exit_status;
+    exec->term_signal = term_signal;
+    tjs_exec_maybe_finish(exec);
+
+    if (!exec->settled) {
+        // 子进程创建的其他进程可能还占用着输出管道, 只再等待一小段时间
+        uv_timer_start(&exec->timer, tjs_exec_exit_timer_callback, TJS_EXEC_EXIT_TIMEOUT, 0);
+    }
+}
+
+/** 输出超过 maxBuffer 后读到的数据写到这里并丢弃 */
+static char tjs_exec_discard_buffer[4096];
+
+static TJSExecOutput* tjs_exec_get_output(TJSExec* exec, uv_handle_t* handle)
+{
+    return (handle == (uv_handle_t*)&exec->outputs[0].pipe) ? &exec->outputs[0] : &exec->outputs[1];
+}
+
+static void tjs_exec_alloc_callback(uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf)
+{
+    TJSExec* exec = handle->data;
+    TJSExecOutput* output = tjs_exec_get_output(exec, handle);
+
+    size_t available = exec->max_buffer - output->length;
+    if (available == 0) {
+        *buf = uv_buf_init(tjs_exec_discard_buffer, sizeof(tjs_exec_discard_buffer));
+        return;
+    }
+
+    if (output->capacity - output->length < 4096 && output->capacity < exec->max_buffer) {
+        size_t capacity = output->capacity ? output->capacity * 2 : 4096;
+        if (capacity > exec->max_buffer) {
+            capacity = exec->max_buffer;
+        }
+
+        char* data = realloc(output->data, capacity);
+        if (data) {
+            output->data = data;
+            output->capacity = capacity;
+        }
+    }
+
+    if (output->capacity == output->length) {
+        *buf = uv_buf_init(tjs_exec_discard_buffer, sizeof(tjs_exec_discard_buffer));
+        return;
+    }
+
+    *buf = uv_buf_init(output->data + output->length, output->capacity - output->length);
+}
+
+static void tjs_exec_read_callback(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf)
+{
+    TJSExec* exec = handle->data;
+    TJSExecOutput* output = tjs_exec_get_output(exec, (uv_handle_t*)handle);
+
+    if (nread < 0) {
+        tjs_exec_close_output(exec, output);
+        tjs_exec_maybe_finish(exec);
+        return;
+
+    } else if (nread == 0) {
+        return;
+
+    } else if (buf->base == tjs_exec_discard_buffer) {
+        // 超过 maxBuffer: 结束进程并关闭这个输出, 子进程创建的其他进程继续写时会收到 SIGPIPE
+        exec->truncated = true;
+        tjs_exec_kill(exec, exec->kill_signal);
+        tjs_exec_close_output(exec, output);
+        tjs_exec_maybe_finish(exec);
+        return;
+    }
+
+    output->length += nread;
+}
+
+static void tjs_exec_timer_callback(uv_timer_t* handle)
+{
+    TJSExec* exec = handle->data;
+    CHECK_NOT_NULL(exec);
+
+    // 只有确实向进程发送了信号时才设置 timedOut
+    if (!exec->killed) {
+        exec->killed = true;
+        if (tjs_exec_kill(exec, exec->kill_signal)) {
+            exec->timed_out = true;
+        }
+
+        uv_timer_start(&exec->timer, tjs_exec_timer_callback, exec->kill_timeout, 0);
+        return;
+    }
+
+    // 还没有结束: 强制结束进程, 并且不再等待输出 (可能被子进程的子进程占用)
+    if (tjs_exec_kill(exec, SIGKILL)) {
+        exec->timed_out = true;
+    }
+
+    tjs_exec_close_output(exec, &exec->outputs[0]);
+    tjs_exec_close_output(exec, &exec->outputs[1]);
+    tjs_exec_maybe_finish(exec);
+}
+
+/**
+ * 读取 exec 的 stdin, stdout 或 stderr 选项
+ * - 可以是 `ignore` 或 `inherit`, stdout 和 stderr 还可以是 `pipe`
+ * @returns 对应的 uv_stdio_flags, 选项无效时返回 -1
+ */
+static int tjs_exec_get_stdio_flags(JSContext* ctx, JSValueConst options, const char* name, int flags)
+{
+    JSValue value = JS_GetPropertyStr(ctx, options, name);
+    if (JS_IsException(value)) {
+        return -1;
+
+    } else if (JS_IsUndefined(value)) {
+        return flags;
+    }
+
+    const char* str = JS_ToCString(ctx, value);
+    JS_FreeValue(ctx, value);
+    if (!str) {
+        return -1;
+    }
+
+    if (strcmp(str, "ignore") == 0) {
+        flags = UV_IGNORE;
+
+    } else if (strcmp(str, "inherit") == 0) {
+        flags = UV_INHERIT_FD;
+
+    } else if (strcmp(str, "pipe") == 0 && strcmp(name, "stdin") != 0) {
+        flags = UV_CREATE_PIPE;
+
+    } else {
+        JS_ThrowTypeError(ctx, "Invalid %s option: '%s'", name, str);
+        flags = -1;
+    }
+
+    JS_FreeCString(ctx, str);
+    return flags;
+}
+
+/**
+ * 执行一个命令, 在本地缓存区中收集它的输出, 结束后返回一个结果对象
+ * `exec(args, { env, cwd, uid, gid, stdin, stdout, stderr, maxBuffer, timeout, killSignal, killTimeout, lines })`
+ * @param stdin `ignore` (默认) 或 `inherit`
+ * @param stdout `pipe` (默认), `ignore` 或 `inherit`, 只收集 `pipe` 的输出, stderr 相同
+ * @param maxBuffer stdout 和 stderr 各自最多保存的字节数, 超过后结束进程并设置 `truncated`
+ * @param timeout 超时时间 (毫秒), 超时后发送 killSignal, 再过 killTimeout 毫秒后发送 SIGKILL
+ * - 进程退出后最多再等待 TJS_EXEC_EXIT_TIMEOUT 毫秒读取输出, 不等待仍占用管道的子进程
+ * @param lines 为 true 时 stdout 和 stderr 返回按行分割后的字符串数组
+ * @return Promise<{ code, signal, stdout, stderr, timedOut, truncated }>
+ */
+static JSValue tjs_exec(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    if (argc < 1) {
+        return JS_ThrowTypeError(ctx, "only string and array are allowed");
+    }
+
+    JSValueConst arg1 = argc > 1 ? argv[1] : JS_UNDEFINED;
+    uint32_t timeout = 0;
+    int stdio_flags[3] = { UV_IGNORE, UV_CREATE_PIPE, UV_CREATE_PIPE };
+    static const char* stdio_names[3] = { "stdin", "stdout", "stderr" };
+
+    TJSExec* exec = calloc(1, sizeof(*exec));
+    if (!exec) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    exec->ctx = ctx;
+    exec->max_buffer = TJS_EXEC_MAX_BUFFER;
+    exec->kill_signal = SIGTERM;
+    exec->kill_timeout = TJS_EXEC_KILL_TIMEOUT;
+
+    uv_process_options_t options;
+    memset(&options, 0, sizeof(options));
+
+    if (tjs_spawn_get_args_options(ctx, &options, argv[0]) < 0) {
+        goto fail;
+    }
+
+    if (JS_IsObject(arg1)) {
+        if (tjs_spawn_get_options(ctx, &options, arg1) < 0) {
+            goto fail;
+        }
+
+        exec->max_buffer = TJS_GetPropertyUint32(ctx, arg1, "maxBuffer", exec->max_buffer);
+        exec->kill_signal = TJS_GetPropertyInt32(ctx, arg1, "killSignal", exec->kill_signal);
+        exec->kill_timeout = TJS_GetPropertyUint32(ctx, arg1, "killTimeout", exec->kill_timeout);
+        exec->lines = TJS_GetPropertyUint32(ctx, arg1, "lines", 0) != 0;
+        timeout = TJS_GetPropertyUint32(ctx, arg1, "timeout", 0);
+
+        for (int i = 0; i < 3; i++) {
+            stdio_flags[i] = tjs_exec_get_stdio_flags(ctx, arg1, stdio_names[i], stdio_flags[i]);
+            if (stdio_flags[i] < 0) {
+                goto fail;
+            }
+        }
+    }
+
+    uv_loop_t* loop = TJS_GetLoop(ctx);
+    uv_stdio_container_t stdio[3];
+    for (int i = 0; i < 3; i++) {
+        stdio[i].flags = (uv_stdio_flags)stdio_flags[i];
+        stdio[i].data.fd = i;
+    }
+
+    for (int i = 0; i < 2; i++) {
+        TJSExecOutput* output = &exec->outputs[i];
+        if (stdio_flags[i + 1] != UV_CREATE_PIPE) {
+            output->closed = true;
+            continue;
+        }
+
+        CHECK_EQ(uv_pipe_init(loop, &output->pipe, 0), 0);
+        output->pipe.data = exec;
+        output->piped = true;
+        exec->handle_count++;
+
+        stdio[i + 1].flags = UV_CREATE_PIPE | UV_WRITABLE_PIPE;
+        stdio[i + 1].data.stream = (uv_stream_t*)&output->pipe;
+    }
+
+    options.stdio = stdio;
+    options.stdio_count = 3;
+    options.exit_cb = tjs_exec_exit_callback;
+    exec->process.data = exec;
+
+    int ret = uv_spawn(loop, &exec->process, &options);
+
+    // uv_spawn 使用了 options.stdio, 这里不能让 tjs_spawn_free_options 释放它
+    options.stdio = NULL;
+    tjs_spawn_free_options(ctx, &options);
+
+    if (ret != 0) {
+        // 进程句柄在 uv_spawn 失败时也需要关闭
+        exec->handle_count++;
+        exec->settled = true;
+        tjs_exec_close_handle(exec, (uv_handle_t*)&exec->process);
+        tjs_exec_close_output(exec, &exec->outputs[0]);
+        tjs_exec_close_output(exec, &exec->outputs[1]);
+        return tjs_throw_uv_error(ctx, ret);
+    }
+
+    exec->handle_count++;
+    CHECK_EQ(uv_timer_init(loop, &exec->timer), 0);
+    exec->timer.data = exec;
+    exec->handle_count++;
+
+    if (timeout > 0) {
+        uv_timer_start(&exec->timer, tjs_exec_timer_callback, timeout, 0);
+    }
+
+    for (int i = 0; i < 2; i++) {
+        TJSExecOutput* output = &exec->outputs[i];
+        if (output->closed) {
+            continue;
+
+        } else if (uv_read_start((uv_stream_t*)&output->pipe, tjs_exec_alloc_callback, tjs_exec_read_callback) != 0) {
+            tjs_exec_close_output(exec, output);
+        }
+    }
+
+    return TJS_InitPromise(ctx, &exec->result);
+
+fail:
+    tjs_spawn_free_options(ctx, &options);
+    free(exec);
+    return JS_EXCEPTION;
+}
+
 static JSClassDef tjs_process_class = {
     "Process",
     .finalizer = tjs_process_finalizer,
@@ -574,10 +1031,12 @@ static const JSCFunctionListEntry tjs_process_proto_funcs[] = {
     TJS_CGETSET_MAGIC_DEF("stdin", tjs_process_stdio_get, NULL, 0),
     TJS_CGETSET_MAGIC_DEF("stdout", tjs_process_stdio_get, NULL, 1),
     TJS_CGETSET_MAGIC_DEF("stderr", tjs_process_stdio_get, NULL, 2),
+    TJS_CGETSET_MAGIC_DEF("ipc", tjs_process_stdio_get, NULL, 3),
     JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Process", JS_PROP_CONFIGURABLE),
 };
 
 static const JSCFunctionListEntry tjs_process_funcs[] = {
+    TJS_CFUNC_DEF("exec", 2, tjs_exec),
     TJS_CFUNC_DEF("spawn", 2, tjs_spawn),
 };
 
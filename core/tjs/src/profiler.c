@@ -0,0 +1,459 @@
+/* CPU 采样分析器 */
+#include "private.h"
+#include "tjs-utils.h"
+
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/** 默认的采样间隔 (微秒) */
+#define TJS_PROFILER_INTERVAL 1000
+
+/** 最小的采样间隔 (微秒) */
+#define TJS_PROFILER_INTERVAL_MIN 100
+
+/** 默认最多保留的采样数, 超过后覆盖最早的采样 */
+#define TJS_PROFILER_MAX_SAMPLES (64 * 1024)
+
+/** 最多记录的调用栈深度 */
+#define TJS_PROFILER_MAX_DEPTH 256
+
+/** 调用树的节点, 0 为根节点 */
+typedef struct tjs_profiler_node_s {
+    JSAtom func_name;
+    JSAtom filename;
+    int line_num;
+    uint32_t parent;
+    uint32_t first_child;
+    uint32_t next_sibling;
+} tjs_profiler_node_t;
+
+typedef struct tjs_profiler_sample_s {
+    uint32_t node;
+    uint64_t timestamp; /* 纳秒 */
+} tjs_profiler_sample_t;
+
+struct tjs_profiler_s {
+    JSContext* ctx;
+
+    /* 采样线程 */
+    uv_thread_t thread;
+    uv_mutex_t mutex;
+    uv_cond_t cond;
+    int stopping;
+
+    /* 采样线程请求采样的时间, 0 表示已处理 */
+    _Atomic uint64_t pending;
+    uint64_t interval; /* 纳秒 */
+    uint64_t start_time;
+
+    /* 事件循环的轮数, 用于判断两次中断检查之间是否进入过事件循环 */
+    uint32_t loop_count;
+    uint32_t last_loop_count;
+
+    tjs_profiler_node_t* nodes;
+    uint32_t node_count;
+    uint32_t node_capacity;
+
+    /* 环形缓存区 */
+    tjs_profiler_sample_t* samples;
+    uint32_t sample_capacity;
+    uint32_t sample_head;
+    uint32_t sample_count;
+
+    JSStackFrameInfo frames[TJS_PROFILER_MAX_DEPTH];
+};
+
+static void tjs_profiler_thread(void* arg)
+{
+    tjs_profiler_t* profiler = arg;
+
+    uv_mutex_lock(&profiler->mutex);
+    while (!profiler->stopping) {
+        uv_cond_timedwait(&profiler->cond, &profiler->mutex, profiler->interval);
+        if (profiler->stopping) {
+            break;
+        }
+
+        /* 上一次的请求还没有被处理时不更新, 以便发现空闲期间的请求 */
+        uint64_t expected = 0;
+        atomic_compare_exchange_strong(&profiler->pending, &expected, uv_hrtime());
+    }
+
+    uv_mutex_unlock(&profiler->mutex);
+}
+
+static uint32_t tjs_profiler_get_child(tjs_profiler_t* profiler, uint32_t parent, JSStackFrameInfo* frame)
+{
+    JSContext* ctx = profiler->ctx;
+    tjs_profiler_node_t* node = NULL;
+
+    uint32_t index = profiler->nodes[parent].first_child;
+    while (index) {
+        node = &profiler->nodes[index];
+        if (node->func_name == frame->func_name && node->filename == frame->filename && node->line_num == frame->line_num) {
+            JS_FreeAtom(ctx, frame->func_name);
+            JS_FreeAtom(ctx, frame->filename);
+            return index;
+        }
+
+        index = node->next_sibling;
+    }
+
+    if (profiler->node_count >= profiler->node_capacity) {
+        uint32_t capacity = profiler->node_capacity * 2;
+        tjs_profiler_node_t* nodes = js_realloc(ctx, profiler->nodes, capacity * sizeof(*nodes));
+        if (nodes == NULL) {
+            JS_FreeAtom(ctx, frame->func_name);
+            JS_FreeAtom(ctx, frame->filename);
+            return 0;
+        }
+
+        profiler->nodes = nodes;
+        profiler->node_capacity = capacity;
+    }
+
+    index = profiler->node_count++;
+    node = &profiler->nodes[index];
+    node->func_name = frame->func_name;
+    node->filename = frame->filename;
+    node->line_num = frame->line_num;
+    node->parent = parent;
+    node->first_child = 0;
+    node->next_sibling = profiler->nodes[parent].first_child;
+    profiler->nodes[parent].first_child = index;
+    return index;
+}
+
+static void tjs_profiler_sample(tjs_profiler_t* profiler, uint64_t timestamp)
+{
+    JSStackFrameInfo* frames = profiler->frames;
+    int count = JS_GetStackFrames(profiler->ctx, frames, TJS_PROFILER_MAX_DEPTH);
+
+    /* 从最外层的调用开始查找或添加节点 */
+    uint32_t node = 0;
+    int i = count - 1;
+    for (; i >= 0; i--) {
+        node = tjs_profiler_get_child(profiler, node, &frames[i]);
+        if (node == 0) {
+            break;
+        }
+    }
+
+    for (i = i - 1; i >= 0; i--) {
+        JS_FreeAtom(profiler->ctx, frames[i].func_name);
+        JS_FreeAtom(profiler->ctx, frames[i].filename);
+    }
+
+    uint32_t index = (profiler->sample_head + profiler->sample_count) % profiler->sample_capacity;
+    if (profiler->sample_count < profiler->sample_capacity) {
+        profiler->sample_count++;
+
+    } else {
+        profiler->sample_head = (profiler->sample_head + 1) % profiler->sample_capacity;
+    }
+
+    profiler->samples[index].node = node;
+    profiler->samples[index].timestamp = timestamp;
+}
+
+/** 在 JS 代码执行过程中被周期性调用 */
+static int tjs_profiler_interrupt_handler(JSRuntime* rt, void* opaque)
+{
+    tjs_profiler_t* profiler = opaque;
+    int has_idle = profiler->loop_count != profiler->last_loop_count;
+    profiler->last_loop_count = profiler->loop_count;
+
+    if (atomic_load_explicit(&profiler->pending, memory_order_relaxed) == 0) {
+        return 0;
+    }
+
+    /* 进入过事件循环并且请求已过期, 说明请求时可能是空闲的 */
+    uint64_t requested = atomic_exchange(&profiler->pending, 0);
+    uint64_t now = uv_hrtime();
+    if (has_idle && now - requested > profiler->interval * 2) {
+        return 0;
+    }
+
+    tjs_profiler_sample(profiler, now);
+    return 0;
+}
+
+int tjs_profiler_start(TJSRuntime* qrt, uint32_t interval, uint32_t max_samples)
+{
+    if (qrt->profiler) {
+        return UV_EALREADY;
+    }
+
+    JSContext* ctx = qrt->ctx;
+    tjs_profiler_t* profiler = js_mallocz(ctx, sizeof(*profiler));
+    if (profiler == NULL) {
+        return UV_ENOMEM;
+    }
+
+    if (interval == 0) {
+        interval = TJS_PROFILER_INTERVAL;
+
+    } else if (interval < TJS_PROFILER_INTERVAL_MIN) {
+        interval = TJS_PROFILER_INTERVAL_MIN;
+    }
+
+    profiler->ctx = ctx;
+    profiler->interval = (uint64_t)interval * 1000;
+    profiler->sample_capacity = max_samples ? max_samples : TJS_PROFILER_MAX_SAMPLES;
+    profiler->samples = js_malloc(ctx, profiler->sample_capacity * sizeof(*profiler->samples));
+    profiler->node_capacity = 256;
+    profiler->nodes = js_malloc(ctx, profiler->node_capacity * sizeof(*profiler->nodes));
+    if (profiler->samples == NULL || profiler->nodes == NULL) {
+        js_free(ctx, profiler->samples);
+        js_free(ctx, profiler->nodes);
+        js_free(ctx, profiler);
+        return UV_ENOMEM;
+    }
+
+    /* 根节点 */
+    memset(&profiler->nodes[0], 0, sizeof(profiler->nodes[0]));
+    profiler->nodes[0].line_num = -1;
+    profiler->node_count = 1;
+
+    atomic_init(&profiler->pending, 0);
+    profiler->start_time = uv_hrtime();
+
+    CHECK_EQ(uv_mutex_init(&profiler->mutex), 0);
+    CHECK_EQ(uv_cond_init(&profiler->cond), 0);
+    int ret = uv_thread_create(&profiler->thread, tjs_profiler_thread, profiler);
+    if (ret < 0) {
+        uv_cond_destroy(&profiler->cond);
+        uv_mutex_destroy(&profiler->mutex);
+        js_free(ctx, profiler->samples);
+        js_free(ctx, profiler->nodes);
+        js_free(ctx, profiler);
+        return ret;
+    }
+
+    qrt->profiler = profiler;
+    JS_SetInterruptHandler(qrt->rt, tjs_profiler_interrupt_handler, profiler);
+    return 0;
+}
+
+static void tjs_profiler_free(TJSRuntime* qrt)
+{
+    tjs_profiler_t* profiler = qrt->profiler;
+    JSContext* ctx = qrt->ctx;
+
+    JS_SetInterruptHandler(qrt->rt, NULL, NULL);
+    qrt->profiler = NULL;
+
+    uv_mutex_lock(&profiler->mutex);
+    profiler->stopping = 1;
+    uv_cond_signal(&profiler->cond);
+    uv_mutex_unlock(&profiler->mutex);
+    uv_thread_join(&profiler->thread);
+
+    uv_cond_destroy(&profiler->cond);
+    uv_mutex_destroy(&profiler->mutex);
+
+    for (uint32_t i = 0; i < profiler->node_count; i++) {
+        JS_FreeAtom(ctx, profiler->nodes[i].func_name);
+        JS_FreeAtom(ctx, profiler->nodes[i].filename);
+    }
+
+    js_free(ctx, profiler->nodes);
+    js_free(ctx, profiler->samples);
+    js_free(ctx, profiler);
+}
+
+/** 生成 Chrome DevTools 的 .cpuprofile 格式的对象 */
+static JSValue tjs_profiler_to_object(tjs_profiler_t* profiler, uint64_t end_time)
+{
+    JSContext* ctx = profiler->ctx;
+    uint32_t* hit_counts = js_mallocz(ctx, profiler->node_count * sizeof(uint32_t));
+    if (hit_counts == NULL) {
+        return JS_EXCEPTION;
+    }
+
+    JSValue result = JS_NewObject(ctx);
+    JSValue samples = JS_NewArray(ctx);
+    JSValue time_deltas = JS_NewArray(ctx);
+
+    uint64_t last_time = profiler->start_time;
+    for (uint32_t i = 0; i < profiler->sample_count; i++) {
+        tjs_profiler_sample_t* sample = &profiler->samples[(profiler->sample_head + i) % profiler->sample_capacity];
+        hit_counts[sample->node]++;
+
+        JS_SetPropertyUint32(ctx, samples, i, JS_NewUint32(ctx, sample->node + 1));
+        JS_SetPropertyUint32(ctx, time_deltas, i, JS_NewInt64(ctx, (int64_t)(sample->timestamp - last_time) / 1000));
+        last_time = sample->timestamp;
+    }
+
+    JSValue nodes = JS_NewArray(ctx);
+    for (uint32_t i = 0; i < profiler->node_count; i++) {
+        tjs_profiler_node_t* node = &profiler->nodes[i];
+
+        JSValue call_frame = JS_NewObject(ctx);
+        JSValue func_name;
+        if (i == 0) {
+            func_name = JS_NewString(ctx, "(root)");
+
+        } else if (node->func_name == JS_ATOM_NULL) {
+            func_name = JS_NewString(ctx, "");
+
+        } else {
+            func_name = JS_AtomToString(ctx, node->func_name);
+        }
+
+        JSValue url = node->filename == JS_ATOM_NULL ? JS_NewString(ctx, "") : JS_AtomToString(ctx, node->filename);
+        JS_SetPropertyStr(ctx, call_frame, "functionName", func_name);
+        JS_SetPropertyStr(ctx, call_frame, "scriptId", JS_NewString(ctx, "0"));
+        JS_SetPropertyStr(ctx, call_frame, "url", url);
+        JS_SetPropertyStr(ctx, call_frame, "lineNumber", JS_NewInt32(ctx, node->line_num > 0 ? node->line_num - 1 : -1));
+        JS_SetPropertyStr(ctx, call_frame, "columnNumber", JS_NewInt32(ctx, -1));
+
+        JSValue children = JS_NewArray(ctx);
+        uint32_t count = 0;
+        for (uint32_t child = node->first_child; child; child = profiler->nodes[child].next_sibling) {
+            JS_SetPropertyUint32(ctx, children, count++, JS_NewUint32(ctx, child + 1));
+        }
+
+        JSValue item = JS_NewObject(ctx);
+        JS_SetPropertyStr(ctx, item, "id", JS_NewUint32(ctx, i + 1));
+        JS_SetPropertyStr(ctx, item, "callFrame", call_frame);
+        JS_SetPropertyStr(ctx, item, "hitCount", JS_NewUint32(ctx, hit_counts[i]));
+        JS_SetPropertyStr(ctx, item, "children", children);
+        JS_SetPropertyUint32(ctx, nodes, i, item);
+    }
+
+    js_free(ctx, hit_counts);
+
+    JS_SetPropertyStr(ctx, result, "nodes", nodes);
+    JS_SetPropertyStr(ctx, result, "startTime", JS_NewInt64(ctx, profiler->start_time / 1000));
+    JS_SetPropertyStr(ctx, result, "endTime", JS_NewInt64(ctx, end_time / 1000));
+    JS_SetPropertyStr(ctx, result, "samples", samples);
+    JS_SetPropertyStr(ctx, result, "timeDeltas", time_deltas);
+    return result;
+}
+
+JSValue tjs_profiler_stop(TJSRuntime* qrt)
+{
+    tjs_profiler_t* profiler = qrt->profiler;
+    if (profiler == NULL) {
+        return JS_UNDEFINED;
+    }
+
+    JS_SetInterruptHandler(qrt->rt, NULL, NULL);
+    JSValue result = tjs_profiler_to_object(profiler, uv_hrtime());
+    tjs_profiler_free(qrt);
+    return result;
+}
+
+void tjs_profiler_on_prepare(TJSRuntime* qrt)
+{
+    qrt->profiler->loop_count++;
+}
+
+void tjs_profiler_close(TJSRuntime* qrt)
+{
+    if (qrt->profiler) {
+        tjs_profiler_free(qrt);
+    }
+}
+
+int tjs_profiler_write_file(TJSRuntime* qrt)
+{
+    if (!qrt->options.cpu_profile || qrt->profiler == NULL) {
+        return 0;
+    }
+
+    JSContext* ctx = qrt->ctx;
+    JSValue profile = tjs_profiler_stop(qrt);
+    if (JS_IsException(profile)) {
+        return -1;
+    }
+
+    JSValue json = JS_JSONStringify(ctx, profile, JS_UNDEFINED, JS_UNDEFINED);
+    JS_FreeValue(ctx, profile);
+
+    size_t size = 0;
+    const char* data = JS_ToCStringLen(ctx, &size, json);
+    JS_FreeValue(ctx, json);
+    if (data == NULL) {
+        return -1;
+    }
+
+    // CPU.20220101.120000.1234.cpuprofile
+    char filename[PATH_MAX];
+    time_t now = time(NULL);
+    struct tm* tm = localtime(&now);
+    size_t length = strftime(filename, sizeof(filename), "CPU.%Y%m%d.%H%M%S", tm);
+    snprintf(filename + length, sizeof(filename) - length, ".%d.cpuprofile", (int)uv_os_getpid());
+
+    int ret = 0;
+    FILE* file = fopen(filename, "wb");
+    if (file == NULL || fwrite(data, 1, size, file) != size) {
+        fprintf(stderr, "tjs: could not write CPU profile: %s\n", filename);
+        ret = -1;
+    }
+
+    if (file) {
+        fclose(file);
+    }
+
+    JS_FreeCString(ctx, data);
+    return ret;
+}
+
+static JSValue tjs_profiler_start_profiling(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSRuntime* qrt = TJS_GetRuntime(ctx);
+    CHECK_NOT_NULL(qrt);
+
+    int64_t interval = TJS_ToInt64(ctx, argv[0], 0);
+    int64_t max_samples = TJS_ToInt64(ctx, argv[1], 0);
+    if (interval < 0 || interval > UINT32_MAX || max_samples < 0 || max_samples > UINT32_MAX) {
+        return JS_ThrowRangeError(ctx, "invalid profiler options");
+    }
+
+    int ret = tjs_profiler_start(qrt, (uint32_t)interval, (uint32_t)max_samples);
+    if (ret < 0) {
+        return tjs_throw_uv_error(ctx, ret);
+    }
+
+    return JS_UNDEFINED;
+}
+
+static JSValue tjs_profiler_stop_profiling(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSRuntime* qrt = TJS_GetRuntime(ctx);
+    CHECK_NOT_NULL(qrt);
+
+    return tjs_profiler_stop(qrt);
+}
+
+static JSValue tjs_profiler_is_profiling(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSRuntime* qrt = TJS_GetRuntime(ctx);
+    CHECK_NOT_NULL(qrt);
+
+    return JS_NewBool(ctx, qrt->profiler != NULL);
+}
+
+static const JSCFunctionListEntry tjs_profiler_funcs[] = {
+    TJS_CFUNC_DEF("isProfiling", 0, tjs_profiler_is_profiling),
+    TJS_CFUNC_DEF("start", 2, tjs_profiler_start_profiling),
+    TJS_CFUNC_DEF("stop", 0, tjs_profiler_stop_profiling),
+};
+
+void tjs_mod_profiler_init(JSContext* ctx, JSModuleDef* m)
+{
+    JSValue profiler = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, profiler, tjs_profiler_funcs, countof(tjs_profiler_funcs));
+    JS_DefinePropertyValueStr(ctx, profiler, "INTERVAL", JS_NewInt32(ctx, TJS_PROFILER_INTERVAL), JS_PROP_C_W_E);
+    JS_SetModuleExport(ctx, m, "profiler", profiler);
+}
+
+void tjs_mod_profiler_export(JSContext* ctx, JSModuleDef* m)
+{
+    JS_AddModuleExport(ctx, m, "profiler");
+}
@@ -52,7 +52,20 @@ JSValue tjs_stream_accept(JSContext* ctx, TJSStream* stream, int argc, JSValueCo
         break;
 
     case UV_NAMED_PIPE:
-        result = tjs_pipe_new(ctx);
+        // IPC 管道: 接收对方通过 `write2()` 传递过来的句柄
+        if (stream->h.pipe.ipc && uv_pipe_pending_count(&stream->h.pipe) > 0) {
+            uv_handle_type type = uv_pipe_pending_type(&stream->h.pipe);
+            if (type == UV_TCP) {
+                result = tjs_tcp_new(ctx, AF_UNSPEC);
+                connection = tjs_tcp_get(ctx, result);
+                break;
+
+            } else if (type != UV_NAMED_PIPE) {
+                return JS_UNDEFINED;
+            }
+        }
+
+        result = tjs_pipe_new(ctx, 0);
         connection = tjs_pipe_get(ctx, result);
         break;
 
@@ -89,6 +102,7 @@ static void tjs_stream_close_callback(uv_handle_t* handle)
 
     stream->closed = 1;
     if (stream->finalized) {
+        tjs_heap_remove(TJS_HEAP_STREAM, sizeof(*stream));
         free(stream); // 被动关闭，close 在 finalizer 后执行
     }
 }
@@ -198,6 +212,7 @@ void tjs_stream_finalizer(JSRuntime* runtime, TJSStream* stream)
     tjs_stream_clear(stream);
 
     if (stream->closed) {
+        tjs_heap_remove(TJS_HEAP_STREAM, sizeof(*stream));
         free(stream);
 
     } else {
@@ -307,6 +322,7 @@ JSValue tjs_stream_init(JSContext* ctx, JSValue obj, TJSStream* stream)
     stream->stream_id = tjs_stream_next_id++;
 
     tjs_stream_total_count++;
+    tjs_heap_add(TJS_HEAP_STREAM, sizeof(*stream));
 
     stream->h.handle.data = stream;
 
@@ -546,6 +562,7 @@ static void tjs_stream_write_callback(uv_write_t* req, int status)
     }
 
     TJS_SettlePromise(ctx, &request->result, is_reject, 1, (JSValueConst*)&arg);
+    tjs_heap_remove(TJS_HEAP_WRITE, request->size);
     js_free(ctx, request);
 }
 
@@ -593,6 +610,7 @@ JSValue tjs_stream_write(JSContext* ctx, TJSStream* stream, int argc, JSValueCon
     }
 
     request->req.data = request;
+    request->size = sizeof(*request) + buffer.length;
     memcpy(request->data, buffer.data, buffer.length);
 
     if (buffer.is_string) {
@@ -606,6 +624,69 @@ JSValue tjs_stream_write(JSContext* ctx, TJSStream* stream, int argc, JSValueCon
         return tjs_throw_uv_error(ctx, ret);
     }
 
+    tjs_heap_add(TJS_HEAP_WRITE, request->size);
+
+    return TJS_InitPromise(ctx, &request->result);
+}
+
+/**
+ * 通过 IPC 管道发送数据以及一个 TCP 句柄
+ * `write2(data, handle)`
+ */
+JSValue tjs_stream_write2(JSContext* ctx, TJSStream* stream, int argc, JSValueConst* argv)
+{
+    CHECK_NOT_NULL(ctx);
+    CHECK_NOT_NULL(stream);
+
+    if (argc < 2) {
+        return JS_ThrowTypeError(ctx, "handle expected");
+    }
+
+    if (stream->h.stream.type != UV_NAMED_PIPE || !stream->h.pipe.ipc) {
+        return JS_ThrowTypeError(ctx, "not an IPC pipe");
+    }
+
+    TJSStream* send_stream = tjs_tcp_get(ctx, argv[1]);
+    if (!send_stream) {
+        return JS_EXCEPTION;
+    }
+
+    tjs_buffer_t buffer = TJS_ToArrayBuffer(ctx, argv[0]);
+    if (JS_IsException(buffer.error)) {
+        return buffer.error;
+    }
+
+    // 传递句柄时至少要发送一个字节
+    size_t length = buffer.length > 0 ? buffer.length : 1;
+    TJSWriteReq* request = js_malloc(ctx, sizeof(*request) + length);
+    if (!request) {
+        if (buffer.is_string) {
+            JS_FreeCString(ctx, (char*)buffer.data);
+        }
+
+        return JS_EXCEPTION;
+    }
+
+    request->req.data = request;
+    request->size = sizeof(*request) + length;
+    request->data[0] = '\n';
+    if (buffer.length > 0) {
+        memcpy(request->data, buffer.data, buffer.length);
+    }
+
+    if (buffer.is_string) {
+        JS_FreeCString(ctx, (char*)buffer.data);
+    }
+
+    uv_buf_t uv_buffer = uv_buf_init(request->data, length);
+    int ret = uv_write2(&request->req, &stream->h.stream, &uv_buffer, 1, &send_stream->h.stream, tjs_stream_write_callback);
+    if (ret != 0) {
+        js_free(ctx, request);
+        return tjs_throw_uv_error(ctx, ret);
+    }
+
+    tjs_heap_add(TJS_HEAP_WRITE, request->size);
+
     return TJS_InitPromise(ctx, &request->result);
 }
 
@@ -84,9 +84,16 @@ JSValue tjs_stream_pause(JSContext* ctx, TJSStream* stream, int argc, JSValueCon
 JSValue tjs_stream_resume(JSContext* ctx, TJSStream* stream, int argc, JSValueConst* argv);
 JSValue tjs_stream_shutdown(JSContext* ctx, TJSStream* stream, int argc, JSValueConst* argv);
 JSValue tjs_stream_write(JSContext* ctx, TJSStream* stream, int argc, JSValueConst* argv);
+JSValue tjs_stream_write2(JSContext* ctx, TJSStream* stream, int argc, JSValueConst* argv);
+
+/** `TCP.bind()` 标记: 设置 SO_REUSEPORT, 允许多个进程或线程侦听同一个端口 */
+#define TJS_TCP_REUSEPORT (1 << 8)
+
+int tjs_tcp_bind_ex(uv_tcp_t* tcp, const struct sockaddr* addr, int flags);
 
 JSValue tjs_tcp_new(JSContext* ctx, int af);
 TJSStream* tjs_tcp_get(JSContext* ctx, JSValueConst obj);
+TJSStream* tjs_tcp_try_get(JSValueConst obj);
 TJSStream* tjs_pipe_get(JSContext* ctx, JSValueConst obj);
 
 void tjs_mod_pipe_init(JSContext* ctx, JSModuleDef* module);
@@ -34,7 +34,7 @@ static JSClassDef tjs_pipe_class = {
     .gc_mark = tjs_pipe_mark,
 };
 
-JSValue tjs_pipe_new(JSContext* ctx)
+JSValue tjs_pipe_new(JSContext* ctx, int ipc)
 {
     TJSStream* stream;
     JSValue obj;
@@ -51,7 +51,7 @@ JSValue tjs_pipe_new(JSContext* ctx)
         return JS_EXCEPTION;
     }
 
-    r = uv_pipe_init(TJS_GetLoop(ctx), &stream->h.pipe, 0);
+    r = uv_pipe_init(TJS_GetLoop(ctx), &stream->h.pipe, ipc);
     if (r != 0) {
         JS_FreeValue(ctx, obj);
         free(stream);
@@ -62,9 +62,18 @@ JSValue tjs_pipe_new(JSContext* ctx)
     return tjs_stream_init(ctx, obj, stream);
 }
 
+/**
+ * `new Pipe(ipc)`
+ * @param ipc 是否是 IPC 管道, IPC 管道可以用来在进程间传递句柄
+ */
 static JSValue tjs_pipe_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst* argv)
 {
-    return tjs_pipe_new(ctx);
+    int ipc = 0;
+    if (argc > 0) {
+        ipc = JS_ToBool(ctx, argv[0]);
+    }
+
+    return tjs_pipe_new(ctx, ipc);
 }
 
 static JSValue tjs_pipe_accept(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
@@ -189,6 +198,17 @@ static JSValue tjs_pipe_get_queue_size(JSContext* ctx, JSValueConst this_val, in
     return JS_NewInt32(ctx, size);
 }
 
+/**
+ * 返回 IPC 管道中等待接收 (`accept()`) 的句柄的数量
+ */
+static JSValue tjs_pipe_get_pending_count(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSStream* stream = tjs_pipe_get(ctx, this_val);
+    CHECK_NOT_NULL(stream);
+
+    return JS_NewInt32(ctx, uv_pipe_pending_count(&stream->h.pipe));
+}
+
 static JSValue tjs_pipe_get_id(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
     TJSStream* stream = tjs_pipe_get(ctx, this_val);
@@ -312,6 +332,14 @@ static JSValue tjs_pipe_write(JSContext* ctx, JSValueConst this_val, int argc, J
     return tjs_stream_write(ctx, stream, argc, argv);
 }
 
+static JSValue tjs_pipe_write2(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    TJSStream* stream = tjs_pipe_get(ctx, this_val);
+    CHECK_NOT_NULL(stream);
+
+    return tjs_stream_write2(ctx, stream, argc, argv);
+}
+
 static const JSCFunctionListEntry tjs_pipe_proto_funcs[] = {
     /* Stream functions */
     TJS_CFUNC_DEF("accept", 0, tjs_pipe_accept),
@@ -335,7 +363,9 @@ static const JSCFunctionListEntry tjs_pipe_proto_funcs[] = {
     TJS_CFUNC_DEF("bufferedAmount", 0, tjs_pipe_get_queue_size),
     TJS_CFUNC_DEF("connect", 1, tjs_pipe_connect),
     TJS_CFUNC_DEF("id", 0, tjs_pipe_get_id),
+    TJS_CFUNC_DEF("pendingCount", 0, tjs_pipe_get_pending_count),
     TJS_CFUNC_DEF("setDebug", 1, tjs_pipe_set_debug),
+    TJS_CFUNC_DEF("write2", 2, tjs_pipe_write2),
 
     TJS_CGETSET_MAGIC_DEF("onclose", tjs_pipe_event_get, tjs_pipe_event_set, STREAM_EVENT_CLOSE),
     TJS_CGETSET_MAGIC_DEF("onconnect", tjs_pipe_event_get, tjs_pipe_event_set, STREAM_EVENT_CONNECT),
@@ -3,6 +3,16 @@
 #include "tjs-utils.h"
 #include "streams.h"
 
+#include <errno.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#ifndef SOCK_CLOEXEC
+#define SOCK_CLOEXEC 0
+#endif
+
 static JSClassID tjs_tcp_class_id;
 
 static void tjs_tcp_finalizer(JSRuntime* runtime, JSValue val)
@@ -87,6 +97,67 @@ static JSValue tjs_tcp_accept(JSContext* ctx, JSValueConst this_val, int argc, J
     return tjs_stream_accept(ctx, stream, argc, argv);
 }
 
+/**
+ * 设置 SO_REUSEPORT 选项
+ * - 多个进程或线程可以绑定同一个地址和端口, 由内核在它们之间分配新的连接
+ * @return 成功返回 0, 否则返回 libuv 错误码
+ */
+int tjs_socket_set_reuse_port(uv_os_sock_t sock)
+{
+#if defined(SO_REUSEPORT) && !defined(_WIN32)
+    int yes = 1;
+    if (setsockopt(sock, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(yes))) {
+        return uv_translate_sys_error(errno);
+    }
+
+    return 0;
+#else
+    return UV_ENOTSUP;
+#endif
+}
+
+/**
+ * 绑定地址
+ * - libuv 在 bind 时才创建 socket, 而 SO_REUSEPORT 必须在 bind 之前设置,
+ *   所以需要 `TJS_TCP_REUSEPORT` 时先自己创建 socket
+ */
+int tjs_tcp_bind_ex(uv_tcp_t* tcp, const struct sockaddr* addr, int flags)
+{
+    if (flags & TJS_TCP_REUSEPORT) {
+        flags &= ~TJS_TCP_REUSEPORT;
+
+        uv_os_fd_t fd;
+        if (uv_fileno((uv_handle_t*)tcp, &fd) == 0) {
+            int ret = tjs_socket_set_reuse_port((uv_os_sock_t)fd);
+            if (ret != 0) {
+                return ret;
+            }
+
+        } else {
+#if defined(SO_REUSEPORT) && !defined(_WIN32)
+            int sock = socket(addr->sa_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            if (sock < 0) {
+                return uv_translate_sys_error(errno);
+            }
+
+            int ret = tjs_socket_set_reuse_port(sock);
+            if (ret == 0) {
+                ret = uv_tcp_open(tcp, sock);
+            }
+
+            if (ret != 0) {
+                close(sock);
+                return ret;
+            }
+#else
+            return UV_ENOTSUP;
+#endif
+        }
+    }
+
+    return uv_tcp_bind(tcp, addr, flags);
+}
+
 static JSValue tjs_tcp_bind(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
     TJSStream* stream = tjs_tcp_get(ctx, this_val);
@@ -106,7 +177,7 @@ static JSValue tjs_tcp_bind(JSContext* ctx, JSValueConst this_val, int argc, JSV
         }
     }
 
-    ret = uv_tcp_bind(&stream->h.tcp, (struct sockaddr*)&ss, flags);
+    ret = tjs_tcp_bind_ex(&stream->h.tcp, (struct sockaddr*)&ss, flags);
     if (ret != 0) {
         return tjs_throw_uv_error(ctx, ret);
     }
@@ -179,6 +250,12 @@ TJSStream* tjs_tcp_get(JSContext* ctx, JSValueConst obj)
     return JS_GetOpaque2(ctx, obj, tjs_tcp_class_id);
 }
 
+/** 如果不是 TCP 对象则返回 NULL, 不会抛出异常 */
+TJSStream* tjs_tcp_try_get(JSValueConst obj)
+{
+    return JS_GetOpaque(obj, tjs_tcp_class_id);
+}
+
 static JSValue tjs_tcp_get_queue_size(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
     TJSStream* stream = tjs_tcp_get(ctx, this_val);
@@ -373,6 +450,7 @@ static const JSCFunctionListEntry tjs_tcp_proto_funcs[] = {
 
 static const JSCFunctionListEntry tjs_tcp_class_funcs[] = {
     JS_PROP_INT32_DEF("IPV6ONLY", UV_TCP_IPV6ONLY, 0),
+    JS_PROP_INT32_DEF("REUSEPORT", TJS_TCP_REUSEPORT, 0),
 };
 
 void tjs_mod_tcp_init(JSContext* ctx, JSModuleDef* module)
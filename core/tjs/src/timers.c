@@ -77,6 +77,7 @@ static void tjs_timer_close_callback(uv_handle_t* handle)
 {
     TJSTimer* timer = handle->data;
     CHECK_NOT_NULL(timer);
+    tjs_heap_remove(TJS_HEAP_TIMER, sizeof(*timer));
     free(timer);
 }
 
@@ -160,6 +161,7 @@ static JSValue tjs_set_timeout(JSContext* ctx, JSValueConst this_val, int argc,
         return JS_EXCEPTION;
     }
 
+    tjs_heap_add(TJS_HEAP_TIMER, sizeof(*timer));
     timer->ctx = ctx;
     CHECK_EQ(uv_timer_init(TJS_GetLoop(ctx), &timer->handle), 0);
     timer->handle.data = timer;
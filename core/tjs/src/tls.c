@@ -51,6 +51,7 @@ static void tls_stream_close_callback(uv_handle_t* handle)
     }
 
     if (stream->finalized) {
+        tjs_heap_remove(TJS_HEAP_TLS, sizeof(*stream));
         free(stream);
     }
 }
@@ -231,6 +232,7 @@ void tls_stream_finalizer(JSRuntime* runtime, TJSStream* stream)
 
     stream->finalized = 1;
     if (stream->closed) {
+        tjs_heap_remove(TJS_HEAP_TLS, sizeof(*stream));
         free(stream);
 
     } else {
@@ -249,6 +251,7 @@ JSValue tls_stream_init(JSContext* ctx, JSValue obj, TJSStream* stream)
     stream->closed = 0;
     stream->finalized = 0;
     stream->read_start = 0;
+    tjs_heap_add(TJS_HEAP_TLS, sizeof(*stream));
 
     stream->h.handle.data = stream;
 
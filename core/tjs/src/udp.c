@@ -25,6 +25,19 @@
 #include "private.h"
 #include "tjs-utils.h"
 
+#include <errno.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#ifndef SOCK_CLOEXEC
+#define SOCK_CLOEXEC 0
+#endif
+
+/** `UDP.bind()` 标记: 设置 SO_REUSEPORT, 允许多个进程或线程绑定同一个端口 */
+#define TJS_UDP_REUSEPORT (1 << 12)
+
 #define TJS_CheckNumber(ctx, index, value)                                                                \
     if ((argc > (index)) && !JS_IsUndefined(argv[(index)]) && JS_ToInt32(ctx, &(value), argv[(index)])) { \
         return JS_ThrowTypeError(ctx, #value " must be a number");                                        \
@@ -94,7 +107,42 @@ static JSValue tjs_udp_bind(JSContext* ctx, JSValueConst this_val, int argc, JSV
     TJS_CheckSocketAddress(ctx, 0, ss);
     TJS_CheckNumber(ctx, 1, flags);
 
-    int ret = uv_udp_bind(&udp->udp, (struct sockaddr*)&ss, flags);
+    // SO_REUSEPORT 必须在 bind 之前设置, 所以需要时先创建 socket
+    int ret = 0;
+    if (flags & TJS_UDP_REUSEPORT) {
+        flags &= ~TJS_UDP_REUSEPORT;
+
+        uv_os_fd_t fd;
+        if (uv_fileno((uv_handle_t*)&udp->udp, &fd) == 0) {
+            ret = tjs_socket_set_reuse_port((uv_os_sock_t)fd);
+
+        } else {
+#if defined(SO_REUSEPORT) && !defined(_WIN32)
+            int sock = socket(ss.ss_family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+            if (sock < 0) {
+                ret = uv_translate_sys_error(errno);
+
+            } else {
+                ret = tjs_socket_set_reuse_port(sock);
+                if (ret == 0) {
+                    ret = uv_udp_open(&udp->udp, sock);
+                }
+
+                if (ret != 0) {
+                    close(sock);
+                }
+            }
+#else
+            ret = UV_ENOTSUP;
+#endif
+        }
+
+        if (ret != 0) {
+            return tjs_throw_uv_error(ctx, ret);
+        }
+    }
+
+    ret = uv_udp_bind(&udp->udp, (struct sockaddr*)&ss, flags);
     return TJS_GetResult(ctx, ret);
 }
 
@@ -105,6 +153,7 @@ static void tjs_udp_close_callback(uv_handle_t* handle)
 
     udp->closed = 1;
     if (udp->finalized) {
+        tjs_heap_remove(TJS_HEAP_UDP, sizeof(*udp));
         free(udp);
     }
 }
@@ -229,6 +278,7 @@ static void tjs_udp_finalizer(JSRuntime* rt, JSValue val)
 
     udp->finalized = 1;
     if (udp->closed) {
+        tjs_heap_remove(TJS_HEAP_UDP, sizeof(*udp));
         free(udp);
 
     } else {
@@ -306,6 +356,7 @@ static JSValue tjs_udp_new(JSContext* ctx, int af)
         return JS_ThrowInternalError(ctx, "couldn't initialize UDP handle");
     }
 
+    tjs_heap_add(TJS_HEAP_UDP, sizeof(*udp));
     udp->ctx = ctx;
     udp->closed = 0;
     udp->finalized = 0;
@@ -593,7 +644,8 @@ static const JSCFunctionListEntry tjs_udp_proto_funcs[] = {
 static const JSCFunctionListEntry tjs_udp_class_funcs[] = {
     JS_PROP_INT32_DEF("IPV6ONLY", UV_UDP_IPV6ONLY, 0),
     JS_PROP_INT32_DEF("PARTIAL", UV_UDP_PARTIAL, 0),
-    JS_PROP_INT32_DEF("REUSEADDR", UV_UDP_REUSEADDR, 0)
+    JS_PROP_INT32_DEF("REUSEADDR", UV_UDP_REUSEADDR, 0),
+    JS_PROP_INT32_DEF("REUSEPORT", TJS_UDP_REUSEPORT, 0)
 };
 
 void tjs_mod_udp_init(JSContext* ctx, JSModuleDef* m)
@@ -0,0 +1,840 @@
+/* UTF-8 编码和解码 */
+#include "private.h"
+#include "tjs-utils.h"
+
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TJS_UTF8_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define TJS_UTF8_NEON 1
+#include <arm_neon.h>
+#endif
+
+/** utf8.decode() 的选项: 遇到无效的字节序列时抛出异常, 否则替换为 U+FFFD */
+#define TJS_UTF8_FATAL 0x01
+
+#define TJS_UTF8_REPLACEMENT 0xFFFD
+
+/** 无效的字节序列, 解码为 U+FFFD */
+#define TJS_UTF8_INVALID 0xFFFFFFFF
+
+/**
+ * 返回开头的 ASCII 字符的个数
+ * - 每次检查 16 个字节 (SSE2/NEON), 然后是 8 个字节, 最后逐个字节检查
+ */
+static size_t tjs__utf8_ascii_length(const uint8_t* src, size_t length)
+{
+    size_t i = 0;
+
+#if defined(TJS_UTF8_SSE2)
+    for (; i + 16 <= length; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(src + i));
+        if (_mm_movemask_epi8(chunk) != 0) {
+            break;
+        }
+    }
+
+#elif defined(TJS_UTF8_NEON)
+    for (; i + 16 <= length; i += 16) {
+        if (vmaxvq_u8(vld1q_u8(src + i)) >= 0x80) {
+            break;
+        }
+    }
+#endif
+
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        memcpy(&word, src + i, sizeof(word));
+        if (word & 0x8080808080808080ULL) {
+            break;
+        }
+    }
+
+    while (i < length && src[i] < 0x80) {
+        i++;
+    }
+
+    return i;
+}
+
+/** 返回开头的小于 0x80 的 UTF-16 单元的个数 */
+static size_t tjs__utf16_ascii_length(const uint16_t* src, size_t length)
+{
+    size_t i = 0;
+
+#if defined(TJS_UTF8_SSE2)
+    const __m128i mask = _mm_set1_epi16((short)0xFF80);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= length; i += 8) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(src + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chunk, mask), zero)) != 0xFFFF) {
+            break;
+        }
+    }
+
+#elif defined(TJS_UTF8_NEON)
+    for (; i + 8 <= length; i += 8) {
+        if (vmaxvq_u16(vld1q_u16(src + i)) >= 0x80) {
+            break;
+        }
+    }
+#endif
+
+    while (i < length && src[i] < 0x80) {
+        i++;
+    }
+
+    return i;
+}
+
+/** 把 count 个 ASCII 字符从 UTF-16 压缩为 8 位 */
+static void tjs__utf16_narrow(uint8_t* dst, const uint16_t* src, size_t count)
+{
+    size_t i = 0;
+
+#if defined(TJS_UTF8_SSE2)
+    for (; i + 8 <= count; i += 8) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storel_epi64((__m128i*)(dst + i), _mm_packus_epi16(chunk, chunk));
+    }
+
+#elif defined(TJS_UTF8_NEON)
+    for (; i + 8 <= count; i += 8) {
+        vst1_u8(dst + i, vmovn_u16(vld1q_u16(src + i)));
+    }
+#endif
+
+    for (; i < count; i++) {
+        dst[i] = (uint8_t)src[i];
+    }
+}
+
+/** 把 count 个 8 位字符扩展为 UTF-16 */
+static void tjs__utf16_widen(uint16_t* dst, const uint8_t* src, size_t count)
+{
+    size_t i = 0;
+
+#if defined(TJS_UTF8_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_unpacklo_epi8(chunk, zero));
+        _mm_storeu_si128((__m128i*)(dst + i + 8), _mm_unpackhi_epi8(chunk, zero));
+    }
+
+#elif defined(TJS_UTF8_NEON)
+    for (; i + 16 <= count; i += 16) {
+        uint8x16_t chunk = vld1q_u8(src + i);
+        vst1q_u16(dst + i, vmovl_u8(vget_low_u8(chunk)));
+        vst1q_u16(dst + i + 8, vmovl_u8(vget_high_u8(chunk)));
+    }
+#endif
+
+    for (; i < count; i++) {
+        dst[i] = src[i];
+    }
+}
+
+/** 块的大小, 每次检查 16 个字节或 UTF-16 单元是否都是 ASCII 字符 */
+#define TJS_UTF8_BLOCK 16
+
+/** 开头的 16 个字节是否都是 ASCII 字符 */
+static inline bool tjs__utf8_ascii_block(const uint8_t* src)
+{
+#if defined(TJS_UTF8_SSE2)
+    return _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)src)) == 0;
+
+#elif defined(TJS_UTF8_NEON)
+    return vmaxvq_u8(vld1q_u8(src)) < 0x80;
+
+#else
+    uint64_t words[2];
+    memcpy(words, src, sizeof(words));
+    return ((words[0] | words[1]) & 0x8080808080808080ULL) == 0;
+#endif
+}
+
+/** 开头的 16 个 UTF-16 单元是否都是 ASCII 字符 */
+static inline bool tjs__utf16_ascii_block(const uint16_t* src)
+{
+#if defined(TJS_UTF8_SSE2)
+    __m128i chunk = _mm_or_si128(_mm_loadu_si128((const __m128i*)src), _mm_loadu_si128((const __m128i*)(src + 8)));
+    return _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chunk, _mm_set1_epi16((short)0xFF80)), _mm_setzero_si128())) == 0xFFFF;
+
+#elif defined(TJS_UTF8_NEON)
+    return vmaxvq_u16(vorrq_u16(vld1q_u16(src), vld1q_u16(src + 8))) < 0x80;
+
+#else
+    uint16_t bits = 0;
+    for (size_t i = 0; i < TJS_UTF8_BLOCK; i++) {
+        bits |= src[i];
+    }
+
+    return (bits & 0xFF80) == 0;
+#endif
+}
+
+/**
+ * 解码一个非 ASCII 的 UTF-8 字节序列
+ * - 按照 WHATWG Encoding 标准, 无效序列的最长有效前缀作为一个错误, 解码为一个 U+FFFD
+ * @param pcode 码点, 无效时为 TJS_UTF8_INVALID
+ * @return 消耗的字节数, 至少为 1
+ */
+static size_t tjs__utf8_decode_char(const uint8_t* src, size_t length, uint32_t* pcode)
+{
+    uint32_t c = src[0];
+    size_t need;
+    uint8_t lower = 0x80;
+    uint8_t upper = 0xBF;
+
+    if (c >= 0xC2 && c <= 0xDF) {
+        need = 1;
+        c &= 0x1F;
+
+    } else if (c >= 0xE0 && c <= 0xEF) {
+        need = 2;
+        lower = c == 0xE0 ? 0xA0 : 0x80;
+        upper = c == 0xED ? 0x9F : 0xBF;
+        c &= 0x0F;
+
+    } else if (c >= 0xF0 && c <= 0xF4) {
+        need = 3;
+        lower = c == 0xF0 ? 0x90 : 0x80;
+        upper = c == 0xF4 ? 0x8F : 0xBF;
+        c &= 0x07;
+
+    } else {
+        *pcode = TJS_UTF8_INVALID;
+        return 1;
+    }
+
+    size_t i = 1;
+    for (; i <= need; i++) {
+        if (i >= length || src[i] < lower || src[i] > upper) {
+            *pcode = TJS_UTF8_INVALID;
+            return i;
+        }
+
+        c = (c << 6) | (src[i] & 0x3F);
+        lower = 0x80;
+        upper = 0xBF;
+    }
+
+    *pcode = c;
+    return i;
+}
+
+/**
+ * 检查 UTF-8 数据
+ * @return 第一个无效序列的位置, 全部有效时返回 length
+ */
+static size_t tjs__utf8_validate(const uint8_t* src, size_t length)
+{
+    size_t i = 0;
+    while (i < length) {
+        if (src[i] < 0x80) {
+            i += tjs__utf8_ascii_length(src + i, length - i);
+            continue;
+        }
+
+        uint32_t c;
+        size_t size = tjs__utf8_decode_char(src + i, length - i, &c);
+        if (c == TJS_UTF8_INVALID) {
+            return i;
+        }
+
+        i += size;
+    }
+
+    return length;
+}
+
+/**
+ * 读取一个非 ASCII 的 UTF-8 字符, 常见的 2 字节和 3 字节序列直接解码
+ * @param pcode 码点, 无效时为 TJS_UTF8_INVALID
+ * @return 消耗的字节数
+ */
+static inline size_t tjs__utf8_read_char(const uint8_t* src, size_t length, uint32_t* pcode)
+{
+    uint32_t c = src[0];
+    if (c >= 0xC2 && c <= 0xDF) {
+        if (length > 1 && (src[1] & 0xC0) == 0x80) {
+            *pcode = ((c & 0x1F) << 6) | (src[1] & 0x3F);
+            return 2;
+        }
+
+    } else if ((c & 0xF0) == 0xE0) {
+        if (length > 2 && (src[1] & 0xC0) == 0x80 && (src[2] & 0xC0) == 0x80) {
+            uint32_t code = ((c & 0x0F) << 12) | ((src[1] & 0x3F) << 6) | (src[2] & 0x3F);
+            if (code >= 0x800 && (code < 0xD800 || code > 0xDFFF)) {
+                *pcode = code;
+                return 3;
+            }
+        }
+    }
+
+    return tjs__utf8_decode_char(src, length, pcode);
+}
+
+/**
+ * UTF-8 -> UTF-16
+ * - 每次检查 16 个字节, 都是 ASCII 字符时直接扩展, 否则逐个字符解码
+ * @param dst 至少要有 length 个单元
+ * @param pmax 最大的 UTF-16 单元, 用于判断是否可以使用 8 位字符串
+ * @param perror 第一个无效序列的位置, 没有时为 length
+ * @return 写入的单元数
+ */
+static size_t tjs__utf8_to_utf16(uint16_t* dst, const uint8_t* src, size_t length, uint32_t* pmax, size_t* perror)
+{
+    uint16_t* start = dst;
+    uint32_t max = 0;
+    size_t error = length;
+    size_t i = 0;
+
+    while (i < length) {
+        if (i + TJS_UTF8_BLOCK <= length && tjs__utf8_ascii_block(src + i)) {
+            tjs__utf16_widen(dst, src + i, TJS_UTF8_BLOCK);
+            dst += TJS_UTF8_BLOCK;
+            i += TJS_UTF8_BLOCK;
+            continue;
+        }
+
+        size_t end = i + TJS_UTF8_BLOCK < length ? i + TJS_UTF8_BLOCK : length;
+        while (i < end) {
+            uint32_t c = src[i];
+            if (c < 0x80) {
+                *dst++ = (uint16_t)c;
+                i++;
+                continue;
+            }
+
+            size_t size = tjs__utf8_read_char(src + i, length - i, &c);
+            if (c == TJS_UTF8_INVALID) {
+                c = TJS_UTF8_REPLACEMENT;
+                if (error == length) {
+                    error = i;
+                }
+
+            } else if (c > 0xFFFF) {
+                c -= 0x10000;
+                *dst++ = (uint16_t)(0xD800 + (c >> 10));
+                c = 0xDC00 + (c & 0x3FF);
+            }
+
+            if (c > max) {
+                max = c;
+            }
+
+            *dst++ = (uint16_t)c;
+            i += size;
+        }
+    }
+
+    *pmax = max;
+    *perror = error;
+    return dst - start;
+}
+
+/** 较短的数据使用栈上的缓存区解码 */
+#define TJS_UTF8_STACK_UNITS 512
+
+/**
+ * UTF-8 -> JS 字符串
+ * - 纯 ASCII 时直接复制到 8 位字符串中
+ * - 否则先解码为 UTF-16, 如果所有字符都不大于 0xFF 则仍然使用 8 位字符串
+ */
+static JSValue tjs__utf8_new_string(JSContext* ctx, const uint8_t* src, size_t length, int flags)
+{
+    void* buffer = NULL;
+    JSValue value;
+
+    size_t ascii = tjs__utf8_ascii_length(src, length);
+    if (ascii == length) {
+        value = JS_NewStringBuffer(ctx, length, false, &buffer);
+        if (!JS_IsException(value) && length > 0) {
+            memcpy(buffer, src, length);
+        }
+
+        return value;
+    }
+
+    uint16_t stack_units[TJS_UTF8_STACK_UNITS];
+    size_t rest = length - ascii;
+    uint16_t* units = rest <= TJS_UTF8_STACK_UNITS ? stack_units : js_malloc(ctx, rest * sizeof(uint16_t));
+    if (!units) {
+        return JS_EXCEPTION;
+    }
+
+    uint32_t max = 0;
+    size_t error = rest;
+    size_t count = tjs__utf8_to_utf16(units, src + ascii, rest, &max, &error);
+    if (error < rest && (flags & TJS_UTF8_FATAL)) {
+        value = JS_ThrowTypeError(ctx, "The encoded data was not valid utf-8 (at offset %zu)", ascii + error);
+
+    } else if (max <= 0xFF) {
+        value = JS_NewStringBuffer(ctx, ascii + count, false, &buffer);
+        if (!JS_IsException(value)) {
+            memcpy(buffer, src, ascii);
+            tjs__utf16_narrow((uint8_t*)buffer + ascii, units, count);
+        }
+
+    } else {
+        value = JS_NewStringBuffer(ctx, ascii + count, true, &buffer);
+        if (!JS_IsException(value)) {
+            tjs__utf16_widen(buffer, src, ascii);
+            memcpy((uint16_t*)buffer + ascii, units, count * sizeof(uint16_t));
+        }
+    }
+
+    if (units != stack_units) {
+        js_free(ctx, units);
+    }
+
+    return value;
+}
+
+/**
+ * 编码为 UTF-8 后的最大长度
+ * - 代理项按 3 个字节计算, 所以只有包含代理对时才会比实际的长度大
+ */
+static size_t tjs__utf16_utf8_capacity(const uint16_t* src, size_t length)
+{
+    size_t i = tjs__utf16_ascii_length(src, length);
+    size_t extra = 0;
+
+#if defined(TJS_UTF8_SSE2)
+    const __m128i mask2 = _mm_set1_epi16((short)0xFF80);
+    const __m128i mask3 = _mm_set1_epi16((short)0xF800);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= length; i += 8) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(src + i));
+        int ascii = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chunk, mask2), zero));
+        int small = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chunk, mask3), zero));
+        extra += 8 - (__builtin_popcount(ascii) >> 1);
+        extra += 8 - (__builtin_popcount(small) >> 1);
+    }
+
+#elif defined(TJS_UTF8_NEON)
+    const uint16x8_t limit2 = vdupq_n_u16(0x80);
+    const uint16x8_t limit3 = vdupq_n_u16(0x800);
+    for (; i + 8 <= length; i += 8) {
+        uint16x8_t chunk = vld1q_u16(src + i);
+        uint16x8_t count = vaddq_u16(vshrq_n_u16(vcgeq_u16(chunk, limit2), 15), vshrq_n_u16(vcgeq_u16(chunk, limit3), 15));
+        extra += vaddvq_u16(count);
+    }
+#endif
+
+    for (; i < length; i++) {
+        extra += (src[i] >= 0x80) + (src[i] >= 0x800);
+    }
+
+    return length + extra;
+}
+
+/** 8 位字符串编码为 UTF-8 后的长度 */
+static size_t tjs__latin1_utf8_length(const uint8_t* src, size_t length)
+{
+    size_t i = tjs__utf8_ascii_length(src, length);
+    size_t extra = 0;
+
+#if defined(TJS_UTF8_SSE2)
+    for (; i + 16 <= length; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(src + i));
+        extra += __builtin_popcount(_mm_movemask_epi8(chunk));
+    }
+
+#elif defined(TJS_UTF8_NEON)
+    for (; i + 16 <= length; i += 16) {
+        extra += vaddvq_u8(vshrq_n_u8(vld1q_u8(src + i), 7));
+    }
+#endif
+
+    for (; i < length; i++) {
+        extra += src[i] >> 7;
+    }
+
+    return length + extra;
+}
+
+/**
+ * 8 位字符串 -> UTF-8
+ * - 缓存区足够时每次处理 16 个字符, 末尾的字符逐个检查缓存区的大小
+ * @param capacity 最多写入的字节数, 不会写入不完整的字符
+ * @param pread 读取的字符数
+ * @return 写入的字节数
+ */
+static size_t tjs__latin1_to_utf8(uint8_t* dst, size_t capacity, const uint8_t* src, size_t length, size_t* pread)
+{
+    size_t i = 0;
+    size_t written = 0;
+
+    while (i + TJS_UTF8_BLOCK <= length && written + TJS_UTF8_BLOCK * 2 <= capacity) {
+        if (tjs__utf8_ascii_block(src + i)) {
+            memcpy(dst + written, src + i, TJS_UTF8_BLOCK);
+            written += TJS_UTF8_BLOCK;
+            i += TJS_UTF8_BLOCK;
+            continue;
+        }
+
+        for (size_t end = i + TJS_UTF8_BLOCK; i < end; i++) {
+            uint8_t c = src[i];
+            if (c < 0x80) {
+                dst[written++] = c;
+
+            } else {
+                dst[written++] = 0xC0 | (c >> 6);
+                dst[written++] = 0x80 | (c & 0x3F);
+            }
+        }
+    }
+
+    for (; i < length; i++) {
+        uint8_t c = src[i];
+        if (c < 0x80) {
+            if (written + 1 > capacity) {
+                break;
+            }
+
+            dst[written++] = c;
+
+        } else {
+            if (written + 2 > capacity) {
+                break;
+            }
+
+            dst[written++] = 0xC0 | (c >> 6);
+            dst[written++] = 0x80 | (c & 0x3F);
+        }
+    }
+
+    *pread = i;
+    return written;
+}
+
+/**
+ * 读取一个非 ASCII 的 UTF-16 字符, 单独的代理项作为 U+FFFD
+ * @return 消耗的 UTF-16 单元数
+ */
+static inline size_t tjs__utf16_read_char(const uint16_t* src, size_t length, uint32_t* pcode)
+{
+    uint32_t c = src[0];
+    if (c < 0xD800 || c > 0xDFFF) {
+        *pcode = c;
+        return 1;
+
+    } else if (c <= 0xDBFF && length > 1 && src[1] >= 0xDC00 && src[1] <= 0xDFFF) {
+        *pcode = 0x10000 + ((c - 0xD800) << 10) + (src[1] - 0xDC00);
+        return 2;
+    }
+
+    *pcode = TJS_UTF8_REPLACEMENT;
+    return 1;
+}
+
+/**
+ * 写入一个非 ASCII 字符的 UTF-8 编码
+ * @return 写入的字节数
+ */
+static inline size_t tjs__utf8_write_char(uint8_t* dst, uint32_t c)
+{
+    if (c < 0x800) {
+        dst[0] = 0xC0 | (c >> 6);
+        dst[1] = 0x80 | (c & 0x3F);
+        return 2;
+
+    } else if (c < 0x10000) {
+        dst[0] = 0xE0 | (c >> 12);
+        dst[1] = 0x80 | ((c >> 6) & 0x3F);
+        dst[2] = 0x80 | (c & 0x3F);
+        return 3;
+    }
+
+    dst[0] = 0xF0 | (c >> 18);
+    dst[1] = 0x80 | ((c >> 12) & 0x3F);
+    dst[2] = 0x80 | ((c >> 6) & 0x3F);
+    dst[3] = 0x80 | (c & 0x3F);
+    return 4;
+}
+
+/**
+ * UTF-16 字符串 -> UTF-8, 单独的代理项编码为 U+FFFD
+ * - 缓存区足够时每次处理 16 个单元, 末尾的字符逐个检查缓存区的大小
+ * @param capacity 最多写入的字节数, 不会写入不完整的字符
+ * @param pread 读取的 UTF-16 单元数
+ * @return 写入的字节数
+ */
+static size_t tjs__utf16_to_utf8(uint8_t* dst, size_t capacity, const uint16_t* src, size_t length, size_t* pread)
+{
+    size_t i = 0;
+    size_t written = 0;
+
+    // 一个块最多写入 15 * 3 + 4 个字节 (最后一个单元是和下一个块组成的代理对)
+    while (i + TJS_UTF8_BLOCK <= length && written + TJS_UTF8_BLOCK * 4 <= capacity) {
+        if (tjs__utf16_ascii_block(src + i)) {
+            tjs__utf16_narrow(dst + written, src + i, TJS_UTF8_BLOCK);
+            written += TJS_UTF8_BLOCK;
+            i += TJS_UTF8_BLOCK;
+            continue;
+        }
+
+        size_t end = i + TJS_UTF8_BLOCK;
+        while (i < end) {
+            uint32_t c = src[i];
+            if (c < 0x80) {
+                dst[written++] = (uint8_t)c;
+                i++;
+                continue;
+            }
+
+            i += tjs__utf16_read_char(src + i, length - i, &c);
+            written += tjs__utf8_write_char(dst + written, c);
+        }
+    }
+
+    while (i < length) {
+        uint32_t c = src[i];
+        size_t count = 1;
+        size_t size = 1;
+        if (c >= 0x80) {
+            count = tjs__utf16_read_char(src + i, length - i, &c);
+            size = c < 0x800 ? 2 : (c < 0x10000 ? 3 : 4);
+        }
+
+        if (written + size > capacity) {
+            break;
+        }
+
+        if (size == 1) {
+            dst[written] = (uint8_t)c;
+
+        } else {
+            tjs__utf8_write_char(dst + written, c);
+        }
+
+        written += size;
+        i += count;
+    }
+
+    *pread = i;
+    return written;
+}
+
+/**
+ * UTF-8 -> 字符串
+ * @param data ArrayBuffer 或 TypedArray
+ * @param offset 开始位置, 可选
+ * @param length 长度, 可选
+ * @param flags `FATAL`: 遇到无效的字节序列时抛出 TypeError, 否则替换为 U+FFFD
+ */
+JSValue tjs_utf8_decode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    tjs_buffer_t buffer = TJS_GetArrayBuffer(ctx, argv[0]);
+    if (JS_IsException(buffer.error)) {
+        return JS_ThrowTypeError(ctx, "The provided value is not of type '(ArrayBuffer or ArrayBufferView)'");
+    }
+
+    /* 可选的 offset 和 length 参数, 避免为了解码一部分数据而创建新的视图 */
+    uint64_t offset = 0;
+    uint64_t length = buffer.length;
+    if (argc > 1 && !JS_IsUndefined(argv[1]) && JS_ToIndex(ctx, &offset, argv[1])) {
+        return JS_EXCEPTION;
+    }
+
+    if (offset > buffer.length) {
+        offset = buffer.length;
+    }
+
+    length = buffer.length - offset;
+    if (argc > 2 && !JS_IsUndefined(argv[2]) && JS_ToIndex(ctx, &length, argv[2])) {
+        return JS_EXCEPTION;
+    }
+
+    if (length > buffer.length - offset) {
+        length = buffer.length - offset;
+    }
+
+    int flags = argc > 3 ? TJS_ToInt32(ctx, argv[3], 0) : 0;
+    return tjs__utf8_new_string(ctx, buffer.data + offset, length, flags);
+}
+
+/**
+ * 字符串 -> UTF-8
+ * - 直接读取字符串的字符, 只编码一次, 不需要中间缓存区
+ * - 先计算最大长度并分配缓存区, 包含代理对时编码后再缩小
+ */
+JSValue tjs_utf8_encode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    JSValue string = JS_ToString(ctx, argc > 0 ? argv[0] : JS_UNDEFINED);
+    if (JS_IsException(string)) {
+        return string;
+    }
+
+    size_t length = 0;
+    JS_BOOL is_wide = FALSE;
+    const void* chars = JS_GetStringBuffer(string, &length, &is_wide);
+
+    size_t capacity = is_wide ? tjs__utf16_utf8_capacity(chars, length) : tjs__latin1_utf8_length(chars, length);
+    uint8_t* data = capacity > 0 ? js_malloc(ctx, capacity) : NULL;
+    if (capacity > 0 && !data) {
+        JS_FreeValue(ctx, string);
+        return JS_EXCEPTION;
+    }
+
+    size_t read = 0;
+    size_t size = 0;
+    if (is_wide) {
+        size = tjs__utf16_to_utf8(data, capacity, chars, length, &read);
+
+    } else if (capacity == length) {
+        memcpy(data, chars, length);
+        size = length;
+
+    } else {
+        size = tjs__latin1_to_utf8(data, capacity, chars, length, &read);
+    }
+
+    JS_FreeValue(ctx, string);
+
+    if (size < capacity) {
+        uint8_t* shrunk = js_realloc(ctx, data, size > 0 ? size : 1);
+        if (shrunk) {
+            data = shrunk;
+        }
+    }
+
+    return TJS_NewUint8Array(ctx, data, size);
+}
+
+/**
+ * 把字符串编码到调用者提供的缓存区中
+ * @param source 字符串
+ * @param destination Uint8Array
+ * @returns `{ read, written }` 读取的 UTF-16 单元数和写入的字节数
+ */
+static JSValue tjs_utf8_encode_into(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    tjs_buffer_t buffer = TJS_GetArrayBuffer(ctx, argv[1]);
+    if (JS_IsException(buffer.error) || (!buffer.data && buffer.length > 0)) {
+        return JS_ThrowTypeError(ctx, "The '%s' argument must be a Uint8Array", "destination");
+    }
+
+    JSValue string = JS_ToString(ctx, argv[0]);
+    if (JS_IsException(string)) {
+        return string;
+    }
+
+    size_t length = 0;
+    JS_BOOL is_wide = FALSE;
+    const void* chars = JS_GetStringBuffer(string, &length, &is_wide);
+
+    size_t read = 0;
+    size_t written = 0;
+    if (is_wide) {
+        written = tjs__utf16_to_utf8(buffer.data, buffer.length, chars, length, &read);
+
+    } else {
+        written = tjs__latin1_to_utf8(buffer.data, buffer.length, chars, length, &read);
+    }
+
+    JS_FreeValue(ctx, string);
+
+    JSValue result = JS_NewObject(ctx);
+    JS_DefinePropertyValueStr(ctx, result, "read", JS_NewInt64(ctx, read), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, result, "written", JS_NewInt64(ctx, written), JS_PROP_C_W_E);
+    return result;
+}
+
+/**
+ * 检查是否是有效的 UTF-8 数据
+ * @returns 第一个无效字节序列的位置, 全部有效时返回 -1
+ */
+static JSValue tjs_utf8_validate(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    tjs_buffer_t buffer = TJS_GetArrayBuffer(ctx, argv[0]);
+    if (JS_IsException(buffer.error)) {
+        return JS_ThrowTypeError(ctx, "The provided value is not of type '(ArrayBuffer or ArrayBufferView)'");
+    }
+
+    size_t error = tjs__utf8_validate(buffer.data, buffer.length);
+    return JS_NewInt64(ctx, error == buffer.length ? -1 : (int64_t)error);
+}
+
+/** 较短的 JSON 文本复制到栈上的缓存区中 */
+#define TJS_UTF8_JSON_STACK 4096
+
+/**
+ * 直接从 UTF-8 数据解析 JSON: (data, reviver?)
+ * - 不需要先解码为字符串再由 JSON.parse() 重新扫描, 忽略开头的 BOM
+ * - JSON 解析器要求数据以 '\0' 结尾, 所以仍然需要复制一次
+ * - 包含无效的 UTF-8 序列时先替换为 U+FFFD, 结果和 TextDecoder + JSON.parse() 相同
+ */
+static JSValue tjs_utf8_parse_json(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    tjs_buffer_t buffer = TJS_GetArrayBuffer(ctx, argv[0]);
+    if (JS_IsException(buffer.error)) {
+        return JS_ThrowTypeError(ctx, "The provided value is not of type '(ArrayBuffer or ArrayBufferView)'");
+    }
+
+    const uint8_t* src = buffer.data;
+    size_t length = buffer.length;
+    if (length >= 3 && src[0] == 0xEF && src[1] == 0xBB && src[2] == 0xBF) {
+        src += 3;
+        length -= 3;
+    }
+
+    JSValue result;
+    if (tjs__utf8_validate(src, length) < length) {
+        JSValue string = tjs__utf8_new_string(ctx, src, length, 0);
+        if (JS_IsException(string)) {
+            return string;
+        }
+
+        size_t text_length = 0;
+        const char* text = JS_ToCStringLen(ctx, &text_length, string);
+        JS_FreeValue(ctx, string);
+        if (!text) {
+            return JS_EXCEPTION;
+        }
+
+        result = JS_ParseJSON(ctx, text, text_length, "<input>");
+        JS_FreeCString(ctx, text);
+
+    } else {
+        char stack_text[TJS_UTF8_JSON_STACK];
+        char* text = length < sizeof(stack_text) ? stack_text : js_malloc(ctx, length + 1);
+        if (!text) {
+            return JS_EXCEPTION;
+        }
+
+        memcpy(text, src, length);
+        text[length] = '\0';
+        result = JS_ParseJSON(ctx, text, length, "<input>");
+
+        if (text != stack_text) {
+            js_free(ctx, text);
+        }
+    }
+
+    return argc > 1 ? JS_ReviveJSON(ctx, result, argv[1]) : result;
+}
+
+static const JSCFunctionListEntry tjs_utf8_funcs[] = {
+    JS_PROP_INT32_DEF("FATAL", TJS_UTF8_FATAL, JS_PROP_ENUMERABLE),
+    TJS_CFUNC_DEF("decode", 4, tjs_utf8_decode),
+    TJS_CFUNC_DEF("encode", 1, tjs_utf8_encode),
+    TJS_CFUNC_DEF("encodeInto", 2, tjs_utf8_encode_into),
+    TJS_CFUNC_DEF("parseJSON", 2, tjs_utf8_parse_json),
+    TJS_CFUNC_DEF("validate", 1, tjs_utf8_validate),
+};
+
+void tjs_mod_utf8_init(JSContext* ctx, JSModuleDef* m)
+{
+    TJS_ExportModuleObject(ctx, m, "utf8", tjs_utf8_funcs);
+}
+
+void tjs_mod_utf8_export(JSContext* ctx, JSModuleDef* m)
+{
+    JS_AddModuleExport(ctx, m, "utf8");
+}
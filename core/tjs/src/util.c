@@ -9,19 +9,9 @@
 
 enum tjs_util_type_enum {
     HASH_MD5 = 1,
-    HASH_SHA1 = 2,
-    CODE_HEX = 10,
-    CODE_BASE64 = 11
+    HASH_SHA1 = 2
 };
 
-extern int utils_hex_decode(uint8_t* buffer, size_t bufferSize, const void* data, size_t data_size);
-extern int utils_hex_encode(char* buffer, size_t bufferSize, const void* data, size_t data_size);
-
-extern int utils_base64_encode(unsigned char* dst, size_t dlen, size_t* olen,
-    const unsigned char* src, size_t slen);
-extern int utils_base64_decode(unsigned char* dst, size_t dlen, size_t* olen,
-    const unsigned char* src, size_t slen);
-
 static JSValue tjs_util_test(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
     return JS_UNDEFINED;
@@ -51,38 +41,6 @@ static JSValue tjs_util_hash(JSContext* ctx, JSValueConst this_val, int argc, JS
     }
 }
 
-static JSValue tjs_utf8_decode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
-{
-    tjs_buffer_t buffer = TJS_GetArrayBuffer(ctx, argv[0]);
-    if (JS_IsException(buffer.error)) {
-        return JS_ThrowTypeError(ctx, "The provided value is not of type '(ArrayBuffer or ArrayBufferView)'");
-    }
-
-    return JS_NewStringLen(ctx, buffer.data, buffer.length);
-}
-
-static JSValue tjs_utf8_encode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
-{
-    uint8_t* buffer = NULL;
-    size_t data_length = 0;
-
-    if (argc > 0) {
-        const char* data = JS_ToCStringLen(ctx, &data_length, argv[0]);
-        if (!data) {
-            return JS_EXCEPTION;
-        }
-
-        if (data_length > 0) {
-            buffer = js_malloc(ctx, data_length);
-            memcpy(buffer, data, data_length);
-        }
-
-        JS_FreeCString(ctx, data);
-    }
-
-    return TJS_NewUint8Array(ctx, buffer, data_length);
-}
-
 static JSValue tjs_read_module_file(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
     if (argc <= 0) {
@@ -113,120 +71,29 @@ static JSValue tjs_get_module_names(JSContext* ctx, JSValueConst this_val, int a
     return tjs_module_get_names(ctx);
 }
 
-static JSValue tjs_util_encode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
-{
-    tjs_buffer_t buffer = TJS_GetArrayBuffer(ctx, argv[0]);
-    if (JS_IsException(buffer.error)) {
-        return buffer.error;
-    }
-
-    int32_t type = CODE_HEX;
-    if (argc > 1) {
-        type = TJS_ToInt32(ctx, argv[1], -1);
-    }
-
-    JSValue ret = JS_UNDEFINED;
-
-#if 1
-    if (type == CODE_HEX) {
-        size_t bufferSize = buffer.length * 2 + 2;
-        char* result = js_malloc(ctx, bufferSize);
-
-        utils_hex_encode(result, bufferSize, buffer.data, buffer.length);
-        ret = JS_NewStringLen(ctx, result, buffer.length * 2);
-        js_free(ctx, result);
-
-    } else if (type == CODE_BASE64) {
-        size_t bufferSize = buffer.length * 2;
-        char* result = js_malloc(ctx, bufferSize);
-
-        size_t olen = 0;
-        utils_base64_encode((uint8_t*)result, bufferSize, &olen, buffer.data, buffer.length);
-        ret = JS_NewStringLen(ctx, result, olen);
-        js_free(ctx, result);
-
-    } else {
-        ret = JS_NewStringLen(ctx, buffer.data, buffer.length);
-    }
-
-#endif
-    return ret;
-}
-
-static JSValue tjs_util_decode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
-{
-    size_t data_size = 0;
-    const char* data = JS_ToCStringLen(ctx, &data_size, argv[0]);
-    if (!data) {
-        return JS_EXCEPTION;
-    }
-
-    int32_t type = CODE_HEX;
-    if (argc > 1) {
-        type = TJS_ToInt32(ctx, argv[1], -1);
-    }
-
-    if (type == CODE_HEX) {
-        size_t bufferSize = data_size / 2 + 2;
-        uint8_t* buffer = js_malloc(ctx, bufferSize);
-        int status = utils_hex_decode(buffer, bufferSize, data, data_size);
-        JS_FreeCString(ctx, data);
-
-        if (status < 0) {
-            js_free(ctx, buffer);
-            return JS_UNDEFINED;
-        }
-
-        return TJS_NewUint8Array(ctx, buffer, status);
-
-    } else if (type == CODE_BASE64) {
-        size_t bufferSize = data_size;
-        char* buffer = js_malloc(ctx, data_size);
-        // memcpy(buffer, data, data_size);
-        size_t olen = 0;
-        utils_base64_decode(buffer, bufferSize, &olen, data, data_size);
-        JS_FreeCString(ctx, data);
-
-        return TJS_NewUint8Array(ctx, (uint8_t*)buffer, olen);
-
-    } else {
-        uint8_t* buffer = js_malloc(ctx, data_size);
-        memcpy(buffer, data, data_size);
-        JS_FreeCString(ctx, data);
-
-        return TJS_NewUint8Array(ctx, buffer, data_size);
-    }
-}
-
 static const JSCFunctionListEntry tjs_util_funcs[] = {
     TJS_CONST(HASH_MD5),
     TJS_CONST(HASH_SHA1),
     TJS_CONST(CODE_HEX),
     TJS_CONST(CODE_BASE64),
+    TJS_CONST(CODE_BASE64URL),
 
     TJS_CFUNC_DEF("test", 2, tjs_util_test),
     TJS_CFUNC_DEF("hash", 2, tjs_util_hash),
     TJS_CFUNC_DEF("asset", 1, tjs_read_module_file),
     TJS_CFUNC_DEF("modules", 0, tjs_get_module_names),
-    TJS_CFUNC_DEF("decode", 2, tjs_util_decode),
-    TJS_CFUNC_DEF("encode", 2, tjs_util_encode),
+    TJS_CFUNC_DEF("decode", 2, tjs_codec_decode),
+    TJS_CFUNC_DEF("encode", 2, tjs_codec_encode),
     TJS_CFUNC_DEF("toString", 2, tjs_utf8_decode),
     TJS_CFUNC_DEF("toBuffer", 2, tjs_utf8_encode)
 };
 
-static const JSCFunctionListEntry tjs_utf8_funcs[] = {
-    TJS_CFUNC_DEF("decode", 2, tjs_utf8_decode),
-    TJS_CFUNC_DEF("encode", 2, tjs_utf8_encode)
-};
-
 void tjs_mod_util_init(JSContext* ctx, JSModuleDef* m)
 {
     TJS_ExportModuleObject(ctx, m, "util", tjs_util_funcs);
-    TJS_ExportModuleObject(ctx, m, "utf8", tjs_utf8_funcs);
 }
 
 void tjs_mod_util_export(JSContext* ctx, JSModuleDef* m)
 {
     JS_AddModuleExport(ctx, m, "util");
-    JS_AddModuleExport(ctx, m, "utf8");
 }
@@ -443,10 +443,12 @@ tjs_buffer_t TJS_ToArrayBuffer(JSContext* ctx, JSValueConst value)
         return buffer;
     }
 
-    // ArrayBuffer
-    buffer.data = JS_GetArrayBuffer(ctx, &buffer.length, value);
-    if (buffer.data != NULL) {
-        return buffer;
+    // ArrayBuffer (先判断类型, 避免对 TypedArray 抛出并丢弃一个异常)
+    if (!JS_IsTypedArray(value)) {
+        buffer.data = JS_GetArrayBuffer(ctx, &buffer.length, value);
+        if (buffer.data != NULL) {
+            return buffer;
+        }
     }
 
     /* Check if it's a typed array. */
@@ -476,10 +478,12 @@ tjs_buffer_t TJS_GetArrayBuffer(JSContext* ctx, JSValueConst value)
     buffer.error = JS_UNDEFINED;
     buffer.is_string = FALSE;
 
-    // ArrayBuffer
-    buffer.data = JS_GetArrayBuffer(ctx, &buffer.length, value);
-    if (buffer.data != NULL) {
-        return buffer;
+    // ArrayBuffer (先判断类型, 避免对 TypedArray 抛出并丢弃一个异常)
+    if (!JS_IsTypedArray(value)) {
+        buffer.data = JS_GetArrayBuffer(ctx, &buffer.length, value);
+        if (buffer.data != NULL) {
+            return buffer;
+        }
     }
 
     /* Check if it's a typed array. */
@@ -59,8 +59,14 @@ void tjs_mod_fs_export(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_fs_init(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_hal_export(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_hal_init(JSContext* ctx, JSModuleDef* m);
+void tjs_mod_heap_export(JSContext* ctx, JSModuleDef* m);
+void tjs_mod_heap_init(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_http_export(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_http_init(JSContext* ctx, JSModuleDef* m);
+void tjs_mod_json_export(JSContext* ctx, JSModuleDef* m);
+void tjs_mod_json_init(JSContext* ctx, JSModuleDef* m);
+void tjs_mod_logger_export(JSContext* ctx, JSModuleDef* m);
+void tjs_mod_logger_init(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_misc_export(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_misc_init(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_mqtt_export(JSContext* ctx, JSModuleDef* m);
@@ -69,6 +75,8 @@ void tjs_mod_os_export(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_os_init(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_process_export(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_process_init(JSContext* ctx, JSModuleDef* m);
+void tjs_mod_profiler_export(JSContext* ctx, JSModuleDef* m);
+void tjs_mod_profiler_init(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_signals_export(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_signals_init(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_std_export(JSContext* ctx, JSModuleDef* m);
@@ -83,6 +91,8 @@ void tjs_mod_uart_export(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_uart_init(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_udp_export(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_udp_init(JSContext* ctx, JSModuleDef* m);
+void tjs_mod_utf8_export(JSContext* ctx, JSModuleDef* m);
+void tjs_mod_utf8_init(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_util_export(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_util_init(JSContext* ctx, JSModuleDef* m);
 void tjs_mod_wasm_export(JSContext* ctx, JSModuleDef* m);
@@ -100,17 +110,22 @@ static int tjs_init(JSContext* ctx, JSModuleDef* m)
     tjs_mod_error_init(ctx, m);
     tjs_mod_fs_init(ctx, m);
     tjs_mod_hal_init(ctx, m);
+    tjs_mod_heap_init(ctx, m);
     tjs_mod_http_init(ctx, m);
+    tjs_mod_json_init(ctx, m);
+    tjs_mod_logger_init(ctx, m);
     tjs_mod_misc_init(ctx, m);
     tjs_mod_mqtt_init(ctx, m);
     tjs_mod_os_init(ctx, m);
     tjs_mod_process_init(ctx, m);
+    tjs_mod_profiler_init(ctx, m);
     tjs_mod_signals_init(ctx, m);
     tjs_mod_std_init(ctx, m);
     tjs_mod_streams_init(ctx, m);
     tjs_mod_timers_init(ctx, m);
     tjs_mod_uart_init(ctx, m);
     tjs_mod_udp_init(ctx, m);
+    tjs_mod_utf8_init(ctx, m);
     tjs_mod_util_init(ctx, m);
     tjs_mod_worker_init(ctx, m);
     tjs_mod_zlib_init(ctx, m);
@@ -139,17 +154,22 @@ JSModuleDef* js_init_module_uv(JSContext* ctx, const char* name)
     tjs_mod_error_export(ctx, m);
     tjs_mod_fs_export(ctx, m);
     tjs_mod_hal_export(ctx, m);
+    tjs_mod_heap_export(ctx, m);
     tjs_mod_http_export(ctx, m);
+    tjs_mod_json_export(ctx, m);
+    tjs_mod_logger_export(ctx, m);
     tjs_mod_misc_export(ctx, m);
     tjs_mod_mqtt_export(ctx, m);
     tjs_mod_os_export(ctx, m);
     tjs_mod_process_export(ctx, m);
+    tjs_mod_profiler_export(ctx, m);
     tjs_mod_signals_export(ctx, m);
     tjs_mod_std_export(ctx, m);
     tjs_mod_streams_export(ctx, m);
     tjs_mod_timers_export(ctx, m);
     tjs_mod_uart_export(ctx, m);
     tjs_mod_udp_export(ctx, m);
+    tjs_mod_utf8_export(ctx, m);
     tjs_mod_util_export(ctx, m);
     tjs_mod_worker_export(ctx, m);
     tjs_mod_zlib_export(ctx, m);
@@ -308,6 +328,7 @@ TJSRuntime* tjs_new_runtime(bool is_worker, TJSRuntimeOptions* options)
     JS_AddIntrinsicBigDecimal(ctx);
 
     qrt->is_worker = is_worker;
+    tjs_worker_init_runtime(qrt);
 
     CHECK_EQ(uv_loop_init(&qrt->loop), 0);
 
@@ -383,6 +404,9 @@ TJSRuntime* tjs_new_worker_runtime(void)
 
 void TJS_FreeRuntime(TJSRuntime* qrt)
 {
+    tjs_profiler_close(qrt);
+    tjs_worker_close_runtime(qrt);
+
     /* Close all loop handles. */
     uv_close((uv_handle_t*)&qrt->jobs.prepare, NULL);
     uv_close((uv_handle_t*)&qrt->jobs.idle, NULL);
@@ -485,6 +509,10 @@ static void uv__prepare_cb(uv_prepare_t* handle)
     CHECK_NOT_NULL(qrt);
 
     uv__maybe_idle(qrt);
+
+    if (qrt->profiler) {
+        tjs_profiler_on_prepare(qrt);
+    }
 }
 
 void tjs_execute_pending_jobs(JSContext* ctx)
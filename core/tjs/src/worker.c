@@ -25,6 +25,8 @@
 #include "private.h"
 #include "tjs.h"
 
+#include <math.h>
+#include <stdatomic.h>
 #include <unistd.h>
 
 enum tjs_worker_events_e {
@@ -60,13 +62,83 @@ typedef struct tjs_worker_s {
     uv_thread_t tid;
     TJSRuntime* wrt;
     bool is_main;
+    DynBuf input; /* 未读完的消息 */
 } TJSWorker;
 
+/**
+ * 消息头, 后面是 sab_count 个 SharedArrayBuffer 指针和 size 字节的序列化数据
+ * - 发送时会增加这些 SharedArrayBuffer 的引用计数, 在接收方读取后再释放
+ */
+typedef struct tjs_worker_frame_s {
+    uint32_t size;
+    uint32_t sab_count;
+} TJSWorkerFrame;
+
 typedef struct tjs_worker_write_req_s {
     uv_write_t req;
     uint8_t* data;
+    uint8_t** sab_tab;
+    TJSWorkerFrame frame;
 } TJSWorkerWriteReq;
 
+/** 引用计数的 SharedArrayBuffer, 可以在多个运行时之间共享 */
+typedef struct tjs_shared_buffer_s {
+    atomic_int ref_count;
+    size_t size;
+    uint64_t data[];
+} TJSSharedBuffer;
+
+/** Atomics.waitAsync 的等待请求 */
+struct tjs_atomics_wait_s {
+    JSContext* ctx;
+    uv_async_t async; /* Atomics.notify 可能在其他线程中调用 */
+    uv_timer_t timer;
+    JSAtomicsWaiter* waiter;
+    JSValue array; /* 等待期间保持 SharedArrayBuffer 的引用 */
+    TJSPromise result;
+    int handles;
+    tjs_atomics_wait_t* prev;
+    tjs_atomics_wait_t* next;
+};
+
+static void* tjs_sab_alloc(void* opaque, size_t size)
+{
+    TJSSharedBuffer* sab = malloc(sizeof(*sab) + size);
+    if (!sab) {
+        return NULL;
+    }
+
+    atomic_init(&sab->ref_count, 1);
+    sab->size = size;
+    tjs_heap_add(TJS_HEAP_SAB, sizeof(*sab) + size);
+    return sab->data;
+}
+
+static void tjs_sab_free(void* opaque, void* ptr)
+{
+    TJSSharedBuffer* sab = container_of(ptr, TJSSharedBuffer, data);
+    if (atomic_fetch_sub(&sab->ref_count, 1) == 1) {
+        tjs_heap_remove(TJS_HEAP_SAB, sizeof(*sab) + sab->size);
+        free(sab);
+    }
+}
+
+static void tjs_sab_dup(void* opaque, void* ptr)
+{
+    TJSSharedBuffer* sab = container_of(ptr, TJSSharedBuffer, data);
+    atomic_fetch_add(&sab->ref_count, 1);
+}
+
+/** 释放消息中的 SharedArrayBuffer 的引用 */
+static void tjs_worker_free_sabs(const uint8_t* sabs, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        void* ptr;
+        memcpy(&ptr, sabs + i * sizeof(ptr), sizeof(ptr));
+        tjs_sab_free(NULL, ptr);
+    }
+}
+
 static JSValue worker_eval(JSContext* ctx, int argc, JSValueConst* argv)
 {
     const char* filename;
@@ -142,6 +214,23 @@ static void uv__close_cb(uv_handle_t* handle)
 {
     TJSWorker* worker = handle->data;
     CHECK_NOT_NULL(worker);
+
+    /* 释放未读完的消息中的 SharedArrayBuffer */
+    DynBuf* input = &worker->input;
+    size_t offset = 0;
+    while (input->size - offset >= sizeof(TJSWorkerFrame)) {
+        TJSWorkerFrame frame;
+        memcpy(&frame, input->buf + offset, sizeof(frame));
+        size_t header_size = sizeof(frame) + frame.sab_count * sizeof(void*);
+        if (input->size - offset < header_size) {
+            break;
+        }
+
+        tjs_worker_free_sabs(input->buf + offset + sizeof(frame), frame.sab_count);
+        offset += header_size + frame.size;
+    }
+
+    dbuf_free(input);
     free(worker);
 }
 
@@ -219,6 +308,39 @@ static void uv__alloc_cb(uv_handle_t* handle, size_t suggested_size, uv_buf_t* b
     buf->len = suggested_size;
 }
 
+/** 处理所有完整的消息, 返回已处理的字节数 */
+static size_t tjs_worker_read_frames(TJSWorker* worker, const uint8_t* data, size_t size)
+{
+    JSContext* ctx = worker->ctx;
+    size_t offset = 0;
+
+    while (size - offset >= sizeof(TJSWorkerFrame)) {
+        TJSWorkerFrame frame;
+        memcpy(&frame, data + offset, sizeof(frame));
+        size_t header_size = sizeof(frame) + frame.sab_count * sizeof(void*);
+        if (size - offset < header_size + frame.size) {
+            break;
+        }
+
+        const uint8_t* sabs = data + offset + sizeof(frame);
+        JSValue obj = JS_ReadObject(ctx, sabs + frame.sab_count * sizeof(void*), frame.size, JS_READ_OBJ_SAB);
+        tjs_worker_free_sabs(sabs, frame.sab_count);
+        offset += header_size + frame.size;
+
+        if (JS_IsException(obj)) {
+            JSValue error = JS_GetException(ctx);
+            maybe_emit_event(worker, WORKER_EVENT_MESSAGE_ERROR, error);
+            JS_FreeValue(ctx, error);
+            continue;
+        }
+
+        maybe_emit_event(worker, WORKER_EVENT_MESSAGE, obj);
+        JS_FreeValue(ctx, obj);
+    }
+
+    return offset;
+}
+
 static void uv__read_cb(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf)
 {
     TJSWorker* worker = handle->data;
@@ -237,11 +359,30 @@ static void uv__read_cb(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf)
         return;
     }
 
-    // TODO: the entire object might not have come in a single packet. Use netstrings.
-    JSValue obj = JS_ReadObject(ctx, (const uint8_t*)buf->base, buf->len, 0);
-    maybe_emit_event(worker, WORKER_EVENT_MESSAGE, obj);
-    JS_FreeValue(ctx, obj);
+    /* 一个消息可能分多次读取, 一次也可能读取多个消息 */
+    const uint8_t* data = (const uint8_t*)buf->base;
+    DynBuf* input = &worker->input;
+    int ret = 0;
+    if (input->size == 0) {
+        size_t used = tjs_worker_read_frames(worker, data, nread);
+        if (used < (size_t)nread) {
+            ret = dbuf_put(input, data + used, nread - used);
+        }
+
+    } else if ((ret = dbuf_put(input, data, nread)) == 0) {
+        size_t used = tjs_worker_read_frames(worker, input->buf, input->size);
+        memmove(input->buf, input->buf + used, input->size - used);
+        input->size -= used;
+    }
+
     js_free(ctx, buf->base);
+
+    if (ret != 0) {
+        uv_read_stop(&worker->h.stream);
+        JSValue error = tjs_new_uv_error(ctx, UV_ENOMEM);
+        maybe_emit_event(worker, WORKER_EVENT_ERROR, error);
+        JS_FreeValue(ctx, error);
+    }
 }
 
 static JSValue tjs_new_worker(JSContext* ctx, uv_os_sock_t channel_fd, bool is_main)
@@ -260,6 +401,7 @@ static JSValue tjs_new_worker(JSContext* ctx, uv_os_sock_t channel_fd, bool is_m
     worker->ctx = ctx;
     worker->is_main = is_main;
     worker->h.handle.data = worker;
+    dbuf_init(&worker->input);
 
 #if defined(_WIN32)
     CHECK_EQ(uv_tcp_init(TJS_GetLoop(ctx), &worker->h.tcp), 0);
@@ -390,11 +532,17 @@ static void uv__write_cb(uv_write_t* req, int status)
     JSContext* ctx = workers->ctx;
 
     if (status < 0) {
+        /* 消息没有发送出去, 释放传递中的 SharedArrayBuffer */
+        for (uint32_t i = 0; i < request->frame.sab_count; i++) {
+            tjs_sab_free(NULL, request->sab_tab[i]);
+        }
+
         JSValue error = tjs_new_uv_error(ctx, status);
         maybe_emit_event(workers, WORKER_EVENT_MESSAGE_ERROR, error);
         JS_FreeValue(ctx, error);
     }
 
+    js_free(ctx, request->sab_tab);
     js_free(ctx, request->data);
     js_free(ctx, request);
 }
@@ -413,21 +561,50 @@ static JSValue tjs_worker_postmessage(JSContext* ctx, JSValueConst this_val, int
 
     memset(request, 0, sizeof(*request));
     size_t length;
-    uint8_t* buffer = JS_WriteObject(ctx, &length, argv[0], 0);
+    uint8_t** sab_tab = NULL;
+    size_t sab_count = 0;
+    uint8_t* buffer = JS_WriteObject2(ctx, &length, argv[0], JS_WRITE_OBJ_SAB, &sab_tab, &sab_count);
     if (!buffer) {
         js_free(ctx, request);
         return JS_EXCEPTION;
     }
 
+    if (length > UINT32_MAX) {
+        js_free(ctx, sab_tab);
+        js_free(ctx, buffer);
+        js_free(ctx, request);
+        return JS_ThrowRangeError(ctx, "message too large");
+    }
+
     request->req.data = request;
     request->data = buffer;
+    request->sab_tab = sab_tab;
+    request->frame.size = length;
+    request->frame.sab_count = sab_count;
 
-    uv_buf_t buf = uv_buf_init((char*)buffer, length);
-    int r = uv_write(&request->req, &worker->h.stream, &buf, 1, uv__write_cb);
+    /* 只传递 SharedArrayBuffer 的指针, 在接收方读取前保持引用 */
+    for (size_t i = 0; i < sab_count; i++) {
+        tjs_sab_dup(NULL, sab_tab[i]);
+    }
+
+    uv_buf_t bufs[3];
+    int count = 0;
+    bufs[count++] = uv_buf_init((char*)&request->frame, sizeof(request->frame));
+    if (sab_count > 0) {
+        bufs[count++] = uv_buf_init((char*)sab_tab, sab_count * sizeof(void*));
+    }
+
+    bufs[count++] = uv_buf_init((char*)buffer, length);
+    int r = uv_write(&request->req, &worker->h.stream, bufs, count, uv__write_cb);
     if (r != 0) {
+        for (size_t i = 0; i < sab_count; i++) {
+            tjs_sab_free(NULL, sab_tab[i]);
+        }
+
+        js_free(ctx, sab_tab);
         js_free(ctx, buffer);
         js_free(ctx, request);
-        return JS_EXCEPTION;
+        return tjs_throw_uv_error(ctx, r);
     }
 
     return JS_UNDEFINED;
@@ -475,6 +652,160 @@ static JSValue tjs_worker_event_set(JSContext* ctx, JSValueConst this_val, JSVal
     return JS_UNDEFINED;
 }
 
+static void tjs_atomics_wait_close_cb(uv_handle_t* handle)
+{
+    tjs_atomics_wait_t* wait = handle->data;
+    CHECK_NOT_NULL(wait);
+
+    if (--wait->handles == 0) {
+        free(wait);
+    }
+}
+
+static void tjs_atomics_wait_close(tjs_atomics_wait_t* wait)
+{
+    TJSRuntime* qrt = TJS_GetRuntime(wait->ctx);
+    if (wait->prev) {
+        wait->prev->next = wait->next;
+
+    } else if (qrt->atomics_waits == wait) {
+        qrt->atomics_waits = wait->next;
+    }
+
+    if (wait->next) {
+        wait->next->prev = wait->prev;
+    }
+
+    wait->prev = NULL;
+    wait->next = NULL;
+
+    JS_FreeValue(wait->ctx, wait->array);
+    wait->array = JS_UNDEFINED;
+
+    uv_close((uv_handle_t*)&wait->async, tjs_atomics_wait_close_cb);
+    uv_close((uv_handle_t*)&wait->timer, tjs_atomics_wait_close_cb);
+}
+
+static void tjs_atomics_wait_settle(tjs_atomics_wait_t* wait)
+{
+    if (!wait->waiter) {
+        return;
+    }
+
+    /* 超时和 notify 可能同时发生, 以是否还在等待队列中为准 */
+    bool notified = JS_AtomicsFreeWaiter(JS_GetRuntime(wait->ctx), wait->waiter);
+    wait->waiter = NULL;
+
+    JSContext* ctx = wait->ctx;
+    JSValue arg = JS_NewString(ctx, notified ? "ok" : "timed-out");
+    TJS_SettlePromise(ctx, &wait->result, false, 1, (JSValueConst*)&arg);
+    tjs_atomics_wait_close(wait);
+}
+
+/* 在调用 Atomics.notify 的线程中执行 */
+static void tjs_atomics_notify_cb(void* opaque)
+{
+    tjs_atomics_wait_t* wait = opaque;
+    uv_async_send(&wait->async);
+}
+
+static void tjs_atomics_async_cb(uv_async_t* handle)
+{
+    tjs_atomics_wait_settle(handle->data);
+}
+
+static void tjs_atomics_timer_cb(uv_timer_t* handle)
+{
+    tjs_atomics_wait_settle(handle->data);
+}
+
+/**
+ * Atomics.waitAsync(typedArray, index, value, timeout)
+ * - 不需要等待时直接返回 'not-equal' 或 'timed-out'
+ * - 否则返回 Promise, 被唤醒时为 'ok', 超时为 'timed-out'
+ */
+static JSValue tjs_atomics_wait_async(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    double timeout;
+    if (JS_ToFloat64(ctx, &timeout, argv[3])) {
+        return JS_EXCEPTION;
+    }
+
+    tjs_atomics_wait_t* wait = calloc(1, sizeof(*wait));
+    if (!wait) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    uv_loop_t* loop = TJS_GetLoop(ctx);
+    wait->ctx = ctx;
+    wait->array = JS_UNDEFINED;
+    wait->handles = 2;
+    CHECK_EQ(uv_async_init(loop, &wait->async, tjs_atomics_async_cb), 0);
+    CHECK_EQ(uv_timer_init(loop, &wait->timer), 0);
+    wait->async.data = wait;
+    wait->timer.data = wait;
+
+    int ret = JS_AtomicsWaitAsync(ctx, &wait->waiter, argv[0], argv[1], argv[2], tjs_atomics_notify_cb, wait);
+    if (ret <= 0) {
+        tjs_atomics_wait_close(wait);
+        return ret < 0 ? JS_EXCEPTION : JS_NewString(ctx, "not-equal");
+
+    } else if (timeout <= 0) {
+        bool notified = JS_AtomicsFreeWaiter(JS_GetRuntime(wait->ctx), wait->waiter);
+        wait->waiter = NULL;
+        tjs_atomics_wait_close(wait);
+        return JS_NewString(ctx, notified ? "ok" : "timed-out");
+    }
+
+    /* NaN 和 Infinity 表示一直等待 */
+    if (!isnan(timeout) && timeout < 1e15) {
+        CHECK_EQ(uv_timer_start(&wait->timer, tjs_atomics_timer_cb, (uint64_t)ceil(timeout), 0), 0);
+    }
+
+    TJSRuntime* qrt = TJS_GetRuntime(ctx);
+    wait->next = qrt->atomics_waits;
+    if (wait->next) {
+        wait->next->prev = wait;
+    }
+
+    qrt->atomics_waits = wait;
+
+    wait->array = JS_DupValue(ctx, argv[0]);
+    return TJS_InitPromise(ctx, &wait->result);
+}
+
+void tjs_worker_init_runtime(TJSRuntime* qrt)
+{
+    static const JSSharedArrayBufferFunctions sab_funcs = {
+        .sab_alloc = tjs_sab_alloc,
+        .sab_free = tjs_sab_free,
+        .sab_dup = tjs_sab_dup,
+        .sab_opaque = NULL
+    };
+
+    JS_SetSharedArrayBufferFunctions(qrt->rt, &sab_funcs);
+
+    /* 主线程不能阻塞, 只能使用 Atomics.waitAsync */
+    JS_SetCanBlock(qrt->rt, qrt->is_worker);
+}
+
+void tjs_worker_close_runtime(TJSRuntime* qrt)
+{
+    while (qrt->atomics_waits) {
+        tjs_atomics_wait_t* wait = qrt->atomics_waits;
+        if (wait->waiter) {
+            JS_AtomicsFreeWaiter(JS_GetRuntime(wait->ctx), wait->waiter);
+            wait->waiter = NULL;
+        }
+
+        /* 运行时正在退出, 不再 resolve, 和 TJS_SettlePromise 一样释放 resolve 函数 */
+        JS_FreeValue(wait->ctx, wait->result.rfuncs[0]);
+        JS_FreeValue(wait->ctx, wait->result.rfuncs[1]);
+        TJS_FreePromise(wait->ctx, &wait->result);
+        tjs_atomics_wait_close(wait);
+    }
+}
+
 static const JSCFunctionListEntry tjs_worker_proto_funcs[] = {
     TJS_CFUNC_DEF("postMessage", 1, tjs_worker_postmessage),
     TJS_CFUNC_DEF("terminate", 0, tjs_worker_terminate),
@@ -498,9 +829,12 @@ void tjs_mod_worker_init(JSContext* ctx, JSModuleDef* m)
     /* Worker object */
     obj = JS_NewCFunction2(ctx, tjs_worker_constructor, "Worker", 1, JS_CFUNC_constructor, 0);
     JS_SetModuleExport(ctx, m, "Worker", obj);
+
+    JS_SetModuleExport(ctx, m, "waitAsync", JS_NewCFunction(ctx, tjs_atomics_wait_async, "waitAsync", 4));
 }
 
 void tjs_mod_worker_export(JSContext* ctx, JSModuleDef* m)
 {
     JS_AddModuleExport(ctx, m, "Worker");
+    JS_AddModuleExport(ctx, m, "waitAsync");
 }
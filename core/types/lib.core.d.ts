@@ -5,18 +5,38 @@
 declare module '@tjs/encoding' {
     /**
      * 解码
+     * - 忽略空白字符, base64 同时支持标准和 URL 安全的字符集, 填充字符是可选的
+     * - 包含无效的字符时抛出 TypeError
      * @param text 要解码的数据
-     * @param format `hex`,`base64`
+     * @param format `hex`,`base64`,`base64url`
      */
-    export function decode(text: string, format?: string): Uint8Array;
+    export function decode(text: string | BufferSource, format?: string): Uint8Array;
 
     /**
      * 编码
      * @param data 要编码的数据
-     * @param format `hex`,`base64`
+     * @param format `hex`,`base64`,`base64url` (不使用填充字符)
      */
     export function encode(data: string | Uint8Array | ArrayBuffer, format?: string): string;
 
+    /**
+     * 分块编码为 hex/base64/base64url 字符串, 用于流式的数据
+     */
+    export class BinaryEncoder {
+        /**
+         * @param format `hex`,`base64`,`base64url`, 默认为 `base64`
+         */
+        constructor(format?: string);
+
+        readonly format: string;
+
+        /**
+         * @param input 要编码的数据块
+         * @param options `stream` 为 true 时表示后面还有数据, 不完整的组留到下一次编码
+         */
+        encode(input?: BufferSource, options?: { stream?: boolean }): string;
+    }
+
     /**
      * UTF8 编码的二进制数据和字符串之间的转换
      */
@@ -24,8 +44,10 @@ declare module '@tjs/encoding' {
         /**
          * 解码
          * @param data UTF8 二进制数据
+         * @param offset 开始位置
+         * @param length 长度
          */
-        function decode(data: BufferSource): string;
+        function decode(data: BufferSource, offset?: number, length?: number): string;
 
         /**
          * 编码
@@ -48,6 +70,12 @@ declare module '@tjs/fs' {
         encoding?: string, // Default: 'utf8'
         mode?: number, // Default: 0o666
         flag?: string // Default: 'w'.
+
+        /** 先写入临时文件再重命名, 中途失败不会留下不完整的文件 */
+        atomic?: boolean;
+
+        /** 写入后同步到磁盘, 'group' 表示与同时进行的其他原子写入合并目录同步 */
+        fsync?: boolean | 'group';
     }
 
     export interface Stats {
@@ -94,6 +122,72 @@ declare module '@tjs/fs' {
         path: string,
         close(): void
         next(...args: []): IteratorResult<Dirent>
+
+        /**
+         * 一次读取多个目录项, 读取完成后返回空数组
+         * @param count 最多读取的目录项数, 默认为 64
+         */
+        read(count?: number): Promise<Dirent[]>
+    }
+
+    export interface WalkEntry extends Dirent {
+        /** 完整路径 (根目录 + 相对路径) */
+        path: string;
+
+        /** 深度, 根目录下的目录项为 1 */
+        depth: number;
+
+        /** lstat 信息, 只有指定了 `stat` 选项时才有 */
+        stat?: Stats;
+    }
+
+    export interface WalkOptions {
+        /** 同时返回每个目录项的 lstat 信息 */
+        stat?: boolean;
+
+        /** 最大深度 */
+        maxDepth?: number;
+
+        /** 每批最多返回的目录项数, 默认为 256 */
+        batchSize?: number;
+
+        /** 返回 false 时忽略这个目录项, 并且不会进入这个目录 */
+        filter?: (entry: WalkEntry) => boolean;
+    }
+
+    export interface WatchEvent {
+        /** 事件类型, `overflow` 表示有事件丢失, 需要重新扫描 */
+        type: 'create' | 'modify' | 'attrib' | 'delete' | 'rename' | 'overflow';
+
+        /** 文件路径 (监视的路径 + 相对路径) */
+        path: string;
+
+        /** 重命名之前的路径, 只有 `rename` 事件才有 */
+        oldPath?: string;
+
+        /** 是否是目录 */
+        directory?: boolean;
+    }
+
+    export interface WatchOptions {
+        /** 是否同时监视所有子目录 */
+        recursive?: boolean;
+
+        /** 合并事件的时间, 单位为毫秒, 默认为 50 */
+        delay?: number;
+    }
+
+    /** 文件系统监视器 */
+    export class FSWatcher extends EventTarget {
+        /** 监视的路径 */
+        readonly path?: string;
+
+        /** 一批事件, `event.data` 为 WatchEvent 数组 */
+        onchange: ((event: MessageEvent) => void) | null;
+        onclose: ((event: Event) => void) | null;
+
+        /** 停止监视 */
+        close(): void;
     }
 
     /**
@@ -123,6 +217,27 @@ declare module '@tjs/fs' {
          */
         read(size?: number, position?: number): Promise<ArrayBuffer>;
 
+        /**
+         * 同步读取文件内容, 会阻塞事件循环, 只适合读取少量数据
+         * @param size 
+         * @param position 
+         */
+        readSync(size?: number, position?: number): ArrayBuffer;
+
+        /**
+         * 读取文件内容到指定的缓存区, 返回实际读取的字节数
+         * @param buffer 在请求完成之前不要修改这个缓存区
+         * @param position 
+         */
+        readInto(buffer: ArrayBuffer | ArrayBufferView, position?: number): Promise<number>;
+
+        /**
+         * 依次读取文件内容到多个缓存区, 返回实际读取的字节数
+         * @param buffers 
+         * @param position 
+         */
+        readv(buffers: (ArrayBuffer | ArrayBufferView)[], position?: number): Promise<number>;
+
         stat(): Promise<Stats>;
 
         /**
@@ -155,6 +270,20 @@ declare module '@tjs/fs' {
          */
         write(data: ArrayBuffer, offset?: number, length?: number, position?: number): Promise<void>;
 
+        /**
+         * 直接写入指定缓存区中的数据而不复制, 返回实际写入的字节数
+         * @param buffer 在请求完成之前不要修改这个缓存区
+         * @param position 
+         */
+        writeFrom(buffer: ArrayBuffer | ArrayBufferView, position?: number): Promise<number>;
+
+        /**
+         * 依次写入多个缓存区中的数据, 返回实际写入的字节数
+         * @param buffers 
+         * @param position 
+         */
+        writev(buffers: (ArrayBuffer | ArrayBufferView)[], position?: number): Promise<number>;
+
         fileno(): number;
     }
 
@@ -190,7 +319,7 @@ declare module '@tjs/fs' {
     export function access(path: string, mode?: number): Promise<number>;
 
     /** 写入数据到文件尾 */
-    export function appendFile(path: string, data: ArrayBuffer | string, options?: IWriteFileOptions): Promise<void>;
+    export function appendFile(path: string, data: string | ArrayBuffer | ArrayBufferView, options?: IWriteFileOptions | string): Promise<void>;
 
     /** chmod */
     export function chmod(path: string, mode: number): Promise<void>;
@@ -222,6 +351,26 @@ declare module '@tjs/fs' {
     /** 创建一个目录 */
     export function mkdir(path: string, options?: { recursive?: boolean, mode?: string | number }): Promise<void>;
 
+    export type MemoryAdvice = 'normal' | 'random' | 'sequential' | 'willneed' | 'dontneed';
+
+    /**
+     * 给内核提供映射内存的访问方式建议
+     * - 其他 ArrayBuffer 抛出 EINVAL 错误
+     * @param buffer mmap() 返回的 ArrayBuffer 或它的视图
+     * @param advice 
+     */
+    export function madvise(buffer: ArrayBuffer | ArrayBufferView, advice: MemoryAdvice): void;
+
+    /**
+     * 将文件映射到内存
+     * - 返回的 ArrayBuffer 直接使用映射的内存, 在被回收时解除映射
+     * - 同一进程内 (包括 Worker) 对同一文件同一区域的可写映射共用同一块内存
+     * - 只读映射使用写时复制, 写入 ArrayBuffer 只修改它自己的副本, 不会修改文件, 其他映射也看不到
+     * @param filename 文件名
+     * @param options 
+     */
+    export function mmap(filename: string, options?: { offset?: number, length?: number, readonly?: boolean, advice?: MemoryAdvice }): ArrayBuffer;
+
     /** 创建一个临时目录 */
     export function mkdtemp(prefix: string): Promise<string>;
 
@@ -288,11 +437,24 @@ declare module '@tjs/fs' {
     /** 删除一个文件或者符号链接 */
     export function unlink(path: string): Promise<void>;
 
-    /** 修改文件时间 */
+    /**
+     * 遍历目录树, 每次返回一批目录项
+     * - 遍历在线程池中进行, 父目录总是在它的子目录项之前返回
+     * @param root 根目录
+     * @param options 
+     */
+    export function walk(root: string, options?: WalkOptions): AsyncGenerator<WalkEntry[]>;
+
+    /** 修改文件时间, 数字表示秒 */
     export function utimes(path: string, atime: number | Date, mtime: number | Date): Promise<void>;
 
-    /** 监控指定名称的文件或目录 */
-    export function watch(filename: string, options: any, listener: Function): Promise<void>;
+    /**
+     * 监控指定名称的文件或目录
+     * - 在 `delay` 毫秒内发生的事件会被合并成一批: 多次修改只报告一次, 创建后又删除的文件不报告
+     * - 重命名事件包含原来的路径
+     */
+    export function watch(filename: string, options?: WatchOptions, listener?: (events: WatchEvent[]) => void): FSWatcher;
+    export function watch(filename: string, listener?: (events: WatchEvent[]) => void): FSWatcher;
 
     /**
      * Asynchronously writes data to a file, replacing the file if it already exists. 
@@ -307,12 +469,80 @@ declare module '@tjs/fs' {
      * @param filename 文件名
      * @param options 选项
      */
-    export function readableStream(filename: string, options?: { chunkSize?: number, onprogress?: (event: { loaded: number, total: number }) => void }): Promise<ReadableStream>;
+    export function readableStream(filename: string, options?: { chunkSize?: number, recycle?: boolean, onprogress?: (event: { loaded: number, total: number }) => void }): Promise<ReadableStream>;
+
+    /**
+     * 循环使用的一组缓存区
+     */
+    export class BufferRing {
+        /**
+         * @param count 缓存区的个数
+         * @param byteLength 每个缓存区的大小
+         */
+        constructor(count: number, byteLength: number);
+
+        /** 返回下一个缓存区, 它在之后第 `count` 次调用 next() 时被重新使用 */
+        next(): Uint8Array;
+    }
 }
 
 /**
  * The os module provides operating system-related utility methods and properties.
  */
+declare module '@tjs/json' {
+    export interface StringifyOptions {
+        /** 缩进, 同 JSON.stringify 的 space 参数 */
+        space?: number | string;
+
+        /** 每个分块的大致大小 (字节), 默认为 CHUNK_SIZE */
+        chunkSize?: number;
+    }
+
+    export interface ParseOptions {
+        /** 单个记录的最大长度 (字节), 默认不限制 */
+        maxLength?: number;
+    }
+
+    /** 默认的分块大小 (字节) */
+    export const CHUNK_SIZE: number;
+
+    /**
+     * 增量序列化为 UTF-8 编码的分块, 内容和 JSON.stringify(value, null, space) 相同
+     */
+    export function stringifyChunks(value: any, options?: StringifyOptions): Generator<Uint8Array, void, unknown>;
+
+    /**
+     * 返回一个按需序列化的流, 每次读取时才生成下一个分块
+     */
+    export function stringifyStream(value: any, options?: StringifyOptions): ReadableStream<Uint8Array>;
+
+    /**
+     * 增量解析器
+     * - 根值为数组时, 每收到一个完整的元素就返回这个元素 (记录)
+     * - 根值不是数组时, 在 end() 时返回整个文档的值
+     */
+    export class JSONParser {
+        constructor(options?: ParseOptions);
+
+        /**
+         * 写入一块 UTF-8 编码的数据
+         * @returns 这块数据中完成的记录
+         */
+        write(data: BufferSource): any[];
+
+        /**
+         * 结束解析, 文档不完整时抛出 SyntaxError
+         * @returns 剩余的记录
+         */
+        end(): any[];
+    }
+
+    /**
+     * 从流中逐个读取顶层数组中的记录
+     */
+    export function parseStream(source: ReadableStream<BufferSource> | AsyncIterable<BufferSource>, options?: ParseOptions): AsyncGenerator<any, void, unknown>;
+}
+
 declare module '@tjs/os' {
     import * as native from '@tjs/native';
 
@@ -479,7 +709,7 @@ declare module '@tjs/os' {
      * @param command 要执行的命令行
      * @param options 选项
      */
-    export function exec(command: string[] | string, options?: ProcessOptions): Promise<ProcessResult>;
+    export function exec(command: string[] | string, options?: native.ExecOptions): Promise<ProcessResult>;
 
     /**
      * 执行 Shell 命令
@@ -669,6 +899,14 @@ declare module '@tjs/path' {
      */
     export function parse(path: string): PathObject;
 
+    /**
+     * Returns the relative path from `from` to `to` based on the current working directory.
+     * 返回从 from 到 to 的相对路径
+     * @param from 
+     * @param to 
+     */
+    export function relative(from: string, to: string): string;
+
     /**
      * Returns a path string from an object. This is the opposite of path.parse().
      * @param path 
@@ -754,6 +992,13 @@ declare module '@tjs/process' {
      */
     export function scriptPath(): string
 
+    /**
+     * 执行一个命令, 返回它的退出状态和输出
+     * @param command 命令及参数, 为字符串时按空格分割
+     * @param options 
+     */
+    export function exec(command: string | string[], options?: native.ExecOptions): Promise<native.ExecResult>
+
     /**
      * Exit the process with optional exit code.
      * 以 `code` 的退出状态同步终止进程。 
@@ -832,7 +1077,7 @@ declare module '@tjs/util' {
     /**
      * 解码
      * @param text 要解码的数据
-     * @param format `hex`,`base64`
+     * @param format `hex`,`base64`,`base64url`
      */
     export function decode(text: string, format?: string): Uint8Array;
 
@@ -845,7 +1090,7 @@ declare module '@tjs/util' {
     /**
      * 编码
      * @param data 要编码的数据
-     * @param format `hex`,`base64`
+     * @param format `hex`,`base64`,`base64url`
      */
     export function encode(data: string | Uint8Array | ArrayBuffer, format?: string): string;
 
@@ -862,17 +1107,24 @@ declare module '@tjs/util' {
      */
     export function sleep(time: number): Promise<void>;
 
+    /**
+     * 解析 JSON 数据, 二进制数据直接按 UTF-8 解析而不需要先解码为字符串
+     * @param data JSON 文本或 UTF-8 编码的数据
+     * @param options.reviver 同 `JSON.parse` 的 reviver 参数
+     */
+    export function parseJSON(data: string | BufferSource, options?: { reviver?: (this: any, key: string, value: any) => any }): any;
+
     /**
      * 将字符串转换为二进制数据
      * @param text 字符串
-     * @param format 编码格式 'utf-8', 'utf8', 'hex', 'base64'
+     * @param format 编码格式 'utf-8', 'utf8', 'hex', 'base64', 'base64url'
      */
     export function toBuffer(text: string, format?: string): ArrayBuffer;
 
     /**
      * 将二进制数据转换为字符串
      * @param data 二进制数据
-     * @param format 编码格式 'utf-8', 'utf8', 'hex', 'base64'
+     * @param format 编码格式 'utf-8', 'utf8', 'hex', 'base64', 'base64url'
      */
     export function toString(data: Uint8Array | ArrayBuffer, format?: string): string;
 
@@ -952,6 +1204,15 @@ declare module '@tjs/util' {
          */
         function compress(data: BufferSource): ArrayBuffer;
 
+        /**
+         * 计算 CRC32 校验值
+         * @param data 数据
+         * @param crc 上一次计算的结果, 用于分段计算
+         * @param offset 开始位置
+         * @param length 长度
+         */
+        function crc32(data: BufferSource, crc?: number, offset?: number, length?: number): number;
+
         /**
          * 数据解压
          * @param data 要解压的数据
@@ -248,6 +248,15 @@ declare module '@tjs/config' {
          * Encode as JSON string
          */
         toJSON(): string;
+
+        /** 停止监视配置文件 */
+        unwatch(): void;
+
+        /**
+         * 监视配置文件, 文件被修改后重新加载
+         * @param onchange 重新加载后调用
+         */
+        watch(onchange?: (config: Config) => void): void;
     }
 
     /**
@@ -489,11 +498,17 @@ declare module '@tjs/logs' {
         /** 进程名 */
         name: string,
 
-        /** 日志输出方式 `syslog`, `console` */
+        /** 日志输出方式 `syslog`, `console`, `file` */
         type?: string,
 
         /** 日志输出级别 `log` | `info` | `warn` | `error` */
-        level?: string
+        level?: string,
+
+        /** 日志文件名，输出方式为 `file` 时有效 */
+        filename?: string,
+
+        /** 日志缓冲区最多可以缓存的日志条数 */
+        capacity?: number
     }
 
     /**
@@ -533,6 +548,15 @@ declare module '@tjs/logs' {
         export function log(level: number, data: string): void;
     }
 
+    /** 异步日志缓冲区 */
+    export const logger: typeof import('@tjs/native').logger;
+
+    /** 等待缓冲区中的日志都写入完成 */
+    export function flush(): void;
+
+    /** 返回日志缓冲区的统计信息 */
+    export function stats(): import('@tjs/native').logger.LoggerStats;
+
     /**
      * 配置控制台日志输出
      * @param config 日志配置参数
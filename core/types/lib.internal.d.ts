@@ -72,6 +72,14 @@ declare module '@tjs/console' {
      */
     export function print(...args: any): void;
 
+    /**
+     * 返回打印到控制台的日志文本
+     * @param {string} level 日志级别: `d`,`l`,`i`,`w`,`e`,`a`
+     * @param {string} lineNumber 源代码行号信息
+     * @param {string} message 已格式化的日志内容
+     */
+    export function formatConsole(level: string, lineNumber: string, message: string): string;
+
     /**
      * 打印日志信息
      * @param {string} level 日志级别: `d`,`l`,`i`,`w`,`e`,`a`
@@ -165,7 +173,7 @@ declare module '@tjs/console' {
  */
 declare module '@tjs/streams' {
     function createReadableStream<R>(underlyingSource?: UnderlyingSource<R>, queuingStrategy?: QueuingStrategy<R>): ReadableStream<R>;
-    function createWritableStream<R>(): WritableStream<R>;
+    function createWritableStream<W>(underlyingSink?: UnderlyingSink<W>, queuingStrategy?: QueuingStrategy<W>): WritableStream<W>;
 }
 
 /** Crypto */
@@ -181,6 +189,59 @@ declare module '@tjs/performance' {
     export class Performance {
 
     }
+
+    global {
+        /** Chrome DevTools 的 .cpuprofile 格式 */
+        interface CpuProfile {
+            nodes: {
+                id: number;
+                callFrame: {
+                    functionName: string;
+                    scriptId: string;
+                    url: string;
+                    lineNumber: number;
+                    columnNumber: number;
+                };
+                hitCount: number;
+                children: number[];
+            }[];
+            startTime: number;
+            endTime: number;
+            samples: number[];
+            timeDeltas: number[];
+        }
+
+        interface Performance {
+            /** 是否正在进行 CPU 采样 */
+            readonly isProfiling: boolean;
+
+            /**
+             * 开始 CPU 采样
+             * @param options.interval 采样间隔 (微秒), 默认为 1000
+             * @param options.maxSamples 最多保留的采样数, 超过后覆盖最早的采样
+             */
+            startProfiling(options?: { interval?: number, maxSamples?: number }): void;
+
+            /** 停止 CPU 采样, 返回 .cpuprofile 格式的对象 */
+            stopProfiling(options?: { format?: 'cpuprofile' }): CpuProfile | undefined;
+
+            /** 停止 CPU 采样, 返回折叠的调用栈文本 (用于生成火焰图) */
+            stopProfiling(options: { format: 'collapsed' }): string | undefined;
+
+            /** 内存使用情况, 包括各个类的对象数以及原生对象的数量和字节数 */
+            readonly memory: {
+                usedJSHeapSize: number;
+                totalJSHeapSize: number;
+                jsHeapSizeLimit: number;
+                classes: { id: number, name: string, count: number, size: number }[];
+                native: { [type: string]: { count: number, size: number } };
+                [key: string]: any;
+            };
+
+            /** 生成 .heapsnapshot 格式的堆快照, 返回快照文件名 */
+            heapSnapshot(filename?: string): Promise<string>;
+        }
+    }
 }
 
 /**
@@ -231,6 +292,7 @@ declare module '@tjs/event-target' {
         addEventListener(eventName: string, listener: Function, options: boolean | { capture?: boolean, passive?: boolean, once?: boolean }): void;
         removeEventListener(eventName: string, listener: Function, options: any): void;
         getEventListeners(eventName?: string): Map<string, any>;
+        hasEventListener(eventName: string): boolean;
         removeAllEventListeners(eventName?: string): void;
     }
 
@@ -239,6 +301,9 @@ declare module '@tjs/event-target' {
     global {
         interface EventTarget {
             getEventListeners(eventName?: string): Map<string, any>;
+
+            /** 是否注册了指定名称的事件的监听器，可以用来在没有监听器时跳过创建事件对象 */
+            hasEventListener(eventName: string): boolean;
             removeAllEventListeners(eventName?: string): void;
         }
     }
@@ -24,7 +24,31 @@ declare module '@tjs/native' {
          * @param size 读取的字节数，可选
          * @returns 读取的文件内容
          */
-        read(size?: number): Promise<ArrayBuffer>;
+        read(size?: number, position?: number): Promise<ArrayBuffer>;
+
+        /**
+         * 同步读取文件内容, 会阻塞事件循环
+         * @param size 读取的字节数
+         * @param position 读取的位置
+         * @returns 读取的文件内容
+         */
+        readSync(size?: number, position?: number): ArrayBuffer;
+
+        /**
+         * 读取文件内容到指定的缓存区, 在请求完成之前不要修改这个缓存区
+         * @param buffer 缓存区
+         * @param position 读取的位置，可选
+         * @returns 实际读取的字节数
+         */
+        readInto(buffer: ArrayBuffer | ArrayBufferView, position?: number): Promise<number>;
+
+        /**
+         * 依次读取文件内容到多个缓存区
+         * @param buffers 缓存区数组
+         * @param position 读取的位置，可选
+         * @returns 实际读取的字节数
+         */
+        readv(buffers: (ArrayBuffer | ArrayBufferView)[], position?: number): Promise<number>;
 
         /**
          * 写入文件内容
@@ -34,6 +58,22 @@ declare module '@tjs/native' {
          */
         write(data: string | ArrayBuffer, encoding?: string): Promise<void>;
 
+        /**
+         * 直接写入指定缓存区中的数据, 不会复制数据, 在请求完成之前不要修改这个缓存区
+         * @param buffer 缓存区
+         * @param position 写入的位置，可选
+         * @returns 实际写入的字节数
+         */
+        writeFrom(buffer: ArrayBuffer | ArrayBufferView, position?: number): Promise<number>;
+
+        /**
+         * 依次写入多个缓存区中的数据
+         * @param buffers 缓存区数组
+         * @param position 写入的位置，可选
+         * @returns 实际写入的字节数
+         */
+        writev(buffers: (ArrayBuffer | ArrayBufferView)[], position?: number): Promise<number>;
+
         /**
          * 关闭文件句柄
          * @returns 关闭操作的结果
@@ -89,6 +129,9 @@ declare module '@tjs/native' {
         // 标准输出的TTY对象
         readonly stdout: TTY;
 
+        // IPC 管道 (fd 3)，仅当 `SpawnOptions.ipc` 为 true 时有效
+        readonly ipc?: Pipe;
+
         /**
          * 发送一个信号给子进程
          * @param signal 信号，可以是数字或信号名
@@ -267,6 +310,11 @@ declare module '@tjs/native' {
          * 标准输出的处理方式，可以是 'inherit'（继承父进程的标准输出），'pipe'（通过管道连接到子进程的标准输出），或 'ignore'（忽略标准输出）。
          */
         stdout?: string;
+
+        /**
+         * 是否以 fd 3 创建一个 IPC 管道 (`ChildProcess.ipc`)，可以用来传递消息和句柄。
+         */
+        ipc?: boolean;
     }
 
 
@@ -460,6 +508,67 @@ declare module '@tjs/native' {
      */
     export function spawn(command: string | string[], options?: SpawnOptions): ChildProcess;
 
+    /**
+     * `exec()` 的选项, 标准输入总是 `/dev/null`, 标准输出和标准错误输出总是被收集
+     */
+    export interface ExecOptions {
+        env?: { [key: string]: any };
+        cwd?: string;
+        uid?: number;
+        gid?: number;
+
+        /** 默认为 `ignore` */
+        stdin?: 'ignore' | 'inherit';
+
+        /** 默认为 `pipe`, 只收集 `pipe` 的输出, 否则结果中没有 `stdout` */
+        stdout?: 'pipe' | 'ignore' | 'inherit';
+
+        /** 默认为 `pipe`, 只收集 `pipe` 的输出, 否则结果中没有 `stderr` */
+        stderr?: 'pipe' | 'ignore' | 'inherit';
+
+        /** stdout 和 stderr 各自最多保存的字节数, 超过后结束进程并设置 `truncated`, 默认为 1MB */
+        maxBuffer?: number;
+
+        /** 超时时间 (毫秒), 默认为 0 表示不限制 */
+        timeout?: number;
+
+        /** 超时或输出超过 maxBuffer 时发送的信号, 默认为 SIGTERM */
+        killSignal?: number;
+
+        /** 发送 killSignal 后还没有结束时, 再过这么长时间 (毫秒) 发送 SIGKILL, 默认为 2000 */
+        killTimeout?: number;
+
+        /** 为 true 时 stdout 和 stderr 返回按行分割后的字符串数组 */
+        lines?: boolean;
+    }
+
+    export interface ExecResult {
+        /** 退出代码 */
+        code: number;
+
+        /** 结束进程的信号 */
+        signal: number;
+
+        /** 输出, 设置了 `lines` 时为字符串数组 */
+        stdout?: string | string[];
+
+        /** 错误输出, 设置了 `lines` 时为字符串数组 */
+        stderr?: string | string[];
+
+        /** 执行超时, 并且进程是被超时后发送的信号结束的 */
+        timedOut?: boolean;
+
+        /** 输出超过了 maxBuffer */
+        truncated?: boolean;
+    }
+
+    /**
+     * 执行一个命令, 在本地缓存区中收集它的输出, 进程结束并且输出都读完后返回一个结果对象
+     * @param command 命令及参数
+     * @param options 
+     */
+    export function exec(command: string | string[], options?: ExecOptions): Promise<ExecResult>;
+
     /**
      * 将错误码转换为字符串描述
      * @param errno 错误码
@@ -574,6 +683,11 @@ declare module '@tjs/native' {
     export namespace errors {
         const UV_ENOENT: number;
         const UV_EACCES: number;
+        const UV_ENOTSUP: number;
+        const UV_ETIMEDOUT: number;
+        const UV_EAI_AGAIN: number;
+        const UV_EAI_NODATA: number;
+        const UV_EAI_NONAME: number;
     }
 
     /**
@@ -673,6 +787,61 @@ declare module '@tjs/native' {
      * 该接口提供了一系列文件系统操作的方法，包括访问权限检查、修改权限、修改所有者、复制文件、创建目录、创建临时文件、打开文件、读取目录、读取文件、读取链接、获取真实路径、重命名、删除目录、获取文件状态、获取文件系统状态、创建符号链接、删除文件、修改文件时间以及监视文件变化。
      */
     export namespace fs {
+        const UV_DIRENT_UNKNOWN: number;
+        const UV_DIRENT_FILE: number;
+        const UV_DIRENT_DIR: number;
+        const UV_DIRENT_LINK: number;
+
+        const MADV_NORMAL: number;
+        const MADV_RANDOM: number;
+        const MADV_SEQUENTIAL: number;
+        const MADV_WILLNEED: number;
+        const MADV_DONTNEED: number;
+
+        /**
+         * 将文件映射到内存, 返回的 ArrayBuffer 被回收时解除映射
+         * @param path 文件名
+         * @param options advice 为 `MADV_*`
+         */
+        function mmap(path: string, options?: { offset?: number, length?: number, readonly?: boolean, advice?: number }): ArrayBuffer;
+
+        /**
+         * 给内核提供映射内存的访问方式建议
+         * @param buffer mmap() 返回的 ArrayBuffer 或它的视图
+         * @param advice `MADV_*`
+         */
+        function madvise(buffer: ArrayBuffer | ArrayBufferView, advice: number): void;
+
+        interface WalkEntry extends Dir {
+            /** 完整路径 */
+            path: string;
+
+            /** 深度, 根目录下的目录项为 1 */
+            depth: number;
+
+            /** lstat 信息 */
+            stat?: any;
+        }
+
+        /** 目录树遍历器 */
+        interface Walker {
+            /**
+             * 读取下一批目录项, 遍历完成后返回空数组
+             * @param skip 不需要进入的子目录 (上一批返回的目录项的 path)
+             */
+            read(skip?: string[]): Promise<WalkEntry[]>;
+
+            /** 停止遍历 */
+            close(): void;
+        }
+
+        /**
+         * 创建一个目录树遍历器, 遍历在线程池中进行
+         * @param root 根目录
+         * @param options 
+         */
+        function walk(root: string, options?: { stat?: boolean, maxDepth?: number, batchSize?: number }): Walker;
+
         /**
          * 检查文件或目录的访问权限
          * @param path 文件或目录的路径
@@ -747,6 +916,33 @@ declare module '@tjs/native' {
          */
         function opendir(path: string): Promise<Dir[]>;
 
+        interface WriteFileOptions {
+            /** 先写入临时文件再重命名 (appendFile 忽略这个选项) */
+            atomic?: boolean;
+
+            /** 写入后同步到磁盘, 'group' 表示与同时进行的其他原子写入合并目录同步 */
+            fsync?: boolean | 'group';
+
+            /** 新建文件的权限 */
+            mode?: number;
+        }
+
+        /**
+         * 在一个工作项中完成打开, 写入, 同步和关闭
+         * @param path 文件的路径
+         * @param data 字符串按 UTF-8 编码写入
+         * @param options 
+         */
+        function writeFile(path: string, data: string | ArrayBuffer | ArrayBufferView, options?: WriteFileOptions): Promise<void>;
+
+        /**
+         * 追加数据到文件末尾
+         * @param path 文件的路径
+         * @param data 字符串按 UTF-8 编码写入
+         * @param options 
+         */
+        function appendFile(path: string, data: string | ArrayBuffer | ArrayBufferView, options?: WriteFileOptions): Promise<void>;
+
         /**
          * 读取文件内容
          * @param path 文件的路径
@@ -817,16 +1013,50 @@ declare module '@tjs/native' {
         /**
          * 修改文件的访问时间和修改时间
          * @param path 文件的路径
+         * @param atime 访问时间, 单位为秒
+         * @param mtime 修改时间, 单位为秒
          * @returns 一个 Promise，当时间修改成功时解析
          */
-        function utimes(path: string): Promise<void>;
+        function utimes(path: string, atime: number, mtime: number): Promise<void>;
+
+        interface WatchEvent {
+            /** 事件类型, `overflow` 表示有事件丢失 */
+            type: 'create' | 'modify' | 'attrib' | 'delete' | 'rename' | 'overflow';
+
+            /** 文件路径 (监视的路径 + 相对路径) */
+            path: string;
+
+            /** 重命名之前的路径, 只有 `rename` 事件才有 */
+            oldPath?: string;
+
+            /** 是否是目录 */
+            directory?: boolean;
+        }
+
+        interface WatchOptions {
+            /** 是否同时监视所有子目录 */
+            recursive?: boolean;
+
+            /** 合并事件的时间, 单位为毫秒, 默认为 50 */
+            delay?: number;
+        }
+
+        /** 文件系统监视器 */
+        interface Watcher {
+            /** 监视的路径 */
+            readonly path: string;
+
+            /** 停止监视 */
+            close(): void;
+        }
 
         /**
          * 监视文件或目录的变化
          * @param path 文件或目录的路径
-         * @returns 一个 Promise，当监视开始时解析
+         * @param options 
+         * @param callback 在 delay 毫秒内发生的事件会合并成一批回调
          */
-        function watch(path: string): Promise<void>;
+        function watch(path: string, options: WatchOptions, callback: (events: WatchEvent[]) => void): Watcher;
     }
 
     /** 操作系统 */
@@ -1012,6 +1242,11 @@ declare module '@tjs/native' {
          */
         const CODE_BASE64: number;
 
+        /**
+         * URL 安全的 Base64 编码格式, 不使用填充字符
+         */
+        const CODE_BASE64URL: number;
+
         /**
          * MD5 哈希算法
          */
@@ -1044,12 +1279,12 @@ declare module '@tjs/native' {
         function encode(data: BufferSource, format?: number): string;
 
         /**
-         * 对数据进行解码
+         * 对数据进行解码，忽略空白字符，包含无效的字符时抛出 TypeError
          * @param {string} data - 要解码的数据字符串
          * @param {number} format - 解码格式，可选
          * @returns {Uint8Array} 解码后的数据 Uint8Array
          */
-        function decode(data: string, format?: number): Uint8Array;
+        function decode(data: string | BufferSource, format?: number): Uint8Array;
 
         /**
          * 计算数据的哈希值
@@ -1066,12 +1301,18 @@ declare module '@tjs/native' {
      * 该命名空间提供了 UTF-8 编码和其他编码之间相互转换的方法
      */
     export namespace utf8 {
+        /** 遇到无效的字节序列时抛出 TypeError, 而不是替换为 U+FFFD */
+        const FATAL: number;
+
         /**
          * 将 BufferSource 转换为 UTF-8 编码的字符串
          * @param data - 要转换的数据，可以是 ArrayBuffer、TypedArray 或 DataView
+         * @param offset - 开始位置，可选
+         * @param length - 长度，可选
+         * @param flags - `FATAL`，可选
          * @returns 转换后的 UTF-8 字符串
          */
-        function decode(data: BufferSource): string;
+        function decode(data: BufferSource, offset?: number, length?: number, flags?: number): string;
 
         /**
          * 将 UTF-8 编码的字符串转换为 Uint8Array
@@ -1079,6 +1320,97 @@ declare module '@tjs/native' {
          * @returns 转换后的 Uint8Array
          */
         function encode(data: string): Uint8Array;
+
+        /**
+         * 将字符串编码到指定的缓冲区中，不会写入不完整的字符
+         * @returns 读取的 UTF-16 单元数和写入的字节数
+         */
+        function encodeInto(source: string, destination: Uint8Array): { read: number, written: number };
+
+        /**
+         * 直接从 UTF-8 编码的数据解析 JSON, 会跳过 BOM, 无效的字节序列被替换为 U+FFFD
+         * @param data UTF-8 编码的 JSON 文本
+         * @param reviver 同 `JSON.parse` 的 reviver 参数
+         */
+        function parseJSON(data: BufferSource, reviver?: (this: any, key: string, value: any) => any): any;
+
+        /**
+         * 检查是否是有效的 UTF-8 数据
+         * @returns 第一个无效字节序列的位置，全部有效时返回 -1
+         */
+        function validate(data: BufferSource): number;
+    }
+
+    /**
+     * 异步日志缓冲区
+     * 日志写入固定大小的环形缓冲区后由后台线程批量输出，缓冲区满时丢弃并计数
+     */
+    export namespace logger {
+        const SINK_STDERR: number;
+        const SINK_STDOUT: number;
+        const SINK_FILE: number;
+        const SINK_SYSLOG: number;
+
+        /** 原样打印到控制台, notice 及以上级别打印到 stderr */
+        const SINK_CONSOLE: number;
+
+        interface LoggerOptions {
+            /** 输出的最大 syslog 日志级别 */
+            level?: number;
+
+            /** 输出目标, `SINK_*` 的组合 */
+            sinks?: number;
+
+            /** 缓冲区最多可缓存的日志条数 */
+            capacity?: number;
+
+            /** 缓冲区最多可缓存的字节数 */
+            maxBytes?: number;
+
+            /** 日志文件名 */
+            filename?: string;
+
+            /** syslog 进程名 */
+            ident?: string;
+        }
+
+        interface LoggerStats {
+            written: number;
+            dropped: number;
+            filtered: number;
+            pending: number;
+            capacity: number;
+            started: boolean;
+        }
+
+        /**
+         * 检查指定级别的日志是否会被输出，不会输出时计入过滤或丢弃计数
+         * @param level syslog 日志级别
+         */
+        function accept(level: number): boolean;
+
+        /**
+         * 写入一条日志，返回是否被缓存
+         * @param level syslog 日志级别
+         * @param message 日志消息
+         * @param echo 输出到 `SINK_CONSOLE` 的文本, 默认为 message
+         */
+        function write(level: number, message: string, echo?: string): boolean;
+
+        /** 启动或重新配置后台日志线程 */
+        function open(options?: LoggerOptions): void;
+
+        /** 输出所有缓存的日志并停止后台线程 */
+        function close(): void;
+
+        /** 等待缓存的日志都输出完成 */
+        function flush(): void;
+
+        /** 设置输出的最大日志级别 */
+        function setLevel(level: number): void;
+
+        /** 返回统计信息 */
+        function stats(): LoggerStats;
     }
 
     /**
@@ -1168,6 +1500,73 @@ declare module '@tjs/native' {
          * @returns 解析后的地址信息数组
          */
         function getaddrinfo(node: string, options: GetaddrinfoOptions): Promise<AddressInfo[]>;
+
+        /** DNS 客户端选项 */
+        interface ResolverOptions {
+            /** 服务器地址列表, 如 `['127.0.0.1:5353', '[::1]:53']`, 默认为 resolv.conf 中的 `nameserver` */
+            servers?: string[];
+
+            /** 每次查询的超时时间 (毫秒), 默认为 resolv.conf 中的 `options timeout:n` 或 5000 */
+            timeout?: number;
+
+            /** 每个服务器的尝试次数, 默认为 resolv.conf 中的 `options attempts:n` 或 2 */
+            attempts?: number;
+
+            /** resolv.conf 文件路径, 默认为 `/etc/resolv.conf` */
+            resolvConf?: string;
+
+            /** hosts 文件路径, 默认为 `/etc/hosts`, 为空字符串时不使用 hosts 文件 */
+            hosts?: string;
+        }
+
+        /** 一条应答记录, A/AAAA 记录包含 address, SRV 记录包含 priority, weight, port 和 name */
+        interface ResolverAnswer {
+            type: number;
+            ttl: number;
+            address?: string;
+            priority?: number;
+            weight?: number;
+            port?: number;
+            name?: string;
+        }
+
+        interface ResolverResult {
+            /** 应答码, 0 表示成功, 3 表示域名不存在 */
+            rcode: number;
+
+            /** 所有应答记录中最小的 TTL (秒), 没有应答记录时为 SOA 记录中的否定应答缓存时间 */
+            ttl: number;
+
+            /** 应答被截断 */
+            truncated?: boolean;
+
+            answers: ResolverAnswer[];
+        }
+
+        /**
+         * 运行在事件循环中的 DNS 客户端 (UDP), 不占用线程池
+         */
+        class Resolver {
+            static readonly A: number;
+            static readonly AAAA: number;
+            static readonly SRV: number;
+
+            constructor(options?: ResolverOptions);
+
+            /**
+             * 查询指定域名的记录, 同时进行的相同查询只发送一次
+             * 超时或所有服务器都出错时 reject
+             * @param name 域名
+             * @param type 记录类型, 默认为 `Resolver.A`
+             */
+            query(name: string, type?: number): Promise<ResolverResult>;
+
+            /** 使用的服务器地址列表 */
+            servers(): { family: number, address: string, port: number }[];
+
+            /** 取消所有正在进行的查询并关闭 */
+            close(): void;
+        }
     }
 
     /**
@@ -1454,6 +1853,87 @@ declare module '@tjs/native' {
              */
             onheadervalue?(value: string): void;
         }
+
+        /**
+         * 原生 HTTP 服务器选项
+         */
+        interface ServerOptions {
+            /** 空闲连接超时时间 (毫秒)，默认 60000 */
+            keepAliveTimeout?: number;
+
+            /** 允许的最大请求消息体长度 (字节)，默认 8MB */
+            maxBodySize?: number;
+
+            /** 每个连接最多允许多少个未应答的请求 (pipelining)，默认 32 */
+            maxPipeline?: number;
+        }
+
+        /**
+         * 原生 HTTP 服务器统计信息
+         */
+        interface ServerStats {
+            /** 当前连接数 */
+            connections: number;
+
+            /** 累计连接数 */
+            totalConnections: number;
+
+            /** 累计请求数 */
+            totalRequests: number;
+        }
+
+        /**
+         * 原生 HTTP 服务器收到的请求
+         */
+        interface ServerRequest extends Message {
+            /** 请求消息体 */
+            body?: ArrayBuffer;
+
+            /** 是否保持连接 */
+            keepAlive: boolean;
+
+            /**
+             * 应答这个请求，每个请求只能应答一次
+             * @param status 状态码
+             * @param headers 消息头
+             * @param body 消息体
+             * @param statusText 状态文本
+             * @returns 如果连接已关闭则返回 false
+             */
+            respond(status: number, headers?: [string, string][] | { [key: string]: string },
+                body?: BufferSource | string | (BufferSource | string)[], statusText?: string): boolean;
+        }
+
+        /**
+         * 原生 HTTP/1.1 服务器
+         * - 在原生层完成连接管理, 请求解析, keep-alive, pipelining 和应答序列化
+         */
+        class Server {
+            constructor(options?: ServerOptions);
+
+            /** 侦听的地址 */
+            address(): SocketAddress;
+
+            /**
+             * 关闭服务器
+             * @param force 是否立即关闭所有连接，否则等待正在处理的请求完成
+             */
+            close(force?: boolean): void;
+
+            /**
+             * 开始侦听
+             * @param address 要绑定的地址，也可以是一个已绑定的 TCP 句柄
+             * @param backlog 
+             * @param flags 同 `TCP.bind()`，如 `TCP.REUSEPORT`
+             */
+            listen(address: SocketAddress | TCP, backlog?: number, flags?: number): void;
+
+            /** 统计信息 */
+            stats(): ServerStats;
+
+            onerror?(error: Error): void;
+            onrequest?(request: ServerRequest): void;
+        }
     }
 
 
@@ -1518,8 +1998,49 @@ declare module '@tjs/native' {
         function hmac(algorithm: DigestAlgorithm, data: Data, secret: Data): ArrayBuffer;
     }
 
+    /** JSON 增量序列化和解析 */
+    export namespace json {
+        /** 默认的分块大小 (字节) */
+        const CHUNK_SIZE: number;
+
+        /** 增量序列化器 */
+        class Writer {
+            /**
+             * @param value 要序列化的值
+             * @param space 缩进, 同 JSON.stringify
+             * @param chunkSize 每个分块的大致大小 (字节)
+             */
+            constructor(value: any, space?: number | string, chunkSize?: number);
+
+            /** 释放相关的资源 */
+            close(): void;
+
+            /**
+             * 读取下一个分块
+             * @returns 已经全部输出时返回 undefined
+             */
+            read(): Uint8Array | undefined;
+        }
+
+        /** 顶层数组的增量解析器 */
+        class Parser {
+            /**
+             * @param maxLength 单个记录的最大长度 (字节), 0 表示不限制
+             */
+            constructor(maxLength?: number);
+
+            /** 结束解析并重置, 返回剩余的记录 */
+            end(): any[];
+
+            /** 写入一块数据, 返回完成的记录 */
+            write(data: BufferSource): any[];
+        }
+    }
+
     /** MQTT 协议 */
     export namespace mqtt {
+        /** AUTH 消息类型 (MQTT 5) */
+        const AUTH: number;
         /** CONNACK 消息类型 */
         const CONNACK: number;
         /** CONNECT 消息类型 */
@@ -1557,6 +2078,44 @@ declare module '@tjs/native' {
             type: number;
             /** 消息长度 */
             length: number;
+            /** 原因码 (MQTT 5) */
+            reasonCode?: number;
+            /** 属性 (MQTT 5) */
+            properties?: Properties;
+        }
+
+        /**
+         * MQTT 5 属性, 编码时值为 undefined 的属性会被忽略
+         */
+        interface Properties {
+            payloadFormatIndicator?: number;
+            messageExpiryInterval?: number;
+            contentType?: string;
+            responseTopic?: string;
+            correlationData?: string | ArrayBuffer | ArrayBufferView;
+            subscriptionIdentifier?: number;
+            sessionExpiryInterval?: number;
+            assignedClientIdentifier?: string;
+            serverKeepAlive?: number;
+            authenticationMethod?: string;
+            authenticationData?: string | ArrayBuffer | ArrayBufferView;
+            requestProblemInformation?: number;
+            willDelayInterval?: number;
+            requestResponseInformation?: number;
+            responseInformation?: string;
+            serverReference?: string;
+            reasonString?: string;
+            receiveMaximum?: number;
+            topicAliasMaximum?: number;
+            topicAlias?: number;
+            maximumQoS?: number;
+            retainAvailable?: number;
+            /** 用户属性 */
+            userProperties?: { [name: string]: string };
+            maximumPacketSize?: number;
+            wildcardSubscriptionAvailable?: number;
+            subscriptionIdentifiersAvailable?: number;
+            sharedSubscriptionAvailable?: number;
         }
 
         /**
@@ -1573,6 +2132,10 @@ declare module '@tjs/native' {
             keepalive?: number;
             /** 是否清除会话，可选 */
             clean?: boolean;
+            /** 协议版本, 4 (MQTT 3.1.1, 默认) 或 5 (MQTT 5) */
+            protocolVersion?: number;
+            /** CONNECT 消息的属性 (MQTT 5) */
+            properties?: Properties;
         }
 
         /**
@@ -1584,9 +2147,11 @@ declare module '@tjs/native' {
 
         /**
          * 编码断开连接消息
+         * @param reasonCode - 原因码, 指定后编码为 MQTT 5 消息
+         * @param properties - 属性 (MQTT 5)
          * @returns {ArrayBuffer} 返回编码后的断开连接消息
          */
-        function encodeDisconnect(): ArrayBuffer;
+        function encodeDisconnect(reasonCode?: number, properties?: Properties): ArrayBuffer;
 
         /**
          * 编码 Ping 请求消息
@@ -1602,27 +2167,31 @@ declare module '@tjs/native' {
          * @param qos - 服务质量
          * @param retained - 保留标志
          * @param pid - 消息 ID
+         * @param properties - 属性, 指定后编码为 MQTT 5 消息, 使用主题别名时 topic 可以为空字符串
          * @returns {ArrayBuffer} 返回编码后的发布消息
          */
-        function encodePublish(topic: string, payload: any, dup: number, qos: number, retained: number, pid: number): ArrayBuffer;
+        function encodePublish(topic: string, payload: any, dup: number, qos: number, retained: number, pid: number, properties?: Properties): ArrayBuffer;
 
         /**
          * 编码订阅消息
          * @param topic - 主题
          * @param dup - 重复标志
          * @param pid - 消息 ID
+         * @param properties - 属性, 指定后编码为 MQTT 5 消息
+         * @param options - 订阅选项 (MQTT 5), 包括 QoS 等, 默认为 0
          * @returns {ArrayBuffer} 返回编码后的订阅消息
          */
-        function encodeSubscribe(topic: string, dup: number, pid: number): ArrayBuffer;
+        function encodeSubscribe(topic: string, dup: number, pid: number, properties?: Properties, options?: number): ArrayBuffer;
 
         /**
          * 编码取消订阅消息
          * @param topic - 主题
          * @param dup - 重复标志
          * @param pid - 消息 ID
+         * @param properties - 属性, 指定后编码为 MQTT 5 消息
          * @returns {ArrayBuffer} 返回编码后的取消订阅消息
          */
-        function encodeUnsubscribe(topic: string, dup: number, pid: number): ArrayBuffer;
+        function encodeUnsubscribe(topic: string, dup: number, pid: number, properties?: Properties): ArrayBuffer;
 
         /**
          * MQTT 协议数据格式解析器
@@ -1630,6 +2199,11 @@ declare module '@tjs/native' {
          * 对原始数据流进行解析，解析后得到相应的 MQTT 消息对象
          */
         class Parser {
+            /**
+             * @param options.protocolVersion 协议版本, 4 (MQTT 3.1.1, 默认) 或 5 (MQTT 5)
+             */
+            constructor(options?: { protocolVersion?: number });
+
             /**
              * 内部缓存区容量
              */
@@ -1662,6 +2236,147 @@ declare module '@tjs/native' {
              */
             onmessage?(message: MQTTMessage): void;
         }
+
+        /**
+         * 消息 ID 分配器, 跳过还在使用中的 ID
+         */
+        class PacketIds {
+            /**
+             * 分配一个没有使用的 ID
+             * @returns 1 ~ 65535, 全部都在使用中时返回 0
+             */
+            alloc(): number;
+
+            /** 指定的 ID 是否在使用中 */
+            has(id: number): boolean;
+
+            /**
+             * 释放指定的 ID
+             * @returns 这个 ID 之前是否在使用中
+             */
+            release(id: number): boolean;
+
+            /** 释放所有的 ID */
+            reset(): void;
+
+            /** 使用中的 ID 数量 */
+            size(): number;
+        }
+
+        /**
+         * 合并写入: 多个消息直接编码到同一个缓存区中, 一次发送
+         */
+        class Writer {
+            /** 缓存区中的消息数 */
+            count(): number;
+
+            /**
+             * 取出所有等待发送的数据, 没有数据时返回 undefined
+             */
+            flush(): ArrayBuffer | undefined;
+
+            /**
+             * 直接编码一个发布消息到缓存区中
+             * @param properties 属性, 指定后编码为 MQTT 5 消息
+             * @returns 消息的字节数
+             */
+            publish(topic: string, payload: any, dup: number, qos: number, retained: number, pid: number, properties?: Properties): number;
+
+            /** 丢弃所有等待发送的数据 */
+            reset(): void;
+
+            /** 缓存区中的字节数 */
+            size(): number;
+
+            /**
+             * 添加一个已编码的消息
+             * @returns 消息的字节数
+             */
+            write(packet: ArrayBuffer | ArrayBufferView): number;
+        }
+
+        interface BrokerOptions {
+            /** 等待 CONNECT 消息的超时时间 (毫秒), 默认为 10000 */
+            connectTimeout?: number;
+
+            /** 最大消息长度, 默认为 1MB */
+            maxPacketSize?: number;
+
+            /** 每个连接最多排队等待发送的字节数, 超过后丢弃发给这个连接的 QoS 0 消息, 默认为 4MB */
+            maxQueueSize?: number;
+        }
+
+        interface BrokerStats {
+            connections: number;
+            subscriptions: number;
+            retained: number;
+            totalConnections: number;
+            messagesReceived: number;
+            messagesSent: number;
+            messagesDropped: number;
+        }
+
+        /**
+         * 原生 MQTT 服务器, 支持 QoS 0/1, 保留消息和遗嘱消息, 只支持 clean session
+         */
+        class Broker {
+            constructor(options?: BrokerOptions);
+
+            /** 所有侦听的地址, Unix 域套接字为路径 */
+            addresses(): (SocketAddress | string)[];
+
+            /** 停止侦听并关闭所有连接 */
+            close(): void;
+
+            /**
+             * 开始侦听, 可以多次调用
+             * @param address TCP 地址或 Unix 域套接字的路径
+             * @param flags 同 `TCP.bind()`
+             */
+            listen(address: SocketAddress | { address: string, port: number } | string, backlog?: number, flags?: number): void;
+
+            /**
+             * 直接发布一个消息
+             * @returns 发送的订阅者数量
+             */
+            publish(topic: string, payload: string | ArrayBuffer | ArrayBufferView, qos?: number, retained?: boolean): number;
+
+            stats(): BrokerStats;
+
+            onerror?: (error: Error) => void;
+        }
+    }
+
+    /** CPU 采样分析器 */
+    export namespace profiler {
+        /** 默认的采样间隔 (微秒) */
+        const INTERVAL: number;
+
+        /** 是否正在采样 */
+        function isProfiling(): boolean;
+
+        /**
+         * 开始采样, 已经开始时抛出异常
+         * @param interval 采样间隔 (微秒), 0 表示使用默认值
+         * @param maxSamples 最多保留的采样数, 0 表示使用默认值
+         */
+        function start(interval?: number, maxSamples?: number): void;
+
+        /** 停止采样, 返回 .cpuprofile 格式的对象, 没有开始时返回 undefined */
+        function stop(): any;
+    }
+
+    /** 堆统计和快照 */
+    export namespace heap {
+        /** 返回 JS 堆, 各个类以及原生对象的内存使用情况 */
+        function getStatistics(): any;
+
+        /**
+         * 执行一次 GC 并生成 .heapsnapshot 格式的堆快照
+         * @param filename 文件名, 默认为 Heap.<date>.<time>.<pid>.heapsnapshot
+         * @returns 快照文件名
+         */
+        function writeSnapshot(filename?: string): Promise<string>;
     }
 
     /** 串口 */
@@ -1969,6 +2684,9 @@ declare module '@tjs/native' {
      * TCP 类，继承自 Socket 类，用于处理传输控制协议通信
      */
     export class TCP extends Socket {
+        /** `bind()` 标记: 设置 SO_REUSEPORT，允许多个进程或线程侦听同一个端口 */
+        static readonly REUSEPORT: number;
+
         /**
          * 获取 TCP 连接的唯一标识符
          * @returns {number} 返回连接的唯一标识符
@@ -1998,6 +2716,11 @@ declare module '@tjs/native' {
      * Pipe 类，继承自 Stream 类，用于处理管道通信
      */
     export class Pipe extends Stream {
+        /**
+         * @param ipc 是否是 IPC 管道，IPC 管道可以用来在进程间传递句柄
+         */
+        constructor(ipc?: boolean);
+
         /**
          * 获取本地地址信息
          * @returns {string} 返回本地地址信息
@@ -2023,10 +2746,22 @@ declare module '@tjs/native' {
         remoteAddress(): string;
 
         /**
-         * 接受一个传入的连接
+         * 接受一个传入的连接，对于 IPC 管道则是接收对方传递过来的句柄
          * @returns {Pipe} 返回接受的 Pipe 连接
          */
-        accept(): Pipe;
+        accept(): Pipe | TCP;
+
+        /**
+         * 返回 IPC 管道中等待接收的句柄的数量
+         */
+        pendingCount(): number;
+
+        /**
+         * 通过 IPC 管道发送数据以及一个 TCP 句柄
+         * @param data 要发送的数据
+         * @param handle 要传递的句柄
+         */
+        write2(data: string | ArrayBuffer | ArrayBufferView, handle: TCP): Promise<void>;
 
         /**
          * 绑定管道到指定地址
@@ -2141,6 +2876,9 @@ declare module '@tjs/native' {
      * UDP 类，继承自 Stream 类，用于处理用户数据报协议通信
      */
     export class UDP extends Stream {
+        /** `bind()` 标记: 设置 SO_REUSEPORT，允许多个进程或线程绑定同一个端口 */
+        static readonly REUSEPORT: number;
+
         /**
          * 获取本地地址信息
          * @returns {SocketAddress} 返回本地地址信息
@@ -2255,10 +2993,10 @@ declare module '@tjs/native' {
         constructor(filename: string);
 
         /**
-         * 向工作线程发送消息
-         * @param args - 要发送的消息参数
+         * 向工作线程发送消息, SharedArrayBuffer 只传递引用
+         * @param message - 要发送的消息
          */
-        postMessage(args: any[]): void;
+        postMessage(message: any): void;
 
         /**
          * 终止工作线程
@@ -2283,6 +3021,12 @@ declare module '@tjs/native' {
         onerror(error?: any): void;
     }
 
+    /**
+     * Atomics.waitAsync 的实现
+     * @returns 不需要等待时返回 'not-equal' 或 'timed-out', 否则返回 Promise
+     */
+    export function waitAsync(typedArray: Int32Array | BigInt64Array, index: number, value: number | bigint, timeout?: number): string | Promise<string>;
+
 
     /**
      * 串口设备
@@ -2396,6 +3140,16 @@ declare module '@tjs/native' {
          */
         function compress(data: BufferSource): ArrayBuffer;
 
+        /**
+         * 计算 CRC32 校验值
+         * @param data - 数据
+         * @param crc - 上一次计算的结果, 用于分段计算
+         * @param offset - 开始位置, 可选
+         * @param length - 长度, 可选
+         * @returns {number} 返回 CRC32 校验值
+         */
+        function crc32(data: BufferSource, crc?: number, offset?: number, length?: number): number;
+
         /**
          * 数据解压
          * @param data - 要解压的数据
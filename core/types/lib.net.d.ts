@@ -55,6 +55,40 @@ declare module '@tjs/dns' {
      */
     export function lookup(hostname: string, options?: number | LookupOptions): Promise<AddressInfo>
     export function lookup(hostname: string, options: { all: true }): Promise<AddressInfo[]>
+
+    export interface ConfigureOptions {
+        /** 是否缓存解析结果, 默认为 true */
+        cache?: boolean;
+
+        /** getaddrinfo 结果的缓存时间 (秒), 默认为 30 */
+        ttl?: number;
+
+        /** 域名不存在且没有 SOA 记录时的缓存时间 (秒), 默认为 5 */
+        negativeTtl?: number;
+
+        /** 最长的缓存时间 (秒), 默认为 3600 */
+        maxTtl?: number;
+
+        /** `lookup()` 是否使用内置的 DNS 客户端 (而不是系统的 getaddrinfo), 或者内置 DNS 客户端的选项 */
+        resolver?: boolean | import('@tjs/native').dns.ResolverOptions;
+    }
+
+    /** 修改 DNS 缓存和解析方式 */
+    export function configure(options: ConfigureOptions): void;
+
+    /** 清除缓存的解析结果 */
+    export function clearCache(): void;
+
+    /** 查询 IPv4 地址 (A 记录) */
+    export function resolve4(hostname: string): Promise<string[]>;
+    export function resolve4(hostname: string, options: { ttl: true }): Promise<{ address: string, ttl: number }[]>;
+
+    /** 查询 IPv6 地址 (AAAA 记录) */
+    export function resolve6(hostname: string): Promise<string[]>;
+    export function resolve6(hostname: string, options: { ttl: true }): Promise<{ address: string, ttl: number }[]>;
+
+    /** 查询服务记录 (SRV 记录) */
+    export function resolveSrv(hostname: string): Promise<{ priority: number, weight: number, port: number, name: string }[]>;
 }
 
 /**
@@ -120,6 +154,14 @@ declare module '@tjs/fetch' {
     export function getManager(): FetchManager;
 }
 
+interface Body {
+    /**
+     * 逐个读取消息体中顶层 JSON 数组的记录, 消息体是流时边接收边解析
+     * @param options.maxLength 单个记录的最大长度 (字节)
+     */
+    jsonRecords(options?: { maxLength?: number }): AsyncGenerator<any, void, unknown>;
+}
+
 /**
  * HTTP 服务端
  */
@@ -207,6 +249,13 @@ declare module '@tjs/http' {
         /** The status message corresponding to the status code. (e.g., OK for 200). */
         readonly statusText: string;
 
+        /**
+         * 以分块传输编码发送 JSON 数据, 增量序列化, 不会生成整个 JSON 字符串
+         * @param value 
+         * @param options 
+         */
+        json(value: any, options?: { space?: number | string, chunkSize?: number }): Promise<void>;
+
         /**
          * 重定向
          * @param status 
@@ -216,9 +265,9 @@ declare module '@tjs/http' {
 
         /**
          * 发送这个应答
-         * @param data 
+         * @param data 是流时以分块传输编码发送
          */
-        send(data: object | string | ArrayBuffer | ArrayBufferView): Promise<any>;
+        send(data: object | string | ArrayBuffer | ArrayBufferView | ReadableStream<Uint8Array>): Promise<any>;
 
         /**
          * 设置状态码和消息
@@ -261,6 +310,24 @@ declare module '@tjs/http' {
         host?: string;
 
         backlog?: number;
+
+        /** 是否设置 SO_REUSEPORT，允许多个进程侦听同一个端口 */
+        reusePort?: boolean;
+
+        /** 已绑定的 TCP 句柄，比如 `cluster.bind()` 返回的句柄 */
+        handle?: import('@tjs/native').TCP;
+
+        /** 是否使用原生 HTTP 服务器 */
+        native?: boolean;
+
+        /** 空闲连接超时时间 (毫秒)，仅原生服务器 */
+        keepAliveTimeout?: number;
+
+        /** 最大请求消息体长度 (字节)，仅原生服务器 */
+        maxBodySize?: number;
+
+        /** 每个连接最多未应答的请求数，仅原生服务器 */
+        maxPipeline?: number;
     }
 
     /**
@@ -296,6 +363,69 @@ declare module '@tjs/http' {
     export function createServer(options: ServerOptions, requestListener: RequestListener): Server;
 }
 
+/**
+ * 多进程共享侦听端口
+ *
+ * 主进程通过 `fork()` 创建多个工作进程, 每个工作进程通过 `bind()` 绑定同一个端口,
+ * 优先使用 SO_REUSEPORT, 不支持时由主进程通过 IPC 管道传递共享的侦听句柄
+ */
+declare module '@tjs/cluster' {
+    import * as native from '@tjs/native';
+
+    /** 当前是否是工作进程 */
+    export const isWorker: boolean;
+
+    /** 当前是否是主进程 */
+    export const isPrimary: boolean;
+
+    /** 当前工作进程的 ID，主进程为 0 */
+    export const workerId: number;
+
+    export const SCHED_REUSEPORT: string;
+    export const SCHED_SHARED: string;
+
+    /** 共享侦听端口的方式，默认为 `SCHED_REUSEPORT` */
+    export const settings: { schedulingPolicy: string };
+
+    /** 主进程创建的所有工作进程 */
+    export const workers: Map<number, Worker>;
+
+    /**
+     * 代表一个工作进程 (在主进程中)
+     */
+    export class Worker extends EventTarget {
+        readonly id: number;
+        readonly pid: number;
+        readonly process: native.ChildProcess;
+
+        /** 当工作进程退出时解析 */
+        readonly exited: Promise<native.ProcessResult>;
+
+        kill(signal?: number): void;
+        send(message: any): Promise<boolean>;
+
+        onexit?(event: CustomEvent): void;
+        onmessage?(event: MessageEvent): void;
+    }
+
+    /**
+     * 创建一个工作进程，默认以相同的参数运行当前的脚本
+     */
+    export function fork(options?: { args?: string[], env?: { [key: string]: string } }): Worker;
+
+    /**
+     * 绑定一个可以在多个工作进程之间共享的 TCP 端口
+     * @returns 已绑定但还未侦听的句柄，可以传给 `net.Server.listen()` 或 `http.createServer({ handle })`
+     */
+    export function bind(address: native.SocketAddress): Promise<native.TCP>;
+
+    /** 发送消息给主进程 (在工作进程中) */
+    export function send(message: any): Promise<boolean> | undefined;
+
+    /** 接收主进程发来的消息 (在工作进程中) */
+    export function onmessage(listener: (message: any) => void): void;
+}
+
 /**
  * JSON-RPC 2.0 client and server
  * 
@@ -560,6 +690,8 @@ declare module '@tjs/jsonrpc' {
  * A library for the MQTT protocol
  */
 declare module '@tjs/mqtt' {
+    import * as native from '@tjs/native';
+
     /**
      * 客户端选项
      */
@@ -583,6 +715,9 @@ declare module '@tjs/mqtt' {
 
         host?: string;
 
+        /** Unix 域套接字的路径, 指定后不再使用 host 和 port */
+        path?: string;
+
         username?: string;
 
         password?: string;
@@ -590,6 +725,53 @@ declare module '@tjs/mqtt' {
         secure?: boolean;
 
         reschedulePings?: boolean;
+
+        /** 最多同时等待确认的 QoS 1/2 消息数, 默认为 16 */
+        maxInflight?: number;
+
+        /** 指定后断网时的消息缓存到磁盘队列中, 否则缓存在内存中 (最多 100 个) */
+        queue?: MQTTQueueOptions;
+
+        /** 协议版本, 4 (MQTT 3.1.1, 默认) 或 5 (MQTT 5) */
+        protocolVersion?: number;
+
+        /** 会话过期时间 (秒, MQTT 5) */
+        sessionExpiryInterval?: number;
+
+        /** 客户端同时处理的 QoS 1/2 消息数 (MQTT 5) */
+        receiveMaximum?: number;
+
+        /** 允许服务端使用的主题别名数 (MQTT 5), 默认为 0 */
+        topicAliasMaximum?: number;
+
+        /** 是否自动为发布的主题分配别名 (MQTT 5), 默认为 true */
+        topicAlias?: boolean;
+
+        /** CONNECT 消息的其他属性 (MQTT 5) */
+        properties?: native.mqtt.Properties;
+    }
+
+    /**
+     * 磁盘消息队列选项
+     */
+    export interface MQTTQueueOptions {
+        /** 队列目录 */
+        path: string;
+
+        /** 单个段文件的大小, 默认为 1MB */
+        segmentSize?: number;
+
+        /** 所有段文件的最大总大小, 超过后丢弃最早的段, 默认为 64MB */
+        maxBytes?: number;
+
+        /** 合并写入的间隔 (毫秒), 默认为 100 */
+        flushInterval?: number;
+
+        /** 每次写入后是否同步到磁盘, 默认为 true */
+        fsync?: boolean;
+
+        /** 重连后重发的速度 (消息数/秒), 默认为 1000 */
+        replayRate?: number;
     }
 
     /**
@@ -597,7 +779,11 @@ declare module '@tjs/mqtt' {
      */
     export interface MQTTPublishOptions {
         topic?: string,
-        qos?: number
+        qos?: number,
+        retained?: number | boolean,
+
+        /** PUBLISH 消息的属性 (MQTT 5), 主题别名由客户端自动分配 */
+        properties?: native.mqtt.Properties
     }
 
     /**
@@ -619,18 +805,54 @@ declare module '@tjs/mqtt' {
      */
     export interface MQTTStore {
         /** 清除所有缓存的消息 */
-        clear(): void;
+        clear(): void | Promise<void>;
+
+        /** 关闭并释放相关的资源 */
+        close(): Promise<void>;
 
-        /** 弹出一个缓存的消息 */
-        pop(): MQTTRequest | undefined;
+        /** 删除最后一次 read() 返回的消息 */
+        commit(): Promise<void>;
 
         /** 缓存指定的消息 */
         put(packet: MQTTRequest): void;
 
+        /** 读取最早缓存的几个消息, 调用 commit() 后才会删除 */
+        read(max: number): Promise<MQTTRequest[]>;
+
         /** 返回缓存的消息数量 */
         size(): number;
     }
 
+    /**
+     * 基于磁盘文件的消息队列, 消息保存在带校验的段文件中, 重启后可以继续发送
+     */
+    export class MQTTDiskStore implements MQTTStore {
+        constructor(options: MQTTQueueOptions);
+
+        /** 段文件的总大小 */
+        readonly byteLength: number;
+
+        /** 因超过 maxBytes 而被丢弃的消息数 */
+        readonly dropped: number;
+
+        /** 队列目录 */
+        readonly path: string;
+
+        clear(): Promise<void>;
+        close(): Promise<void>;
+        commit(): Promise<void>;
+
+        /** 写入所有等待中的消息 */
+        flush(): Promise<void>;
+
+        /** 打开队列目录, 检查并修复所有的段文件 */
+        open(): Promise<void>;
+
+        put(packet: MQTTRequest): void;
+        read(max: number): Promise<MQTTRequest[]>;
+        size(): number;
+    }
+
     /**
      * The MQTTClient class wraps a client connection to an MQTT broker over an arbitrary transport method 
      */
@@ -674,6 +896,11 @@ declare module '@tjs/mqtt' {
          */
         close(): Promise<void>;
 
+        /**
+         * 开始合并写入, 之后发送的消息会保存在发送缓存区中, 直到调用 uncork() 才一起发送
+         */
+        cork(): void;
+
         /**
          * 统计信息
          */
@@ -715,6 +942,11 @@ declare module '@tjs/mqtt' {
          */
         unsubscribe(topic: string, options?: MQTTSubscribeOptions): Promise<any>;
 
+        /**
+         * 结束合并写入, 并一次发送缓存区中所有的消息
+         */
+        uncork(): Promise<void>;
+
         /** Emitted after a disconnection. */
         onclose?(event: Event): void;
 
@@ -756,6 +988,81 @@ declare module '@tjs/mqtt' {
         onpacketreceive?(event: Event): void;
     }
 
+    /**
+     * 内嵌 MQTT 服务器选项
+     */
+    export interface MQTTBrokerOptions {
+        /** 等待 CONNECT 消息的超时时间 (毫秒), 默认为 10000 */
+        connectTimeout?: number;
+
+        /** 最大消息长度, 默认为 1MB */
+        maxPacketSize?: number;
+
+        /** 每个连接最多排队等待发送的字节数, 超过后丢弃发给这个连接的 QoS 0 消息, 默认为 4MB */
+        maxQueueSize?: number;
+    }
+
+    export interface MQTTBrokerListenOptions {
+        /** Unix 域套接字的路径 */
+        path?: string;
+
+        /** 默认为 0.0.0.0 */
+        host?: string;
+
+        /** 默认为 1883 */
+        port?: number;
+
+        backlog?: number;
+
+        reusePort?: boolean;
+    }
+
+    /**
+     * 内嵌的 MQTT 服务器, 用于本机进程之间交换消息
+     * - 支持 QoS 0/1, 保留消息和遗嘱消息, 只支持 clean session
+     * - 同一个消息只编码一次, 所有订阅者共享同一个缓存区
+     */
+    export class MQTTBroker extends EventTarget {
+        constructor(options?: MQTTBrokerOptions);
+
+        options: MQTTBrokerOptions;
+
+        /** 第一个侦听的地址 */
+        address(): native.SocketAddress | string | undefined;
+
+        /** 所有侦听的地址, Unix 域套接字为路径 */
+        addresses(): (native.SocketAddress | string)[];
+
+        /** 停止侦听并关闭所有连接 */
+        close(): void;
+
+        /** 开始侦听, 可以多次调用以同时侦听 TCP 地址和 Unix 域套接字 */
+        listen(options: MQTTBrokerListenOptions): this;
+
+        /**
+         * 在本进程内直接发布一个消息
+         * @returns 发送的订阅者数量
+         */
+        publish(topic: string, payload: string | ArrayBuffer | ArrayBufferView, options?: MQTTPublishOptions): number;
+
+        stats(): {
+            connections: number;
+            subscriptions: number;
+            retained: number;
+            totalConnections: number;
+            messagesReceived: number;
+            messagesSent: number;
+            messagesDropped: number;
+        } | undefined;
+
+        onerror?(event: ErrorEvent): void;
+    }
+
+    /**
+     * 创建一个内嵌的 MQTT 服务器
+     */
+    export function createBroker(options?: MQTTBrokerOptions): MQTTBroker;
+
     /**
      * Connects to the broker specified by the given url and options and returns a Client.
      * @param url 
@@ -826,6 +1133,11 @@ declare module '@tjs/net' {
          */
         port?: number,
 
+        /**
+         * 是否设置 SO_REUSEPORT，允许多个进程或线程侦听同一个端口
+         */
+        reusePort?: boolean,
+
         /**
          * One of either '4(ipv4)' or '6(ipv6)'. Default: '4(ipv4)'.
          */
@@ -867,6 +1179,12 @@ declare module '@tjs/net' {
          */
         connected: Promise<void> | undefined;
 
+        /**
+         * 以字节流的方式读取收到的数据, 支持 `getReader({ mode: 'byob' })`
+         * - 未读取的数据超过高水位线 (64KB) 时暂停从连接读取数据
+         */
+        readonly readable: ReadableStream<Uint8Array>;
+
         /**
          * This property represents the state of the connection as a number.
          */
@@ -909,11 +1227,21 @@ declare module '@tjs/net' {
          */
         localAddress(): SocketAddress;
 
+        /**
+         * 暂停从连接读取数据
+         */
+        pause(): this;
+
         /**
          * Returns an object containing the address, family, and port of the remote endpoint. 
          */
         remoteAddress(): SocketAddress;
 
+        /**
+         * 恢复从连接读取数据
+         */
+        resume(): this;
+
         /**
          * Make the connection block the event loop from finishing.
          * Note: the connection blocks the event loop from finishing by default. 
@@ -953,6 +1281,11 @@ declare module '@tjs/net' {
          */
         unref(): void;
 
+        /**
+         * 以流的方式向连接写数据, 关闭时会调用 `shutdown()`
+         */
+        readonly writable: WritableStream<string | ArrayBuffer | ArrayBufferView>;
+
         /**
          * Sends data on the socket. 
          * The second parameter specifies the encoding in the case of a string. 
@@ -1034,6 +1367,7 @@ declare module '@tjs/net' {
          */
         listen(path: string, backlog?: number): void;
         listen(options: SocketAddress, backlog?: number): void;
+        listen(handle: import('@tjs/native').TCP, backlog?: number): void;
 
         /**
          * Emitted when the server closes. If connections exist, this event is 
@@ -39,3 +39,11 @@ target_include_directories(mdnsd PRIVATE ${MDNS_DIR}/src/)
 add_executable(mscan ${MSCAN_SOURCES})
 target_link_libraries(mscan mdns)
 target_include_directories(mscan PRIVATE ${MDNS_DIR}/src/)
+
+# libmdnsjs, 在 tjs 事件循环中运行的 mDNS 模块 (@tjs/mdns)
+if (BUILD_QUICKJS)
+  add_library(mdnsjs STATIC ${LIBMDNS_SOURCES} ${MDNS_DIR}/src/mdns-js.c)
+  target_compile_definitions(mdnsjs PRIVATE _GNU_SOURCE)
+  target_include_directories(mdnsjs PRIVATE ${MDNS_DIR}/src/)
+  target_link_libraries(mdnsjs tjs_core tjs_quickjs tjs_uv)
+endif ()
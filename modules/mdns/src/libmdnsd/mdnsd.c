@@ -188,12 +188,13 @@ static int _a_match(struct resource *r, mdns_answer_t *a)
 	if (strcmp(r->name, a->name) || r->type != a->type)
 		return 0;
 
-	if (r->type == QTYPE_SRV && r->known.srv.name && a->rdname && !strcmp(r->known.srv.name, a->rdname) &&
-		a->srv.port == r->known.srv.port && a->srv.weight == r->known.srv.weight && a->srv.priority == r->known.srv.priority)
-		return 1;
+	/* 已解析的类型只比较解析后的值, 因为它们的 rdlength 可能都为 0 */
+	if (r->type == QTYPE_SRV)
+		return r->known.srv.name && a->rdname && !strcmp(r->known.srv.name, a->rdname) &&
+			a->srv.port == r->known.srv.port && a->srv.weight == r->known.srv.weight && a->srv.priority == r->known.srv.priority;
 
-	if ((r->type == QTYPE_PTR || r->type == QTYPE_NS || r->type == QTYPE_CNAME) && !strcmp(a->rdname, r->known.ns.name))
-		return 1;
+	if (r->type == QTYPE_PTR || r->type == QTYPE_NS || r->type == QTYPE_CNAME)
+		return r->known.ns.name && a->rdname && !strcmp(a->rdname, r->known.ns.name);
 
 	if (r->type == QTYPE_A || !memcmp(&r->known.a.ip, &a->ip, 4))
 		return 1;
@@ -347,7 +348,7 @@ static void _q_done(mdns_daemon_t *d, struct query *q)
 {
 	struct cached *c = 0;
 	struct query *cur;
-	int i = _namehash(q->name) % LPRIME;
+	int i = _namehash(q->name) % SPRIME;
 
 	while ((c = _c_next(d, c, q->name, q->type)))
 		c->q = 0;
@@ -0,0 +1,1545 @@
+/* mDNS/DNS-SD module */
+#include "tjs-utils.h"
+
+#include "libmdnsd/mdnsd.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <uv.h>
+
+/** mDNS 组播地址和端口 */
+#define MDNSJS_GROUP "224.0.0.251"
+#define MDNSJS_PORT 5353
+
+/** 每个 mDNS 消息的最大长度 */
+#define MDNSJS_FRAME_SIZE 1000
+
+/** 默认发布的记录的 TTL (秒) */
+#define MDNSJS_DEFAULT_TTL 120
+
+/** TXT 记录的 TTL (秒) */
+#define MDNSJS_TXT_TTL 4500
+
+/** 默认解析超时时间 (毫秒) */
+#define MDNSJS_RESOLVE_TIMEOUT 3000
+
+/** 记住最近发送的消息的个数, 用于丢弃组播回环收到的自己的消息 */
+#define MDNSJS_SENT_HISTORY 16
+
+/** 单个名称的最大长度 */
+#define MDNSJS_MAX_NAME 256
+
+JSValue tjs_new_uv_error(JSContext* ctx, int err);
+
+enum mdnsjs_event_enum {
+    MDNSJS_EVENT_CONFLICT = 0,
+    MDNSJS_EVENT_ERROR,
+    MDNSJS_EVENT_MAX,
+};
+
+/** 发布的服务包含的记录 */
+enum mdnsjs_record_enum {
+    MDNSJS_RECORD_PTR = 0,
+    MDNSJS_RECORD_DISCO,
+    MDNSJS_RECORD_SRV,
+    MDNSJS_RECORD_TXT,
+    MDNSJS_RECORD_A,
+    MDNSJS_RECORD_MAX,
+};
+
+typedef struct mdnsjs_s mdnsjs_t;
+typedef struct mdnsjs_query_s mdnsjs_query_t;
+typedef struct mdnsjs_listener_s mdnsjs_listener_t;
+typedef struct mdnsjs_resolve_s mdnsjs_resolve_t;
+typedef struct mdnsjs_service_s mdnsjs_service_t;
+
+/**
+ * 一个查询 (名称 + 类型), 同一个查询的所有监听者共用 libmdnsd 中的同一个查询,
+ * 所有查询共用 libmdnsd 的应答缓存
+ */
+struct mdnsjs_query_s {
+    mdnsjs_t* mdns;
+    char* name;
+    int type;
+    mdnsjs_listener_t* listeners;
+    mdnsjs_query_t* next;
+};
+
+/** 查询的监听者: JS 回调函数或者正在进行的解析 */
+struct mdnsjs_listener_s {
+    uint32_t id;
+    int removed;
+    JSValue callback;
+    mdnsjs_resolve_t* resolve;
+    mdnsjs_query_t* query;
+    mdnsjs_listener_t* next;
+};
+
+/** 解析服务实例的 SRV, TXT 和 A 记录 */
+struct mdnsjs_resolve_s {
+    mdnsjs_t* mdns;
+    TJSPromise promise;
+    char* name;
+    char* host;
+    uint16_t port;
+    uint16_t priority;
+    uint16_t weight;
+    char address[INET_ADDRSTRLEN];
+    JSValue txt;
+    uint64_t deadline;
+    mdnsjs_listener_t* listeners[3];
+    mdnsjs_resolve_t* next;
+};
+
+/** 发布的服务 */
+struct mdnsjs_service_s {
+    uint32_t id;
+    char* type;
+    char* host;
+    mdnsjs_t* mdns;
+    mdns_record_t* records[MDNSJS_RECORD_MAX];
+    mdnsjs_service_t* next;
+};
+
+/**
+ * 等待分发给 JS 的应答
+ * libmdnsd 在处理收发的过程中回调应答, 这时先转换成 JS 对象并放入队列,
+ * 等 libmdnsd 返回后再调用 JS 回调函数, 避免 JS 代码修改 libmdnsd 正在遍历的列表
+ */
+typedef struct mdnsjs_event_s {
+    mdnsjs_query_t* query;
+
+    /** 不为 NULL 时只发给这个监听者 (回放缓存中的应答) */
+    mdnsjs_listener_t* listener;
+
+    /** 只发给产生这个应答时已经存在的监听者 */
+    uint32_t last_id;
+    JSValue value;
+} mdnsjs_event_t;
+
+struct mdnsjs_s {
+    JSContext* ctx;
+    JSRuntime* runtime;
+    JSValue events[MDNSJS_EVENT_MAX];
+
+    mdns_daemon_t* daemon;
+    uv_udp_t udp;
+    uv_timer_t timer;
+    int handle_count;
+
+    int closing;
+    int finalized;
+    int dispatching;
+
+    /** 组播目标地址 */
+    struct sockaddr_in group;
+    uint16_t port;
+
+    /** 发布的 A 记录默认使用的地址 */
+    struct in_addr address;
+    uint32_t ttl;
+    uint32_t next_id;
+
+    mdnsjs_query_t* queries;
+    mdnsjs_resolve_t* resolves;
+    mdnsjs_service_t* services;
+
+    mdnsjs_event_t* pending;
+    uint32_t pending_count;
+    uint32_t pending_capacity;
+
+    /** 最近发送的消息的摘要 */
+    uint32_t sent[MDNSJS_SENT_HISTORY];
+    uint32_t sent_index;
+
+    /** 上一个收到的消息的长度, 下次只需要清零这部分 */
+    size_t buffer_used;
+
+    struct message message;
+    unsigned char buffer[MAX_PACKET_LEN + 1];
+};
+
+static JSClassID mdnsjs_class_id;
+
+static void mdnsjs_process(mdnsjs_t* mdns);
+static void mdnsjs_timer_callback(uv_timer_t* handle);
+
+// ////////////////////////////////////////////////////////////////////////////
+// Utils
+
+/** FNV-1a, 消息内容和长度的摘要 */
+static uint32_t mdnsjs_hash(const unsigned char* data, size_t length)
+{
+    uint32_t hash = 2166136261u ^ (uint32_t)length;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+/**
+ * 复制并规范化名称: `_http._tcp` -> `_http._tcp.local.`, 反向解析的名称只添加 `.`
+ */
+static char* mdnsjs_strdup_name(const char* name)
+{
+    size_t length = strlen(name);
+    while (length > 0 && name[length - 1] == '.') {
+        length--;
+    }
+
+    if (length == 0 || length >= MDNSJS_MAX_NAME) {
+        return NULL;
+    }
+
+    int has_domain = length >= 6 && strncasecmp(name + length - 6, ".local", 6) == 0;
+    has_domain = has_domain || (length >= 5 && strncasecmp(name + length - 5, ".arpa", 5) == 0);
+
+    char* result = malloc(length + 8);
+    if (result) {
+        memcpy(result, name, length);
+        strcpy(result + length, has_domain ? "." : ".local.");
+    }
+
+    return result;
+}
+
+/**
+ * 返回指定名称的字符串属性值 (使用 free 释放)
+ */
+static char* mdnsjs_get_string(JSContext* ctx, JSValueConst object, const char* name)
+{
+    if (!JS_IsObject(object)) {
+        return NULL;
+    }
+
+    JSValue value = JS_GetPropertyStr(ctx, object, name);
+    if (JS_IsUndefined(value) || JS_IsNull(value) || JS_IsException(value)) {
+        JS_FreeValue(ctx, value);
+        return NULL;
+    }
+
+    const char* text = JS_ToCString(ctx, value);
+    JS_FreeValue(ctx, value);
+    if (!text) {
+        return NULL;
+    }
+
+    char* result = strdup(text);
+    JS_FreeCString(ctx, text);
+    return result;
+}
+
+/** TXT 记录: `[length]key=value...` -> { key: value } */
+static JSValue mdnsjs_new_txt(JSContext* ctx, const unsigned char* data, size_t length)
+{
+    JSValue result = JS_NewObject(ctx);
+    size_t offset = 0;
+    while (offset < length) {
+        size_t size = data[offset++];
+        if (size == 0 || offset + size > length) {
+            offset += size;
+            continue;
+        }
+
+        const char* item = (const char*)data + offset;
+        const char* equal = memchr(item, '=', size);
+        if (equal == item) {
+            offset += size;
+            continue;
+        }
+
+        char key[256];
+        size_t key_length = equal ? (size_t)(equal - item) : size;
+        memcpy(key, item, key_length);
+        key[key_length] = '\0';
+
+        JSValue value = JS_TRUE;
+        if (equal) {
+            value = JS_NewStringLen(ctx, equal + 1, size - key_length - 1);
+        }
+
+        JS_SetPropertyStr(ctx, result, key, value);
+        offset += size;
+    }
+
+    return result;
+}
+
+/** { key: value } -> TXT 记录, 没有属性时返回只包含一个空字符串的记录 */
+static int mdnsjs_encode_txt(JSContext* ctx, JSValueConst txt, unsigned char* buffer, size_t capacity, size_t* length)
+{
+    *length = 0;
+    if (JS_IsObject(txt)) {
+        JSPropertyEnum* properties = NULL;
+        uint32_t count = 0;
+        if (JS_GetOwnPropertyNames(ctx, &properties, &count, txt, JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY)) {
+            return -1;
+        }
+
+        int ret = 0;
+        for (uint32_t i = 0; i < count && ret == 0; i++) {
+            const char* key = JS_AtomToCString(ctx, properties[i].atom);
+            JSValue value = JS_GetProperty(ctx, txt, properties[i].atom);
+            const char* text = JS_IsBool(value) ? NULL : JS_ToCString(ctx, value);
+
+            size_t key_length = key ? strlen(key) : 0;
+            size_t text_length = text ? strlen(text) : 0;
+            size_t size = key_length + (text ? text_length + 1 : 0);
+            if (!key || key_length == 0 || (!text && !JS_IsBool(value))) {
+                ret = -1;
+
+            } else if (JS_IsBool(value) && !JS_ToBool(ctx, value)) {
+                // false 表示没有这个属性
+
+            } else if (size > 255 || *length + size + 1 > capacity) {
+                JS_ThrowRangeError(ctx, "TXT record is too long");
+                ret = -1;
+
+            } else {
+                buffer[(*length)++] = (unsigned char)size;
+                memcpy(buffer + *length, key, key_length);
+                *length += key_length;
+                if (text) {
+                    buffer[(*length)++] = '=';
+                    memcpy(buffer + *length, text, text_length);
+                    *length += text_length;
+                }
+            }
+
+            JS_FreeCString(ctx, text);
+            JS_FreeCString(ctx, key);
+            JS_FreeValue(ctx, value);
+        }
+
+        for (uint32_t i = 0; i < count; i++) {
+            JS_FreeAtom(ctx, properties[i].atom);
+        }
+
+        js_free(ctx, properties);
+        if (ret) {
+            return ret;
+        }
+    }
+
+    if (*length == 0) {
+        buffer[(*length)++] = 0;
+    }
+
+    return 0;
+}
+
+/**
+ * 应答 -> JS 对象
+ * `{ name, type, ttl, removed?, address?, target?, port?, priority?, weight?, txt?, data? }`
+ */
+static JSValue mdnsjs_new_answer(JSContext* ctx, const mdns_answer_t* answer)
+{
+    unsigned long now = (unsigned long)time(NULL);
+    unsigned long ttl = answer->ttl > now ? answer->ttl - now : 0;
+    char address[INET_ADDRSTRLEN] = { 0 };
+
+    JSValue result = JS_NewObject(ctx);
+    TJS_SetPropertyValue(ctx, result, "name", JS_NewString(ctx, answer->name));
+    TJS_SetPropertyValue(ctx, result, "type", JS_NewInt32(ctx, answer->type));
+    TJS_SetPropertyValue(ctx, result, "ttl", JS_NewInt64(ctx, ttl));
+    if (ttl == 0) {
+        TJS_SetPropertyValue(ctx, result, "removed", JS_TRUE);
+    }
+
+    switch (answer->type) {
+    case QTYPE_A: {
+        // 收到的 A 记录的 ip 字段是主机字节序, rdata 中是原始数据
+        struct in_addr ip = answer->ip;
+        if (answer->rdata && answer->rdlen == 4) {
+            memcpy(&ip, answer->rdata, 4);
+        }
+
+        inet_ntop(AF_INET, &ip, address, sizeof(address));
+        TJS_SetPropertyValue(ctx, result, "address", JS_NewString(ctx, address));
+        break;
+    }
+
+    case QTYPE_NS:
+    case QTYPE_CNAME:
+    case QTYPE_PTR:
+        TJS_SetPropertyValue(ctx, result, "target", JS_NewString(ctx, answer->rdname ? answer->rdname : ""));
+        if (answer->ip.s_addr) {
+            // 发送这个应答的主机的地址
+            inet_ntop(AF_INET, &answer->ip, address, sizeof(address));
+            TJS_SetPropertyValue(ctx, result, "address", JS_NewString(ctx, address));
+        }
+        break;
+
+    case QTYPE_SRV:
+        TJS_SetPropertyValue(ctx, result, "target", JS_NewString(ctx, answer->rdname ? answer->rdname : ""));
+        TJS_SetPropertyValue(ctx, result, "port", JS_NewInt32(ctx, answer->srv.port));
+        TJS_SetPropertyValue(ctx, result, "priority", JS_NewInt32(ctx, answer->srv.priority));
+        TJS_SetPropertyValue(ctx, result, "weight", JS_NewInt32(ctx, answer->srv.weight));
+        break;
+
+    case QTYPE_TXT:
+        TJS_SetPropertyValue(ctx, result, "txt", mdnsjs_new_txt(ctx, answer->rdata, answer->rdata ? answer->rdlen : 0));
+        break;
+
+    default:
+        TJS_SetPropertyValue(ctx, result, "data", TJS_NewArrayBuffer(ctx, answer->rdata, answer->rdata ? answer->rdlen : 0));
+        break;
+    }
+
+    return result;
+}
+
+// ////////////////////////////////////////////////////////////////////////////
+// Events
+
+static void mdnsjs_push_event(mdnsjs_t* mdns, mdnsjs_query_t* query, mdnsjs_listener_t* listener, JSValue value)
+{
+    if (mdns->pending_count >= mdns->pending_capacity) {
+        uint32_t capacity = mdns->pending_capacity ? mdns->pending_capacity * 2 : 16;
+        mdnsjs_event_t* pending = realloc(mdns->pending, capacity * sizeof(*pending));
+        if (!pending) {
+            JS_FreeValue(mdns->ctx, value);
+            return;
+        }
+
+        mdns->pending = pending;
+        mdns->pending_capacity = capacity;
+    }
+
+    mdnsjs_event_t* event = &mdns->pending[mdns->pending_count++];
+    event->query = query;
+    event->listener = listener;
+    event->last_id = listener ? listener->id : mdns->next_id;
+    event->value = value;
+}
+
+static void mdnsjs_free_events(mdnsjs_t* mdns)
+{
+    for (uint32_t i = 0; i < mdns->pending_count; i++) {
+        JS_FreeValueRT(mdns->runtime, mdns->pending[i].value);
+    }
+
+    mdns->pending_count = 0;
+}
+
+/** libmdnsd 的应答回调, 找到, 过期或者收到 TTL 为 0 的记录时调用 */
+static int mdnsjs_answer_callback(mdns_answer_t* answer, void* arg)
+{
+    mdnsjs_query_t* query = arg;
+    mdnsjs_t* mdns = query->mdns;
+
+    for (mdnsjs_listener_t* listener = query->listeners; listener; listener = listener->next) {
+        if (!listener->removed) {
+            mdnsjs_push_event(mdns, query, NULL, mdnsjs_new_answer(mdns->ctx, answer));
+            break;
+        }
+    }
+
+    return 0;
+}
+
+// ////////////////////////////////////////////////////////////////////////////
+// Queries
+
+/**
+ * 添加查询的监听者, 如果缓存中已经有这个查询的应答, 会先回放给这个监听者
+ */
+static mdnsjs_listener_t* mdnsjs_listen(mdnsjs_t* mdns, const char* name, int type, JSValueConst callback, mdnsjs_resolve_t* resolve)
+{
+    mdnsjs_query_t* query = mdns->queries;
+    while (query && (query->type != type || strcmp(query->name, name))) {
+        query = query->next;
+    }
+
+    if (!query) {
+        query = calloc(1, sizeof(*query));
+        if (!query) {
+            return NULL;
+        }
+
+        query->name = strdup(name);
+        query->type = type;
+        query->mdns = mdns;
+        query->next = mdns->queries;
+        mdns->queries = query;
+        mdnsd_query(mdns->daemon, query->name, type, mdnsjs_answer_callback, query);
+    }
+
+    mdnsjs_listener_t* listener = calloc(1, sizeof(*listener));
+    if (!listener) {
+        return NULL;
+    }
+
+    listener->id = ++mdns->next_id;
+    listener->query = query;
+    listener->resolve = resolve;
+    listener->callback = JS_DupValue(mdns->ctx, callback);
+
+    mdnsjs_listener_t** tail = &query->listeners;
+    while (*tail) {
+        tail = &(*tail)->next;
+    }
+
+    *tail = listener;
+
+    // 共享的应答缓存
+    mdns_answer_t* answer = NULL;
+    unsigned long now = (unsigned long)time(NULL);
+    while ((answer = mdnsd_list(mdns->daemon, name, type, answer))) {
+        if (answer->ttl > now) {
+            mdnsjs_push_event(mdns, query, listener, mdnsjs_new_answer(mdns->ctx, answer));
+        }
+    }
+
+    // 尽快发送新的查询和分发缓存的应答
+    uv_timer_start(&mdns->timer, mdnsjs_timer_callback, 0, 0);
+    return listener;
+}
+
+/** 删除标记为已删除的监听者以及没有监听者的查询 */
+static void mdnsjs_sweep(mdnsjs_t* mdns)
+{
+    mdnsjs_query_t** link = &mdns->queries;
+    while (*link) {
+        mdnsjs_query_t* query = *link;
+        mdnsjs_listener_t** item = &query->listeners;
+        while (*item) {
+            mdnsjs_listener_t* listener = *item;
+            if (listener->removed) {
+                *item = listener->next;
+                JS_FreeValueRT(mdns->runtime, listener->callback);
+                free(listener);
+
+            } else {
+                item = &listener->next;
+            }
+        }
+
+        if (query->listeners) {
+            link = &query->next;
+            continue;
+        }
+
+        *link = query->next;
+        mdnsd_query(mdns->daemon, query->name, query->type, NULL, NULL);
+        free(query->name);
+        free(query);
+    }
+}
+
+/** 删除监听者, 在分发应答期间只做标记 */
+static void mdnsjs_unlisten(mdnsjs_t* mdns, mdnsjs_listener_t* listener)
+{
+    if (listener) {
+        listener->removed = 1;
+    }
+
+    if (!mdns->dispatching && mdns->pending_count == 0) {
+        mdnsjs_sweep(mdns);
+    }
+}
+
+// ////////////////////////////////////////////////////////////////////////////
+// Resolve
+
+static void mdnsjs_resolve_free(mdnsjs_resolve_t* resolve)
+{
+    mdnsjs_t* mdns = resolve->mdns;
+    mdnsjs_resolve_t** link = &mdns->resolves;
+    while (*link && *link != resolve) {
+        link = &(*link)->next;
+    }
+
+    if (*link) {
+        *link = resolve->next;
+    }
+
+    for (int i = 0; i < 3; i++) {
+        if (resolve->listeners[i]) {
+            resolve->listeners[i]->resolve = NULL;
+            resolve->listeners[i]->removed = 1;
+        }
+    }
+
+    JS_FreeValueRT(mdns->runtime, resolve->txt);
+    free(resolve->name);
+    free(resolve->host);
+    free(resolve);
+}
+
+/** 完成解析, status 为 0 表示成功 */
+static void mdnsjs_resolve_done(mdnsjs_resolve_t* resolve, int status)
+{
+    JSContext* ctx = resolve->mdns->ctx;
+
+    JSValue result;
+    if (status) {
+        result = tjs_new_uv_error(ctx, status);
+
+    } else {
+        result = JS_NewObject(ctx);
+        TJS_SetPropertyValue(ctx, result, "name", JS_NewString(ctx, resolve->name));
+        TJS_SetPropertyValue(ctx, result, "host", JS_NewString(ctx, resolve->host));
+        TJS_SetPropertyValue(ctx, result, "port", JS_NewInt32(ctx, resolve->port));
+        TJS_SetPropertyValue(ctx, result, "priority", JS_NewInt32(ctx, resolve->priority));
+        TJS_SetPropertyValue(ctx, result, "weight", JS_NewInt32(ctx, resolve->weight));
+        TJS_SetPropertyValue(ctx, result, "address", JS_NewString(ctx, resolve->address));
+        TJS_SetPropertyValue(ctx, result, "txt", JS_IsUndefined(resolve->txt) ? JS_NewObject(ctx) : JS_DupValue(ctx, resolve->txt));
+    }
+
+    TJS_SettlePromise(ctx, &resolve->promise, status != 0, 1, (JSValueConst*)&result);
+    mdnsjs_resolve_free(resolve);
+}
+
+static void mdnsjs_resolve_answer(mdnsjs_resolve_t* resolve, JSValueConst answer)
+{
+    mdnsjs_t* mdns = resolve->mdns;
+    JSContext* ctx = mdns->ctx;
+
+    if (TJS_GetPropertyInt32(ctx, answer, "removed", 0)) {
+        return;
+    }
+
+    int type = TJS_GetPropertyInt32(ctx, answer, "type", 0);
+    if (type == QTYPE_SRV && !resolve->host) {
+        char* target = mdnsjs_get_string(ctx, answer, "target");
+        if (!target) {
+            return;
+        }
+
+        resolve->host = target;
+        resolve->port = TJS_GetPropertyUint32(ctx, answer, "port", 0);
+        resolve->priority = TJS_GetPropertyUint32(ctx, answer, "priority", 0);
+        resolve->weight = TJS_GetPropertyUint32(ctx, answer, "weight", 0);
+        resolve->listeners[2] = mdnsjs_listen(mdns, target, QTYPE_A, JS_UNDEFINED, resolve);
+
+    } else if (type == QTYPE_TXT) {
+        JS_FreeValue(ctx, resolve->txt);
+        resolve->txt = JS_GetPropertyStr(ctx, answer, "txt");
+
+    } else if (type == QTYPE_A && resolve->address[0] == '\0') {
+        char* address = mdnsjs_get_string(ctx, answer, "address");
+        if (address) {
+            strncpy(resolve->address, address, sizeof(resolve->address) - 1);
+            free(address);
+        }
+    }
+
+    if (resolve->host && resolve->address[0]) {
+        mdnsjs_resolve_done(resolve, 0);
+    }
+}
+
+/** 拒绝已经超时的解析 */
+static void mdnsjs_check_timeouts(mdnsjs_t* mdns)
+{
+    uint64_t now = uv_now(TJS_GetLoop(mdns->ctx));
+    mdnsjs_resolve_t* resolve = mdns->resolves;
+    while (resolve) {
+        mdnsjs_resolve_t* next = resolve->next;
+        if (resolve->deadline <= now) {
+            mdnsjs_resolve_done(resolve, UV_ETIMEDOUT);
+        }
+
+        resolve = next;
+    }
+}
+
+// ////////////////////////////////////////////////////////////////////////////
+// Services
+
+/** 查找已经发布的记录 */
+static mdns_record_t* mdnsjs_find_record(mdns_daemon_t* daemon, const char* name, int type, const char* rdname)
+{
+    mdns_record_t* record = mdnsd_get_published(daemon, name);
+    for (; record; record = mdnsd_record_next(record)) {
+        const mdns_answer_t* data = mdnsd_record_data(record);
+        if (data->type != type || strcmp(data->name, name)) {
+            continue;
+
+        } else if (rdname && (!data->rdname || strcmp(data->rdname, rdname))) {
+            continue;
+        }
+
+        return record;
+    }
+
+    return NULL;
+}
+
+/** 名称冲突, libmdnsd 会在这个回调返回后删除这个记录 */
+static void mdnsjs_conflict_callback(char* name, int type, void* arg)
+{
+    mdnsjs_service_t* service = arg;
+    mdnsjs_t* mdns = service->mdns;
+    JSContext* ctx = mdns->ctx;
+
+    for (int i = 0; i < MDNSJS_RECORD_MAX; i++) {
+        mdns_record_t* record = service->records[i];
+        if (record && mdnsd_record_data(record)->type == type && !strcmp(mdnsd_record_data(record)->name, name)) {
+            service->records[i] = NULL;
+        }
+    }
+
+    JSValue event = JS_NewObject(ctx);
+    TJS_SetPropertyValue(ctx, event, "id", JS_NewUint32(ctx, service->id));
+    TJS_SetPropertyValue(ctx, event, "name", JS_NewString(ctx, name));
+    TJS_SetPropertyValue(ctx, event, "type", JS_NewInt32(ctx, type));
+    mdnsjs_push_event(mdns, NULL, NULL, event);
+}
+
+/**
+ * 取消发布服务
+ * 多个服务共用的 A 记录和服务类型 PTR 记录转交给还在使用它们的服务
+ */
+static void mdnsjs_service_free(mdnsjs_service_t* service, int goodbye)
+{
+    mdnsjs_t* mdns = service->mdns;
+    mdnsjs_service_t** link = &mdns->services;
+    while (*link && *link != service) {
+        link = &(*link)->next;
+    }
+
+    if (*link) {
+        *link = service->next;
+    }
+
+    for (int i = 0; i < MDNSJS_RECORD_MAX && goodbye; i++) {
+        mdns_record_t* record = service->records[i];
+        if (!record) {
+            continue;
+        }
+
+        mdnsjs_service_t* owner = NULL;
+        for (mdnsjs_service_t* item = mdns->services; item && (i == MDNSJS_RECORD_A || i == MDNSJS_RECORD_DISCO); item = item->next) {
+            const char* key = (i == MDNSJS_RECORD_A) ? item->host : item->type;
+            if (!strcmp(key, (i == MDNSJS_RECORD_A) ? service->host : service->type) && !item->records[i]) {
+                owner = item;
+                break;
+            }
+        }
+
+        if (owner) {
+            owner->records[i] = record;
+
+        } else {
+            // 发送 TTL 为 0 的记录
+            mdnsd_done(mdns->daemon, record);
+        }
+    }
+
+    free(service->type);
+    free(service->host);
+    free(service);
+}
+
+// ////////////////////////////////////////////////////////////////////////////
+// Daemon
+
+/** 发送 libmdnsd 生成的所有消息 */
+static void mdnsjs_flush(mdnsjs_t* mdns)
+{
+    struct message* message = &mdns->message;
+    struct in_addr ip;
+    unsigned short port;
+
+    while (mdnsd_out(mdns->daemon, message, &ip, &port)) {
+        struct sockaddr_in to = mdns->group;
+        if (ip.s_addr != inet_addr(MDNSJS_GROUP)) {
+            // 单播应答, 端口是 mdnsjs_recv_callback 传入的主机字节序
+            to.sin_addr = ip;
+            to.sin_port = htons(port);
+        }
+
+        unsigned char* packet = message_packet(message);
+        int length = message_packet_len(message);
+        mdns->sent[mdns->sent_index++ % MDNSJS_SENT_HISTORY] = mdnsjs_hash(packet, length);
+
+        uv_buf_t buf = uv_buf_init((char*)packet, length);
+        uv_udp_try_send(&mdns->udp, &buf, 1, (struct sockaddr*)&to);
+    }
+}
+
+/** 按照 mdnsd_sleep 和解析的超时时间调度下一次处理 */
+static void mdnsjs_schedule(mdnsjs_t* mdns)
+{
+    if (mdns->closing) {
+        return;
+    }
+
+    struct timeval* tv = mdnsd_sleep(mdns->daemon);
+    uint64_t timeout = (uint64_t)tv->tv_sec * 1000 + tv->tv_usec / 1000;
+    uint64_t now = uv_now(TJS_GetLoop(mdns->ctx));
+    for (mdnsjs_resolve_t* resolve = mdns->resolves; resolve; resolve = resolve->next) {
+        uint64_t delay = resolve->deadline > now ? resolve->deadline - now : 0;
+        if (delay < timeout) {
+            timeout = delay;
+        }
+    }
+
+    uv_timer_start(&mdns->timer, mdnsjs_timer_callback, timeout, 0);
+}
+
+/** 分发队列中的应答 */
+static void mdnsjs_dispatch(mdnsjs_t* mdns)
+{
+    JSContext* ctx = mdns->ctx;
+    mdns->dispatching++;
+
+    // 回调函数中可能会添加新的应答, 所以每次都重新读取队列
+    for (uint32_t i = 0; i < mdns->pending_count; i++) {
+        mdnsjs_event_t event = mdns->pending[i];
+        if (event.query == NULL) {
+            TJS_EmitEvent(ctx, mdns->events[MDNSJS_EVENT_CONFLICT], event.value);
+            continue;
+        }
+
+        for (mdnsjs_listener_t* listener = event.query->listeners; listener; listener = listener->next) {
+            if (listener->removed || listener->id > event.last_id) {
+                continue;
+
+            } else if (event.listener && event.listener != listener) {
+                continue;
+            }
+
+            if (listener->resolve) {
+                mdnsjs_resolve_answer(listener->resolve, event.value);
+                continue;
+            }
+
+            JSValue ret = JS_Call(ctx, listener->callback, JS_UNDEFINED, 1, (JSValueConst*)&event.value);
+            if (JS_IsException(ret)) {
+                TJS_DumpError(ctx);
+            }
+
+            JS_FreeValue(ctx, ret);
+        }
+
+        JS_FreeValue(ctx, event.value);
+    }
+
+    mdns->pending_count = 0;
+    mdns->dispatching--;
+}
+
+static void mdnsjs_process(mdnsjs_t* mdns)
+{
+    if (mdns->dispatching) {
+        return;
+    }
+
+    mdnsjs_flush(mdns);
+    mdnsjs_check_timeouts(mdns);
+    mdnsjs_dispatch(mdns);
+    mdnsjs_sweep(mdns);
+
+    // 回调函数中可能发布了新的记录或者关闭了
+    if (!mdns->closing) {
+        mdnsjs_flush(mdns);
+        mdnsjs_schedule(mdns);
+    }
+}
+
+static void mdnsjs_timer_callback(uv_timer_t* handle)
+{
+    mdnsjs_t* mdns = handle->data;
+    CHECK_NOT_NULL(mdns);
+
+    mdnsjs_process(mdns);
+}
+
+static void mdnsjs_alloc_callback(uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf)
+{
+    mdnsjs_t* mdns = handle->data;
+    buf->base = (char*)mdns->buffer;
+    buf->len = MAX_PACKET_LEN;
+}
+
+static void mdnsjs_recv_callback(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf, const struct sockaddr* addr, unsigned flags)
+{
+    mdnsjs_t* mdns = handle->data;
+    CHECK_NOT_NULL(mdns);
+
+    if (nread < 0) {
+        TJS_EmitEvent(mdns->ctx, mdns->events[MDNSJS_EVENT_ERROR], tjs_new_uv_error(mdns->ctx, nread));
+        return;
+
+    } else if (nread == 0 || addr == NULL || addr->sa_family != AF_INET || (flags & UV_UDP_PARTIAL)) {
+        return;
+    }
+
+    // 组播回环收到的自己发送的消息
+    uint32_t hash = mdnsjs_hash(mdns->buffer, nread);
+    for (int i = 0; i < MDNSJS_SENT_HISTORY; i++) {
+        if (mdns->sent[i] == hash) {
+            return;
+        }
+    }
+
+    // message_parse 要求消息后面的数据都为 0
+    if (mdns->buffer_used > (size_t)nread) {
+        memset(mdns->buffer + nread, 0, mdns->buffer_used - nread);
+    }
+
+    mdns->buffer_used = nread;
+
+    memset(&mdns->message, 0, sizeof(mdns->message));
+    if (message_parse(&mdns->message, mdns->buffer) == 0) {
+        const struct sockaddr_in* from = (const struct sockaddr_in*)addr;
+
+        // 从组播端口发出的是 mDNS 响应者, 其他端口是需要单播应答的传统 DNS 查询
+        unsigned short port = ntohs(from->sin_port);
+        if (port == mdns->port) {
+            port = MDNSJS_PORT;
+        }
+
+        mdnsd_in(mdns->daemon, &mdns->message, from->sin_addr, port);
+    }
+
+    mdnsjs_process(mdns);
+}
+
+static void mdnsjs_maybe_free(mdnsjs_t* mdns)
+{
+    if (mdns->finalized && mdns->handle_count == 0) {
+        mdnsd_free(mdns->daemon);
+        free(mdns->pending);
+        free(mdns);
+    }
+}
+
+static void mdnsjs_close_callback(uv_handle_t* handle)
+{
+    mdnsjs_t* mdns = handle->data;
+    CHECK_NOT_NULL(mdns);
+
+    mdns->handle_count--;
+    mdnsjs_maybe_free(mdns);
+}
+
+/** 发送所有发布的记录的 goodbye 消息并关闭套接字 */
+static void mdnsjs_close(mdnsjs_t* mdns)
+{
+    if (mdns->closing) {
+        return;
+    }
+
+    mdns->closing = 1;
+    mdnsd_shutdown(mdns->daemon);
+    mdnsjs_flush(mdns);
+
+    while (mdns->services) {
+        mdnsjs_service_free(mdns->services, 0);
+    }
+
+    for (mdnsjs_query_t* query = mdns->queries; query; query = query->next) {
+        for (mdnsjs_listener_t* listener = query->listeners; listener; listener = listener->next) {
+            listener->removed = 1;
+        }
+    }
+
+    uv_close((uv_handle_t*)&mdns->udp, mdnsjs_close_callback);
+    uv_close((uv_handle_t*)&mdns->timer, mdnsjs_close_callback);
+}
+
+static void mdnsjs_finalizer(JSRuntime* runtime, JSValue val)
+{
+    mdnsjs_t* mdns = JS_GetOpaque(val, mdnsjs_class_id);
+    if (mdns == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < MDNSJS_EVENT_MAX; i++) {
+        JS_FreeValueRT(runtime, mdns->events[i]);
+        mdns->events[i] = JS_UNDEFINED;
+    }
+
+    while (mdns->resolves) {
+        TJS_FreePromiseRT(runtime, &mdns->resolves->promise);
+        mdnsjs_resolve_free(mdns->resolves);
+    }
+
+    mdnsjs_close(mdns);
+    mdnsjs_free_events(mdns);
+    mdnsjs_sweep(mdns);
+
+    mdns->finalized = 1;
+    mdnsjs_maybe_free(mdns);
+}
+
+static void mdnsjs_mark(JSRuntime* runtime, JSValueConst val, JS_MarkFunc* mark_func)
+{
+    mdnsjs_t* mdns = JS_GetOpaque(val, mdnsjs_class_id);
+    if (mdns == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < MDNSJS_EVENT_MAX; i++) {
+        JS_MarkValue(runtime, mdns->events[i], mark_func);
+    }
+
+    for (mdnsjs_query_t* query = mdns->queries; query; query = query->next) {
+        for (mdnsjs_listener_t* listener = query->listeners; listener; listener = listener->next) {
+            JS_MarkValue(runtime, listener->callback, mark_func);
+        }
+    }
+
+    for (mdnsjs_resolve_t* resolve = mdns->resolves; resolve; resolve = resolve->next) {
+        TJS_MarkPromise(runtime, &resolve->promise, mark_func);
+        JS_MarkValue(runtime, resolve->txt, mark_func);
+    }
+
+    for (uint32_t i = 0; i < mdns->pending_count; i++) {
+        JS_MarkValue(runtime, mdns->pending[i].value, mark_func);
+    }
+}
+
+static JSClassDef mdnsjs_class = {
+    "MDNS",
+    .finalizer = mdnsjs_finalizer,
+    .gc_mark = mdnsjs_mark,
+};
+
+static mdnsjs_t* mdnsjs_get(JSContext* ctx, JSValueConst obj)
+{
+    mdnsjs_t* mdns = JS_GetOpaque2(ctx, obj, mdnsjs_class_id);
+    if (mdns && mdns->closing) {
+        JS_ThrowTypeError(ctx, "mdns is closed");
+        return NULL;
+    }
+
+    return mdns;
+}
+
+/**
+ * `new MDNS({ port, interface, ttl, loopback })`
+ */
+static JSValue mdnsjs_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst* argv)
+{
+    JSValueConst options = argc > 0 ? argv[0] : JS_UNDEFINED;
+    if (!JS_IsUndefined(options) && !JS_IsObject(options)) {
+        return JS_ThrowTypeError(ctx, "options must be an object");
+    }
+
+    uint32_t port = MDNSJS_PORT;
+    uint32_t ttl = MDNSJS_DEFAULT_TTL;
+    int loopback = 1;
+    char* interface = NULL;
+    if (JS_IsObject(options)) {
+        port = TJS_GetPropertyUint32(ctx, options, "port", MDNSJS_PORT);
+        ttl = TJS_GetPropertyUint32(ctx, options, "ttl", MDNSJS_DEFAULT_TTL);
+        loopback = TJS_GetPropertyInt32(ctx, options, "loopback", 1);
+        interface = mdnsjs_get_string(ctx, options, "interface");
+    }
+
+    struct in_addr address = { 0 };
+    if (port == 0 || port > 65535) {
+        free(interface);
+        return JS_ThrowRangeError(ctx, "invalid port");
+
+    } else if (interface && inet_pton(AF_INET, interface, &address) != 1) {
+        free(interface);
+        return JS_ThrowTypeError(ctx, "invalid interface address");
+    }
+
+    JSValue obj = JS_NewObjectClass(ctx, mdnsjs_class_id);
+    if (JS_IsException(obj)) {
+        free(interface);
+        return obj;
+    }
+
+    mdnsjs_t* mdns = calloc(1, sizeof(*mdns));
+    if (!mdns) {
+        free(interface);
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+
+    mdns->ctx = ctx;
+    mdns->runtime = JS_GetRuntime(ctx);
+    mdns->port = port;
+    mdns->ttl = ttl;
+    mdns->address = address;
+    mdns->daemon = mdnsd_new(QCLASS_IN, MDNSJS_FRAME_SIZE);
+    for (int i = 0; i < MDNSJS_EVENT_MAX; i++) {
+        mdns->events[i] = JS_UNDEFINED;
+    }
+
+    mdns->group.sin_family = AF_INET;
+    mdns->group.sin_port = htons(port);
+    mdns->group.sin_addr.s_addr = inet_addr(MDNSJS_GROUP);
+    mdnsd_set_address(mdns->daemon, address);
+
+    uv_loop_t* loop = TJS_GetLoop(ctx);
+    CHECK_EQ(uv_udp_init(loop, &mdns->udp), 0);
+    CHECK_EQ(uv_timer_init(loop, &mdns->timer), 0);
+    mdns->udp.data = mdns;
+    mdns->timer.data = mdns;
+    mdns->handle_count = 2;
+    JS_SetOpaque(obj, mdns);
+
+    struct sockaddr_in bind_address = { 0 };
+    bind_address.sin_family = AF_INET;
+    bind_address.sin_port = htons(port);
+
+    int ret = uv_udp_bind(&mdns->udp, (struct sockaddr*)&bind_address, UV_UDP_REUSEADDR);
+    if (ret == 0) {
+        ret = uv_udp_set_membership(&mdns->udp, MDNSJS_GROUP, interface, UV_JOIN_GROUP);
+    }
+
+    if (ret == 0 && interface) {
+        ret = uv_udp_set_multicast_interface(&mdns->udp, interface);
+    }
+
+    if (ret == 0) {
+        uv_udp_set_multicast_ttl(&mdns->udp, 255);
+        uv_udp_set_multicast_loop(&mdns->udp, loopback);
+        ret = uv_udp_recv_start(&mdns->udp, mdnsjs_alloc_callback, mdnsjs_recv_callback);
+    }
+
+    free(interface);
+    if (ret < 0) {
+        mdnsjs_close(mdns);
+        JS_FreeValue(ctx, obj);
+        return JS_Throw(ctx, tjs_new_uv_error(ctx, ret));
+    }
+
+    return obj;
+}
+
+/**
+ * `query(name, type, callback)`, 返回查询 ID
+ * 找到, 过期或者删除记录时调用 callback(answer)
+ */
+static JSValue mdnsjs_query_method(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mdnsjs_t* mdns = mdnsjs_get(ctx, this_val);
+    if (!mdns) {
+        return JS_EXCEPTION;
+
+    } else if (argc < 3 || !JS_IsFunction(ctx, argv[2])) {
+        return JS_ThrowTypeError(ctx, "callback must be a function");
+    }
+
+    int32_t type = 0;
+    const char* text = JS_ToCString(ctx, argv[0]);
+    if (!text || JS_ToInt32(ctx, &type, argv[1])) {
+        JS_FreeCString(ctx, text);
+        return JS_EXCEPTION;
+    }
+
+    char* name = mdnsjs_strdup_name(text);
+    JS_FreeCString(ctx, text);
+    if (!name) {
+        return JS_ThrowTypeError(ctx, "invalid name");
+    }
+
+    mdnsjs_listener_t* listener = mdnsjs_listen(mdns, name, type, argv[2], NULL);
+    free(name);
+    if (!listener) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    return JS_NewUint32(ctx, listener->id);
+}
+
+/**
+ * `browse(type, callback)`, 查找指定类型的服务实例
+ * 例如 `_http._tcp` 查询 `_http._tcp.local.` 的 PTR 记录
+ */
+static JSValue mdnsjs_browse(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mdnsjs_t* mdns = mdnsjs_get(ctx, this_val);
+    if (!mdns) {
+        return JS_EXCEPTION;
+
+    } else if (argc < 2 || !JS_IsFunction(ctx, argv[1])) {
+        return JS_ThrowTypeError(ctx, "callback must be a function");
+    }
+
+    const char* text = JS_ToCString(ctx, argv[0]);
+    if (!text) {
+        return JS_EXCEPTION;
+    }
+
+    char* type = mdnsjs_strdup_name(text);
+    JS_FreeCString(ctx, text);
+    if (!type) {
+        return JS_ThrowTypeError(ctx, "invalid service type");
+    }
+
+    mdnsjs_listener_t* listener = mdnsjs_listen(mdns, type, QTYPE_PTR, argv[1], NULL);
+    free(type);
+    if (!listener) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    return JS_NewUint32(ctx, listener->id);
+}
+
+/**
+ * `cancel(id)`, 取消 query 或者 browse 的查询
+ */
+static JSValue mdnsjs_cancel(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mdnsjs_t* mdns = mdnsjs_get(ctx, this_val);
+    uint32_t id = 0;
+    if (!mdns || JS_ToUint32(ctx, &id, argc > 0 ? argv[0] : JS_UNDEFINED)) {
+        return JS_EXCEPTION;
+    }
+
+    for (mdnsjs_query_t* query = mdns->queries; query; query = query->next) {
+        for (mdnsjs_listener_t* listener = query->listeners; listener; listener = listener->next) {
+            if (listener->id == id && !listener->removed && !listener->resolve) {
+                mdnsjs_unlisten(mdns, listener);
+                return JS_TRUE;
+            }
+        }
+    }
+
+    return JS_FALSE;
+}
+
+/**
+ * `resolve(name, timeout)`, 解析服务实例的 SRV, TXT 和 A 记录
+ * @returns Promise<{ name, host, port, priority, weight, address, txt }>
+ */
+static JSValue mdnsjs_resolve_method(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mdnsjs_t* mdns = mdnsjs_get(ctx, this_val);
+    if (!mdns) {
+        return JS_EXCEPTION;
+    }
+
+    const char* text = JS_ToCString(ctx, argc > 0 ? argv[0] : JS_UNDEFINED);
+    if (!text) {
+        return JS_EXCEPTION;
+    }
+
+    uint32_t timeout = MDNSJS_RESOLVE_TIMEOUT;
+    if (argc > 1 && !JS_IsUndefined(argv[1])) {
+        timeout = TJS_ToUint32(ctx, argv[1], MDNSJS_RESOLVE_TIMEOUT);
+    }
+
+    char* name = mdnsjs_strdup_name(text);
+    JS_FreeCString(ctx, text);
+    if (!name) {
+        return JS_ThrowTypeError(ctx, "invalid name");
+    }
+
+    mdnsjs_resolve_t* resolve = calloc(1, sizeof(*resolve));
+    if (!resolve) {
+        free(name);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    resolve->mdns = mdns;
+    resolve->name = name;
+    resolve->txt = JS_UNDEFINED;
+    resolve->deadline = uv_now(TJS_GetLoop(ctx)) + timeout;
+    resolve->next = mdns->resolves;
+    mdns->resolves = resolve;
+
+    JSValue promise = TJS_InitPromise(ctx, &resolve->promise);
+    resolve->listeners[0] = mdnsjs_listen(mdns, name, QTYPE_SRV, JS_UNDEFINED, resolve);
+    resolve->listeners[1] = mdnsjs_listen(mdns, name, QTYPE_TXT, JS_UNDEFINED, resolve);
+    return promise;
+}
+
+/**
+ * `list(name, type)`, 返回缓存中的应答
+ */
+static JSValue mdnsjs_list(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mdnsjs_t* mdns = mdnsjs_get(ctx, this_val);
+    if (!mdns) {
+        return JS_EXCEPTION;
+    }
+
+    int32_t type = QTYPE_ANY;
+    const char* text = JS_ToCString(ctx, argc > 0 ? argv[0] : JS_UNDEFINED);
+    if (!text) {
+        return JS_EXCEPTION;
+
+    } else if (argc > 1 && !JS_IsUndefined(argv[1]) && JS_ToInt32(ctx, &type, argv[1])) {
+        JS_FreeCString(ctx, text);
+        return JS_EXCEPTION;
+    }
+
+    char* name = mdnsjs_strdup_name(text);
+    JS_FreeCString(ctx, text);
+    if (!name) {
+        return JS_ThrowTypeError(ctx, "invalid name");
+    }
+
+    JSValue result = JS_NewArray(ctx);
+    mdns_answer_t* answer = NULL;
+    unsigned long now = (unsigned long)time(NULL);
+    uint32_t index = 0;
+    while ((answer = mdnsd_list(mdns->daemon, name, type, answer))) {
+        if (answer->ttl > now) {
+            TJS_SetElementValue(ctx, result, index++, mdnsjs_new_answer(ctx, answer));
+        }
+    }
+
+    free(name);
+    return result;
+}
+
+/**
+ * `publish({ name, type, port, host, address, txt, ttl, priority, weight })`, 返回服务 ID
+ */
+static JSValue mdnsjs_publish(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mdnsjs_t* mdns = mdnsjs_get(ctx, this_val);
+    if (!mdns) {
+        return JS_EXCEPTION;
+
+    } else if (argc < 1 || !JS_IsObject(argv[0])) {
+        return JS_ThrowTypeError(ctx, "options must be an object");
+    }
+
+    JSValueConst options = argv[0];
+    char* label = mdnsjs_get_string(ctx, options, "name");
+    char* text = mdnsjs_get_string(ctx, options, "type");
+    char* hostname = mdnsjs_get_string(ctx, options, "host");
+    char* address_text = mdnsjs_get_string(ctx, options, "address");
+    uint32_t port = TJS_GetPropertyUint32(ctx, options, "port", 0);
+    uint32_t ttl = TJS_GetPropertyUint32(ctx, options, "ttl", mdns->ttl);
+    uint32_t priority = TJS_GetPropertyUint32(ctx, options, "priority", 0);
+    uint32_t weight = TJS_GetPropertyUint32(ctx, options, "weight", 0);
+
+    char buffer[MDNSJS_MAX_NAME];
+    if (!hostname && uv_os_gethostname(buffer, &(size_t) { sizeof(buffer) }) == 0) {
+        hostname = strdup(buffer);
+    }
+
+    char* type = text ? mdnsjs_strdup_name(text) : NULL;
+    char* host = hostname ? mdnsjs_strdup_name(hostname) : NULL;
+    struct in_addr address = mdns->address;
+
+    unsigned char txt[1024];
+    size_t txt_length = 0;
+
+    JSValue error = JS_UNDEFINED;
+    if (!label || !type || !host || strlen(label) + strlen(type) + 2 > MDNSJS_MAX_NAME) {
+        error = JS_ThrowTypeError(ctx, "invalid service name or type");
+
+    } else if (port == 0 || port > 65535) {
+        error = JS_ThrowRangeError(ctx, "invalid port");
+
+    } else if (address_text && inet_pton(AF_INET, address_text, &address) != 1) {
+        error = JS_ThrowTypeError(ctx, "invalid address");
+
+    } else {
+        JSValue value = JS_GetPropertyStr(ctx, options, "txt");
+        if (mdnsjs_encode_txt(ctx, value, txt, sizeof(txt), &txt_length)) {
+            error = JS_EXCEPTION;
+        }
+
+        JS_FreeValue(ctx, value);
+    }
+
+    mdnsjs_service_t* service = NULL;
+    if (JS_IsUndefined(error)) {
+        service = calloc(1, sizeof(*service));
+        if (!service) {
+            error = JS_ThrowOutOfMemory(ctx);
+        }
+    }
+
+    if (!JS_IsUndefined(error)) {
+        free(label);
+        free(text);
+        free(hostname);
+        free(address_text);
+        free(type);
+        free(host);
+        return error;
+    }
+
+    char name[MDNSJS_MAX_NAME + 8];
+    snprintf(name, sizeof(name), "%s.%s", label, type);
+
+    service->id = ++mdns->next_id;
+    service->mdns = mdns;
+    service->type = type;
+    service->host = host;
+
+    mdns_daemon_t* daemon = mdns->daemon;
+    mdns_record_t* record;
+
+    // 服务类型和服务实例, 共享记录
+    if (!mdnsjs_find_record(daemon, DISCO_NAME, QTYPE_PTR, type)) {
+        record = mdnsd_shared(daemon, DISCO_NAME, QTYPE_PTR, ttl);
+        mdnsd_set_host(daemon, record, type);
+        service->records[MDNSJS_RECORD_DISCO] = record;
+    }
+
+    record = mdnsd_shared(daemon, type, QTYPE_PTR, ttl);
+    mdnsd_set_host(daemon, record, name);
+    service->records[MDNSJS_RECORD_PTR] = record;
+
+    // 服务实例的地址和属性, 唯一记录
+    record = mdnsd_unique(daemon, name, QTYPE_SRV, ttl, mdnsjs_conflict_callback, service);
+    mdnsd_set_srv(daemon, record, priority, weight, port, host);
+    service->records[MDNSJS_RECORD_SRV] = record;
+
+    record = mdnsd_unique(daemon, name, QTYPE_TXT, MDNSJS_TXT_TTL, mdnsjs_conflict_callback, service);
+    mdnsd_set_raw(daemon, record, (char*)txt, txt_length);
+    service->records[MDNSJS_RECORD_TXT] = record;
+
+    // 主机地址, 多个服务共用
+    if (address.s_addr && !mdnsjs_find_record(daemon, host, QTYPE_A, NULL)) {
+        record = mdnsd_unique(daemon, host, QTYPE_A, ttl, mdnsjs_conflict_callback, service);
+        mdnsd_set_ip(daemon, record, address);
+        service->records[MDNSJS_RECORD_A] = record;
+    }
+
+    service->next = mdns->services;
+    mdns->services = service;
+
+    free(label);
+    free(text);
+    free(hostname);
+    free(address_text);
+
+    uv_timer_start(&mdns->timer, mdnsjs_timer_callback, 0, 0);
+    return JS_NewUint32(ctx, service->id);
+}
+
+/**
+ * `unpublish(id)`, 发送 goodbye 消息并删除服务
+ */
+static JSValue mdnsjs_unpublish(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mdnsjs_t* mdns = mdnsjs_get(ctx, this_val);
+    uint32_t id = 0;
+    if (!mdns || JS_ToUint32(ctx, &id, argc > 0 ? argv[0] : JS_UNDEFINED)) {
+        return JS_EXCEPTION;
+    }
+
+    for (mdnsjs_service_t* service = mdns->services; service; service = service->next) {
+        if (service->id == id) {
+            mdnsjs_service_free(service, 1);
+            uv_timer_start(&mdns->timer, mdnsjs_timer_callback, 0, 0);
+            return JS_TRUE;
+        }
+    }
+
+    return JS_FALSE;
+}
+
+/**
+ * `close()`, 取消所有的查询和服务, 正在进行的解析会失败
+ */
+static JSValue mdnsjs_close_method(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+    mdnsjs_t* mdns = JS_GetOpaque2(ctx, this_val, mdnsjs_class_id);
+    if (!mdns) {
+        return JS_EXCEPTION;
+
+    } else if (mdns->closing) {
+        return JS_UNDEFINED;
+    }
+
+    while (mdns->resolves) {
+        mdnsjs_resolve_done(mdns->resolves, UV_ECANCELED);
+    }
+
+    mdnsjs_close(mdns);
+    if (!mdns->dispatching) {
+        mdnsjs_free_events(mdns);
+        mdnsjs_sweep(mdns);
+    }
+
+    return JS_UNDEFINED;
+}
+
+static JSValue mdnsjs_event_get(JSContext* ctx, JSValueConst this_val, int magic)
+{
+    mdnsjs_t* mdns = JS_GetOpaque2(ctx, this_val, mdnsjs_class_id);
+    if (!mdns) {
+        return JS_EXCEPTION;
+    }
+
+    return JS_DupValue(ctx, mdns->events[magic]);
+}
+
+static JSValue mdnsjs_event_set(JSContext* ctx, JSValueConst this_val, JSValueConst value, int magic)
+{
+    mdnsjs_t* mdns = JS_GetOpaque2(ctx, this_val, mdnsjs_class_id);
+    if (!mdns) {
+        return JS_EXCEPTION;
+    }
+
+    if (JS_IsFunction(ctx, value) || JS_IsUndefined(value) || JS_IsNull(value)) {
+        JS_FreeValue(ctx, mdns->events[magic]);
+        mdns->events[magic] = JS_DupValue(ctx, value);
+    }
+
+    return JS_UNDEFINED;
+}
+
+static const JSCFunctionListEntry mdnsjs_proto_funcs[] = {
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "MDNS", JS_PROP_CONFIGURABLE),
+    TJS_CFUNC_DEF("browse", 2, mdnsjs_browse),
+    TJS_CFUNC_DEF("cancel", 1, mdnsjs_cancel),
+    TJS_CFUNC_DEF("close", 0, mdnsjs_close_method),
+    TJS_CFUNC_DEF("list", 2, mdnsjs_list),
+    TJS_CFUNC_DEF("publish", 1, mdnsjs_publish),
+    TJS_CFUNC_DEF("query", 3, mdnsjs_query_method),
+    TJS_CFUNC_DEF("resolve", 2, mdnsjs_resolve_method),
+    TJS_CFUNC_DEF("unpublish", 1, mdnsjs_unpublish),
+    TJS_CGETSET_MAGIC_DEF("onconflict", mdnsjs_event_get, mdnsjs_event_set, MDNSJS_EVENT_CONFLICT),
+    TJS_CGETSET_MAGIC_DEF("onerror", mdnsjs_event_get, mdnsjs_event_set, MDNSJS_EVENT_ERROR),
+};
+
+static const JSCFunctionListEntry mdnsjs_module_funcs[] = {
+    JS_PROP_INT32_DEF("A", QTYPE_A, JS_PROP_ENUMERABLE),
+    JS_PROP_INT32_DEF("CNAME", QTYPE_CNAME, JS_PROP_ENUMERABLE),
+    JS_PROP_INT32_DEF("PTR", QTYPE_PTR, JS_PROP_ENUMERABLE),
+    JS_PROP_INT32_DEF("TXT", QTYPE_TXT, JS_PROP_ENUMERABLE),
+    JS_PROP_INT32_DEF("SRV", QTYPE_SRV, JS_PROP_ENUMERABLE),
+    JS_PROP_INT32_DEF("ANY", QTYPE_ANY, JS_PROP_ENUMERABLE),
+};
+
+static int module_init(JSContext* ctx, JSModuleDef* module)
+{
+    JSRuntime* runtime = JS_GetRuntime(ctx);
+
+    JS_NewClassID(&mdnsjs_class_id);
+    JS_NewClass(runtime, mdnsjs_class_id, &mdnsjs_class);
+    JSValue proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, mdnsjs_proto_funcs, countof(mdnsjs_proto_funcs));
+    JS_SetClassProto(ctx, mdnsjs_class_id, proto);
+
+    // mdns
+    JSValue obj = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, obj, mdnsjs_module_funcs, countof(mdnsjs_module_funcs));
+
+    JSValue mdnsClass = JS_NewCFunction2(ctx, mdnsjs_constructor, "MDNS", 1, JS_CFUNC_constructor, 0);
+    JS_DefinePropertyValueStr(ctx, obj, "MDNS", mdnsClass, JS_PROP_C_W_E);
+    JS_SetModuleExport(ctx, module, "mdns", obj);
+    return 0;
+}
+
+#ifdef JS_SHARED_LIBRARY
+#define JS_INIT_MODULE js_init_module
+#else
+#define JS_INIT_MODULE js_init_module_mdns
+#endif
+
+JSModuleDef* JS_INIT_MODULE(JSContext* ctx, const char* module_name)
+{
+    JSModuleDef* module = JS_NewCModule(ctx, module_name, module_init);
+    if (!module) {
+        return NULL;
+    }
+
+    JS_AddModuleExport(ctx, module, "mdns");
+    return module;
+}
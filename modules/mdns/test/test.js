@@ -0,0 +1,102 @@
+// @ts-check
+import { mdns } from '@tjs/mdns';
+import * as assert from '@tjs/assert';
+
+// 使用非标准端口, 避免和系统的 mDNS 服务冲突
+const PORT = 25353;
+const TYPE = '_webthing._tcp';
+const COUNT = 50;
+
+/**
+ * @param {() => boolean} condition
+ */
+async function waitFor(condition) {
+    for (let i = 0; i < 500 && !condition(); i++) {
+        await new Promise(resolve => setTimeout(resolve, 10));
+    }
+
+    assert.ok(condition(), 'timeout');
+}
+
+async function main() {
+    const publisher = new mdns.MDNS({ port: PORT });
+    const browser = new mdns.MDNS({ port: PORT });
+
+    // 发布, 每个设备一个 mDNS 实例
+    const id = publisher.publish({ name: 'light', type: TYPE, port: 8080, host: 'device-0', address: '192.168.1.10', txt: { path: '/things', secure: true } });
+
+    /** @type any[] */
+    const devices = [];
+    for (let i = 0; i < COUNT; i++) {
+        const device = new mdns.MDNS({ port: PORT });
+        device.publish({ name: 'sensor-' + i, type: TYPE, port: 9000 + i, host: 'device-' + (i + 1), address: '192.168.2.' + (i + 1) });
+        devices.push(device);
+    }
+
+    // 增量的查找结果
+    /** @type Map<string, any> */
+    const found = new Map();
+    /** @type string[] */
+    const removed = [];
+    const browseId = browser.browse(TYPE, (answer) => {
+        if (answer.removed) {
+            removed.push(answer.target);
+            found.delete(answer.target);
+
+        } else {
+            found.set(answer.target, answer);
+        }
+    });
+
+    const start = Date.now();
+    await waitFor(() => found.size == COUNT + 1);
+    console.log('found', found.size, 'services in', Date.now() - start, 'ms');
+
+    const light = found.get('light._webthing._tcp.local.');
+    assert.equal(light.name, '_webthing._tcp.local.');
+    assert.equal(light.type, mdns.PTR);
+    assert.ok(light.ttl > 0);
+
+    // 解析
+    const result = await browser.resolve('light._webthing._tcp.local.');
+    assert.equal(result.host, 'device-0.local.');
+    assert.equal(result.port, 8080);
+    assert.equal(result.address, '192.168.1.10');
+    await waitFor(() => browser.list('light._webthing._tcp.local.', mdns.TXT).length > 0);
+    const [txt] = browser.list('light._webthing._tcp.local.', mdns.TXT);
+    assert.deepEqual(txt.txt, { path: '/things', secure: true });
+
+    // 第二个查询直接使用缓存中的应答
+    let cached = 0;
+    const cachedId = browser.browse(TYPE, () => cached++);
+    await waitFor(() => cached == COUNT + 1);
+    assert.ok(browser.cancel(cachedId));
+
+    const sensor = await browser.resolve('sensor-7._webthing._tcp', 1000);
+    assert.equal(sensor.port, 9007);
+    assert.equal(sensor.host, 'device-8.local.');
+    assert.equal(sensor.address, '192.168.2.8');
+
+    // 不存在的服务
+    const error = await browser.resolve('unknown._webthing._tcp', 200).catch(error => error);
+    assert.equal(error.errno, -110);
+
+    // 取消发布时发送 goodbye 消息
+    assert.ok(publisher.unpublish(id));
+    await waitFor(() => removed.length == 1);
+    assert.equal(removed[0], 'light._webthing._tcp.local.');
+
+    assert.ok(browser.cancel(browseId));
+    assert.ok(!browser.cancel(browseId));
+
+    for (const device of devices) {
+        device.close();
+    }
+
+    publisher.close();
+    browser.close();
+    assert.throws(() => browser.browse(TYPE, () => { }), TypeError);
+    console.log('done');
+}
+
+main();
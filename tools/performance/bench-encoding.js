@@ -0,0 +1,100 @@
+#!/usr/bin/env tjs
+// @ts-check
+/// <reference path ="../../core/types/index.d.ts" />
+
+/**
+ * UTF-8 编码和解码性能测试
+ *
+ * 统计 TextEncoder/TextDecoder 处理 ASCII, 拉丁字母和中文文本的吞吐量 (MB/s),
+ * 以及 hex/base64 编码和解码二进制数据的吞吐量 (按二进制数据的大小计算)
+ *
+ * 用法: tjs bench-encoding.js [size] [rounds]
+ */
+import * as encoding from '@tjs/encoding';
+
+/**
+ * @param {string} name
+ * @param {number} bytes 每轮处理的字节数
+ * @param {number} rounds
+ * @param {() => any} callback
+ */
+function bench(name, bytes, rounds, callback) {
+    // 预热
+    callback();
+
+    const start = performance.now();
+    for (let i = 0; i < rounds; i++) {
+        callback();
+    }
+
+    const elapsed = (performance.now() - start) / 1000;
+    const result = { name, bytes, rounds, 'MB/s': Math.round(bytes * rounds / elapsed / 1024 / 1024) };
+    console.log(JSON.stringify(result));
+    return result;
+}
+
+/**
+ * @param {number} size
+ * @param {number} rounds
+ */
+function benchBinary(size, rounds) {
+    const data = new Uint8Array(size);
+    for (let i = 0; i < size; i++) {
+        data[i] = (i * 2654435761) >>> 24;
+    }
+
+    for (const format of ['hex', 'base64', 'base64url']) {
+        const text = encoding.encode(data, format);
+        bench(`encode ${format}`, size, rounds, () => encoding.encode(data, format));
+        bench(`decode ${format}`, size, rounds, () => encoding.decode(text, format));
+    }
+
+    // 每 76 个字符换行 (MIME)
+    const lines = encoding.encode(data, 'base64').replace(/.{76}/g, '$&\r\n');
+    bench('decode base64 mime', size, rounds, () => encoding.decode(lines, 'base64'));
+}
+
+function main() {
+    const size = Number(process.argv[2]) || 64 * 1024;
+    const rounds = Number(process.argv[3]) || 1000;
+
+    const encoder = new TextEncoder();
+    const decoder = new TextDecoder();
+
+    const samples = {
+        ascii: '{"jsonrpc":"2.0","method":"update","params":{"value":123}}\n',
+        latin1: 'Grüße aus Köln, café crème, naïve façade. ',
+        cjk: '设备状态更新: 温度 23.5℃, 湿度 45%, 在线 😁\n'
+    };
+
+    for (const [type, sample] of Object.entries(samples)) {
+        const text = sample.repeat(Math.ceil(size / sample.length)).slice(0, size);
+        const data = encoder.encode(text);
+        const output = new Uint8Array(data.byteLength);
+
+        bench(`encode ${type}`, data.byteLength, rounds, () => encoder.encode(text));
+        if (encoder.encodeInto) {
+            bench(`encodeInto ${type}`, data.byteLength, rounds, () => encoder.encodeInto(text, output));
+        }
+
+        bench(`decode ${type}`, data.byteLength, rounds, () => decoder.decode(data));
+
+        // 模拟从网络接收的数据块
+        const chunks = [];
+        for (let i = 0; i < data.byteLength; i += 1500) {
+            chunks.push(data.subarray(i, i + 1500));
+        }
+
+        bench(`decode stream ${type}`, data.byteLength, rounds, () => {
+            for (const chunk of chunks) {
+                decoder.decode(chunk, { stream: true });
+            }
+
+            decoder.decode();
+        });
+    }
+
+    benchBinary(size, rounds);
+}
+
+main();
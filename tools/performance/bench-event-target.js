@@ -0,0 +1,80 @@
+#!/usr/bin/env tjs
+// @ts-check
+/// <reference path ="../../core/types/index.d.ts" />
+
+/**
+ * EventTarget 事件分发性能测试
+ *
+ * 统计不同场景下每秒可以分发的事件数 (events/sec)
+ *
+ * 用法: tjs bench-event-target.js [count]
+ */
+import { defineEventAttribute } from '@tjs/event-target';
+
+class Target extends EventTarget {}
+defineEventAttribute(Target.prototype, 'message');
+
+/**
+ * @param {string} name
+ * @param {number} count
+ * @param {(target: Target) => void} setup
+ * @param {(target: Target, index: number) => void} dispatch
+ */
+function bench(name, count, setup, dispatch) {
+    const target = new Target();
+    setup(target);
+
+    // 预热
+    for (let i = 0; i < 1000; i++) {
+        dispatch(target, i);
+    }
+
+    const start = performance.now();
+    for (let i = 0; i < count; i++) {
+        dispatch(target, i);
+    }
+
+    const elapsed = (performance.now() - start) / 1000;
+    const result = { name, count, 'events/sec': Math.round(count / elapsed) };
+    console.log(JSON.stringify(result));
+    return result;
+}
+
+function main() {
+    const count = Number(process.argv[2]) || 200000;
+
+    let total = 0;
+    const listener = (/** @type {any} */ event) => { total += event.data; };
+
+    /** @param {Target} target @param {number} i */
+    const dispatchMessage = (target, i) => {
+        target.dispatchEvent(new MessageEvent('message', { data: i }));
+    };
+
+    /** @param {Target} target @param {number} i */
+    const dispatchIfListened = (target, i) => {
+        if (target.hasEventListener('message')) {
+            target.dispatchEvent(new MessageEvent('message', { data: i }));
+        }
+    };
+
+    bench('no listener', count, () => {}, dispatchMessage);
+    bench('no listener (hasEventListener)', count, () => {}, dispatchIfListened);
+    bench('onmessage', count, (target) => { target.onmessage = listener; }, dispatchMessage);
+    bench('addEventListener', count, (target) => { target.addEventListener('message', listener); }, dispatchMessage);
+    bench('3 listeners', count, (target) => {
+        target.onmessage = listener;
+        target.addEventListener('message', () => {});
+        target.addEventListener('message', () => {}, { passive: true });
+    }, dispatchMessage);
+
+    bench('get onmessage', count, (target) => {
+        target.addEventListener('message', () => {});
+        target.addEventListener('message', () => {});
+        target.onmessage = listener;
+    }, (target) => { total += target.onmessage ? 1 : 0; });
+
+    return total;
+}
+
+main();
@@ -0,0 +1,79 @@
+#!/usr/bin/env tjs
+// @ts-check
+/// <reference path ="../../core/types/index.d.ts" />
+
+/**
+ * 目录遍历性能测试
+ *
+ * 统计逐项读取目录, 批量读取目录, 遍历目录树以及 `cp -r`, `rm -r` 所需的时间
+ *
+ * 用法: tjs bench-fs.js [files]
+ */
+import * as fs from '@tjs/fs';
+import { join } from '@tjs/path';
+
+/**
+ * @param {string} name
+ * @param {number} count
+ * @param {() => Promise<any>} callback
+ */
+async function bench(name, count, callback) {
+    const start = performance.now();
+    await callback();
+    const elapsed = performance.now() - start;
+
+    const result = { name, count, 'time(ms)': Math.round(elapsed), 'entries/sec': Math.round(count * 1000 / elapsed) };
+    console.log(JSON.stringify(result));
+    return result;
+}
+
+async function main() {
+    const files = Number(process.argv[2]) || 20000;
+    const root = await fs.mkdtemp('/tmp/tjs-bench-fs-XXXXXX');
+    const copy = root + '-copy';
+
+    // 每个子目录 100 个文件
+    for (let i = 0; i < files; i++) {
+        const dirname = join(root, String(Math.floor(i / 100)));
+        if (i % 100 == 0) {
+            await fs.mkdir(dirname);
+        }
+
+        const file = await fs.open(join(dirname, String(i)), 'w');
+        await file.close();
+    }
+
+    const dirs = Math.ceil(files / 100);
+    const total = files + dirs;
+
+    try {
+        await bench('dir.next', total, async () => {
+            for await (const entry of await fs.opendir(root)) {
+                for await (const child of await fs.opendir(join(root, entry.name))) {
+                    // 逐项读取
+                }
+            }
+        });
+
+        await bench('readdir', total, async () => {
+            for (const entry of await fs.readdir(root)) {
+                await fs.readdir(join(root, entry.name));
+            }
+        });
+
+        await bench('walk', total, async () => {
+            for await (const entries of fs.walk(root)) {
+                // 批量读取
+            }
+        });
+
+        await bench('cp -r', total, () => fs.cp(root, copy, { recursive: true }));
+        await bench('rm -r', total, () => fs.rm(copy, { recursive: true }));
+
+    } finally {
+        await fs.rm(root, { recursive: true, force: true });
+        await fs.rm(copy, { recursive: true, force: true });
+    }
+}
+
+main();
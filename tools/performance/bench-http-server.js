@@ -0,0 +1,171 @@
+#!/usr/bin/env tjs
+// @ts-check
+/// <reference path ="../../core/types/index.d.ts" />
+
+/**
+ * HTTP 服务器性能测试 (类似 wrk)
+ *
+ * 分别启动 JS 和原生 HTTP 服务器 (子进程)，然后用多个 keep-alive 连接持续发送请求，
+ * 统计每秒请求数 (requests/sec) 和 p99 延迟
+ *
+ * 用法: tjs bench-http-server.js [connections] [seconds] [js|native]
+ */
+import * as native from '@tjs/native';
+import * as http from '@tjs/http';
+
+const BASE_PORT = 28180;
+const REQUEST = 'GET /hello HTTP/1.1\r\nHost: localhost\r\n\r\n';
+const RESPONSE_MARK = 'HTTP/1.1 ';
+
+/** 原生句柄不会自己保持引用，需要在测试期间保存起来以免被 GC 回收 */
+const handles = new Set();
+
+/**
+ * 服务端: 以指定模式运行 HTTP 服务器
+ * @param {string} mode 'js' 或 'native'
+ * @param {number} port
+ */
+async function serve(mode, port) {
+    const options = { port, native: mode == 'native' };
+    const server = http.createServer(options, async (req, res) => {
+        await res.send('Hello, World!');
+    });
+
+    await server.start();
+    handles.add(server);
+}
+
+/**
+ * 客户端: 单个 keep-alive 连接，每次只有一个未完成的请求
+ * @param {number} port
+ * @param {number} deadline
+ * @param {number[]} latencies
+ */
+async function runConnection(port, deadline, latencies) {
+    const client = new native.TCP();
+    handles.add(client);
+    const textDecoder = new TextDecoder();
+    const request = new TextEncoder().encode(REQUEST);
+
+    let started = 0;
+    let tail = '';
+
+    await new Promise((resolve, reject) => {
+        function sendRequest() {
+            if (performance.now() >= deadline) {
+                client.close();
+                resolve(undefined);
+                return;
+            }
+
+            started = performance.now();
+            client.write(request).catch(reject);
+        }
+
+        client.onerror = reject;
+        client.onmessage = (data) => {
+            if (data == null) {
+                resolve(undefined);
+                return;
+            }
+
+            // 每个应答都很小，通过状态行计数即可
+            const text = tail + textDecoder.decode(data);
+            let count = 0;
+            let pos = text.indexOf(RESPONSE_MARK);
+            while (pos >= 0) {
+                count++;
+                pos = text.indexOf(RESPONSE_MARK, pos + RESPONSE_MARK.length);
+            }
+
+            tail = text.slice(-RESPONSE_MARK.length + 1);
+            if (count > 0) {
+                latencies.push(performance.now() - started);
+                sendRequest();
+            }
+        };
+
+        client.connect({ address: '127.0.0.1', port, family: 4 }).then(sendRequest, reject);
+    });
+
+    handles.delete(client);
+}
+
+/**
+ * @param {number[]} values
+ * @param {number} percent
+ */
+function percentile(values, percent) {
+    if (values.length == 0) {
+        return 0;
+    }
+
+    const sorted = Float64Array.from(values).sort();
+    const index = Math.min(sorted.length - 1, Math.ceil(sorted.length * percent / 100) - 1);
+    return sorted[Math.max(0, index)];
+}
+
+/**
+ * @param {string} mode
+ * @param {number} port
+ * @param {number} connections
+ * @param {number} seconds
+ */
+async function bench(mode, port, connections, seconds) {
+    const script = process.argv[1];
+    const child = native.spawn([native.exepath(), script, 'serve', mode, String(port)], {});
+
+    // 等待服务器启动
+    await new Promise((resolve) => setTimeout(resolve, 500));
+
+    try {
+        /** @type number[] */
+        const latencies = [];
+        const start = performance.now();
+        const deadline = start + seconds * 1000;
+
+        const tasks = [];
+        for (let i = 0; i < connections; i++) {
+            tasks.push(runConnection(port, deadline, latencies));
+        }
+
+        await Promise.all(tasks);
+
+        const elapsed = (performance.now() - start) / 1000;
+        const total = latencies.length;
+        const result = {
+            mode,
+            connections,
+            requests: total,
+            'requests/sec': Math.round(total / elapsed),
+            'p50(ms)': percentile(latencies, 50).toFixed(3),
+            'p99(ms)': percentile(latencies, 99).toFixed(3)
+        };
+
+        console.log(JSON.stringify(result));
+        return result;
+
+    } finally {
+        child.kill(native.signals.SIGTERM);
+        await child.wait();
+    }
+}
+
+async function main() {
+    const args = process.argv.slice(2);
+    if (args[0] == 'serve') {
+        await serve(args[1], Number(args[2]));
+        return;
+    }
+
+    const connections = Number(args[0]) || 16;
+    const seconds = Number(args[1]) || 5;
+
+    const modes = args[2] ? [args[2]] : ['js', 'native'];
+
+    for (let i = 0; i < modes.length; i++) {
+        await bench(modes[i], BASE_PORT + i, connections, seconds);
+    }
+}
+
+main().catch((error) => console.log(error));
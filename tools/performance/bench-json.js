@@ -0,0 +1,89 @@
+#!/usr/bin/env tjs
+// @ts-check
+/// <reference path ="../../core/types/index.d.ts" />
+
+/**
+ * JSON 解析性能测试
+ *
+ * 比较先用 TextDecoder 解码再 JSON.parse 和直接从 UTF-8 字节解析 (util.parseJSON) 的吞吐量 (MB/s),
+ * 以及 JSON.stringify + TextEncoder 和增量序列化 (json.stringifyChunks) 的吞吐量, 文档大小分别为 1KB 和 1MB
+ *
+ * 用法: tjs bench-json.js [rounds]
+ */
+import * as json from '@tjs/json';
+import * as util from '@tjs/util';
+
+/**
+ * @param {string} name
+ * @param {number} bytes 每轮处理的字节数
+ * @param {number} rounds
+ * @param {() => any} callback
+ */
+function bench(name, bytes, rounds, callback) {
+    // 预热
+    callback();
+
+    const start = performance.now();
+    for (let i = 0; i < rounds; i++) {
+        callback();
+    }
+
+    const elapsed = (performance.now() - start) / 1000;
+    const result = { name, bytes, rounds, 'MB/s': Math.round(bytes * rounds / elapsed / 1024 / 1024) };
+    console.log(JSON.stringify(result));
+    return result;
+}
+
+/**
+ * 生成指定大小的 JSON 文档
+ * @param {number} size 文档的字节数
+ * @param {boolean} cjk 是否包含中文
+ */
+function createDocument(size, cjk) {
+    const encoder = new TextEncoder();
+    const items = [];
+    let length = 2;
+    for (let i = 0; length < size; i++) {
+        const item = {
+            id: i,
+            name: cjk ? '传感器-' + i : 'sensor-' + i,
+            online: (i % 3) != 0,
+            values: [i * 0.5, i + 1, -i],
+            status: { temperature: 23.5, humidity: 45, text: cjk ? '运行正常' : 'running' }
+        };
+
+        items.push(item);
+        length += encoder.encode(JSON.stringify(item)).byteLength + 1;
+    }
+
+    return JSON.stringify(items);
+}
+
+function main() {
+    const rounds = Number(process.argv[2]) || 0;
+
+    const encoder = new TextEncoder();
+    const decoder = new TextDecoder();
+
+    for (const size of [1024, 1024 * 1024]) {
+        const count = rounds || Math.max(10, Math.round(64 * 1024 * 1024 / size));
+
+        for (const cjk of [false, true]) {
+            const data = encoder.encode(createDocument(size, cjk));
+            const type = (size >= 1024 * 1024 ? '1MB' : '1KB') + (cjk ? ' cjk' : ' ascii');
+
+            bench(`TextDecoder+JSON.parse ${type}`, data.byteLength, count, () => JSON.parse(decoder.decode(data)));
+            bench(`parseJSON ${type}`, data.byteLength, count, () => util.parseJSON(data));
+
+            const value = JSON.parse(decoder.decode(data));
+            bench(`JSON.stringify+TextEncoder ${type}`, data.byteLength, count, () => encoder.encode(JSON.stringify(value)));
+            bench(`stringifyChunks ${type}`, data.byteLength, count, () => {
+                for (const chunk of json.stringifyChunks(value)) {
+                    chunk.byteLength;
+                }
+            });
+        }
+    }
+}
+
+main();
@@ -0,0 +1,65 @@
+#!/usr/bin/env tjs
+// @ts-check
+/// <reference path ="../../core/types/index.d.ts" />
+
+/**
+ * 日志输出性能测试
+ *
+ * 统计不同输出方式下每秒可以输出的日志条数 (logs/sec), 以及被丢弃的日志条数
+ *
+ * 用法: tjs bench-logs.js [count]
+ */
+import * as fs from '@tjs/fs';
+import * as logs from '@tjs/logs';
+
+/**
+ * @param {string} name
+ * @param {number} count
+ * @param {() => void} log
+ */
+function bench(name, count, log) {
+    const before = logs.stats();
+
+    const start = performance.now();
+    for (let i = 0; i < count; i++) {
+        log();
+    }
+
+    const elapsed = (performance.now() - start) / 1000;
+    logs.flush();
+
+    const after = logs.stats();
+    const result = {
+        name,
+        count,
+        'logs/sec': Math.round(count / elapsed),
+        dropped: after.dropped - before.dropped
+    };
+
+    console.print(JSON.stringify(result));
+    return result;
+}
+
+function main() {
+    const count = Number(process.argv[2]) || 100000;
+    const filename = `/tmp/tjs-bench-logs-${process.pid}.log`;
+    const data = { name: 'test', value: 100 };
+
+    try {
+        logs.config({ type: 'file', filename, level: 'info' });
+        bench('file', count, () => console.info('message', data));
+        bench('file (filtered)', count, () => console.debug('message', data));
+
+        logs.config({ type: 'file', filename, level: 'info', capacity: 64 });
+        bench('file (capacity = 64)', count, () => console.info('message', data));
+
+        const logger = logs.logger;
+        bench('logger.write', count, () => logger.write(6, 'message'));
+
+    } finally {
+        logs.logger.close();
+        fs.rm(filename, { force: true });
+    }
+}
+
+main();
@@ -0,0 +1,171 @@
+#!/usr/bin/env tjs
+// @ts-check
+/// <reference path ="../../core/types/index.d.ts" />
+
+/**
+ * 内嵌 MQTT 服务器转发性能测试
+ *
+ * 多个订阅者 (默认 100 个) 订阅同一个主题, 分别测试:
+ * - 在本进程内直接调用 broker.publish()
+ * - 发布者通过 Unix 域套接字或 TCP 连接发布
+ *
+ * 订阅者只统计收到的字节数, 不解析消息, 尽量减少测试本身的开销
+ *
+ * 用法: tjs bench-mqtt-broker.js [count] [subscribers]
+ */
+import * as fs from '@tjs/fs';
+import * as native from '@tjs/native';
+import * as mqtt from '@tjs/mqtt';
+
+const BATCH_SIZE = 1000;
+
+/**
+ * @param {number} ms
+ */
+function sleep(ms) {
+    return new Promise(resolve => setTimeout(resolve, ms));
+}
+
+/**
+ * @param {string} text
+ */
+function encodeString(text) {
+    const data = new TextEncoder().encode(text);
+    return [data.length >> 8, data.length & 0xff, ...data];
+}
+
+/**
+ * 创建只统计接收字节数的订阅者
+ * @param {any} address
+ * @param {string} filter
+ * @param {number} index
+ */
+async function createSubscriber(address, filter, index) {
+    const socket = (typeof address == 'string') ? new native.Pipe() : new native.TCP();
+    await socket.connect(address);
+
+    const subscriber = { socket, received: 0 };
+    socket.onmessage = (data) => {
+        if (data) {
+            subscriber.received += data.byteLength;
+        }
+    };
+
+    const body = [0, 1, ...encodeString(filter), 0];
+    await socket.write(native.mqtt.encodeConnect({ clientId: 'sub' + index, keepalive: 0 }));
+    await socket.write(new Uint8Array([0x82, body.length, ...body]));
+    return subscriber;
+}
+
+/**
+ * @param {{received: number}[]} subscribers
+ * @param {(index: number) => number} bytes 每个订阅者应收到的字节数
+ */
+async function waitForSubscribers(subscribers, bytes) {
+    const timeout = Date.now() + 60 * 1000;
+    while (subscribers.some((subscriber, index) => subscriber.received < bytes(index))) {
+        if (Date.now() > timeout) {
+            throw new Error('timeout');
+        }
+
+        await sleep(1);
+    }
+}
+
+/**
+ * @param {string} name
+ * @param {mqtt.MQTTBroker} broker
+ * @param {{received: number}[]} subscribers
+ * @param {number} count
+ * @param {number} packetSize
+ * @param {(index: number) => any} publish
+ */
+async function bench(name, broker, subscribers, count, packetSize, publish) {
+    const base = subscribers.map(subscriber => subscriber.received);
+    const dropped = broker.stats()?.messagesDropped || 0;
+    const start = performance.now();
+
+    for (let i = 0; i < count; i += BATCH_SIZE) {
+        await publish(Math.min(BATCH_SIZE, count - i));
+    }
+
+    await waitForSubscribers(subscribers, (index) => base[index] + count * packetSize);
+    const elapsed = (performance.now() - start) / 1000;
+
+    const deliveries = count * subscribers.length;
+    const result = {
+        name,
+        subscribers: subscribers.length,
+        'msg/s': Math.round(count / elapsed),
+        'deliveries/s': Math.round(deliveries / elapsed),
+        dropped: (broker.stats()?.messagesDropped || 0) - dropped
+    };
+
+    console.log(JSON.stringify(result));
+    return result;
+}
+
+async function main() {
+    const count = Number(process.argv[2]) || 20000;
+    const subscriberCount = Number(process.argv[3]) || 100;
+    const payload = JSON.stringify({ temperature: 25.5, humidity: 60, time: Date.now() });
+    const topic = 'device/test/data';
+    const packetSize = native.mqtt.encodePublish(topic, payload, 0, 0, 0, 0).byteLength;
+
+    const path = `/tmp/bench_mqtt_broker_${process.pid}.sock`;
+    await fs.unlink(path).catch(() => { });
+
+    const broker = mqtt.createBroker({ maxQueueSize: 64 * 1024 * 1024 });
+    broker.listen({ path });
+    broker.listen({ host: '127.0.0.1', port: 0 });
+
+    /** @type any */
+    const tcpAddress = broker.addresses()[1];
+
+    for (const transport of ['unix', 'tcp']) {
+        const address = (transport == 'unix') ? path : tcpAddress;
+
+        const subscribers = [];
+        for (let i = 0; i < subscriberCount; i++) {
+            subscribers.push(await createSubscriber(address, 'device/+/data', i));
+        }
+
+        // 等待 CONNACK 和 SUBACK
+        await waitForSubscribers(subscribers, () => 4 + 5);
+
+        // 1. 本进程内直接发布
+        await bench(`broker.publish (${transport})`, broker, subscribers, count, packetSize, async (size) => {
+            for (let i = 0; i < size; i++) {
+                broker.publish(topic, payload);
+            }
+
+            await sleep(0);
+        });
+
+        // 2. 通过客户端发布
+        const publisher = mqtt.connect(transport == 'unix' ? { path, keepalive: 0 } : { host: '127.0.0.1', port: tcpAddress.port, keepalive: 0 });
+        await publisher?.ready;
+
+        await bench(`client.publish (${transport})`, broker, subscribers, count, packetSize, async (size) => {
+            const promises = [];
+            publisher?.cork();
+            for (let i = 0; i < size; i++) {
+                promises.push(publisher?.publish(topic, payload));
+            }
+
+            await publisher?.uncork();
+            await Promise.all(promises);
+        });
+
+        await publisher?.close();
+        for (const subscriber of subscribers) {
+            subscriber.socket.close();
+        }
+
+        await sleep(100);
+    }
+
+    broker.close();
+}
+
+main();
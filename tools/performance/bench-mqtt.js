@@ -0,0 +1,172 @@
+#!/usr/bin/env tjs
+// @ts-check
+/// <reference path ="../../core/types/index.d.ts" />
+
+/**
+ * MQTT 发布性能测试
+ *
+ * 在本机启动一个简单的 MQTT 服务端替身 (只回复 CONNACK, PUBACK 和 PINGRESP), 比较:
+ * - 直接逐个编码并写入 Socket, 没有客户端的开销 (参考值)
+ * - MQTTClient 合并写入 QoS 0 消息
+ * - MQTTClient 在不同发送窗口 (maxInflight) 下的 QoS 1 消息
+ *
+ * 用法: tjs bench-mqtt.js [count]
+ */
+import * as native from '@tjs/native';
+import * as mqtt from '@tjs/mqtt';
+import * as net from '@tjs/net';
+
+const PORT = 28183;
+
+const CONNACK = new Uint8Array([0x20, 0x02, 0x00, 0x00]);
+const PINGRESP = new Uint8Array([0xd0, 0x00]);
+
+/**
+ * 创建服务端替身
+ */
+function createBroker() {
+    /** @type Set<net.Socket> 保持连接的引用, 避免被回收 */
+    const connections = new Set();
+
+    const server = net.createServer((/** @type any */ event) => {
+        /** @type net.Socket */
+        const connection = event.connection;
+        const parser = new native.mqtt.Parser();
+        connections.add(connection);
+
+        /** @type number[] */
+        let acks = [];
+        parser.onmessage = (message) => {
+            const type = message.type;
+            if (type == native.mqtt.CONNECT) {
+                connection.write(CONNACK);
+
+            } else if (type == native.mqtt.PINGREQ) {
+                connection.write(PINGRESP);
+
+            } else if (type == native.mqtt.PUBLISH && message.qos > 0) {
+                // @ts-ignore
+                acks.push(message.packetId);
+            }
+        };
+
+        connection.onmessage = (/** @type any */ event) => {
+            const data = event.data;
+            if (!data) {
+                connections.delete(connection);
+                connection.close();
+                return;
+            }
+
+            parser.execute(data);
+
+            // 同一块数据中的消息一起应答
+            if (acks.length > 0) {
+                const packet = new Uint8Array(acks.length * 4);
+                acks.forEach((pid, index) => {
+                    packet.set([0x40, 0x02, pid >> 8, pid & 0xff], index * 4);
+                });
+
+                acks = [];
+                connection.write(packet);
+            }
+        };
+    });
+
+    server.listen({ address: '127.0.0.1', port: PORT });
+    return server;
+}
+
+/**
+ * @param {string} name
+ * @param {number} count
+ * @param {() => Promise<any>} callback
+ */
+async function bench(name, count, callback) {
+    const start = performance.now();
+    await callback();
+    const elapsed = (performance.now() - start) / 1000;
+
+    const result = { name, count, 'msg/s': Math.round(count / elapsed) };
+    console.log(JSON.stringify(result));
+    return result;
+}
+
+/**
+ * @param {mqtt.MQTTClientOptions} options
+ */
+async function connect(options) {
+    const client = mqtt.connect({ host: '127.0.0.1', port: PORT, keepalive: 0, ...options });
+    client.onerror = (/** @type any */ event) => console.log('error:', event.error);
+    await client.ready;
+    return client;
+}
+
+async function main() {
+    const count = Number(process.argv[2]) || 100000;
+    const payload = JSON.stringify({ temperature: 25.5, humidity: 60, time: Date.now() });
+    const topic = 'device/test/data';
+
+    const server = createBroker();
+
+    // 1. 参考值: 逐个编码, 逐个写入
+    {
+        const socket = net.connect(PORT, '127.0.0.1');
+        await socket.connected;
+        await socket.write(native.mqtt.encodeConnect({ clientId: 'bench' }));
+
+        await bench('encodePublish + write (qos 0)', count, async () => {
+            for (let i = 0; i < count; i++) {
+                await socket.write(native.mqtt.encodePublish(topic, payload, 0, 0, 0, 0));
+            }
+        });
+
+        socket.close();
+    }
+
+    // 2. 合并写入
+    {
+        const client = await connect({});
+        await bench('client.publish (qos 0)', count, async () => {
+            const promises = [];
+            for (let i = 0; i < count; i++) {
+                promises.push(client.publish(topic, payload));
+            }
+
+            await Promise.all(promises);
+        });
+
+        await bench('client.publish + cork (qos 0)', count, async () => {
+            const promises = [];
+            client.cork();
+            for (let i = 0; i < count; i++) {
+                promises.push(client.publish(topic, payload));
+            }
+
+            await client.uncork();
+            await Promise.all(promises);
+        });
+
+        await client.close();
+    }
+
+    // 3. 发送窗口
+    for (const maxInflight of [1, 16, 64]) {
+        const client = await connect({ maxInflight });
+        const total = Math.min(count, maxInflight * 1000);
+        await bench(`client.publish (qos 1, maxInflight ${maxInflight})`, total, async () => {
+            const promises = [];
+            for (let i = 0; i < total; i++) {
+                promises.push(client.publish(topic, payload, { qos: 1 }));
+            }
+
+            await Promise.all(promises);
+        });
+
+        await client.close();
+    }
+
+    server.close();
+}
+
+main();
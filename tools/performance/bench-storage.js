@@ -0,0 +1,72 @@
+#!/usr/bin/env tjs
+// @ts-check
+/// <reference path ="../../core/types/index.d.ts" />
+
+/**
+ * FileStorage 性能测试
+ *
+ * 统计写入吞吐量 (writes/sec), 以及重新打开 (重放日志) 所需的时间
+ *
+ * 用法: tjs bench-storage.js [keys] [rounds]
+ */
+import * as fs from '@tjs/fs';
+import * as storage from '@tjs/storage';
+
+/**
+ * @param {string} filename
+ * @param {number} keys
+ * @param {number} rounds 每个键写入的次数
+ */
+async function benchWrite(filename, keys, rounds) {
+    const profile = new storage.FileStorage(filename);
+    await profile.open();
+
+    const start = performance.now();
+    for (let round = 0; round < rounds; round++) {
+        for (let i = 0; i < keys; i++) {
+            profile.setItem('key-' + i, { round, value: 'value-' + i });
+        }
+
+        await profile.flush();
+    }
+
+    const elapsed = (performance.now() - start) / 1000;
+    const writes = keys * rounds;
+    const fileSize = profile.size;
+    await profile.close();
+
+    return { name: 'write', writes, 'writes/sec': Math.round(writes / elapsed), fileSize };
+}
+
+/**
+ * @param {string} filename
+ */
+async function benchOpen(filename) {
+    const profile = new storage.FileStorage(filename);
+
+    const start = performance.now();
+    await profile.open();
+    const elapsed = performance.now() - start;
+
+    const result = { name: 'open', keys: profile.length, records: profile.lineCount, 'time(ms)': Math.round(elapsed) };
+    await profile.close();
+    return result;
+}
+
+async function main() {
+    const keys = Number(process.argv[2]) || 100000;
+    const rounds = Number(process.argv[3]) || 3;
+    const filename = `/tmp/tjs-bench-storage-${process.pid}.db`;
+
+    await fs.rm(filename, { force: true });
+
+    try {
+        console.log(JSON.stringify(await benchWrite(filename, keys, rounds)));
+        console.log(JSON.stringify(await benchOpen(filename)));
+
+    } finally {
+        await fs.rm(filename, { force: true });
+    }
+}
+
+main();
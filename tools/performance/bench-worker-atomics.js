@@ -0,0 +1,173 @@
+#!/usr/bin/env tjs
+// @ts-check
+/// <reference path ="../../core/types/index.d.ts" />
+
+/**
+ * Worker 之间的 ping-pong 延迟测试
+ *
+ * 比较 postMessage (序列化并复制) 和 SharedArrayBuffer + Atomics 的往返延迟 (us) 及每秒往返次数,
+ * 以及每次传递 1MB 数据时复制 ArrayBuffer 和只传递 SharedArrayBuffer 引用的差别
+ *
+ * 用法: tjs bench-worker-atomics.js [rounds]
+ *
+ * 同一个文件也作为工作线程的脚本, 工作线程中 globalThis.postMessage 是一个函数
+ * 两个线程都阻塞等待时, 至少需要 2 个 CPU 核才有意义
+ */
+import * as os from '@tjs/os';
+
+const isWorker = typeof globalThis.postMessage === 'function';
+
+/**
+ * 轮流递增 state[0]: 值为偶数时由 parity 为 0 的一方递增, 奇数时由 parity 为 1 的一方递增
+ * @param {Int32Array} state
+ * @param {number} parity
+ * @param {number} rounds
+ */
+function pingPongBlocking(state, parity, rounds) {
+    const end = rounds * 2;
+    for (let value = parity; value < end; value += 2) {
+        let current = Atomics.load(state, 0);
+        while (current !== value) {
+            Atomics.wait(state, 0, current);
+            current = Atomics.load(state, 0);
+        }
+
+        Atomics.store(state, 0, value + 1);
+        Atomics.notify(state, 0);
+    }
+}
+
+/**
+ * 和 pingPongBlocking 相同, 但是使用 Atomics.waitAsync, 可以在主线程中使用
+ * @param {Int32Array} state
+ * @param {number} parity
+ * @param {number} rounds
+ */
+async function pingPongAsync(state, parity, rounds) {
+    const end = rounds * 2;
+    for (let value = parity; value < end; value += 2) {
+        let current = Atomics.load(state, 0);
+        while (current !== value) {
+            const result = Atomics.waitAsync(state, 0, current);
+            if (result.async) {
+                await result.value;
+            }
+
+            current = Atomics.load(state, 0);
+        }
+
+        Atomics.store(state, 0, value + 1);
+        Atomics.notify(state, 0);
+    }
+}
+
+function workerMain() {
+    self.onmessage = (/** @type any */ event) => {
+        const message = event.data;
+        if (message.type === 'echo') {
+            self.postMessage(message);
+
+        } else if (message.type === 'atomics') {
+            const state = new Int32Array(message.buffer);
+            const start = performance.now();
+            pingPongBlocking(state, message.parity, message.rounds);
+            self.postMessage({ type: 'done', elapsed: performance.now() - start });
+        }
+    };
+}
+
+/**
+ * @param {string} name
+ * @param {number} rounds
+ * @param {number} elapsed 毫秒
+ */
+function report(name, rounds, elapsed) {
+    const result = {
+        name,
+        rounds,
+        'latency(us)': Math.round(elapsed * 1000 / rounds * 100) / 100,
+        'round-trips/sec': Math.round(rounds / elapsed * 1000)
+    };
+
+    console.log(JSON.stringify(result));
+    return result;
+}
+
+/**
+ * 等待下一个消息
+ * @param {Worker} worker
+ * @returns {Promise<any>}
+ */
+function nextMessage(worker) {
+    return new Promise(resolve => {
+        worker.onmessage = (/** @type any */ event) => resolve(event.data);
+    });
+}
+
+/**
+ * postMessage 往返, 每次都序列化并复制 data
+ * @param {Worker} worker
+ * @param {string} name
+ * @param {number} rounds
+ * @param {any} data
+ */
+async function benchPostMessage(worker, name, rounds, data) {
+    const start = performance.now();
+    for (let i = 0; i < rounds; i++) {
+        worker.postMessage({ type: 'echo', i, data });
+        await nextMessage(worker);
+    }
+
+    return report(name, rounds, performance.now() - start);
+}
+
+async function main() {
+    const rounds = Number(process.argv[2]) || 10000;
+
+    // @ts-ignore
+    const filename = import.meta.url.slice(7); // strip "file://"
+    const worker1 = new Worker(filename);
+    const worker2 = new Worker(filename);
+    console.log(JSON.stringify({ cpus: os.cpus().length, rounds }));
+
+    // 预热
+    await benchPostMessage(worker1, 'warm-up', 100, null);
+    console.log('');
+
+    await benchPostMessage(worker1, 'postMessage', rounds, null);
+
+    // 主线程使用 Atomics.waitAsync, 工作线程使用 Atomics.wait
+    let state = new Int32Array(new SharedArrayBuffer(4));
+    const done = nextMessage(worker1);
+    const start = performance.now();
+    worker1.postMessage({ type: 'atomics', buffer: state.buffer, parity: 1, rounds });
+    await pingPongAsync(state, 0, rounds);
+    report('main waitAsync <-> worker wait', rounds, performance.now() - start);
+    await done;
+
+    // 两个工作线程都使用 Atomics.wait
+    state = new Int32Array(new SharedArrayBuffer(4));
+    const done1 = nextMessage(worker1);
+    const done2 = nextMessage(worker2);
+    worker2.postMessage({ type: 'atomics', buffer: state.buffer, parity: 1, rounds });
+    worker1.postMessage({ type: 'atomics', buffer: state.buffer, parity: 0, rounds });
+    const [result] = await Promise.all([done1, done2]);
+    report('worker wait <-> worker wait', rounds, result.elapsed);
+
+    // 每次传递 1MB 数据
+    console.log('');
+    const size = 1024 * 1024;
+    const count = Math.max(10, Math.round(rounds / 100));
+    await benchPostMessage(worker1, 'postMessage 1MB ArrayBuffer', count, new ArrayBuffer(size));
+    await benchPostMessage(worker1, 'postMessage 1MB SharedArrayBuffer', count, new SharedArrayBuffer(size));
+
+    worker1.terminate();
+    worker2.terminate();
+}
+
+if (isWorker) {
+    workerMain();
+
+} else {
+    main();
+}
@@ -0,0 +1,71 @@
+#!/usr/bin/env tjs
+// @ts-check
+/// <reference path ="../../core/types/index.d.ts" />
+
+/**
+ * 小文件写入性能测试
+ *
+ * 比较 open/write/close, 单个工作项写入, 原子写入, 以及同步到磁盘时单独同步和合并同步的吞吐量 (writes/sec)
+ *
+ * 用法: tjs bench-writefile.js [count] [concurrency]
+ */
+import * as fs from '@tjs/fs';
+import { join } from '@tjs/path';
+
+/**
+ * @param {string} name
+ * @param {number} count
+ * @param {number} concurrency 同时进行的写入数
+ * @param {(index: number) => Promise<any>} write
+ */
+async function bench(name, count, concurrency, write) {
+    let index = 0;
+    async function next() {
+        while (index < count) {
+            await write(index++);
+        }
+    }
+
+    const start = performance.now();
+    const tasks = [];
+    for (let i = 0; i < concurrency; i++) {
+        tasks.push(next());
+    }
+
+    await Promise.all(tasks);
+    const elapsed = (performance.now() - start) / 1000;
+
+    const result = { name, count, concurrency, 'writes/sec': Math.round(count / elapsed) };
+    console.log(JSON.stringify(result));
+    return result;
+}
+
+async function main() {
+    const count = Number(process.argv[2]) || 2000;
+    const concurrency = Number(process.argv[3]) || 8;
+    const root = await fs.mkdtemp('/tmp/tjs-bench-writefile-XXXXXX');
+    const data = JSON.stringify({ state: 'running', values: new Array(32).fill(0) });
+
+    /** @param {number} index */
+    const filename = (index) => join(root, 'state-' + (index % 64) + '.json');
+
+    try {
+        await bench('open/write/close', count, concurrency, async (index) => {
+            const file = await fs.open(filename(index), 'w');
+            await file.write(data);
+            await file.close();
+        });
+
+        await bench('writeFile', count, concurrency, (index) => fs.writeFile(filename(index), data));
+        await bench('writeFile atomic', count, concurrency, (index) => fs.writeFile(filename(index), data, { atomic: true }));
+
+        const syncCount = Math.ceil(count / 10);
+        await bench('writeFile atomic fsync', syncCount, concurrency, (index) => fs.writeFile(filename(index), data, { atomic: true, fsync: true }));
+        await bench('writeFile atomic fsync group', syncCount, concurrency, (index) => fs.writeFile(filename(index), data, { atomic: true, fsync: 'group' }));
+
+    } finally {
+        await fs.rm(root, { recursive: true, force: true });
+    }
+}
+
+main();